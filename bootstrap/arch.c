@@ -22,7 +22,9 @@
  */
 
 #include "arch.h"
+#include "intern.h"
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * arch_init -- initialize the architecture-specific data structure
@@ -63,12 +65,147 @@ arch_init(arch_cpu_t cpu, arch_loader_t loader)
         return NULL;
     }
 
-    arch->assemble = NULL;
-    arch->export = NULL;
-
     return arch;
 }
 
+/*
+ * arch_code_release -- release the code generated by the assembler
+ */
+void
+arch_code_release(arch_code_t *code)
+{
+    free(code->text.s);
+    free(code->data.s);
+    free(code->sym.syms);
+    free(code->rel.rels);
+    code->text.s = NULL;
+    code->text.size = 0;
+    code->data.s = NULL;
+    code->data.size = 0;
+    code->sym.syms = NULL;
+    code->sym.n = 0;
+    code->rel.rels = NULL;
+    code->rel.n = 0;
+}
+
+/*
+ * _symtype -- get the type of the symbol table entry of a symbol
+ */
+static int
+_symtype(arch_sym_type_t type)
+{
+    switch ( type ) {
+    case ARCH_SYM_LOCAL:
+        return COMPILER_SYMBOL_BSS;
+    case ARCH_SYM_GLOBAL:
+        return COMPILER_SYMBOL_DATA;
+    case ARCH_SYM_FUNC:
+        return COMPILER_SYMBOL_CODE;
+    case ARCH_SYM_EXTERN:
+        return COMPILER_SYMBOL_EXTERN;
+    default:
+        return -1;
+    }
+}
+
+/*
+ * arch_symidx_init -- index the symbols of the code by their labels, and
+ * resolve the external symbols defined in the code; return -1 if a label is
+ * defined twice
+ */
+int
+arch_symidx_init(arch_symidx_t *idx, const arch_code_t *code)
+{
+    const arch_sym_t *sym;
+    compiler_symbol_t *ent;
+    ssize_t found;
+    int type;
+    int pass;
+    int i;
+
+    symbol_table_init(&idx->table);
+    idx->ents = malloc(sizeof(compiler_symbol_t) * (code->sym.n + 1));
+    idx->res = malloc(sizeof(int) * (code->sym.n + 1));
+    if ( idx->ents == NULL || idx->res == NULL ) {
+        arch_symidx_release(idx);
+        return -1;
+    }
+
+    /* The definitions first, so that an external symbol of the same label
+       resolves to the definition */
+    for ( pass = 0; pass < 2; pass++ ) {
+        for ( i = 0; i < code->sym.n; i++ ) {
+            sym = &code->sym.syms[i];
+            if ( (sym->type == ARCH_SYM_EXTERN) != (pass == 1) ) {
+                continue;
+            }
+            type = _symtype(sym->type);
+            ent = &idx->ents[i];
+            memset(ent, 0, sizeof(compiler_symbol_t));
+            ent->label = intern(sym->label);
+            if ( type < 0 || ent->label == NULL ) {
+                arch_symidx_release(idx);
+                return -1;
+            }
+            ent->type = type;
+            ent->u.bss.n = sym->size;
+
+            found = symbol_table_lookup(&idx->table, ent->label);
+            if ( found >= 0 ) {
+                if ( pass == 0 ) {
+                    /* Defined twice */
+                    arch_symidx_release(idx);
+                    return -1;
+                }
+                idx->res[i] = symbol_table_get(&idx->table, found)
+                    - idx->ents;
+                continue;
+            }
+            if ( symbol_table_add(&idx->table, ent) < 0 ) {
+                arch_symidx_release(idx);
+                return -1;
+            }
+            idx->res[i] = i;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * arch_symidx_lookup -- get the index of the symbol defining the label, or -1
+ * if not found
+ */
+int
+arch_symidx_lookup(const arch_symidx_t *idx, const char *label)
+{
+    ssize_t found;
+
+    label = intern(label);
+    if ( label == NULL ) {
+        return -1;
+    }
+    found = symbol_table_lookup(&idx->table, label);
+    if ( found < 0 ) {
+        return -1;
+    }
+
+    return symbol_table_get(&idx->table, found) - idx->ents;
+}
+
+/*
+ * arch_symidx_release -- release the index of the symbols
+ */
+void
+arch_symidx_release(arch_symidx_t *idx)
+{
+    symbol_table_release(&idx->table);
+    free(idx->ents);
+    free(idx->res);
+    idx->ents = NULL;
+    idx->res = NULL;
+}
+
 /*
  * Local variables:
  * tab-width: 4
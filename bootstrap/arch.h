@@ -25,6 +25,7 @@
 #define _ARCH_H
 
 #include "ir.h"
+#include "symbol.h"
 #include <stdio.h>
 #include <stdint.h>
 #include <unistd.h>
@@ -35,6 +36,7 @@
 typedef enum {
     ARCH_CPU_X86_64,
     ARCH_CPU_AARCH64,
+    ARCH_CPU_DFVM,
 } arch_cpu_t;
 
 /*
@@ -69,6 +71,7 @@ typedef enum {
     ARCH_SYM_LOCAL,
     ARCH_SYM_GLOBAL,
     ARCH_SYM_FUNC,
+    ARCH_SYM_EXTERN,
 } arch_sym_type_t;
 
 /*
@@ -76,7 +79,7 @@ typedef enum {
  */
 typedef struct {
     arch_sym_type_t type;
-    char *label;
+    const char *label;
     off_t pos;
     size_t size;
     uint64_t *ref;
@@ -115,13 +118,52 @@ typedef struct {
 
 } arch_code_t;
 
+/*
+ * Index of the symbols of the code by their labels; res is the index of the
+ * symbol defining the label of each symbol, which differs from the symbol
+ * itself only for an external symbol defined in the code
+ */
+typedef struct {
+    compiler_symbol_table_t table;
+    compiler_symbol_t *ents;
+    int *res;
+} arch_symidx_t;
+
+/*
+ * Code loaded to the memory (see ld/jit/jit.c); the text is executable and
+ * not writable, and the data followed by the bss is writable and not
+ * executable
+ */
+typedef struct {
+    uint8_t *base;
+    size_t size;
+    struct {
+        uint8_t *s;
+        size_t size;
+    } text;
+    struct {
+        uint8_t *s;
+        size_t size;
+    } data;
+    struct {
+        uint8_t *s;
+        size_t size;
+    } bss;
+    /* Addresses of the symbols of the code */
+    struct {
+        int n;
+        arch_symidx_t idx;
+        void **addrs;
+    } sym;
+} arch_jit_t;
+
 /*
  * Architecture-specific function
  */
 typedef struct {
     arch_cpu_t cpu;
     arch_loader_t loader;
-    int (*assemble)(ir_object_t *);
+    int (*assemble)(ir_object_t *, arch_code_t *);
     int (*export)(FILE *, arch_code_t *);
 } arch_t;
 
@@ -132,16 +174,24 @@ extern "C" {
 /* arch.c */
 arch_t *
 arch_init(arch_cpu_t, arch_loader_t);
+void
+arch_code_release(arch_code_t *);
+int
+arch_symidx_init(arch_symidx_t *, const arch_code_t *);
+int
+arch_symidx_lookup(const arch_symidx_t *, const char *);
+void
+arch_symidx_release(arch_symidx_t *);
 
 /* arch/x86-64.c */
 int
 x86_64_test(uint8_t *);
 int
-x86_64_assemble(ir_object_t *);
+x86_64_assemble(ir_object_t *, arch_code_t *);
 
 /* arch/aarch64.c */
 int
-aarch64_assemble(ir_object_t *);
+aarch64_assemble(ir_object_t *, arch_code_t *);
 
 /* ld/mach-o.c */
 int
@@ -151,6 +201,14 @@ mach_o_export(FILE *, arch_code_t *);
 int
 elf_export(FILE *, arch_code_t *);
 
+/* ld/jit.c */
+arch_jit_t *
+jit_load(const arch_code_t *, void *(*)(const char *));
+void *
+jit_sym(const arch_jit_t *, const char *);
+void
+jit_release(arch_jit_t *);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,7 +21,7 @@
  * SOFTWARE.
  */
 
-#include "../../ir.h"
+#include "../../arch.h"
 #include <stdint.h>
 #include <string.h>
 
@@ -29,7 +29,7 @@
  * aarch64_assemble -- assemble from IR to aarch64 code
  */
 int
-aarch64_assemble(ir_object_t *obj)
+aarch64_assemble(ir_object_t *obj, arch_code_t *code)
 {
     return -1;
 }
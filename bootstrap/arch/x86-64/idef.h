@@ -0,0 +1,331 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _ARCH_X86_64_IDEF_H
+#define _ARCH_X86_64_IDEF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Instruction definitions; the rules in the .idef files are converted by
+ * idefgen into the static tables of idef_table.c at build time.
+ */
+
+#define OPCODE_REXW         0x101
+#define OPCODE_DIGIT_PREFIX 0x200
+#define OPCODE_REGISTER     0x300
+#define OPCODE_CB           0x401
+#define OPCODE_CW           0x402
+#define OPCODE_CD           0x404
+#define OPCODE_CP           0x406
+#define OPCODE_CO           0x408
+#define OPCODE_CT           0x40a
+#define OPCODE_IB           0x501
+#define OPCODE_IW           0x502
+#define OPCODE_ID           0x504
+#define OPCODE_IO           0x508
+#define OPCODE_RB           0x601
+#define OPCODE_RW           0x602
+#define OPCODE_RD           0x604
+#define OPCODE_RO           0x608
+#define OPCODE_ST_PREFIX    0x700
+
+#define OPERAND_REL8        0x101
+#define OPERAND_REL16       0x102
+#define OPERAND_REL32       0x104
+#define OPERAND_REL64       0x108
+#define OPERAND_PTR16_16    0x202
+#define OPERAND_PTR16_32    0x204
+#define OPERAND_PTR16_64    0x208
+#define OPERAND_R8          0x301
+#define OPERAND_R16         0x302
+#define OPERAND_R32         0x304
+#define OPERAND_R64         0x308
+#define OPERAND_IMM8        0x401
+#define OPERAND_IMM16       0x402
+#define OPERAND_IMM32       0x404
+#define OPERAND_IMM64       0x408
+#define OPERAND_RM8         0x501
+#define OPERAND_RM16        0x502
+#define OPERAND_RM32        0x504
+#define OPERAND_RM64        0x508
+#define OPERAND_M           0x600
+#define OPERAND_M8          0x601
+#define OPERAND_M16         0x602
+#define OPERAND_M32         0x604
+#define OPERAND_M64         0x608
+#define OPERAND_M128        0x610
+#define OPERAND_M16_16      0x702
+#define OPERAND_M16_32      0x704
+#define OPERAND_M16_64      0x708
+#define OPERAND_M16A16      0x802
+#define OPERAND_M16A32      0x804
+#define OPERAND_M16A64      0x808
+#define OPERAND_M32A32      0x814
+#define OPERAND_MOFFS8      0x901
+#define OPERAND_MOFFS16     0x902
+#define OPERAND_MOFFS32     0x904
+#define OPERAND_MOFFS64     0x908
+#define OPERAND_SREG        0xa00
+#define OPERAND_M32FP       0xb04
+#define OPERAND_M64FP       0xb08
+#define OPERAND_M80FP       0xb0a
+#define OPERAND_M16INT      0xc02
+#define OPERAND_M32INT      0xc04
+#define OPERAND_M64INT      0xc08
+#define OPERAND_ST(i)       (0xd00 + (i))
+#define OPERAND_MM          0xe00
+#define OPERAND_MM_M32      0xe04
+#define OPERAND_MM_M64      0xe08
+#define OPERAND_XMM         0xf00
+#define OPERAND_XMM_M32     0xf04
+#define OPERAND_XMM_M64     0xf08
+#define OPERAND_XMM_M128    0xf10
+#define OPERAND_AL          0x1001
+#define OPERAND_AX          0x1002
+#define OPERAND_EAX         0x1004
+#define OPERAND_RAX         0x1008
+#define OPERAND_CL          0x1101
+
+#define OPERAND_CLASS(x)    ((x) >> 8)
+#define OPERAND_BYTES(x)    ((x) & 0xff)
+#define OPERAND_CLASS_REL   0x01
+#define OPERAND_CLASS_PTR   0x02
+#define OPERAND_CLASS_R     0x03
+#define OPERAND_CLASS_IMM   0x04
+#define OPERAND_CLASS_RM    0x05
+#define OPERAND_CLASS_M     0x06
+#define OPERAND_CLASS_ACC   0x10
+#define OPERAND_CLASS_CL    0x11
+
+#define OPCODE_MAX_SIZE     16
+#define OPERAND_MAX_NUM     2
+
+/*
+ * Encode type
+ */
+enum encode_type {
+    ENCODE_M,
+    ENCODE_RM,
+    ENCODE_MR,
+    ENCODE_OI,
+    ENCODE_MI,
+    ENCODE_D,
+    ENCODE_I,
+    ENCODE_O,
+    ENCODE_MC,
+    ENCODE_ZO,
+};
+#define ENCODE_NUM          (ENCODE_ZO + 1)
+
+/*
+ * Opcode
+ */
+struct opcode {
+    size_t size;
+    int opcode[OPCODE_MAX_SIZE];
+};
+
+/*
+ * Encode: M
+ */
+struct encode_m {
+    int m;
+};
+
+/*
+ * Encode: RM
+ */
+struct encode_rm {
+    int r;
+    int rm;
+};
+
+/*
+ * Encode: MR
+ */
+struct encode_mr {
+    int rm;
+    int r;
+};
+
+/*
+ * Encode: OI
+ */
+struct encode_oi {
+    int r;
+    int imm;
+};
+
+/*
+ * Encode: MI
+ */
+struct encode_mi {
+    int rm;
+    int imm;
+};
+
+/*
+ * Encode: D
+ */
+struct encode_d {
+    int ptr;
+};
+
+/*
+ * Encode: I
+ */
+struct encode_i {
+    int acc;
+    int imm;
+};
+
+/*
+ * Encode: O
+ */
+struct encode_o {
+    int r;
+};
+
+/*
+ * Encode: MC (the count is in CL)
+ */
+struct encode_mc {
+    int rm;
+    int c;
+};
+
+/*
+ * Encode
+ */
+struct encode {
+    enum encode_type type;
+    union {
+        struct encode_m m;
+        struct encode_rm rm;
+        struct encode_mr mr;
+        struct encode_oi oi;
+        struct encode_mi mi;
+        struct encode_d d;
+        struct encode_i i;
+        struct encode_o o;
+        struct encode_mc mc;
+    } u;
+};
+
+/*
+ * Rule tuple; the operands are in the order of the instruction, and len is
+ * the length of the encoded instruction without the operand-size prefix,
+ * ModR/M displacement, and SIB
+ */
+struct rule {
+    struct encode encode;
+    struct opcode op;
+    int noperands;
+    int operands[OPERAND_MAX_NUM];
+    int len;
+};
+
+/*
+ * Key of the rule index; the kinds of the operands and the operation size,
+ * which is the size of the first register or memory operand
+ */
+#define IDEF_KIND_NONE      0
+#define IDEF_KIND_REG       1
+#define IDEF_KIND_MEM       2
+#define IDEF_KIND_IMM       3
+#define IDEF_SIZE_NONE      0
+#define IDEF_SIZE_8         1
+#define IDEF_SIZE_16        2
+#define IDEF_SIZE_32        3
+#define IDEF_SIZE_64        4
+#define IDEF_KEY(k0, k1, sz)    ((k0) | ((k1) << 2) | ((sz) << 4))
+#define IDEF_NKEYS          (1 << 7)
+
+/*
+ * Rules for a mnemonic; the rules are sorted by the encode type, and the
+ * rules of the encode type t are rules[idx[t]] to rules[idx[t + 1] - 1].
+ * The candidate rules for the operands of the key k are
+ * rules[cands[bucket[k]]] to rules[cands[bucket[k + 1] - 1]] in the order of
+ * the length of the encoding.
+ */
+struct mnemonic {
+    const char *mnemonic;
+    const struct rule *rules;
+    size_t nrules;
+    uint16_t idx[ENCODE_NUM + 1];
+    const uint16_t *cands;
+    uint16_t bucket[IDEF_NKEYS + 1];
+};
+
+/*
+ * Rules; the mnemonics are placed in a perfect hash table, where the slot of
+ * a mnemonic is idef_hash(mnemonic, seed) & (size - 1) and the empty slots
+ * have NULL mnemonics
+ */
+struct x86_64_instr_ruleset {
+    uint32_t seed;
+    size_t size;
+    const struct mnemonic *mnemonics;
+};
+
+/*
+ * idef_hash -- compute the seeded FNV-1a hash of a mnemonic
+ */
+static __inline__ uint32_t
+idef_hash(const char *s, uint32_t seed)
+{
+    uint32_t h;
+
+    h = 2166136261U ^ seed;
+    while ( *s ) {
+        h ^= (uint8_t)*s;
+        h *= 16777619U;
+        s++;
+    }
+
+    return h;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* idef_table.c (generated) */
+extern const struct x86_64_instr_ruleset x86_64_ruleset;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ARCH_X86_64_IDEF_H */
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,2145 @@
+/* Generated by idefgen; do not edit. */
+
+#include "idef.h"
+
+static const struct rule _rules_adc[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x12, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x13, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x13, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x13, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x10, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x11, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x11, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x11, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x202, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x202, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x202, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x202, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x202, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x202, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x202, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x14, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x15, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x15, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x15, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_adc[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_adcx[] = {
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 5, { 0x66, 0xf, 0x38, 0xf6, 0x300 } },
+      2, { 0x304, 0x504 }, 5 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 6, { 0x66, 0x101, 0xf, 0x38, 0xf6, 0x300 } },
+      2, { 0x308, 0x508 }, 6 },
+};
+
+static const uint16_t _cands_adcx[] = {
+    0, 0, 1, 1,
+};
+
+static const struct rule _rules_add[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x2, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x3, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x3, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x3, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x0, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x1, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x1, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x1, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x200, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x200, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x200, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x200, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x200, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x200, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x200, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x4, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x5, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x5, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x5, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_add[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_and[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x22, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x23, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x23, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x23, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x20, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x21, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x21, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x21, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x204, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x204, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x204, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x204, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x204, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x204, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x204, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x24, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x25, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x25, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x25, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_and[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_call[] = {
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 2, { 0xff, 0x202 } },
+      1, { 0x508 }, 2 },
+    { { ENCODE_M, { .m = { 0x702 } } },
+      { 2, { 0xff, 0x203 } },
+      1, { 0x702 }, 2 },
+    { { ENCODE_M, { .m = { 0x704 } } },
+      { 2, { 0xff, 0x203 } },
+      1, { 0x704 }, 2 },
+    { { ENCODE_M, { .m = { 0x708 } } },
+      { 3, { 0x101, 0xff, 0x203 } },
+      1, { 0x708 }, 3 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 2, { 0xe8, 0x404 } },
+      1, { 0x104 }, 5 },
+};
+
+static const uint16_t _cands_call[] = {
+    4, 0, 0,
+};
+
+static const struct rule _rules_cdq[] = {
+    { { ENCODE_ZO, { .m = { 0 } } },
+      { 1, { 0x99 } },
+      0, { }, 1 },
+};
+
+static const uint16_t _cands_cdq[] = {
+    0,
+};
+
+static const struct rule _rules_cmp[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x3a, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x3b, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x3b, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x3b, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x38, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x39, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x39, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x39, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x207, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x207, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x207, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x207, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x207, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x207, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x207, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x3c, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x3d, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x3d, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x3d, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_cmp[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_cqo[] = {
+    { { ENCODE_ZO, { .m = { 0 } } },
+      { 2, { 0x101, 0x99 } },
+      0, { }, 2 },
+};
+
+static const uint16_t _cands_cqo[] = {
+    0,
+};
+
+static const struct rule _rules_dec[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xfe, 0x201 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xff, 0x201 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xff, 0x201 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xff, 0x201 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_dec[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_div[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x206 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x206 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x206 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x206 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_div[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_idiv[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x207 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x207 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x207 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x207 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_idiv[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_imul[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x205 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x205 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x205 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x205 } },
+      1, { 0x508 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 3, { 0xf, 0xaf, 0x300 } },
+      2, { 0x302, 0x502 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 3, { 0xf, 0xaf, 0x300 } },
+      2, { 0x304, 0x504 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 4, { 0x101, 0xf, 0xaf, 0x300 } },
+      2, { 0x308, 0x508 }, 4 },
+};
+
+static const uint16_t _cands_imul[] = {
+    0, 0, 1, 1, 4, 4, 2, 2, 5, 5, 3, 3,
+    6, 6,
+};
+
+static const struct rule _rules_inc[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xfe, 0x200 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xff, 0x200 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xff, 0x200 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xff, 0x200 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_inc[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_ja[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x77, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x87, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_ja[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jae[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x73, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x83, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jae[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jb[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x72, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x82, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jb[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jbe[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x76, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x86, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jbe[] = {
+    0, 1,
+};
+
+static const struct rule _rules_je[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x74, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x84, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_je[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jg[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x7f, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x8f, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jg[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jge[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x7d, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x8d, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jge[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jl[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x7c, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x8c, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jl[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jle[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x7e, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x8e, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jle[] = {
+    0, 1,
+};
+
+static const struct rule _rules_jmp[] = {
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 2, { 0xff, 0x204 } },
+      1, { 0x508 }, 2 },
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0xeb, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 2, { 0xe9, 0x404 } },
+      1, { 0x104 }, 5 },
+    { { ENCODE_D, { .d = { 0x702 } } },
+      { 2, { 0xff, 0x205 } },
+      1, { 0x702 }, 2 },
+    { { ENCODE_D, { .d = { 0x704 } } },
+      { 2, { 0xff, 0x205 } },
+      1, { 0x704 }, 2 },
+    { { ENCODE_D, { .d = { 0x708 } } },
+      { 3, { 0x101, 0xff, 0x205 } },
+      1, { 0x708 }, 3 },
+};
+
+static const uint16_t _cands_jmp[] = {
+    1, 2, 0, 0,
+};
+
+static const struct rule _rules_jne[] = {
+    { { ENCODE_D, { .d = { 0x101 } } },
+      { 2, { 0x75, 0x401 } },
+      1, { 0x101 }, 2 },
+    { { ENCODE_D, { .d = { 0x104 } } },
+      { 3, { 0xf, 0x85, 0x404 } },
+      1, { 0x104 }, 6 },
+};
+
+static const uint16_t _cands_jne[] = {
+    0, 1,
+};
+
+static const struct rule _rules_lea[] = {
+    { { ENCODE_RM, { .rm = { 0x302, 0x600 } } },
+      { 2, { 0x8d, 0x300 } },
+      2, { 0x302, 0x600 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x600 } } },
+      { 2, { 0x8d, 0x300 } },
+      2, { 0x304, 0x600 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x600 } } },
+      { 3, { 0x101, 0x8d, 0x300 } },
+      2, { 0x308, 0x600 }, 3 },
+};
+
+static const uint16_t _cands_lea[] = {
+    0, 1, 2,
+};
+
+static const struct rule _rules_leave[] = {
+    { { ENCODE_ZO, { .m = { 0 } } },
+      { 1, { 0xc9 } },
+      0, { }, 1 },
+};
+
+static const uint16_t _cands_leave[] = {
+    0,
+};
+
+static const struct rule _rules_mov[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x8a, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x8b, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x8b, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x8b, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x88, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x89, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x89, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x89, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_OI, { .oi = { 0x301, 0x401 } } },
+      { 3, { 0xb0, 0x601, 0x501 } },
+      2, { 0x301, 0x401 }, 2 },
+    { { ENCODE_OI, { .oi = { 0x302, 0x402 } } },
+      { 3, { 0xb8, 0x602, 0x502 } },
+      2, { 0x302, 0x402 }, 3 },
+    { { ENCODE_OI, { .oi = { 0x304, 0x404 } } },
+      { 3, { 0xb8, 0x604, 0x504 } },
+      2, { 0x304, 0x404 }, 5 },
+    { { ENCODE_OI, { .oi = { 0x308, 0x408 } } },
+      { 4, { 0x101, 0xb8, 0x604, 0x508 } },
+      2, { 0x308, 0x408 }, 10 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0xc6, 0x200, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0xc7, 0x200, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0xc7, 0x200, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0xc7, 0x200, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+};
+
+static const uint16_t _cands_mov[] = {
+    0, 4, 4, 0, 8, 12, 12, 1, 5, 5, 1, 9,
+    13, 13, 2, 6, 6, 2, 10, 14, 14, 3, 7, 7,
+    3, 15, 11, 15,
+};
+
+static const struct rule _rules_movsx[] = {
+    { { ENCODE_RM, { .rm = { 0x302, 0x501 } } },
+      { 3, { 0xf, 0xbe, 0x300 } },
+      2, { 0x302, 0x501 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x501 } } },
+      { 3, { 0xf, 0xbe, 0x300 } },
+      2, { 0x304, 0x501 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x501 } } },
+      { 4, { 0x101, 0xf, 0xbe, 0x300 } },
+      2, { 0x308, 0x501 }, 4 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x502 } } },
+      { 3, { 0xf, 0xbf, 0x300 } },
+      2, { 0x304, 0x502 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x502 } } },
+      { 4, { 0x101, 0xf, 0xbf, 0x300 } },
+      2, { 0x308, 0x502 }, 4 },
+};
+
+static const uint16_t _cands_movsx[] = {
+    0, 0, 1, 3, 1, 3, 2, 4, 2, 4,
+};
+
+static const struct rule _rules_movsxd[] = {
+    { { ENCODE_RM, { .rm = { 0x308, 0x504 } } },
+      { 3, { 0x101, 0x63, 0x300 } },
+      2, { 0x308, 0x504 }, 3 },
+};
+
+static const uint16_t _cands_movsxd[] = {
+    0, 0,
+};
+
+static const struct rule _rules_movzx[] = {
+    { { ENCODE_RM, { .rm = { 0x302, 0x501 } } },
+      { 3, { 0xf, 0xb6, 0x300 } },
+      2, { 0x302, 0x501 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x501 } } },
+      { 3, { 0xf, 0xb6, 0x300 } },
+      2, { 0x304, 0x501 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x501 } } },
+      { 4, { 0x101, 0xf, 0xb6, 0x300 } },
+      2, { 0x308, 0x501 }, 4 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x502 } } },
+      { 3, { 0xf, 0xb7, 0x300 } },
+      2, { 0x304, 0x502 }, 3 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x502 } } },
+      { 4, { 0x101, 0xf, 0xb7, 0x300 } },
+      2, { 0x308, 0x502 }, 4 },
+};
+
+static const uint16_t _cands_movzx[] = {
+    0, 0, 1, 3, 1, 3, 2, 4, 2, 4,
+};
+
+static const struct rule _rules_mul[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x204 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x204 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x204 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x204 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_mul[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_neg[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x203 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x203 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x203 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x203 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_neg[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_nop[] = {
+    { { ENCODE_ZO, { .m = { 0 } } },
+      { 1, { 0x90 } },
+      0, { }, 1 },
+};
+
+static const uint16_t _cands_nop[] = {
+    0,
+};
+
+static const struct rule _rules_not[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 2, { 0xf6, 0x202 } },
+      1, { 0x501 }, 2 },
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xf7, 0x202 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x504 } } },
+      { 2, { 0xf7, 0x202 } },
+      1, { 0x504 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 3, { 0x101, 0xf7, 0x202 } },
+      1, { 0x508 }, 3 },
+};
+
+static const uint16_t _cands_not[] = {
+    0, 0, 1, 1, 2, 2, 3, 3,
+};
+
+static const struct rule _rules_or[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0xa, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0xb, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0xb, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0xb, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x8, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x9, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x9, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x9, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x201, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x201, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x201, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x201, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x201, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x201, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x201, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0xc, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0xd, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0xd, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0xd, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_or[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_pop[] = {
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0x8f, 0x200 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 2, { 0x8f, 0x200 } },
+      1, { 0x508 }, 2 },
+    { { ENCODE_O, { .o = { 0x302 } } },
+      { 2, { 0x58, 0x602 } },
+      1, { 0x302 }, 1 },
+    { { ENCODE_O, { .o = { 0x308 } } },
+      { 2, { 0x58, 0x604 } },
+      1, { 0x308 }, 1 },
+};
+
+static const uint16_t _cands_pop[] = {
+    2, 0, 0, 3, 1, 1,
+};
+
+static const struct rule _rules_push[] = {
+    { { ENCODE_M, { .m = { 0x502 } } },
+      { 2, { 0xff, 0x206 } },
+      1, { 0x502 }, 2 },
+    { { ENCODE_M, { .m = { 0x508 } } },
+      { 2, { 0xff, 0x206 } },
+      1, { 0x508 }, 2 },
+    { { ENCODE_O, { .o = { 0x302 } } },
+      { 2, { 0x50, 0x602 } },
+      1, { 0x302 }, 1 },
+    { { ENCODE_O, { .o = { 0x308 } } },
+      { 2, { 0x50, 0x604 } },
+      1, { 0x308 }, 1 },
+};
+
+static const uint16_t _cands_push[] = {
+    2, 0, 0, 3, 1, 1,
+};
+
+static const struct rule _rules_ret[] = {
+    { { ENCODE_ZO, { .m = { 0 } } },
+      { 1, { 0xc3 } },
+      0, { }, 1 },
+};
+
+static const uint16_t _cands_ret[] = {
+    0,
+};
+
+static const struct rule _rules_sar[] = {
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0xc0, 0x207, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0xc1, 0x207, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0xc1, 0x207, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0xc1, 0x207, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_MC, { .mc = { 0x501, 0x1101 } } },
+      { 2, { 0xd2, 0x207 } },
+      2, { 0x501, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x502, 0x1101 } } },
+      { 2, { 0xd3, 0x207 } },
+      2, { 0x502, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x504, 0x1101 } } },
+      { 2, { 0xd3, 0x207 } },
+      2, { 0x504, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x508, 0x1101 } } },
+      { 3, { 0x101, 0xd3, 0x207 } },
+      2, { 0x508, 0x1101 }, 3 },
+};
+
+static const uint16_t _cands_sar[] = {
+    4, 4, 0, 0, 5, 5, 1, 1, 6, 6, 2, 2,
+    7, 7, 3, 3,
+};
+
+static const struct rule _rules_seta[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x97, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_seta[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setae[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x93, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setae[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setb[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x92, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setb[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setbe[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x96, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setbe[] = {
+    0, 0,
+};
+
+static const struct rule _rules_sete[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x94, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_sete[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setg[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x9f, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setg[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setge[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x9d, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setge[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setl[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x9c, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setl[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setle[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x9e, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setle[] = {
+    0, 0,
+};
+
+static const struct rule _rules_setne[] = {
+    { { ENCODE_M, { .m = { 0x501 } } },
+      { 3, { 0xf, 0x95, 0x200 } },
+      1, { 0x501 }, 3 },
+};
+
+static const uint16_t _cands_setne[] = {
+    0, 0,
+};
+
+static const struct rule _rules_shl[] = {
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0xc0, 0x204, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0xc1, 0x204, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0xc1, 0x204, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0xc1, 0x204, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_MC, { .mc = { 0x501, 0x1101 } } },
+      { 2, { 0xd2, 0x204 } },
+      2, { 0x501, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x502, 0x1101 } } },
+      { 2, { 0xd3, 0x204 } },
+      2, { 0x502, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x504, 0x1101 } } },
+      { 2, { 0xd3, 0x204 } },
+      2, { 0x504, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x508, 0x1101 } } },
+      { 3, { 0x101, 0xd3, 0x204 } },
+      2, { 0x508, 0x1101 }, 3 },
+};
+
+static const uint16_t _cands_shl[] = {
+    4, 4, 0, 0, 5, 5, 1, 1, 6, 6, 2, 2,
+    7, 7, 3, 3,
+};
+
+static const struct rule _rules_shr[] = {
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0xc0, 0x205, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0xc1, 0x205, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0xc1, 0x205, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0xc1, 0x205, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_MC, { .mc = { 0x501, 0x1101 } } },
+      { 2, { 0xd2, 0x205 } },
+      2, { 0x501, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x502, 0x1101 } } },
+      { 2, { 0xd3, 0x205 } },
+      2, { 0x502, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x504, 0x1101 } } },
+      { 2, { 0xd3, 0x205 } },
+      2, { 0x504, 0x1101 }, 2 },
+    { { ENCODE_MC, { .mc = { 0x508, 0x1101 } } },
+      { 3, { 0x101, 0xd3, 0x205 } },
+      2, { 0x508, 0x1101 }, 3 },
+};
+
+static const uint16_t _cands_shr[] = {
+    4, 4, 0, 0, 5, 5, 1, 1, 6, 6, 2, 2,
+    7, 7, 3, 3,
+};
+
+static const struct rule _rules_sub[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x2a, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x2b, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x2b, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x2b, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x28, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x29, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x29, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x29, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x205, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x205, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x205, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x205, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x205, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x205, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x205, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x2c, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x2d, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x2d, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x2d, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_sub[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct rule _rules_test[] = {
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x84, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x85, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x85, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x85, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0xf6, 0x200, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0xf7, 0x200, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0xf7, 0x200, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0xf7, 0x200, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0xa8, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0xa9, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0xa9, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0xa9, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_test[] = {
+    0, 0, 8, 4, 4, 1, 1, 9, 5, 5, 2, 2,
+    10, 6, 6, 3, 3, 11, 7, 7,
+};
+
+static const struct rule _rules_xor[] = {
+    { { ENCODE_RM, { .rm = { 0x301, 0x501 } } },
+      { 2, { 0x32, 0x300 } },
+      2, { 0x301, 0x501 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x302, 0x502 } } },
+      { 2, { 0x33, 0x300 } },
+      2, { 0x302, 0x502 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x304, 0x504 } } },
+      { 2, { 0x33, 0x300 } },
+      2, { 0x304, 0x504 }, 2 },
+    { { ENCODE_RM, { .rm = { 0x308, 0x508 } } },
+      { 3, { 0x101, 0x33, 0x300 } },
+      2, { 0x308, 0x508 }, 3 },
+    { { ENCODE_MR, { .mr = { 0x501, 0x301 } } },
+      { 2, { 0x30, 0x300 } },
+      2, { 0x501, 0x301 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x502, 0x302 } } },
+      { 2, { 0x31, 0x300 } },
+      2, { 0x502, 0x302 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x504, 0x304 } } },
+      { 2, { 0x31, 0x300 } },
+      2, { 0x504, 0x304 }, 2 },
+    { { ENCODE_MR, { .mr = { 0x508, 0x308 } } },
+      { 3, { 0x101, 0x31, 0x300 } },
+      2, { 0x508, 0x308 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x501, 0x401 } } },
+      { 3, { 0x80, 0x206, 0x501 } },
+      2, { 0x501, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x402 } } },
+      { 3, { 0x81, 0x206, 0x502 } },
+      2, { 0x502, 0x402 }, 4 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x404 } } },
+      { 3, { 0x81, 0x206, 0x504 } },
+      2, { 0x504, 0x404 }, 6 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x404 } } },
+      { 4, { 0x101, 0x81, 0x206, 0x504 } },
+      2, { 0x508, 0x404 }, 7 },
+    { { ENCODE_MI, { .mi = { 0x502, 0x401 } } },
+      { 3, { 0x83, 0x206, 0x501 } },
+      2, { 0x502, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x504, 0x401 } } },
+      { 3, { 0x83, 0x206, 0x501 } },
+      2, { 0x504, 0x401 }, 3 },
+    { { ENCODE_MI, { .mi = { 0x508, 0x401 } } },
+      { 4, { 0x101, 0x83, 0x206, 0x501 } },
+      2, { 0x508, 0x401 }, 4 },
+    { { ENCODE_I, { .i = { 0x1001, 0x401 } } },
+      { 2, { 0x34, 0x501 } },
+      2, { 0x1001, 0x401 }, 2 },
+    { { ENCODE_I, { .i = { 0x1002, 0x402 } } },
+      { 2, { 0x35, 0x502 } },
+      2, { 0x1002, 0x402 }, 3 },
+    { { ENCODE_I, { .i = { 0x1004, 0x404 } } },
+      { 2, { 0x35, 0x504 } },
+      2, { 0x1004, 0x404 }, 5 },
+    { { ENCODE_I, { .i = { 0x1008, 0x404 } } },
+      { 3, { 0x101, 0x35, 0x504 } },
+      2, { 0x1008, 0x404 }, 6 },
+};
+
+static const uint16_t _cands_xor[] = {
+    0, 4, 4, 0, 15, 8, 8, 1, 5, 5, 1, 12,
+    16, 9, 12, 9, 2, 6, 6, 2, 13, 17, 10, 13,
+    10, 3, 7, 7, 3, 14, 18, 11, 14, 11,
+};
+
+static const struct mnemonic _mnemonics[256] = {
+    [122] = { "adc", _rules_adc, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_adc,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [38] = { "adcx", _rules_adcx, 2,
+        { 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2 },
+        _cands_adcx,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+          3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4,
+        } },
+    [155] = { "add", _rules_add, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_add,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [1] = { "and", _rules_and, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_and,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [104] = { "call", _rules_call, 5,
+        { 0, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5 },
+        _cands_call,
+        {
+          0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 2, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3,
+        } },
+    [26] = { "cdq", _rules_cdq, 1,
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        _cands_cdq,
+        {
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1,
+        } },
+    [44] = { "cmp", _rules_cmp, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_cmp,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [125] = { "cqo", _rules_cqo, 1,
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        _cands_cqo,
+        {
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1,
+        } },
+    [48] = { "dec", _rules_dec, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_dec,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [243] = { "div", _rules_div, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_div,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [6] = { "idiv", _rules_idiv, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_idiv,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [35] = { "imul", _rules_imul, 7,
+        { 0, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7 },
+        _cands_imul,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6,
+          6, 6, 7, 8, 8, 8, 9, 9, 9, 9, 10, 10,
+          10, 10, 10, 10, 10, 10, 11, 12, 12, 12, 13, 13,
+          13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+          14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+          14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+          14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+          14, 14, 14, 14, 14, 14, 14, 14, 14,
+        } },
+    [140] = { "inc", _rules_inc, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_inc,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [37] = { "ja", _rules_ja, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_ja,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [192] = { "jae", _rules_jae, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jae,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [108] = { "jb", _rules_jb, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jb,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [43] = { "jbe", _rules_jbe, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jbe,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [217] = { "je", _rules_je, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_je,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [179] = { "jg", _rules_jg, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jg,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [226] = { "jge", _rules_jge, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jge,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [222] = { "jl", _rules_jl, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jl,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [97] = { "jle", _rules_jle, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jle,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [147] = { "jmp", _rules_jmp, 6,
+        { 0, 1, 1, 1, 1, 1, 6, 6, 6, 6, 6 },
+        _cands_jmp,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4,
+        } },
+    [231] = { "jne", _rules_jne, 2,
+        { 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2 },
+        _cands_jne,
+        {
+          0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [62] = { "lea", _rules_lea, 3,
+        { 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3 },
+        _cands_lea,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3,
+        } },
+    [7] = { "leave", _rules_leave, 1,
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        _cands_leave,
+        {
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1,
+        } },
+    [114] = { "mov", _rules_mov, 16,
+        { 0, 0, 4, 8, 12, 16, 16, 16, 16, 16, 16 },
+        _cands_mov,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 13, 14,
+          14, 14, 14, 14, 14, 14, 16, 17, 17, 17, 18, 18,
+          18, 18, 20, 21, 21, 21, 21, 21, 21, 21, 23, 24,
+          24, 24, 25, 25, 25, 25, 27, 28, 28, 28, 28, 28,
+          28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+          28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+          28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+          28, 28, 28, 28, 28, 28, 28, 28, 28,
+        } },
+    [241] = { "movsx", _rules_movsx, 5,
+        { 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+        _cands_movsx,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8,
+          8, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10,
+        } },
+    [143] = { "movsxd", _rules_movsxd, 1,
+        { 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_movsxd,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+          1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [160] = { "movzx", _rules_movzx, 5,
+        { 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5 },
+        _cands_movzx,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8,
+          8, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+          10, 10, 10, 10, 10, 10, 10, 10, 10,
+        } },
+    [214] = { "mul", _rules_mul, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_mul,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [246] = { "neg", _rules_neg, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_neg,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [85] = { "nop", _rules_nop, 1,
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        _cands_nop,
+        {
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1,
+        } },
+    [9] = { "not", _rules_not, 4,
+        { 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 },
+        _cands_not,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 7, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+          8, 8, 8, 8, 8, 8, 8, 8, 8,
+        } },
+    [181] = { "or", _rules_or, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_or,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [111] = { "pop", _rules_pop, 4,
+        { 0, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4 },
+        _cands_pop,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 5, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6,
+        } },
+    [252] = { "push", _rules_push, 4,
+        { 0, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4 },
+        _cands_push,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+          3, 3, 3, 3, 3, 3, 5, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+          6, 6, 6, 6, 6, 6, 6, 6, 6,
+        } },
+    [159] = { "ret", _rules_ret, 1,
+        { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 },
+        _cands_ret,
+        {
+          0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+          1, 1, 1, 1, 1, 1, 1, 1, 1,
+        } },
+    [118] = { "sar", _rules_sar, 8,
+        { 0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 8 },
+        _cands_sar,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+          2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8,
+          8, 8, 8, 8, 8, 8, 9, 10, 10, 10, 10, 10,
+          10, 10, 11, 12, 12, 12, 12, 12, 12, 12, 13, 14,
+          14, 14, 14, 14, 14, 14, 15, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16,
+        } },
+    [235] = { "seta", _rules_seta, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_seta,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [138] = { "setae", _rules_setae, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setae,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [126] = { "setb", _rules_setb, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setb,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [129] = { "setbe", _rules_setbe, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setbe,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [55] = { "sete", _rules_sete, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_sete,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [93] = { "setg", _rules_setg, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setg,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [40] = { "setge", _rules_setge, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setge,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [12] = { "setl", _rules_setl, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setl,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [75] = { "setle", _rules_setle, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setle,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [245] = { "setne", _rules_setne, 1,
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+        _cands_setne,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 1, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+          2, 2, 2, 2, 2, 2, 2, 2, 2,
+        } },
+    [197] = { "shl", _rules_shl, 8,
+        { 0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 8 },
+        _cands_shl,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+          2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8,
+          8, 8, 8, 8, 8, 8, 9, 10, 10, 10, 10, 10,
+          10, 10, 11, 12, 12, 12, 12, 12, 12, 12, 13, 14,
+          14, 14, 14, 14, 14, 14, 15, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16,
+        } },
+    [27] = { "shr", _rules_shr, 8,
+        { 0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 8 },
+        _cands_shr,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+          2, 2, 2, 2, 2, 2, 3, 4, 4, 4, 4, 4,
+          4, 4, 5, 6, 6, 6, 6, 6, 6, 6, 7, 8,
+          8, 8, 8, 8, 8, 8, 9, 10, 10, 10, 10, 10,
+          10, 10, 11, 12, 12, 12, 12, 12, 12, 12, 13, 14,
+          14, 14, 14, 14, 14, 14, 15, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+          16, 16, 16, 16, 16, 16, 16, 16, 16,
+        } },
+    [58] = { "sub", _rules_sub, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_sub,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+    [236] = { "test", _rules_test, 12,
+        { 0, 0, 0, 4, 4, 8, 8, 12, 12, 12, 12 },
+        _cands_test,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2,
+          2, 2, 2, 2, 2, 2, 4, 5, 5, 5, 5, 5,
+          5, 5, 6, 7, 7, 7, 7, 7, 7, 7, 9, 10,
+          10, 10, 10, 10, 10, 10, 11, 12, 12, 12, 12, 12,
+          12, 12, 14, 15, 15, 15, 15, 15, 15, 15, 16, 17,
+          17, 17, 17, 17, 17, 17, 19, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20,
+        } },
+    [77] = { "xor", _rules_xor, 19,
+        { 0, 0, 4, 8, 8, 15, 15, 19, 19, 19, 19 },
+        _cands_xor,
+        {
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+          0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3,
+          3, 3, 4, 4, 4, 4, 6, 7, 7, 7, 7, 7,
+          7, 7, 9, 10, 10, 10, 11, 11, 11, 11, 14, 16,
+          16, 16, 16, 16, 16, 16, 18, 19, 19, 19, 20, 20,
+          20, 20, 23, 25, 25, 25, 25, 25, 25, 25, 27, 28,
+          28, 28, 29, 29, 29, 29, 32, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+          34, 34, 34, 34, 34, 34, 34, 34, 34,
+        } },
+};
+
+const struct x86_64_instr_ruleset x86_64_ruleset = {
+    .seed = 0xd,
+    .size = 256,
+    .mnemonics = _mnemonics,
+};
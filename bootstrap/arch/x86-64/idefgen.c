@@ -0,0 +1,1007 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * idefgen -- convert the instruction definition files (*.idef) into the
+ * static tables of the assembler
+ *
+ * Usage: idefgen <output.c> <file.idef>...
+ *
+ * The mnemonic of the rules is taken from the file name.  The rules of each
+ * mnemonic are sorted by the encode type, and the mnemonics are placed in a
+ * perfect hash table so that the assembler looks up a mnemonic by a single
+ * string comparison.  The rules are also indexed by the kinds of the operands
+ * and the operation size, and the candidates of a key are sorted by the
+ * length of the encoding so that the shortest one is selected first.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "idef.h"
+
+#define IDEFGEN_MAX_SEED    0x10000
+
+/*
+ * Rules of a mnemonic being parsed
+ */
+struct idef {
+    char *mnemonic;
+    struct {
+        size_t n;
+        size_t size;
+        struct rule *rules;
+    } rule;
+    uint16_t idx[ENCODE_NUM + 1];
+    /* Index */
+    struct {
+        size_t n;
+        uint16_t *cands;
+    } cand;
+    uint16_t bucket[IDEF_NKEYS + 1];
+};
+
+/*
+ * Trim leading and trailing whitespaces
+ */
+static char *
+_trim(char *s)
+{
+    char *ns;
+    char *rs;
+
+    rs = s;
+    ns = s;
+
+    /* Remove leading whitespaces */
+    while ( *s ) {
+        if ( isspace(*s) ) {
+            s++;
+        } else {
+            break;
+        }
+    }
+
+    /* Copy */
+    while ( *s ) {
+        *ns = *s;
+        ns++;
+        s++;
+    }
+    *ns = 0;
+
+    /* Remove trailing whitespaces */
+    while ( ns > rs && isspace(*(ns - 1)) ) {
+        ns--;
+        *ns = '\0';
+    }
+
+    return rs;
+}
+
+/*
+ * _ishexdigit -- check if the hexdecimal ascii character
+ */
+static int
+_ishexdigit(int c)
+{
+    if ( '0' <= c && c <= '9' ) {
+        return 1;
+    } else if ( 'a' <= c && c <= 'f' ) {
+        return 1;
+    } else if ( 'A' <= c && c <= 'F' ) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+/*
+ * _parse_opcode_chunk -- parse an opcode chunk
+ */
+static int
+_parse_opcode_chunk(const char *token)
+{
+    int ret;
+
+    /* Code offsets; lowercase to be distinguished from the hexadecimal
+       opcodes (e.g., CB and CD) */
+    if ( 0 == strcmp("cb", token) ) {
+        return OPCODE_CB;
+    } else if ( 0 == strcmp("cw", token) ) {
+        return OPCODE_CW;
+    } else if ( 0 == strcmp("cd", token) ) {
+        return OPCODE_CD;
+    } else if ( 0 == strcmp("cp", token) ) {
+        return OPCODE_CP;
+    } else if ( 0 == strcmp("co", token) ) {
+        return OPCODE_CO;
+    } else if ( 0 == strcmp("ct", token) ) {
+        return OPCODE_CT;
+    }
+
+    /* Hexdecimal */
+    if ( 2 == strlen(token) ) {
+        if ( _ishexdigit(token[0]) && _ishexdigit(token[1]) ) {
+            return strtol(token, NULL, 16);
+        }
+    }
+
+    if ( 0 == strcasecmp("W", token) ) {
+        /* REX.W */
+        return OPCODE_REXW;
+    } else if ( '/' == *token ) {
+        token++;
+        if ( 'r' == *token ) {
+            ret = OPCODE_REGISTER;
+        } else if ( '0' <= *token && *token <= '7' ) {
+            ret = OPCODE_DIGIT_PREFIX + (*token - '0');
+        } else {
+            return -1;
+        }
+        token++;
+        if ( '\0' != *token ) {
+            return -1;
+        }
+        return ret;
+    } else if ( 0 == strcasecmp("ib", token) ) {
+        return OPCODE_IB;
+    } else if ( 0 == strcasecmp("iw", token) ) {
+        return OPCODE_IW;
+    } else if ( 0 == strcasecmp("id", token) ) {
+        return OPCODE_ID;
+    } else if ( 0 == strcasecmp("io", token) ) {
+        return OPCODE_IO;
+    } else if ( '+' == *token ) {
+        token++;
+        if ( 0 == strcasecmp("rb", token ) ) {
+            return OPCODE_RB;
+        } else if ( 0 == strcasecmp("rw", token ) ) {
+            return OPCODE_RW;
+        } else if ( 0 == strcasecmp("rd", token ) ) {
+            return OPCODE_RD;
+        } else if ( 0 == strcasecmp("ro", token ) ) {
+            return OPCODE_RO;
+        } else if ( '0' <= *token && *token <= '7' ) {
+            ret = OPCODE_ST_PREFIX + (*token - '0');
+            token++;
+            if ( '\0' != *token ) {
+                return -1;
+            }
+            return ret;
+        } else {
+            return -1;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * _parse_opcode -- parse an opcode field
+ */
+static int
+_parse_opcode(struct opcode *op, char *opcode)
+{
+    char *tok;
+    char *savedptr;
+    int c;
+
+    tok = strtok_r(opcode, " ", &savedptr);
+    op->size = 0;
+    while ( NULL != tok ) {
+        c = _parse_opcode_chunk(tok);
+        if ( c < 0 ) {
+            return -1;
+        }
+        if ( op->size >= OPCODE_MAX_SIZE ) {
+            /* Exceed the maximum opcode size */
+            return -1;
+        }
+        op->opcode[op->size] = c;
+        op->size++;
+        tok = strtok_r(NULL, " ", &savedptr);
+    }
+
+    return 0;
+}
+
+/*
+ * _parse_encode_type -- parse the encode type of an token
+ */
+static int
+_parse_encode_type(const char *token)
+{
+    if ( 0 == strcasecmp("M", token) ) {
+        return ENCODE_M;
+    } else if ( 0 == strcasecmp("RM", token) ) {
+        return ENCODE_RM;
+    } else if ( 0 == strcasecmp("MR", token) ) {
+        return ENCODE_MR;
+    } else if ( 0 == strcasecmp("OI", token) ) {
+        return ENCODE_OI;
+    } else if ( 0 == strcasecmp("MI", token) ) {
+        return ENCODE_MI;
+    } else if ( 0 == strcasecmp("D", token) ) {
+        return ENCODE_D;
+    } else if ( 0 == strcasecmp("I", token) ) {
+        return ENCODE_I;
+    } else if ( 0 == strcasecmp("O", token) ) {
+        return ENCODE_O;
+    } else if ( 0 == strcasecmp("MC", token) ) {
+        return ENCODE_MC;
+    } else if ( 0 == strcasecmp("ZO", token) ) {
+        return ENCODE_ZO;
+    }
+
+    return -1;
+}
+
+/*
+ * Operand tokens; r8* and r/m8* (the byte registers addressable only with a
+ * REX prefix: spl, bpl, sil, dil, and r8l-r15l) take the same kinds as r8 and
+ * r/m8, since the encoder adds the REX prefix for those registers by itself
+ * (see _rex() in x86-64.c), and rejects ah-bh with it.  The rules of such
+ * operands are of the REX opcode, which is not supported and skipped.
+ */
+static const struct {
+    const char *token;
+    int operand;
+} _operands[] = {
+    { "rel8", OPERAND_REL8 },
+    { "rel16", OPERAND_REL16 },
+    { "rel32", OPERAND_REL32 },
+    { "rel64", OPERAND_REL64 },
+    { "ptr16:16", OPERAND_PTR16_16 },
+    { "ptr16:32", OPERAND_PTR16_32 },
+    { "ptr16:64", OPERAND_PTR16_64 },
+    { "r8", OPERAND_R8 },
+    { "r8*", OPERAND_R8 },
+    { "r16", OPERAND_R16 },
+    { "r32", OPERAND_R32 },
+    { "r64", OPERAND_R64 },
+    { "r/m8", OPERAND_RM8 },
+    { "r/m8*", OPERAND_RM8 },
+    { "r/m16", OPERAND_RM16 },
+    { "r/m32", OPERAND_RM32 },
+    { "r/m64", OPERAND_RM64 },
+    { "imm8", OPERAND_IMM8 },
+    { "imm16", OPERAND_IMM16 },
+    { "imm32", OPERAND_IMM32 },
+    { "imm64", OPERAND_IMM64 },
+    { "m", OPERAND_M },
+    { "m16:16", OPERAND_M16_16 },
+    { "m16:32", OPERAND_M16_32 },
+    { "m16:64", OPERAND_M16_64 },
+    { "al", OPERAND_AL },
+    { "ax", OPERAND_AX },
+    { "eax", OPERAND_EAX },
+    { "rax", OPERAND_RAX },
+    { "cl", OPERAND_CL },
+};
+
+/*
+ * _parse_operand_chunk -- parse an operand chunk
+ */
+static int
+_parse_operand_chunk(const char *token)
+{
+    size_t i;
+
+    for ( i = 0; i < sizeof(_operands) / sizeof(_operands[0]); i++ ) {
+        if ( 0 == strcasecmp(_operands[i].token, token) ) {
+            return _operands[i].operand;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * _parse_operand -- parse an operand field
+ */
+static int
+_parse_operand(struct rule *rule, int enc, char *operands)
+{
+    struct encode *encode;
+    char *tok;
+    char *savedptr;
+    int arr[3];
+    int operand;
+    int n;
+
+    n = 0;
+    tok = strtok_r(operands, ",", &savedptr);
+    while ( NULL != tok ) {
+        if ( n < 3 ) {
+            operand = _parse_operand_chunk(_trim(tok));
+            if ( operand < 0 ) {
+                return -1;
+            }
+            arr[n] = operand;
+            n++;
+        }
+        tok = strtok_r(NULL, ",", &savedptr);
+    }
+
+    encode = &rule->encode;
+    encode->type = enc;
+    switch ( enc ) {
+    case ENCODE_RM:
+        if ( n != 2 ) {
+            return -1;
+        }
+        encode->u.rm.r = arr[0];
+        encode->u.rm.rm = arr[1];
+        break;
+    case ENCODE_MR:
+        if ( n != 2 ) {
+            return -1;
+        }
+        encode->u.mr.rm = arr[0];
+        encode->u.mr.r = arr[1];
+        break;
+    case ENCODE_OI:
+        if ( n != 2 ) {
+            return -1;
+        }
+        encode->u.oi.r = arr[0];
+        encode->u.oi.imm = arr[1];
+        break;
+    case ENCODE_MI:
+        if ( n != 2 ) {
+            return -1;
+        }
+        encode->u.mi.rm = arr[0];
+        encode->u.mi.imm = arr[1];
+        break;
+    case ENCODE_M:
+        if ( n != 1 ) {
+            return -1;
+        }
+        encode->u.m.m = arr[0];
+        break;
+    case ENCODE_D:
+        if ( n != 1 ) {
+            return -1;
+        }
+        encode->u.d.ptr = arr[0];
+        break;
+    case ENCODE_I:
+        if ( n != 2 || OPERAND_CLASS(arr[0]) != OPERAND_CLASS_ACC ) {
+            return -1;
+        }
+        encode->u.i.acc = arr[0];
+        encode->u.i.imm = arr[1];
+        break;
+    case ENCODE_O:
+        if ( n != 1 || OPERAND_CLASS(arr[0]) != OPERAND_CLASS_R ) {
+            return -1;
+        }
+        encode->u.o.r = arr[0];
+        break;
+    case ENCODE_MC:
+        if ( n != 2 || OPERAND_CLASS(arr[1]) != OPERAND_CLASS_CL ) {
+            return -1;
+        }
+        encode->u.mc.rm = arr[0];
+        encode->u.mc.c = arr[1];
+        break;
+    case ENCODE_ZO:
+        if ( n != 0 ) {
+            return -1;
+        }
+        break;
+    default:
+        return -1;
+    }
+
+    /* Operands in the order of the instruction */
+    rule->noperands = n;
+    memcpy(rule->operands, arr, sizeof(int) * n);
+
+    return 0;
+}
+
+/*
+ * _rule_len -- compute the length of the encoded instruction of the rule
+ */
+static int
+_rule_len(const struct rule *rule)
+{
+    size_t i;
+    int len;
+    int c;
+
+    len = 0;
+    for ( i = 0; i < rule->op.size; i++ ) {
+        c = rule->op.opcode[i];
+        if ( c < 0x100 ) {
+            /* Opcode byte */
+            len++;
+        } else if ( OPCODE_REXW == c ) {
+            len++;
+        } else if ( (c & 0xf00) == OPCODE_DIGIT_PREFIX
+                    || OPCODE_REGISTER == c ) {
+            /* ModR/M */
+            len++;
+        } else if ( (c & 0xf00) == (OPCODE_CB & 0xf00)
+                    || (c & 0xf00) == (OPCODE_IB & 0xf00) ) {
+            /* Code offset or immediate value */
+            len += c & 0xff;
+        }
+    }
+
+    return len;
+}
+
+/*
+ * _size_index -- get the index of the size of an operand
+ */
+static int
+_size_index(int operand)
+{
+    switch ( OPERAND_BYTES(operand) ) {
+    case 1:
+        return IDEF_SIZE_8;
+    case 2:
+        return IDEF_SIZE_16;
+    case 4:
+        return IDEF_SIZE_32;
+    case 8:
+        return IDEF_SIZE_64;
+    default:
+        return -1;
+    }
+}
+
+/*
+ * _rule_key_match -- check if the rule accepts the operands of the key
+ */
+static int
+_rule_key_match(const struct rule *rule, int key)
+{
+    int kinds[OPERAND_MAX_NUM];
+    int size;
+    int k;
+    int i;
+
+    kinds[0] = key & 3;
+    kinds[1] = (key >> 2) & 3;
+    size = IDEF_SIZE_NONE;
+    for ( i = 0; i < OPERAND_MAX_NUM; i++ ) {
+        k = kinds[i];
+        if ( i >= rule->noperands ) {
+            if ( IDEF_KIND_NONE != k ) {
+                return 0;
+            }
+            continue;
+        }
+        switch ( OPERAND_CLASS(rule->operands[i]) ) {
+        case OPERAND_CLASS_R:
+        case OPERAND_CLASS_ACC:
+            if ( IDEF_KIND_REG != k ) {
+                return 0;
+            }
+            break;
+        case OPERAND_CLASS_RM:
+            if ( IDEF_KIND_REG != k && IDEF_KIND_MEM != k ) {
+                return 0;
+            }
+            break;
+        case OPERAND_CLASS_M:
+            /* Memory of any size (the address is the operand) */
+            if ( IDEF_KIND_MEM != k ) {
+                return 0;
+            }
+            continue;
+        case OPERAND_CLASS_CL:
+            if ( IDEF_KIND_REG != k ) {
+                return 0;
+            }
+            continue;
+        case OPERAND_CLASS_IMM:
+        case OPERAND_CLASS_REL:
+            if ( IDEF_KIND_IMM != k ) {
+                return 0;
+            }
+            continue;
+        default:
+            /* Far pointers are not selected */
+            return 0;
+        }
+        if ( IDEF_SIZE_NONE == size ) {
+            size = _size_index(rule->operands[i]);
+        }
+    }
+
+    return (key >> 4) == size;
+}
+
+/*
+ * _index_rules -- index the rules by the keys
+ */
+static int
+_index_rules(struct idef *idef)
+{
+    uint16_t *cands;
+    size_t n;
+    size_t i;
+    size_t j;
+    uint16_t t;
+    int key;
+
+    cands = malloc(sizeof(uint16_t) * (idef->rule.n * IDEF_NKEYS + 1));
+    if ( NULL == cands ) {
+        return -1;
+    }
+    n = 0;
+    for ( key = 0; key < IDEF_NKEYS; key++ ) {
+        idef->bucket[key] = n;
+        for ( i = 0; i < idef->rule.n; i++ ) {
+            if ( !_rule_key_match(&idef->rule.rules[i], key) ) {
+                continue;
+            }
+            /* Insert keeping the order of the length (stable) */
+            for ( j = n; j > idef->bucket[key]; j-- ) {
+                t = cands[j - 1];
+                if ( idef->rule.rules[t].len <= idef->rule.rules[i].len ) {
+                    break;
+                }
+                cands[j] = t;
+            }
+            cands[j] = i;
+            n++;
+        }
+    }
+    if ( n > UINT16_MAX ) {
+        free(cands);
+        return -1;
+    }
+    idef->bucket[IDEF_NKEYS] = n;
+    idef->cand.n = n;
+    idef->cand.cands = cands;
+
+    return 0;
+}
+
+/*
+ * _add_rule -- add a rule to the mnemonic
+ */
+static int
+_add_rule(struct idef *idef, const struct rule *rule)
+{
+    size_t nsize;
+    struct rule *rules;
+
+    if ( idef->rule.n >= idef->rule.size ) {
+        nsize = idef->rule.size ? idef->rule.size * 2 : 16;
+        rules = realloc(idef->rule.rules, sizeof(struct rule) * nsize);
+        if ( NULL == rules ) {
+            return -1;
+        }
+        idef->rule.rules = rules;
+        idef->rule.size = nsize;
+    }
+    memcpy(&idef->rule.rules[idef->rule.n], rule, sizeof(struct rule));
+    idef->rule.n++;
+
+    return 0;
+}
+
+/*
+ * _sort_rules -- sort the rules by the encode type preserving the order in
+ * the file, and build the index of each encode type
+ */
+static int
+_sort_rules(struct idef *idef)
+{
+    struct rule *rules;
+    size_t n;
+    size_t i;
+    int t;
+
+    if ( idef->rule.n > UINT16_MAX ) {
+        return -1;
+    }
+    rules = malloc(sizeof(struct rule) * (idef->rule.n + 1));
+    if ( NULL == rules ) {
+        return -1;
+    }
+    n = 0;
+    for ( t = 0; t < ENCODE_NUM; t++ ) {
+        idef->idx[t] = n;
+        for ( i = 0; i < idef->rule.n; i++ ) {
+            if ( (int)idef->rule.rules[i].encode.type == t ) {
+                memcpy(&rules[n], &idef->rule.rules[i], sizeof(struct rule));
+                n++;
+            }
+        }
+    }
+    idef->idx[ENCODE_NUM] = n;
+    free(idef->rule.rules);
+    idef->rule.rules = rules;
+    idef->rule.size = idef->rule.n + 1;
+
+    return _index_rules(idef);
+}
+
+/*
+ * _parse_file -- parse an instruction definition file
+ */
+static int
+_parse_file(struct idef *idef, const char *fname)
+{
+    struct rule rule;
+    FILE *fp;
+    char buf[1024];
+    char *tok;
+    char *cols[5];
+    const char *base;
+    const char *ext;
+    int n;
+    int i;
+    int enc;
+
+    /* The mnemonic is the base name of the file */
+    base = strrchr(fname, '/');
+    base = (NULL == base) ? fname : base + 1;
+    ext = strrchr(base, '.');
+    if ( NULL == ext ) {
+        ext = base + strlen(base);
+    }
+    idef->mnemonic = strndup(base, ext - base);
+    if ( NULL == idef->mnemonic ) {
+        return -1;
+    }
+
+    fp = fopen(fname, "r");
+    if ( NULL == fp ) {
+        return -1;
+    }
+    while ( NULL != fgets(buf, sizeof(buf), fp) ) {
+        /* Parse this line */
+        _trim(buf);
+        if ( '\0' == buf[0] || 0 == strncmp("//", buf, 2) ) {
+            /* Empty line or comment */
+            continue;
+        }
+
+        /* Split the columns; the operands are empty for ZO */
+        n = 0;
+        tok = buf;
+        while ( NULL != tok && n < 5 ) {
+            cols[n] = tok;
+            n++;
+            tok = strchr(tok, '|');
+            if ( NULL != tok ) {
+                *tok = '\0';
+                tok++;
+            }
+        }
+        if ( 5 != n ) {
+            /* Invalid line */
+            fprintf(stderr, "%s: Invalid instruction rule\n", fname);
+            continue;
+        }
+
+        for ( i = 0; i < n; i++ ) {
+            cols[i] = _trim(cols[i]);
+        }
+        if ( 0 != strcmp("V", cols[3]) ) {
+            /* Not valid in the 64-bit mode */
+            continue;
+        }
+
+        /* Parse the encode type, the opcode, and the operands; the rules
+           that are not supported are skipped */
+        memset(&rule, 0, sizeof(struct rule));
+        enc = _parse_encode_type(cols[1]);
+        if ( enc < 0 ) {
+            continue;
+        }
+        if ( 0 != _parse_opcode(&rule.op, cols[0]) ) {
+            continue;
+        }
+        if ( 0 != _parse_operand(&rule, enc, cols[2]) ) {
+            continue;
+        }
+        rule.len = _rule_len(&rule);
+        if ( _add_rule(idef, &rule) < 0 ) {
+            fclose(fp);
+            return -1;
+        }
+    }
+    if ( ferror(fp) ) {
+        fclose(fp);
+        return -1;
+    }
+    fclose(fp);
+
+    return _sort_rules(idef);
+}
+
+/*
+ * _perfect_hash -- find the size and the seed of the hash table where the
+ * mnemonics do not collide
+ */
+static int
+_perfect_hash(struct idef *idefs, int n, size_t *size, uint32_t *seed)
+{
+    char *used;
+    size_t sz;
+    uint32_t s;
+    size_t slot;
+    int i;
+
+    for ( sz = 1; sz < (size_t)n; sz <<= 1 ) {
+    }
+    for ( ; sz <= ((size_t)n << 4); sz <<= 1 ) {
+        used = malloc(sz);
+        if ( NULL == used ) {
+            return -1;
+        }
+        for ( s = 0; s < IDEFGEN_MAX_SEED; s++ ) {
+            memset(used, 0, sz);
+            for ( i = 0; i < n; i++ ) {
+                slot = idef_hash(idefs[i].mnemonic, s) & (sz - 1);
+                if ( used[slot] ) {
+                    break;
+                }
+                used[slot] = 1;
+            }
+            if ( i == n ) {
+                free(used);
+                *size = sz;
+                *seed = s;
+                return 0;
+            }
+        }
+        free(used);
+    }
+
+    return -1;
+}
+
+/*
+ * _print_encode -- print the initializer of the encode
+ */
+static void
+_print_encode(FILE *fp, const struct encode *enc)
+{
+    switch ( enc->type ) {
+    case ENCODE_M:
+        fprintf(fp, "{ ENCODE_M, { .m = { 0x%x } } }", enc->u.m.m);
+        break;
+    case ENCODE_RM:
+        fprintf(fp, "{ ENCODE_RM, { .rm = { 0x%x, 0x%x } } }", enc->u.rm.r,
+                enc->u.rm.rm);
+        break;
+    case ENCODE_MR:
+        fprintf(fp, "{ ENCODE_MR, { .mr = { 0x%x, 0x%x } } }", enc->u.mr.rm,
+                enc->u.mr.r);
+        break;
+    case ENCODE_OI:
+        fprintf(fp, "{ ENCODE_OI, { .oi = { 0x%x, 0x%x } } }", enc->u.oi.r,
+                enc->u.oi.imm);
+        break;
+    case ENCODE_MI:
+        fprintf(fp, "{ ENCODE_MI, { .mi = { 0x%x, 0x%x } } }", enc->u.mi.rm,
+                enc->u.mi.imm);
+        break;
+    case ENCODE_D:
+        fprintf(fp, "{ ENCODE_D, { .d = { 0x%x } } }", enc->u.d.ptr);
+        break;
+    case ENCODE_I:
+        fprintf(fp, "{ ENCODE_I, { .i = { 0x%x, 0x%x } } }", enc->u.i.acc,
+                enc->u.i.imm);
+        break;
+    case ENCODE_O:
+        fprintf(fp, "{ ENCODE_O, { .o = { 0x%x } } }", enc->u.o.r);
+        break;
+    case ENCODE_MC:
+        fprintf(fp, "{ ENCODE_MC, { .mc = { 0x%x, 0x%x } } }", enc->u.mc.rm,
+                enc->u.mc.c);
+        break;
+    case ENCODE_ZO:
+        fprintf(fp, "{ ENCODE_ZO, { .m = { 0 } } }");
+        break;
+    }
+}
+
+/*
+ * _print_ident -- print the name of a table of the mnemonic as a C identifier
+ */
+static void
+_print_ident(FILE *fp, const char *prefix, const char *s)
+{
+    fprintf(fp, "%s", prefix);
+    for ( ; *s; s++ ) {
+        fputc(isalnum(*s) ? *s : '_', fp);
+    }
+}
+
+/*
+ * _generate -- generate the tables
+ */
+static int
+_generate(FILE *fp, struct idef *idefs, int n)
+{
+    const struct rule *rule;
+    size_t size;
+    uint32_t seed;
+    size_t slot;
+    size_t j;
+    int i;
+    int t;
+
+    if ( _perfect_hash(idefs, n, &size, &seed) < 0 ) {
+        fprintf(stderr, "Cannot find a perfect hash of the mnemonics\n");
+        return -1;
+    }
+
+    fprintf(fp, "/* Generated by idefgen; do not edit. */\n\n");
+    fprintf(fp, "#include \"idef.h\"\n");
+
+    /* Rules */
+    for ( i = 0; i < n; i++ ) {
+        if ( 0 == idefs[i].rule.n ) {
+            continue;
+        }
+        fprintf(fp, "\nstatic const struct rule ");
+        _print_ident(fp, "_rules_", idefs[i].mnemonic);
+        fprintf(fp, "[] = {\n");
+        for ( j = 0; j < idefs[i].rule.n; j++ ) {
+            rule = &idefs[i].rule.rules[j];
+            fprintf(fp, "    { ");
+            _print_encode(fp, &rule->encode);
+            fprintf(fp, ",\n      { %zu, {", rule->op.size);
+            for ( t = 0; t < (int)rule->op.size; t++ ) {
+                fprintf(fp, "%s 0x%x", t ? "," : "", rule->op.opcode[t]);
+            }
+            fprintf(fp, " } },\n      %d, {", rule->noperands);
+            for ( t = 0; t < rule->noperands; t++ ) {
+                fprintf(fp, "%s 0x%x", t ? "," : "", rule->operands[t]);
+            }
+            fprintf(fp, " }, %d },\n", rule->len);
+        }
+        fprintf(fp, "};\n");
+
+        /* Index */
+        if ( 0 == idefs[i].cand.n ) {
+            continue;
+        }
+        fprintf(fp, "\nstatic const uint16_t ");
+        _print_ident(fp, "_cands_", idefs[i].mnemonic);
+        fprintf(fp, "[] = {");
+        for ( j = 0; j < idefs[i].cand.n; j++ ) {
+            fprintf(fp, "%s%u,", j % 12 ? " " : "\n    ",
+                    idefs[i].cand.cands[j]);
+        }
+        fprintf(fp, "\n};\n");
+    }
+
+    /* Hash table of the mnemonics */
+    fprintf(fp, "\nstatic const struct mnemonic _mnemonics[%zu] = {\n", size);
+    for ( i = 0; i < n; i++ ) {
+        slot = idef_hash(idefs[i].mnemonic, seed) & (size - 1);
+        fprintf(fp, "    [%zu] = { \"%s\", ", slot, idefs[i].mnemonic);
+        if ( 0 == idefs[i].rule.n ) {
+            fprintf(fp, "NULL");
+        } else {
+            _print_ident(fp, "_rules_", idefs[i].mnemonic);
+        }
+        fprintf(fp, ", %zu,\n        {", idefs[i].rule.n);
+        for ( t = 0; t <= ENCODE_NUM; t++ ) {
+            fprintf(fp, "%s %u", t ? "," : "", idefs[i].idx[t]);
+        }
+        fprintf(fp, " },\n        ");
+        if ( 0 == idefs[i].cand.n ) {
+            fprintf(fp, "NULL");
+        } else {
+            _print_ident(fp, "_cands_", idefs[i].mnemonic);
+        }
+        fprintf(fp, ",\n        {");
+        for ( t = 0; t <= IDEF_NKEYS; t++ ) {
+            fprintf(fp, "%s%u,", t % 12 ? " " : "\n          ",
+                    idefs[i].bucket[t]);
+        }
+        fprintf(fp, "\n        } },\n");
+    }
+    fprintf(fp, "};\n\n");
+    fprintf(fp, "const struct x86_64_instr_ruleset x86_64_ruleset = {\n");
+    fprintf(fp, "    .seed = 0x%x,\n", seed);
+    fprintf(fp, "    .size = %zu,\n", size);
+    fprintf(fp, "    .mnemonics = _mnemonics,\n");
+    fprintf(fp, "};\n");
+
+    return 0;
+}
+
+/*
+ * Main routine
+ */
+int
+main(int argc, const char *const argv[])
+{
+    struct idef *idefs;
+    FILE *fp;
+    int n;
+    int i;
+    int j;
+
+    if ( argc < 3 ) {
+        fprintf(stderr, "Usage: %s <output.c> <file.idef>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    n = argc - 2;
+    idefs = calloc(n, sizeof(struct idef));
+    if ( NULL == idefs ) {
+        perror("calloc");
+        return EXIT_FAILURE;
+    }
+    for ( i = 0; i < n; i++ ) {
+        if ( _parse_file(&idefs[i], argv[i + 2]) < 0 ) {
+            perror(argv[i + 2]);
+            return EXIT_FAILURE;
+        }
+        for ( j = 0; j < i; j++ ) {
+            if ( 0 == strcmp(idefs[i].mnemonic, idefs[j].mnemonic) ) {
+                fprintf(stderr, "%s: Duplicate mnemonic\n", argv[i + 2]);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    fp = fopen(argv[1], "w");
+    if ( NULL == fp ) {
+        perror(argv[1]);
+        return EXIT_FAILURE;
+    }
+    if ( _generate(fp, idefs, n) < 0 || 0 != fclose(fp) ) {
+        remove(argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    for ( i = 0; i < n; i++ ) {
+        free(idefs[i].mnemonic);
+        free(idefs[i].rule.rules);
+        free(idefs[i].cand.cands);
+    }
+    free(idefs);
+
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -25,106 +25,10 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
-#include <ctype.h>
 #include "instr.h"
+#include "idef.h"
 #include "reg.h"
 
-#ifndef BASEDIR
-#define BASEDIR ""
-#endif
-#define INSTR_FILE_FORMAT   "/arch/x86-64/idefs/%s.idef"
-
-#define OPCODE_REXW         0x101
-#define OPCODE_DIGIT_PREFIX 0x200
-#define OPCODE_REGISTER     0x300
-#define OPCODE_CB           0x401
-#define OPCODE_CW           0x402
-#define OPCODE_CD           0x404
-#define OPCODE_CP           0x406
-#define OPCODE_CO           0x408
-#define OPCODE_CT           0x40a
-#define OPCODE_IB           0x501
-#define OPCODE_IW           0x502
-#define OPCODE_ID           0x504
-#define OPCODE_IO           0x508
-#define OPCODE_RB           0x601
-#define OPCODE_RW           0x602
-#define OPCODE_RD           0x604
-#define OPCODE_RO           0x608
-#define OPCODE_ST_PREFIX    0x700
-
-#define OPERAND_REL8        0x101
-#define OPERAND_REL16       0x102
-#define OPERAND_REL32       0x104
-#define OPERAND_REL64       0x108
-#define OPERAND_PTR16_16    0x202
-#define OPERAND_PTR16_32    0x204
-#define OPERAND_PTR16_64    0x208
-#define OPERAND_R8          0x301
-#define OPERAND_R8X         0x301
-#define OPERAND_R16         0x302
-#define OPERAND_R32         0x304
-#define OPERAND_R64         0x308
-#define OPERAND_IMM8        0x401
-#define OPERAND_IMM16       0x402
-#define OPERAND_IMM32       0x404
-#define OPERAND_IMM64       0x408
-#define OPERAND_RM8         0x501
-#define OPERAND_RM8X        0x501
-#define OPERAND_RM16        0x502
-#define OPERAND_RM32        0x504
-#define OPERAND_RM64        0x508
-#define OPERAND_M           0x600
-#define OPERAND_M8          0x601
-#define OPERAND_M16         0x602
-#define OPERAND_M32         0x604
-#define OPERAND_M64         0x608
-#define OPERAND_M128        0x610
-#define OPERAND_M16_16      0x702
-#define OPERAND_M16_32      0x704
-#define OPERAND_M16_64      0x708
-#define OPERAND_M16A16      0x802
-#define OPERAND_M16A32      0x804
-#define OPERAND_M16A64      0x808
-#define OPERAND_M32A32      0x814
-#define OPERAND_MOFFS8      0x901
-#define OPERAND_MOFFS16     0x902
-#define OPERAND_MOFFS32     0x904
-#define OPERAND_MOFFS64     0x908
-#define OPERAND_SREG        0xa00
-#define OPERAND_M32FP       0xb04
-#define OPERAND_M64FP       0xb08
-#define OPERAND_M80FP       0xb0a
-#define OPERAND_M16INT      0xc02
-#define OPERAND_M32INT      0xc04
-#define OPERAND_M64INT      0xc08
-#define OPERAND_ST(i)       (0xd00 + (i))
-#define OPERAND_MM          0xe00
-#define OPERAND_MM_M32      0xe04
-#define OPERAND_MM_M64      0xe08
-#define OPERAND_XMM         0xf00
-#define OPERAND_XMM_M32     0xf04
-#define OPERAND_XMM_M64     0xf08
-#define OPERAND_XMM_M128    0xf10
-#define OPERAND_AL          0x1001
-#define OPERAND_AX          0x1002
-#define OPERAND_EAX         0x1004
-#define OPERAND_RAX         0x1008
-
-#define OPCODE_MAX_SIZE     16
-
-/*
- * Encode type
- */
-enum encode_type {
-    ENCODE_M,
-    ENCODE_RM,
-    ENCODE_MR,
-    ENCODE_OI,
-    ENCODE_MI,
-    ENCODE_D,
-};
-
 /*
  * _operand_num_by_encode_type -- get the number of operands for the specified
  * encode type
@@ -133,13 +37,18 @@ static __inline__ int
 _operand_num_by_encode_type(enum encode_type enc)
 {
     switch ( enc ) {
+    case ENCODE_ZO:
+        return 0;
     case ENCODE_M:
     case ENCODE_D:
+    case ENCODE_O:
         return 1;
     case ENCODE_RM:
     case ENCODE_MR:
     case ENCODE_OI:
     case ENCODE_MI:
+    case ENCODE_I:
+    case ENCODE_MC:
         return 2;
     }
 
@@ -165,168 +74,19 @@ _encode_type_str(enum encode_type enc)
         return "MI";
     case ENCODE_D:
         return "D";
+    case ENCODE_I:
+        return "I";
+    case ENCODE_O:
+        return "O";
+    case ENCODE_MC:
+        return "MC";
+    case ENCODE_ZO:
+        return "ZO";
     default:
         return NULL;
     }
 }
 
-/*
- * Opcode
- */
-struct opcode {
-    size_t size;
-    int opcode[OPCODE_MAX_SIZE];
-};
-
-/*
- * Encode: M
- */
-struct encode_m {
-    int m;
-};
-
-/*
- * Encode: RM
- */
-struct encode_rm {
-    int r;
-    int rm;
-};
-
-/*
- * Encode: MR
- */
-struct encode_mr {
-    int rm;
-    int r;
-};
-
-/*
- * Encode: OI
- */
-struct encode_oi {
-    int r;
-    int imm;
-};
-
-/*
- * Encode: MI
- */
-struct encode_mi {
-    int rm;
-    int imm;
-};
-
-/*
- * Encode: D
- */
-struct encode_d {
-    int ptr;
-};
-
-/*
- * Encode
- */
-struct encode {
-    enum encode_type type;
-    union {
-        struct encode_m m;
-        struct encode_rm rm;
-        struct encode_mr mr;
-        struct encode_oi oi;
-        struct encode_mi mi;
-        struct encode_d d;
-    } u;
-};
-
-/*
- * Rule tuple
- */
-struct rule {
-    struct encode encode;
-    struct opcode op;
-    struct rule *next;
-};
-
-/*
- * Rules for a mnemonic
- */
-struct mnemonic {
-    char *mnemonic;
-    struct rule *rules;
-    struct mnemonic *next;
-};
-
-/*
- * Rules
- */
-struct x86_64_instr_ruleset {
-    struct mnemonic *mnemonics;
-};
-
-/*
- * Architecture-specific data structure
- */
-struct x86_64_asm {
-    struct x86_64_instr_ruleset ruleset;
-};
-
-/*
- * Trim leading and trailing whitespaces
- */
-static char *
-_trim(char *s)
-{
-    char *ns;
-    char *rs;
-
-    rs = s;
-    ns = s;
-
-    /* Remove leading whitespaces */
-    while ( *s ) {
-        if ( isspace(*s) ) {
-            s++;
-        } else {
-            break;
-        }
-    }
-
-    /* Copy */
-    while ( *s ) {
-        *ns = *s;
-        ns++;
-        s++;
-    }
-    *ns = 0;
-
-    /* Remove trailing whitespaces */
-    ns--;
-    while ( isspace(*ns) ) {
-        *ns = '\0';
-        ns--;
-    }
-
-    return rs;
-}
-
-/*
- * _ishexdigit -- check if the hexdecimal ascii character
- */
-static int
-_ishexdigit(int c)
-{
-    if ( '0' <= c && c <= '9' ) {
-        return 1;
-    } else if ( 'a' <= c && c <= 'f' ) {
-        return 1;
-    } else if ( 'A' <= c && c <= 'F' ) {
-        return 1;
-    } else {
-        return 0;
-    }
-}
-
 /*
  * _check_size
  */
@@ -339,7 +99,7 @@ _check_size(int64_t val)
         return 1;
     } else if ( val >= -0x8000 && val < 0x8000 ) {
         return 2;
-    } else if ( val >= -0x80000000 && val < 0x80000000 ) {
+    } else if ( val >= -0x80000000LL && val < 0x80000000LL ) {
         return 4;
     } else {
         return 8;
@@ -347,711 +107,163 @@ _check_size(int64_t val)
 }
 
 /*
- * _free_rule
- */
-static void
-_free_rule(struct rule *rule)
-{
-    free(rule);
-}
-
-/*
- * _free_mnemonic
- */
-static void
-_free_mnemonic(struct mnemonic *mnemonic)
-{
-    struct rule *rule;
-    struct rule *next;
-
-    if ( mnemonic->mnemonic ) {
-        free(mnemonic->mnemonic);
-    }
-    rule = mnemonic->rules;
-    while ( NULL != rule ) {
-        next = rule->next;
-        _free_rule(rule);
-        rule = next;
-    }
-    free(mnemonic);
-}
-
-/*
- * _parse_opcode_chunk -- parse an opcode chunk
+ * _operand_key -- get the key of the rule index for the operands
  */
 static int
-_parse_opcode_chunk(const char *token)
+_operand_key(int n, const x86_64_operand_t *ops)
 {
-    int ret;
-
-    /* Hexdecimal */
-    if ( 2 == strlen(token) ) {
-        if ( _ishexdigit(token[0]) && _ishexdigit(token[1]) ) {
-            return strtol(token, NULL, 16);
-        }
-    }
-
-    if ( 0 == strcasecmp("W", token) ) {
-        /* REX.W */
-        return OPCODE_REXW;
-    } else if ( '/' == *token ) {
-        token++;
-        if ( 'r' == *token ) {
-            ret = OPCODE_REGISTER;
-        } else if ( '0' <= *token && *token <= '7' ) {
-            ret = OPCODE_DIGIT_PREFIX + (*token - '0');
-        } else {
-            return -1;
-        }
-        token++;
-        if ( '\0' != *token ) {
-            return -1;
-        }
-        return ret;
-    } else if ( 0 == strcasecmp("cb", token) ) {
-        return OPCODE_CB;
-    } else if ( 0 == strcasecmp("cw", token) ) {
-        return OPCODE_CW;
-    } else if ( 0 == strcasecmp("cd", token) ) {
-        return OPCODE_CD;
-    } else if ( 0 == strcasecmp("cp", token) ) {
-        return OPCODE_CP;
-    } else if ( 0 == strcasecmp("co", token) ) {
-        return OPCODE_CO;
-    } else if ( 0 == strcasecmp("ct", token) ) {
-        return OPCODE_CT;
-    } else if ( 0 == strcasecmp("ib", token) ) {
-        return OPCODE_IB;
-    } else if ( 0 == strcasecmp("iw", token) ) {
-        return OPCODE_IW;
-    } else if ( 0 == strcasecmp("id", token) ) {
-        return OPCODE_ID;
-    } else if ( 0 == strcasecmp("io", token) ) {
-        return OPCODE_IO;
-    } else if ( '+' == *token ) {
-        token++;
-        if ( 0 == strcasecmp("rb", token ) ) {
-            return OPCODE_RB;
-        } else if ( 0 == strcasecmp("rw", token ) ) {
-            return OPCODE_RW;
-        } else if ( 0 == strcasecmp("rd", token ) ) {
-            return OPCODE_RD;
-        } else if ( 0 == strcasecmp("ro", token ) ) {
-            return OPCODE_RO;
-        } else if ( '0' <= *token && *token <= '7' ) {
-            ret = OPCODE_ST_PREFIX + (*token - '0');
-            token++;
-            if ( '\0' != *token ) {
-                return -1;
-            }
-            return ret;
-        } else {
-            return -1;
-        }
-    }
-
-    return -1;
-}
-
-/*
- * _parse_opcode -- parse an opcode field
- */
-static int
-_parse_opcode(struct opcode *op, const char *opcode)
-{
-    char *tok;
-    char *savedptr;
-    char *s;
-    int c;
+    int kinds[OPERAND_MAX_NUM];
+    int size;
+    int bits;
+    int i;
 
-    /* Copy the opcode */
-    s = strdup(opcode);
-    if ( NULL == s ) {
+    if ( n < 0 || n > OPERAND_MAX_NUM ) {
         return -1;
     }
-
-    tok = strtok_r(s, " ", &savedptr);
-    op->size = 0;
-    while ( NULL != tok ) {
-        c = _parse_opcode_chunk(tok);
-        if ( c < 0 ) {
+    kinds[0] = IDEF_KIND_NONE;
+    kinds[1] = IDEF_KIND_NONE;
+    size = 0;
+    for ( i = 0; i < n; i++ ) {
+        switch ( ops[i].type ) {
+        case X86_64_OPERAND_REG:
+            kinds[i] = IDEF_KIND_REG;
+            bits = REG_SIZE(ops[i].u.reg);
+            break;
+        case X86_64_OPERAND_MEM:
+            kinds[i] = IDEF_KIND_MEM;
+            bits = ops[i].u.mem.size;
+            break;
+        case X86_64_OPERAND_IMM:
+            kinds[i] = IDEF_KIND_IMM;
+            bits = 0;
+            break;
+        default:
             return -1;
-        } else {
-            if ( op->size >= OPCODE_MAX_SIZE ) {
-                /* Exceed the maximum opcode size */
-                return -1;
-            }
-            op->opcode[op->size] = c;
-            op->size++;
         }
-        tok = strtok_r(NULL, " ", &savedptr);
-    }
-
-    return 0;
-}
-
-/*
- * _parse_encode_type -- parse the encode type of an token
- */
-static int
-_parse_encode_type(const char *token)
-{
-    if ( 0 == strcasecmp("M", token) ) {
-        return ENCODE_M;
-    } else if ( 0 == strcasecmp("RM", token) ) {
-        return ENCODE_RM;
-    } else if ( 0 == strcasecmp("MR", token) ) {
-        return ENCODE_MR;
-    } else if ( 0 == strcasecmp("OI", token) ) {
-        return ENCODE_OI;
-    } else if ( 0 == strcasecmp("MI", token) ) {
-        return ENCODE_MI;
-    } else if ( 0 == strcasecmp("D", token) ) {
-        return ENCODE_D;
-    }
-
-    return -1;
-}
-
-/* 
- * _parse_operand_chunk -- parse an operand chunk
- */
-static int
-_parse_operand_chunk(const char *token)
-{
-    if ( 0 == strcasecmp("rel8", token) ) {
-        /* rel8 */
-        return OPERAND_REL8;
-    } else if ( 0 == strcasecmp("rel16", token) ) {
-        /* rel16 */
-        return OPERAND_REL16;
-    } else if ( 0 == strcasecmp("rel32", token) ) {
-        /* rel32 */
-        return OPERAND_REL32;
-    } else if ( 0 == strcasecmp("rel64", token) ) {
-        /* rel64 */
-        return OPERAND_REL64;
-    } else if ( 0 == strcasecmp("ptr16:16", token) ) {
-        /* ptr16:16 */
-        return OPERAND_PTR16_16;
-    } else if ( 0 == strcasecmp("ptr16:32", token) ) {
-        /* ptr16:32 */
-        return OPERAND_PTR16_32;
-    } else if ( 0 == strcasecmp("ptr16:64", token) ) {
-        /* ptr16:64 */
-        return OPERAND_PTR16_64;
-    } else if ( 0 == strcasecmp("r8", token) ) {
-        /* r8 */
-        return OPERAND_R8;
-    } else if ( 0 == strcasecmp("r8*", token) ) {
-        /* r8* */
-        return OPERAND_R8X;
-    } else if ( 0 == strcasecmp("r16", token) ) {
-        /* r16 */
-        return OPERAND_R16;
-    } else if ( 0 == strcasecmp("r32", token) ) {
-        /* r32 */
-        return OPERAND_R32;
-    } else if ( 0 == strcasecmp("r64", token) ) {
-        /* r64 */
-        return OPERAND_R64;
-    } else if ( 0 == strcasecmp("r/m8", token) ) {
-        /* r/m8 */
-        return OPERAND_RM8;
-    } else if ( 0 == strcasecmp("r/m8*", token) ) {
-        /* r/m8* */
-        return OPERAND_RM8X;
-    } else if ( 0 == strcasecmp("r/m16", token) ) {
-        /* r/m16 */
-        return OPERAND_RM16;
-    } else if ( 0 == strcasecmp("r/m32", token) ) {
-        /* r/m32 */
-        return OPERAND_RM32;
-    } else if ( 0 == strcasecmp("r/m64", token) ) {
-        /* r/m64 */
-        return OPERAND_RM64;
-    } else if ( 0 == strcasecmp("imm8", token) ) {
-        /* imm8 */
-        return OPERAND_IMM8;
-    } else if ( 0 == strcasecmp("imm16", token) ) {
-        /* imm16 */
-        return OPERAND_IMM16;
-    } else if ( 0 == strcasecmp("imm32", token) ) {
-        /* imm32 */
-        return OPERAND_IMM32;
-    } else if ( 0 == strcasecmp("imm64", token) ) {
-        /* imm64 */
-        return OPERAND_IMM64;
-    } else if ( 0 == strcasecmp("m16:16", token) ) {
-        /* m16:16 */
-        return OPERAND_M16_16;
-    } else if ( 0 == strcasecmp("m16:32", token) ) {
-        /* m16:32 */
-        return OPERAND_M16_32;
-    } else if ( 0 == strcasecmp("m16:64", token) ) {
-        /* m16:64 */
-        return OPERAND_M16_64;
-    } else if ( 0 == strcasecmp("al", token) ) {
-        /* al */
-        return OPERAND_AL;
-    } else if ( 0 == strcasecmp("ax", token) ) {
-        /* ax */
-        return OPERAND_AX;
-    } else if ( 0 == strcasecmp("eax", token) ) {
-        /* eax */
-        return OPERAND_EAX;
-    } else if ( 0 == strcasecmp("rax", token) ) {
-        /* rax */
-        return OPERAND_RAX;
-    }
-
-    return -1;
-}
-
-/*
- * _parse_operand
- */
-int
-_parse_operand(struct encode *encode, int enc, const char *operands)
-{
-    char *s;
-    char *tok;
-    char *savedptr;
-    int arr[3];
-    int operand;
-    int n;
-
-    /* Duplicate the operand string */
-    s = strdup(operands);
-    if ( NULL == s ) {
-        return -1;
-    }
-
-    n = 0;
-    tok = strtok_r(s, ",", &savedptr);
-    while ( NULL != tok ) {
-        if ( n < 3 ) {
-            operand = _parse_operand_chunk(_trim(tok));
-            if ( operand < 0 ) {
-                return -1;
-            }
-            arr[n] = operand;
-            n++;
+        if ( 0 == size ) {
+            /* The operation size is the size of the first register or memory
+               operand */
+            size = bits;
         }
-        tok = strtok_r(NULL, ",", &savedptr);
     }
 
-    encode->type = enc;
-    switch ( enc ) {
-    case ENCODE_RM:
-        if ( n != 2 ) {
-            return -1;
-        }
-        encode->u.rm.r = arr[0];
-        encode->u.rm.rm = arr[1];
-        break;
-    case ENCODE_MR:
-        if ( n != 2 ) {
-            return -1;
-        }
-        encode->u.mr.rm = arr[0];
-        encode->u.mr.r = arr[1];
-        break;
-    case ENCODE_OI:
-        if ( n != 2 ) {
-            return -1;
-        }
-        encode->u.oi.r = arr[0];
-        encode->u.oi.imm = arr[1];
-        break;
-    case ENCODE_MI:
-        if ( n != 2 ) {
-            return -1;
-        }
-        encode->u.mi.rm = arr[0];
-        encode->u.mi.imm = arr[1];
-        break;
-    case ENCODE_M:
-        if ( n != 1 ) {
-            return -1;
-        }
-        encode->u.m.m = arr[0];
-        break;
-    case ENCODE_D:
-        if ( n != 1 ) {
-            return -1;
-        }
-        encode->u.d.ptr = arr[0];
-        break;
+    switch ( size ) {
+    case 0:
+        return IDEF_KEY(kinds[0], kinds[1], IDEF_SIZE_NONE);
+    case 8:
+        return IDEF_KEY(kinds[0], kinds[1], IDEF_SIZE_8);
+    case 16:
+        return IDEF_KEY(kinds[0], kinds[1], IDEF_SIZE_16);
+    case 32:
+        return IDEF_KEY(kinds[0], kinds[1], IDEF_SIZE_32);
+    case 64:
+        return IDEF_KEY(kinds[0], kinds[1], IDEF_SIZE_64);
     default:
         return -1;
     }
-
-    return 0;
 }
 
 /*
- * Parse an instruction definition file
- */
-static struct mnemonic *
-_instr_parse_file(const char *m, const char *fname)
-{
-    struct mnemonic *mnemonic;
-    struct rule *rule;
-    FILE *fp;
-    char buf[1024];
-    char *tok;
-    char *savedptr;
-    char *cols[5];
-    int n;
-    int enc;
-    int ret;
-
-    mnemonic = malloc(sizeof(struct mnemonic));
-    if ( NULL == mnemonic ) {
-        return NULL;
-    }
-    mnemonic->mnemonic = strdup(m);
-    if ( NULL == mnemonic ) {
-        free(mnemonic);
-        return NULL;
-    }
-    mnemonic->rules = NULL;
-    mnemonic->next = NULL;
-
-    fp = fopen(fname, "r");
-    if ( NULL == fp ) {
-        free(mnemonic->mnemonic);
-        free(mnemonic);
-        return NULL;
-    }
-
-    while ( !feof(fp) ) {
-        if ( NULL == fgets(buf, sizeof(buf), fp) ) {
-            if ( !feof(fp) ) {
-                /* Error */
-                fclose(fp);
-                _free_mnemonic(mnemonic);
-                return NULL;
-            }
-            break;
-        }
-        /* Parse this line */
-        _trim(buf);
-        if ( 0 == strncmp("//", buf, 2) ) {
-            /* Comment */
-            continue;
-        }
-        /* New rule */
-        rule = malloc(sizeof(struct rule));
-        if ( NULL == rule ) {
-            fclose(fp);
-            _free_mnemonic(mnemonic);
-            return NULL;
-        }
-        rule->op.size = 0;
-        rule->next = NULL;
-
-        n = 0;
-        tok = strtok_r(buf, "|", &savedptr);
-        while ( NULL != tok ) {
-            if ( n < 5 ) {
-                cols[n] = _trim(tok);
-                n++;
-            }
-            tok = strtok_r(NULL, "|", &savedptr);
-        }
-        if ( 5 != n ) {
-            /* Invalid line */
-            fprintf(stderr, "Invalid instruction rule\n");
-            free(rule);
-            continue;
-        }
-
-        /* Parse the encode type */
-        enc = _parse_encode_type(cols[1]);
-        if ( enc < 0 ) {
-            free(rule);
-            continue;
-        }
-        /* Parse the opcode */
-        ret = _parse_opcode(&rule->op, cols[0]);
-        if ( 0 != ret ) {
-            free(rule);
-            continue;
-        }
-        /* Parse the operand */
-        ret = _parse_operand(&rule->encode, enc, cols[2]);
-        if ( 0 != ret ) {
-            free(rule);
-            continue;
-        }
-
-        rule->next = mnemonic->rules;
-        mnemonic->rules = rule;
-    }
-
-    fclose(fp);
-
-    return mnemonic;
-}
-
-/*
- * _is_operand_mem
+ * _imm_fits -- check if the immediate value is encoded in the specified bytes;
+ * the value is sign-extended unless it has the operation size
  */
 static int
-_is_operand_mem(x86_64_operand_t *op)
+_imm_fits(int64_t imm, int bytes, int opbytes)
 {
-    if ( op->type == X86_64_OPERAND_MEM ) {
+    if ( _check_size(imm) <= bytes ) {
         return 1;
-    } else {
-        return 0;
-    }
-}
-
-/*
- * _is_operand_reg
- */
-static int
-_is_operand_reg(x86_64_operand_t *op)
-{
-    if ( op->type == X86_64_OPERAND_REG ) {
-        return 1;
-    } else {
-        return 0;
-    }
-}
-
-/*
- * _is_operand_reg_mem
- */
-static int
-_is_operand_reg_mem(x86_64_operand_t *op)
-{
-    if ( op->type == X86_64_OPERAND_REG || op->type == X86_64_OPERAND_MEM ) {
-        return 1;
-    } else {
-        return 0;
-    }
-}
-
-/*
- * _operand_imm
- */
-static int
-_operand_imm(x86_64_operand_t *op)
-{
-    if ( op->type != X86_64_OPERAND_IMM ) {
-        return -1;
     }
-
-    if ( op->u.imm == 0 ) {
-        return 0;
-    } else if ( op->u.imm >= -0x80 && op->u.imm < 0x80 ) {
+    if ( bytes == opbytes && bytes < 8 && imm >= 0
+         && imm < ((int64_t)1 << (bytes * 8)) ) {
         return 1;
-    } else if ( op->u.imm >= -0x8000 && op->u.imm < 0x8000 ) {
-        return 2;
-    } else {
-        return 4;
-    }
-}
-
-/*
- * _search_encode_m
- */
-static int
-_search_encode_m(struct rule *rule, int n, x86_64_operand_t *ops)
-{
-    int scale;
-
-    /* Assertion */
-    if ( rule->encode.type != ENCODE_M ) {
-        return -1;
-    }
-
-    /* Check the number of operands */
-    if ( n != 1 ) {
-        return -1;
-    }
-
-    /* Check the operand type */
-    if ( ops[0].type != X86_64_OPERAND_MEM ) {
-        return -1;
-    }
-    /* Check the operand size */
-    if ( ops[0].u.mem.base < 0 || ops[0].u.mem.base > 7 ) {
-        return -1;
-    }
-    switch ( ops[0].u.mem.scale ) {
-    case 1:
-        scale = 0;
-        break;
-    case 2:
-        scale = 1;
-        break;
-    case 4:
-        scale = 2;
-        break;
-    case 8:
-        scale = 3;
-        break;
-    default:
-        /* Invalid scale */
-        return -1;
-    }
-
-    switch ( rule->encode.u.m.m ) {
-    case OPERAND_M16_16:
-        printf("m16_16 Scale: %d\n", ops[0].u.mem.scale);
-        break;
-    case OPERAND_M16_32:
-        printf("m16_32 Scale: %d\n", ops[0].u.mem.scale);
-        break;
-    case OPERAND_M16_64:
-        printf("m16_64 Scale: %d\n", ops[0].u.mem.scale);
-        break;
-    default:
-        return -1;
-    }
-
-    return 0;
-}
-
-/*
- * _search_encode_rm
- */
-static int
-_search_encode_rm(struct rule *rule, int n, x86_64_operand_t *ops)
-{
-    /* Assertion */
-    if ( rule->encode.type != ENCODE_RM ) {
-        return -1;
-    }
-
-    /* Check the number of operands */
-    if ( n != 2 ) {
-        return -1;
-    }
-    /* Check the operand type */
-    if ( !_is_operand_reg(&ops[0]) ) {
-        return -1;
-    }
-    if ( !_is_operand_reg_mem(&ops[1]) ) {
-        return -1;
     }
 
     return 0;
 }
 
 /*
- * _search_encode_mr
+ * _match -- check if the operands match the rule
  */
 static int
-_search_encode_mr(struct rule *rule, int n, x86_64_operand_t *ops)
+_match(const struct rule *rule, int n, const x86_64_operand_t *ops)
 {
-    /* Assertion */
-    if ( rule->encode.type != ENCODE_RM ) {
-        return -1;
-    }
-
-    /* Check the number of operands */
-    if ( n != 2 ) {
-        return -1;
-    }
-    /* Check the operand type */
-    if ( !_is_operand_reg_mem(&ops[0]) ) {
-        return -1;
-    }
-    if ( !_is_operand_reg(&ops[1]) ) {
-        return -1;
-    }
-
-    return 0;
-}
+    int opbytes;
+    int spec;
+    int i;
 
-/*
- * _search_encode_mi
- */
-static int
-_search_encode_mi(struct rule *rule, int n, x86_64_operand_t *ops)
-{
-    /* Assertion */
-    if ( rule->encode.type != ENCODE_MI ) {
-        return -1;
+    opbytes = 0;
+    for ( i = 0; i < n && 0 == opbytes; i++ ) {
+        switch ( OPERAND_CLASS(rule->operands[i]) ) {
+        case OPERAND_CLASS_R:
+        case OPERAND_CLASS_RM:
+        case OPERAND_CLASS_ACC:
+            opbytes = OPERAND_BYTES(rule->operands[i]);
+            break;
+        }
     }
 
-    /* Check the number of operands */
-    if ( n != 2 ) {
-        return -1;
-    }
-    /* Check the operand type */
-    if ( !_is_operand_reg_mem(&ops[0]) ) {
-        return -1;
-    }
-    if ( _operand_imm(&ops[1]) < 0 ) {
-        return -1;
+    for ( i = 0; i < n; i++ ) {
+        spec = rule->operands[i];
+        switch ( ops[i].type ) {
+        case X86_64_OPERAND_REG:
+            if ( REG_SIZE(ops[i].u.reg) != OPERAND_BYTES(spec) * 8 ) {
+                return 0;
+            }
+            if ( OPERAND_CLASS(spec) == OPERAND_CLASS_ACC
+                 && (REG_CODE(ops[i].u.reg) != 0 || REG_REX(ops[i].u.reg)) ) {
+                /* Not the accumulator */
+                return 0;
+            }
+            if ( OPERAND_CLASS(spec) == OPERAND_CLASS_CL
+                 && ops[i].u.reg != REG_CL ) {
+                /* Not the count register */
+                return 0;
+            }
+            break;
+        case X86_64_OPERAND_MEM:
+            if ( OPERAND_CLASS(spec) == OPERAND_CLASS_M ) {
+                /* Memory of any size */
+                break;
+            }
+            if ( ops[i].u.mem.size != 0
+                 && ops[i].u.mem.size != OPERAND_BYTES(spec) * 8 ) {
+                return 0;
+            }
+            break;
+        case X86_64_OPERAND_IMM:
+            if ( !_imm_fits(ops[i].u.imm, OPERAND_BYTES(spec), opbytes) ) {
+                return 0;
+            }
+            break;
+        }
     }
 
-    return 0;
+    return 1;
 }
 
 /*
- * _search_encode_d
+ * _search_rule -- search a matching rule; the candidates for the kinds and
+ * the size of the operands are in the order of the length of the encoding,
+ * and the first matching one is the shortest
  */
 static int
-_search_encode_d(struct rule *rule, int n, x86_64_operand_t *ops)
+_search_rule(const struct mnemonic *mnemonic, int n, x86_64_operand_t *ops,
+             const struct rule **found)
 {
-    /* Assertion */
-    if ( rule->encode.type != ENCODE_MI ) {
-        return -1;
-    }
+    const struct rule *rule;
+    int key;
+    int i;
 
-    /* Check the number of operands */
-    if ( n != 1 ) {
+    key = _operand_key(n, ops);
+    if ( key < 0 ) {
         return -1;
     }
-
-    return 0;
-}
-
-/*
- * _search_rule -- search a matching rule
- */
-static int
-_search_rule(struct mnemonic *mnemonic, int n, x86_64_operand_t *ops,
-             struct rule **found)
-{
-    struct rule *rule;
-    int ret;
-
-    rule = mnemonic->rules;
-    while ( NULL != rule ) {
-        /* Check the operand size first */
-        if ( n != _operand_num_by_encode_type(rule->encode.type) ) {
-            continue;
-        }
-        ret = _search_encode_m(rule, n, ops);
-        if ( 0 == ret ) {
+    for ( i = mnemonic->bucket[key]; i < mnemonic->bucket[key + 1]; i++ ) {
+        rule = &mnemonic->rules[mnemonic->cands[i]];
+        if ( _match(rule, n, ops) ) {
             *found = rule;
             return 0;
         }
-        ret = _search_encode_rm(rule, n, ops);
-        if ( 0 == ret ) {
-            *found = rule;
-            return 0;
-        }
-        ret = _search_encode_mr(rule, n, ops);
-        if ( 0 == ret ) {
-            *found = rule;
-            return 0;
-        }
-        ret = _search_encode_mi(rule, n, ops);
-        if ( 0 == ret ) {
-            *found = rule;
-            return 0;
-        }
-
-        rule = rule->next;
     }
 
     return -1;
@@ -1062,58 +274,47 @@ _search_rule(struct mnemonic *mnemonic, int n, x86_64_operand_t *ops,
  * operands.
  */
 int
-x86_64_search(struct x86_64_instr_ruleset *ruleset, const char *mne, int n,
-              x86_64_operand_t *ops, struct rule **found)
+x86_64_search(const struct x86_64_instr_ruleset *ruleset, const char *mne,
+              int n, x86_64_operand_t *ops, const struct rule **found)
 {
-    struct mnemonic *mnemonic;
-
-    mnemonic = ruleset->mnemonics;
+    const struct mnemonic *mnemonic;
 
-    while ( NULL != mnemonic ) {
-        if ( 0 == strcmp(mne, mnemonic->mnemonic) ) {
-            /* Found */
-            return _search_rule(mnemonic, n, ops, found);
-        }
-        mnemonic = mnemonic->next;
+    /* Mnemonics are in the perfect hash table, so that the slot is the only
+       candidate */
+    mnemonic = &ruleset->mnemonics[idef_hash(mne, ruleset->seed)
+                                   & (ruleset->size - 1)];
+    if ( NULL == mnemonic->mnemonic || 0 != strcmp(mne, mnemonic->mnemonic) ) {
+        return -1;
     }
 
-    return -1;
+    return _search_rule(mnemonic, n, ops, found);
 }
 
 /*
- * x86_64_load_instr -- load all instructions
+ * x86_64_print_instr -- print out all instructions
  */
 int
-x86_64_load_instr(struct x86_64_asm *arch)
+x86_64_print_instr(struct x86_64_asm *arch)
 {
-    struct x86_64_instr_ruleset ruleset;
-    struct mnemonic *mnemonic;
-    static const char *mnemonics[]
-        = {"adc", "adcx", "add", "call", "jmp", "mov", "xor"};
-    int i;
-    char fname[128];
-
-    ruleset.mnemonics = NULL;
-
-    /* Load the instruction datasheet */
-    for ( i = 0; i < sizeof(mnemonics) / sizeof(mnemonics[0]); i++ ) {
-        snprintf(fname, sizeof(fname), BASEDIR INSTR_FILE_FORMAT, mnemonics[i]);
-        mnemonic = _instr_parse_file(mnemonics[i], fname);
-        if ( NULL == mnemonic ) {
-            return -1;
+    const struct x86_64_instr_ruleset *ruleset;
+    const struct mnemonic *mnemonic;
+    const struct rule *rule;
+    size_t i;
+    size_t j;
+    size_t k;
+
+    ruleset = arch->ruleset;
+
+    /* Output the instructions */
+    for ( i = 0; i < ruleset->size; i++ ) {
+        mnemonic = &ruleset->mnemonics[i];
+        if ( NULL == mnemonic->mnemonic ) {
+            continue;
         }
-        mnemonic->next = ruleset.mnemonics;
-        ruleset.mnemonics = mnemonic;
-    }
-
-    /* Output the loaded instructions */
-    struct rule *rule;
-    mnemonic = ruleset.mnemonics;
-    while ( NULL != mnemonic ) {
         printf("* %s\n", mnemonic->mnemonic);
-        rule = mnemonic->rules;
-        while ( NULL != rule ) {
-            printf("Encode: %x / ", rule->encode.type);
+        for ( j = 0; j < mnemonic->nrules; j++ ) {
+            rule = &mnemonic->rules[j];
+            printf("Encode: %s / ", _encode_type_str(rule->encode.type));
             switch ( rule->encode.type ) {
             case ENCODE_M:
                 printf("M %x", rule->encode.u.m.m);
@@ -1133,68 +334,46 @@ x86_64_load_instr(struct x86_64_asm *arch)
             case ENCODE_D:
                 printf("D %x", rule->encode.u.d.ptr);
                 break;
+            case ENCODE_I:
+                printf("I %x %x", rule->encode.u.i.acc, rule->encode.u.i.imm);
+                break;
+            case ENCODE_O:
+                printf("O %x", rule->encode.u.o.r);
+                break;
+            case ENCODE_MC:
+                printf("MC %x %x", rule->encode.u.mc.rm, rule->encode.u.mc.c);
+                break;
+            case ENCODE_ZO:
+                printf("ZO");
+                break;
             }
             printf(" /");
-            for ( i = 0; i < rule->op.size; i++ ) {
-                printf(" %x", rule->op.opcode[i]);
+            for ( k = 0; k < rule->op.size; k++ ) {
+                printf(" %x", rule->op.opcode[k]);
             }
             printf("\n");
-            rule = rule->next;
         }
-        mnemonic = mnemonic->next;
     }
 
-    /* Try to search */
-    x86_64_operand_t ops[2];
-    struct rule *found;
-    int ret;
-    ops[0].type = X86_64_OPERAND_MEM;
-    ops[0].u.mem.base = 0;
-    ops[0].u.mem.sindex = 0;
-    ops[0].u.mem.scale = 1;
-    ops[0].u.mem.disp = 0;
-    ret = x86_64_search(&ruleset, "call", 1, ops, &found);
-    printf("Search (call): %d %p\n", ret, found);
-
-    ops[0].type = X86_64_OPERAND_REG;
-    ops[0].u.reg = REG_RAX;
-    ops[1].type = X86_64_OPERAND_REG;
-    ops[1].u.reg = REG_RAX;
-    ret = x86_64_search(&ruleset, "xor", 2, ops, &found);
-    printf("Search (xor): %d %p %s\n", ret, found,
-           _encode_type_str(found->encode.type));
-
     return 0;
 }
 
 /*
- * x86_64_initialize
+ * x86_64_initialize -- initialize the assembler; the instruction set is the
+ * precompiled table, so that nothing is loaded at runtime
  */
 struct x86_64_asm *
 x86_64_initialize(struct x86_64_asm *arch)
 {
-    int ret;
-    int allocated;
-
-    allocated = 0;
     if ( NULL == arch ) {
         /* Allocate a new instance */
         arch = malloc(sizeof(struct x86_64_asm));
         if ( NULL == arch ) {
             return NULL;
         }
-        allocated = 1;
     }
     (void)memset(arch, 0, sizeof(struct x86_64_asm));
-
-    /* Load instructions */
-    ret = x86_64_load_instr(arch);
-    if ( 0 != ret ) {
-        if ( allocated ) {
-            free(arch);
-        }
-        return NULL;
-    }
+    arch->ruleset = &x86_64_ruleset;
 
     return arch;
 }
@@ -1215,4 +394,4 @@ x86_64_asm(struct x86_64_instr_ruleset *ruleset)
  * End:
  * vim600: sw=4 ts=4 fdm=marker
  * vim<600: sw=4 ts=4
- */
+ */
\ No newline at end of file
@@ -25,6 +25,7 @@
 #define _ARCH_X86_64_INSTR_H
 
 #include <stdint.h>
+#include "idef.h"
 
 /*
  * Operand type
@@ -36,13 +37,15 @@ typedef enum {
 } x86_64_operand_type_t;
 
 /*
- * Memory operand
+ * Memory operand; the size is the access size in bits, or zero if it is
+ * given by the register operand
  */
 typedef struct {
     int base;
     int sindex;
     int scale;
     int32_t disp;
+    int size;
 } x86_64_operand_mem_t;
 
 /*
@@ -53,10 +56,34 @@ typedef struct {
     union {
         int reg;
         x86_64_operand_mem_t mem;
-        uint32_t imm;
+        int64_t imm;
     } u;
 } x86_64_operand_t;
 
+/*
+ * Architecture-specific data structure
+ */
+struct x86_64_asm {
+    const struct x86_64_instr_ruleset *ruleset;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* instr.c */
+int
+x86_64_search(const struct x86_64_instr_ruleset *, const char *, int,
+              x86_64_operand_t *, const struct rule **);
+int
+x86_64_print_instr(struct x86_64_asm *);
+struct x86_64_asm *
+x86_64_initialize(struct x86_64_asm *);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* _ARCH_X86_64_INSTR_H */
 
 /*
@@ -27,6 +27,7 @@
 #define REG_GENERIC     0
 #define REG_SEGMENT     1
 #define REG_DEBUG       2
+#define REG_IP          3
 
 #define REG_CODE(r)     ((r) & 0x7)
 #define REG_REX(r)      (((r) >> 3) & 0x1)
@@ -40,15 +41,16 @@
 
 #define SEG_ENCODE(code, size)  ((code) | (1 << 8))
 #define DB_ENCODE(code, size)   ((code) | (2 << 8))
+#define IP_ENCODE(code, size)   ((code) | (3 << 8) | ((size) << 16))
 
 /*
  * x86-64 registers
  */
 typedef enum {
     REG_NONE = 0,
-    /* IP */
+    /* IP; only as the base of RIP-relative addressing */
     //REG_EIP,
-    //REG_RIP,
+    REG_RIP = IP_ENCODE(5, 64),
     /* AX */
     REG_AL = REG_ENCODE(0, 0, 0, 0, 8),
     REG_AH = REG_ENCODE(4, 0, 0, 1, 8),
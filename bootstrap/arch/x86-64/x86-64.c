@@ -22,11 +22,13 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "reg.h"
 #include "instr.h"
-#include "../../ir.h"
+#include "../../arch.h"
+#include "../../intern.h"
 
 /*     return (1<<6) | (w<<3) | (r<<2) | (x<<1) | b; */
 #define REX             (1<<6)
@@ -58,10 +60,8 @@
 /* Group 4 */
 #define OVERRIDE_ADDR_SIZE  0x67
 
-void *
-x86_64_initialize(void *);
-int
-x86_64_load_instr(void *);
+/* Maximum length of an instruction */
+#define X86_64_INSTR_MAX_LEN    15
 
 /*
  * Encode ModR/M
@@ -211,7 +211,8 @@ _rex(int rex, x86_64_reg_t r, x86_64_reg_t rmbase, x86_64_reg_t s)
     rex |= REG_REX(s) ? REX_X : 0;
     rex |= REG_REX(rmbase) ? REX_B : 0;
 
-    if ( rex ) {
+    /* spl, bpl, sil, and dil are encoded with REX */
+    if ( rex || REG_REX0(r) || REG_REX0(rmbase) ) {
         if ( REG_NE(r) || REG_NE(s) || REG_NE(rmbase) ) {
             /* Not encodable */
             return -1;
@@ -321,6 +322,8 @@ static int
 _encode_rm_mem(uint8_t *code, int *rex, x86_64_operand_t op1,
                x86_64_operand_t op2)
 {
+    x86_64_reg_t base;
+    x86_64_reg_t idx;
     int size;
     int ss;
     int mod;
@@ -349,10 +352,28 @@ _encode_rm_mem(uint8_t *code, int *rex, x86_64_operand_t op1,
         /* Invalid scale */
         return -1;
     }
+    base = op2.u.mem.base;
+    idx = op2.u.mem.sindex;
+
+    if ( base == REG_RIP ) {
+        /* RIP-relative (disp32 from the end of the instruction) */
+        if ( idx != REG_NONE ) {
+            return -1;
+        }
+        ret = _encode_modrm(code, rex, 0, op1.u.reg, REG_RBP);
+        if ( ret < 0 ) {
+            return -1;
+        }
+        memcpy(code + ret, &op2.u.mem.disp, 4);
+        return ret + 4;
+    }
 
     /* Check the displacement */
-    if ( op2.u.mem.disp == 0 ) {
-        /* No displacement */
+    if ( base == REG_NONE ) {
+        /* No base (disp32 for any displacement values) */
+        mod = 0;
+    } else if ( op2.u.mem.disp == 0 && REG_CODE(base) != 5 ) {
+        /* No displacement; rbp and r13 need the displacement as the base */
         mod = 0;
     } else if ( op2.u.mem.disp <= 0x7f && op2.u.mem.disp >= -0x80 ) {
         /* 1-byte displacement */
@@ -362,27 +383,19 @@ _encode_rm_mem(uint8_t *code, int *rex, x86_64_operand_t op1,
         mod = 2;
     }
 
-    /* Check if SIB is needed */
-    if ( (op2.u.mem.sindex != REG_NONE && op2.u.mem.base != REG_NONE) || ss )  {
-        /* Encode SIB */
+    /* Check if SIB is needed; rsp and r12 as the base need SIB */
+    if ( idx != REG_NONE || ss || base == REG_NONE || REG_CODE(base) == 4 ) {
+        /* Encode SIB; no index is encoded as rsp, and no base as rbp */
         ret = _encode_modrm_sib(code, rex, mod, op1.u.reg,
-                                op2.u.mem.base, op2.u.mem.sindex, ss);
-        if ( ret < 0 ) {
-            return -1;
-        }
-        size = ret;
-    } else if ( op2.u.mem.sindex == REG_NONE && op2.u.mem.base == REG_NONE ) {
-        /* Displacement only (disp32 for any displacement values) */
-        ret = _encode_modrm(code, rex, op1.u.reg, REG_NONE, 5);
+                                base == REG_NONE ? REG_RBP : base,
+                                idx == REG_NONE ? REG_RSP : idx, ss);
         if ( ret < 0 ) {
             return -1;
         }
         size = ret;
-        /* Force to use disp32 */
-        mod = 2;
     } else {
-        /* ss=0, then ModR/M is used without SIB */
-        ret = _encode_modrm(code, rex, mod, op1.u.reg, op2.u.mem.sindex);
+        /* ModR/M is used without SIB */
+        ret = _encode_modrm(code, rex, mod, op1.u.reg, base);
         if ( ret < 0 ) {
             return -1;
         }
@@ -390,17 +403,12 @@ _encode_rm_mem(uint8_t *code, int *rex, x86_64_operand_t op1,
     }
 
     /* Add displacement */
-    switch ( mod ) {
-    case 1:
-        memcpy(code + size, &op2.u.mem.disp, 1);
-        size += 1;
-        break;
-    case 2:
+    if ( base == REG_NONE || mod == 2 ) {
         memcpy(code + size, &op2.u.mem.disp, 4);
         size += 4;
-        break;
-    default:
-        ;
+    } else if ( mod == 1 ) {
+        memcpy(code + size, &op2.u.mem.disp, 1);
+        size += 1;
     }
 
     return size;
@@ -442,40 +450,253 @@ _encode_mr(uint8_t *code, int *rex, x86_64_operand_t op1,
 }
 
 /*
- * _encode_mi -- MI
+ * _encode_m -- M; the reg field of ModR/M is the opcode extension
  */
 static int
-_encode_mi(uint8_t *code, int *rex, x86_64_operand_t op1,
-           x86_64_operand_t op2, size_t size)
+_encode_m(uint8_t *code, int *rex, int digit, x86_64_operand_t op1)
 {
     /* Pseudo operand */
     x86_64_operand_t pop;
-    int ret;
 
-    if ( op1.type != X86_64_OPERAND_REG && op1.type != X86_64_OPERAND_MEM ) {
-        return -1;
+    pop.type = X86_64_OPERAND_REG;
+    pop.u.reg = REG_ENCODE(digit, 0, 0, 0, 0);
+
+    return _encode_rm(code, rex, pop, op1);
+}
+
+/*
+ * _is_prefix -- check if the opcode byte is a mandatory prefix, which
+ * precedes REX
+ */
+static int
+_is_prefix(int c)
+{
+    return c == OVERRIDE_OPERAND_SIZE || c == REPNE || c == REP;
+}
+
+/*
+ * _operation_bytes -- get the operation size of the rule in bytes
+ */
+static int
+_operation_bytes(const struct rule *rule)
+{
+    int i;
+
+    for ( i = 0; i < rule->noperands; i++ ) {
+        switch ( OPERAND_CLASS(rule->operands[i]) ) {
+        case OPERAND_CLASS_R:
+        case OPERAND_CLASS_RM:
+        case OPERAND_CLASS_ACC:
+            return OPERAND_BYTES(rule->operands[i]);
+        }
     }
-    if ( op2.type != X86_64_OPERAND_IMM ) {
-        return -1;
+
+    return 0;
+}
+
+/*
+ * _encode_rule -- encode an instruction with the operands by the rule found
+ * by x86_64_search(); return the length of the instruction
+ */
+static int
+_encode_rule(uint8_t *code, const struct rule *rule,
+             const x86_64_operand_t *ops)
+{
+    uint8_t modrm[8];
+    x86_64_operand_t rm;
+    int64_t imm;
+    size_t i;
+    int oreg;
+    int nmodrm;
+    int rex;
+    int len;
+    int c;
+
+    /* Operands encoded in the ModR/M, the opcode, and the immediate */
+    rm.type = X86_64_OPERAND_REG;
+    rm.u.reg = REG_NONE;
+    oreg = REG_NONE;
+    imm = 0;
+    switch ( rule->encode.type ) {
+    case ENCODE_M:
+    case ENCODE_MC:
+        rm = ops[0];
+        break;
+    case ENCODE_MI:
+        rm = ops[0];
+        imm = ops[1].u.imm;
+        break;
+    case ENCODE_O:
+        oreg = ops[0].u.reg;
+        break;
+    case ENCODE_OI:
+        oreg = ops[0].u.reg;
+        imm = ops[1].u.imm;
+        break;
+    case ENCODE_I:
+        imm = ops[1].u.imm;
+        break;
+    case ENCODE_D:
+        imm = ops[0].u.imm;
+        break;
+    default:
+        break;
     }
 
-    pop.type = X86_64_OPERAND_REG;
-    pop.u.reg = REG_NONE;
-    if ( op1.type == X86_64_OPERAND_REG ) {
-        ret = _encode_rm_reg(code, rex, pop, op1);
-    } else if ( op1.type == X86_64_OPERAND_MEM ) {
-        ret = _encode_rm_mem(code, rex, pop, op1);
-    } else {
-        return -1;
+    /* Resolve REX and ModR/M */
+    rex = 0;
+    nmodrm = 0;
+    for ( i = 0; i < rule->op.size; i++ ) {
+        if ( rule->op.opcode[i] == OPCODE_REXW ) {
+            rex |= REX_W;
+        }
     }
-    if ( ret < 0 ) {
-        return -1;
+    for ( i = 0; i < rule->op.size; i++ ) {
+        c = rule->op.opcode[i];
+        if ( c == OPCODE_REGISTER ) {
+            if ( rule->encode.type == ENCODE_RM ) {
+                nmodrm = _encode_rm(modrm, &rex, ops[0], ops[1]);
+            } else if ( rule->encode.type == ENCODE_MR ) {
+                nmodrm = _encode_mr(modrm, &rex, ops[0], ops[1]);
+            } else {
+                return -1;
+            }
+        } else if ( (c & 0xf00) == OPCODE_DIGIT_PREFIX ) {
+            nmodrm = _encode_m(modrm, &rex, c & 0xff, rm);
+        } else if ( (c & 0xf00) == (OPCODE_RB & 0xf00) ) {
+            rex = _rex(rex, REG_NONE, oreg, REG_NONE);
+        }
+        if ( nmodrm < 0 || rex < 0 ) {
+            return -1;
+        }
+    }
+    if ( rex ) {
+        rex |= REX;
+    }
+
+    /* Prefixes */
+    len = 0;
+    if ( _operation_bytes(rule) == 2 ) {
+        code[len++] = OVERRIDE_OPERAND_SIZE;
+    }
+    for ( i = 0; i < rule->op.size && _is_prefix(rule->op.opcode[i]); i++ ) {
+        code[len++] = rule->op.opcode[i];
+    }
+    if ( rex ) {
+        code[len++] = rex;
+    }
+
+    /* Opcode, ModR/M, and the immediate value or code offset */
+    for ( ; i < rule->op.size; i++ ) {
+        c = rule->op.opcode[i];
+        if ( c < 0x100 ) {
+            code[len++] = c;
+        } else if ( c == OPCODE_REGISTER
+                    || (c & 0xf00) == OPCODE_DIGIT_PREFIX ) {
+            memcpy(code + len, modrm, nmodrm);
+            len += nmodrm;
+        } else if ( (c & 0xf00) == (OPCODE_RB & 0xf00) ) {
+            if ( len == 0 ) {
+                return -1;
+            }
+            code[len - 1] += REG_CODE(oreg);
+        } else if ( (c & 0xf00) == (OPCODE_CB & 0xf00)
+                    || (c & 0xf00) == (OPCODE_IB & 0xf00) ) {
+            memcpy(code + len, &imm, c & 0xff);
+            len += c & 0xff;
+        } else if ( c != OPCODE_REXW ) {
+            return -1;
+        }
     }
-    memcpy(code + ret, &op2.u.imm, size);
 
-    return ret + size;
+    return len;
 }
 
+/*
+ * Encodings expected of the rules selected; the shortest form is taken for the
+ * immediate values fitting 8 bits and for the accumulator
+ */
+#define X86_64_REG(r)   { .type = X86_64_OPERAND_REG, .u.reg = (r) }
+#define X86_64_IMM(i)   { .type = X86_64_OPERAND_IMM, .u.imm = (i) }
+#define X86_64_MEM(b, d, s)                                             \
+    { .type = X86_64_OPERAND_MEM,                                       \
+      .u.mem = { .base = (b), .sindex = REG_NONE, .scale = 1,           \
+                 .disp = (d), .size = (s) } }
+static const struct {
+    const char *mne;
+    int n;
+    x86_64_operand_t ops[2];
+    int len;
+    uint8_t code[X86_64_INSTR_MAX_LEN];
+} _encodings[] = {
+    { "add", 2, { X86_64_REG(REG_RAX), X86_64_IMM(1) },
+      4, { 0x48, 0x83, 0xc0, 0x01 } },
+    { "add", 2, { X86_64_REG(REG_RAX), X86_64_IMM(1000) },
+      6, { 0x48, 0x05, 0xe8, 0x03, 0x00, 0x00 } },
+    { "add", 2, { X86_64_REG(REG_EAX), X86_64_IMM(1000) },
+      5, { 0x05, 0xe8, 0x03, 0x00, 0x00 } },
+    { "add", 2, { X86_64_REG(REG_RCX), X86_64_IMM(1000) },
+      7, { 0x48, 0x81, 0xc1, 0xe8, 0x03, 0x00, 0x00 } },
+    { "add", 2, { X86_64_REG(REG_ECX), X86_64_IMM(127) },
+      3, { 0x83, 0xc1, 0x7f } },
+    { "add", 2, { X86_64_REG(REG_ECX), X86_64_IMM(128) },
+      6, { 0x81, 0xc1, 0x80, 0x00, 0x00, 0x00 } },
+    { "add", 2, { X86_64_REG(REG_ECX), X86_64_IMM(-128) },
+      3, { 0x83, 0xc1, 0x80 } },
+    { "add", 2, { X86_64_REG(REG_R8), X86_64_IMM(-1) },
+      4, { 0x49, 0x83, 0xc0, 0xff } },
+    { "add", 2, { X86_64_REG(REG_AL), X86_64_IMM(0xff) },
+      2, { 0x04, 0xff } },
+    { "and", 2, { X86_64_REG(REG_EAX), X86_64_IMM(0xffff) },
+      5, { 0x25, 0xff, 0xff, 0x00, 0x00 } },
+    { "xor", 2, { X86_64_REG(REG_RAX), X86_64_REG(REG_RAX) },
+      3, { 0x48, 0x33, 0xc0 } },
+    { "xor", 2, { X86_64_REG(REG_SIL), X86_64_REG(REG_SIL) },
+      3, { 0x40, 0x32, 0xf6 } },
+    { "add", 2, { X86_64_REG(REG_R8L), X86_64_IMM(1) },
+      4, { 0x41, 0x80, 0xc0, 0x01 } },
+    { "mov", 2, { X86_64_MEM(REG_RBP, -8, 64), X86_64_REG(REG_RAX) },
+      4, { 0x48, 0x89, 0x45, 0xf8 } },
+    { "mov", 2, { X86_64_REG(REG_RAX), X86_64_MEM(REG_RBP, -1000, 64) },
+      7, { 0x48, 0x8b, 0x85, 0x18, 0xfc, 0xff, 0xff } },
+    { "call", 1, { X86_64_MEM(REG_RAX, 0, 64) },
+      2, { 0xff, 0x10 } },
+};
+
+/*
+ * _test_encodings -- check the rules selected and their encodings
+ */
+static int
+_test_encodings(struct x86_64_asm *arch)
+{
+    const struct rule *rule;
+    x86_64_operand_t ops[2];
+    uint8_t code[X86_64_INSTR_MAX_LEN];
+    size_t i;
+    int len;
+    int j;
+
+    for ( i = 0; i < sizeof(_encodings) / sizeof(_encodings[0]); i++ ) {
+        memcpy(ops, _encodings[i].ops, sizeof(ops));
+        len = -1;
+        if ( x86_64_search(arch->ruleset, _encodings[i].mne, _encodings[i].n,
+                           ops, &rule) == 0 ) {
+            len = _encode_rule(code, rule, ops);
+        }
+        if ( len != _encodings[i].len
+             || memcmp(code, _encodings[i].code, len) != 0 ) {
+            fprintf(stderr, "Wrong encoding of %s (#%zu):", _encodings[i].mne,
+                    i);
+            for ( j = 0; j < len; j++ ) {
+                fprintf(stderr, " %02x", code[j]);
+            }
+            fprintf(stderr, "\n");
+            return -1;
+        }
+    }
+
+    return 0;
+}
 
 /*
  * Temporary function for testing
@@ -491,8 +712,15 @@ x86_64_test(uint8_t *code)
     if ( NULL == arch ) {
         return -1;
     }
-    /* Load the instruction set */
-    ret = x86_64_load_instr(arch);
+    /* Print out the instruction set, and check the encodings */
+    ret = x86_64_print_instr(arch);
+    if ( ret == 0 ) {
+        ret = _test_encodings(arch);
+    }
+    free(arch);
+    if ( ret < 0 ) {
+        return -1;
+    }
 
     /* mov %rdi,%rax */
     int rex;
@@ -511,26 +739,1493 @@ x86_64_test(uint8_t *code)
 }
 
 /*
- * x86_64_assemble -- assemble from IR to x86-64 code
+ * Code generation from IR; the registers of the IR are allocated by
+ * regalloc(), and the spilled ones are in the slots of the stack frame below
+ * the frame pointer.  The scratch register is not allocated to the virtual
+ * registers, and is used when an operation cannot take the operands as they
+ * are.  A coroutine takes the pointer to its frame in the first argument
+ * register, and the dispatch to the resume point uses the scratch and the
+ * accumulator, which is not an argument register.
  */
-int
-x86_64_assemble(ir_object_t *obj)
-{
+#define X86_64_SCRATCH          REG_R11
+#define X86_64_SLOT_SIZE        8
+#define X86_64_STACK_ALIGN      16
+#define X86_64_CORO_FRAME       REG_RDI
+#define X86_64_CORO_TABLE       REG_RAX
+
+/*
+ * Callee-saved registers except for the frame pointer
+ */
+static const int _callee_saved[] = {
+    REG_RBX, REG_R12, REG_R13, REG_R14, REG_R15,
+};
+#define X86_64_NSAVED   (int)(sizeof(_callee_saved) / sizeof(int))
+
+/*
+ * Conditions of the signed and unsigned comparisons; njcc jumps if the
+ * condition does not hold
+ */
+static const struct {
+    ir_opcode_t opcode;
+    int unsig;
+    const char *setcc;
+    const char *jcc;
+    const char *njcc;
+} _conds[] = {
+    { IR_OPCODE_CMP_EQ, 0, "sete", "je", "jne" },
+    { IR_OPCODE_CMP_NEQ, 0, "setne", "jne", "je" },
+    { IR_OPCODE_CMP_GT, 0, "setg", "jg", "jle" },
+    { IR_OPCODE_CMP_LT, 0, "setl", "jl", "jge" },
+    { IR_OPCODE_CMP_GEQ, 0, "setge", "jge", "jl" },
+    { IR_OPCODE_CMP_LEQ, 0, "setle", "jle", "jg" },
+    { IR_OPCODE_CMP_EQ, 1, "sete", "je", "jne" },
+    { IR_OPCODE_CMP_NEQ, 1, "setne", "jne", "je" },
+    { IR_OPCODE_CMP_GT, 1, "seta", "ja", "jbe" },
+    { IR_OPCODE_CMP_LT, 1, "setb", "jb", "jae" },
+    { IR_OPCODE_CMP_GEQ, 1, "setae", "jae", "jb" },
+    { IR_OPCODE_CMP_LEQ, 1, "setbe", "jbe", "ja" },
+};
+
+/*
+ * Jump to a block placed later; the displacement is resolved after all the
+ * blocks of the function are placed
+ */
+struct x86_64_fixup {
+    off_t pos;
+    int block;
+};
+
+/*
+ * Context of the code generation
+ */
+struct x86_64_gen {
     struct x86_64_asm *arch;
-    int ret;
+    arch_code_t *code;
+    /* Allocated sizes of the text and the symbols */
+    size_t tsize;
+    int ssize;
+    /* Function being assembled */
+    ir_func_t *func;
+    off_t *blocks;
+    int *uses;
+    struct {
+        size_t n;
+        size_t size;
+        struct x86_64_fixup *fixups;
+    } fixup;
+    /* Callee-saved registers to save */
+    int saved[X86_64_NSAVED];
+    int nsaved;
+    /* Size of the stack frame, or -1 without the frame pointer */
+    int frame;
+    /* Jump table of the coroutine (the offsets of the resume points from the
+       table), and the number of the yields placed */
+    off_t table;
+    int nyields;
+};
 
-    /* Initialize the x86_64 assembler */
-    arch = x86_64_initialize(NULL);
-    if ( NULL == arch ) {
+/*
+ * _reg -- register operand
+ */
+static x86_64_operand_t
+_reg(int reg)
+{
+    x86_64_operand_t op;
+
+    op.type = X86_64_OPERAND_REG;
+    op.u.reg = reg;
+
+    return op;
+}
+
+/*
+ * _imm -- immediate operand
+ */
+static x86_64_operand_t
+_imm(int64_t imm)
+{
+    x86_64_operand_t op;
+
+    op.type = X86_64_OPERAND_IMM;
+    op.u.imm = imm;
+
+    return op;
+}
+
+/*
+ * _mem -- memory operand of base + disp
+ */
+static x86_64_operand_t
+_mem(int base, int32_t disp, int size)
+{
+    x86_64_operand_t op;
+
+    op.type = X86_64_OPERAND_MEM;
+    op.u.mem.base = base;
+    op.u.mem.sindex = REG_NONE;
+    op.u.mem.scale = 1;
+    op.u.mem.disp = disp;
+    op.u.mem.size = size;
+
+    return op;
+}
+
+/*
+ * _subreg -- get the register of the specified size sharing the register
+ * code
+ */
+static int
+_subreg(int reg, int bits)
+{
+    if ( bits == 8 ) {
+        return REG_ENCODE(REG_CODE(reg), REG_REX(reg),
+                          !REG_REX(reg) && REG_CODE(reg) >= 4, 0, 8);
+    }
+
+    return REG_ENCODE(REG_CODE(reg), REG_REX(reg), 0, 0, bits);
+}
+
+/*
+ * _size -- get the size of a register or memory operand in bits
+ */
+static int
+_size(x86_64_operand_t op)
+{
+    if ( op.type == X86_64_OPERAND_REG ) {
+        return REG_SIZE(op.u.reg);
+    } else if ( op.type == X86_64_OPERAND_MEM ) {
+        return op.u.mem.size;
+    }
+
+    return 0;
+}
+
+/*
+ * _same -- check if two operands are the same location
+ */
+static int
+_same(x86_64_operand_t a, x86_64_operand_t b)
+{
+    if ( a.type == X86_64_OPERAND_REG && b.type == X86_64_OPERAND_REG ) {
+        return REG_CODE(a.u.reg) == REG_CODE(b.u.reg)
+            && REG_REX(a.u.reg) == REG_REX(b.u.reg);
+    }
+    if ( a.type == X86_64_OPERAND_MEM && b.type == X86_64_OPERAND_MEM ) {
+        return a.u.mem.base == b.u.mem.base && a.u.mem.disp == b.u.mem.disp
+            && a.u.mem.sindex == REG_NONE && b.u.mem.sindex == REG_NONE;
+    }
+
+    return 0;
+}
+
+/*
+ * _scratch -- scratch register of the size of the operand
+ */
+static x86_64_operand_t
+_scratch(x86_64_operand_t op)
+{
+    return _reg(_subreg(X86_64_SCRATCH, _size(op)));
+}
+
+/*
+ * _reserve -- reserve the space of the text
+ */
+static int
+_reserve(struct x86_64_gen *gen, size_t len)
+{
+    arch_code_t *code;
+    uint8_t *s;
+    size_t nsize;
+
+    code = gen->code;
+    if ( code->text.size + len <= gen->tsize ) {
+        return 0;
+    }
+    nsize = gen->tsize ? gen->tsize : 4096;
+    while ( nsize < code->text.size + len ) {
+        nsize <<= 1;
+    }
+    s = realloc(code->text.s, nsize);
+    if ( s == NULL ) {
         return -1;
     }
-    /* Load the instruction set */
-    ret = x86_64_load_instr(arch);
-    if ( ret < 0 ) {
+    code->text.s = s;
+    gen->tsize = nsize;
+
+    return 0;
+}
+
+/*
+ * _emit_rule -- emit an instruction by the rule
+ */
+static int
+_emit_rule(struct x86_64_gen *gen, const struct rule *rule,
+           x86_64_operand_t *ops)
+{
+    int len;
+
+    if ( _reserve(gen, X86_64_INSTR_MAX_LEN) < 0 ) {
+        return -1;
+    }
+    len = _encode_rule(gen->code->text.s + gen->code->text.size, rule, ops);
+    if ( len < 0 ) {
         return -1;
     }
+    gen->code->text.size += len;
 
-    return -1;
+    return 0;
+}
+
+/*
+ * _emit -- emit an instruction; the shortest encoding is selected for the
+ * operands
+ */
+static int
+_emit(struct x86_64_gen *gen, const char *mne, int n, x86_64_operand_t *ops)
+{
+    const struct rule *rule;
+
+    if ( x86_64_search(gen->arch->ruleset, mne, n, ops, &rule) < 0 ) {
+        return -1;
+    }
+
+    return _emit_rule(gen, rule, ops);
+}
+
+/*
+ * _emit0 -- emit an instruction without operands
+ */
+static int
+_emit0(struct x86_64_gen *gen, const char *mne)
+{
+    return _emit(gen, mne, 0, NULL);
+}
+
+/*
+ * _emit1 -- emit an instruction with an operand
+ */
+static int
+_emit1(struct x86_64_gen *gen, const char *mne, x86_64_operand_t op)
+{
+    return _emit(gen, mne, 1, &op);
+}
+
+/*
+ * _emit2 -- emit an instruction with two operands
+ */
+static int
+_emit2(struct x86_64_gen *gen, const char *mne, x86_64_operand_t op1,
+       x86_64_operand_t op2)
+{
+    x86_64_operand_t ops[2];
+
+    ops[0] = op1;
+    ops[1] = op2;
+
+    return _emit(gen, mne, 2, ops);
+}
+
+/*
+ * _sym -- add a symbol; return the index of the symbol
+ */
+static int
+_sym(struct x86_64_gen *gen, arch_sym_type_t type, const char *label,
+     off_t pos, size_t size)
+{
+    arch_code_t *code;
+    arch_sym_t *syms;
+    int nsize;
+
+    code = gen->code;
+    if ( code->sym.n >= gen->ssize ) {
+        nsize = gen->ssize ? gen->ssize * 2 : 16;
+        syms = realloc(code->sym.syms, sizeof(arch_sym_t) * nsize);
+        if ( syms == NULL ) {
+            return -1;
+        }
+        code->sym.syms = syms;
+        gen->ssize = nsize;
+    }
+    code->sym.syms[code->sym.n].type = type;
+    code->sym.syms[code->sym.n].label = label;
+    code->sym.syms[code->sym.n].pos = pos;
+    code->sym.syms[code->sym.n].size = size;
+    code->sym.syms[code->sym.n].ref = NULL;
+
+    return code->sym.n++;
+}
+
+/*
+ * _bits -- get the operation size of a virtual register; the integers
+ * shorter than 32 bits and booleans are operated in 32 bits
+ */
+static int
+_bits(struct x86_64_gen *gen, int r)
+{
+    switch ( gen->func->reg.regs[r].type ) {
+    case IR_REG_PTR:
+    case IR_REG_I64:
+    case IR_REG_U64:
+        return 64;
+    default:
+        return 32;
+    }
+}
+
+/*
+ * _loc -- get the location of a virtual register
+ */
+static int
+_loc(struct x86_64_gen *gen, int r, int bits, x86_64_operand_t *op)
+{
+    ir_reg_t *reg;
+
+    if ( r < 0 || (size_t)r >= gen->func->reg.n ) {
+        return -1;
+    }
+    reg = &gen->func->reg.regs[r];
+    if ( reg->hreg >= 0 ) {
+        *op = _reg(_subreg(reg->hreg, bits));
+    } else if ( reg->slot >= 0 ) {
+        *op = _mem(REG_RBP, -X86_64_SLOT_SIZE * (reg->slot + 1), bits);
+    } else {
+        /* Not allocated */
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _imm_value -- get the value of an immediate
+ */
+static int64_t
+_imm_value(const ir_imm_t *imm)
+{
+    switch ( imm->type ) {
+    case IR_IMM_I8:
+        return imm->u.u8;
+    case IR_IMM_S8:
+        return imm->u.s8;
+    case IR_IMM_I16:
+        return imm->u.u16;
+    case IR_IMM_S16:
+        return imm->u.s16;
+    case IR_IMM_I32:
+        return imm->u.u32;
+    case IR_IMM_S32:
+        return imm->u.s32;
+    default:
+        return imm->u.s64;
+    }
+}
+
+/*
+ * _operand -- get the operand of an IR operand
+ */
+static int
+_operand(struct x86_64_gen *gen, const ir_operand_t *src, int bits,
+         x86_64_operand_t *op)
+{
+    int64_t v;
+
+    switch ( src->type ) {
+    case OPERAND_TYPE_REG:
+        return _loc(gen, src->u.reg, bits, op);
+    case OPERAND_TYPE_IMM:
+        v = _imm_value(&src->u.imm);
+        if ( bits < 64 ) {
+            v = (int32_t)v;
+        }
+        *op = _imm(v);
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+/*
+ * _ref -- get the memory operand of an IR reference; the base and the index
+ * are in the physical registers
+ */
+static int
+_ref(struct x86_64_gen *gen, const ir_operand_t *src, int bits,
+     x86_64_operand_t *op)
+{
+    x86_64_operand_t r;
+
+    if ( src->type != OPERAND_TYPE_REF || src->u.ref.disp < INT32_MIN
+         || src->u.ref.disp > INT32_MAX ) {
+        return -1;
+    }
+    *op = _mem(REG_NONE, src->u.ref.disp, bits);
+    if ( src->u.ref.base >= 0 ) {
+        if ( _loc(gen, src->u.ref.base, 64, &r) < 0
+             || r.type != X86_64_OPERAND_REG ) {
+            return -1;
+        }
+        op->u.mem.base = r.u.reg;
+    }
+    if ( src->u.ref.index >= 0 ) {
+        if ( _loc(gen, src->u.ref.index, 64, &r) < 0
+             || r.type != X86_64_OPERAND_REG ) {
+            return -1;
+        }
+        op->u.mem.sindex = r.u.reg;
+        op->u.mem.scale = src->u.ref.scale;
+    }
+
+    return 0;
+}
+
+/*
+ * _mov -- move a value; an immediate value is moved by the shortest
+ * instruction
+ */
+static int
+_mov(struct x86_64_gen *gen, x86_64_operand_t dst, x86_64_operand_t src)
+{
+    x86_64_operand_t t;
+
+    if ( _same(dst, src) ) {
+        return 0;
+    }
+    if ( src.type == X86_64_OPERAND_IMM && dst.type == X86_64_OPERAND_REG ) {
+        if ( src.u.imm == 0 ) {
+            /* Zero; the upper 32 bits are also cleared */
+            dst = _reg(_subreg(dst.u.reg, 32));
+            return _emit2(gen, "xor", dst, dst);
+        }
+        if ( REG_SIZE(dst.u.reg) == 64 && src.u.imm > 0
+             && src.u.imm <= (int64_t)UINT32_MAX ) {
+            /* Zero-extended to 64 bits */
+            dst = _reg(_subreg(dst.u.reg, 32));
+        }
+    }
+    if ( dst.type == X86_64_OPERAND_MEM
+         && (src.type == X86_64_OPERAND_MEM
+             || (src.type == X86_64_OPERAND_IMM
+                 && (src.u.imm < INT32_MIN || src.u.imm > INT32_MAX))) ) {
+        /* Through the scratch register */
+        t = _scratch(dst);
+        if ( _mov(gen, t, src) < 0 ) {
+            return -1;
+        }
+        src = t;
+    }
+
+    return _emit2(gen, "mov", dst, src);
+}
+
+/*
+ * _narrow -- truncate the value of a register narrower than 32 bits, and
+ * sign- or zero-extend it to the operation size by the type
+ */
+static int
+_narrow(struct x86_64_gen *gen, int r)
+{
+    ir_reg_type_t type;
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    x86_64_operand_t t;
+    int w;
+
+    type = gen->func->reg.regs[r].type;
+    w = ir_reg_type_bits(type);
+    if ( w >= 32 || type == IR_REG_BOOL ) {
+        return 0;
+    }
+    if ( _loc(gen, r, 32, &d) < 0 ) {
+        return -1;
+    }
+    if ( d.type == X86_64_OPERAND_REG ) {
+        t = d;
+        a = _reg(_subreg(d.u.reg, w));
+    } else {
+        t = _scratch(d);
+        a = d;
+        a.u.mem.size = w;
+    }
+    if ( _emit2(gen, ir_reg_type_unsigned(type) ? "movzx" : "movsx", t,
+                a) < 0 ) {
+        return -1;
+    }
+
+    return _mov(gen, d, t);
+}
+
+/*
+ * _convert -- emit the move of a value to a register; the value of a
+ * narrower register is extended by its type, and the value is truncated to
+ * the type of the destination
+ */
+static int
+_convert(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    ir_reg_type_t stype;
+    ir_reg_type_t dtype;
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    x86_64_operand_t t;
+    int bits;
+    int r;
+
+    r = p->result.reg[0];
+    bits = _bits(gen, r);
+    if ( _loc(gen, r, bits, &d) < 0 ) {
+        return -1;
+    }
+    if ( p->operands[0].type != OPERAND_TYPE_REG ) {
+        /* The immediate values are of the type of the destination */
+        if ( _operand(gen, &p->operands[0], bits, &a) < 0 ) {
+            return -1;
+        }
+        return _mov(gen, d, a);
+    }
+    stype = gen->func->reg.regs[p->operands[0].u.reg].type;
+    dtype = gen->func->reg.regs[r].type;
+    if ( bits == 64 && _bits(gen, p->operands[0].u.reg) < 64 ) {
+        /* Extend from the 32-bit operation size */
+        if ( _operand(gen, &p->operands[0], 32, &a) < 0 ) {
+            return -1;
+        }
+        t = d.type == X86_64_OPERAND_REG ? d : _scratch(d);
+        if ( ir_reg_type_unsigned(stype) ) {
+            /* The upper 32 bits are cleared */
+            if ( _emit2(gen, "mov", _reg(_subreg(t.u.reg, 32)), a) < 0 ) {
+                return -1;
+            }
+        } else if ( _emit2(gen, "movsxd", t, a) < 0 ) {
+            return -1;
+        }
+        return _mov(gen, d, t);
+    }
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0
+         || _mov(gen, d, a) < 0 ) {
+        return -1;
+    }
+    if ( ir_reg_type_bits(stype) > ir_reg_type_bits(dtype)
+         || ir_reg_type_unsigned(stype) != ir_reg_type_unsigned(dtype) ) {
+        return _narrow(gen, r);
+    }
+
+    return 0;
+}
+
+/*
+ * _binop -- emit d = a op b in the two-address form
+ */
+static int
+_binop(struct x86_64_gen *gen, const char *mne, int commutative,
+       x86_64_operand_t d, x86_64_operand_t a, x86_64_operand_t b)
+{
+    const struct rule *rule;
+    x86_64_operand_t ops[2];
+    x86_64_operand_t t;
+
+    if ( commutative && !_same(a, d)
+         && (_same(b, d) || (a.type == X86_64_OPERAND_IMM
+                             && b.type != X86_64_OPERAND_IMM)) ) {
+        t = a;
+        a = b;
+        b = t;
+    }
+
+    /* Compute in the destination unless b is overwritten before used */
+    if ( d.type == X86_64_OPERAND_REG && !_same(b, d) ) {
+        t = d;
+    } else {
+        t = _scratch(d);
+    }
+
+    /* Load the immediate value that the instruction cannot take */
+    if ( b.type == X86_64_OPERAND_IMM ) {
+        ops[0] = t;
+        ops[1] = b;
+        if ( x86_64_search(gen->arch->ruleset, mne, 2, ops, &rule) < 0 ) {
+            if ( _same(t, _scratch(d)) ) {
+                return -1;
+            }
+            if ( _mov(gen, _scratch(d), b) < 0 ) {
+                return -1;
+            }
+            b = _scratch(d);
+        }
+    }
+
+    if ( _mov(gen, t, a) < 0 ) {
+        return -1;
+    }
+    if ( _emit2(gen, mne, t, b) < 0 ) {
+        return -1;
+    }
+
+    return _mov(gen, d, t);
+}
+
+/*
+ * _arith -- emit an arithmetic, bit-wise, or shift operation
+ */
+static int
+_arith(struct x86_64_gen *gen, ir_instr_t *p, const char *mne,
+       int commutative)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    x86_64_operand_t b;
+    int bits;
+
+    bits = _bits(gen, p->result.reg[0]);
+    if ( _loc(gen, p->result.reg[0], bits, &d) < 0
+         || _operand(gen, &p->operands[0], bits, &a) < 0
+         || _operand(gen, &p->operands[1], bits, &b) < 0 ) {
+        return -1;
+    }
+    if ( p->opcode == IR_OPCODE_LSHIFT || p->opcode == IR_OPCODE_RSHIFT ) {
+        /* The count is an immediate or in CL */
+        if ( b.type == X86_64_OPERAND_IMM ) {
+            b.u.imm &= bits - 1;
+        } else if ( b.type == X86_64_OPERAND_REG
+                    && REG_CODE(b.u.reg) == REG_CODE(REG_CL)
+                    && !REG_REX(b.u.reg) ) {
+            b = _reg(REG_CL);
+        } else {
+            return -1;
+        }
+    }
+    if ( _binop(gen, mne, commutative, d, a, b) < 0 ) {
+        return -1;
+    }
+
+    /* The bit-wise operations and the right shift keep the extension */
+    switch ( p->opcode ) {
+    case IR_OPCODE_ADD:
+    case IR_OPCODE_SUB:
+    case IR_OPCODE_MUL:
+    case IR_OPCODE_LSHIFT:
+        return _narrow(gen, p->result.reg[0]);
+    default:
+        return 0;
+    }
+}
+
+/*
+ * _unary -- emit d = op a
+ */
+static int
+_unary(struct x86_64_gen *gen, ir_instr_t *p, const char *mne)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    x86_64_operand_t t;
+    int bits;
+
+    bits = _bits(gen, p->result.reg[0]);
+    if ( _loc(gen, p->result.reg[0], bits, &d) < 0
+         || _operand(gen, &p->operands[0], bits, &a) < 0 ) {
+        return -1;
+    }
+    t = d.type == X86_64_OPERAND_REG ? d : _scratch(d);
+    if ( _mov(gen, t, a) < 0 || _emit1(gen, mne, t) < 0
+         || _mov(gen, d, t) < 0 ) {
+        return -1;
+    }
+
+    return _narrow(gen, p->result.reg[0]);
+}
+
+/*
+ * _divide -- emit the division; the dividend and the quotient are in rax, and
+ * the remainder is in rdx (see _constrain() of regalloc.c); the division is
+ * unsigned if the quotient is of an unsigned type
+ */
+static int
+_divide(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    x86_64_operand_t a;
+    x86_64_operand_t b;
+    int bits;
+
+    if ( p->result.n != 2 ) {
+        return -1;
+    }
+    bits = _bits(gen, p->result.reg[0]);
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0
+         || _operand(gen, &p->operands[1], bits, &b) < 0 ) {
+        return -1;
+    }
+    if ( !_same(a, _reg(REG_RAX)) || b.type == X86_64_OPERAND_IMM ) {
+        return -1;
+    }
+    if ( ir_reg_type_unsigned(gen->func->reg.regs[p->result.reg[0]].type) ) {
+        if ( _emit2(gen, "xor", _reg(REG_EDX), _reg(REG_EDX)) < 0
+             || _emit1(gen, "div", b) < 0 ) {
+            return -1;
+        }
+    } else if ( _emit0(gen, bits == 64 ? "cqo" : "cdq") < 0
+                || _emit1(gen, "idiv", b) < 0 ) {
+        return -1;
+    }
+
+    /* The quotient of the minimum value by -1 overflows the type */
+    return _narrow(gen, p->result.reg[0]);
+}
+
+/*
+ * _mulh -- emit the multiplication of the full width; the first operand and
+ * the low half are in rax, and the high half is in rdx
+ */
+static int
+_mulh(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    x86_64_operand_t a;
+    x86_64_operand_t b;
+    ir_reg_type_t type;
+    int bits;
+
+    if ( p->result.n != 2 ) {
+        return -1;
+    }
+    bits = _bits(gen, p->result.reg[0]);
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0
+         || _operand(gen, &p->operands[1], bits, &b) < 0 ) {
+        return -1;
+    }
+    if ( !_same(a, _reg(REG_RAX)) || b.type == X86_64_OPERAND_IMM ) {
+        return -1;
+    }
+
+    type = gen->func->reg.regs[p->result.reg[0]].type;
+
+    return _emit1(gen, ir_reg_type_unsigned(type) ? "mul" : "imul", b);
+}
+
+/*
+ * _cond -- get the index of the condition of a comparison, or -1; the
+ * comparison is unsigned if the register operand is of an unsigned type
+ */
+static int
+_cond(struct x86_64_gen *gen, const ir_instr_t *p)
+{
+    size_t i;
+    int unsig;
+    int j;
+
+    unsig = 0;
+    for ( j = 0; j < p->noperands && j < 2; j++ ) {
+        if ( p->operands[j].type == OPERAND_TYPE_REG ) {
+            unsig = ir_reg_type_unsigned(
+                gen->func->reg.regs[p->operands[j].u.reg].type);
+            break;
+        }
+    }
+    for ( i = 0; i < sizeof(_conds) / sizeof(_conds[0]); i++ ) {
+        if ( _conds[i].opcode == p->opcode && _conds[i].unsig == unsig ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * _compare -- emit the comparison of the operands
+ */
+static int
+_compare(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    x86_64_operand_t a;
+    x86_64_operand_t b;
+    x86_64_operand_t t;
+    int bits;
+    int i;
+
+    /* The size of the operands */
+    bits = 64;
+    for ( i = 0; i < 2; i++ ) {
+        if ( p->operands[i].type == OPERAND_TYPE_REG ) {
+            bits = _bits(gen, p->operands[i].u.reg);
+            break;
+        }
+    }
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0
+         || _operand(gen, &p->operands[1], bits, &b) < 0 ) {
+        return -1;
+    }
+    if ( a.type == X86_64_OPERAND_IMM
+         || (a.type == X86_64_OPERAND_MEM && b.type == X86_64_OPERAND_MEM) ) {
+        t = _reg(_subreg(X86_64_SCRATCH, bits));
+        if ( _mov(gen, t, a) < 0 ) {
+            return -1;
+        }
+        a = t;
+    }
+    if ( b.type == X86_64_OPERAND_IMM
+         && (b.u.imm < INT32_MIN || b.u.imm > INT32_MAX) ) {
+        if ( _same(a, _reg(X86_64_SCRATCH)) ) {
+            return -1;
+        }
+        t = _reg(_subreg(X86_64_SCRATCH, bits));
+        if ( _mov(gen, t, b) < 0 ) {
+            return -1;
+        }
+        b = t;
+    }
+
+    return _emit2(gen, "cmp", a, b);
+}
+
+/*
+ * _setcc -- set the boolean of the condition to the register
+ */
+static int
+_setcc(struct x86_64_gen *gen, const char *setcc, int r)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t t;
+
+    if ( _loc(gen, r, 32, &d) < 0 ) {
+        return -1;
+    }
+    t = d.type == X86_64_OPERAND_REG ? d : _scratch(d);
+    if ( _emit1(gen, setcc, _reg(_subreg(t.u.reg, 8))) < 0
+         || _emit2(gen, "movzx", t, _reg(_subreg(t.u.reg, 8))) < 0 ) {
+        return -1;
+    }
+
+    return _mov(gen, d, t);
+}
+
+/*
+ * _not -- emit the logical negation
+ */
+static int
+_not(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    int bits;
+
+    bits = 32;
+    if ( p->operands[0].type == OPERAND_TYPE_REG ) {
+        bits = _bits(gen, p->operands[0].u.reg);
+    }
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0 ) {
+        return -1;
+    }
+    if ( a.type == X86_64_OPERAND_IMM ) {
+        if ( _loc(gen, p->result.reg[0], 32, &d) < 0 ) {
+            return -1;
+        }
+        return _mov(gen, d, _imm(a.u.imm == 0));
+    }
+    if ( a.type == X86_64_OPERAND_REG ) {
+        if ( _emit2(gen, "test", a, a) < 0 ) {
+            return -1;
+        }
+    } else {
+        if ( _emit2(gen, "cmp", a, _imm(0)) < 0 ) {
+            return -1;
+        }
+    }
+
+    return _setcc(gen, "sete", p->result.reg[0]);
+}
+
+/*
+ * _jump -- emit a jump to a block; a backward jump is encoded in the short
+ * form if possible, and a forward jump is resolved after the blocks are
+ * placed
+ */
+static int
+_jump(struct x86_64_gen *gen, const char *mne, int block)
+{
+    struct x86_64_fixup *fixups;
+    const struct rule *rule;
+    x86_64_operand_t op;
+    size_t nsize;
+    off_t pos;
+
+    pos = gen->code->text.size;
+    if ( gen->blocks[block] >= 0 ) {
+        /* The short form is two bytes long */
+        op = _imm(gen->blocks[block] - (pos + 2));
+        if ( x86_64_search(gen->arch->ruleset, mne, 1, &op, &rule) < 0 ) {
+            return -1;
+        }
+        op.u.imm = gen->blocks[block] - (pos + rule->len);
+        return _emit_rule(gen, rule, &op);
+    }
+
+    op = _imm(INT32_MAX);
+    if ( _emit1(gen, mne, op) < 0 ) {
+        return -1;
+    }
+    if ( gen->fixup.n >= gen->fixup.size ) {
+        nsize = gen->fixup.size ? gen->fixup.size * 2 : 64;
+        fixups = realloc(gen->fixup.fixups,
+                         sizeof(struct x86_64_fixup) * nsize);
+        if ( fixups == NULL ) {
+            return -1;
+        }
+        gen->fixup.fixups = fixups;
+        gen->fixup.size = nsize;
+    }
+    gen->fixup.fixups[gen->fixup.n].pos = gen->code->text.size - 4;
+    gen->fixup.fixups[gen->fixup.n].block = block;
+    gen->fixup.n++;
+
+    return 0;
+}
+
+/*
+ * _branch -- emit a conditional branch; the block placed next is reached by
+ * falling through
+ */
+static int
+_branch(struct x86_64_gen *gen, const char *jcc, const char *njcc, int bthen,
+        int belse, int next)
+{
+    if ( bthen == belse ) {
+        return bthen == next ? 0 : _jump(gen, "jmp", bthen);
+    }
+    if ( bthen == next ) {
+        return _jump(gen, njcc, belse);
+    }
+    if ( _jump(gen, jcc, bthen) < 0 ) {
+        return -1;
+    }
+    if ( belse == next ) {
+        return 0;
+    }
+
+    return _jump(gen, "jmp", belse);
+}
+
+/*
+ * _br -- emit the branch on a boolean
+ */
+static int
+_br(struct x86_64_gen *gen, ir_instr_t *p, int next)
+{
+    x86_64_operand_t a;
+    int bthen;
+    int belse;
+
+    bthen = p->operands[1].u.block;
+    belse = p->operands[2].u.block;
+    if ( _operand(gen, &p->operands[0], 32, &a) < 0 ) {
+        return -1;
+    }
+    if ( a.type == X86_64_OPERAND_IMM ) {
+        bthen = a.u.imm ? bthen : belse;
+        return bthen == next ? 0 : _jump(gen, "jmp", bthen);
+    }
+    if ( a.type == X86_64_OPERAND_REG ) {
+        if ( _emit2(gen, "test", a, a) < 0 ) {
+            return -1;
+        }
+    } else {
+        if ( _emit2(gen, "cmp", a, _imm(0)) < 0 ) {
+            return -1;
+        }
+    }
+
+    return _branch(gen, "jne", "je", bthen, belse, next);
+}
+
+/*
+ * _fusible -- check if the comparison is used only by the following branch,
+ * so that the branch is taken on the flags
+ */
+static int
+_fusible(struct x86_64_gen *gen, ir_instr_t *p, ir_instr_t *q)
+{
+    if ( _cond(gen, p) < 0 || q == NULL || q->opcode != IR_OPCODE_BR ) {
+        return 0;
+    }
+    if ( q->operands[0].type != OPERAND_TYPE_REG
+         || q->operands[0].u.reg != p->result.reg[0] ) {
+        return 0;
+    }
+
+    return gen->uses[p->result.reg[0]] == 1;
+}
+
+/*
+ * _epilogue -- restore the registers and return
+ */
+static int
+_epilogue(struct x86_64_gen *gen)
+{
+    int i;
+
+    for ( i = gen->nsaved; i > 0; i-- ) {
+        if ( _emit1(gen, "pop", _reg(gen->saved[i - 1])) < 0 ) {
+            return -1;
+        }
+    }
+    if ( gen->frame >= 0 && _emit0(gen, "leave") < 0 ) {
+        return -1;
+    }
+
+    return _emit0(gen, "ret");
+}
+
+/*
+ * _store -- store a value to the memory; an immediate value is stored in 32
+ * bits unless it is a 64-bit integer
+ */
+static int
+_store(struct x86_64_gen *gen, ir_instr_t *p)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    int bits;
+
+    if ( p->operands[0].type == OPERAND_TYPE_REG ) {
+        bits = _bits(gen, p->operands[0].u.reg);
+    } else if ( p->operands[0].type == OPERAND_TYPE_IMM
+                && (p->operands[0].u.imm.type == IR_IMM_I64
+                    || p->operands[0].u.imm.type == IR_IMM_S64) ) {
+        bits = 64;
+    } else {
+        bits = 32;
+    }
+    if ( _operand(gen, &p->operands[0], bits, &a) < 0
+         || _ref(gen, &p->operands[1], bits, &d) < 0 ) {
+        return -1;
+    }
+
+    return _mov(gen, d, a);
+}
+
+/*
+ * _dispatch -- jump to the point to resume the coroutine from by the state
+ * of the frame; the jump table following the jump holds the offsets from the
+ * table, the start for the state 0, and the points following the yields
+ */
+static int
+_dispatch(struct x86_64_gen *gen)
+{
+    x86_64_operand_t t;
+    x86_64_operand_t a;
+    x86_64_operand_t m;
+    arch_code_t *code;
+    int32_t disp;
+    off_t pos;
+    size_t len;
+
+    if ( gen->func->frame.states <= 0 ) {
+        /* Not lowered */
+        return -1;
+    }
+    code = gen->code;
+    t = _reg(X86_64_SCRATCH);
+    a = _reg(X86_64_CORO_TABLE);
+    m = _mem(X86_64_CORO_TABLE, 0, 32);
+    m.u.mem.sindex = X86_64_SCRATCH;
+    m.u.mem.scale = 4;
+    if ( _emit2(gen, "mov", t, _mem(X86_64_CORO_FRAME, 0, 64)) < 0
+         || _emit2(gen, "lea", a, _mem(REG_RIP, 0, 0)) < 0 ) {
+        return -1;
+    }
+    pos = code->text.size;
+    if ( _emit2(gen, "movsxd", t, m) < 0 || _emit2(gen, "add", t, a) < 0
+         || _emit1(gen, "jmp", t) < 0 ) {
+        return -1;
+    }
+    while ( code->text.size % 4 ) {
+        if ( _emit0(gen, "nop") < 0 ) {
+            return -1;
+        }
+    }
+
+    /* The table; the displacement of lea is from the end of itself */
+    gen->table = code->text.size;
+    gen->nyields = 0;
+    disp = gen->table - pos;
+    memcpy(code->text.s + pos - 4, &disp, 4);
+    len = 4 * gen->func->frame.states;
+    if ( _reserve(gen, len) < 0 ) {
+        return -1;
+    }
+    memset(code->text.s + code->text.size, 0, len);
+    code->text.size += len;
+    disp = code->text.size - gen->table;
+    memcpy(code->text.s + gen->table, &disp, 4);
+
+    return 0;
+}
+
+/*
+ * _yield -- return from the coroutine, and put the point following it to the
+ * jump table of the dispatch
+ */
+static int
+_yield(struct x86_64_gen *gen)
+{
+    int32_t disp;
+
+    /* The values are in the return registers, and the live ones are in the
+       frame (see ir_coro.c) */
+    if ( _epilogue(gen) < 0 ) {
+        return -1;
+    }
+    gen->nyields++;
+    if ( gen->nyields >= gen->func->frame.states ) {
+        return -1;
+    }
+    disp = gen->code->text.size - gen->table;
+    memcpy(gen->code->text.s + gen->table + 4 * gen->nyields, &disp, 4);
+
+    return 0;
+}
+
+/*
+ * _instr -- emit an instruction; next is the block placed next
+ */
+static int
+_instr(struct x86_64_gen *gen, ir_instr_t *p, int next)
+{
+    x86_64_operand_t d;
+    x86_64_operand_t a;
+    ir_reg_type_t type;
+    int bits;
+    int cond;
+
+    switch ( p->opcode ) {
+    case IR_OPCODE_LOAD:
+        bits = _bits(gen, p->result.reg[0]);
+        if ( _loc(gen, p->result.reg[0], bits, &d) < 0
+             || _ref(gen, &p->operands[0], bits, &a) < 0 ) {
+            return -1;
+        }
+        return _mov(gen, d, a);
+    case IR_OPCODE_STORE:
+        return _store(gen, p);
+    case IR_OPCODE_MOV:
+        return _convert(gen, p);
+    case IR_OPCODE_ADD:
+        return _arith(gen, p, "add", 1);
+    case IR_OPCODE_SUB:
+        return _arith(gen, p, "sub", 0);
+    case IR_OPCODE_MUL:
+        return _arith(gen, p, "imul", 1);
+    case IR_OPCODE_DIV:
+    case IR_OPCODE_MOD:
+        return _divide(gen, p);
+    case IR_OPCODE_MULH:
+        return _mulh(gen, p);
+    case IR_OPCODE_INC:
+        return _unary(gen, p, "inc");
+    case IR_OPCODE_DEC:
+        return _unary(gen, p, "dec");
+    case IR_OPCODE_NOT:
+        return _not(gen, p);
+    case IR_OPCODE_COMP:
+        return _unary(gen, p, "not");
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_AND:
+        /* Booleans are 0 or 1, so that the logical operations are
+           bit-wise */
+        return _arith(gen, p, "and", 1);
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_OR:
+        return _arith(gen, p, "or", 1);
+    case IR_OPCODE_XOR:
+        return _arith(gen, p, "xor", 1);
+    case IR_OPCODE_LSHIFT:
+        return _arith(gen, p, "shl", 0);
+    case IR_OPCODE_RSHIFT:
+        /* Logical for the unsigned types */
+        type = gen->func->reg.regs[p->result.reg[0]].type;
+        return _arith(gen, p, ir_reg_type_unsigned(type) ? "shr" : "sar", 0);
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        cond = _cond(gen, p);
+        if ( _compare(gen, p) < 0 ) {
+            return -1;
+        }
+        return _setcc(gen, _conds[cond].setcc, p->result.reg[0]);
+    case IR_OPCODE_RET:
+        /* The return values are in the registers (see _constrain() of
+           regalloc.c) */
+        return _epilogue(gen);
+    case IR_OPCODE_YIELD:
+        return _yield(gen);
+    case IR_OPCODE_JMP:
+        if ( p->operands[0].u.block == next ) {
+            return 0;
+        }
+        return _jump(gen, "jmp", p->operands[0].u.block);
+    case IR_OPCODE_BR:
+        return _br(gen, p, next);
+    default:
+        /* Allocas and phi functions are not supported */
+        return -1;
+    }
+}
+
+/*
+ * _prepare -- prepare the per-function state; count the uses of the
+ * registers, and find the callee-saved registers to save and the size of the
+ * stack frame
+ */
+static int
+_prepare(struct x86_64_gen *gen, ir_func_t *func)
+{
+    ir_instr_t *p;
+    off_t *blocks;
+    size_t i;
+    int *uses;
+    int *r;
+    int pos;
+    int j;
+    int k;
+
+    gen->func = func;
+    blocks = realloc(gen->blocks, sizeof(off_t) * (func->block.n + 1));
+    if ( blocks == NULL ) {
+        return -1;
+    }
+    gen->blocks = blocks;
+    uses = realloc(gen->uses, sizeof(int) * (func->reg.n + 1));
+    if ( uses == NULL ) {
+        return -1;
+    }
+    gen->uses = uses;
+    memset(uses, 0, sizeof(int) * func->reg.n);
+    gen->fixup.n = 0;
+
+    for ( i = 0; i < func->block.n; i++ ) {
+        gen->blocks[i] = -1;
+        for ( pos = func->block.blocks[i].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *r >= 0 ) {
+                        uses[*r]++;
+                    }
+                }
+            }
+        }
+    }
+
+    gen->nsaved = 0;
+    for ( j = 0; j < X86_64_NSAVED; j++ ) {
+        for ( i = 0; i < func->reg.n; i++ ) {
+            if ( func->reg.regs[i].hreg == _callee_saved[j] ) {
+                gen->saved[gen->nsaved++] = _callee_saved[j];
+                break;
+            }
+        }
+    }
+
+    /* The frame pointer is used for the spill slots, and the stack is kept
+       aligned */
+    gen->frame = -1;
+    if ( func->nslots > 0 ) {
+        gen->frame = func->nslots * X86_64_SLOT_SIZE;
+        if ( (gen->frame + gen->nsaved * 8) % X86_64_STACK_ALIGN ) {
+            gen->frame += 8;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _export -- export a 64-bit value of the coroutine as the data object
+ * <name><suffix> for the runtime
+ */
+static int
+_export(struct x86_64_gen *gen, const char *suffix, int64_t val)
+{
+    arch_code_t *code;
+    const char *label;
+    uint8_t *s;
+    size_t len;
+    char *buf;
+
+    code = gen->code;
+    len = strlen(gen->func->name);
+    buf = malloc(len + strlen(suffix) + 1);
+    if ( buf == NULL ) {
+        return -1;
+    }
+    memcpy(buf, gen->func->name, len);
+    strcpy(buf + len, suffix);
+    label = intern(buf);
+    free(buf);
+    if ( label == NULL ) {
+        return -1;
+    }
+
+    s = realloc(code->data.s, code->data.size + sizeof(int64_t));
+    if ( s == NULL ) {
+        return -1;
+    }
+    code->data.s = s;
+    memcpy(code->data.s + code->data.size, &val, sizeof(int64_t));
+    if ( _sym(gen, ARCH_SYM_GLOBAL, label, code->data.size,
+              sizeof(int64_t)) < 0 ) {
+        return -1;
+    }
+    code->data.size += sizeof(int64_t);
+
+    return 0;
+}
+
+/*
+ * _func -- assemble a function
+ */
+static int
+_func(struct x86_64_gen *gen, ir_func_t *func)
+{
+    ir_instr_t *p;
+    ir_instr_t *q;
+    off_t start;
+    size_t i;
+    int32_t disp;
+    int next;
+    int cond;
+    int pos;
+    int b;
+
+    if ( _prepare(gen, func) < 0 ) {
+        return -1;
+    }
+
+    /* Align the entry */
+    while ( gen->code->text.size % X86_64_STACK_ALIGN ) {
+        if ( _emit0(gen, "nop") < 0 ) {
+            return -1;
+        }
+    }
+    start = gen->code->text.size;
+
+    /* Prologue */
+    if ( gen->frame >= 0 ) {
+        if ( _emit1(gen, "push", _reg(REG_RBP)) < 0
+             || _emit2(gen, "mov", _reg(REG_RBP), _reg(REG_RSP)) < 0 ) {
+            return -1;
+        }
+        if ( gen->frame > 0
+             && _emit2(gen, "sub", _reg(REG_RSP), _imm(gen->frame)) < 0 ) {
+            return -1;
+        }
+    }
+    for ( i = 0; i < (size_t)gen->nsaved; i++ ) {
+        if ( _emit1(gen, "push", _reg(gen->saved[i])) < 0 ) {
+            return -1;
+        }
+    }
+    if ( func->type == IR_FUNC_COROUTINE && _dispatch(gen) < 0 ) {
+        return -1;
+    }
+
+    /* Blocks in the order of the function; the empty blocks are not
+       reachable */
+    for ( b = 0; b < (int)func->block.n; b++ ) {
+        if ( func->block.blocks[b].head < 0 ) {
+            continue;
+        }
+        for ( next = b + 1; next < (int)func->block.n; next++ ) {
+            if ( func->block.blocks[next].head >= 0 ) {
+                break;
+            }
+        }
+        gen->blocks[b] = gen->code->text.size;
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            q = p->next >= 0 ? &func->instr.instrs[p->next] : NULL;
+            if ( _fusible(gen, p, q) ) {
+                /* Compare and branch */
+                cond = _cond(gen, p);
+                if ( _compare(gen, p) < 0
+                     || _branch(gen, _conds[cond].jcc, _conds[cond].njcc,
+                                q->operands[1].u.block,
+                                q->operands[2].u.block, next) < 0 ) {
+                    return -1;
+                }
+                p = q;
+                continue;
+            }
+            if ( _instr(gen, p, next) < 0 ) {
+                return -1;
+            }
+        }
+    }
+
+    /* Resolve the jumps */
+    for ( i = 0; i < gen->fixup.n; i++ ) {
+        if ( gen->blocks[gen->fixup.fixups[i].block] < 0 ) {
+            return -1;
+        }
+        disp = gen->blocks[gen->fixup.fixups[i].block]
+            - (gen->fixup.fixups[i].pos + 4);
+        memcpy(gen->code->text.s + gen->fixup.fixups[i].pos, &disp, 4);
+    }
+
+    if ( _sym(gen, ARCH_SYM_FUNC, func->name, start,
+              gen->code->text.size - start) < 0 ) {
+        return -1;
+    }
+    if ( func->type == IR_FUNC_COROUTINE ) {
+        /* The size of the frame, and the number of the values of a packet */
+        if ( _export(gen, "_frame", func->frame.size) < 0
+             || _export(gen, "_packet", func->frame.packet) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * x86_64_assemble -- assemble from IR to x86-64 code; the registers of the
+ * functions must be allocated with regalloc_x86_64
+ */
+int
+x86_64_assemble(ir_object_t *obj, arch_code_t *code)
+{
+    struct x86_64_gen gen;
+    ir_func_t *func;
+    int ret;
+
+    memset(code, 0, sizeof(arch_code_t));
+    code->cpu = ARCH_CPU_X86_64;
+    memset(&gen, 0, sizeof(struct x86_64_gen));
+    gen.code = code;
+
+    /* Initialize the x86_64 assembler */
+    gen.arch = x86_64_initialize(NULL);
+    if ( NULL == gen.arch ) {
+        return -1;
+    }
+
+    ret = 0;
+    for ( func = obj->funcs; func != NULL; func = func->next ) {
+        if ( _func(&gen, func) < 0 ) {
+            ret = -1;
+            break;
+        }
+    }
+    free(gen.blocks);
+    free(gen.uses);
+    free(gen.fixup.fixups);
+    free(gen.arch);
+    if ( ret < 0 ) {
+        arch_code_release(code);
+    }
+
+    return ret;
 }
 
 /*
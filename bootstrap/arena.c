@@ -0,0 +1,175 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "arena.h"
+#include <string.h>
+
+#define ARENA_ROUNDUP(x)    (((x) + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1))
+#define ARENA_HDR_SIZE      ARENA_ROUNDUP(sizeof(arena_chunk_t))
+
+/*
+ * arena_new -- allocate a new arena
+ */
+arena_t *
+arena_new(void)
+{
+    arena_t *arena;
+
+    arena = malloc(sizeof(arena_t));
+    if ( NULL == arena ) {
+        return NULL;
+    }
+    arena->head = NULL;
+    arena->next_size = ARENA_MIN_CHUNK_SIZE;
+    arena->allocated = 0;
+
+    return arena;
+}
+
+/*
+ * _chunk_new -- allocate a new chunk that can hold at least size bytes
+ */
+static arena_chunk_t *
+_chunk_new(arena_t *arena, size_t size)
+{
+    arena_chunk_t *chunk;
+    size_t csize;
+
+    /* Grow the chunk size geometrically to keep the number of chunks (and
+       thus the cost of the release) logarithmic in the tree size */
+    csize = arena->next_size;
+    while ( csize < size ) {
+        csize <<= 1;
+    }
+    if ( arena->next_size < ARENA_MAX_CHUNK_SIZE ) {
+        arena->next_size <<= 1;
+    }
+
+    chunk = malloc(ARENA_HDR_SIZE + csize);
+    if ( NULL == chunk ) {
+        return NULL;
+    }
+    chunk->size = csize;
+    chunk->used = 0;
+    chunk->next = arena->head;
+    arena->head = chunk;
+    arena->allocated += ARENA_HDR_SIZE + csize;
+
+    return chunk;
+}
+
+/*
+ * arena_alloc -- allocate size bytes from the arena
+ */
+void *
+arena_alloc(arena_t *arena, size_t size)
+{
+    arena_chunk_t *chunk;
+    void *ptr;
+
+    size = ARENA_ROUNDUP(size);
+    chunk = arena->head;
+    if ( NULL == chunk || chunk->used + size > chunk->size ) {
+        chunk = _chunk_new(arena, size);
+        if ( NULL == chunk ) {
+            return NULL;
+        }
+    }
+    ptr = (uint8_t *)chunk + ARENA_HDR_SIZE + chunk->used;
+    chunk->used += size;
+
+    return ptr;
+}
+
+/*
+ * arena_calloc -- allocate zero-cleared size bytes from the arena
+ */
+void *
+arena_calloc(arena_t *arena, size_t size)
+{
+    void *ptr;
+
+    ptr = arena_alloc(arena, size);
+    if ( NULL == ptr ) {
+        return NULL;
+    }
+    memset(ptr, 0, size);
+
+    return ptr;
+}
+
+/*
+ * arena_strndup -- copy at most n characters of a string into the arena
+ */
+char *
+arena_strndup(arena_t *arena, const char *s, size_t n)
+{
+    char *ptr;
+    size_t len;
+
+    for ( len = 0; len < n && s[len] != '\0'; len++ );
+    ptr = arena_alloc(arena, len + 1);
+    if ( NULL == ptr ) {
+        return NULL;
+    }
+    memcpy(ptr, s, len);
+    ptr[len] = '\0';
+
+    return ptr;
+}
+
+/*
+ * arena_strdup -- copy a string into the arena
+ */
+char *
+arena_strdup(arena_t *arena, const char *s)
+{
+    return arena_strndup(arena, s, strlen(s));
+}
+
+/*
+ * arena_release -- release all the objects allocated from the arena
+ */
+void
+arena_release(arena_t *arena)
+{
+    arena_chunk_t *chunk;
+    arena_chunk_t *next;
+
+    chunk = arena->head;
+    while ( NULL != chunk ) {
+        next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,85 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _ARENA_H
+#define _ARENA_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ARENA_ALIGN             16
+#define ARENA_MIN_CHUNK_SIZE    4096
+#define ARENA_MAX_CHUNK_SIZE    (1 << 20)
+
+/*
+ * Chunk of an arena; the payload follows the header
+ */
+typedef struct _arena_chunk arena_chunk_t;
+struct _arena_chunk {
+    arena_chunk_t *next;
+    size_t size;
+    size_t used;
+};
+
+/*
+ * Bump-pointer arena allocator.  Objects are never freed individually; the
+ * whole arena is released at once by arena_release().
+ */
+typedef struct {
+    arena_chunk_t *head;
+    size_t next_size;
+    size_t allocated;
+} arena_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* arena.c */
+arena_t *
+arena_new(void);
+void *
+arena_alloc(arena_t *, size_t);
+void *
+arena_calloc(arena_t *, size_t);
+char *
+arena_strdup(arena_t *, const char *);
+char *
+arena_strndup(arena_t *, const char *, size_t);
+void
+arena_release(arena_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ARENA_H */
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,1255 @@
+// Expression nested to the depth of 10000
+
+fn main(a: i32, b: i32) (r: i32)
+{
+    r := a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+         | a & b << 20 + b * a - b ^ a | b
+         & a << 27 + a * b - a ^ b | a & b
+         << 3 + b * a - b ^ a | b & a << 10
+         + a * b - a ^ b | a & b << 17 + b
+         * a - b ^ a | b & a << 24 + a * b
+         - a ^ b | a & b << 0 + b * a - b
+         ^ a | b & a << 7 + a * b - a ^ b
+         | a & b << 14 + b * a - b ^ a | b
+         & a << 21 + a * b - a ^ b | a & b
+         << 28 + b * a - b ^ a | b & a << 4
+         + a * b - a ^ b | a & b << 11 + b
+         * a - b ^ a | b & a << 18 + a * b
+         - a ^ b | a & b << 25 + b * a - b
+         ^ a | b & a << 1 + a * b - a ^ b
+         | a & b << 8 + b * a - b ^ a | b
+         & a << 15 + a * b - a ^ b | a & b
+         << 22 + b * a - b ^ a | b & a << 29
+         + a * b - a ^ b | a & b << 5 + b
+         * a - b ^ a | b & a << 12 + a * b
+         - a ^ b | a & b << 19 + b * a - b
+         ^ a | b & a << 26 + a * b - a ^ b
+         | a & b << 2 + b * a - b ^ a | b
+         & a << 9 + a * b - a ^ b | a & b
+         << 16 + b * a - b ^ a | b & a << 23
+         + a * b - a ^ b | a & b << 30 + b
+         * a - b ^ a | b & a << 6 + a * b
+         - a ^ b | a & b << 13 + b * a - b
+         ^ a | b & a << 20 + a * b - a ^ b
+         | a & b << 27 + b * a - b ^ a | b
+         & a << 3 + a * b - a ^ b | a & b
+         << 10 + b * a - b ^ a | b & a << 17
+         + a * b - a ^ b | a & b << 24 + b
+         * a - b ^ a | b & a << 0 + a * b
+         - a ^ b | a & b << 7 + b * a - b
+         ^ a | b & a << 14 + a * b - a ^ b
+         | a & b << 21 + b * a - b ^ a | b
+         & a << 28 + a * b - a ^ b | a & b
+         << 4 + b * a - b ^ a | b & a << 11
+         + a * b - a ^ b | a & b << 18 + b
+         * a - b ^ a | b & a << 25 + a * b
+         - a ^ b | a & b << 1 + b * a - b
+         ^ a | b & a << 8 + a * b - a ^ b
+         | a & b << 15 + b * a - b ^ a | b
+         & a << 22 + a * b - a ^ b | a & b
+         << 29 + b * a - b ^ a | b & a << 5
+         + a * b - a ^ b | a & b << 12 + b
+         * a - b ^ a | b & a << 19 + a * b
+         - a ^ b | a & b << 26 + b * a - b
+         ^ a | b & a << 2 + a * b - a ^ b
+         | a & b << 9 + b * a - b ^ a | b
+         & a << 16 + a * b - a ^ b | a & b
+         << 23 + b * a - b ^ a | b & a << 30
+         + a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+         | a & b << 20 + b * a - b ^ a | b
+         & a << 27 + a * b - a ^ b | a & b
+         << 3 + b * a - b ^ a | b & a << 10
+         + a * b - a ^ b | a & b << 17 + b
+         * a - b ^ a | b & a << 24 + a * b
+         - a ^ b | a & b << 0 + b * a - b
+         ^ a | b & a << 7 + a * b - a ^ b
+         | a & b << 14 + b * a - b ^ a | b
+         & a << 21 + a * b - a ^ b | a & b
+         << 28 + b * a - b ^ a | b & a << 4
+         + a * b - a ^ b | a & b << 11 + b
+         * a - b ^ a | b & a << 18 + a * b
+         - a ^ b | a & b << 25 + b * a - b
+         ^ a | b & a << 1 + a * b - a ^ b
+         | a & b << 8 + b * a - b ^ a | b
+         & a << 15 + a * b - a ^ b | a & b
+         << 22 + b * a - b ^ a | b & a << 29
+         + a * b - a ^ b | a & b << 5 + b
+         * a - b ^ a | b & a << 12 + a * b
+         - a ^ b | a & b << 19 + b * a - b
+         ^ a | b & a << 26 + a * b - a ^ b
+         | a & b << 2 + b * a - b ^ a | b
+         & a << 9 + a * b - a ^ b | a & b
+         << 16 + b * a - b ^ a | b & a << 23
+         + a * b - a ^ b | a & b << 30 + b
+         * a - b ^ a | b & a << 6 + a * b
+         - a ^ b | a & b << 13 + b * a - b
+         ^ a | b & a << 20 + a * b - a ^ b
+         | a & b << 27 + b * a - b ^ a | b
+         & a << 3 + a * b - a ^ b | a & b
+         << 10 + b * a - b ^ a | b & a << 17
+         + a * b - a ^ b | a & b << 24 + b
+         * a - b ^ a | b & a << 0 + a * b
+         - a ^ b | a & b << 7 + b * a - b
+         ^ a | b & a << 14 + a * b - a ^ b
+         | a & b << 21 + b * a - b ^ a | b
+         & a << 28 + a * b - a ^ b | a & b
+         << 4 + b * a - b ^ a | b & a << 11
+         + a * b - a ^ b | a & b << 18 + b
+         * a - b ^ a | b & a << 25 + a * b
+         - a ^ b | a & b << 1 + b * a - b
+         ^ a | b & a << 8 + a * b - a ^ b
+         | a & b << 15 + b * a - b ^ a | b
+         & a << 22 + a * b - a ^ b | a & b
+         << 29 + b * a - b ^ a | b & a << 5
+         + a * b - a ^ b | a & b << 12 + b
+         * a - b ^ a | b & a << 19 + a * b
+         - a ^ b | a & b << 26 + b * a - b
+         ^ a | b & a << 2 + a * b - a ^ b
+         | a & b << 9 + b * a - b ^ a | b
+         & a << 16 + a * b - a ^ b | a & b
+         << 23 + b * a - b ^ a | b & a << 30
+         + a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+         | a & b << 20 + b * a - b ^ a | b
+         & a << 27 + a * b - a ^ b | a & b
+         << 3 + b * a - b ^ a | b & a << 10
+         + a * b - a ^ b | a & b << 17 + b
+         * a - b ^ a | b & a << 24 + a * b
+         - a ^ b | a & b << 0 + b * a - b
+         ^ a | b & a << 7 + a * b - a ^ b
+         | a & b << 14 + b * a - b ^ a | b
+         & a << 21 + a * b - a ^ b | a & b
+         << 28 + b * a - b ^ a | b & a << 4
+         + a * b - a ^ b | a & b << 11 + b
+         * a - b ^ a | b & a << 18 + a * b
+         - a ^ b | a & b << 25 + b * a - b
+         ^ a | b & a << 1 + a * b - a ^ b
+         | a & b << 8 + b * a - b ^ a | b
+         & a << 15 + a * b - a ^ b | a & b
+         << 22 + b * a - b ^ a | b & a << 29
+         + a * b - a ^ b | a & b << 5 + b
+         * a - b ^ a | b & a << 12 + a * b
+         - a ^ b | a & b << 19 + b * a - b
+         ^ a | b & a << 26 + a * b - a ^ b
+         | a & b << 2 + b * a - b ^ a | b
+         & a << 9 + a * b - a ^ b | a & b
+         << 16 + b * a - b ^ a | b & a << 23
+         + a * b - a ^ b | a & b << 30 + b
+         * a - b ^ a | b & a << 6 + a * b
+         - a ^ b | a & b << 13 + b * a - b
+         ^ a | b & a << 20 + a * b - a ^ b
+         | a & b << 27 + b * a - b ^ a | b
+         & a << 3 + a * b - a ^ b | a & b
+         << 10 + b * a - b ^ a | b & a << 17
+         + a * b - a ^ b | a & b << 24 + b
+         * a - b ^ a | b & a << 0 + a * b
+         - a ^ b | a & b << 7 + b * a - b
+         ^ a | b & a << 14 + a * b - a ^ b
+         | a & b << 21 + b * a - b ^ a | b
+         & a << 28 + a * b - a ^ b | a & b
+         << 4 + b * a - b ^ a | b & a << 11
+         + a * b - a ^ b | a & b << 18 + b
+         * a - b ^ a | b & a << 25 + a * b
+         - a ^ b | a & b << 1 + b * a - b
+         ^ a | b & a << 8 + a * b - a ^ b
+         | a & b << 15 + b * a - b ^ a | b
+         & a << 22 + a * b - a ^ b | a & b
+         << 29 + b * a - b ^ a | b & a << 5
+         + a * b - a ^ b | a & b << 12 + b
+         * a - b ^ a | b & a << 19 + a * b
+         - a ^ b | a & b << 26 + b * a - b
+         ^ a | b & a << 2 + a * b - a ^ b
+         | a & b << 9 + b * a - b ^ a | b
+         & a << 16 + a * b - a ^ b | a & b
+         << 23 + b * a - b ^ a | b & a << 30
+         + a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+         | a & b << 20 + b * a - b ^ a | b
+         & a << 27 + a * b - a ^ b | a & b
+         << 3 + b * a - b ^ a | b & a << 10
+         + a * b - a ^ b | a & b << 17 + b
+         * a - b ^ a | b & a << 24 + a * b
+         - a ^ b | a & b << 0 + b * a - b
+         ^ a | b & a << 7 + a * b - a ^ b
+         | a & b << 14 + b * a - b ^ a | b
+         & a << 21 + a * b - a ^ b | a & b
+         << 28 + b * a - b ^ a | b & a << 4
+         + a * b - a ^ b | a & b << 11 + b
+         * a - b ^ a | b & a << 18 + a * b
+         - a ^ b | a & b << 25 + b * a - b
+         ^ a | b & a << 1 + a * b - a ^ b
+         | a & b << 8 + b * a - b ^ a | b
+         & a << 15 + a * b - a ^ b | a & b
+         << 22 + b * a - b ^ a | b & a << 29
+         + a * b - a ^ b | a & b << 5 + b
+         * a - b ^ a | b & a << 12 + a * b
+         - a ^ b | a & b << 19 + b * a - b
+         ^ a | b & a << 26 + a * b - a ^ b
+         | a & b << 2 + b * a - b ^ a | b
+         & a << 9 + a * b - a ^ b | a & b
+         << 16 + b * a - b ^ a | b & a << 23
+         + a * b - a ^ b | a & b << 30 + b
+         * a - b ^ a | b & a << 6 + a * b
+         - a ^ b | a & b << 13 + b * a - b
+         ^ a | b & a << 20 + a * b - a ^ b
+         | a & b << 27 + b * a - b ^ a | b
+         & a << 3 + a * b - a ^ b | a & b
+         << 10 + b * a - b ^ a | b & a << 17
+         + a * b - a ^ b | a & b << 24 + b
+         * a - b ^ a | b & a << 0 + a * b
+         - a ^ b | a & b << 7 + b * a - b
+         ^ a | b & a << 14 + a * b - a ^ b
+         | a & b << 21 + b * a - b ^ a | b
+         & a << 28 + a * b - a ^ b | a & b
+         << 4 + b * a - b ^ a | b & a << 11
+         + a * b - a ^ b | a & b << 18 + b
+         * a - b ^ a | b & a << 25 + a * b
+         - a ^ b | a & b << 1 + b * a - b
+         ^ a | b & a << 8 + a * b - a ^ b
+         | a & b << 15 + b * a - b ^ a | b
+         & a << 22 + a * b - a ^ b | a & b
+         << 29 + b * a - b ^ a | b & a << 5
+         + a * b - a ^ b | a & b << 12 + b
+         * a - b ^ a | b & a << 19 + a * b
+         - a ^ b | a & b << 26 + b * a - b
+         ^ a | b & a << 2 + a * b - a ^ b
+         | a & b << 9 + b * a - b ^ a | b
+         & a << 16 + a * b - a ^ b | a & b
+         << 23 + b * a - b ^ a | b & a << 30
+         + a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+         | a & b << 20 + b * a - b ^ a | b
+         & a << 27 + a * b - a ^ b | a & b
+         << 3 + b * a - b ^ a | b & a << 10
+         + a * b - a ^ b | a & b << 17 + b
+         * a - b ^ a | b & a << 24 + a * b
+         - a ^ b | a & b << 0 + b * a - b
+         ^ a | b & a << 7 + a * b - a ^ b
+         | a & b << 14 + b * a - b ^ a | b
+         & a << 21 + a * b - a ^ b | a & b
+         << 28 + b * a - b ^ a | b & a << 4
+         + a * b - a ^ b | a & b << 11 + b
+         * a - b ^ a | b & a << 18 + a * b
+         - a ^ b | a & b << 25 + b * a - b
+         ^ a | b & a << 1 + a * b - a ^ b
+         | a & b << 8 + b * a - b ^ a | b
+         & a << 15 + a * b - a ^ b | a & b
+         << 22 + b * a - b ^ a | b & a << 29
+         + a * b - a ^ b | a & b << 5 + b
+         * a - b ^ a | b & a << 12 + a * b
+         - a ^ b | a & b << 19 + b * a - b
+         ^ a | b & a << 26 + a * b - a ^ b
+         | a & b << 2 + b * a - b ^ a | b
+         & a << 9 + a * b - a ^ b | a & b
+         << 16 + b * a - b ^ a | b & a << 23
+         + a * b - a ^ b | a & b << 30 + b
+         * a - b ^ a | b & a << 6 + a * b
+         - a ^ b | a & b << 13 + b * a - b
+         ^ a | b & a << 20 + a * b - a ^ b
+         | a & b << 27 + b * a - b ^ a | b
+         & a << 3 + a * b - a ^ b | a & b
+         << 10 + b * a - b ^ a | b & a << 17
+         + a * b - a ^ b | a & b << 24 + b
+         * a - b ^ a | b & a << 0 + a * b
+         - a ^ b | a & b << 7 + b * a - b
+         ^ a | b & a << 14 + a * b - a ^ b
+         | a & b << 21 + b * a - b ^ a | b
+         & a << 28 + a * b - a ^ b | a & b
+         << 4 + b * a - b ^ a | b & a << 11
+         + a * b - a ^ b | a & b << 18 + b
+         * a - b ^ a | b & a << 25 + a * b
+         - a ^ b | a & b << 1 + b * a - b
+         ^ a | b & a << 8 + a * b - a ^ b
+         | a & b << 15 + b * a - b ^ a | b
+         & a << 22 + a * b - a ^ b | a & b
+         << 29 + b * a - b ^ a | b & a << 5
+         + a * b - a ^ b | a & b << 12 + b
+         * a - b ^ a | b & a << 19 + a * b
+         - a ^ b | a & b << 26 + b * a - b
+         ^ a | b & a << 2 + a * b - a ^ b
+         | a & b << 9 + b * a - b ^ a | b
+         & a << 16 + a * b - a ^ b | a & b
+         << 23 + b * a - b ^ a | b & a << 30
+         + a * b - a ^ b | a & b << 6 + b
+         * a - b ^ a | b & a << 13 + a * b
+         - a ^ b | a & b << 20 + b * a - b
+         ^ a | b & a << 27 + a * b - a ^ b
+         | a & b << 3 + b * a - b ^ a | b
+         & a << 10 + a * b - a ^ b | a & b
+         << 17 + b * a - b ^ a | b & a << 24
+         + a * b - a ^ b | a & b << 0 + b
+         * a - b ^ a | b & a << 7 + a * b
+         - a ^ b | a & b << 14 + b * a - b
+         ^ a | b & a << 21 + a * b - a ^ b
+         | a & b << 28 + b * a - b ^ a | b
+         & a << 4 + a * b - a ^ b | a & b
+         << 11 + b * a - b ^ a | b & a << 18
+         + a * b - a ^ b | a & b << 25 + b
+         * a - b ^ a | b & a << 1 + a * b
+         - a ^ b | a & b << 8 + b * a - b
+         ^ a | b & a << 15 + a * b - a ^ b
+         | a & b << 22 + b * a - b ^ a | b
+         & a << 29 + a * b - a ^ b | a & b
+         << 5 + b * a - b ^ a | b & a << 12
+         + a * b - a ^ b | a & b << 19 + b
+         * a - b ^ a | b & a << 26 + a * b
+         - a ^ b | a & b << 2 + b * a - b
+         ^ a | b & a << 9 + a * b - a ^ b
+         | a & b << 16 + b * a - b ^ a | b
+         & a << 23 + a * b - a ^ b | a & b
+         << 30 + b * a - b ^ a | b & a << 6
+         + a * b - a ^ b | a & b << 13 + b
+         * a - b ^ a | b & a << 20 + a * b
+         - a ^ b | a & b << 27 + b * a - b
+         ^ a | b & a << 3 + a * b - a ^ b
+         | a & b << 10 + b * a - b ^ a | b
+         & a << 17 + a * b - a ^ b | a & b
+         << 24 + b * a - b ^ a | b & a << 0
+         + a * b - a ^ b | a & b << 7 + b
+         * a - b ^ a | b & a << 14 + a * b
+         - a ^ b | a & b << 21 + b * a - b
+         ^ a | b & a << 28 + a * b - a ^ b
+         | a & b << 4 + b * a - b ^ a | b
+         & a << 11 + a * b - a ^ b | a & b
+         << 18 + b * a - b ^ a | b & a << 25
+         + a * b - a ^ b | a & b << 1 + b
+         * a - b ^ a | b & a << 8 + a * b
+         - a ^ b | a & b << 15 + b * a - b
+         ^ a | b & a << 22 + a * b - a ^ b
+         | a & b << 29 + b * a - b ^ a | b
+         & a << 5 + a * b - a ^ b | a & b
+         << 12 + b * a - b ^ a | b & a << 19
+         + a * b - a ^ b | a & b << 26 + b
+         * a - b ^ a | b & a << 2 + a * b
+         - a ^ b | a & b << 9 + b * a - b
+         ^ a | b & a << 16 + a * b - a ^ b
+         | a & b << 23 + b * a - b ^ a | b
+         & a << 30 + a * b - a ^ b | a & b
+         << 6 + b * a - b ^ a | b & a << 13
+         + a * b - a ^ b | a & b << 20 + b
+         * a - b ^ a | b & a << 27 + a * b
+         - a ^ b | a & b << 3 + b * a - b
+         ^ a | b & a << 10 + a * b - a ^ b
+         | a & b << 17 + b * a - b ^ a | b
+         & a << 24 + a * b - a ^ b | a & b
+         << 0 + b * a - b ^ a | b & a << 7
+         + a * b - a ^ b | a & b << 14 + b
+         * a - b ^ a | b & a << 21 + a * b
+         - a ^ b | a & b << 28 + b * a - b
+         ^ a | b & a << 4 + a * b - a ^ b
+         | a & b << 11 + b * a - b ^ a | b
+         & a << 18 + a * b - a ^ b | a & b
+         << 25 + b * a - b ^ a | b & a << 1
+         + a * b - a ^ b | a & b << 8 + b
+         * a - b ^ a | b & a << 15 + a * b
+         - a ^ b | a & b << 22 + b * a - b
+         ^ a | b & a << 29 + a * b - a ^ b
+         | a & b << 5 + b * a - b ^ a | b
+         & a << 12 + a * b - a ^ b | a & b
+         << 19 + b * a - b ^ a | b & a << 26
+         + a * b - a ^ b | a & b << 2 + b
+         * a - b ^ a | b & a << 9 + a * b
+         - a ^ b | a & b << 16 + b * a - b
+         ^ a | b & a << 23 + a * b - a ^ b
+         | a & b << 30 + b * a - b ^ a | b
+         & a << 6 + a * b - a ^ b | a & b
+         << 13 + b * a - b ^ a | b & a << 20
+         + a * b - a ^ b | a & b << 27 + b
+         * a - b ^ a | b & a << 3 + a * b
+         - a ^ b | a & b << 10 + b * a - b
+         ^ a | b & a << 17 + a * b - a ^ b
+         | a & b << 24 + b * a - b ^ a | b
+         & a << 0 + a * b - a ^ b | a & b
+         << 7 + b * a - b ^ a | b & a << 14
+         + a * b - a ^ b | a & b << 21 + b
+         * a - b ^ a | b & a << 28 + a * b
+         - a ^ b | a & b << 4 + b * a - b
+         ^ a | b & a << 11 + a * b - a ^ b
+         | a & b << 18 + b * a - b ^ a | b
+         & a << 25 + a * b - a ^ b | a & b
+         << 1 + b * a - b ^ a | b & a << 8
+         + a * b - a ^ b | a & b << 15 + b
+         * a - b ^ a | b & a << 22 + a * b
+         - a ^ b | a & b << 29 + b * a - b
+         ^ a | b & a << 5 + a * b - a ^ b
+         | a & b << 12 + b * a - b ^ a | b
+         & a << 19 + a * b - a ^ b | a & b
+         << 26 + b * a - b ^ a | b & a << 2
+         + a * b - a ^ b | a & b << 9 + b
+         * a - b ^ a | b & a << 16 + a * b
+         - a ^ b | a & b << 23 + b * a - b
+         ^ a | b & a << 30 + a * b - a ^ b
+         | a & b << 6 + b * a - b ^ a | b
+         & a << 13 + a * b - a ^ b | a & b
+         << 20 + b * a - b ^ a | b & a << 27
+         + a * b - a ^ b | a & b << 3 + b
+         * a - b ^ a | b & a << 10 + a * b
+         - a ^ b | a & b << 17 + b * a - b
+         ^ a | b & a << 24 + a * b - a ^ b
+         | a & b << 0 + b * a - b ^ a | b
+         & a << 7 + a * b - a ^ b | a & b
+         << 14 + b * a - b ^ a | b & a << 21
+         + a * b - a ^ b | a & b << 28 + b
+         * a - b ^ a | b & a << 4 + a * b
+         - a ^ b | a & b << 11 + b * a - b
+         ^ a | b & a << 18 + a * b - a ^ b
+         | a & b << 25 + b * a - b ^ a | b
+         & a << 1 + a * b - a ^ b | a & b
+         << 8 + b * a - b ^ a | b & a << 15
+         + a * b - a ^ b | a & b << 22 + b
+         * a - b ^ a | b & a << 29 + a * b
+         - a ^ b | a & b << 5 + b * a - b
+         ^ a | b & a << 12 + a * b - a ^ b
+         | a & b << 19 + b * a - b ^ a | b
+         & a << 26 + a * b - a ^ b | a & b
+         << 2 + b * a - b ^ a | b & a << 9
+         + a * b - a ^ b | a & b << 16 + b
+         * a - b ^ a | b & a << 23 + a * b
+         - a ^ b | a & b << 30 + b * a - b
+         ^ a | b & a << 6 + a * b - a ^ b
+         | a & b << 13 + b * a - b ^ a | b
+         & a << 20 + a * b - a ^ b | a & b
+         << 27 + b * a - b ^ a | b & a << 3
+         + a * b - a ^ b | a & b << 10 + b
+         * a - b ^ a | b & a << 17 + a * b
+         - a ^ b | a & b << 24 + b * a - b
+         ^ a | b & a << 0 + a * b - a ^ b
+         | a & b << 7 + b * a - b ^ a | b
+         & a << 14 + a * b - a ^ b | a & b
+         << 21 + b * a - b ^ a | b & a << 28
+         + a * b - a ^ b | a & b << 4 + b
+         * a - b ^ a | b & a << 11 + a * b
+         - a ^ b | a & b << 18 + b * a - b
+         ^ a | b & a << 25 + a * b - a ^ b
+         | a & b << 1 + b * a - b ^ a | b
+         & a << 8 + a * b - a ^ b | a & b
+         << 15 + b * a - b ^ a | b & a << 22
+         + a * b - a ^ b | a & b << 29 + b
+         * a - b ^ a | b & a << 5 + a * b
+         - a ^ b | a & b << 12 + b * a - b
+         ^ a | b & a << 19 + a * b - a ^ b
+         | a & b << 26 + b * a - b ^ a | b
+         & a << 2 + a * b - a ^ b | a & b
+         << 9 + b * a - b ^ a | b & a << 16
+         + a * b - a ^ b | a & b << 23 + b
+         * a - b ^ a | b & a << 30 + a * b
+         - a ^ b | a & b << 6 + b * a - b
+         ^ a | b & a << 13 + a * b - a ^ b
+}
@@ -0,0 +1,30001 @@
+// 2000 functions
+
+fn f0(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 0 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f2(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 2 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f3(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 3 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f4(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 4 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f5(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 5 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f6(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 6 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f7(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 7 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f8(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 8 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f9(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 9 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f10(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 10 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f11(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 11 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f12(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 12 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f13(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 13 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f14(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 14 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f15(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 15 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f16(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 16 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f17(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 17 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f18(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 18 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f19(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 19 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f20(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 20 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f21(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 21 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f22(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 22 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f23(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 23 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f24(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 24 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f25(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 25 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f26(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 26 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f27(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 27 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f28(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 28 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f29(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 29 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f30(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 30 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f31(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 31 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f32(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 32 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f33(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 33 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f34(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 34 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f35(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 35 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f36(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 36 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f37(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 37 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f38(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 38 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f39(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 39 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f40(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 40 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f41(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 41 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f42(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 42 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f43(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 43 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f44(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 44 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f45(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 45 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f46(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 46 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f47(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 47 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f48(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 48 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f49(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 49 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f50(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 50 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f51(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 51 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f52(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 52 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f53(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 53 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f54(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 54 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f55(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 55 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f56(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 56 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f57(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 57 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f58(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 58 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f59(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 59 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f60(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 60 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f61(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 61 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f62(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 62 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f63(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 63 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f64(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 64 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f65(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 65 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f66(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 66 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f67(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 67 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f68(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 68 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f69(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 69 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f70(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 70 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f71(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 71 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f72(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 72 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f73(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 73 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f74(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 74 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f75(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 75 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f76(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 76 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f77(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 77 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f78(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 78 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f79(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 79 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f80(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 80 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f81(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 81 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f82(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 82 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f83(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 83 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f84(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 84 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f85(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 85 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f86(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 86 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f87(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 87 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f88(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 88 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f89(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 89 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f90(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 90 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f91(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 91 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f92(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 92 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f93(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 93 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f94(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 94 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f95(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 95 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f96(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 96 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f97(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 97 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f98(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 98 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f99(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 99 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f100(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 100 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f101(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 101 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f102(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 102 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f103(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 103 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f104(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 104 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f105(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 105 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f106(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 106 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f107(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 107 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f108(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 108 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f109(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 109 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f110(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 110 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f111(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 111 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f112(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 112 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f113(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 113 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f114(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 114 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f115(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 115 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f116(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 116 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f117(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 117 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f118(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 118 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f119(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 119 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f120(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 120 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f121(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 121 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f122(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 122 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f123(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 123 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f124(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 124 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f125(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 125 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f126(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 126 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f127(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 127 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f128(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 128 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f129(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 129 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f130(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 130 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f131(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 131 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f132(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 132 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f133(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 133 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f134(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 134 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f135(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 135 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f136(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 136 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f137(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 137 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f138(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 138 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f139(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 139 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f140(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 140 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f141(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 141 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f142(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 142 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f143(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 143 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f144(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 144 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f145(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 145 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f146(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 146 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f147(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 147 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f148(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 148 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f149(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 149 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f150(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 150 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f151(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 151 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f152(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 152 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f153(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 153 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f154(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 154 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f155(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 155 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f156(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 156 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f157(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 157 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f158(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 158 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f159(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 159 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f160(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 160 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f161(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 161 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f162(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 162 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f163(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 163 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f164(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 164 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f165(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 165 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f166(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 166 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f167(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 167 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f168(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 168 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f169(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 169 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f170(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 170 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f171(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 171 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f172(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 172 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f173(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 173 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f174(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 174 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f175(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 175 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f176(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 176 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f177(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 177 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f178(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 178 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f179(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 179 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f180(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 180 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f181(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 181 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f182(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 182 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f183(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 183 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f184(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 184 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f185(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 185 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f186(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 186 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f187(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 187 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f188(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 188 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f189(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 189 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f190(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 190 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f191(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 191 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f192(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 192 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f193(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 193 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f194(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 194 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f195(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 195 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f196(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 196 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f197(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 197 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f198(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 198 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f199(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 199 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f200(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 200 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f201(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 201 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f202(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 202 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f203(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 203 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f204(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 204 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f205(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 205 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f206(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 206 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f207(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 207 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f208(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 208 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f209(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 209 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f210(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 210 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f211(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 211 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f212(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 212 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f213(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 213 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f214(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 214 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f215(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 215 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f216(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 216 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f217(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 217 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f218(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 218 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f219(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 219 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f220(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 220 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f221(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 221 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f222(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 222 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f223(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 223 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f224(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 224 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f225(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 225 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f226(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 226 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f227(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 227 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f228(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 228 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f229(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 229 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f230(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 230 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f231(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 231 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f232(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 232 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f233(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 233 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f234(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 234 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f235(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 235 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f236(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 236 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f237(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 237 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f238(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 238 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f239(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 239 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f240(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 240 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f241(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 241 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f242(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 242 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f243(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 243 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f244(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 244 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f245(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 245 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f246(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 246 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f247(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 247 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f248(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 248 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f249(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 249 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f250(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 250 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f251(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 251 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f252(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 252 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f253(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 253 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f254(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 254 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f255(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 255 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f256(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 256 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f257(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 257 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f258(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 258 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f259(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 259 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f260(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 260 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f261(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 261 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f262(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 262 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f263(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 263 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f264(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 264 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f265(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 265 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f266(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 266 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f267(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 267 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f268(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 268 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f269(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 269 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f270(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 270 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f271(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 271 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f272(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 272 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f273(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 273 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f274(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 274 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f275(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 275 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f276(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 276 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f277(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 277 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f278(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 278 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f279(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 279 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f280(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 280 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f281(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 281 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f282(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 282 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f283(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 283 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f284(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 284 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f285(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 285 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f286(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 286 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f287(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 287 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f288(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 288 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f289(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 289 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f290(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 290 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f291(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 291 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f292(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 292 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f293(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 293 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f294(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 294 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f295(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 295 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f296(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 296 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f297(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 297 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f298(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 298 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f299(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 299 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f300(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 300 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f301(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 301 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f302(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 302 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f303(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 303 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f304(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 304 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f305(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 305 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f306(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 306 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f307(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 307 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f308(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 308 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f309(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 309 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f310(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 310 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f311(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 311 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f312(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 312 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f313(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 313 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f314(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 314 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f315(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 315 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f316(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 316 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f317(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 317 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f318(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 318 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f319(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 319 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f320(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 320 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f321(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 321 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f322(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 322 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f323(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 323 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f324(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 324 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f325(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 325 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f326(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 326 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f327(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 327 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f328(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 328 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f329(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 329 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f330(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 330 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f331(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 331 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f332(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 332 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f333(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 333 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f334(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 334 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f335(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 335 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f336(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 336 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f337(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 337 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f338(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 338 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f339(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 339 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f340(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 340 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f341(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 341 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f342(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 342 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f343(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 343 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f344(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 344 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f345(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 345 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f346(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 346 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f347(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 347 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f348(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 348 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f349(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 349 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f350(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 350 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f351(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 351 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f352(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 352 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f353(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 353 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f354(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 354 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f355(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 355 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f356(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 356 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f357(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 357 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f358(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 358 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f359(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 359 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f360(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 360 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f361(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 361 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f362(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 362 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f363(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 363 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f364(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 364 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f365(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 365 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f366(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 366 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f367(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 367 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f368(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 368 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f369(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 369 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f370(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 370 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f371(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 371 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f372(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 372 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f373(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 373 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f374(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 374 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f375(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 375 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f376(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 376 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f377(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 377 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f378(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 378 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f379(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 379 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f380(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 380 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f381(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 381 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f382(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 382 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f383(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 383 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f384(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 384 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f385(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 385 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f386(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 386 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f387(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 387 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f388(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 388 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f389(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 389 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f390(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 390 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f391(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 391 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f392(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 392 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f393(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 393 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f394(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 394 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f395(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 395 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f396(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 396 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f397(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 397 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f398(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 398 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f399(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 399 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f400(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 400 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f401(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 401 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f402(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 402 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f403(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 403 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f404(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 404 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f405(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 405 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f406(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 406 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f407(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 407 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f408(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 408 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f409(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 409 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f410(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 410 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f411(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 411 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f412(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 412 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f413(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 413 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f414(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 414 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f415(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 415 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f416(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 416 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f417(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 417 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f418(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 418 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f419(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 419 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f420(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 420 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f421(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 421 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f422(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 422 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f423(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 423 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f424(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 424 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f425(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 425 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f426(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 426 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f427(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 427 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f428(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 428 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f429(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 429 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f430(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 430 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f431(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 431 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f432(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 432 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f433(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 433 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f434(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 434 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f435(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 435 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f436(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 436 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f437(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 437 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f438(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 438 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f439(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 439 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f440(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 440 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f441(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 441 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f442(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 442 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f443(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 443 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f444(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 444 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f445(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 445 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f446(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 446 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f447(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 447 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f448(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 448 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f449(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 449 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f450(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 450 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f451(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 451 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f452(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 452 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f453(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 453 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f454(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 454 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f455(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 455 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f456(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 456 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f457(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 457 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f458(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 458 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f459(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 459 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f460(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 460 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f461(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 461 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f462(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 462 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f463(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 463 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f464(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 464 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f465(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 465 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f466(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 466 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f467(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 467 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f468(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 468 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f469(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 469 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f470(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 470 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f471(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 471 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f472(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 472 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f473(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 473 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f474(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 474 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f475(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 475 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f476(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 476 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f477(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 477 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f478(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 478 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f479(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 479 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f480(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 480 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f481(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 481 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f482(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 482 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f483(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 483 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f484(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 484 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f485(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 485 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f486(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 486 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f487(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 487 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f488(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 488 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f489(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 489 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f490(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 490 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f491(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 491 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f492(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 492 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f493(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 493 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f494(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 494 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f495(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 495 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f496(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 496 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f497(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 497 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f498(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 498 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f499(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 499 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f500(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 500 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f501(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 501 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f502(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 502 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f503(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 503 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f504(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 504 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f505(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 505 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f506(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 506 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f507(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 507 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f508(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 508 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f509(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 509 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f510(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 510 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f511(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 511 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f512(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 512 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f513(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 513 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f514(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 514 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f515(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 515 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f516(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 516 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f517(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 517 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f518(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 518 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f519(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 519 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f520(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 520 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f521(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 521 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f522(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 522 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f523(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 523 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f524(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 524 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f525(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 525 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f526(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 526 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f527(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 527 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f528(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 528 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f529(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 529 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f530(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 530 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f531(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 531 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f532(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 532 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f533(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 533 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f534(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 534 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f535(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 535 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f536(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 536 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f537(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 537 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f538(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 538 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f539(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 539 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f540(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 540 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f541(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 541 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f542(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 542 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f543(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 543 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f544(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 544 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f545(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 545 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f546(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 546 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f547(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 547 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f548(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 548 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f549(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 549 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f550(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 550 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f551(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 551 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f552(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 552 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f553(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 553 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f554(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 554 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f555(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 555 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f556(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 556 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f557(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 557 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f558(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 558 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f559(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 559 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f560(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 560 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f561(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 561 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f562(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 562 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f563(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 563 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f564(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 564 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f565(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 565 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f566(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 566 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f567(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 567 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f568(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 568 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f569(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 569 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f570(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 570 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f571(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 571 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f572(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 572 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f573(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 573 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f574(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 574 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f575(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 575 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f576(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 576 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f577(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 577 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f578(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 578 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f579(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 579 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f580(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 580 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f581(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 581 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f582(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 582 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f583(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 583 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f584(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 584 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f585(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 585 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f586(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 586 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f587(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 587 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f588(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 588 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f589(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 589 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f590(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 590 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f591(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 591 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f592(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 592 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f593(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 593 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f594(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 594 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f595(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 595 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f596(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 596 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f597(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 597 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f598(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 598 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f599(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 599 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f600(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 600 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f601(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 601 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f602(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 602 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f603(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 603 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f604(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 604 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f605(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 605 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f606(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 606 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f607(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 607 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f608(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 608 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f609(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 609 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f610(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 610 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f611(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 611 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f612(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 612 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f613(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 613 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f614(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 614 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f615(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 615 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f616(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 616 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f617(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 617 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f618(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 618 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f619(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 619 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f620(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 620 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f621(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 621 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f622(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 622 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f623(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 623 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f624(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 624 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f625(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 625 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f626(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 626 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f627(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 627 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f628(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 628 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f629(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 629 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f630(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 630 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f631(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 631 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f632(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 632 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f633(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 633 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f634(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 634 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f635(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 635 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f636(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 636 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f637(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 637 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f638(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 638 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f639(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 639 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f640(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 640 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f641(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 641 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f642(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 642 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f643(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 643 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f644(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 644 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f645(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 645 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f646(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 646 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f647(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 647 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f648(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 648 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f649(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 649 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f650(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 650 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f651(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 651 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f652(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 652 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f653(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 653 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f654(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 654 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f655(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 655 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f656(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 656 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f657(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 657 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f658(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 658 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f659(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 659 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f660(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 660 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f661(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 661 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f662(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 662 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f663(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 663 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f664(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 664 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f665(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 665 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f666(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 666 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f667(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 667 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f668(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 668 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f669(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 669 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f670(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 670 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f671(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 671 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f672(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 672 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f673(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 673 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f674(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 674 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f675(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 675 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f676(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 676 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f677(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 677 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f678(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 678 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f679(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 679 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f680(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 680 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f681(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 681 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f682(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 682 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f683(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 683 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f684(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 684 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f685(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 685 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f686(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 686 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f687(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 687 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f688(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 688 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f689(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 689 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f690(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 690 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f691(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 691 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f692(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 692 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f693(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 693 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f694(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 694 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f695(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 695 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f696(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 696 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f697(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 697 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f698(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 698 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f699(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 699 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f700(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 700 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f701(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 701 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f702(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 702 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f703(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 703 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f704(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 704 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f705(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 705 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f706(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 706 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f707(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 707 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f708(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 708 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f709(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 709 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f710(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 710 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f711(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 711 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f712(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 712 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f713(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 713 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f714(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 714 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f715(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 715 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f716(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 716 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f717(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 717 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f718(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 718 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f719(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 719 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f720(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 720 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f721(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 721 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f722(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 722 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f723(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 723 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f724(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 724 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f725(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 725 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f726(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 726 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f727(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 727 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f728(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 728 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f729(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 729 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f730(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 730 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f731(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 731 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f732(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 732 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f733(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 733 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f734(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 734 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f735(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 735 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f736(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 736 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f737(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 737 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f738(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 738 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f739(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 739 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f740(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 740 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f741(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 741 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f742(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 742 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f743(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 743 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f744(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 744 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f745(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 745 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f746(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 746 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f747(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 747 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f748(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 748 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f749(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 749 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f750(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 750 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f751(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 751 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f752(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 752 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f753(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 753 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f754(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 754 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f755(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 755 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f756(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 756 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f757(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 757 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f758(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 758 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f759(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 759 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f760(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 760 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f761(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 761 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f762(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 762 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f763(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 763 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f764(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 764 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f765(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 765 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f766(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 766 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f767(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 767 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f768(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 768 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f769(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 769 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f770(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 770 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f771(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 771 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f772(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 772 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f773(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 773 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f774(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 774 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f775(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 775 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f776(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 776 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f777(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 777 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f778(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 778 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f779(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 779 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f780(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 780 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f781(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 781 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f782(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 782 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f783(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 783 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f784(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 784 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f785(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 785 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f786(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 786 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f787(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 787 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f788(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 788 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f789(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 789 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f790(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 790 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f791(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 791 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f792(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 792 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f793(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 793 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f794(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 794 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f795(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 795 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f796(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 796 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f797(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 797 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f798(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 798 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f799(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 799 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f800(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 800 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f801(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 801 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f802(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 802 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f803(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 803 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f804(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 804 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f805(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 805 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f806(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 806 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f807(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 807 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f808(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 808 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f809(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 809 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f810(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 810 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f811(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 811 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f812(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 812 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f813(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 813 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f814(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 814 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f815(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 815 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f816(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 816 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f817(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 817 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f818(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 818 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f819(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 819 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f820(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 820 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f821(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 821 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f822(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 822 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f823(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 823 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f824(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 824 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f825(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 825 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f826(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 826 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f827(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 827 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f828(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 828 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f829(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 829 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f830(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 830 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f831(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 831 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f832(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 832 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f833(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 833 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f834(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 834 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f835(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 835 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f836(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 836 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f837(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 837 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f838(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 838 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f839(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 839 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f840(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 840 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f841(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 841 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f842(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 842 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f843(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 843 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f844(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 844 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f845(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 845 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f846(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 846 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f847(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 847 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f848(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 848 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f849(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 849 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f850(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 850 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f851(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 851 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f852(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 852 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f853(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 853 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f854(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 854 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f855(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 855 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f856(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 856 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f857(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 857 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f858(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 858 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f859(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 859 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f860(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 860 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f861(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 861 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f862(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 862 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f863(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 863 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f864(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 864 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f865(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 865 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f866(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 866 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f867(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 867 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f868(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 868 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f869(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 869 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f870(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 870 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f871(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 871 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f872(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 872 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f873(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 873 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f874(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 874 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f875(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 875 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f876(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 876 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f877(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 877 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f878(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 878 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f879(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 879 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f880(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 880 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f881(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 881 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f882(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 882 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f883(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 883 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f884(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 884 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f885(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 885 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f886(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 886 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f887(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 887 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f888(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 888 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f889(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 889 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f890(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 890 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f891(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 891 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f892(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 892 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f893(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 893 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f894(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 894 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f895(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 895 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f896(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 896 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f897(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 897 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f898(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 898 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f899(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 899 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f900(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 900 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f901(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 901 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f902(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 902 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f903(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 903 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f904(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 904 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f905(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 905 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f906(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 906 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f907(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 907 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f908(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 908 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f909(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 909 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f910(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 910 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f911(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 911 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f912(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 912 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f913(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 913 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f914(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 914 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f915(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 915 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f916(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 916 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f917(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 917 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f918(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 918 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f919(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 919 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f920(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 920 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f921(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 921 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f922(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 922 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f923(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 923 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f924(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 924 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f925(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 925 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f926(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 926 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f927(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 927 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f928(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 928 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f929(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 929 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f930(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 930 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f931(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 931 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f932(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 932 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f933(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 933 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f934(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 934 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f935(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 935 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f936(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 936 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f937(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 937 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f938(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 938 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f939(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 939 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f940(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 940 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f941(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 941 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f942(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 942 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f943(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 943 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f944(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 944 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f945(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 945 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f946(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 946 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f947(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 947 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f948(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 948 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f949(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 949 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f950(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 950 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f951(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 951 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f952(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 952 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f953(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 953 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f954(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 954 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f955(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 955 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f956(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 956 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f957(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 957 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f958(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 958 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f959(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 959 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f960(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 960 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f961(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 961 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f962(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 962 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f963(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 963 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f964(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 964 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f965(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 965 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f966(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 966 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f967(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 967 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f968(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 968 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f969(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 969 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f970(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 970 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f971(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 971 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f972(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 972 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f973(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 973 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f974(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 974 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f975(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 975 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f976(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 976 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f977(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 977 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f978(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 978 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f979(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 979 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f980(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 980 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f981(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 981 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f982(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 982 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f983(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 983 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f984(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 984 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f985(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 985 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f986(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 986 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f987(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 987 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f988(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 988 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f989(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 989 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f990(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 990 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f991(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 991 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f992(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 992 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f993(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 993 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f994(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 994 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f995(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 995 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f996(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 996 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f997(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 997 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f998(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 998 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f999(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 999 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1000(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1000 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1001(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1001 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1002(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1002 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1003(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1003 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1004(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1004 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1005(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1005 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1006(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1006 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1007(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1007 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1008(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1008 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1009(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1009 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1010(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1010 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1011(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1011 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1012(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1012 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1013(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1013 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1014(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1014 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1015(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1015 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1016(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1016 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1017(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1017 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1018(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1018 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1019(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1019 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1020(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1020 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1021(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1021 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1022(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1022 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1023(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1023 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1024(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1024 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1025(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1025 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1026(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1026 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1027(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1027 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1028(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1028 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1029(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1029 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1030(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1030 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1031(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1031 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1032(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1032 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1033(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1033 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1034(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1034 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1035(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1035 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1036(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1036 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1037(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1037 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1038(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1038 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1039(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1039 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1040(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1040 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1041(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1041 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1042(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1042 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1043(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1043 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1044(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1044 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1045(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1045 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1046(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1046 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1047(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1047 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1048(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1048 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1049(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1049 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1050(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1050 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1051(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1051 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1052(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1052 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1053(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1053 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1054(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1054 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1055(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1055 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1056(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1056 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1057(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1057 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1058(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1058 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1059(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1059 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1060(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1060 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1061(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1061 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1062(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1062 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1063(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1063 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1064(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1064 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1065(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1065 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1066(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1066 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1067(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1067 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1068(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1068 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1069(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1069 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1070(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1070 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1071(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1071 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1072(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1072 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1073(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1073 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1074(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1074 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1075(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1075 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1076(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1076 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1077(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1077 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1078(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1078 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1079(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1079 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1080(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1080 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1081(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1081 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1082(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1082 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1083(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1083 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1084(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1084 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1085(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1085 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1086(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1086 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1087(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1087 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1088(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1088 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1089(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1089 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1090(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1090 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1091(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1091 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1092(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1092 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1093(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1093 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1094(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1094 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1095(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1095 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1096(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1096 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1097(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1097 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1098(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1098 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1099(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1099 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1100(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1100 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1101(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1101 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1102(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1102 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1103(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1103 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1104(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1104 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1105(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1105 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1106(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1106 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1107(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1107 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1108(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1108 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1109(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1109 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1110(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1110 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1111(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1111 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1112(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1112 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1113(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1113 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1114(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1114 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1115(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1115 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1116(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1116 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1117(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1117 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1118(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1118 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1119(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1119 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1120(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1120 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1121(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1121 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1122(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1122 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1123(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1123 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1124(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1124 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1125(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1125 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1126(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1126 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1127(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1127 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1128(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1128 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1129(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1129 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1130(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1130 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1131(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1131 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1132(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1132 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1133(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1133 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1134(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1134 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1135(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1135 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1136(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1136 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1137(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1137 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1138(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1138 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1139(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1139 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1140(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1140 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1141(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1141 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1142(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1142 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1143(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1143 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1144(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1144 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1145(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1145 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1146(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1146 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1147(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1147 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1148(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1148 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1149(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1149 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1150(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1150 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1151(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1151 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1152(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1152 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1153(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1153 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1154(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1154 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1155(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1155 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1156(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1156 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1157(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1157 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1158(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1158 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1159(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1159 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1160(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1160 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1161(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1161 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1162(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1162 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1163(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1163 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1164(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1164 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1165(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1165 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1166(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1166 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1167(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1167 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1168(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1168 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1169(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1169 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1170(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1170 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1171(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1171 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1172(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1172 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1173(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1173 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1174(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1174 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1175(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1175 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1176(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1176 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1177(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1177 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1178(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1178 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1179(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1179 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1180(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1180 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1181(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1181 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1182(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1182 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1183(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1183 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1184(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1184 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1185(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1185 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1186(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1186 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1187(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1187 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1188(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1188 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1189(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1189 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1190(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1190 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1191(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1191 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1192(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1192 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1193(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1193 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1194(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1194 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1195(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1195 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1196(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1196 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1197(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1197 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1198(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1198 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1199(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1199 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1200(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1200 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1201(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1201 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1202(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1202 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1203(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1203 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1204(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1204 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1205(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1205 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1206(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1206 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1207(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1207 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1208(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1208 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1209(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1209 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1210(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1210 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1211(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1211 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1212(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1212 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1213(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1213 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1214(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1214 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1215(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1215 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1216(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1216 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1217(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1217 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1218(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1218 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1219(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1219 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1220(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1220 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1221(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1221 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1222(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1222 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1223(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1223 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1224(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1224 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1225(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1225 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1226(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1226 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1227(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1227 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1228(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1228 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1229(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1229 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1230(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1230 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1231(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1231 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1232(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1232 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1233(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1233 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1234(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1234 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1235(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1235 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1236(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1236 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1237(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1237 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1238(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1238 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1239(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1239 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1240(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1240 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1241(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1241 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1242(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1242 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1243(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1243 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1244(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1244 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1245(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1245 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1246(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1246 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1247(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1247 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1248(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1248 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1249(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1249 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1250(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1250 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1251(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1251 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1252(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1252 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1253(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1253 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1254(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1254 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1255(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1255 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1256(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1256 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1257(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1257 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1258(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1258 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1259(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1259 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1260(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1260 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1261(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1261 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1262(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1262 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1263(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1263 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1264(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1264 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1265(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1265 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1266(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1266 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1267(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1267 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1268(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1268 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1269(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1269 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1270(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1270 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1271(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1271 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1272(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1272 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1273(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1273 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1274(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1274 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1275(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1275 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1276(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1276 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1277(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1277 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1278(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1278 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1279(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1279 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1280(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1280 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1281(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1281 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1282(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1282 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1283(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1283 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1284(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1284 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1285(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1285 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1286(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1286 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1287(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1287 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1288(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1288 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1289(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1289 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1290(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1290 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1291(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1291 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1292(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1292 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1293(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1293 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1294(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1294 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1295(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1295 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1296(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1296 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1297(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1297 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1298(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1298 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1299(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1299 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1300(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1300 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1301(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1301 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1302(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1302 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1303(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1303 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1304(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1304 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1305(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1305 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1306(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1306 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1307(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1307 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1308(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1308 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1309(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1309 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1310(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1310 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1311(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1311 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1312(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1312 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1313(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1313 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1314(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1314 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1315(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1315 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1316(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1316 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1317(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1317 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1318(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1318 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1319(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1319 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1320(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1320 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1321(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1321 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1322(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1322 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1323(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1323 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1324(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1324 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1325(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1325 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1326(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1326 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1327(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1327 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1328(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1328 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1329(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1329 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1330(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1330 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1331(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1331 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1332(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1332 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1333(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1333 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1334(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1334 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1335(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1335 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1336(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1336 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1337(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1337 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1338(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1338 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1339(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1339 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1340(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1340 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1341(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1341 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1342(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1342 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1343(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1343 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1344(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1344 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1345(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1345 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1346(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1346 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1347(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1347 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1348(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1348 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1349(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1349 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1350(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1350 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1351(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1351 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1352(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1352 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1353(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1353 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1354(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1354 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1355(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1355 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1356(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1356 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1357(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1357 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1358(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1358 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1359(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1359 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1360(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1360 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1361(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1361 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1362(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1362 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1363(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1363 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1364(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1364 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1365(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1365 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1366(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1366 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1367(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1367 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1368(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1368 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1369(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1369 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1370(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1370 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1371(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1371 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1372(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1372 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1373(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1373 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1374(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1374 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1375(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1375 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1376(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1376 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1377(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1377 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1378(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1378 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1379(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1379 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1380(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1380 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1381(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1381 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1382(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1382 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1383(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1383 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1384(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1384 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1385(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1385 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1386(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1386 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1387(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1387 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1388(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1388 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1389(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1389 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1390(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1390 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1391(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1391 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1392(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1392 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1393(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1393 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1394(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1394 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1395(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1395 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1396(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1396 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1397(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1397 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1398(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1398 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1399(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1399 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1400(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1400 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1401(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1401 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1402(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1402 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1403(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1403 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1404(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1404 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1405(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1405 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1406(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1406 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1407(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1407 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1408(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1408 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1409(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1409 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1410(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1410 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1411(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1411 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1412(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1412 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1413(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1413 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1414(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1414 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1415(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1415 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1416(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1416 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1417(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1417 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1418(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1418 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1419(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1419 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1420(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1420 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1421(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1421 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1422(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1422 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1423(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1423 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1424(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1424 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1425(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1425 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1426(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1426 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1427(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1427 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1428(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1428 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1429(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1429 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1430(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1430 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1431(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1431 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1432(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1432 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1433(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1433 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1434(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1434 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1435(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1435 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1436(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1436 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1437(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1437 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1438(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1438 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1439(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1439 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1440(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1440 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1441(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1441 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1442(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1442 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1443(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1443 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1444(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1444 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1445(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1445 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1446(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1446 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1447(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1447 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1448(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1448 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1449(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1449 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1450(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1450 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1451(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1451 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1452(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1452 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1453(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1453 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1454(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1454 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1455(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1455 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1456(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1456 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1457(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1457 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1458(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1458 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1459(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1459 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1460(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1460 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1461(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1461 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1462(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1462 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1463(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1463 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1464(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1464 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1465(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1465 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1466(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1466 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1467(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1467 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1468(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1468 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1469(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1469 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1470(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1470 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1471(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1471 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1472(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1472 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1473(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1473 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1474(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1474 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1475(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1475 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1476(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1476 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1477(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1477 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1478(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1478 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1479(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1479 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1480(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1480 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1481(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1481 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1482(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1482 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1483(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1483 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1484(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1484 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1485(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1485 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1486(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1486 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1487(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1487 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1488(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1488 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1489(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1489 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1490(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1490 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1491(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1491 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1492(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1492 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1493(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1493 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1494(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1494 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1495(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1495 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1496(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1496 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1497(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1497 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1498(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1498 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1499(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1499 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1500(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1500 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1501(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1501 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1502(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1502 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1503(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1503 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1504(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1504 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1505(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1505 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1506(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1506 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1507(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1507 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1508(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1508 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1509(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1509 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1510(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1510 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1511(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1511 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1512(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1512 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1513(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1513 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1514(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1514 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1515(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1515 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1516(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1516 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1517(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1517 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1518(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1518 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1519(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1519 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1520(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1520 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1521(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1521 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1522(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1522 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1523(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1523 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1524(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1524 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1525(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1525 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1526(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1526 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1527(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1527 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1528(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1528 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1529(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1529 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1530(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1530 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1531(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1531 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1532(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1532 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1533(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1533 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1534(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1534 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1535(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1535 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1536(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1536 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1537(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1537 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1538(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1538 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1539(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1539 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1540(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1540 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1541(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1541 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1542(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1542 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1543(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1543 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1544(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1544 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1545(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1545 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1546(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1546 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1547(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1547 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1548(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1548 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1549(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1549 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1550(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1550 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1551(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1551 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1552(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1552 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1553(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1553 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1554(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1554 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1555(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1555 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1556(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1556 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1557(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1557 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1558(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1558 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1559(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1559 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1560(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1560 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1561(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1561 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1562(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1562 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1563(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1563 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1564(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1564 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1565(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1565 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1566(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1566 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1567(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1567 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1568(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1568 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1569(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1569 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1570(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1570 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1571(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1571 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1572(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1572 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1573(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1573 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1574(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1574 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1575(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1575 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1576(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1576 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1577(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1577 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1578(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1578 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1579(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1579 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1580(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1580 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1581(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1581 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1582(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1582 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1583(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1583 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1584(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1584 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1585(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1585 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1586(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1586 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1587(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1587 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1588(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1588 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1589(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1589 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1590(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1590 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1591(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1591 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1592(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1592 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1593(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1593 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1594(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1594 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1595(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1595 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1596(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1596 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1597(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1597 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1598(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1598 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1599(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1599 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1600(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1600 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1601(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1601 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1602(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1602 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1603(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1603 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1604(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1604 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1605(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1605 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1606(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1606 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1607(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1607 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1608(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1608 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1609(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1609 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1610(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1610 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1611(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1611 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1612(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1612 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1613(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1613 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1614(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1614 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1615(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1615 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1616(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1616 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1617(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1617 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1618(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1618 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1619(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1619 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1620(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1620 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1621(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1621 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1622(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1622 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1623(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1623 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1624(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1624 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1625(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1625 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1626(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1626 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1627(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1627 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1628(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1628 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1629(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1629 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1630(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1630 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1631(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1631 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1632(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1632 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1633(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1633 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1634(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1634 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1635(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1635 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1636(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1636 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1637(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1637 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1638(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1638 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1639(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1639 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1640(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1640 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1641(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1641 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1642(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1642 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1643(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1643 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1644(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1644 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1645(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1645 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1646(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1646 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1647(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1647 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1648(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1648 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1649(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1649 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1650(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1650 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1651(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1651 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1652(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1652 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1653(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1653 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1654(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1654 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1655(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1655 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1656(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1656 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1657(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1657 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1658(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1658 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1659(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1659 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1660(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1660 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1661(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1661 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1662(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1662 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1663(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1663 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1664(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1664 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1665(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1665 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1666(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1666 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1667(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1667 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1668(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1668 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1669(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1669 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1670(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1670 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1671(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1671 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1672(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1672 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1673(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1673 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1674(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1674 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1675(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1675 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1676(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1676 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1677(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1677 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1678(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1678 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1679(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1679 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1680(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1680 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1681(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1681 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1682(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1682 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1683(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1683 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1684(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1684 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1685(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1685 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1686(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1686 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1687(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1687 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1688(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1688 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1689(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1689 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1690(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1690 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1691(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1691 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1692(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1692 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1693(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1693 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1694(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1694 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1695(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1695 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1696(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1696 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1697(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1697 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1698(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1698 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1699(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1699 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1700(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1700 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1701(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1701 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1702(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1702 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1703(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1703 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1704(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1704 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1705(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1705 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1706(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1706 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1707(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1707 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1708(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1708 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1709(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1709 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1710(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1710 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1711(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1711 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1712(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1712 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1713(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1713 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1714(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1714 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1715(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1715 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1716(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1716 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1717(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1717 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1718(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1718 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1719(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1719 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1720(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1720 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1721(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1721 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1722(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1722 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1723(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1723 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1724(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1724 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1725(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1725 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1726(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1726 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1727(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1727 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1728(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1728 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1729(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1729 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1730(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1730 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1731(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1731 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1732(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1732 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1733(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1733 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1734(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1734 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1735(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1735 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1736(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1736 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1737(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1737 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1738(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1738 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1739(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1739 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1740(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1740 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1741(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1741 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1742(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1742 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1743(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1743 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1744(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1744 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1745(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1745 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1746(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1746 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1747(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1747 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1748(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1748 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1749(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1749 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1750(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1750 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1751(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1751 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1752(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1752 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1753(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1753 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1754(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1754 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1755(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1755 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1756(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1756 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1757(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1757 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1758(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1758 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1759(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1759 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1760(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1760 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1761(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1761 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1762(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1762 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1763(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1763 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1764(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1764 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1765(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1765 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1766(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1766 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1767(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1767 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1768(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1768 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1769(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1769 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1770(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1770 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1771(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1771 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1772(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1772 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1773(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1773 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1774(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1774 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1775(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1775 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1776(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1776 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1777(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1777 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1778(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1778 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1779(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1779 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1780(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1780 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1781(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1781 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1782(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1782 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1783(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1783 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1784(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1784 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1785(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1785 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1786(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1786 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1787(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1787 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1788(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1788 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1789(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1789 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1790(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1790 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1791(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1791 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1792(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1792 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1793(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1793 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1794(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1794 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1795(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1795 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1796(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1796 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1797(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1797 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1798(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1798 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1799(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1799 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1800(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1800 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1801(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1801 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1802(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1802 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1803(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1803 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1804(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1804 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1805(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1805 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1806(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1806 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1807(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1807 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1808(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1808 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1809(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1809 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1810(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1810 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1811(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1811 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1812(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1812 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1813(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1813 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1814(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1814 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1815(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1815 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1816(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1816 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1817(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1817 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1818(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1818 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1819(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1819 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1820(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1820 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1821(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1821 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1822(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1822 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1823(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1823 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1824(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1824 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1825(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1825 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1826(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1826 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1827(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1827 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1828(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1828 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1829(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1829 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1830(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1830 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1831(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1831 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1832(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1832 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1833(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1833 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1834(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1834 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1835(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1835 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1836(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1836 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1837(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1837 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1838(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1838 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1839(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1839 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1840(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1840 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1841(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1841 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1842(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1842 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1843(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1843 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1844(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1844 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1845(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1845 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1846(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1846 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1847(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1847 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1848(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1848 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1849(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1849 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1850(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1850 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1851(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1851 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1852(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1852 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1853(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1853 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1854(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1854 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1855(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1855 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1856(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1856 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1857(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1857 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1858(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1858 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1859(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1859 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1860(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1860 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1861(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1861 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1862(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1862 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1863(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1863 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1864(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1864 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1865(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1865 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1866(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1866 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1867(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1867 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1868(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1868 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1869(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1869 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1870(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1870 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1871(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1871 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1872(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1872 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1873(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1873 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1874(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1874 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1875(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1875 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1876(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1876 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1877(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1877 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1878(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1878 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1879(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1879 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1880(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1880 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1881(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1881 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1882(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1882 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1883(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1883 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1884(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1884 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1885(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1885 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1886(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1886 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1887(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1887 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1888(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1888 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1889(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1889 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1890(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1890 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1891(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1891 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1892(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1892 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1893(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1893 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1894(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1894 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1895(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1895 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1896(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1896 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1897(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1897 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1898(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1898 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1899(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1899 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1900(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1900 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1901(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1901 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1902(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1902 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1903(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1903 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1904(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1904 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1905(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1905 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1906(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1906 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1907(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1907 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1908(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1908 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1909(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1909 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1910(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1910 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1911(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1911 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1912(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1912 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1913(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1913 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1914(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1914 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1915(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1915 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1916(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1916 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1917(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1917 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1918(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1918 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1919(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1919 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1920(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1920 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1921(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1921 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1922(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1922 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1923(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1923 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1924(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1924 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1925(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1925 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1926(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1926 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1927(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1927 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1928(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1928 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1929(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1929 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1930(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1930 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1931(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1931 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1932(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1932 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1933(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1933 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1934(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1934 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1935(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1935 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1936(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1936 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1937(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1937 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1938(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1938 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1939(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1939 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1940(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1940 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1941(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1941 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1942(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1942 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1943(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1943 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1944(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1944 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1945(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1945 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1946(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1946 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1947(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1947 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1948(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1948 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1949(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1949 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1950(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1950 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1951(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1951 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1952(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1952 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1953(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1953 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1954(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1954 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1955(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1955 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1956(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1956 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1957(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1957 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1958(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1958 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1959(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1959 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1960(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1960 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1961(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1961 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1962(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1962 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1963(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1963 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1964(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1964 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1965(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1965 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1966(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1966 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1967(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1967 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1968(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1968 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
+
+fn f1969(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1969 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 16
+}
+
+fn f1970(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1970 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 17
+}
+
+fn f1971(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1971 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 18
+}
+
+fn f1972(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1972 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 19
+}
+
+fn f1973(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1973 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 20
+}
+
+fn f1974(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1974 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 21
+}
+
+fn f1975(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1975 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 22
+}
+
+fn f1976(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1976 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 23
+}
+
+fn f1977(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1977 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 24
+}
+
+fn f1978(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1978 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 25
+}
+
+fn f1979(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1979 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 26
+}
+
+fn f1980(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1980 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 27
+}
+
+fn f1981(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1981 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 28
+}
+
+fn f1982(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1982 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 29
+}
+
+fn f1983(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1983 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 30
+}
+
+fn f1984(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1984 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 0
+}
+
+fn f1985(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1985 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 1
+}
+
+fn f1986(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1986 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 2
+}
+
+fn f1987(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1987 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 3
+}
+
+fn f1988(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1988 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 4
+}
+
+fn f1989(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1989 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 5
+}
+
+fn f1990(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1990 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 6
+}
+
+fn f1991(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1991 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 7
+}
+
+fn f1992(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1992 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 8
+}
+
+fn f1993(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1993 {
+            s := s - a
+        } else {
+            s := s + i * 6
+        }
+        i++
+    }
+    r := s ^ a << 9
+}
+
+fn f1994(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1994 {
+            s := s - a
+        } else {
+            s := s + i * 7
+        }
+        i++
+    }
+    r := s ^ a << 10
+}
+
+fn f1995(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1995 {
+            s := s - a
+        } else {
+            s := s + i * 1
+        }
+        i++
+    }
+    r := s ^ a << 11
+}
+
+fn f1996(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1996 {
+            s := s - a
+        } else {
+            s := s + i * 2
+        }
+        i++
+    }
+    r := s ^ a << 12
+}
+
+fn f1997(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1997 {
+            s := s - a
+        } else {
+            s := s + i * 3
+        }
+        i++
+    }
+    r := s ^ a << 13
+}
+
+fn f1998(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1998 {
+            s := s - a
+        } else {
+            s := s + i * 4
+        }
+        i++
+    }
+    r := s ^ a << 14
+}
+
+fn f1999(a: i32, b: i32) (r: i32)
+{
+    s: i32 := a
+    i: i32 := 0
+    while i < b {
+        if s > 1999 {
+            s := s - a
+        } else {
+            s := s + i * 5
+        }
+        i++
+    }
+    r := s ^ a << 15
+}
@@ -0,0 +1,105 @@
+// Kernels of the generated-code benchmark; each runs n iterations of a loop
+// and returns a value depending on all of them so that nothing is removed.
+// An expression has a single operator to keep the C reference in
+// bench/minica_bench_code.c unambiguous.
+
+// Integer arithmetic
+fn arith(n: i64, x: i64) (r: i64)
+{
+    i: i64 := 0
+    r := x
+    while i < n {
+        r := r * 3
+        r := r + i
+        r := r - x
+        r := r ^ i
+        i++
+    }
+}
+
+// Division and remainder by a divisor unknown at compile time
+fn divmod(n: i64, d: i64) (r: i64)
+{
+    i: i64 := 0
+    q: i64 := 0
+    m: i64 := 0
+    r := 0
+    while i < n {
+        q := i / d
+        m := i % d
+        r := r + q
+        r := r ^ m
+        i++
+    }
+}
+
+// Division and remainder by a constant, strength-reduced by the compiler
+fn divconst(n: i64) (r: i64)
+{
+    i: i64 := 0
+    q: i64 := 0
+    m: i64 := 0
+    r := 0
+    while i < n {
+        q := i / 7
+        m := i % 7
+        r := r + q
+        r := r ^ m
+        i++
+    }
+}
+
+// Shifts by a variable and a constant count
+fn shifts(n: i64, s: i64) (r: i64)
+{
+    i: i64 := 0
+    t: i64 := 0
+    r := 1
+    while i < n {
+        t := i << s
+        r := r ^ t
+        t := r >> 3
+        r := r + t
+        i++
+    }
+}
+
+// Switch dispatch on a value changing every iteration
+fn dispatch(n: i64, x: i64) (r: i64)
+{
+    i: i64 := 0
+    k: i64 := 0
+    r := x
+    while i < n {
+        k := r & 7
+        switch k {
+            case 0:
+                r := r + 3
+            case 1:
+                r := r ^ 5
+            case 2:
+                r := r + i
+            case 3:
+                r := r * 5
+            case 4, 5:
+                r := r - 1
+            case 6:
+                r := r + 7
+            default:
+                r := r ^ i
+        }
+        i++
+    }
+}
+
+// Coroutine resumed by the driver to yield every value, one round trip per
+// iteration
+coroutine pingpong(n: i64) (r: i64)
+{
+    i: i64 := 0
+    while i < n {
+        yield i
+        i++
+    }
+    r := n
+}
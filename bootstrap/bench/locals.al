@@ -0,0 +1,4006 @@
+// 4000 local variables
+
+fn main(a: i32) (r: i32)
+{
+    v0: i32 := a
+    v1: i32 := v0 + 1
+    v2: i32 := v1 + 2
+    v3: i32 := v2 + 3
+    v4: i32 := v3 + 4
+    v5: i32 := v4 + 5
+    v6: i32 := v5 + 6
+    v7: i32 := v6 + 7
+    v8: i32 := v7 + 8
+    v9: i32 := v8 + 9
+    v10: i32 := v9 + 10
+    v11: i32 := v10 + 11
+    v12: i32 := v11 + 12
+    v13: i32 := v12 + 13
+    v14: i32 := v13 + 14
+    v15: i32 := v14 + 15
+    v16: i32 := v15 + 16
+    v17: i32 := v16 + 17
+    v18: i32 := v17 + 18
+    v19: i32 := v18 + 19
+    v20: i32 := v19 + 20
+    v21: i32 := v20 + 21
+    v22: i32 := v21 + 22
+    v23: i32 := v22 + 23
+    v24: i32 := v23 + 24
+    v25: i32 := v24 + 25
+    v26: i32 := v25 + 26
+    v27: i32 := v26 + 27
+    v28: i32 := v27 + 28
+    v29: i32 := v28 + 29
+    v30: i32 := v29 + 30
+    v31: i32 := v30 + 31
+    v32: i32 := v31 + 32
+    v33: i32 := v32 + 33
+    v34: i32 := v33 + 34
+    v35: i32 := v34 + 35
+    v36: i32 := v35 + 36
+    v37: i32 := v36 + 37
+    v38: i32 := v37 + 38
+    v39: i32 := v38 + 39
+    v40: i32 := v39 + 40
+    v41: i32 := v40 + 41
+    v42: i32 := v41 + 42
+    v43: i32 := v42 + 43
+    v44: i32 := v43 + 44
+    v45: i32 := v44 + 45
+    v46: i32 := v45 + 46
+    v47: i32 := v46 + 47
+    v48: i32 := v47 + 48
+    v49: i32 := v48 + 49
+    v50: i32 := v49 + 50
+    v51: i32 := v50 + 51
+    v52: i32 := v51 + 52
+    v53: i32 := v52 + 53
+    v54: i32 := v53 + 54
+    v55: i32 := v54 + 55
+    v56: i32 := v55 + 56
+    v57: i32 := v56 + 57
+    v58: i32 := v57 + 58
+    v59: i32 := v58 + 59
+    v60: i32 := v59 + 60
+    v61: i32 := v60 + 61
+    v62: i32 := v61 + 62
+    v63: i32 := v62 + 63
+    v64: i32 := v63 + 64
+    v65: i32 := v64 + 65
+    v66: i32 := v65 + 66
+    v67: i32 := v66 + 67
+    v68: i32 := v67 + 68
+    v69: i32 := v68 + 69
+    v70: i32 := v69 + 70
+    v71: i32 := v70 + 71
+    v72: i32 := v71 + 72
+    v73: i32 := v72 + 73
+    v74: i32 := v73 + 74
+    v75: i32 := v74 + 75
+    v76: i32 := v75 + 76
+    v77: i32 := v76 + 77
+    v78: i32 := v77 + 78
+    v79: i32 := v78 + 79
+    v80: i32 := v79 + 80
+    v81: i32 := v80 + 81
+    v82: i32 := v81 + 82
+    v83: i32 := v82 + 83
+    v84: i32 := v83 + 84
+    v85: i32 := v84 + 85
+    v86: i32 := v85 + 86
+    v87: i32 := v86 + 87
+    v88: i32 := v87 + 88
+    v89: i32 := v88 + 89
+    v90: i32 := v89 + 90
+    v91: i32 := v90 + 91
+    v92: i32 := v91 + 92
+    v93: i32 := v92 + 93
+    v94: i32 := v93 + 94
+    v95: i32 := v94 + 95
+    v96: i32 := v95 + 96
+    v97: i32 := v96 + 97
+    v98: i32 := v97 + 98
+    v99: i32 := v98 + 99
+    v100: i32 := v99 + 100
+    v101: i32 := v100 + 101
+    v102: i32 := v101 + 102
+    v103: i32 := v102 + 103
+    v104: i32 := v103 + 104
+    v105: i32 := v104 + 105
+    v106: i32 := v105 + 106
+    v107: i32 := v106 + 107
+    v108: i32 := v107 + 108
+    v109: i32 := v108 + 109
+    v110: i32 := v109 + 110
+    v111: i32 := v110 + 111
+    v112: i32 := v111 + 112
+    v113: i32 := v112 + 113
+    v114: i32 := v113 + 114
+    v115: i32 := v114 + 115
+    v116: i32 := v115 + 116
+    v117: i32 := v116 + 117
+    v118: i32 := v117 + 118
+    v119: i32 := v118 + 119
+    v120: i32 := v119 + 120
+    v121: i32 := v120 + 121
+    v122: i32 := v121 + 122
+    v123: i32 := v122 + 123
+    v124: i32 := v123 + 124
+    v125: i32 := v124 + 125
+    v126: i32 := v125 + 126
+    v127: i32 := v126 + 127
+    v128: i32 := v127 + 128
+    v129: i32 := v128 + 129
+    v130: i32 := v129 + 130
+    v131: i32 := v130 + 131
+    v132: i32 := v131 + 132
+    v133: i32 := v132 + 133
+    v134: i32 := v133 + 134
+    v135: i32 := v134 + 135
+    v136: i32 := v135 + 136
+    v137: i32 := v136 + 137
+    v138: i32 := v137 + 138
+    v139: i32 := v138 + 139
+    v140: i32 := v139 + 140
+    v141: i32 := v140 + 141
+    v142: i32 := v141 + 142
+    v143: i32 := v142 + 143
+    v144: i32 := v143 + 144
+    v145: i32 := v144 + 145
+    v146: i32 := v145 + 146
+    v147: i32 := v146 + 147
+    v148: i32 := v147 + 148
+    v149: i32 := v148 + 149
+    v150: i32 := v149 + 150
+    v151: i32 := v150 + 151
+    v152: i32 := v151 + 152
+    v153: i32 := v152 + 153
+    v154: i32 := v153 + 154
+    v155: i32 := v154 + 155
+    v156: i32 := v155 + 156
+    v157: i32 := v156 + 157
+    v158: i32 := v157 + 158
+    v159: i32 := v158 + 159
+    v160: i32 := v159 + 160
+    v161: i32 := v160 + 161
+    v162: i32 := v161 + 162
+    v163: i32 := v162 + 163
+    v164: i32 := v163 + 164
+    v165: i32 := v164 + 165
+    v166: i32 := v165 + 166
+    v167: i32 := v166 + 167
+    v168: i32 := v167 + 168
+    v169: i32 := v168 + 169
+    v170: i32 := v169 + 170
+    v171: i32 := v170 + 171
+    v172: i32 := v171 + 172
+    v173: i32 := v172 + 173
+    v174: i32 := v173 + 174
+    v175: i32 := v174 + 175
+    v176: i32 := v175 + 176
+    v177: i32 := v176 + 177
+    v178: i32 := v177 + 178
+    v179: i32 := v178 + 179
+    v180: i32 := v179 + 180
+    v181: i32 := v180 + 181
+    v182: i32 := v181 + 182
+    v183: i32 := v182 + 183
+    v184: i32 := v183 + 184
+    v185: i32 := v184 + 185
+    v186: i32 := v185 + 186
+    v187: i32 := v186 + 187
+    v188: i32 := v187 + 188
+    v189: i32 := v188 + 189
+    v190: i32 := v189 + 190
+    v191: i32 := v190 + 191
+    v192: i32 := v191 + 192
+    v193: i32 := v192 + 193
+    v194: i32 := v193 + 194
+    v195: i32 := v194 + 195
+    v196: i32 := v195 + 196
+    v197: i32 := v196 + 197
+    v198: i32 := v197 + 198
+    v199: i32 := v198 + 199
+    v200: i32 := v199 + 200
+    v201: i32 := v200 + 201
+    v202: i32 := v201 + 202
+    v203: i32 := v202 + 203
+    v204: i32 := v203 + 204
+    v205: i32 := v204 + 205
+    v206: i32 := v205 + 206
+    v207: i32 := v206 + 207
+    v208: i32 := v207 + 208
+    v209: i32 := v208 + 209
+    v210: i32 := v209 + 210
+    v211: i32 := v210 + 211
+    v212: i32 := v211 + 212
+    v213: i32 := v212 + 213
+    v214: i32 := v213 + 214
+    v215: i32 := v214 + 215
+    v216: i32 := v215 + 216
+    v217: i32 := v216 + 217
+    v218: i32 := v217 + 218
+    v219: i32 := v218 + 219
+    v220: i32 := v219 + 220
+    v221: i32 := v220 + 221
+    v222: i32 := v221 + 222
+    v223: i32 := v222 + 223
+    v224: i32 := v223 + 224
+    v225: i32 := v224 + 225
+    v226: i32 := v225 + 226
+    v227: i32 := v226 + 227
+    v228: i32 := v227 + 228
+    v229: i32 := v228 + 229
+    v230: i32 := v229 + 230
+    v231: i32 := v230 + 231
+    v232: i32 := v231 + 232
+    v233: i32 := v232 + 233
+    v234: i32 := v233 + 234
+    v235: i32 := v234 + 235
+    v236: i32 := v235 + 236
+    v237: i32 := v236 + 237
+    v238: i32 := v237 + 238
+    v239: i32 := v238 + 239
+    v240: i32 := v239 + 240
+    v241: i32 := v240 + 241
+    v242: i32 := v241 + 242
+    v243: i32 := v242 + 243
+    v244: i32 := v243 + 244
+    v245: i32 := v244 + 245
+    v246: i32 := v245 + 246
+    v247: i32 := v246 + 247
+    v248: i32 := v247 + 248
+    v249: i32 := v248 + 249
+    v250: i32 := v249 + 250
+    v251: i32 := v250 + 251
+    v252: i32 := v251 + 252
+    v253: i32 := v252 + 253
+    v254: i32 := v253 + 254
+    v255: i32 := v254 + 255
+    v256: i32 := v255 + 256
+    v257: i32 := v256 + 257
+    v258: i32 := v257 + 258
+    v259: i32 := v258 + 259
+    v260: i32 := v259 + 260
+    v261: i32 := v260 + 261
+    v262: i32 := v261 + 262
+    v263: i32 := v262 + 263
+    v264: i32 := v263 + 264
+    v265: i32 := v264 + 265
+    v266: i32 := v265 + 266
+    v267: i32 := v266 + 267
+    v268: i32 := v267 + 268
+    v269: i32 := v268 + 269
+    v270: i32 := v269 + 270
+    v271: i32 := v270 + 271
+    v272: i32 := v271 + 272
+    v273: i32 := v272 + 273
+    v274: i32 := v273 + 274
+    v275: i32 := v274 + 275
+    v276: i32 := v275 + 276
+    v277: i32 := v276 + 277
+    v278: i32 := v277 + 278
+    v279: i32 := v278 + 279
+    v280: i32 := v279 + 280
+    v281: i32 := v280 + 281
+    v282: i32 := v281 + 282
+    v283: i32 := v282 + 283
+    v284: i32 := v283 + 284
+    v285: i32 := v284 + 285
+    v286: i32 := v285 + 286
+    v287: i32 := v286 + 287
+    v288: i32 := v287 + 288
+    v289: i32 := v288 + 289
+    v290: i32 := v289 + 290
+    v291: i32 := v290 + 291
+    v292: i32 := v291 + 292
+    v293: i32 := v292 + 293
+    v294: i32 := v293 + 294
+    v295: i32 := v294 + 295
+    v296: i32 := v295 + 296
+    v297: i32 := v296 + 297
+    v298: i32 := v297 + 298
+    v299: i32 := v298 + 299
+    v300: i32 := v299 + 300
+    v301: i32 := v300 + 301
+    v302: i32 := v301 + 302
+    v303: i32 := v302 + 303
+    v304: i32 := v303 + 304
+    v305: i32 := v304 + 305
+    v306: i32 := v305 + 306
+    v307: i32 := v306 + 307
+    v308: i32 := v307 + 308
+    v309: i32 := v308 + 309
+    v310: i32 := v309 + 310
+    v311: i32 := v310 + 311
+    v312: i32 := v311 + 312
+    v313: i32 := v312 + 313
+    v314: i32 := v313 + 314
+    v315: i32 := v314 + 315
+    v316: i32 := v315 + 316
+    v317: i32 := v316 + 317
+    v318: i32 := v317 + 318
+    v319: i32 := v318 + 319
+    v320: i32 := v319 + 320
+    v321: i32 := v320 + 321
+    v322: i32 := v321 + 322
+    v323: i32 := v322 + 323
+    v324: i32 := v323 + 324
+    v325: i32 := v324 + 325
+    v326: i32 := v325 + 326
+    v327: i32 := v326 + 327
+    v328: i32 := v327 + 328
+    v329: i32 := v328 + 329
+    v330: i32 := v329 + 330
+    v331: i32 := v330 + 331
+    v332: i32 := v331 + 332
+    v333: i32 := v332 + 333
+    v334: i32 := v333 + 334
+    v335: i32 := v334 + 335
+    v336: i32 := v335 + 336
+    v337: i32 := v336 + 337
+    v338: i32 := v337 + 338
+    v339: i32 := v338 + 339
+    v340: i32 := v339 + 340
+    v341: i32 := v340 + 341
+    v342: i32 := v341 + 342
+    v343: i32 := v342 + 343
+    v344: i32 := v343 + 344
+    v345: i32 := v344 + 345
+    v346: i32 := v345 + 346
+    v347: i32 := v346 + 347
+    v348: i32 := v347 + 348
+    v349: i32 := v348 + 349
+    v350: i32 := v349 + 350
+    v351: i32 := v350 + 351
+    v352: i32 := v351 + 352
+    v353: i32 := v352 + 353
+    v354: i32 := v353 + 354
+    v355: i32 := v354 + 355
+    v356: i32 := v355 + 356
+    v357: i32 := v356 + 357
+    v358: i32 := v357 + 358
+    v359: i32 := v358 + 359
+    v360: i32 := v359 + 360
+    v361: i32 := v360 + 361
+    v362: i32 := v361 + 362
+    v363: i32 := v362 + 363
+    v364: i32 := v363 + 364
+    v365: i32 := v364 + 365
+    v366: i32 := v365 + 366
+    v367: i32 := v366 + 367
+    v368: i32 := v367 + 368
+    v369: i32 := v368 + 369
+    v370: i32 := v369 + 370
+    v371: i32 := v370 + 371
+    v372: i32 := v371 + 372
+    v373: i32 := v372 + 373
+    v374: i32 := v373 + 374
+    v375: i32 := v374 + 375
+    v376: i32 := v375 + 376
+    v377: i32 := v376 + 377
+    v378: i32 := v377 + 378
+    v379: i32 := v378 + 379
+    v380: i32 := v379 + 380
+    v381: i32 := v380 + 381
+    v382: i32 := v381 + 382
+    v383: i32 := v382 + 383
+    v384: i32 := v383 + 384
+    v385: i32 := v384 + 385
+    v386: i32 := v385 + 386
+    v387: i32 := v386 + 387
+    v388: i32 := v387 + 388
+    v389: i32 := v388 + 389
+    v390: i32 := v389 + 390
+    v391: i32 := v390 + 391
+    v392: i32 := v391 + 392
+    v393: i32 := v392 + 393
+    v394: i32 := v393 + 394
+    v395: i32 := v394 + 395
+    v396: i32 := v395 + 396
+    v397: i32 := v396 + 397
+    v398: i32 := v397 + 398
+    v399: i32 := v398 + 399
+    v400: i32 := v399 + 400
+    v401: i32 := v400 + 401
+    v402: i32 := v401 + 402
+    v403: i32 := v402 + 403
+    v404: i32 := v403 + 404
+    v405: i32 := v404 + 405
+    v406: i32 := v405 + 406
+    v407: i32 := v406 + 407
+    v408: i32 := v407 + 408
+    v409: i32 := v408 + 409
+    v410: i32 := v409 + 410
+    v411: i32 := v410 + 411
+    v412: i32 := v411 + 412
+    v413: i32 := v412 + 413
+    v414: i32 := v413 + 414
+    v415: i32 := v414 + 415
+    v416: i32 := v415 + 416
+    v417: i32 := v416 + 417
+    v418: i32 := v417 + 418
+    v419: i32 := v418 + 419
+    v420: i32 := v419 + 420
+    v421: i32 := v420 + 421
+    v422: i32 := v421 + 422
+    v423: i32 := v422 + 423
+    v424: i32 := v423 + 424
+    v425: i32 := v424 + 425
+    v426: i32 := v425 + 426
+    v427: i32 := v426 + 427
+    v428: i32 := v427 + 428
+    v429: i32 := v428 + 429
+    v430: i32 := v429 + 430
+    v431: i32 := v430 + 431
+    v432: i32 := v431 + 432
+    v433: i32 := v432 + 433
+    v434: i32 := v433 + 434
+    v435: i32 := v434 + 435
+    v436: i32 := v435 + 436
+    v437: i32 := v436 + 437
+    v438: i32 := v437 + 438
+    v439: i32 := v438 + 439
+    v440: i32 := v439 + 440
+    v441: i32 := v440 + 441
+    v442: i32 := v441 + 442
+    v443: i32 := v442 + 443
+    v444: i32 := v443 + 444
+    v445: i32 := v444 + 445
+    v446: i32 := v445 + 446
+    v447: i32 := v446 + 447
+    v448: i32 := v447 + 448
+    v449: i32 := v448 + 449
+    v450: i32 := v449 + 450
+    v451: i32 := v450 + 451
+    v452: i32 := v451 + 452
+    v453: i32 := v452 + 453
+    v454: i32 := v453 + 454
+    v455: i32 := v454 + 455
+    v456: i32 := v455 + 456
+    v457: i32 := v456 + 457
+    v458: i32 := v457 + 458
+    v459: i32 := v458 + 459
+    v460: i32 := v459 + 460
+    v461: i32 := v460 + 461
+    v462: i32 := v461 + 462
+    v463: i32 := v462 + 463
+    v464: i32 := v463 + 464
+    v465: i32 := v464 + 465
+    v466: i32 := v465 + 466
+    v467: i32 := v466 + 467
+    v468: i32 := v467 + 468
+    v469: i32 := v468 + 469
+    v470: i32 := v469 + 470
+    v471: i32 := v470 + 471
+    v472: i32 := v471 + 472
+    v473: i32 := v472 + 473
+    v474: i32 := v473 + 474
+    v475: i32 := v474 + 475
+    v476: i32 := v475 + 476
+    v477: i32 := v476 + 477
+    v478: i32 := v477 + 478
+    v479: i32 := v478 + 479
+    v480: i32 := v479 + 480
+    v481: i32 := v480 + 481
+    v482: i32 := v481 + 482
+    v483: i32 := v482 + 483
+    v484: i32 := v483 + 484
+    v485: i32 := v484 + 485
+    v486: i32 := v485 + 486
+    v487: i32 := v486 + 487
+    v488: i32 := v487 + 488
+    v489: i32 := v488 + 489
+    v490: i32 := v489 + 490
+    v491: i32 := v490 + 491
+    v492: i32 := v491 + 492
+    v493: i32 := v492 + 493
+    v494: i32 := v493 + 494
+    v495: i32 := v494 + 495
+    v496: i32 := v495 + 496
+    v497: i32 := v496 + 497
+    v498: i32 := v497 + 498
+    v499: i32 := v498 + 499
+    v500: i32 := v499 + 500
+    v501: i32 := v500 + 501
+    v502: i32 := v501 + 502
+    v503: i32 := v502 + 503
+    v504: i32 := v503 + 504
+    v505: i32 := v504 + 505
+    v506: i32 := v505 + 506
+    v507: i32 := v506 + 507
+    v508: i32 := v507 + 508
+    v509: i32 := v508 + 509
+    v510: i32 := v509 + 510
+    v511: i32 := v510 + 511
+    v512: i32 := v511 + 512
+    v513: i32 := v512 + 513
+    v514: i32 := v513 + 514
+    v515: i32 := v514 + 515
+    v516: i32 := v515 + 516
+    v517: i32 := v516 + 517
+    v518: i32 := v517 + 518
+    v519: i32 := v518 + 519
+    v520: i32 := v519 + 520
+    v521: i32 := v520 + 521
+    v522: i32 := v521 + 522
+    v523: i32 := v522 + 523
+    v524: i32 := v523 + 524
+    v525: i32 := v524 + 525
+    v526: i32 := v525 + 526
+    v527: i32 := v526 + 527
+    v528: i32 := v527 + 528
+    v529: i32 := v528 + 529
+    v530: i32 := v529 + 530
+    v531: i32 := v530 + 531
+    v532: i32 := v531 + 532
+    v533: i32 := v532 + 533
+    v534: i32 := v533 + 534
+    v535: i32 := v534 + 535
+    v536: i32 := v535 + 536
+    v537: i32 := v536 + 537
+    v538: i32 := v537 + 538
+    v539: i32 := v538 + 539
+    v540: i32 := v539 + 540
+    v541: i32 := v540 + 541
+    v542: i32 := v541 + 542
+    v543: i32 := v542 + 543
+    v544: i32 := v543 + 544
+    v545: i32 := v544 + 545
+    v546: i32 := v545 + 546
+    v547: i32 := v546 + 547
+    v548: i32 := v547 + 548
+    v549: i32 := v548 + 549
+    v550: i32 := v549 + 550
+    v551: i32 := v550 + 551
+    v552: i32 := v551 + 552
+    v553: i32 := v552 + 553
+    v554: i32 := v553 + 554
+    v555: i32 := v554 + 555
+    v556: i32 := v555 + 556
+    v557: i32 := v556 + 557
+    v558: i32 := v557 + 558
+    v559: i32 := v558 + 559
+    v560: i32 := v559 + 560
+    v561: i32 := v560 + 561
+    v562: i32 := v561 + 562
+    v563: i32 := v562 + 563
+    v564: i32 := v563 + 564
+    v565: i32 := v564 + 565
+    v566: i32 := v565 + 566
+    v567: i32 := v566 + 567
+    v568: i32 := v567 + 568
+    v569: i32 := v568 + 569
+    v570: i32 := v569 + 570
+    v571: i32 := v570 + 571
+    v572: i32 := v571 + 572
+    v573: i32 := v572 + 573
+    v574: i32 := v573 + 574
+    v575: i32 := v574 + 575
+    v576: i32 := v575 + 576
+    v577: i32 := v576 + 577
+    v578: i32 := v577 + 578
+    v579: i32 := v578 + 579
+    v580: i32 := v579 + 580
+    v581: i32 := v580 + 581
+    v582: i32 := v581 + 582
+    v583: i32 := v582 + 583
+    v584: i32 := v583 + 584
+    v585: i32 := v584 + 585
+    v586: i32 := v585 + 586
+    v587: i32 := v586 + 587
+    v588: i32 := v587 + 588
+    v589: i32 := v588 + 589
+    v590: i32 := v589 + 590
+    v591: i32 := v590 + 591
+    v592: i32 := v591 + 592
+    v593: i32 := v592 + 593
+    v594: i32 := v593 + 594
+    v595: i32 := v594 + 595
+    v596: i32 := v595 + 596
+    v597: i32 := v596 + 597
+    v598: i32 := v597 + 598
+    v599: i32 := v598 + 599
+    v600: i32 := v599 + 600
+    v601: i32 := v600 + 601
+    v602: i32 := v601 + 602
+    v603: i32 := v602 + 603
+    v604: i32 := v603 + 604
+    v605: i32 := v604 + 605
+    v606: i32 := v605 + 606
+    v607: i32 := v606 + 607
+    v608: i32 := v607 + 608
+    v609: i32 := v608 + 609
+    v610: i32 := v609 + 610
+    v611: i32 := v610 + 611
+    v612: i32 := v611 + 612
+    v613: i32 := v612 + 613
+    v614: i32 := v613 + 614
+    v615: i32 := v614 + 615
+    v616: i32 := v615 + 616
+    v617: i32 := v616 + 617
+    v618: i32 := v617 + 618
+    v619: i32 := v618 + 619
+    v620: i32 := v619 + 620
+    v621: i32 := v620 + 621
+    v622: i32 := v621 + 622
+    v623: i32 := v622 + 623
+    v624: i32 := v623 + 624
+    v625: i32 := v624 + 625
+    v626: i32 := v625 + 626
+    v627: i32 := v626 + 627
+    v628: i32 := v627 + 628
+    v629: i32 := v628 + 629
+    v630: i32 := v629 + 630
+    v631: i32 := v630 + 631
+    v632: i32 := v631 + 632
+    v633: i32 := v632 + 633
+    v634: i32 := v633 + 634
+    v635: i32 := v634 + 635
+    v636: i32 := v635 + 636
+    v637: i32 := v636 + 637
+    v638: i32 := v637 + 638
+    v639: i32 := v638 + 639
+    v640: i32 := v639 + 640
+    v641: i32 := v640 + 641
+    v642: i32 := v641 + 642
+    v643: i32 := v642 + 643
+    v644: i32 := v643 + 644
+    v645: i32 := v644 + 645
+    v646: i32 := v645 + 646
+    v647: i32 := v646 + 647
+    v648: i32 := v647 + 648
+    v649: i32 := v648 + 649
+    v650: i32 := v649 + 650
+    v651: i32 := v650 + 651
+    v652: i32 := v651 + 652
+    v653: i32 := v652 + 653
+    v654: i32 := v653 + 654
+    v655: i32 := v654 + 655
+    v656: i32 := v655 + 656
+    v657: i32 := v656 + 657
+    v658: i32 := v657 + 658
+    v659: i32 := v658 + 659
+    v660: i32 := v659 + 660
+    v661: i32 := v660 + 661
+    v662: i32 := v661 + 662
+    v663: i32 := v662 + 663
+    v664: i32 := v663 + 664
+    v665: i32 := v664 + 665
+    v666: i32 := v665 + 666
+    v667: i32 := v666 + 667
+    v668: i32 := v667 + 668
+    v669: i32 := v668 + 669
+    v670: i32 := v669 + 670
+    v671: i32 := v670 + 671
+    v672: i32 := v671 + 672
+    v673: i32 := v672 + 673
+    v674: i32 := v673 + 674
+    v675: i32 := v674 + 675
+    v676: i32 := v675 + 676
+    v677: i32 := v676 + 677
+    v678: i32 := v677 + 678
+    v679: i32 := v678 + 679
+    v680: i32 := v679 + 680
+    v681: i32 := v680 + 681
+    v682: i32 := v681 + 682
+    v683: i32 := v682 + 683
+    v684: i32 := v683 + 684
+    v685: i32 := v684 + 685
+    v686: i32 := v685 + 686
+    v687: i32 := v686 + 687
+    v688: i32 := v687 + 688
+    v689: i32 := v688 + 689
+    v690: i32 := v689 + 690
+    v691: i32 := v690 + 691
+    v692: i32 := v691 + 692
+    v693: i32 := v692 + 693
+    v694: i32 := v693 + 694
+    v695: i32 := v694 + 695
+    v696: i32 := v695 + 696
+    v697: i32 := v696 + 697
+    v698: i32 := v697 + 698
+    v699: i32 := v698 + 699
+    v700: i32 := v699 + 700
+    v701: i32 := v700 + 701
+    v702: i32 := v701 + 702
+    v703: i32 := v702 + 703
+    v704: i32 := v703 + 704
+    v705: i32 := v704 + 705
+    v706: i32 := v705 + 706
+    v707: i32 := v706 + 707
+    v708: i32 := v707 + 708
+    v709: i32 := v708 + 709
+    v710: i32 := v709 + 710
+    v711: i32 := v710 + 711
+    v712: i32 := v711 + 712
+    v713: i32 := v712 + 713
+    v714: i32 := v713 + 714
+    v715: i32 := v714 + 715
+    v716: i32 := v715 + 716
+    v717: i32 := v716 + 717
+    v718: i32 := v717 + 718
+    v719: i32 := v718 + 719
+    v720: i32 := v719 + 720
+    v721: i32 := v720 + 721
+    v722: i32 := v721 + 722
+    v723: i32 := v722 + 723
+    v724: i32 := v723 + 724
+    v725: i32 := v724 + 725
+    v726: i32 := v725 + 726
+    v727: i32 := v726 + 727
+    v728: i32 := v727 + 728
+    v729: i32 := v728 + 729
+    v730: i32 := v729 + 730
+    v731: i32 := v730 + 731
+    v732: i32 := v731 + 732
+    v733: i32 := v732 + 733
+    v734: i32 := v733 + 734
+    v735: i32 := v734 + 735
+    v736: i32 := v735 + 736
+    v737: i32 := v736 + 737
+    v738: i32 := v737 + 738
+    v739: i32 := v738 + 739
+    v740: i32 := v739 + 740
+    v741: i32 := v740 + 741
+    v742: i32 := v741 + 742
+    v743: i32 := v742 + 743
+    v744: i32 := v743 + 744
+    v745: i32 := v744 + 745
+    v746: i32 := v745 + 746
+    v747: i32 := v746 + 747
+    v748: i32 := v747 + 748
+    v749: i32 := v748 + 749
+    v750: i32 := v749 + 750
+    v751: i32 := v750 + 751
+    v752: i32 := v751 + 752
+    v753: i32 := v752 + 753
+    v754: i32 := v753 + 754
+    v755: i32 := v754 + 755
+    v756: i32 := v755 + 756
+    v757: i32 := v756 + 757
+    v758: i32 := v757 + 758
+    v759: i32 := v758 + 759
+    v760: i32 := v759 + 760
+    v761: i32 := v760 + 761
+    v762: i32 := v761 + 762
+    v763: i32 := v762 + 763
+    v764: i32 := v763 + 764
+    v765: i32 := v764 + 765
+    v766: i32 := v765 + 766
+    v767: i32 := v766 + 767
+    v768: i32 := v767 + 768
+    v769: i32 := v768 + 769
+    v770: i32 := v769 + 770
+    v771: i32 := v770 + 771
+    v772: i32 := v771 + 772
+    v773: i32 := v772 + 773
+    v774: i32 := v773 + 774
+    v775: i32 := v774 + 775
+    v776: i32 := v775 + 776
+    v777: i32 := v776 + 777
+    v778: i32 := v777 + 778
+    v779: i32 := v778 + 779
+    v780: i32 := v779 + 780
+    v781: i32 := v780 + 781
+    v782: i32 := v781 + 782
+    v783: i32 := v782 + 783
+    v784: i32 := v783 + 784
+    v785: i32 := v784 + 785
+    v786: i32 := v785 + 786
+    v787: i32 := v786 + 787
+    v788: i32 := v787 + 788
+    v789: i32 := v788 + 789
+    v790: i32 := v789 + 790
+    v791: i32 := v790 + 791
+    v792: i32 := v791 + 792
+    v793: i32 := v792 + 793
+    v794: i32 := v793 + 794
+    v795: i32 := v794 + 795
+    v796: i32 := v795 + 796
+    v797: i32 := v796 + 797
+    v798: i32 := v797 + 798
+    v799: i32 := v798 + 799
+    v800: i32 := v799 + 800
+    v801: i32 := v800 + 801
+    v802: i32 := v801 + 802
+    v803: i32 := v802 + 803
+    v804: i32 := v803 + 804
+    v805: i32 := v804 + 805
+    v806: i32 := v805 + 806
+    v807: i32 := v806 + 807
+    v808: i32 := v807 + 808
+    v809: i32 := v808 + 809
+    v810: i32 := v809 + 810
+    v811: i32 := v810 + 811
+    v812: i32 := v811 + 812
+    v813: i32 := v812 + 813
+    v814: i32 := v813 + 814
+    v815: i32 := v814 + 815
+    v816: i32 := v815 + 816
+    v817: i32 := v816 + 817
+    v818: i32 := v817 + 818
+    v819: i32 := v818 + 819
+    v820: i32 := v819 + 820
+    v821: i32 := v820 + 821
+    v822: i32 := v821 + 822
+    v823: i32 := v822 + 823
+    v824: i32 := v823 + 824
+    v825: i32 := v824 + 825
+    v826: i32 := v825 + 826
+    v827: i32 := v826 + 827
+    v828: i32 := v827 + 828
+    v829: i32 := v828 + 829
+    v830: i32 := v829 + 830
+    v831: i32 := v830 + 831
+    v832: i32 := v831 + 832
+    v833: i32 := v832 + 833
+    v834: i32 := v833 + 834
+    v835: i32 := v834 + 835
+    v836: i32 := v835 + 836
+    v837: i32 := v836 + 837
+    v838: i32 := v837 + 838
+    v839: i32 := v838 + 839
+    v840: i32 := v839 + 840
+    v841: i32 := v840 + 841
+    v842: i32 := v841 + 842
+    v843: i32 := v842 + 843
+    v844: i32 := v843 + 844
+    v845: i32 := v844 + 845
+    v846: i32 := v845 + 846
+    v847: i32 := v846 + 847
+    v848: i32 := v847 + 848
+    v849: i32 := v848 + 849
+    v850: i32 := v849 + 850
+    v851: i32 := v850 + 851
+    v852: i32 := v851 + 852
+    v853: i32 := v852 + 853
+    v854: i32 := v853 + 854
+    v855: i32 := v854 + 855
+    v856: i32 := v855 + 856
+    v857: i32 := v856 + 857
+    v858: i32 := v857 + 858
+    v859: i32 := v858 + 859
+    v860: i32 := v859 + 860
+    v861: i32 := v860 + 861
+    v862: i32 := v861 + 862
+    v863: i32 := v862 + 863
+    v864: i32 := v863 + 864
+    v865: i32 := v864 + 865
+    v866: i32 := v865 + 866
+    v867: i32 := v866 + 867
+    v868: i32 := v867 + 868
+    v869: i32 := v868 + 869
+    v870: i32 := v869 + 870
+    v871: i32 := v870 + 871
+    v872: i32 := v871 + 872
+    v873: i32 := v872 + 873
+    v874: i32 := v873 + 874
+    v875: i32 := v874 + 875
+    v876: i32 := v875 + 876
+    v877: i32 := v876 + 877
+    v878: i32 := v877 + 878
+    v879: i32 := v878 + 879
+    v880: i32 := v879 + 880
+    v881: i32 := v880 + 881
+    v882: i32 := v881 + 882
+    v883: i32 := v882 + 883
+    v884: i32 := v883 + 884
+    v885: i32 := v884 + 885
+    v886: i32 := v885 + 886
+    v887: i32 := v886 + 887
+    v888: i32 := v887 + 888
+    v889: i32 := v888 + 889
+    v890: i32 := v889 + 890
+    v891: i32 := v890 + 891
+    v892: i32 := v891 + 892
+    v893: i32 := v892 + 893
+    v894: i32 := v893 + 894
+    v895: i32 := v894 + 895
+    v896: i32 := v895 + 896
+    v897: i32 := v896 + 897
+    v898: i32 := v897 + 898
+    v899: i32 := v898 + 899
+    v900: i32 := v899 + 900
+    v901: i32 := v900 + 901
+    v902: i32 := v901 + 902
+    v903: i32 := v902 + 903
+    v904: i32 := v903 + 904
+    v905: i32 := v904 + 905
+    v906: i32 := v905 + 906
+    v907: i32 := v906 + 907
+    v908: i32 := v907 + 908
+    v909: i32 := v908 + 909
+    v910: i32 := v909 + 910
+    v911: i32 := v910 + 911
+    v912: i32 := v911 + 912
+    v913: i32 := v912 + 913
+    v914: i32 := v913 + 914
+    v915: i32 := v914 + 915
+    v916: i32 := v915 + 916
+    v917: i32 := v916 + 917
+    v918: i32 := v917 + 918
+    v919: i32 := v918 + 919
+    v920: i32 := v919 + 920
+    v921: i32 := v920 + 921
+    v922: i32 := v921 + 922
+    v923: i32 := v922 + 923
+    v924: i32 := v923 + 924
+    v925: i32 := v924 + 925
+    v926: i32 := v925 + 926
+    v927: i32 := v926 + 927
+    v928: i32 := v927 + 928
+    v929: i32 := v928 + 929
+    v930: i32 := v929 + 930
+    v931: i32 := v930 + 931
+    v932: i32 := v931 + 932
+    v933: i32 := v932 + 933
+    v934: i32 := v933 + 934
+    v935: i32 := v934 + 935
+    v936: i32 := v935 + 936
+    v937: i32 := v936 + 937
+    v938: i32 := v937 + 938
+    v939: i32 := v938 + 939
+    v940: i32 := v939 + 940
+    v941: i32 := v940 + 941
+    v942: i32 := v941 + 942
+    v943: i32 := v942 + 943
+    v944: i32 := v943 + 944
+    v945: i32 := v944 + 945
+    v946: i32 := v945 + 946
+    v947: i32 := v946 + 947
+    v948: i32 := v947 + 948
+    v949: i32 := v948 + 949
+    v950: i32 := v949 + 950
+    v951: i32 := v950 + 951
+    v952: i32 := v951 + 952
+    v953: i32 := v952 + 953
+    v954: i32 := v953 + 954
+    v955: i32 := v954 + 955
+    v956: i32 := v955 + 956
+    v957: i32 := v956 + 957
+    v958: i32 := v957 + 958
+    v959: i32 := v958 + 959
+    v960: i32 := v959 + 960
+    v961: i32 := v960 + 961
+    v962: i32 := v961 + 962
+    v963: i32 := v962 + 963
+    v964: i32 := v963 + 964
+    v965: i32 := v964 + 965
+    v966: i32 := v965 + 966
+    v967: i32 := v966 + 967
+    v968: i32 := v967 + 968
+    v969: i32 := v968 + 969
+    v970: i32 := v969 + 970
+    v971: i32 := v970 + 971
+    v972: i32 := v971 + 972
+    v973: i32 := v972 + 973
+    v974: i32 := v973 + 974
+    v975: i32 := v974 + 975
+    v976: i32 := v975 + 976
+    v977: i32 := v976 + 977
+    v978: i32 := v977 + 978
+    v979: i32 := v978 + 979
+    v980: i32 := v979 + 980
+    v981: i32 := v980 + 981
+    v982: i32 := v981 + 982
+    v983: i32 := v982 + 983
+    v984: i32 := v983 + 984
+    v985: i32 := v984 + 985
+    v986: i32 := v985 + 986
+    v987: i32 := v986 + 987
+    v988: i32 := v987 + 988
+    v989: i32 := v988 + 989
+    v990: i32 := v989 + 990
+    v991: i32 := v990 + 991
+    v992: i32 := v991 + 992
+    v993: i32 := v992 + 993
+    v994: i32 := v993 + 994
+    v995: i32 := v994 + 995
+    v996: i32 := v995 + 996
+    v997: i32 := v996 + 997
+    v998: i32 := v997 + 998
+    v999: i32 := v998 + 999
+    v1000: i32 := v999 + 1000
+    v1001: i32 := v1000 + 1001
+    v1002: i32 := v1001 + 1002
+    v1003: i32 := v1002 + 1003
+    v1004: i32 := v1003 + 1004
+    v1005: i32 := v1004 + 1005
+    v1006: i32 := v1005 + 1006
+    v1007: i32 := v1006 + 1007
+    v1008: i32 := v1007 + 1008
+    v1009: i32 := v1008 + 1009
+    v1010: i32 := v1009 + 1010
+    v1011: i32 := v1010 + 1011
+    v1012: i32 := v1011 + 1012
+    v1013: i32 := v1012 + 1013
+    v1014: i32 := v1013 + 1014
+    v1015: i32 := v1014 + 1015
+    v1016: i32 := v1015 + 1016
+    v1017: i32 := v1016 + 1017
+    v1018: i32 := v1017 + 1018
+    v1019: i32 := v1018 + 1019
+    v1020: i32 := v1019 + 1020
+    v1021: i32 := v1020 + 1021
+    v1022: i32 := v1021 + 1022
+    v1023: i32 := v1022 + 1023
+    v1024: i32 := v1023 + 1024
+    v1025: i32 := v1024 + 1025
+    v1026: i32 := v1025 + 1026
+    v1027: i32 := v1026 + 1027
+    v1028: i32 := v1027 + 1028
+    v1029: i32 := v1028 + 1029
+    v1030: i32 := v1029 + 1030
+    v1031: i32 := v1030 + 1031
+    v1032: i32 := v1031 + 1032
+    v1033: i32 := v1032 + 1033
+    v1034: i32 := v1033 + 1034
+    v1035: i32 := v1034 + 1035
+    v1036: i32 := v1035 + 1036
+    v1037: i32 := v1036 + 1037
+    v1038: i32 := v1037 + 1038
+    v1039: i32 := v1038 + 1039
+    v1040: i32 := v1039 + 1040
+    v1041: i32 := v1040 + 1041
+    v1042: i32 := v1041 + 1042
+    v1043: i32 := v1042 + 1043
+    v1044: i32 := v1043 + 1044
+    v1045: i32 := v1044 + 1045
+    v1046: i32 := v1045 + 1046
+    v1047: i32 := v1046 + 1047
+    v1048: i32 := v1047 + 1048
+    v1049: i32 := v1048 + 1049
+    v1050: i32 := v1049 + 1050
+    v1051: i32 := v1050 + 1051
+    v1052: i32 := v1051 + 1052
+    v1053: i32 := v1052 + 1053
+    v1054: i32 := v1053 + 1054
+    v1055: i32 := v1054 + 1055
+    v1056: i32 := v1055 + 1056
+    v1057: i32 := v1056 + 1057
+    v1058: i32 := v1057 + 1058
+    v1059: i32 := v1058 + 1059
+    v1060: i32 := v1059 + 1060
+    v1061: i32 := v1060 + 1061
+    v1062: i32 := v1061 + 1062
+    v1063: i32 := v1062 + 1063
+    v1064: i32 := v1063 + 1064
+    v1065: i32 := v1064 + 1065
+    v1066: i32 := v1065 + 1066
+    v1067: i32 := v1066 + 1067
+    v1068: i32 := v1067 + 1068
+    v1069: i32 := v1068 + 1069
+    v1070: i32 := v1069 + 1070
+    v1071: i32 := v1070 + 1071
+    v1072: i32 := v1071 + 1072
+    v1073: i32 := v1072 + 1073
+    v1074: i32 := v1073 + 1074
+    v1075: i32 := v1074 + 1075
+    v1076: i32 := v1075 + 1076
+    v1077: i32 := v1076 + 1077
+    v1078: i32 := v1077 + 1078
+    v1079: i32 := v1078 + 1079
+    v1080: i32 := v1079 + 1080
+    v1081: i32 := v1080 + 1081
+    v1082: i32 := v1081 + 1082
+    v1083: i32 := v1082 + 1083
+    v1084: i32 := v1083 + 1084
+    v1085: i32 := v1084 + 1085
+    v1086: i32 := v1085 + 1086
+    v1087: i32 := v1086 + 1087
+    v1088: i32 := v1087 + 1088
+    v1089: i32 := v1088 + 1089
+    v1090: i32 := v1089 + 1090
+    v1091: i32 := v1090 + 1091
+    v1092: i32 := v1091 + 1092
+    v1093: i32 := v1092 + 1093
+    v1094: i32 := v1093 + 1094
+    v1095: i32 := v1094 + 1095
+    v1096: i32 := v1095 + 1096
+    v1097: i32 := v1096 + 1097
+    v1098: i32 := v1097 + 1098
+    v1099: i32 := v1098 + 1099
+    v1100: i32 := v1099 + 1100
+    v1101: i32 := v1100 + 1101
+    v1102: i32 := v1101 + 1102
+    v1103: i32 := v1102 + 1103
+    v1104: i32 := v1103 + 1104
+    v1105: i32 := v1104 + 1105
+    v1106: i32 := v1105 + 1106
+    v1107: i32 := v1106 + 1107
+    v1108: i32 := v1107 + 1108
+    v1109: i32 := v1108 + 1109
+    v1110: i32 := v1109 + 1110
+    v1111: i32 := v1110 + 1111
+    v1112: i32 := v1111 + 1112
+    v1113: i32 := v1112 + 1113
+    v1114: i32 := v1113 + 1114
+    v1115: i32 := v1114 + 1115
+    v1116: i32 := v1115 + 1116
+    v1117: i32 := v1116 + 1117
+    v1118: i32 := v1117 + 1118
+    v1119: i32 := v1118 + 1119
+    v1120: i32 := v1119 + 1120
+    v1121: i32 := v1120 + 1121
+    v1122: i32 := v1121 + 1122
+    v1123: i32 := v1122 + 1123
+    v1124: i32 := v1123 + 1124
+    v1125: i32 := v1124 + 1125
+    v1126: i32 := v1125 + 1126
+    v1127: i32 := v1126 + 1127
+    v1128: i32 := v1127 + 1128
+    v1129: i32 := v1128 + 1129
+    v1130: i32 := v1129 + 1130
+    v1131: i32 := v1130 + 1131
+    v1132: i32 := v1131 + 1132
+    v1133: i32 := v1132 + 1133
+    v1134: i32 := v1133 + 1134
+    v1135: i32 := v1134 + 1135
+    v1136: i32 := v1135 + 1136
+    v1137: i32 := v1136 + 1137
+    v1138: i32 := v1137 + 1138
+    v1139: i32 := v1138 + 1139
+    v1140: i32 := v1139 + 1140
+    v1141: i32 := v1140 + 1141
+    v1142: i32 := v1141 + 1142
+    v1143: i32 := v1142 + 1143
+    v1144: i32 := v1143 + 1144
+    v1145: i32 := v1144 + 1145
+    v1146: i32 := v1145 + 1146
+    v1147: i32 := v1146 + 1147
+    v1148: i32 := v1147 + 1148
+    v1149: i32 := v1148 + 1149
+    v1150: i32 := v1149 + 1150
+    v1151: i32 := v1150 + 1151
+    v1152: i32 := v1151 + 1152
+    v1153: i32 := v1152 + 1153
+    v1154: i32 := v1153 + 1154
+    v1155: i32 := v1154 + 1155
+    v1156: i32 := v1155 + 1156
+    v1157: i32 := v1156 + 1157
+    v1158: i32 := v1157 + 1158
+    v1159: i32 := v1158 + 1159
+    v1160: i32 := v1159 + 1160
+    v1161: i32 := v1160 + 1161
+    v1162: i32 := v1161 + 1162
+    v1163: i32 := v1162 + 1163
+    v1164: i32 := v1163 + 1164
+    v1165: i32 := v1164 + 1165
+    v1166: i32 := v1165 + 1166
+    v1167: i32 := v1166 + 1167
+    v1168: i32 := v1167 + 1168
+    v1169: i32 := v1168 + 1169
+    v1170: i32 := v1169 + 1170
+    v1171: i32 := v1170 + 1171
+    v1172: i32 := v1171 + 1172
+    v1173: i32 := v1172 + 1173
+    v1174: i32 := v1173 + 1174
+    v1175: i32 := v1174 + 1175
+    v1176: i32 := v1175 + 1176
+    v1177: i32 := v1176 + 1177
+    v1178: i32 := v1177 + 1178
+    v1179: i32 := v1178 + 1179
+    v1180: i32 := v1179 + 1180
+    v1181: i32 := v1180 + 1181
+    v1182: i32 := v1181 + 1182
+    v1183: i32 := v1182 + 1183
+    v1184: i32 := v1183 + 1184
+    v1185: i32 := v1184 + 1185
+    v1186: i32 := v1185 + 1186
+    v1187: i32 := v1186 + 1187
+    v1188: i32 := v1187 + 1188
+    v1189: i32 := v1188 + 1189
+    v1190: i32 := v1189 + 1190
+    v1191: i32 := v1190 + 1191
+    v1192: i32 := v1191 + 1192
+    v1193: i32 := v1192 + 1193
+    v1194: i32 := v1193 + 1194
+    v1195: i32 := v1194 + 1195
+    v1196: i32 := v1195 + 1196
+    v1197: i32 := v1196 + 1197
+    v1198: i32 := v1197 + 1198
+    v1199: i32 := v1198 + 1199
+    v1200: i32 := v1199 + 1200
+    v1201: i32 := v1200 + 1201
+    v1202: i32 := v1201 + 1202
+    v1203: i32 := v1202 + 1203
+    v1204: i32 := v1203 + 1204
+    v1205: i32 := v1204 + 1205
+    v1206: i32 := v1205 + 1206
+    v1207: i32 := v1206 + 1207
+    v1208: i32 := v1207 + 1208
+    v1209: i32 := v1208 + 1209
+    v1210: i32 := v1209 + 1210
+    v1211: i32 := v1210 + 1211
+    v1212: i32 := v1211 + 1212
+    v1213: i32 := v1212 + 1213
+    v1214: i32 := v1213 + 1214
+    v1215: i32 := v1214 + 1215
+    v1216: i32 := v1215 + 1216
+    v1217: i32 := v1216 + 1217
+    v1218: i32 := v1217 + 1218
+    v1219: i32 := v1218 + 1219
+    v1220: i32 := v1219 + 1220
+    v1221: i32 := v1220 + 1221
+    v1222: i32 := v1221 + 1222
+    v1223: i32 := v1222 + 1223
+    v1224: i32 := v1223 + 1224
+    v1225: i32 := v1224 + 1225
+    v1226: i32 := v1225 + 1226
+    v1227: i32 := v1226 + 1227
+    v1228: i32 := v1227 + 1228
+    v1229: i32 := v1228 + 1229
+    v1230: i32 := v1229 + 1230
+    v1231: i32 := v1230 + 1231
+    v1232: i32 := v1231 + 1232
+    v1233: i32 := v1232 + 1233
+    v1234: i32 := v1233 + 1234
+    v1235: i32 := v1234 + 1235
+    v1236: i32 := v1235 + 1236
+    v1237: i32 := v1236 + 1237
+    v1238: i32 := v1237 + 1238
+    v1239: i32 := v1238 + 1239
+    v1240: i32 := v1239 + 1240
+    v1241: i32 := v1240 + 1241
+    v1242: i32 := v1241 + 1242
+    v1243: i32 := v1242 + 1243
+    v1244: i32 := v1243 + 1244
+    v1245: i32 := v1244 + 1245
+    v1246: i32 := v1245 + 1246
+    v1247: i32 := v1246 + 1247
+    v1248: i32 := v1247 + 1248
+    v1249: i32 := v1248 + 1249
+    v1250: i32 := v1249 + 1250
+    v1251: i32 := v1250 + 1251
+    v1252: i32 := v1251 + 1252
+    v1253: i32 := v1252 + 1253
+    v1254: i32 := v1253 + 1254
+    v1255: i32 := v1254 + 1255
+    v1256: i32 := v1255 + 1256
+    v1257: i32 := v1256 + 1257
+    v1258: i32 := v1257 + 1258
+    v1259: i32 := v1258 + 1259
+    v1260: i32 := v1259 + 1260
+    v1261: i32 := v1260 + 1261
+    v1262: i32 := v1261 + 1262
+    v1263: i32 := v1262 + 1263
+    v1264: i32 := v1263 + 1264
+    v1265: i32 := v1264 + 1265
+    v1266: i32 := v1265 + 1266
+    v1267: i32 := v1266 + 1267
+    v1268: i32 := v1267 + 1268
+    v1269: i32 := v1268 + 1269
+    v1270: i32 := v1269 + 1270
+    v1271: i32 := v1270 + 1271
+    v1272: i32 := v1271 + 1272
+    v1273: i32 := v1272 + 1273
+    v1274: i32 := v1273 + 1274
+    v1275: i32 := v1274 + 1275
+    v1276: i32 := v1275 + 1276
+    v1277: i32 := v1276 + 1277
+    v1278: i32 := v1277 + 1278
+    v1279: i32 := v1278 + 1279
+    v1280: i32 := v1279 + 1280
+    v1281: i32 := v1280 + 1281
+    v1282: i32 := v1281 + 1282
+    v1283: i32 := v1282 + 1283
+    v1284: i32 := v1283 + 1284
+    v1285: i32 := v1284 + 1285
+    v1286: i32 := v1285 + 1286
+    v1287: i32 := v1286 + 1287
+    v1288: i32 := v1287 + 1288
+    v1289: i32 := v1288 + 1289
+    v1290: i32 := v1289 + 1290
+    v1291: i32 := v1290 + 1291
+    v1292: i32 := v1291 + 1292
+    v1293: i32 := v1292 + 1293
+    v1294: i32 := v1293 + 1294
+    v1295: i32 := v1294 + 1295
+    v1296: i32 := v1295 + 1296
+    v1297: i32 := v1296 + 1297
+    v1298: i32 := v1297 + 1298
+    v1299: i32 := v1298 + 1299
+    v1300: i32 := v1299 + 1300
+    v1301: i32 := v1300 + 1301
+    v1302: i32 := v1301 + 1302
+    v1303: i32 := v1302 + 1303
+    v1304: i32 := v1303 + 1304
+    v1305: i32 := v1304 + 1305
+    v1306: i32 := v1305 + 1306
+    v1307: i32 := v1306 + 1307
+    v1308: i32 := v1307 + 1308
+    v1309: i32 := v1308 + 1309
+    v1310: i32 := v1309 + 1310
+    v1311: i32 := v1310 + 1311
+    v1312: i32 := v1311 + 1312
+    v1313: i32 := v1312 + 1313
+    v1314: i32 := v1313 + 1314
+    v1315: i32 := v1314 + 1315
+    v1316: i32 := v1315 + 1316
+    v1317: i32 := v1316 + 1317
+    v1318: i32 := v1317 + 1318
+    v1319: i32 := v1318 + 1319
+    v1320: i32 := v1319 + 1320
+    v1321: i32 := v1320 + 1321
+    v1322: i32 := v1321 + 1322
+    v1323: i32 := v1322 + 1323
+    v1324: i32 := v1323 + 1324
+    v1325: i32 := v1324 + 1325
+    v1326: i32 := v1325 + 1326
+    v1327: i32 := v1326 + 1327
+    v1328: i32 := v1327 + 1328
+    v1329: i32 := v1328 + 1329
+    v1330: i32 := v1329 + 1330
+    v1331: i32 := v1330 + 1331
+    v1332: i32 := v1331 + 1332
+    v1333: i32 := v1332 + 1333
+    v1334: i32 := v1333 + 1334
+    v1335: i32 := v1334 + 1335
+    v1336: i32 := v1335 + 1336
+    v1337: i32 := v1336 + 1337
+    v1338: i32 := v1337 + 1338
+    v1339: i32 := v1338 + 1339
+    v1340: i32 := v1339 + 1340
+    v1341: i32 := v1340 + 1341
+    v1342: i32 := v1341 + 1342
+    v1343: i32 := v1342 + 1343
+    v1344: i32 := v1343 + 1344
+    v1345: i32 := v1344 + 1345
+    v1346: i32 := v1345 + 1346
+    v1347: i32 := v1346 + 1347
+    v1348: i32 := v1347 + 1348
+    v1349: i32 := v1348 + 1349
+    v1350: i32 := v1349 + 1350
+    v1351: i32 := v1350 + 1351
+    v1352: i32 := v1351 + 1352
+    v1353: i32 := v1352 + 1353
+    v1354: i32 := v1353 + 1354
+    v1355: i32 := v1354 + 1355
+    v1356: i32 := v1355 + 1356
+    v1357: i32 := v1356 + 1357
+    v1358: i32 := v1357 + 1358
+    v1359: i32 := v1358 + 1359
+    v1360: i32 := v1359 + 1360
+    v1361: i32 := v1360 + 1361
+    v1362: i32 := v1361 + 1362
+    v1363: i32 := v1362 + 1363
+    v1364: i32 := v1363 + 1364
+    v1365: i32 := v1364 + 1365
+    v1366: i32 := v1365 + 1366
+    v1367: i32 := v1366 + 1367
+    v1368: i32 := v1367 + 1368
+    v1369: i32 := v1368 + 1369
+    v1370: i32 := v1369 + 1370
+    v1371: i32 := v1370 + 1371
+    v1372: i32 := v1371 + 1372
+    v1373: i32 := v1372 + 1373
+    v1374: i32 := v1373 + 1374
+    v1375: i32 := v1374 + 1375
+    v1376: i32 := v1375 + 1376
+    v1377: i32 := v1376 + 1377
+    v1378: i32 := v1377 + 1378
+    v1379: i32 := v1378 + 1379
+    v1380: i32 := v1379 + 1380
+    v1381: i32 := v1380 + 1381
+    v1382: i32 := v1381 + 1382
+    v1383: i32 := v1382 + 1383
+    v1384: i32 := v1383 + 1384
+    v1385: i32 := v1384 + 1385
+    v1386: i32 := v1385 + 1386
+    v1387: i32 := v1386 + 1387
+    v1388: i32 := v1387 + 1388
+    v1389: i32 := v1388 + 1389
+    v1390: i32 := v1389 + 1390
+    v1391: i32 := v1390 + 1391
+    v1392: i32 := v1391 + 1392
+    v1393: i32 := v1392 + 1393
+    v1394: i32 := v1393 + 1394
+    v1395: i32 := v1394 + 1395
+    v1396: i32 := v1395 + 1396
+    v1397: i32 := v1396 + 1397
+    v1398: i32 := v1397 + 1398
+    v1399: i32 := v1398 + 1399
+    v1400: i32 := v1399 + 1400
+    v1401: i32 := v1400 + 1401
+    v1402: i32 := v1401 + 1402
+    v1403: i32 := v1402 + 1403
+    v1404: i32 := v1403 + 1404
+    v1405: i32 := v1404 + 1405
+    v1406: i32 := v1405 + 1406
+    v1407: i32 := v1406 + 1407
+    v1408: i32 := v1407 + 1408
+    v1409: i32 := v1408 + 1409
+    v1410: i32 := v1409 + 1410
+    v1411: i32 := v1410 + 1411
+    v1412: i32 := v1411 + 1412
+    v1413: i32 := v1412 + 1413
+    v1414: i32 := v1413 + 1414
+    v1415: i32 := v1414 + 1415
+    v1416: i32 := v1415 + 1416
+    v1417: i32 := v1416 + 1417
+    v1418: i32 := v1417 + 1418
+    v1419: i32 := v1418 + 1419
+    v1420: i32 := v1419 + 1420
+    v1421: i32 := v1420 + 1421
+    v1422: i32 := v1421 + 1422
+    v1423: i32 := v1422 + 1423
+    v1424: i32 := v1423 + 1424
+    v1425: i32 := v1424 + 1425
+    v1426: i32 := v1425 + 1426
+    v1427: i32 := v1426 + 1427
+    v1428: i32 := v1427 + 1428
+    v1429: i32 := v1428 + 1429
+    v1430: i32 := v1429 + 1430
+    v1431: i32 := v1430 + 1431
+    v1432: i32 := v1431 + 1432
+    v1433: i32 := v1432 + 1433
+    v1434: i32 := v1433 + 1434
+    v1435: i32 := v1434 + 1435
+    v1436: i32 := v1435 + 1436
+    v1437: i32 := v1436 + 1437
+    v1438: i32 := v1437 + 1438
+    v1439: i32 := v1438 + 1439
+    v1440: i32 := v1439 + 1440
+    v1441: i32 := v1440 + 1441
+    v1442: i32 := v1441 + 1442
+    v1443: i32 := v1442 + 1443
+    v1444: i32 := v1443 + 1444
+    v1445: i32 := v1444 + 1445
+    v1446: i32 := v1445 + 1446
+    v1447: i32 := v1446 + 1447
+    v1448: i32 := v1447 + 1448
+    v1449: i32 := v1448 + 1449
+    v1450: i32 := v1449 + 1450
+    v1451: i32 := v1450 + 1451
+    v1452: i32 := v1451 + 1452
+    v1453: i32 := v1452 + 1453
+    v1454: i32 := v1453 + 1454
+    v1455: i32 := v1454 + 1455
+    v1456: i32 := v1455 + 1456
+    v1457: i32 := v1456 + 1457
+    v1458: i32 := v1457 + 1458
+    v1459: i32 := v1458 + 1459
+    v1460: i32 := v1459 + 1460
+    v1461: i32 := v1460 + 1461
+    v1462: i32 := v1461 + 1462
+    v1463: i32 := v1462 + 1463
+    v1464: i32 := v1463 + 1464
+    v1465: i32 := v1464 + 1465
+    v1466: i32 := v1465 + 1466
+    v1467: i32 := v1466 + 1467
+    v1468: i32 := v1467 + 1468
+    v1469: i32 := v1468 + 1469
+    v1470: i32 := v1469 + 1470
+    v1471: i32 := v1470 + 1471
+    v1472: i32 := v1471 + 1472
+    v1473: i32 := v1472 + 1473
+    v1474: i32 := v1473 + 1474
+    v1475: i32 := v1474 + 1475
+    v1476: i32 := v1475 + 1476
+    v1477: i32 := v1476 + 1477
+    v1478: i32 := v1477 + 1478
+    v1479: i32 := v1478 + 1479
+    v1480: i32 := v1479 + 1480
+    v1481: i32 := v1480 + 1481
+    v1482: i32 := v1481 + 1482
+    v1483: i32 := v1482 + 1483
+    v1484: i32 := v1483 + 1484
+    v1485: i32 := v1484 + 1485
+    v1486: i32 := v1485 + 1486
+    v1487: i32 := v1486 + 1487
+    v1488: i32 := v1487 + 1488
+    v1489: i32 := v1488 + 1489
+    v1490: i32 := v1489 + 1490
+    v1491: i32 := v1490 + 1491
+    v1492: i32 := v1491 + 1492
+    v1493: i32 := v1492 + 1493
+    v1494: i32 := v1493 + 1494
+    v1495: i32 := v1494 + 1495
+    v1496: i32 := v1495 + 1496
+    v1497: i32 := v1496 + 1497
+    v1498: i32 := v1497 + 1498
+    v1499: i32 := v1498 + 1499
+    v1500: i32 := v1499 + 1500
+    v1501: i32 := v1500 + 1501
+    v1502: i32 := v1501 + 1502
+    v1503: i32 := v1502 + 1503
+    v1504: i32 := v1503 + 1504
+    v1505: i32 := v1504 + 1505
+    v1506: i32 := v1505 + 1506
+    v1507: i32 := v1506 + 1507
+    v1508: i32 := v1507 + 1508
+    v1509: i32 := v1508 + 1509
+    v1510: i32 := v1509 + 1510
+    v1511: i32 := v1510 + 1511
+    v1512: i32 := v1511 + 1512
+    v1513: i32 := v1512 + 1513
+    v1514: i32 := v1513 + 1514
+    v1515: i32 := v1514 + 1515
+    v1516: i32 := v1515 + 1516
+    v1517: i32 := v1516 + 1517
+    v1518: i32 := v1517 + 1518
+    v1519: i32 := v1518 + 1519
+    v1520: i32 := v1519 + 1520
+    v1521: i32 := v1520 + 1521
+    v1522: i32 := v1521 + 1522
+    v1523: i32 := v1522 + 1523
+    v1524: i32 := v1523 + 1524
+    v1525: i32 := v1524 + 1525
+    v1526: i32 := v1525 + 1526
+    v1527: i32 := v1526 + 1527
+    v1528: i32 := v1527 + 1528
+    v1529: i32 := v1528 + 1529
+    v1530: i32 := v1529 + 1530
+    v1531: i32 := v1530 + 1531
+    v1532: i32 := v1531 + 1532
+    v1533: i32 := v1532 + 1533
+    v1534: i32 := v1533 + 1534
+    v1535: i32 := v1534 + 1535
+    v1536: i32 := v1535 + 1536
+    v1537: i32 := v1536 + 1537
+    v1538: i32 := v1537 + 1538
+    v1539: i32 := v1538 + 1539
+    v1540: i32 := v1539 + 1540
+    v1541: i32 := v1540 + 1541
+    v1542: i32 := v1541 + 1542
+    v1543: i32 := v1542 + 1543
+    v1544: i32 := v1543 + 1544
+    v1545: i32 := v1544 + 1545
+    v1546: i32 := v1545 + 1546
+    v1547: i32 := v1546 + 1547
+    v1548: i32 := v1547 + 1548
+    v1549: i32 := v1548 + 1549
+    v1550: i32 := v1549 + 1550
+    v1551: i32 := v1550 + 1551
+    v1552: i32 := v1551 + 1552
+    v1553: i32 := v1552 + 1553
+    v1554: i32 := v1553 + 1554
+    v1555: i32 := v1554 + 1555
+    v1556: i32 := v1555 + 1556
+    v1557: i32 := v1556 + 1557
+    v1558: i32 := v1557 + 1558
+    v1559: i32 := v1558 + 1559
+    v1560: i32 := v1559 + 1560
+    v1561: i32 := v1560 + 1561
+    v1562: i32 := v1561 + 1562
+    v1563: i32 := v1562 + 1563
+    v1564: i32 := v1563 + 1564
+    v1565: i32 := v1564 + 1565
+    v1566: i32 := v1565 + 1566
+    v1567: i32 := v1566 + 1567
+    v1568: i32 := v1567 + 1568
+    v1569: i32 := v1568 + 1569
+    v1570: i32 := v1569 + 1570
+    v1571: i32 := v1570 + 1571
+    v1572: i32 := v1571 + 1572
+    v1573: i32 := v1572 + 1573
+    v1574: i32 := v1573 + 1574
+    v1575: i32 := v1574 + 1575
+    v1576: i32 := v1575 + 1576
+    v1577: i32 := v1576 + 1577
+    v1578: i32 := v1577 + 1578
+    v1579: i32 := v1578 + 1579
+    v1580: i32 := v1579 + 1580
+    v1581: i32 := v1580 + 1581
+    v1582: i32 := v1581 + 1582
+    v1583: i32 := v1582 + 1583
+    v1584: i32 := v1583 + 1584
+    v1585: i32 := v1584 + 1585
+    v1586: i32 := v1585 + 1586
+    v1587: i32 := v1586 + 1587
+    v1588: i32 := v1587 + 1588
+    v1589: i32 := v1588 + 1589
+    v1590: i32 := v1589 + 1590
+    v1591: i32 := v1590 + 1591
+    v1592: i32 := v1591 + 1592
+    v1593: i32 := v1592 + 1593
+    v1594: i32 := v1593 + 1594
+    v1595: i32 := v1594 + 1595
+    v1596: i32 := v1595 + 1596
+    v1597: i32 := v1596 + 1597
+    v1598: i32 := v1597 + 1598
+    v1599: i32 := v1598 + 1599
+    v1600: i32 := v1599 + 1600
+    v1601: i32 := v1600 + 1601
+    v1602: i32 := v1601 + 1602
+    v1603: i32 := v1602 + 1603
+    v1604: i32 := v1603 + 1604
+    v1605: i32 := v1604 + 1605
+    v1606: i32 := v1605 + 1606
+    v1607: i32 := v1606 + 1607
+    v1608: i32 := v1607 + 1608
+    v1609: i32 := v1608 + 1609
+    v1610: i32 := v1609 + 1610
+    v1611: i32 := v1610 + 1611
+    v1612: i32 := v1611 + 1612
+    v1613: i32 := v1612 + 1613
+    v1614: i32 := v1613 + 1614
+    v1615: i32 := v1614 + 1615
+    v1616: i32 := v1615 + 1616
+    v1617: i32 := v1616 + 1617
+    v1618: i32 := v1617 + 1618
+    v1619: i32 := v1618 + 1619
+    v1620: i32 := v1619 + 1620
+    v1621: i32 := v1620 + 1621
+    v1622: i32 := v1621 + 1622
+    v1623: i32 := v1622 + 1623
+    v1624: i32 := v1623 + 1624
+    v1625: i32 := v1624 + 1625
+    v1626: i32 := v1625 + 1626
+    v1627: i32 := v1626 + 1627
+    v1628: i32 := v1627 + 1628
+    v1629: i32 := v1628 + 1629
+    v1630: i32 := v1629 + 1630
+    v1631: i32 := v1630 + 1631
+    v1632: i32 := v1631 + 1632
+    v1633: i32 := v1632 + 1633
+    v1634: i32 := v1633 + 1634
+    v1635: i32 := v1634 + 1635
+    v1636: i32 := v1635 + 1636
+    v1637: i32 := v1636 + 1637
+    v1638: i32 := v1637 + 1638
+    v1639: i32 := v1638 + 1639
+    v1640: i32 := v1639 + 1640
+    v1641: i32 := v1640 + 1641
+    v1642: i32 := v1641 + 1642
+    v1643: i32 := v1642 + 1643
+    v1644: i32 := v1643 + 1644
+    v1645: i32 := v1644 + 1645
+    v1646: i32 := v1645 + 1646
+    v1647: i32 := v1646 + 1647
+    v1648: i32 := v1647 + 1648
+    v1649: i32 := v1648 + 1649
+    v1650: i32 := v1649 + 1650
+    v1651: i32 := v1650 + 1651
+    v1652: i32 := v1651 + 1652
+    v1653: i32 := v1652 + 1653
+    v1654: i32 := v1653 + 1654
+    v1655: i32 := v1654 + 1655
+    v1656: i32 := v1655 + 1656
+    v1657: i32 := v1656 + 1657
+    v1658: i32 := v1657 + 1658
+    v1659: i32 := v1658 + 1659
+    v1660: i32 := v1659 + 1660
+    v1661: i32 := v1660 + 1661
+    v1662: i32 := v1661 + 1662
+    v1663: i32 := v1662 + 1663
+    v1664: i32 := v1663 + 1664
+    v1665: i32 := v1664 + 1665
+    v1666: i32 := v1665 + 1666
+    v1667: i32 := v1666 + 1667
+    v1668: i32 := v1667 + 1668
+    v1669: i32 := v1668 + 1669
+    v1670: i32 := v1669 + 1670
+    v1671: i32 := v1670 + 1671
+    v1672: i32 := v1671 + 1672
+    v1673: i32 := v1672 + 1673
+    v1674: i32 := v1673 + 1674
+    v1675: i32 := v1674 + 1675
+    v1676: i32 := v1675 + 1676
+    v1677: i32 := v1676 + 1677
+    v1678: i32 := v1677 + 1678
+    v1679: i32 := v1678 + 1679
+    v1680: i32 := v1679 + 1680
+    v1681: i32 := v1680 + 1681
+    v1682: i32 := v1681 + 1682
+    v1683: i32 := v1682 + 1683
+    v1684: i32 := v1683 + 1684
+    v1685: i32 := v1684 + 1685
+    v1686: i32 := v1685 + 1686
+    v1687: i32 := v1686 + 1687
+    v1688: i32 := v1687 + 1688
+    v1689: i32 := v1688 + 1689
+    v1690: i32 := v1689 + 1690
+    v1691: i32 := v1690 + 1691
+    v1692: i32 := v1691 + 1692
+    v1693: i32 := v1692 + 1693
+    v1694: i32 := v1693 + 1694
+    v1695: i32 := v1694 + 1695
+    v1696: i32 := v1695 + 1696
+    v1697: i32 := v1696 + 1697
+    v1698: i32 := v1697 + 1698
+    v1699: i32 := v1698 + 1699
+    v1700: i32 := v1699 + 1700
+    v1701: i32 := v1700 + 1701
+    v1702: i32 := v1701 + 1702
+    v1703: i32 := v1702 + 1703
+    v1704: i32 := v1703 + 1704
+    v1705: i32 := v1704 + 1705
+    v1706: i32 := v1705 + 1706
+    v1707: i32 := v1706 + 1707
+    v1708: i32 := v1707 + 1708
+    v1709: i32 := v1708 + 1709
+    v1710: i32 := v1709 + 1710
+    v1711: i32 := v1710 + 1711
+    v1712: i32 := v1711 + 1712
+    v1713: i32 := v1712 + 1713
+    v1714: i32 := v1713 + 1714
+    v1715: i32 := v1714 + 1715
+    v1716: i32 := v1715 + 1716
+    v1717: i32 := v1716 + 1717
+    v1718: i32 := v1717 + 1718
+    v1719: i32 := v1718 + 1719
+    v1720: i32 := v1719 + 1720
+    v1721: i32 := v1720 + 1721
+    v1722: i32 := v1721 + 1722
+    v1723: i32 := v1722 + 1723
+    v1724: i32 := v1723 + 1724
+    v1725: i32 := v1724 + 1725
+    v1726: i32 := v1725 + 1726
+    v1727: i32 := v1726 + 1727
+    v1728: i32 := v1727 + 1728
+    v1729: i32 := v1728 + 1729
+    v1730: i32 := v1729 + 1730
+    v1731: i32 := v1730 + 1731
+    v1732: i32 := v1731 + 1732
+    v1733: i32 := v1732 + 1733
+    v1734: i32 := v1733 + 1734
+    v1735: i32 := v1734 + 1735
+    v1736: i32 := v1735 + 1736
+    v1737: i32 := v1736 + 1737
+    v1738: i32 := v1737 + 1738
+    v1739: i32 := v1738 + 1739
+    v1740: i32 := v1739 + 1740
+    v1741: i32 := v1740 + 1741
+    v1742: i32 := v1741 + 1742
+    v1743: i32 := v1742 + 1743
+    v1744: i32 := v1743 + 1744
+    v1745: i32 := v1744 + 1745
+    v1746: i32 := v1745 + 1746
+    v1747: i32 := v1746 + 1747
+    v1748: i32 := v1747 + 1748
+    v1749: i32 := v1748 + 1749
+    v1750: i32 := v1749 + 1750
+    v1751: i32 := v1750 + 1751
+    v1752: i32 := v1751 + 1752
+    v1753: i32 := v1752 + 1753
+    v1754: i32 := v1753 + 1754
+    v1755: i32 := v1754 + 1755
+    v1756: i32 := v1755 + 1756
+    v1757: i32 := v1756 + 1757
+    v1758: i32 := v1757 + 1758
+    v1759: i32 := v1758 + 1759
+    v1760: i32 := v1759 + 1760
+    v1761: i32 := v1760 + 1761
+    v1762: i32 := v1761 + 1762
+    v1763: i32 := v1762 + 1763
+    v1764: i32 := v1763 + 1764
+    v1765: i32 := v1764 + 1765
+    v1766: i32 := v1765 + 1766
+    v1767: i32 := v1766 + 1767
+    v1768: i32 := v1767 + 1768
+    v1769: i32 := v1768 + 1769
+    v1770: i32 := v1769 + 1770
+    v1771: i32 := v1770 + 1771
+    v1772: i32 := v1771 + 1772
+    v1773: i32 := v1772 + 1773
+    v1774: i32 := v1773 + 1774
+    v1775: i32 := v1774 + 1775
+    v1776: i32 := v1775 + 1776
+    v1777: i32 := v1776 + 1777
+    v1778: i32 := v1777 + 1778
+    v1779: i32 := v1778 + 1779
+    v1780: i32 := v1779 + 1780
+    v1781: i32 := v1780 + 1781
+    v1782: i32 := v1781 + 1782
+    v1783: i32 := v1782 + 1783
+    v1784: i32 := v1783 + 1784
+    v1785: i32 := v1784 + 1785
+    v1786: i32 := v1785 + 1786
+    v1787: i32 := v1786 + 1787
+    v1788: i32 := v1787 + 1788
+    v1789: i32 := v1788 + 1789
+    v1790: i32 := v1789 + 1790
+    v1791: i32 := v1790 + 1791
+    v1792: i32 := v1791 + 1792
+    v1793: i32 := v1792 + 1793
+    v1794: i32 := v1793 + 1794
+    v1795: i32 := v1794 + 1795
+    v1796: i32 := v1795 + 1796
+    v1797: i32 := v1796 + 1797
+    v1798: i32 := v1797 + 1798
+    v1799: i32 := v1798 + 1799
+    v1800: i32 := v1799 + 1800
+    v1801: i32 := v1800 + 1801
+    v1802: i32 := v1801 + 1802
+    v1803: i32 := v1802 + 1803
+    v1804: i32 := v1803 + 1804
+    v1805: i32 := v1804 + 1805
+    v1806: i32 := v1805 + 1806
+    v1807: i32 := v1806 + 1807
+    v1808: i32 := v1807 + 1808
+    v1809: i32 := v1808 + 1809
+    v1810: i32 := v1809 + 1810
+    v1811: i32 := v1810 + 1811
+    v1812: i32 := v1811 + 1812
+    v1813: i32 := v1812 + 1813
+    v1814: i32 := v1813 + 1814
+    v1815: i32 := v1814 + 1815
+    v1816: i32 := v1815 + 1816
+    v1817: i32 := v1816 + 1817
+    v1818: i32 := v1817 + 1818
+    v1819: i32 := v1818 + 1819
+    v1820: i32 := v1819 + 1820
+    v1821: i32 := v1820 + 1821
+    v1822: i32 := v1821 + 1822
+    v1823: i32 := v1822 + 1823
+    v1824: i32 := v1823 + 1824
+    v1825: i32 := v1824 + 1825
+    v1826: i32 := v1825 + 1826
+    v1827: i32 := v1826 + 1827
+    v1828: i32 := v1827 + 1828
+    v1829: i32 := v1828 + 1829
+    v1830: i32 := v1829 + 1830
+    v1831: i32 := v1830 + 1831
+    v1832: i32 := v1831 + 1832
+    v1833: i32 := v1832 + 1833
+    v1834: i32 := v1833 + 1834
+    v1835: i32 := v1834 + 1835
+    v1836: i32 := v1835 + 1836
+    v1837: i32 := v1836 + 1837
+    v1838: i32 := v1837 + 1838
+    v1839: i32 := v1838 + 1839
+    v1840: i32 := v1839 + 1840
+    v1841: i32 := v1840 + 1841
+    v1842: i32 := v1841 + 1842
+    v1843: i32 := v1842 + 1843
+    v1844: i32 := v1843 + 1844
+    v1845: i32 := v1844 + 1845
+    v1846: i32 := v1845 + 1846
+    v1847: i32 := v1846 + 1847
+    v1848: i32 := v1847 + 1848
+    v1849: i32 := v1848 + 1849
+    v1850: i32 := v1849 + 1850
+    v1851: i32 := v1850 + 1851
+    v1852: i32 := v1851 + 1852
+    v1853: i32 := v1852 + 1853
+    v1854: i32 := v1853 + 1854
+    v1855: i32 := v1854 + 1855
+    v1856: i32 := v1855 + 1856
+    v1857: i32 := v1856 + 1857
+    v1858: i32 := v1857 + 1858
+    v1859: i32 := v1858 + 1859
+    v1860: i32 := v1859 + 1860
+    v1861: i32 := v1860 + 1861
+    v1862: i32 := v1861 + 1862
+    v1863: i32 := v1862 + 1863
+    v1864: i32 := v1863 + 1864
+    v1865: i32 := v1864 + 1865
+    v1866: i32 := v1865 + 1866
+    v1867: i32 := v1866 + 1867
+    v1868: i32 := v1867 + 1868
+    v1869: i32 := v1868 + 1869
+    v1870: i32 := v1869 + 1870
+    v1871: i32 := v1870 + 1871
+    v1872: i32 := v1871 + 1872
+    v1873: i32 := v1872 + 1873
+    v1874: i32 := v1873 + 1874
+    v1875: i32 := v1874 + 1875
+    v1876: i32 := v1875 + 1876
+    v1877: i32 := v1876 + 1877
+    v1878: i32 := v1877 + 1878
+    v1879: i32 := v1878 + 1879
+    v1880: i32 := v1879 + 1880
+    v1881: i32 := v1880 + 1881
+    v1882: i32 := v1881 + 1882
+    v1883: i32 := v1882 + 1883
+    v1884: i32 := v1883 + 1884
+    v1885: i32 := v1884 + 1885
+    v1886: i32 := v1885 + 1886
+    v1887: i32 := v1886 + 1887
+    v1888: i32 := v1887 + 1888
+    v1889: i32 := v1888 + 1889
+    v1890: i32 := v1889 + 1890
+    v1891: i32 := v1890 + 1891
+    v1892: i32 := v1891 + 1892
+    v1893: i32 := v1892 + 1893
+    v1894: i32 := v1893 + 1894
+    v1895: i32 := v1894 + 1895
+    v1896: i32 := v1895 + 1896
+    v1897: i32 := v1896 + 1897
+    v1898: i32 := v1897 + 1898
+    v1899: i32 := v1898 + 1899
+    v1900: i32 := v1899 + 1900
+    v1901: i32 := v1900 + 1901
+    v1902: i32 := v1901 + 1902
+    v1903: i32 := v1902 + 1903
+    v1904: i32 := v1903 + 1904
+    v1905: i32 := v1904 + 1905
+    v1906: i32 := v1905 + 1906
+    v1907: i32 := v1906 + 1907
+    v1908: i32 := v1907 + 1908
+    v1909: i32 := v1908 + 1909
+    v1910: i32 := v1909 + 1910
+    v1911: i32 := v1910 + 1911
+    v1912: i32 := v1911 + 1912
+    v1913: i32 := v1912 + 1913
+    v1914: i32 := v1913 + 1914
+    v1915: i32 := v1914 + 1915
+    v1916: i32 := v1915 + 1916
+    v1917: i32 := v1916 + 1917
+    v1918: i32 := v1917 + 1918
+    v1919: i32 := v1918 + 1919
+    v1920: i32 := v1919 + 1920
+    v1921: i32 := v1920 + 1921
+    v1922: i32 := v1921 + 1922
+    v1923: i32 := v1922 + 1923
+    v1924: i32 := v1923 + 1924
+    v1925: i32 := v1924 + 1925
+    v1926: i32 := v1925 + 1926
+    v1927: i32 := v1926 + 1927
+    v1928: i32 := v1927 + 1928
+    v1929: i32 := v1928 + 1929
+    v1930: i32 := v1929 + 1930
+    v1931: i32 := v1930 + 1931
+    v1932: i32 := v1931 + 1932
+    v1933: i32 := v1932 + 1933
+    v1934: i32 := v1933 + 1934
+    v1935: i32 := v1934 + 1935
+    v1936: i32 := v1935 + 1936
+    v1937: i32 := v1936 + 1937
+    v1938: i32 := v1937 + 1938
+    v1939: i32 := v1938 + 1939
+    v1940: i32 := v1939 + 1940
+    v1941: i32 := v1940 + 1941
+    v1942: i32 := v1941 + 1942
+    v1943: i32 := v1942 + 1943
+    v1944: i32 := v1943 + 1944
+    v1945: i32 := v1944 + 1945
+    v1946: i32 := v1945 + 1946
+    v1947: i32 := v1946 + 1947
+    v1948: i32 := v1947 + 1948
+    v1949: i32 := v1948 + 1949
+    v1950: i32 := v1949 + 1950
+    v1951: i32 := v1950 + 1951
+    v1952: i32 := v1951 + 1952
+    v1953: i32 := v1952 + 1953
+    v1954: i32 := v1953 + 1954
+    v1955: i32 := v1954 + 1955
+    v1956: i32 := v1955 + 1956
+    v1957: i32 := v1956 + 1957
+    v1958: i32 := v1957 + 1958
+    v1959: i32 := v1958 + 1959
+    v1960: i32 := v1959 + 1960
+    v1961: i32 := v1960 + 1961
+    v1962: i32 := v1961 + 1962
+    v1963: i32 := v1962 + 1963
+    v1964: i32 := v1963 + 1964
+    v1965: i32 := v1964 + 1965
+    v1966: i32 := v1965 + 1966
+    v1967: i32 := v1966 + 1967
+    v1968: i32 := v1967 + 1968
+    v1969: i32 := v1968 + 1969
+    v1970: i32 := v1969 + 1970
+    v1971: i32 := v1970 + 1971
+    v1972: i32 := v1971 + 1972
+    v1973: i32 := v1972 + 1973
+    v1974: i32 := v1973 + 1974
+    v1975: i32 := v1974 + 1975
+    v1976: i32 := v1975 + 1976
+    v1977: i32 := v1976 + 1977
+    v1978: i32 := v1977 + 1978
+    v1979: i32 := v1978 + 1979
+    v1980: i32 := v1979 + 1980
+    v1981: i32 := v1980 + 1981
+    v1982: i32 := v1981 + 1982
+    v1983: i32 := v1982 + 1983
+    v1984: i32 := v1983 + 1984
+    v1985: i32 := v1984 + 1985
+    v1986: i32 := v1985 + 1986
+    v1987: i32 := v1986 + 1987
+    v1988: i32 := v1987 + 1988
+    v1989: i32 := v1988 + 1989
+    v1990: i32 := v1989 + 1990
+    v1991: i32 := v1990 + 1991
+    v1992: i32 := v1991 + 1992
+    v1993: i32 := v1992 + 1993
+    v1994: i32 := v1993 + 1994
+    v1995: i32 := v1994 + 1995
+    v1996: i32 := v1995 + 1996
+    v1997: i32 := v1996 + 1997
+    v1998: i32 := v1997 + 1998
+    v1999: i32 := v1998 + 1999
+    v2000: i32 := v1999 + 2000
+    v2001: i32 := v2000 + 2001
+    v2002: i32 := v2001 + 2002
+    v2003: i32 := v2002 + 2003
+    v2004: i32 := v2003 + 2004
+    v2005: i32 := v2004 + 2005
+    v2006: i32 := v2005 + 2006
+    v2007: i32 := v2006 + 2007
+    v2008: i32 := v2007 + 2008
+    v2009: i32 := v2008 + 2009
+    v2010: i32 := v2009 + 2010
+    v2011: i32 := v2010 + 2011
+    v2012: i32 := v2011 + 2012
+    v2013: i32 := v2012 + 2013
+    v2014: i32 := v2013 + 2014
+    v2015: i32 := v2014 + 2015
+    v2016: i32 := v2015 + 2016
+    v2017: i32 := v2016 + 2017
+    v2018: i32 := v2017 + 2018
+    v2019: i32 := v2018 + 2019
+    v2020: i32 := v2019 + 2020
+    v2021: i32 := v2020 + 2021
+    v2022: i32 := v2021 + 2022
+    v2023: i32 := v2022 + 2023
+    v2024: i32 := v2023 + 2024
+    v2025: i32 := v2024 + 2025
+    v2026: i32 := v2025 + 2026
+    v2027: i32 := v2026 + 2027
+    v2028: i32 := v2027 + 2028
+    v2029: i32 := v2028 + 2029
+    v2030: i32 := v2029 + 2030
+    v2031: i32 := v2030 + 2031
+    v2032: i32 := v2031 + 2032
+    v2033: i32 := v2032 + 2033
+    v2034: i32 := v2033 + 2034
+    v2035: i32 := v2034 + 2035
+    v2036: i32 := v2035 + 2036
+    v2037: i32 := v2036 + 2037
+    v2038: i32 := v2037 + 2038
+    v2039: i32 := v2038 + 2039
+    v2040: i32 := v2039 + 2040
+    v2041: i32 := v2040 + 2041
+    v2042: i32 := v2041 + 2042
+    v2043: i32 := v2042 + 2043
+    v2044: i32 := v2043 + 2044
+    v2045: i32 := v2044 + 2045
+    v2046: i32 := v2045 + 2046
+    v2047: i32 := v2046 + 2047
+    v2048: i32 := v2047 + 2048
+    v2049: i32 := v2048 + 2049
+    v2050: i32 := v2049 + 2050
+    v2051: i32 := v2050 + 2051
+    v2052: i32 := v2051 + 2052
+    v2053: i32 := v2052 + 2053
+    v2054: i32 := v2053 + 2054
+    v2055: i32 := v2054 + 2055
+    v2056: i32 := v2055 + 2056
+    v2057: i32 := v2056 + 2057
+    v2058: i32 := v2057 + 2058
+    v2059: i32 := v2058 + 2059
+    v2060: i32 := v2059 + 2060
+    v2061: i32 := v2060 + 2061
+    v2062: i32 := v2061 + 2062
+    v2063: i32 := v2062 + 2063
+    v2064: i32 := v2063 + 2064
+    v2065: i32 := v2064 + 2065
+    v2066: i32 := v2065 + 2066
+    v2067: i32 := v2066 + 2067
+    v2068: i32 := v2067 + 2068
+    v2069: i32 := v2068 + 2069
+    v2070: i32 := v2069 + 2070
+    v2071: i32 := v2070 + 2071
+    v2072: i32 := v2071 + 2072
+    v2073: i32 := v2072 + 2073
+    v2074: i32 := v2073 + 2074
+    v2075: i32 := v2074 + 2075
+    v2076: i32 := v2075 + 2076
+    v2077: i32 := v2076 + 2077
+    v2078: i32 := v2077 + 2078
+    v2079: i32 := v2078 + 2079
+    v2080: i32 := v2079 + 2080
+    v2081: i32 := v2080 + 2081
+    v2082: i32 := v2081 + 2082
+    v2083: i32 := v2082 + 2083
+    v2084: i32 := v2083 + 2084
+    v2085: i32 := v2084 + 2085
+    v2086: i32 := v2085 + 2086
+    v2087: i32 := v2086 + 2087
+    v2088: i32 := v2087 + 2088
+    v2089: i32 := v2088 + 2089
+    v2090: i32 := v2089 + 2090
+    v2091: i32 := v2090 + 2091
+    v2092: i32 := v2091 + 2092
+    v2093: i32 := v2092 + 2093
+    v2094: i32 := v2093 + 2094
+    v2095: i32 := v2094 + 2095
+    v2096: i32 := v2095 + 2096
+    v2097: i32 := v2096 + 2097
+    v2098: i32 := v2097 + 2098
+    v2099: i32 := v2098 + 2099
+    v2100: i32 := v2099 + 2100
+    v2101: i32 := v2100 + 2101
+    v2102: i32 := v2101 + 2102
+    v2103: i32 := v2102 + 2103
+    v2104: i32 := v2103 + 2104
+    v2105: i32 := v2104 + 2105
+    v2106: i32 := v2105 + 2106
+    v2107: i32 := v2106 + 2107
+    v2108: i32 := v2107 + 2108
+    v2109: i32 := v2108 + 2109
+    v2110: i32 := v2109 + 2110
+    v2111: i32 := v2110 + 2111
+    v2112: i32 := v2111 + 2112
+    v2113: i32 := v2112 + 2113
+    v2114: i32 := v2113 + 2114
+    v2115: i32 := v2114 + 2115
+    v2116: i32 := v2115 + 2116
+    v2117: i32 := v2116 + 2117
+    v2118: i32 := v2117 + 2118
+    v2119: i32 := v2118 + 2119
+    v2120: i32 := v2119 + 2120
+    v2121: i32 := v2120 + 2121
+    v2122: i32 := v2121 + 2122
+    v2123: i32 := v2122 + 2123
+    v2124: i32 := v2123 + 2124
+    v2125: i32 := v2124 + 2125
+    v2126: i32 := v2125 + 2126
+    v2127: i32 := v2126 + 2127
+    v2128: i32 := v2127 + 2128
+    v2129: i32 := v2128 + 2129
+    v2130: i32 := v2129 + 2130
+    v2131: i32 := v2130 + 2131
+    v2132: i32 := v2131 + 2132
+    v2133: i32 := v2132 + 2133
+    v2134: i32 := v2133 + 2134
+    v2135: i32 := v2134 + 2135
+    v2136: i32 := v2135 + 2136
+    v2137: i32 := v2136 + 2137
+    v2138: i32 := v2137 + 2138
+    v2139: i32 := v2138 + 2139
+    v2140: i32 := v2139 + 2140
+    v2141: i32 := v2140 + 2141
+    v2142: i32 := v2141 + 2142
+    v2143: i32 := v2142 + 2143
+    v2144: i32 := v2143 + 2144
+    v2145: i32 := v2144 + 2145
+    v2146: i32 := v2145 + 2146
+    v2147: i32 := v2146 + 2147
+    v2148: i32 := v2147 + 2148
+    v2149: i32 := v2148 + 2149
+    v2150: i32 := v2149 + 2150
+    v2151: i32 := v2150 + 2151
+    v2152: i32 := v2151 + 2152
+    v2153: i32 := v2152 + 2153
+    v2154: i32 := v2153 + 2154
+    v2155: i32 := v2154 + 2155
+    v2156: i32 := v2155 + 2156
+    v2157: i32 := v2156 + 2157
+    v2158: i32 := v2157 + 2158
+    v2159: i32 := v2158 + 2159
+    v2160: i32 := v2159 + 2160
+    v2161: i32 := v2160 + 2161
+    v2162: i32 := v2161 + 2162
+    v2163: i32 := v2162 + 2163
+    v2164: i32 := v2163 + 2164
+    v2165: i32 := v2164 + 2165
+    v2166: i32 := v2165 + 2166
+    v2167: i32 := v2166 + 2167
+    v2168: i32 := v2167 + 2168
+    v2169: i32 := v2168 + 2169
+    v2170: i32 := v2169 + 2170
+    v2171: i32 := v2170 + 2171
+    v2172: i32 := v2171 + 2172
+    v2173: i32 := v2172 + 2173
+    v2174: i32 := v2173 + 2174
+    v2175: i32 := v2174 + 2175
+    v2176: i32 := v2175 + 2176
+    v2177: i32 := v2176 + 2177
+    v2178: i32 := v2177 + 2178
+    v2179: i32 := v2178 + 2179
+    v2180: i32 := v2179 + 2180
+    v2181: i32 := v2180 + 2181
+    v2182: i32 := v2181 + 2182
+    v2183: i32 := v2182 + 2183
+    v2184: i32 := v2183 + 2184
+    v2185: i32 := v2184 + 2185
+    v2186: i32 := v2185 + 2186
+    v2187: i32 := v2186 + 2187
+    v2188: i32 := v2187 + 2188
+    v2189: i32 := v2188 + 2189
+    v2190: i32 := v2189 + 2190
+    v2191: i32 := v2190 + 2191
+    v2192: i32 := v2191 + 2192
+    v2193: i32 := v2192 + 2193
+    v2194: i32 := v2193 + 2194
+    v2195: i32 := v2194 + 2195
+    v2196: i32 := v2195 + 2196
+    v2197: i32 := v2196 + 2197
+    v2198: i32 := v2197 + 2198
+    v2199: i32 := v2198 + 2199
+    v2200: i32 := v2199 + 2200
+    v2201: i32 := v2200 + 2201
+    v2202: i32 := v2201 + 2202
+    v2203: i32 := v2202 + 2203
+    v2204: i32 := v2203 + 2204
+    v2205: i32 := v2204 + 2205
+    v2206: i32 := v2205 + 2206
+    v2207: i32 := v2206 + 2207
+    v2208: i32 := v2207 + 2208
+    v2209: i32 := v2208 + 2209
+    v2210: i32 := v2209 + 2210
+    v2211: i32 := v2210 + 2211
+    v2212: i32 := v2211 + 2212
+    v2213: i32 := v2212 + 2213
+    v2214: i32 := v2213 + 2214
+    v2215: i32 := v2214 + 2215
+    v2216: i32 := v2215 + 2216
+    v2217: i32 := v2216 + 2217
+    v2218: i32 := v2217 + 2218
+    v2219: i32 := v2218 + 2219
+    v2220: i32 := v2219 + 2220
+    v2221: i32 := v2220 + 2221
+    v2222: i32 := v2221 + 2222
+    v2223: i32 := v2222 + 2223
+    v2224: i32 := v2223 + 2224
+    v2225: i32 := v2224 + 2225
+    v2226: i32 := v2225 + 2226
+    v2227: i32 := v2226 + 2227
+    v2228: i32 := v2227 + 2228
+    v2229: i32 := v2228 + 2229
+    v2230: i32 := v2229 + 2230
+    v2231: i32 := v2230 + 2231
+    v2232: i32 := v2231 + 2232
+    v2233: i32 := v2232 + 2233
+    v2234: i32 := v2233 + 2234
+    v2235: i32 := v2234 + 2235
+    v2236: i32 := v2235 + 2236
+    v2237: i32 := v2236 + 2237
+    v2238: i32 := v2237 + 2238
+    v2239: i32 := v2238 + 2239
+    v2240: i32 := v2239 + 2240
+    v2241: i32 := v2240 + 2241
+    v2242: i32 := v2241 + 2242
+    v2243: i32 := v2242 + 2243
+    v2244: i32 := v2243 + 2244
+    v2245: i32 := v2244 + 2245
+    v2246: i32 := v2245 + 2246
+    v2247: i32 := v2246 + 2247
+    v2248: i32 := v2247 + 2248
+    v2249: i32 := v2248 + 2249
+    v2250: i32 := v2249 + 2250
+    v2251: i32 := v2250 + 2251
+    v2252: i32 := v2251 + 2252
+    v2253: i32 := v2252 + 2253
+    v2254: i32 := v2253 + 2254
+    v2255: i32 := v2254 + 2255
+    v2256: i32 := v2255 + 2256
+    v2257: i32 := v2256 + 2257
+    v2258: i32 := v2257 + 2258
+    v2259: i32 := v2258 + 2259
+    v2260: i32 := v2259 + 2260
+    v2261: i32 := v2260 + 2261
+    v2262: i32 := v2261 + 2262
+    v2263: i32 := v2262 + 2263
+    v2264: i32 := v2263 + 2264
+    v2265: i32 := v2264 + 2265
+    v2266: i32 := v2265 + 2266
+    v2267: i32 := v2266 + 2267
+    v2268: i32 := v2267 + 2268
+    v2269: i32 := v2268 + 2269
+    v2270: i32 := v2269 + 2270
+    v2271: i32 := v2270 + 2271
+    v2272: i32 := v2271 + 2272
+    v2273: i32 := v2272 + 2273
+    v2274: i32 := v2273 + 2274
+    v2275: i32 := v2274 + 2275
+    v2276: i32 := v2275 + 2276
+    v2277: i32 := v2276 + 2277
+    v2278: i32 := v2277 + 2278
+    v2279: i32 := v2278 + 2279
+    v2280: i32 := v2279 + 2280
+    v2281: i32 := v2280 + 2281
+    v2282: i32 := v2281 + 2282
+    v2283: i32 := v2282 + 2283
+    v2284: i32 := v2283 + 2284
+    v2285: i32 := v2284 + 2285
+    v2286: i32 := v2285 + 2286
+    v2287: i32 := v2286 + 2287
+    v2288: i32 := v2287 + 2288
+    v2289: i32 := v2288 + 2289
+    v2290: i32 := v2289 + 2290
+    v2291: i32 := v2290 + 2291
+    v2292: i32 := v2291 + 2292
+    v2293: i32 := v2292 + 2293
+    v2294: i32 := v2293 + 2294
+    v2295: i32 := v2294 + 2295
+    v2296: i32 := v2295 + 2296
+    v2297: i32 := v2296 + 2297
+    v2298: i32 := v2297 + 2298
+    v2299: i32 := v2298 + 2299
+    v2300: i32 := v2299 + 2300
+    v2301: i32 := v2300 + 2301
+    v2302: i32 := v2301 + 2302
+    v2303: i32 := v2302 + 2303
+    v2304: i32 := v2303 + 2304
+    v2305: i32 := v2304 + 2305
+    v2306: i32 := v2305 + 2306
+    v2307: i32 := v2306 + 2307
+    v2308: i32 := v2307 + 2308
+    v2309: i32 := v2308 + 2309
+    v2310: i32 := v2309 + 2310
+    v2311: i32 := v2310 + 2311
+    v2312: i32 := v2311 + 2312
+    v2313: i32 := v2312 + 2313
+    v2314: i32 := v2313 + 2314
+    v2315: i32 := v2314 + 2315
+    v2316: i32 := v2315 + 2316
+    v2317: i32 := v2316 + 2317
+    v2318: i32 := v2317 + 2318
+    v2319: i32 := v2318 + 2319
+    v2320: i32 := v2319 + 2320
+    v2321: i32 := v2320 + 2321
+    v2322: i32 := v2321 + 2322
+    v2323: i32 := v2322 + 2323
+    v2324: i32 := v2323 + 2324
+    v2325: i32 := v2324 + 2325
+    v2326: i32 := v2325 + 2326
+    v2327: i32 := v2326 + 2327
+    v2328: i32 := v2327 + 2328
+    v2329: i32 := v2328 + 2329
+    v2330: i32 := v2329 + 2330
+    v2331: i32 := v2330 + 2331
+    v2332: i32 := v2331 + 2332
+    v2333: i32 := v2332 + 2333
+    v2334: i32 := v2333 + 2334
+    v2335: i32 := v2334 + 2335
+    v2336: i32 := v2335 + 2336
+    v2337: i32 := v2336 + 2337
+    v2338: i32 := v2337 + 2338
+    v2339: i32 := v2338 + 2339
+    v2340: i32 := v2339 + 2340
+    v2341: i32 := v2340 + 2341
+    v2342: i32 := v2341 + 2342
+    v2343: i32 := v2342 + 2343
+    v2344: i32 := v2343 + 2344
+    v2345: i32 := v2344 + 2345
+    v2346: i32 := v2345 + 2346
+    v2347: i32 := v2346 + 2347
+    v2348: i32 := v2347 + 2348
+    v2349: i32 := v2348 + 2349
+    v2350: i32 := v2349 + 2350
+    v2351: i32 := v2350 + 2351
+    v2352: i32 := v2351 + 2352
+    v2353: i32 := v2352 + 2353
+    v2354: i32 := v2353 + 2354
+    v2355: i32 := v2354 + 2355
+    v2356: i32 := v2355 + 2356
+    v2357: i32 := v2356 + 2357
+    v2358: i32 := v2357 + 2358
+    v2359: i32 := v2358 + 2359
+    v2360: i32 := v2359 + 2360
+    v2361: i32 := v2360 + 2361
+    v2362: i32 := v2361 + 2362
+    v2363: i32 := v2362 + 2363
+    v2364: i32 := v2363 + 2364
+    v2365: i32 := v2364 + 2365
+    v2366: i32 := v2365 + 2366
+    v2367: i32 := v2366 + 2367
+    v2368: i32 := v2367 + 2368
+    v2369: i32 := v2368 + 2369
+    v2370: i32 := v2369 + 2370
+    v2371: i32 := v2370 + 2371
+    v2372: i32 := v2371 + 2372
+    v2373: i32 := v2372 + 2373
+    v2374: i32 := v2373 + 2374
+    v2375: i32 := v2374 + 2375
+    v2376: i32 := v2375 + 2376
+    v2377: i32 := v2376 + 2377
+    v2378: i32 := v2377 + 2378
+    v2379: i32 := v2378 + 2379
+    v2380: i32 := v2379 + 2380
+    v2381: i32 := v2380 + 2381
+    v2382: i32 := v2381 + 2382
+    v2383: i32 := v2382 + 2383
+    v2384: i32 := v2383 + 2384
+    v2385: i32 := v2384 + 2385
+    v2386: i32 := v2385 + 2386
+    v2387: i32 := v2386 + 2387
+    v2388: i32 := v2387 + 2388
+    v2389: i32 := v2388 + 2389
+    v2390: i32 := v2389 + 2390
+    v2391: i32 := v2390 + 2391
+    v2392: i32 := v2391 + 2392
+    v2393: i32 := v2392 + 2393
+    v2394: i32 := v2393 + 2394
+    v2395: i32 := v2394 + 2395
+    v2396: i32 := v2395 + 2396
+    v2397: i32 := v2396 + 2397
+    v2398: i32 := v2397 + 2398
+    v2399: i32 := v2398 + 2399
+    v2400: i32 := v2399 + 2400
+    v2401: i32 := v2400 + 2401
+    v2402: i32 := v2401 + 2402
+    v2403: i32 := v2402 + 2403
+    v2404: i32 := v2403 + 2404
+    v2405: i32 := v2404 + 2405
+    v2406: i32 := v2405 + 2406
+    v2407: i32 := v2406 + 2407
+    v2408: i32 := v2407 + 2408
+    v2409: i32 := v2408 + 2409
+    v2410: i32 := v2409 + 2410
+    v2411: i32 := v2410 + 2411
+    v2412: i32 := v2411 + 2412
+    v2413: i32 := v2412 + 2413
+    v2414: i32 := v2413 + 2414
+    v2415: i32 := v2414 + 2415
+    v2416: i32 := v2415 + 2416
+    v2417: i32 := v2416 + 2417
+    v2418: i32 := v2417 + 2418
+    v2419: i32 := v2418 + 2419
+    v2420: i32 := v2419 + 2420
+    v2421: i32 := v2420 + 2421
+    v2422: i32 := v2421 + 2422
+    v2423: i32 := v2422 + 2423
+    v2424: i32 := v2423 + 2424
+    v2425: i32 := v2424 + 2425
+    v2426: i32 := v2425 + 2426
+    v2427: i32 := v2426 + 2427
+    v2428: i32 := v2427 + 2428
+    v2429: i32 := v2428 + 2429
+    v2430: i32 := v2429 + 2430
+    v2431: i32 := v2430 + 2431
+    v2432: i32 := v2431 + 2432
+    v2433: i32 := v2432 + 2433
+    v2434: i32 := v2433 + 2434
+    v2435: i32 := v2434 + 2435
+    v2436: i32 := v2435 + 2436
+    v2437: i32 := v2436 + 2437
+    v2438: i32 := v2437 + 2438
+    v2439: i32 := v2438 + 2439
+    v2440: i32 := v2439 + 2440
+    v2441: i32 := v2440 + 2441
+    v2442: i32 := v2441 + 2442
+    v2443: i32 := v2442 + 2443
+    v2444: i32 := v2443 + 2444
+    v2445: i32 := v2444 + 2445
+    v2446: i32 := v2445 + 2446
+    v2447: i32 := v2446 + 2447
+    v2448: i32 := v2447 + 2448
+    v2449: i32 := v2448 + 2449
+    v2450: i32 := v2449 + 2450
+    v2451: i32 := v2450 + 2451
+    v2452: i32 := v2451 + 2452
+    v2453: i32 := v2452 + 2453
+    v2454: i32 := v2453 + 2454
+    v2455: i32 := v2454 + 2455
+    v2456: i32 := v2455 + 2456
+    v2457: i32 := v2456 + 2457
+    v2458: i32 := v2457 + 2458
+    v2459: i32 := v2458 + 2459
+    v2460: i32 := v2459 + 2460
+    v2461: i32 := v2460 + 2461
+    v2462: i32 := v2461 + 2462
+    v2463: i32 := v2462 + 2463
+    v2464: i32 := v2463 + 2464
+    v2465: i32 := v2464 + 2465
+    v2466: i32 := v2465 + 2466
+    v2467: i32 := v2466 + 2467
+    v2468: i32 := v2467 + 2468
+    v2469: i32 := v2468 + 2469
+    v2470: i32 := v2469 + 2470
+    v2471: i32 := v2470 + 2471
+    v2472: i32 := v2471 + 2472
+    v2473: i32 := v2472 + 2473
+    v2474: i32 := v2473 + 2474
+    v2475: i32 := v2474 + 2475
+    v2476: i32 := v2475 + 2476
+    v2477: i32 := v2476 + 2477
+    v2478: i32 := v2477 + 2478
+    v2479: i32 := v2478 + 2479
+    v2480: i32 := v2479 + 2480
+    v2481: i32 := v2480 + 2481
+    v2482: i32 := v2481 + 2482
+    v2483: i32 := v2482 + 2483
+    v2484: i32 := v2483 + 2484
+    v2485: i32 := v2484 + 2485
+    v2486: i32 := v2485 + 2486
+    v2487: i32 := v2486 + 2487
+    v2488: i32 := v2487 + 2488
+    v2489: i32 := v2488 + 2489
+    v2490: i32 := v2489 + 2490
+    v2491: i32 := v2490 + 2491
+    v2492: i32 := v2491 + 2492
+    v2493: i32 := v2492 + 2493
+    v2494: i32 := v2493 + 2494
+    v2495: i32 := v2494 + 2495
+    v2496: i32 := v2495 + 2496
+    v2497: i32 := v2496 + 2497
+    v2498: i32 := v2497 + 2498
+    v2499: i32 := v2498 + 2499
+    v2500: i32 := v2499 + 2500
+    v2501: i32 := v2500 + 2501
+    v2502: i32 := v2501 + 2502
+    v2503: i32 := v2502 + 2503
+    v2504: i32 := v2503 + 2504
+    v2505: i32 := v2504 + 2505
+    v2506: i32 := v2505 + 2506
+    v2507: i32 := v2506 + 2507
+    v2508: i32 := v2507 + 2508
+    v2509: i32 := v2508 + 2509
+    v2510: i32 := v2509 + 2510
+    v2511: i32 := v2510 + 2511
+    v2512: i32 := v2511 + 2512
+    v2513: i32 := v2512 + 2513
+    v2514: i32 := v2513 + 2514
+    v2515: i32 := v2514 + 2515
+    v2516: i32 := v2515 + 2516
+    v2517: i32 := v2516 + 2517
+    v2518: i32 := v2517 + 2518
+    v2519: i32 := v2518 + 2519
+    v2520: i32 := v2519 + 2520
+    v2521: i32 := v2520 + 2521
+    v2522: i32 := v2521 + 2522
+    v2523: i32 := v2522 + 2523
+    v2524: i32 := v2523 + 2524
+    v2525: i32 := v2524 + 2525
+    v2526: i32 := v2525 + 2526
+    v2527: i32 := v2526 + 2527
+    v2528: i32 := v2527 + 2528
+    v2529: i32 := v2528 + 2529
+    v2530: i32 := v2529 + 2530
+    v2531: i32 := v2530 + 2531
+    v2532: i32 := v2531 + 2532
+    v2533: i32 := v2532 + 2533
+    v2534: i32 := v2533 + 2534
+    v2535: i32 := v2534 + 2535
+    v2536: i32 := v2535 + 2536
+    v2537: i32 := v2536 + 2537
+    v2538: i32 := v2537 + 2538
+    v2539: i32 := v2538 + 2539
+    v2540: i32 := v2539 + 2540
+    v2541: i32 := v2540 + 2541
+    v2542: i32 := v2541 + 2542
+    v2543: i32 := v2542 + 2543
+    v2544: i32 := v2543 + 2544
+    v2545: i32 := v2544 + 2545
+    v2546: i32 := v2545 + 2546
+    v2547: i32 := v2546 + 2547
+    v2548: i32 := v2547 + 2548
+    v2549: i32 := v2548 + 2549
+    v2550: i32 := v2549 + 2550
+    v2551: i32 := v2550 + 2551
+    v2552: i32 := v2551 + 2552
+    v2553: i32 := v2552 + 2553
+    v2554: i32 := v2553 + 2554
+    v2555: i32 := v2554 + 2555
+    v2556: i32 := v2555 + 2556
+    v2557: i32 := v2556 + 2557
+    v2558: i32 := v2557 + 2558
+    v2559: i32 := v2558 + 2559
+    v2560: i32 := v2559 + 2560
+    v2561: i32 := v2560 + 2561
+    v2562: i32 := v2561 + 2562
+    v2563: i32 := v2562 + 2563
+    v2564: i32 := v2563 + 2564
+    v2565: i32 := v2564 + 2565
+    v2566: i32 := v2565 + 2566
+    v2567: i32 := v2566 + 2567
+    v2568: i32 := v2567 + 2568
+    v2569: i32 := v2568 + 2569
+    v2570: i32 := v2569 + 2570
+    v2571: i32 := v2570 + 2571
+    v2572: i32 := v2571 + 2572
+    v2573: i32 := v2572 + 2573
+    v2574: i32 := v2573 + 2574
+    v2575: i32 := v2574 + 2575
+    v2576: i32 := v2575 + 2576
+    v2577: i32 := v2576 + 2577
+    v2578: i32 := v2577 + 2578
+    v2579: i32 := v2578 + 2579
+    v2580: i32 := v2579 + 2580
+    v2581: i32 := v2580 + 2581
+    v2582: i32 := v2581 + 2582
+    v2583: i32 := v2582 + 2583
+    v2584: i32 := v2583 + 2584
+    v2585: i32 := v2584 + 2585
+    v2586: i32 := v2585 + 2586
+    v2587: i32 := v2586 + 2587
+    v2588: i32 := v2587 + 2588
+    v2589: i32 := v2588 + 2589
+    v2590: i32 := v2589 + 2590
+    v2591: i32 := v2590 + 2591
+    v2592: i32 := v2591 + 2592
+    v2593: i32 := v2592 + 2593
+    v2594: i32 := v2593 + 2594
+    v2595: i32 := v2594 + 2595
+    v2596: i32 := v2595 + 2596
+    v2597: i32 := v2596 + 2597
+    v2598: i32 := v2597 + 2598
+    v2599: i32 := v2598 + 2599
+    v2600: i32 := v2599 + 2600
+    v2601: i32 := v2600 + 2601
+    v2602: i32 := v2601 + 2602
+    v2603: i32 := v2602 + 2603
+    v2604: i32 := v2603 + 2604
+    v2605: i32 := v2604 + 2605
+    v2606: i32 := v2605 + 2606
+    v2607: i32 := v2606 + 2607
+    v2608: i32 := v2607 + 2608
+    v2609: i32 := v2608 + 2609
+    v2610: i32 := v2609 + 2610
+    v2611: i32 := v2610 + 2611
+    v2612: i32 := v2611 + 2612
+    v2613: i32 := v2612 + 2613
+    v2614: i32 := v2613 + 2614
+    v2615: i32 := v2614 + 2615
+    v2616: i32 := v2615 + 2616
+    v2617: i32 := v2616 + 2617
+    v2618: i32 := v2617 + 2618
+    v2619: i32 := v2618 + 2619
+    v2620: i32 := v2619 + 2620
+    v2621: i32 := v2620 + 2621
+    v2622: i32 := v2621 + 2622
+    v2623: i32 := v2622 + 2623
+    v2624: i32 := v2623 + 2624
+    v2625: i32 := v2624 + 2625
+    v2626: i32 := v2625 + 2626
+    v2627: i32 := v2626 + 2627
+    v2628: i32 := v2627 + 2628
+    v2629: i32 := v2628 + 2629
+    v2630: i32 := v2629 + 2630
+    v2631: i32 := v2630 + 2631
+    v2632: i32 := v2631 + 2632
+    v2633: i32 := v2632 + 2633
+    v2634: i32 := v2633 + 2634
+    v2635: i32 := v2634 + 2635
+    v2636: i32 := v2635 + 2636
+    v2637: i32 := v2636 + 2637
+    v2638: i32 := v2637 + 2638
+    v2639: i32 := v2638 + 2639
+    v2640: i32 := v2639 + 2640
+    v2641: i32 := v2640 + 2641
+    v2642: i32 := v2641 + 2642
+    v2643: i32 := v2642 + 2643
+    v2644: i32 := v2643 + 2644
+    v2645: i32 := v2644 + 2645
+    v2646: i32 := v2645 + 2646
+    v2647: i32 := v2646 + 2647
+    v2648: i32 := v2647 + 2648
+    v2649: i32 := v2648 + 2649
+    v2650: i32 := v2649 + 2650
+    v2651: i32 := v2650 + 2651
+    v2652: i32 := v2651 + 2652
+    v2653: i32 := v2652 + 2653
+    v2654: i32 := v2653 + 2654
+    v2655: i32 := v2654 + 2655
+    v2656: i32 := v2655 + 2656
+    v2657: i32 := v2656 + 2657
+    v2658: i32 := v2657 + 2658
+    v2659: i32 := v2658 + 2659
+    v2660: i32 := v2659 + 2660
+    v2661: i32 := v2660 + 2661
+    v2662: i32 := v2661 + 2662
+    v2663: i32 := v2662 + 2663
+    v2664: i32 := v2663 + 2664
+    v2665: i32 := v2664 + 2665
+    v2666: i32 := v2665 + 2666
+    v2667: i32 := v2666 + 2667
+    v2668: i32 := v2667 + 2668
+    v2669: i32 := v2668 + 2669
+    v2670: i32 := v2669 + 2670
+    v2671: i32 := v2670 + 2671
+    v2672: i32 := v2671 + 2672
+    v2673: i32 := v2672 + 2673
+    v2674: i32 := v2673 + 2674
+    v2675: i32 := v2674 + 2675
+    v2676: i32 := v2675 + 2676
+    v2677: i32 := v2676 + 2677
+    v2678: i32 := v2677 + 2678
+    v2679: i32 := v2678 + 2679
+    v2680: i32 := v2679 + 2680
+    v2681: i32 := v2680 + 2681
+    v2682: i32 := v2681 + 2682
+    v2683: i32 := v2682 + 2683
+    v2684: i32 := v2683 + 2684
+    v2685: i32 := v2684 + 2685
+    v2686: i32 := v2685 + 2686
+    v2687: i32 := v2686 + 2687
+    v2688: i32 := v2687 + 2688
+    v2689: i32 := v2688 + 2689
+    v2690: i32 := v2689 + 2690
+    v2691: i32 := v2690 + 2691
+    v2692: i32 := v2691 + 2692
+    v2693: i32 := v2692 + 2693
+    v2694: i32 := v2693 + 2694
+    v2695: i32 := v2694 + 2695
+    v2696: i32 := v2695 + 2696
+    v2697: i32 := v2696 + 2697
+    v2698: i32 := v2697 + 2698
+    v2699: i32 := v2698 + 2699
+    v2700: i32 := v2699 + 2700
+    v2701: i32 := v2700 + 2701
+    v2702: i32 := v2701 + 2702
+    v2703: i32 := v2702 + 2703
+    v2704: i32 := v2703 + 2704
+    v2705: i32 := v2704 + 2705
+    v2706: i32 := v2705 + 2706
+    v2707: i32 := v2706 + 2707
+    v2708: i32 := v2707 + 2708
+    v2709: i32 := v2708 + 2709
+    v2710: i32 := v2709 + 2710
+    v2711: i32 := v2710 + 2711
+    v2712: i32 := v2711 + 2712
+    v2713: i32 := v2712 + 2713
+    v2714: i32 := v2713 + 2714
+    v2715: i32 := v2714 + 2715
+    v2716: i32 := v2715 + 2716
+    v2717: i32 := v2716 + 2717
+    v2718: i32 := v2717 + 2718
+    v2719: i32 := v2718 + 2719
+    v2720: i32 := v2719 + 2720
+    v2721: i32 := v2720 + 2721
+    v2722: i32 := v2721 + 2722
+    v2723: i32 := v2722 + 2723
+    v2724: i32 := v2723 + 2724
+    v2725: i32 := v2724 + 2725
+    v2726: i32 := v2725 + 2726
+    v2727: i32 := v2726 + 2727
+    v2728: i32 := v2727 + 2728
+    v2729: i32 := v2728 + 2729
+    v2730: i32 := v2729 + 2730
+    v2731: i32 := v2730 + 2731
+    v2732: i32 := v2731 + 2732
+    v2733: i32 := v2732 + 2733
+    v2734: i32 := v2733 + 2734
+    v2735: i32 := v2734 + 2735
+    v2736: i32 := v2735 + 2736
+    v2737: i32 := v2736 + 2737
+    v2738: i32 := v2737 + 2738
+    v2739: i32 := v2738 + 2739
+    v2740: i32 := v2739 + 2740
+    v2741: i32 := v2740 + 2741
+    v2742: i32 := v2741 + 2742
+    v2743: i32 := v2742 + 2743
+    v2744: i32 := v2743 + 2744
+    v2745: i32 := v2744 + 2745
+    v2746: i32 := v2745 + 2746
+    v2747: i32 := v2746 + 2747
+    v2748: i32 := v2747 + 2748
+    v2749: i32 := v2748 + 2749
+    v2750: i32 := v2749 + 2750
+    v2751: i32 := v2750 + 2751
+    v2752: i32 := v2751 + 2752
+    v2753: i32 := v2752 + 2753
+    v2754: i32 := v2753 + 2754
+    v2755: i32 := v2754 + 2755
+    v2756: i32 := v2755 + 2756
+    v2757: i32 := v2756 + 2757
+    v2758: i32 := v2757 + 2758
+    v2759: i32 := v2758 + 2759
+    v2760: i32 := v2759 + 2760
+    v2761: i32 := v2760 + 2761
+    v2762: i32 := v2761 + 2762
+    v2763: i32 := v2762 + 2763
+    v2764: i32 := v2763 + 2764
+    v2765: i32 := v2764 + 2765
+    v2766: i32 := v2765 + 2766
+    v2767: i32 := v2766 + 2767
+    v2768: i32 := v2767 + 2768
+    v2769: i32 := v2768 + 2769
+    v2770: i32 := v2769 + 2770
+    v2771: i32 := v2770 + 2771
+    v2772: i32 := v2771 + 2772
+    v2773: i32 := v2772 + 2773
+    v2774: i32 := v2773 + 2774
+    v2775: i32 := v2774 + 2775
+    v2776: i32 := v2775 + 2776
+    v2777: i32 := v2776 + 2777
+    v2778: i32 := v2777 + 2778
+    v2779: i32 := v2778 + 2779
+    v2780: i32 := v2779 + 2780
+    v2781: i32 := v2780 + 2781
+    v2782: i32 := v2781 + 2782
+    v2783: i32 := v2782 + 2783
+    v2784: i32 := v2783 + 2784
+    v2785: i32 := v2784 + 2785
+    v2786: i32 := v2785 + 2786
+    v2787: i32 := v2786 + 2787
+    v2788: i32 := v2787 + 2788
+    v2789: i32 := v2788 + 2789
+    v2790: i32 := v2789 + 2790
+    v2791: i32 := v2790 + 2791
+    v2792: i32 := v2791 + 2792
+    v2793: i32 := v2792 + 2793
+    v2794: i32 := v2793 + 2794
+    v2795: i32 := v2794 + 2795
+    v2796: i32 := v2795 + 2796
+    v2797: i32 := v2796 + 2797
+    v2798: i32 := v2797 + 2798
+    v2799: i32 := v2798 + 2799
+    v2800: i32 := v2799 + 2800
+    v2801: i32 := v2800 + 2801
+    v2802: i32 := v2801 + 2802
+    v2803: i32 := v2802 + 2803
+    v2804: i32 := v2803 + 2804
+    v2805: i32 := v2804 + 2805
+    v2806: i32 := v2805 + 2806
+    v2807: i32 := v2806 + 2807
+    v2808: i32 := v2807 + 2808
+    v2809: i32 := v2808 + 2809
+    v2810: i32 := v2809 + 2810
+    v2811: i32 := v2810 + 2811
+    v2812: i32 := v2811 + 2812
+    v2813: i32 := v2812 + 2813
+    v2814: i32 := v2813 + 2814
+    v2815: i32 := v2814 + 2815
+    v2816: i32 := v2815 + 2816
+    v2817: i32 := v2816 + 2817
+    v2818: i32 := v2817 + 2818
+    v2819: i32 := v2818 + 2819
+    v2820: i32 := v2819 + 2820
+    v2821: i32 := v2820 + 2821
+    v2822: i32 := v2821 + 2822
+    v2823: i32 := v2822 + 2823
+    v2824: i32 := v2823 + 2824
+    v2825: i32 := v2824 + 2825
+    v2826: i32 := v2825 + 2826
+    v2827: i32 := v2826 + 2827
+    v2828: i32 := v2827 + 2828
+    v2829: i32 := v2828 + 2829
+    v2830: i32 := v2829 + 2830
+    v2831: i32 := v2830 + 2831
+    v2832: i32 := v2831 + 2832
+    v2833: i32 := v2832 + 2833
+    v2834: i32 := v2833 + 2834
+    v2835: i32 := v2834 + 2835
+    v2836: i32 := v2835 + 2836
+    v2837: i32 := v2836 + 2837
+    v2838: i32 := v2837 + 2838
+    v2839: i32 := v2838 + 2839
+    v2840: i32 := v2839 + 2840
+    v2841: i32 := v2840 + 2841
+    v2842: i32 := v2841 + 2842
+    v2843: i32 := v2842 + 2843
+    v2844: i32 := v2843 + 2844
+    v2845: i32 := v2844 + 2845
+    v2846: i32 := v2845 + 2846
+    v2847: i32 := v2846 + 2847
+    v2848: i32 := v2847 + 2848
+    v2849: i32 := v2848 + 2849
+    v2850: i32 := v2849 + 2850
+    v2851: i32 := v2850 + 2851
+    v2852: i32 := v2851 + 2852
+    v2853: i32 := v2852 + 2853
+    v2854: i32 := v2853 + 2854
+    v2855: i32 := v2854 + 2855
+    v2856: i32 := v2855 + 2856
+    v2857: i32 := v2856 + 2857
+    v2858: i32 := v2857 + 2858
+    v2859: i32 := v2858 + 2859
+    v2860: i32 := v2859 + 2860
+    v2861: i32 := v2860 + 2861
+    v2862: i32 := v2861 + 2862
+    v2863: i32 := v2862 + 2863
+    v2864: i32 := v2863 + 2864
+    v2865: i32 := v2864 + 2865
+    v2866: i32 := v2865 + 2866
+    v2867: i32 := v2866 + 2867
+    v2868: i32 := v2867 + 2868
+    v2869: i32 := v2868 + 2869
+    v2870: i32 := v2869 + 2870
+    v2871: i32 := v2870 + 2871
+    v2872: i32 := v2871 + 2872
+    v2873: i32 := v2872 + 2873
+    v2874: i32 := v2873 + 2874
+    v2875: i32 := v2874 + 2875
+    v2876: i32 := v2875 + 2876
+    v2877: i32 := v2876 + 2877
+    v2878: i32 := v2877 + 2878
+    v2879: i32 := v2878 + 2879
+    v2880: i32 := v2879 + 2880
+    v2881: i32 := v2880 + 2881
+    v2882: i32 := v2881 + 2882
+    v2883: i32 := v2882 + 2883
+    v2884: i32 := v2883 + 2884
+    v2885: i32 := v2884 + 2885
+    v2886: i32 := v2885 + 2886
+    v2887: i32 := v2886 + 2887
+    v2888: i32 := v2887 + 2888
+    v2889: i32 := v2888 + 2889
+    v2890: i32 := v2889 + 2890
+    v2891: i32 := v2890 + 2891
+    v2892: i32 := v2891 + 2892
+    v2893: i32 := v2892 + 2893
+    v2894: i32 := v2893 + 2894
+    v2895: i32 := v2894 + 2895
+    v2896: i32 := v2895 + 2896
+    v2897: i32 := v2896 + 2897
+    v2898: i32 := v2897 + 2898
+    v2899: i32 := v2898 + 2899
+    v2900: i32 := v2899 + 2900
+    v2901: i32 := v2900 + 2901
+    v2902: i32 := v2901 + 2902
+    v2903: i32 := v2902 + 2903
+    v2904: i32 := v2903 + 2904
+    v2905: i32 := v2904 + 2905
+    v2906: i32 := v2905 + 2906
+    v2907: i32 := v2906 + 2907
+    v2908: i32 := v2907 + 2908
+    v2909: i32 := v2908 + 2909
+    v2910: i32 := v2909 + 2910
+    v2911: i32 := v2910 + 2911
+    v2912: i32 := v2911 + 2912
+    v2913: i32 := v2912 + 2913
+    v2914: i32 := v2913 + 2914
+    v2915: i32 := v2914 + 2915
+    v2916: i32 := v2915 + 2916
+    v2917: i32 := v2916 + 2917
+    v2918: i32 := v2917 + 2918
+    v2919: i32 := v2918 + 2919
+    v2920: i32 := v2919 + 2920
+    v2921: i32 := v2920 + 2921
+    v2922: i32 := v2921 + 2922
+    v2923: i32 := v2922 + 2923
+    v2924: i32 := v2923 + 2924
+    v2925: i32 := v2924 + 2925
+    v2926: i32 := v2925 + 2926
+    v2927: i32 := v2926 + 2927
+    v2928: i32 := v2927 + 2928
+    v2929: i32 := v2928 + 2929
+    v2930: i32 := v2929 + 2930
+    v2931: i32 := v2930 + 2931
+    v2932: i32 := v2931 + 2932
+    v2933: i32 := v2932 + 2933
+    v2934: i32 := v2933 + 2934
+    v2935: i32 := v2934 + 2935
+    v2936: i32 := v2935 + 2936
+    v2937: i32 := v2936 + 2937
+    v2938: i32 := v2937 + 2938
+    v2939: i32 := v2938 + 2939
+    v2940: i32 := v2939 + 2940
+    v2941: i32 := v2940 + 2941
+    v2942: i32 := v2941 + 2942
+    v2943: i32 := v2942 + 2943
+    v2944: i32 := v2943 + 2944
+    v2945: i32 := v2944 + 2945
+    v2946: i32 := v2945 + 2946
+    v2947: i32 := v2946 + 2947
+    v2948: i32 := v2947 + 2948
+    v2949: i32 := v2948 + 2949
+    v2950: i32 := v2949 + 2950
+    v2951: i32 := v2950 + 2951
+    v2952: i32 := v2951 + 2952
+    v2953: i32 := v2952 + 2953
+    v2954: i32 := v2953 + 2954
+    v2955: i32 := v2954 + 2955
+    v2956: i32 := v2955 + 2956
+    v2957: i32 := v2956 + 2957
+    v2958: i32 := v2957 + 2958
+    v2959: i32 := v2958 + 2959
+    v2960: i32 := v2959 + 2960
+    v2961: i32 := v2960 + 2961
+    v2962: i32 := v2961 + 2962
+    v2963: i32 := v2962 + 2963
+    v2964: i32 := v2963 + 2964
+    v2965: i32 := v2964 + 2965
+    v2966: i32 := v2965 + 2966
+    v2967: i32 := v2966 + 2967
+    v2968: i32 := v2967 + 2968
+    v2969: i32 := v2968 + 2969
+    v2970: i32 := v2969 + 2970
+    v2971: i32 := v2970 + 2971
+    v2972: i32 := v2971 + 2972
+    v2973: i32 := v2972 + 2973
+    v2974: i32 := v2973 + 2974
+    v2975: i32 := v2974 + 2975
+    v2976: i32 := v2975 + 2976
+    v2977: i32 := v2976 + 2977
+    v2978: i32 := v2977 + 2978
+    v2979: i32 := v2978 + 2979
+    v2980: i32 := v2979 + 2980
+    v2981: i32 := v2980 + 2981
+    v2982: i32 := v2981 + 2982
+    v2983: i32 := v2982 + 2983
+    v2984: i32 := v2983 + 2984
+    v2985: i32 := v2984 + 2985
+    v2986: i32 := v2985 + 2986
+    v2987: i32 := v2986 + 2987
+    v2988: i32 := v2987 + 2988
+    v2989: i32 := v2988 + 2989
+    v2990: i32 := v2989 + 2990
+    v2991: i32 := v2990 + 2991
+    v2992: i32 := v2991 + 2992
+    v2993: i32 := v2992 + 2993
+    v2994: i32 := v2993 + 2994
+    v2995: i32 := v2994 + 2995
+    v2996: i32 := v2995 + 2996
+    v2997: i32 := v2996 + 2997
+    v2998: i32 := v2997 + 2998
+    v2999: i32 := v2998 + 2999
+    v3000: i32 := v2999 + 3000
+    v3001: i32 := v3000 + 3001
+    v3002: i32 := v3001 + 3002
+    v3003: i32 := v3002 + 3003
+    v3004: i32 := v3003 + 3004
+    v3005: i32 := v3004 + 3005
+    v3006: i32 := v3005 + 3006
+    v3007: i32 := v3006 + 3007
+    v3008: i32 := v3007 + 3008
+    v3009: i32 := v3008 + 3009
+    v3010: i32 := v3009 + 3010
+    v3011: i32 := v3010 + 3011
+    v3012: i32 := v3011 + 3012
+    v3013: i32 := v3012 + 3013
+    v3014: i32 := v3013 + 3014
+    v3015: i32 := v3014 + 3015
+    v3016: i32 := v3015 + 3016
+    v3017: i32 := v3016 + 3017
+    v3018: i32 := v3017 + 3018
+    v3019: i32 := v3018 + 3019
+    v3020: i32 := v3019 + 3020
+    v3021: i32 := v3020 + 3021
+    v3022: i32 := v3021 + 3022
+    v3023: i32 := v3022 + 3023
+    v3024: i32 := v3023 + 3024
+    v3025: i32 := v3024 + 3025
+    v3026: i32 := v3025 + 3026
+    v3027: i32 := v3026 + 3027
+    v3028: i32 := v3027 + 3028
+    v3029: i32 := v3028 + 3029
+    v3030: i32 := v3029 + 3030
+    v3031: i32 := v3030 + 3031
+    v3032: i32 := v3031 + 3032
+    v3033: i32 := v3032 + 3033
+    v3034: i32 := v3033 + 3034
+    v3035: i32 := v3034 + 3035
+    v3036: i32 := v3035 + 3036
+    v3037: i32 := v3036 + 3037
+    v3038: i32 := v3037 + 3038
+    v3039: i32 := v3038 + 3039
+    v3040: i32 := v3039 + 3040
+    v3041: i32 := v3040 + 3041
+    v3042: i32 := v3041 + 3042
+    v3043: i32 := v3042 + 3043
+    v3044: i32 := v3043 + 3044
+    v3045: i32 := v3044 + 3045
+    v3046: i32 := v3045 + 3046
+    v3047: i32 := v3046 + 3047
+    v3048: i32 := v3047 + 3048
+    v3049: i32 := v3048 + 3049
+    v3050: i32 := v3049 + 3050
+    v3051: i32 := v3050 + 3051
+    v3052: i32 := v3051 + 3052
+    v3053: i32 := v3052 + 3053
+    v3054: i32 := v3053 + 3054
+    v3055: i32 := v3054 + 3055
+    v3056: i32 := v3055 + 3056
+    v3057: i32 := v3056 + 3057
+    v3058: i32 := v3057 + 3058
+    v3059: i32 := v3058 + 3059
+    v3060: i32 := v3059 + 3060
+    v3061: i32 := v3060 + 3061
+    v3062: i32 := v3061 + 3062
+    v3063: i32 := v3062 + 3063
+    v3064: i32 := v3063 + 3064
+    v3065: i32 := v3064 + 3065
+    v3066: i32 := v3065 + 3066
+    v3067: i32 := v3066 + 3067
+    v3068: i32 := v3067 + 3068
+    v3069: i32 := v3068 + 3069
+    v3070: i32 := v3069 + 3070
+    v3071: i32 := v3070 + 3071
+    v3072: i32 := v3071 + 3072
+    v3073: i32 := v3072 + 3073
+    v3074: i32 := v3073 + 3074
+    v3075: i32 := v3074 + 3075
+    v3076: i32 := v3075 + 3076
+    v3077: i32 := v3076 + 3077
+    v3078: i32 := v3077 + 3078
+    v3079: i32 := v3078 + 3079
+    v3080: i32 := v3079 + 3080
+    v3081: i32 := v3080 + 3081
+    v3082: i32 := v3081 + 3082
+    v3083: i32 := v3082 + 3083
+    v3084: i32 := v3083 + 3084
+    v3085: i32 := v3084 + 3085
+    v3086: i32 := v3085 + 3086
+    v3087: i32 := v3086 + 3087
+    v3088: i32 := v3087 + 3088
+    v3089: i32 := v3088 + 3089
+    v3090: i32 := v3089 + 3090
+    v3091: i32 := v3090 + 3091
+    v3092: i32 := v3091 + 3092
+    v3093: i32 := v3092 + 3093
+    v3094: i32 := v3093 + 3094
+    v3095: i32 := v3094 + 3095
+    v3096: i32 := v3095 + 3096
+    v3097: i32 := v3096 + 3097
+    v3098: i32 := v3097 + 3098
+    v3099: i32 := v3098 + 3099
+    v3100: i32 := v3099 + 3100
+    v3101: i32 := v3100 + 3101
+    v3102: i32 := v3101 + 3102
+    v3103: i32 := v3102 + 3103
+    v3104: i32 := v3103 + 3104
+    v3105: i32 := v3104 + 3105
+    v3106: i32 := v3105 + 3106
+    v3107: i32 := v3106 + 3107
+    v3108: i32 := v3107 + 3108
+    v3109: i32 := v3108 + 3109
+    v3110: i32 := v3109 + 3110
+    v3111: i32 := v3110 + 3111
+    v3112: i32 := v3111 + 3112
+    v3113: i32 := v3112 + 3113
+    v3114: i32 := v3113 + 3114
+    v3115: i32 := v3114 + 3115
+    v3116: i32 := v3115 + 3116
+    v3117: i32 := v3116 + 3117
+    v3118: i32 := v3117 + 3118
+    v3119: i32 := v3118 + 3119
+    v3120: i32 := v3119 + 3120
+    v3121: i32 := v3120 + 3121
+    v3122: i32 := v3121 + 3122
+    v3123: i32 := v3122 + 3123
+    v3124: i32 := v3123 + 3124
+    v3125: i32 := v3124 + 3125
+    v3126: i32 := v3125 + 3126
+    v3127: i32 := v3126 + 3127
+    v3128: i32 := v3127 + 3128
+    v3129: i32 := v3128 + 3129
+    v3130: i32 := v3129 + 3130
+    v3131: i32 := v3130 + 3131
+    v3132: i32 := v3131 + 3132
+    v3133: i32 := v3132 + 3133
+    v3134: i32 := v3133 + 3134
+    v3135: i32 := v3134 + 3135
+    v3136: i32 := v3135 + 3136
+    v3137: i32 := v3136 + 3137
+    v3138: i32 := v3137 + 3138
+    v3139: i32 := v3138 + 3139
+    v3140: i32 := v3139 + 3140
+    v3141: i32 := v3140 + 3141
+    v3142: i32 := v3141 + 3142
+    v3143: i32 := v3142 + 3143
+    v3144: i32 := v3143 + 3144
+    v3145: i32 := v3144 + 3145
+    v3146: i32 := v3145 + 3146
+    v3147: i32 := v3146 + 3147
+    v3148: i32 := v3147 + 3148
+    v3149: i32 := v3148 + 3149
+    v3150: i32 := v3149 + 3150
+    v3151: i32 := v3150 + 3151
+    v3152: i32 := v3151 + 3152
+    v3153: i32 := v3152 + 3153
+    v3154: i32 := v3153 + 3154
+    v3155: i32 := v3154 + 3155
+    v3156: i32 := v3155 + 3156
+    v3157: i32 := v3156 + 3157
+    v3158: i32 := v3157 + 3158
+    v3159: i32 := v3158 + 3159
+    v3160: i32 := v3159 + 3160
+    v3161: i32 := v3160 + 3161
+    v3162: i32 := v3161 + 3162
+    v3163: i32 := v3162 + 3163
+    v3164: i32 := v3163 + 3164
+    v3165: i32 := v3164 + 3165
+    v3166: i32 := v3165 + 3166
+    v3167: i32 := v3166 + 3167
+    v3168: i32 := v3167 + 3168
+    v3169: i32 := v3168 + 3169
+    v3170: i32 := v3169 + 3170
+    v3171: i32 := v3170 + 3171
+    v3172: i32 := v3171 + 3172
+    v3173: i32 := v3172 + 3173
+    v3174: i32 := v3173 + 3174
+    v3175: i32 := v3174 + 3175
+    v3176: i32 := v3175 + 3176
+    v3177: i32 := v3176 + 3177
+    v3178: i32 := v3177 + 3178
+    v3179: i32 := v3178 + 3179
+    v3180: i32 := v3179 + 3180
+    v3181: i32 := v3180 + 3181
+    v3182: i32 := v3181 + 3182
+    v3183: i32 := v3182 + 3183
+    v3184: i32 := v3183 + 3184
+    v3185: i32 := v3184 + 3185
+    v3186: i32 := v3185 + 3186
+    v3187: i32 := v3186 + 3187
+    v3188: i32 := v3187 + 3188
+    v3189: i32 := v3188 + 3189
+    v3190: i32 := v3189 + 3190
+    v3191: i32 := v3190 + 3191
+    v3192: i32 := v3191 + 3192
+    v3193: i32 := v3192 + 3193
+    v3194: i32 := v3193 + 3194
+    v3195: i32 := v3194 + 3195
+    v3196: i32 := v3195 + 3196
+    v3197: i32 := v3196 + 3197
+    v3198: i32 := v3197 + 3198
+    v3199: i32 := v3198 + 3199
+    v3200: i32 := v3199 + 3200
+    v3201: i32 := v3200 + 3201
+    v3202: i32 := v3201 + 3202
+    v3203: i32 := v3202 + 3203
+    v3204: i32 := v3203 + 3204
+    v3205: i32 := v3204 + 3205
+    v3206: i32 := v3205 + 3206
+    v3207: i32 := v3206 + 3207
+    v3208: i32 := v3207 + 3208
+    v3209: i32 := v3208 + 3209
+    v3210: i32 := v3209 + 3210
+    v3211: i32 := v3210 + 3211
+    v3212: i32 := v3211 + 3212
+    v3213: i32 := v3212 + 3213
+    v3214: i32 := v3213 + 3214
+    v3215: i32 := v3214 + 3215
+    v3216: i32 := v3215 + 3216
+    v3217: i32 := v3216 + 3217
+    v3218: i32 := v3217 + 3218
+    v3219: i32 := v3218 + 3219
+    v3220: i32 := v3219 + 3220
+    v3221: i32 := v3220 + 3221
+    v3222: i32 := v3221 + 3222
+    v3223: i32 := v3222 + 3223
+    v3224: i32 := v3223 + 3224
+    v3225: i32 := v3224 + 3225
+    v3226: i32 := v3225 + 3226
+    v3227: i32 := v3226 + 3227
+    v3228: i32 := v3227 + 3228
+    v3229: i32 := v3228 + 3229
+    v3230: i32 := v3229 + 3230
+    v3231: i32 := v3230 + 3231
+    v3232: i32 := v3231 + 3232
+    v3233: i32 := v3232 + 3233
+    v3234: i32 := v3233 + 3234
+    v3235: i32 := v3234 + 3235
+    v3236: i32 := v3235 + 3236
+    v3237: i32 := v3236 + 3237
+    v3238: i32 := v3237 + 3238
+    v3239: i32 := v3238 + 3239
+    v3240: i32 := v3239 + 3240
+    v3241: i32 := v3240 + 3241
+    v3242: i32 := v3241 + 3242
+    v3243: i32 := v3242 + 3243
+    v3244: i32 := v3243 + 3244
+    v3245: i32 := v3244 + 3245
+    v3246: i32 := v3245 + 3246
+    v3247: i32 := v3246 + 3247
+    v3248: i32 := v3247 + 3248
+    v3249: i32 := v3248 + 3249
+    v3250: i32 := v3249 + 3250
+    v3251: i32 := v3250 + 3251
+    v3252: i32 := v3251 + 3252
+    v3253: i32 := v3252 + 3253
+    v3254: i32 := v3253 + 3254
+    v3255: i32 := v3254 + 3255
+    v3256: i32 := v3255 + 3256
+    v3257: i32 := v3256 + 3257
+    v3258: i32 := v3257 + 3258
+    v3259: i32 := v3258 + 3259
+    v3260: i32 := v3259 + 3260
+    v3261: i32 := v3260 + 3261
+    v3262: i32 := v3261 + 3262
+    v3263: i32 := v3262 + 3263
+    v3264: i32 := v3263 + 3264
+    v3265: i32 := v3264 + 3265
+    v3266: i32 := v3265 + 3266
+    v3267: i32 := v3266 + 3267
+    v3268: i32 := v3267 + 3268
+    v3269: i32 := v3268 + 3269
+    v3270: i32 := v3269 + 3270
+    v3271: i32 := v3270 + 3271
+    v3272: i32 := v3271 + 3272
+    v3273: i32 := v3272 + 3273
+    v3274: i32 := v3273 + 3274
+    v3275: i32 := v3274 + 3275
+    v3276: i32 := v3275 + 3276
+    v3277: i32 := v3276 + 3277
+    v3278: i32 := v3277 + 3278
+    v3279: i32 := v3278 + 3279
+    v3280: i32 := v3279 + 3280
+    v3281: i32 := v3280 + 3281
+    v3282: i32 := v3281 + 3282
+    v3283: i32 := v3282 + 3283
+    v3284: i32 := v3283 + 3284
+    v3285: i32 := v3284 + 3285
+    v3286: i32 := v3285 + 3286
+    v3287: i32 := v3286 + 3287
+    v3288: i32 := v3287 + 3288
+    v3289: i32 := v3288 + 3289
+    v3290: i32 := v3289 + 3290
+    v3291: i32 := v3290 + 3291
+    v3292: i32 := v3291 + 3292
+    v3293: i32 := v3292 + 3293
+    v3294: i32 := v3293 + 3294
+    v3295: i32 := v3294 + 3295
+    v3296: i32 := v3295 + 3296
+    v3297: i32 := v3296 + 3297
+    v3298: i32 := v3297 + 3298
+    v3299: i32 := v3298 + 3299
+    v3300: i32 := v3299 + 3300
+    v3301: i32 := v3300 + 3301
+    v3302: i32 := v3301 + 3302
+    v3303: i32 := v3302 + 3303
+    v3304: i32 := v3303 + 3304
+    v3305: i32 := v3304 + 3305
+    v3306: i32 := v3305 + 3306
+    v3307: i32 := v3306 + 3307
+    v3308: i32 := v3307 + 3308
+    v3309: i32 := v3308 + 3309
+    v3310: i32 := v3309 + 3310
+    v3311: i32 := v3310 + 3311
+    v3312: i32 := v3311 + 3312
+    v3313: i32 := v3312 + 3313
+    v3314: i32 := v3313 + 3314
+    v3315: i32 := v3314 + 3315
+    v3316: i32 := v3315 + 3316
+    v3317: i32 := v3316 + 3317
+    v3318: i32 := v3317 + 3318
+    v3319: i32 := v3318 + 3319
+    v3320: i32 := v3319 + 3320
+    v3321: i32 := v3320 + 3321
+    v3322: i32 := v3321 + 3322
+    v3323: i32 := v3322 + 3323
+    v3324: i32 := v3323 + 3324
+    v3325: i32 := v3324 + 3325
+    v3326: i32 := v3325 + 3326
+    v3327: i32 := v3326 + 3327
+    v3328: i32 := v3327 + 3328
+    v3329: i32 := v3328 + 3329
+    v3330: i32 := v3329 + 3330
+    v3331: i32 := v3330 + 3331
+    v3332: i32 := v3331 + 3332
+    v3333: i32 := v3332 + 3333
+    v3334: i32 := v3333 + 3334
+    v3335: i32 := v3334 + 3335
+    v3336: i32 := v3335 + 3336
+    v3337: i32 := v3336 + 3337
+    v3338: i32 := v3337 + 3338
+    v3339: i32 := v3338 + 3339
+    v3340: i32 := v3339 + 3340
+    v3341: i32 := v3340 + 3341
+    v3342: i32 := v3341 + 3342
+    v3343: i32 := v3342 + 3343
+    v3344: i32 := v3343 + 3344
+    v3345: i32 := v3344 + 3345
+    v3346: i32 := v3345 + 3346
+    v3347: i32 := v3346 + 3347
+    v3348: i32 := v3347 + 3348
+    v3349: i32 := v3348 + 3349
+    v3350: i32 := v3349 + 3350
+    v3351: i32 := v3350 + 3351
+    v3352: i32 := v3351 + 3352
+    v3353: i32 := v3352 + 3353
+    v3354: i32 := v3353 + 3354
+    v3355: i32 := v3354 + 3355
+    v3356: i32 := v3355 + 3356
+    v3357: i32 := v3356 + 3357
+    v3358: i32 := v3357 + 3358
+    v3359: i32 := v3358 + 3359
+    v3360: i32 := v3359 + 3360
+    v3361: i32 := v3360 + 3361
+    v3362: i32 := v3361 + 3362
+    v3363: i32 := v3362 + 3363
+    v3364: i32 := v3363 + 3364
+    v3365: i32 := v3364 + 3365
+    v3366: i32 := v3365 + 3366
+    v3367: i32 := v3366 + 3367
+    v3368: i32 := v3367 + 3368
+    v3369: i32 := v3368 + 3369
+    v3370: i32 := v3369 + 3370
+    v3371: i32 := v3370 + 3371
+    v3372: i32 := v3371 + 3372
+    v3373: i32 := v3372 + 3373
+    v3374: i32 := v3373 + 3374
+    v3375: i32 := v3374 + 3375
+    v3376: i32 := v3375 + 3376
+    v3377: i32 := v3376 + 3377
+    v3378: i32 := v3377 + 3378
+    v3379: i32 := v3378 + 3379
+    v3380: i32 := v3379 + 3380
+    v3381: i32 := v3380 + 3381
+    v3382: i32 := v3381 + 3382
+    v3383: i32 := v3382 + 3383
+    v3384: i32 := v3383 + 3384
+    v3385: i32 := v3384 + 3385
+    v3386: i32 := v3385 + 3386
+    v3387: i32 := v3386 + 3387
+    v3388: i32 := v3387 + 3388
+    v3389: i32 := v3388 + 3389
+    v3390: i32 := v3389 + 3390
+    v3391: i32 := v3390 + 3391
+    v3392: i32 := v3391 + 3392
+    v3393: i32 := v3392 + 3393
+    v3394: i32 := v3393 + 3394
+    v3395: i32 := v3394 + 3395
+    v3396: i32 := v3395 + 3396
+    v3397: i32 := v3396 + 3397
+    v3398: i32 := v3397 + 3398
+    v3399: i32 := v3398 + 3399
+    v3400: i32 := v3399 + 3400
+    v3401: i32 := v3400 + 3401
+    v3402: i32 := v3401 + 3402
+    v3403: i32 := v3402 + 3403
+    v3404: i32 := v3403 + 3404
+    v3405: i32 := v3404 + 3405
+    v3406: i32 := v3405 + 3406
+    v3407: i32 := v3406 + 3407
+    v3408: i32 := v3407 + 3408
+    v3409: i32 := v3408 + 3409
+    v3410: i32 := v3409 + 3410
+    v3411: i32 := v3410 + 3411
+    v3412: i32 := v3411 + 3412
+    v3413: i32 := v3412 + 3413
+    v3414: i32 := v3413 + 3414
+    v3415: i32 := v3414 + 3415
+    v3416: i32 := v3415 + 3416
+    v3417: i32 := v3416 + 3417
+    v3418: i32 := v3417 + 3418
+    v3419: i32 := v3418 + 3419
+    v3420: i32 := v3419 + 3420
+    v3421: i32 := v3420 + 3421
+    v3422: i32 := v3421 + 3422
+    v3423: i32 := v3422 + 3423
+    v3424: i32 := v3423 + 3424
+    v3425: i32 := v3424 + 3425
+    v3426: i32 := v3425 + 3426
+    v3427: i32 := v3426 + 3427
+    v3428: i32 := v3427 + 3428
+    v3429: i32 := v3428 + 3429
+    v3430: i32 := v3429 + 3430
+    v3431: i32 := v3430 + 3431
+    v3432: i32 := v3431 + 3432
+    v3433: i32 := v3432 + 3433
+    v3434: i32 := v3433 + 3434
+    v3435: i32 := v3434 + 3435
+    v3436: i32 := v3435 + 3436
+    v3437: i32 := v3436 + 3437
+    v3438: i32 := v3437 + 3438
+    v3439: i32 := v3438 + 3439
+    v3440: i32 := v3439 + 3440
+    v3441: i32 := v3440 + 3441
+    v3442: i32 := v3441 + 3442
+    v3443: i32 := v3442 + 3443
+    v3444: i32 := v3443 + 3444
+    v3445: i32 := v3444 + 3445
+    v3446: i32 := v3445 + 3446
+    v3447: i32 := v3446 + 3447
+    v3448: i32 := v3447 + 3448
+    v3449: i32 := v3448 + 3449
+    v3450: i32 := v3449 + 3450
+    v3451: i32 := v3450 + 3451
+    v3452: i32 := v3451 + 3452
+    v3453: i32 := v3452 + 3453
+    v3454: i32 := v3453 + 3454
+    v3455: i32 := v3454 + 3455
+    v3456: i32 := v3455 + 3456
+    v3457: i32 := v3456 + 3457
+    v3458: i32 := v3457 + 3458
+    v3459: i32 := v3458 + 3459
+    v3460: i32 := v3459 + 3460
+    v3461: i32 := v3460 + 3461
+    v3462: i32 := v3461 + 3462
+    v3463: i32 := v3462 + 3463
+    v3464: i32 := v3463 + 3464
+    v3465: i32 := v3464 + 3465
+    v3466: i32 := v3465 + 3466
+    v3467: i32 := v3466 + 3467
+    v3468: i32 := v3467 + 3468
+    v3469: i32 := v3468 + 3469
+    v3470: i32 := v3469 + 3470
+    v3471: i32 := v3470 + 3471
+    v3472: i32 := v3471 + 3472
+    v3473: i32 := v3472 + 3473
+    v3474: i32 := v3473 + 3474
+    v3475: i32 := v3474 + 3475
+    v3476: i32 := v3475 + 3476
+    v3477: i32 := v3476 + 3477
+    v3478: i32 := v3477 + 3478
+    v3479: i32 := v3478 + 3479
+    v3480: i32 := v3479 + 3480
+    v3481: i32 := v3480 + 3481
+    v3482: i32 := v3481 + 3482
+    v3483: i32 := v3482 + 3483
+    v3484: i32 := v3483 + 3484
+    v3485: i32 := v3484 + 3485
+    v3486: i32 := v3485 + 3486
+    v3487: i32 := v3486 + 3487
+    v3488: i32 := v3487 + 3488
+    v3489: i32 := v3488 + 3489
+    v3490: i32 := v3489 + 3490
+    v3491: i32 := v3490 + 3491
+    v3492: i32 := v3491 + 3492
+    v3493: i32 := v3492 + 3493
+    v3494: i32 := v3493 + 3494
+    v3495: i32 := v3494 + 3495
+    v3496: i32 := v3495 + 3496
+    v3497: i32 := v3496 + 3497
+    v3498: i32 := v3497 + 3498
+    v3499: i32 := v3498 + 3499
+    v3500: i32 := v3499 + 3500
+    v3501: i32 := v3500 + 3501
+    v3502: i32 := v3501 + 3502
+    v3503: i32 := v3502 + 3503
+    v3504: i32 := v3503 + 3504
+    v3505: i32 := v3504 + 3505
+    v3506: i32 := v3505 + 3506
+    v3507: i32 := v3506 + 3507
+    v3508: i32 := v3507 + 3508
+    v3509: i32 := v3508 + 3509
+    v3510: i32 := v3509 + 3510
+    v3511: i32 := v3510 + 3511
+    v3512: i32 := v3511 + 3512
+    v3513: i32 := v3512 + 3513
+    v3514: i32 := v3513 + 3514
+    v3515: i32 := v3514 + 3515
+    v3516: i32 := v3515 + 3516
+    v3517: i32 := v3516 + 3517
+    v3518: i32 := v3517 + 3518
+    v3519: i32 := v3518 + 3519
+    v3520: i32 := v3519 + 3520
+    v3521: i32 := v3520 + 3521
+    v3522: i32 := v3521 + 3522
+    v3523: i32 := v3522 + 3523
+    v3524: i32 := v3523 + 3524
+    v3525: i32 := v3524 + 3525
+    v3526: i32 := v3525 + 3526
+    v3527: i32 := v3526 + 3527
+    v3528: i32 := v3527 + 3528
+    v3529: i32 := v3528 + 3529
+    v3530: i32 := v3529 + 3530
+    v3531: i32 := v3530 + 3531
+    v3532: i32 := v3531 + 3532
+    v3533: i32 := v3532 + 3533
+    v3534: i32 := v3533 + 3534
+    v3535: i32 := v3534 + 3535
+    v3536: i32 := v3535 + 3536
+    v3537: i32 := v3536 + 3537
+    v3538: i32 := v3537 + 3538
+    v3539: i32 := v3538 + 3539
+    v3540: i32 := v3539 + 3540
+    v3541: i32 := v3540 + 3541
+    v3542: i32 := v3541 + 3542
+    v3543: i32 := v3542 + 3543
+    v3544: i32 := v3543 + 3544
+    v3545: i32 := v3544 + 3545
+    v3546: i32 := v3545 + 3546
+    v3547: i32 := v3546 + 3547
+    v3548: i32 := v3547 + 3548
+    v3549: i32 := v3548 + 3549
+    v3550: i32 := v3549 + 3550
+    v3551: i32 := v3550 + 3551
+    v3552: i32 := v3551 + 3552
+    v3553: i32 := v3552 + 3553
+    v3554: i32 := v3553 + 3554
+    v3555: i32 := v3554 + 3555
+    v3556: i32 := v3555 + 3556
+    v3557: i32 := v3556 + 3557
+    v3558: i32 := v3557 + 3558
+    v3559: i32 := v3558 + 3559
+    v3560: i32 := v3559 + 3560
+    v3561: i32 := v3560 + 3561
+    v3562: i32 := v3561 + 3562
+    v3563: i32 := v3562 + 3563
+    v3564: i32 := v3563 + 3564
+    v3565: i32 := v3564 + 3565
+    v3566: i32 := v3565 + 3566
+    v3567: i32 := v3566 + 3567
+    v3568: i32 := v3567 + 3568
+    v3569: i32 := v3568 + 3569
+    v3570: i32 := v3569 + 3570
+    v3571: i32 := v3570 + 3571
+    v3572: i32 := v3571 + 3572
+    v3573: i32 := v3572 + 3573
+    v3574: i32 := v3573 + 3574
+    v3575: i32 := v3574 + 3575
+    v3576: i32 := v3575 + 3576
+    v3577: i32 := v3576 + 3577
+    v3578: i32 := v3577 + 3578
+    v3579: i32 := v3578 + 3579
+    v3580: i32 := v3579 + 3580
+    v3581: i32 := v3580 + 3581
+    v3582: i32 := v3581 + 3582
+    v3583: i32 := v3582 + 3583
+    v3584: i32 := v3583 + 3584
+    v3585: i32 := v3584 + 3585
+    v3586: i32 := v3585 + 3586
+    v3587: i32 := v3586 + 3587
+    v3588: i32 := v3587 + 3588
+    v3589: i32 := v3588 + 3589
+    v3590: i32 := v3589 + 3590
+    v3591: i32 := v3590 + 3591
+    v3592: i32 := v3591 + 3592
+    v3593: i32 := v3592 + 3593
+    v3594: i32 := v3593 + 3594
+    v3595: i32 := v3594 + 3595
+    v3596: i32 := v3595 + 3596
+    v3597: i32 := v3596 + 3597
+    v3598: i32 := v3597 + 3598
+    v3599: i32 := v3598 + 3599
+    v3600: i32 := v3599 + 3600
+    v3601: i32 := v3600 + 3601
+    v3602: i32 := v3601 + 3602
+    v3603: i32 := v3602 + 3603
+    v3604: i32 := v3603 + 3604
+    v3605: i32 := v3604 + 3605
+    v3606: i32 := v3605 + 3606
+    v3607: i32 := v3606 + 3607
+    v3608: i32 := v3607 + 3608
+    v3609: i32 := v3608 + 3609
+    v3610: i32 := v3609 + 3610
+    v3611: i32 := v3610 + 3611
+    v3612: i32 := v3611 + 3612
+    v3613: i32 := v3612 + 3613
+    v3614: i32 := v3613 + 3614
+    v3615: i32 := v3614 + 3615
+    v3616: i32 := v3615 + 3616
+    v3617: i32 := v3616 + 3617
+    v3618: i32 := v3617 + 3618
+    v3619: i32 := v3618 + 3619
+    v3620: i32 := v3619 + 3620
+    v3621: i32 := v3620 + 3621
+    v3622: i32 := v3621 + 3622
+    v3623: i32 := v3622 + 3623
+    v3624: i32 := v3623 + 3624
+    v3625: i32 := v3624 + 3625
+    v3626: i32 := v3625 + 3626
+    v3627: i32 := v3626 + 3627
+    v3628: i32 := v3627 + 3628
+    v3629: i32 := v3628 + 3629
+    v3630: i32 := v3629 + 3630
+    v3631: i32 := v3630 + 3631
+    v3632: i32 := v3631 + 3632
+    v3633: i32 := v3632 + 3633
+    v3634: i32 := v3633 + 3634
+    v3635: i32 := v3634 + 3635
+    v3636: i32 := v3635 + 3636
+    v3637: i32 := v3636 + 3637
+    v3638: i32 := v3637 + 3638
+    v3639: i32 := v3638 + 3639
+    v3640: i32 := v3639 + 3640
+    v3641: i32 := v3640 + 3641
+    v3642: i32 := v3641 + 3642
+    v3643: i32 := v3642 + 3643
+    v3644: i32 := v3643 + 3644
+    v3645: i32 := v3644 + 3645
+    v3646: i32 := v3645 + 3646
+    v3647: i32 := v3646 + 3647
+    v3648: i32 := v3647 + 3648
+    v3649: i32 := v3648 + 3649
+    v3650: i32 := v3649 + 3650
+    v3651: i32 := v3650 + 3651
+    v3652: i32 := v3651 + 3652
+    v3653: i32 := v3652 + 3653
+    v3654: i32 := v3653 + 3654
+    v3655: i32 := v3654 + 3655
+    v3656: i32 := v3655 + 3656
+    v3657: i32 := v3656 + 3657
+    v3658: i32 := v3657 + 3658
+    v3659: i32 := v3658 + 3659
+    v3660: i32 := v3659 + 3660
+    v3661: i32 := v3660 + 3661
+    v3662: i32 := v3661 + 3662
+    v3663: i32 := v3662 + 3663
+    v3664: i32 := v3663 + 3664
+    v3665: i32 := v3664 + 3665
+    v3666: i32 := v3665 + 3666
+    v3667: i32 := v3666 + 3667
+    v3668: i32 := v3667 + 3668
+    v3669: i32 := v3668 + 3669
+    v3670: i32 := v3669 + 3670
+    v3671: i32 := v3670 + 3671
+    v3672: i32 := v3671 + 3672
+    v3673: i32 := v3672 + 3673
+    v3674: i32 := v3673 + 3674
+    v3675: i32 := v3674 + 3675
+    v3676: i32 := v3675 + 3676
+    v3677: i32 := v3676 + 3677
+    v3678: i32 := v3677 + 3678
+    v3679: i32 := v3678 + 3679
+    v3680: i32 := v3679 + 3680
+    v3681: i32 := v3680 + 3681
+    v3682: i32 := v3681 + 3682
+    v3683: i32 := v3682 + 3683
+    v3684: i32 := v3683 + 3684
+    v3685: i32 := v3684 + 3685
+    v3686: i32 := v3685 + 3686
+    v3687: i32 := v3686 + 3687
+    v3688: i32 := v3687 + 3688
+    v3689: i32 := v3688 + 3689
+    v3690: i32 := v3689 + 3690
+    v3691: i32 := v3690 + 3691
+    v3692: i32 := v3691 + 3692
+    v3693: i32 := v3692 + 3693
+    v3694: i32 := v3693 + 3694
+    v3695: i32 := v3694 + 3695
+    v3696: i32 := v3695 + 3696
+    v3697: i32 := v3696 + 3697
+    v3698: i32 := v3697 + 3698
+    v3699: i32 := v3698 + 3699
+    v3700: i32 := v3699 + 3700
+    v3701: i32 := v3700 + 3701
+    v3702: i32 := v3701 + 3702
+    v3703: i32 := v3702 + 3703
+    v3704: i32 := v3703 + 3704
+    v3705: i32 := v3704 + 3705
+    v3706: i32 := v3705 + 3706
+    v3707: i32 := v3706 + 3707
+    v3708: i32 := v3707 + 3708
+    v3709: i32 := v3708 + 3709
+    v3710: i32 := v3709 + 3710
+    v3711: i32 := v3710 + 3711
+    v3712: i32 := v3711 + 3712
+    v3713: i32 := v3712 + 3713
+    v3714: i32 := v3713 + 3714
+    v3715: i32 := v3714 + 3715
+    v3716: i32 := v3715 + 3716
+    v3717: i32 := v3716 + 3717
+    v3718: i32 := v3717 + 3718
+    v3719: i32 := v3718 + 3719
+    v3720: i32 := v3719 + 3720
+    v3721: i32 := v3720 + 3721
+    v3722: i32 := v3721 + 3722
+    v3723: i32 := v3722 + 3723
+    v3724: i32 := v3723 + 3724
+    v3725: i32 := v3724 + 3725
+    v3726: i32 := v3725 + 3726
+    v3727: i32 := v3726 + 3727
+    v3728: i32 := v3727 + 3728
+    v3729: i32 := v3728 + 3729
+    v3730: i32 := v3729 + 3730
+    v3731: i32 := v3730 + 3731
+    v3732: i32 := v3731 + 3732
+    v3733: i32 := v3732 + 3733
+    v3734: i32 := v3733 + 3734
+    v3735: i32 := v3734 + 3735
+    v3736: i32 := v3735 + 3736
+    v3737: i32 := v3736 + 3737
+    v3738: i32 := v3737 + 3738
+    v3739: i32 := v3738 + 3739
+    v3740: i32 := v3739 + 3740
+    v3741: i32 := v3740 + 3741
+    v3742: i32 := v3741 + 3742
+    v3743: i32 := v3742 + 3743
+    v3744: i32 := v3743 + 3744
+    v3745: i32 := v3744 + 3745
+    v3746: i32 := v3745 + 3746
+    v3747: i32 := v3746 + 3747
+    v3748: i32 := v3747 + 3748
+    v3749: i32 := v3748 + 3749
+    v3750: i32 := v3749 + 3750
+    v3751: i32 := v3750 + 3751
+    v3752: i32 := v3751 + 3752
+    v3753: i32 := v3752 + 3753
+    v3754: i32 := v3753 + 3754
+    v3755: i32 := v3754 + 3755
+    v3756: i32 := v3755 + 3756
+    v3757: i32 := v3756 + 3757
+    v3758: i32 := v3757 + 3758
+    v3759: i32 := v3758 + 3759
+    v3760: i32 := v3759 + 3760
+    v3761: i32 := v3760 + 3761
+    v3762: i32 := v3761 + 3762
+    v3763: i32 := v3762 + 3763
+    v3764: i32 := v3763 + 3764
+    v3765: i32 := v3764 + 3765
+    v3766: i32 := v3765 + 3766
+    v3767: i32 := v3766 + 3767
+    v3768: i32 := v3767 + 3768
+    v3769: i32 := v3768 + 3769
+    v3770: i32 := v3769 + 3770
+    v3771: i32 := v3770 + 3771
+    v3772: i32 := v3771 + 3772
+    v3773: i32 := v3772 + 3773
+    v3774: i32 := v3773 + 3774
+    v3775: i32 := v3774 + 3775
+    v3776: i32 := v3775 + 3776
+    v3777: i32 := v3776 + 3777
+    v3778: i32 := v3777 + 3778
+    v3779: i32 := v3778 + 3779
+    v3780: i32 := v3779 + 3780
+    v3781: i32 := v3780 + 3781
+    v3782: i32 := v3781 + 3782
+    v3783: i32 := v3782 + 3783
+    v3784: i32 := v3783 + 3784
+    v3785: i32 := v3784 + 3785
+    v3786: i32 := v3785 + 3786
+    v3787: i32 := v3786 + 3787
+    v3788: i32 := v3787 + 3788
+    v3789: i32 := v3788 + 3789
+    v3790: i32 := v3789 + 3790
+    v3791: i32 := v3790 + 3791
+    v3792: i32 := v3791 + 3792
+    v3793: i32 := v3792 + 3793
+    v3794: i32 := v3793 + 3794
+    v3795: i32 := v3794 + 3795
+    v3796: i32 := v3795 + 3796
+    v3797: i32 := v3796 + 3797
+    v3798: i32 := v3797 + 3798
+    v3799: i32 := v3798 + 3799
+    v3800: i32 := v3799 + 3800
+    v3801: i32 := v3800 + 3801
+    v3802: i32 := v3801 + 3802
+    v3803: i32 := v3802 + 3803
+    v3804: i32 := v3803 + 3804
+    v3805: i32 := v3804 + 3805
+    v3806: i32 := v3805 + 3806
+    v3807: i32 := v3806 + 3807
+    v3808: i32 := v3807 + 3808
+    v3809: i32 := v3808 + 3809
+    v3810: i32 := v3809 + 3810
+    v3811: i32 := v3810 + 3811
+    v3812: i32 := v3811 + 3812
+    v3813: i32 := v3812 + 3813
+    v3814: i32 := v3813 + 3814
+    v3815: i32 := v3814 + 3815
+    v3816: i32 := v3815 + 3816
+    v3817: i32 := v3816 + 3817
+    v3818: i32 := v3817 + 3818
+    v3819: i32 := v3818 + 3819
+    v3820: i32 := v3819 + 3820
+    v3821: i32 := v3820 + 3821
+    v3822: i32 := v3821 + 3822
+    v3823: i32 := v3822 + 3823
+    v3824: i32 := v3823 + 3824
+    v3825: i32 := v3824 + 3825
+    v3826: i32 := v3825 + 3826
+    v3827: i32 := v3826 + 3827
+    v3828: i32 := v3827 + 3828
+    v3829: i32 := v3828 + 3829
+    v3830: i32 := v3829 + 3830
+    v3831: i32 := v3830 + 3831
+    v3832: i32 := v3831 + 3832
+    v3833: i32 := v3832 + 3833
+    v3834: i32 := v3833 + 3834
+    v3835: i32 := v3834 + 3835
+    v3836: i32 := v3835 + 3836
+    v3837: i32 := v3836 + 3837
+    v3838: i32 := v3837 + 3838
+    v3839: i32 := v3838 + 3839
+    v3840: i32 := v3839 + 3840
+    v3841: i32 := v3840 + 3841
+    v3842: i32 := v3841 + 3842
+    v3843: i32 := v3842 + 3843
+    v3844: i32 := v3843 + 3844
+    v3845: i32 := v3844 + 3845
+    v3846: i32 := v3845 + 3846
+    v3847: i32 := v3846 + 3847
+    v3848: i32 := v3847 + 3848
+    v3849: i32 := v3848 + 3849
+    v3850: i32 := v3849 + 3850
+    v3851: i32 := v3850 + 3851
+    v3852: i32 := v3851 + 3852
+    v3853: i32 := v3852 + 3853
+    v3854: i32 := v3853 + 3854
+    v3855: i32 := v3854 + 3855
+    v3856: i32 := v3855 + 3856
+    v3857: i32 := v3856 + 3857
+    v3858: i32 := v3857 + 3858
+    v3859: i32 := v3858 + 3859
+    v3860: i32 := v3859 + 3860
+    v3861: i32 := v3860 + 3861
+    v3862: i32 := v3861 + 3862
+    v3863: i32 := v3862 + 3863
+    v3864: i32 := v3863 + 3864
+    v3865: i32 := v3864 + 3865
+    v3866: i32 := v3865 + 3866
+    v3867: i32 := v3866 + 3867
+    v3868: i32 := v3867 + 3868
+    v3869: i32 := v3868 + 3869
+    v3870: i32 := v3869 + 3870
+    v3871: i32 := v3870 + 3871
+    v3872: i32 := v3871 + 3872
+    v3873: i32 := v3872 + 3873
+    v3874: i32 := v3873 + 3874
+    v3875: i32 := v3874 + 3875
+    v3876: i32 := v3875 + 3876
+    v3877: i32 := v3876 + 3877
+    v3878: i32 := v3877 + 3878
+    v3879: i32 := v3878 + 3879
+    v3880: i32 := v3879 + 3880
+    v3881: i32 := v3880 + 3881
+    v3882: i32 := v3881 + 3882
+    v3883: i32 := v3882 + 3883
+    v3884: i32 := v3883 + 3884
+    v3885: i32 := v3884 + 3885
+    v3886: i32 := v3885 + 3886
+    v3887: i32 := v3886 + 3887
+    v3888: i32 := v3887 + 3888
+    v3889: i32 := v3888 + 3889
+    v3890: i32 := v3889 + 3890
+    v3891: i32 := v3890 + 3891
+    v3892: i32 := v3891 + 3892
+    v3893: i32 := v3892 + 3893
+    v3894: i32 := v3893 + 3894
+    v3895: i32 := v3894 + 3895
+    v3896: i32 := v3895 + 3896
+    v3897: i32 := v3896 + 3897
+    v3898: i32 := v3897 + 3898
+    v3899: i32 := v3898 + 3899
+    v3900: i32 := v3899 + 3900
+    v3901: i32 := v3900 + 3901
+    v3902: i32 := v3901 + 3902
+    v3903: i32 := v3902 + 3903
+    v3904: i32 := v3903 + 3904
+    v3905: i32 := v3904 + 3905
+    v3906: i32 := v3905 + 3906
+    v3907: i32 := v3906 + 3907
+    v3908: i32 := v3907 + 3908
+    v3909: i32 := v3908 + 3909
+    v3910: i32 := v3909 + 3910
+    v3911: i32 := v3910 + 3911
+    v3912: i32 := v3911 + 3912
+    v3913: i32 := v3912 + 3913
+    v3914: i32 := v3913 + 3914
+    v3915: i32 := v3914 + 3915
+    v3916: i32 := v3915 + 3916
+    v3917: i32 := v3916 + 3917
+    v3918: i32 := v3917 + 3918
+    v3919: i32 := v3918 + 3919
+    v3920: i32 := v3919 + 3920
+    v3921: i32 := v3920 + 3921
+    v3922: i32 := v3921 + 3922
+    v3923: i32 := v3922 + 3923
+    v3924: i32 := v3923 + 3924
+    v3925: i32 := v3924 + 3925
+    v3926: i32 := v3925 + 3926
+    v3927: i32 := v3926 + 3927
+    v3928: i32 := v3927 + 3928
+    v3929: i32 := v3928 + 3929
+    v3930: i32 := v3929 + 3930
+    v3931: i32 := v3930 + 3931
+    v3932: i32 := v3931 + 3932
+    v3933: i32 := v3932 + 3933
+    v3934: i32 := v3933 + 3934
+    v3935: i32 := v3934 + 3935
+    v3936: i32 := v3935 + 3936
+    v3937: i32 := v3936 + 3937
+    v3938: i32 := v3937 + 3938
+    v3939: i32 := v3938 + 3939
+    v3940: i32 := v3939 + 3940
+    v3941: i32 := v3940 + 3941
+    v3942: i32 := v3941 + 3942
+    v3943: i32 := v3942 + 3943
+    v3944: i32 := v3943 + 3944
+    v3945: i32 := v3944 + 3945
+    v3946: i32 := v3945 + 3946
+    v3947: i32 := v3946 + 3947
+    v3948: i32 := v3947 + 3948
+    v3949: i32 := v3948 + 3949
+    v3950: i32 := v3949 + 3950
+    v3951: i32 := v3950 + 3951
+    v3952: i32 := v3951 + 3952
+    v3953: i32 := v3952 + 3953
+    v3954: i32 := v3953 + 3954
+    v3955: i32 := v3954 + 3955
+    v3956: i32 := v3955 + 3956
+    v3957: i32 := v3956 + 3957
+    v3958: i32 := v3957 + 3958
+    v3959: i32 := v3958 + 3959
+    v3960: i32 := v3959 + 3960
+    v3961: i32 := v3960 + 3961
+    v3962: i32 := v3961 + 3962
+    v3963: i32 := v3962 + 3963
+    v3964: i32 := v3963 + 3964
+    v3965: i32 := v3964 + 3965
+    v3966: i32 := v3965 + 3966
+    v3967: i32 := v3966 + 3967
+    v3968: i32 := v3967 + 3968
+    v3969: i32 := v3968 + 3969
+    v3970: i32 := v3969 + 3970
+    v3971: i32 := v3970 + 3971
+    v3972: i32 := v3971 + 3972
+    v3973: i32 := v3972 + 3973
+    v3974: i32 := v3973 + 3974
+    v3975: i32 := v3974 + 3975
+    v3976: i32 := v3975 + 3976
+    v3977: i32 := v3976 + 3977
+    v3978: i32 := v3977 + 3978
+    v3979: i32 := v3978 + 3979
+    v3980: i32 := v3979 + 3980
+    v3981: i32 := v3980 + 3981
+    v3982: i32 := v3981 + 3982
+    v3983: i32 := v3982 + 3983
+    v3984: i32 := v3983 + 3984
+    v3985: i32 := v3984 + 3985
+    v3986: i32 := v3985 + 3986
+    v3987: i32 := v3986 + 3987
+    v3988: i32 := v3987 + 3988
+    v3989: i32 := v3988 + 3989
+    v3990: i32 := v3989 + 3990
+    v3991: i32 := v3990 + 3991
+    v3992: i32 := v3991 + 3992
+    v3993: i32 := v3992 + 3993
+    v3994: i32 := v3993 + 3994
+    v3995: i32 := v3994 + 3995
+    v3996: i32 := v3995 + 3996
+    v3997: i32 := v3996 + 3997
+    v3998: i32 := v3997 + 3998
+    v3999: i32 := v3998 + 3999
+    r := v0 + v3999
+}
@@ -0,0 +1,519 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../compile.h"
+#include "../arch.h"
+#include "../minica.h"
+#include "../report.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_REPEAT    5
+#define BENCH_MAX       256
+
+/*
+ * Stages of the compiler measured; each stage takes the result of the
+ * previous one, and the parser includes the scanner
+ */
+typedef enum {
+    BENCH_LEX,
+    BENCH_PARSE,
+    BENCH_COMPILE,
+    BENCH_ASSEMBLE,
+    BENCH_ELF,
+    BENCH_MACH_O,
+    BENCH_NSTAGES,
+} bench_stage_t;
+
+static const char *_stages[BENCH_NSTAGES] = {
+    [BENCH_LEX] = "lex",
+    [BENCH_PARSE] = "parse",
+    [BENCH_COMPILE] = "compile",
+    [BENCH_ASSEMBLE] = "assemble",
+    [BENCH_ELF] = "elf",
+    [BENCH_MACH_O] = "mach-o",
+};
+
+/*
+ * Result of a source; the best time of the repetitions for each stage, or
+ * zero if the stage is not supported for the source, and the time of each
+ * phase of the compiler in the best run of the compile stage
+ */
+typedef struct {
+    char name[64];
+    size_t lines;
+    size_t bytes;
+    double sec[BENCH_NSTAGES];
+    double phase[REPORT_NPHASES];
+} bench_result_t;
+
+/*
+ * Baseline throughputs (MB/sec) loaded from a file
+ */
+typedef struct {
+    size_t n;
+    struct {
+        char name[64];
+        int stage;
+        double mbps;
+    } ents[BENCH_MAX * BENCH_NSTAGES];
+} bench_baseline_t;
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-n <repeat>] [-b <baseline>] [-w <baseline>] "
+            "[-t <percent>] <alang-file>...\n", prog);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * _now -- get the monotonic time in seconds
+ */
+static double
+_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * _best -- keep the best time of a stage
+ */
+static void
+_best(bench_result_t *res, bench_stage_t stage, double t)
+{
+    if ( res->sec[stage] == 0 || t < res->sec[stage] ) {
+        res->sec[stage] = t;
+    }
+}
+
+/*
+ * _load -- read a source file
+ */
+static char *
+_load(const char *path, size_t *len)
+{
+    FILE *fp;
+    char *buf;
+    long size;
+
+    fp = fopen(path, "r");
+    if ( NULL == fp ) {
+        return NULL;
+    }
+    if ( fseek(fp, 0, SEEK_END) < 0 || (size = ftell(fp)) < 0
+         || fseek(fp, 0, SEEK_SET) < 0 ) {
+        fclose(fp);
+        return NULL;
+    }
+    buf = malloc(size + 1);
+    if ( NULL == buf ) {
+        fclose(fp);
+        return NULL;
+    }
+    if ( fread(buf, 1, size, fp) != (size_t)size ) {
+        free(buf);
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+    buf[size] = '\0';
+    *len = size;
+
+    return buf;
+}
+
+/*
+ * _run -- run the stages on the source text once; a stage is skipped once a
+ * stage fails (e.g., unsupported by the compiler)
+ */
+static int
+_run(bench_result_t *res, const char *buf, size_t len, FILE *null)
+{
+    arch_code_t code;
+    compiler_t *c;
+    st_t *st;
+    double t;
+    int ret;
+    int p;
+
+    t = _now();
+    ret = minica_scan_buffer(buf, len) < 0 ? -1 : 0;
+    _best(res, BENCH_LEX, _now() - t);
+    if ( ret < 0 ) {
+        return -1;
+    }
+
+    t = _now();
+    st = minica_parse_buffer(buf, len);
+    _best(res, BENCH_PARSE, _now() - t);
+    if ( NULL == st ) {
+        return -1;
+    }
+
+    /* The compiler instance is not released but leaked; the phases of the
+       compiler are timed only in this stage */
+    report_enable(REPORT_TIME);
+    t = _now();
+    c = minica_compile(st);
+    t = _now() - t;
+    if ( NULL != c
+         && (res->sec[BENCH_COMPILE] == 0 || t < res->sec[BENCH_COMPILE]) ) {
+        for ( p = REPORT_COMPILE; p <= REPORT_REGALLOC; p++ ) {
+            res->phase[p] = report_ns(p) / 1e9;
+        }
+    }
+    report_enable(0);
+    if ( NULL == c ) {
+        st_release(st);
+        return 0;
+    }
+    _best(res, BENCH_COMPILE, t);
+
+    t = _now();
+    ret = x86_64_assemble(c->irobj, &code);
+    if ( ret < 0 ) {
+        st_release(st);
+        return 0;
+    }
+    _best(res, BENCH_ASSEMBLE, _now() - t);
+
+    t = _now();
+    ret = elf_export(null, &code);
+    fflush(null);
+    if ( ret >= 0 ) {
+        _best(res, BENCH_ELF, _now() - t);
+    }
+    t = _now();
+    ret = mach_o_export(null, &code);
+    fflush(null);
+    if ( ret >= 0 ) {
+        _best(res, BENCH_MACH_O, _now() - t);
+    }
+
+    arch_code_release(&code);
+    st_release(st);
+
+    return 0;
+}
+
+/*
+ * _name -- get the name of a source from its path
+ */
+static void
+_name(char *name, size_t size, const char *path)
+{
+    const char *s;
+    size_t len;
+
+    s = strrchr(path, '/');
+    s = s != NULL ? s + 1 : path;
+    len = strlen(s);
+    if ( len > 3 && 0 == strcmp(s + len - 3, ".al") ) {
+        len -= 3;
+    }
+    if ( len >= size ) {
+        len = size - 1;
+    }
+    memcpy(name, s, len);
+    name[len] = '\0';
+}
+
+/*
+ * _baseline_load -- load the baseline throughputs
+ */
+static int
+_baseline_load(bench_baseline_t *bl, const char *path)
+{
+    FILE *fp;
+    char line[256];
+    char name[64];
+    char stage[16];
+    double mbps;
+    int i;
+
+    bl->n = 0;
+    fp = fopen(path, "r");
+    if ( NULL == fp ) {
+        return -1;
+    }
+    while ( NULL != fgets(line, sizeof(line), fp) ) {
+        if ( line[0] == '#'
+             || sscanf(line, "%63s %15s %lf", name, stage, &mbps) != 3 ) {
+            continue;
+        }
+        for ( i = 0; i < BENCH_NSTAGES; i++ ) {
+            if ( 0 == strcmp(stage, _stages[i]) ) {
+                break;
+            }
+        }
+        if ( i >= BENCH_NSTAGES
+             || bl->n >= sizeof(bl->ents) / sizeof(bl->ents[0]) ) {
+            continue;
+        }
+        strcpy(bl->ents[bl->n].name, name);
+        bl->ents[bl->n].stage = i;
+        bl->ents[bl->n].mbps = mbps;
+        bl->n++;
+    }
+    fclose(fp);
+
+    return 0;
+}
+
+/*
+ * _baseline_lookup -- look up the baseline throughput of a stage, or return
+ * zero if not found
+ */
+static double
+_baseline_lookup(const bench_baseline_t *bl, const char *name, int stage)
+{
+    size_t i;
+
+    for ( i = 0; i < bl->n; i++ ) {
+        if ( bl->ents[i].stage == stage
+             && 0 == strcmp(bl->ents[i].name, name) ) {
+            return bl->ents[i].mbps;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _baseline_save -- save the throughputs as the baseline
+ */
+static int
+_baseline_save(const char *path, const bench_result_t *res, int n)
+{
+    FILE *fp;
+    int i;
+    int j;
+
+    fp = fopen(path, "w");
+    if ( NULL == fp ) {
+        return -1;
+    }
+    fprintf(fp, "# <source> <stage> <MB/sec>\n");
+    for ( i = 0; i < n; i++ ) {
+        for ( j = 0; j < BENCH_NSTAGES; j++ ) {
+            if ( res[i].sec[j] > 0 ) {
+                fprintf(fp, "%s %s %.3f\n", res[i].name, _stages[j],
+                        res[i].bytes / res[i].sec[j] / 1e6);
+            }
+        }
+    }
+    fclose(fp);
+
+    return 0;
+}
+
+/*
+ * _print -- print the results, compared against the baseline if any, and
+ * return the number of the stages slower than the baseline by the threshold
+ */
+static int
+_print(const bench_result_t *res, int n, const bench_baseline_t *bl,
+       double threshold)
+{
+    double mbps;
+    double base;
+    double diff;
+    int slow;
+    int i;
+    int j;
+
+    slow = 0;
+    printf("%-10s %-9s %8s %10s %10s %12s %9s", "source", "stage", "lines",
+           "bytes", "time (ms)", "lines/sec", "MB/sec");
+    if ( bl != NULL ) {
+        printf(" %9s", "baseline");
+    }
+    printf("\n");
+    for ( i = 0; i < n; i++ ) {
+        for ( j = 0; j < BENCH_NSTAGES; j++ ) {
+            printf("%-10s %-9s %8zu %10zu", res[i].name, _stages[j],
+                   res[i].lines, res[i].bytes);
+            if ( res[i].sec[j] == 0 ) {
+                printf(" %10s %12s %9s\n", "-", "-", "-");
+                continue;
+            }
+            mbps = res[i].bytes / res[i].sec[j] / 1e6;
+            printf(" %10.3f %12.0f %9.2f", res[i].sec[j] * 1e3,
+                   res[i].lines / res[i].sec[j], mbps);
+            if ( bl != NULL ) {
+                base = _baseline_lookup(bl, res[i].name, j);
+                if ( base > 0 ) {
+                    diff = (mbps - base) / base * 100;
+                    printf(" %+8.1f%%", diff);
+                    if ( threshold > 0 && diff < -threshold ) {
+                        printf(" slower");
+                        slow++;
+                    }
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    return slow;
+}
+
+/*
+ * _print_phases -- print the time of each phase of the compiler in the
+ * compile stage; the time of a phase includes the nested phases
+ */
+static void
+_print_phases(const bench_result_t *res, int n)
+{
+    double sec;
+    int i;
+    int p;
+
+    printf("\n%-10s %-9s %10s %6s\n", "source", "phase", "time (ms)", "%");
+    for ( i = 0; i < n; i++ ) {
+        sec = res[i].sec[BENCH_COMPILE];
+        if ( sec == 0 ) {
+            continue;
+        }
+        for ( p = REPORT_COMPILE; p <= REPORT_REGALLOC; p++ ) {
+            if ( res[i].phase[p] == 0 ) {
+                continue;
+            }
+            printf("%-10s %-9s %10.3f %6.1f\n", res[i].name, report_name(p),
+                   res[i].phase[p] * 1e3, 100 * res[i].phase[p] / sec);
+        }
+    }
+}
+
+/*
+ * Main routine for the throughput benchmark
+ */
+int
+main(int argc, const char *const argv[])
+{
+    static bench_baseline_t baseline;
+    static bench_result_t res[BENCH_MAX];
+    const char *load;
+    const char *save;
+    double threshold;
+    FILE *null;
+    size_t len;
+    size_t k;
+    char *buf;
+    int repeat;
+    int slow;
+    int n;
+    int i;
+    int r;
+
+    /* Parse the options */
+    repeat = BENCH_REPEAT;
+    load = NULL;
+    save = NULL;
+    threshold = 0;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-n") && i + 1 < argc ) {
+            repeat = atoi(argv[++i]);
+            if ( repeat < 1 ) {
+                usage(argv[0]);
+            }
+        } else if ( 0 == strcmp(argv[i], "-b") && i + 1 < argc ) {
+            load = argv[++i];
+        } else if ( 0 == strcmp(argv[i], "-w") && i + 1 < argc ) {
+            save = argv[++i];
+        } else if ( 0 == strcmp(argv[i], "-t") && i + 1 < argc ) {
+            threshold = atof(argv[++i]);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if ( i >= argc || argc - i > BENCH_MAX ) {
+        usage(argv[0]);
+    }
+    if ( load != NULL && _baseline_load(&baseline, load) < 0 ) {
+        fprintf(stderr, "Cannot load the baseline: %s\n", load);
+        load = NULL;
+    }
+
+    /* The object writers write to the null device */
+    null = fopen("/dev/null", "w");
+    if ( NULL == null ) {
+        perror("fopen");
+        return EXIT_FAILURE;
+    }
+
+    /* Run the stages on each source */
+    for ( n = 0; i < argc; i++, n++ ) {
+        buf = _load(argv[i], &len);
+        if ( NULL == buf ) {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+        memset(&res[n], 0, sizeof(bench_result_t));
+        _name(res[n].name, sizeof(res[n].name), argv[i]);
+        res[n].bytes = len;
+        for ( k = 0; k < len; k++ ) {
+            if ( buf[k] == '\n' ) {
+                res[n].lines++;
+            }
+        }
+        for ( r = 0; r < repeat; r++ ) {
+            if ( _run(&res[n], buf, len, null) < 0 ) {
+                fprintf(stderr, "Failed to parse the code: %s\n", argv[i]);
+                return EXIT_FAILURE;
+            }
+        }
+        free(buf);
+    }
+    fclose(null);
+
+    if ( save != NULL && _baseline_save(save, res, n) < 0 ) {
+        perror(save);
+        return EXIT_FAILURE;
+    }
+    slow = _print(res, n, load != NULL ? &baseline : NULL, threshold);
+    _print_phases(res, n);
+    if ( slow > 0 ) {
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,473 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../runtime/runtime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#define BENCH_SAMPLES   20
+#define BENCH_TARGET    10
+#define BENCH_CHECK     1000
+
+/* Compiled from bench/kernels.al */
+int64_t arith(int64_t, int64_t);
+int64_t divmod(int64_t, int64_t);
+int64_t divconst(int64_t);
+int64_t shifts(int64_t, int64_t);
+int64_t dispatch(int64_t, int64_t);
+RT_COROUTINE(pingpong);
+
+/*
+ * Kernel; the run function calls the compiled kernel for n iterations, and
+ * the reference computes the same value in C
+ */
+typedef struct {
+    const char *name;
+    int64_t (*run)(int64_t);
+    int64_t (*ref)(int64_t);
+} kernel_t;
+
+/*
+ * Statistics of the samples in nanoseconds per iteration
+ */
+typedef struct {
+    double mean;
+    double ci;
+    double min;
+    double median;
+    double tsc;
+} stat_t;
+
+/*
+ * _arith -- the reference of arith
+ */
+static int64_t
+_arith(int64_t n)
+{
+    uint64_t r;
+    int64_t i;
+
+    r = 12345;
+    for ( i = 0; i < n; i++ ) {
+        r = r * 3;
+        r = r + i;
+        r = r - 12345;
+        r = r ^ i;
+    }
+
+    return r;
+}
+
+/*
+ * _divmod -- the reference of divmod
+ */
+static int64_t
+_divmod(int64_t n)
+{
+    uint64_t r;
+    int64_t i;
+
+    r = 0;
+    for ( i = 0; i < n; i++ ) {
+        r = r + i / 13;
+        r = r ^ (i % 13);
+    }
+
+    return r;
+}
+
+/*
+ * _divconst -- the reference of divconst
+ */
+static int64_t
+_divconst(int64_t n)
+{
+    uint64_t r;
+    int64_t i;
+
+    r = 0;
+    for ( i = 0; i < n; i++ ) {
+        r = r + i / 7;
+        r = r ^ (i % 7);
+    }
+
+    return r;
+}
+
+/*
+ * _shifts -- the reference of shifts; the right shift is arithmetic
+ */
+static int64_t
+_shifts(int64_t n)
+{
+    uint64_t r;
+    int64_t i;
+
+    r = 1;
+    for ( i = 0; i < n; i++ ) {
+        r = r ^ ((uint64_t)i << 5);
+        r = r + ((int64_t)r >> 3);
+    }
+
+    return r;
+}
+
+/*
+ * _dispatch -- the reference of dispatch
+ */
+static int64_t
+_dispatch(int64_t n)
+{
+    uint64_t r;
+    int64_t i;
+
+    r = 12345;
+    for ( i = 0; i < n; i++ ) {
+        switch ( r & 7 ) {
+        case 0:
+            r = r + 3;
+            break;
+        case 1:
+            r = r ^ 5;
+            break;
+        case 2:
+            r = r + i;
+            break;
+        case 3:
+            r = r * 5;
+            break;
+        case 4:
+        case 5:
+            r = r - 1;
+            break;
+        case 6:
+            r = r + 7;
+            break;
+        default:
+            r = r ^ i;
+        }
+    }
+
+    return r;
+}
+
+/*
+ * _pingpong -- the reference of pingpong; the sum of the values yielded
+ */
+static int64_t
+_pingpong(int64_t n)
+{
+    return n * (n - 1) / 2;
+}
+
+/*
+ * Wrappers of the compiled kernels
+ */
+static int64_t
+_run_arith(int64_t n)
+{
+    return arith(n, 12345);
+}
+
+static int64_t
+_run_divmod(int64_t n)
+{
+    return divmod(n, 13);
+}
+
+static int64_t
+_run_divconst(int64_t n)
+{
+    return divconst(n);
+}
+
+static int64_t
+_run_shifts(int64_t n)
+{
+    return shifts(n, 5);
+}
+
+static int64_t
+_run_dispatch(int64_t n)
+{
+    return dispatch(n, 12345);
+}
+
+/*
+ * _run_pingpong -- resume the coroutine until it returns, and sum up the
+ * values yielded
+ */
+static int64_t
+_run_pingpong(int64_t n)
+{
+    int64_t packet[RT_MAX_VALUES];
+    int64_t *frame;
+    int64_t sum;
+
+    frame = calloc(1, (size_t)pingpong_frame);
+    if ( NULL == frame ) {
+        return -1;
+    }
+    frame[RT_FRAME_PACKET] = (int64_t)(intptr_t)packet;
+    sum = 0;
+    for ( ;; ) {
+        ((rt_entry_t)pingpong)(frame, n, 0, 0, 0, 0);
+        if ( frame[RT_FRAME_STATE] == 0 ) {
+            break;
+        }
+        sum += packet[0];
+    }
+    free(frame);
+
+    return sum;
+}
+
+static kernel_t _kernels[] = {
+    { "arith", _run_arith, _arith },
+    { "divmod", _run_divmod, _divmod },
+    { "divconst", _run_divconst, _divconst },
+    { "shifts", _run_shifts, _shifts },
+    { "dispatch", _run_dispatch, _dispatch },
+    { "pingpong", _run_pingpong, _pingpong },
+};
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-s <samples>] [-t <milliseconds>] "
+            "[<kernel>...]\n", prog);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * _now -- get the monotonic time in nanoseconds
+ */
+static double
+_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+ * _tsc -- read the time-stamp counter, or zero if not available
+ */
+static uint64_t
+_tsc(void)
+{
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*
+ * _t975 -- the 97.5th percentile of Student's t-distribution for the degrees
+ * of freedom, for the two-sided 95% confidence interval
+ */
+static double
+_t975(int df)
+{
+    static const double t[] = {
+        0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262,
+        2.228, 2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093,
+        2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045,
+        2.042,
+    };
+
+    if ( df < (int)(sizeof(t) / sizeof(t[0])) ) {
+        return t[df];
+    }
+
+    return df < 60 ? 2.000 : df < 120 ? 1.980 : 1.960;
+}
+
+/*
+ * _cmp -- compare two samples
+ */
+static int
+_cmp(const void *a, const void *b)
+{
+    double x;
+    double y;
+
+    x = *(const double *)a;
+    y = *(const double *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+/*
+ * _measure -- measure a kernel; the number of the iterations is doubled until
+ * a call takes the target time, and then the samples of the calls are taken
+ */
+static int64_t
+_measure(const kernel_t *k, int samples, double target, stat_t *st)
+{
+    double *ns;
+    double t;
+    double var;
+    uint64_t tsc;
+    int64_t n;
+    int i;
+
+    ns = malloc(sizeof(double) * samples);
+    if ( NULL == ns ) {
+        return -1;
+    }
+
+    /* Calibrate the number of the iterations, which also warms up */
+    for ( n = 1024; ; n <<= 1 ) {
+        t = _now();
+        k->run(n);
+        if ( _now() - t >= target || n >= ((int64_t)1 << 40) ) {
+            break;
+        }
+    }
+
+    tsc = 0;
+    for ( i = 0; i < samples; i++ ) {
+        t = _now();
+        tsc -= _tsc();
+        k->run(n);
+        tsc += _tsc();
+        ns[i] = (_now() - t) / n;
+    }
+
+    st->mean = 0;
+    for ( i = 0; i < samples; i++ ) {
+        st->mean += ns[i];
+    }
+    st->mean /= samples;
+    var = 0;
+    for ( i = 0; i < samples; i++ ) {
+        var += (ns[i] - st->mean) * (ns[i] - st->mean);
+    }
+    st->ci = 0;
+    if ( samples > 1 ) {
+        var /= samples - 1;
+        st->ci = _t975(samples - 1) * sqrt(var / samples);
+    }
+    qsort(ns, samples, sizeof(double), _cmp);
+    st->min = ns[0];
+    st->median = samples & 1 ? ns[samples / 2]
+        : (ns[samples / 2 - 1] + ns[samples / 2]) / 2;
+    st->tsc = (double)tsc / samples / n;
+    free(ns);
+
+    return n;
+}
+
+/*
+ * Main routine for the generated-code benchmark
+ */
+int
+main(int argc, const char *const argv[])
+{
+    stat_t st;
+    double target;
+    int64_t n;
+    int64_t v;
+    int samples;
+    int failed;
+    int first;
+    int i;
+    size_t j;
+
+    /* Parse the options */
+    samples = BENCH_SAMPLES;
+    target = BENCH_TARGET;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-s") && i + 1 < argc ) {
+            samples = atoi(argv[++i]);
+            if ( samples < 2 ) {
+                usage(argv[0]);
+            }
+        } else if ( 0 == strcmp(argv[i], "-t") && i + 1 < argc ) {
+            target = atof(argv[++i]);
+            if ( target <= 0 ) {
+                usage(argv[0]);
+            }
+        } else {
+            usage(argv[0]);
+        }
+    }
+    first = i;
+
+    printf("%-10s %12s %10s %9s %10s %10s %10s\n", "kernel", "iterations",
+           "ns/op", "+-95%", "min", "median", "tsc/op");
+    failed = 0;
+    for ( j = 0; j < sizeof(_kernels) / sizeof(_kernels[0]); j++ ) {
+        /* Select the kernels specified */
+        for ( i = first; i < argc; i++ ) {
+            if ( 0 == strcmp(argv[i], _kernels[j].name) ) {
+                break;
+            }
+        }
+        if ( first < argc && i >= argc ) {
+            continue;
+        }
+
+        /* Check the compiled code against the reference first */
+        v = _kernels[j].run(BENCH_CHECK);
+        if ( v != _kernels[j].ref(BENCH_CHECK) ) {
+            printf("%-10s wrong result: %lld (expected %lld)\n",
+                   _kernels[j].name, (long long)v,
+                   (long long)_kernels[j].ref(BENCH_CHECK));
+            failed++;
+            continue;
+        }
+
+        n = _measure(&_kernels[j], samples, target * 1e6, &st);
+        if ( n < 0 ) {
+            return EXIT_FAILURE;
+        }
+        printf("%-10s %12lld %10.3f %8.1f%% %10.3f %10.3f %10.2f\n",
+               _kernels[j].name, (long long)n, st.mean,
+               st.mean > 0 ? st.ci / st.mean * 100 : 0.0, st.min, st.median,
+               st.tsc);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,209 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Generators of the synthetic sources for the throughput benchmark; each
+ * writes a source of the specified size to the standard output
+ */
+typedef struct {
+    const char *name;
+    void (*gen)(FILE *, int);
+    int n;
+    const char *desc;
+} generator_t;
+
+/*
+ * _funcs -- many small functions with loops and branches
+ */
+static void
+_funcs(FILE *fp, int n)
+{
+    int i;
+
+    fprintf(fp, "// %d functions\n", n);
+    for ( i = 0; i < n; i++ ) {
+        fprintf(fp, "\nfn f%d(a: i32, b: i32) (r: i32)\n{\n", i);
+        fprintf(fp, "    s: i32 := a\n");
+        fprintf(fp, "    i: i32 := 0\n");
+        fprintf(fp, "    while i < b {\n");
+        fprintf(fp, "        if s > %d {\n", i);
+        fprintf(fp, "            s := s - a\n");
+        fprintf(fp, "        } else {\n");
+        fprintf(fp, "            s := s + i * %d\n", i % 7 + 1);
+        fprintf(fp, "        }\n");
+        fprintf(fp, "        i++\n");
+        fprintf(fp, "    }\n");
+        fprintf(fp, "    r := s ^ a << %d\n", i % 31);
+        fprintf(fp, "}\n");
+    }
+}
+
+/*
+ * _expr -- an expression of the specified number of terms; the operators are
+ * left-associative, so the syntax tree is nested to the same depth
+ * (parenthesized expressions are not compiled yet)
+ */
+static void
+_expr(FILE *fp, int n)
+{
+    static const char *ops[] = { "+", "*", "-", "^", "|", "&", "<<" };
+    int i;
+
+    fprintf(fp, "// Expression nested to the depth of %d\n\n", n);
+    fprintf(fp, "fn main(a: i32, b: i32) (r: i32)\n{\n    r := a");
+    for ( i = 1; i < n; i++ ) {
+        if ( i % 8 == 0 ) {
+            fprintf(fp, "\n        ");
+        }
+        if ( i % 7 == 6 ) {
+            fprintf(fp, " %s %d", ops[i % 7], i % 31);
+        } else {
+            fprintf(fp, " %s %s", ops[i % 7], i & 1 ? "b" : "a");
+        }
+    }
+    fprintf(fp, "\n}\n");
+}
+
+/*
+ * _switch -- a switch table of the specified number of cases
+ */
+static void
+_switch(FILE *fp, int n)
+{
+    int i;
+
+    fprintf(fp, "// Switch table of %d cases\n\n", n);
+    fprintf(fp, "fn main(x: i32) (r: i32)\n{\n    switch x {\n");
+    for ( i = 0; i < n; i++ ) {
+        fprintf(fp, "        case %d:\n            r := x * %d + %d\n",
+                i + 1, i % 13 + 1, i);
+    }
+    fprintf(fp, "        default:\n            r := 0\n    }\n}\n");
+}
+
+/*
+ * _string -- long string literals; the compiler does not support the
+ * strings yet, so only the front end runs on this source
+ */
+static void
+_string(FILE *fp, int n)
+{
+    int i;
+    int j;
+
+    fprintf(fp, "// %d string literals\n\n", n);
+    fprintf(fp, "fn main() (r: i32)\n{\n");
+    for ( i = 0; i < n; i++ ) {
+        fprintf(fp, "    s%d: string := \"", i);
+        for ( j = 0; j < 256; j++ ) {
+            fputc('a' + (i + j) % 26, fp);
+        }
+        fprintf(fp, "\\x%02x\\\"\\\\\"\n", i & 0x7f);
+    }
+    fprintf(fp, "    r := 0\n}\n");
+}
+
+/*
+ * _locals -- a function with the specified number of local variables
+ */
+static void
+_locals(FILE *fp, int n)
+{
+    int i;
+
+    fprintf(fp, "// %d local variables\n\n", n);
+    fprintf(fp, "fn main(a: i32) (r: i32)\n{\n");
+    fprintf(fp, "    v0: i32 := a\n");
+    for ( i = 1; i < n; i++ ) {
+        fprintf(fp, "    v%d: i32 := v%d + %d\n", i, i - 1, i);
+    }
+    fprintf(fp, "    r := v0 + v%d\n}\n", n - 1);
+}
+
+static generator_t _generators[] = {
+    { "funcs", _funcs, 2000, "many functions" },
+    { "expr", _expr, 10000, "deep expression nesting" },
+    { "switch", _switch, 2000, "huge switch table" },
+    { "string", _string, 2000, "long string literals" },
+    { "locals", _locals, 4000, "thousands of locals" },
+};
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    size_t i;
+
+    fprintf(stderr, "Usage: %s <generator> [<size>]\n", prog);
+    for ( i = 0; i < sizeof(_generators) / sizeof(_generators[0]); i++ ) {
+        fprintf(stderr, "    %-8s %s (default: %d)\n", _generators[i].name,
+                _generators[i].desc, _generators[i].n);
+    }
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * Main routine for the generators
+ */
+int
+main(int argc, const char *const argv[])
+{
+    size_t i;
+    int n;
+
+    if ( argc < 2 || argc > 3 ) {
+        usage(argv[0]);
+    }
+    for ( i = 0; i < sizeof(_generators) / sizeof(_generators[0]); i++ ) {
+        if ( 0 == strcmp(argv[1], _generators[i].name) ) {
+            break;
+        }
+    }
+    if ( i >= sizeof(_generators) / sizeof(_generators[0]) ) {
+        usage(argv[0]);
+    }
+    n = _generators[i].n;
+    if ( argc > 2 ) {
+        n = atoi(argv[2]);
+        if ( n < 1 ) {
+            usage(argv[0]);
+        }
+    }
+    _generators[i].gen(stdout, n);
+
+    return EXIT_SUCCESS;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,4009 @@
+// Switch table of 2000 cases
+
+fn main(x: i32) (r: i32)
+{
+    switch x {
+        case 1:
+            r := x * 1 + 0
+        case 2:
+            r := x * 2 + 1
+        case 3:
+            r := x * 3 + 2
+        case 4:
+            r := x * 4 + 3
+        case 5:
+            r := x * 5 + 4
+        case 6:
+            r := x * 6 + 5
+        case 7:
+            r := x * 7 + 6
+        case 8:
+            r := x * 8 + 7
+        case 9:
+            r := x * 9 + 8
+        case 10:
+            r := x * 10 + 9
+        case 11:
+            r := x * 11 + 10
+        case 12:
+            r := x * 12 + 11
+        case 13:
+            r := x * 13 + 12
+        case 14:
+            r := x * 1 + 13
+        case 15:
+            r := x * 2 + 14
+        case 16:
+            r := x * 3 + 15
+        case 17:
+            r := x * 4 + 16
+        case 18:
+            r := x * 5 + 17
+        case 19:
+            r := x * 6 + 18
+        case 20:
+            r := x * 7 + 19
+        case 21:
+            r := x * 8 + 20
+        case 22:
+            r := x * 9 + 21
+        case 23:
+            r := x * 10 + 22
+        case 24:
+            r := x * 11 + 23
+        case 25:
+            r := x * 12 + 24
+        case 26:
+            r := x * 13 + 25
+        case 27:
+            r := x * 1 + 26
+        case 28:
+            r := x * 2 + 27
+        case 29:
+            r := x * 3 + 28
+        case 30:
+            r := x * 4 + 29
+        case 31:
+            r := x * 5 + 30
+        case 32:
+            r := x * 6 + 31
+        case 33:
+            r := x * 7 + 32
+        case 34:
+            r := x * 8 + 33
+        case 35:
+            r := x * 9 + 34
+        case 36:
+            r := x * 10 + 35
+        case 37:
+            r := x * 11 + 36
+        case 38:
+            r := x * 12 + 37
+        case 39:
+            r := x * 13 + 38
+        case 40:
+            r := x * 1 + 39
+        case 41:
+            r := x * 2 + 40
+        case 42:
+            r := x * 3 + 41
+        case 43:
+            r := x * 4 + 42
+        case 44:
+            r := x * 5 + 43
+        case 45:
+            r := x * 6 + 44
+        case 46:
+            r := x * 7 + 45
+        case 47:
+            r := x * 8 + 46
+        case 48:
+            r := x * 9 + 47
+        case 49:
+            r := x * 10 + 48
+        case 50:
+            r := x * 11 + 49
+        case 51:
+            r := x * 12 + 50
+        case 52:
+            r := x * 13 + 51
+        case 53:
+            r := x * 1 + 52
+        case 54:
+            r := x * 2 + 53
+        case 55:
+            r := x * 3 + 54
+        case 56:
+            r := x * 4 + 55
+        case 57:
+            r := x * 5 + 56
+        case 58:
+            r := x * 6 + 57
+        case 59:
+            r := x * 7 + 58
+        case 60:
+            r := x * 8 + 59
+        case 61:
+            r := x * 9 + 60
+        case 62:
+            r := x * 10 + 61
+        case 63:
+            r := x * 11 + 62
+        case 64:
+            r := x * 12 + 63
+        case 65:
+            r := x * 13 + 64
+        case 66:
+            r := x * 1 + 65
+        case 67:
+            r := x * 2 + 66
+        case 68:
+            r := x * 3 + 67
+        case 69:
+            r := x * 4 + 68
+        case 70:
+            r := x * 5 + 69
+        case 71:
+            r := x * 6 + 70
+        case 72:
+            r := x * 7 + 71
+        case 73:
+            r := x * 8 + 72
+        case 74:
+            r := x * 9 + 73
+        case 75:
+            r := x * 10 + 74
+        case 76:
+            r := x * 11 + 75
+        case 77:
+            r := x * 12 + 76
+        case 78:
+            r := x * 13 + 77
+        case 79:
+            r := x * 1 + 78
+        case 80:
+            r := x * 2 + 79
+        case 81:
+            r := x * 3 + 80
+        case 82:
+            r := x * 4 + 81
+        case 83:
+            r := x * 5 + 82
+        case 84:
+            r := x * 6 + 83
+        case 85:
+            r := x * 7 + 84
+        case 86:
+            r := x * 8 + 85
+        case 87:
+            r := x * 9 + 86
+        case 88:
+            r := x * 10 + 87
+        case 89:
+            r := x * 11 + 88
+        case 90:
+            r := x * 12 + 89
+        case 91:
+            r := x * 13 + 90
+        case 92:
+            r := x * 1 + 91
+        case 93:
+            r := x * 2 + 92
+        case 94:
+            r := x * 3 + 93
+        case 95:
+            r := x * 4 + 94
+        case 96:
+            r := x * 5 + 95
+        case 97:
+            r := x * 6 + 96
+        case 98:
+            r := x * 7 + 97
+        case 99:
+            r := x * 8 + 98
+        case 100:
+            r := x * 9 + 99
+        case 101:
+            r := x * 10 + 100
+        case 102:
+            r := x * 11 + 101
+        case 103:
+            r := x * 12 + 102
+        case 104:
+            r := x * 13 + 103
+        case 105:
+            r := x * 1 + 104
+        case 106:
+            r := x * 2 + 105
+        case 107:
+            r := x * 3 + 106
+        case 108:
+            r := x * 4 + 107
+        case 109:
+            r := x * 5 + 108
+        case 110:
+            r := x * 6 + 109
+        case 111:
+            r := x * 7 + 110
+        case 112:
+            r := x * 8 + 111
+        case 113:
+            r := x * 9 + 112
+        case 114:
+            r := x * 10 + 113
+        case 115:
+            r := x * 11 + 114
+        case 116:
+            r := x * 12 + 115
+        case 117:
+            r := x * 13 + 116
+        case 118:
+            r := x * 1 + 117
+        case 119:
+            r := x * 2 + 118
+        case 120:
+            r := x * 3 + 119
+        case 121:
+            r := x * 4 + 120
+        case 122:
+            r := x * 5 + 121
+        case 123:
+            r := x * 6 + 122
+        case 124:
+            r := x * 7 + 123
+        case 125:
+            r := x * 8 + 124
+        case 126:
+            r := x * 9 + 125
+        case 127:
+            r := x * 10 + 126
+        case 128:
+            r := x * 11 + 127
+        case 129:
+            r := x * 12 + 128
+        case 130:
+            r := x * 13 + 129
+        case 131:
+            r := x * 1 + 130
+        case 132:
+            r := x * 2 + 131
+        case 133:
+            r := x * 3 + 132
+        case 134:
+            r := x * 4 + 133
+        case 135:
+            r := x * 5 + 134
+        case 136:
+            r := x * 6 + 135
+        case 137:
+            r := x * 7 + 136
+        case 138:
+            r := x * 8 + 137
+        case 139:
+            r := x * 9 + 138
+        case 140:
+            r := x * 10 + 139
+        case 141:
+            r := x * 11 + 140
+        case 142:
+            r := x * 12 + 141
+        case 143:
+            r := x * 13 + 142
+        case 144:
+            r := x * 1 + 143
+        case 145:
+            r := x * 2 + 144
+        case 146:
+            r := x * 3 + 145
+        case 147:
+            r := x * 4 + 146
+        case 148:
+            r := x * 5 + 147
+        case 149:
+            r := x * 6 + 148
+        case 150:
+            r := x * 7 + 149
+        case 151:
+            r := x * 8 + 150
+        case 152:
+            r := x * 9 + 151
+        case 153:
+            r := x * 10 + 152
+        case 154:
+            r := x * 11 + 153
+        case 155:
+            r := x * 12 + 154
+        case 156:
+            r := x * 13 + 155
+        case 157:
+            r := x * 1 + 156
+        case 158:
+            r := x * 2 + 157
+        case 159:
+            r := x * 3 + 158
+        case 160:
+            r := x * 4 + 159
+        case 161:
+            r := x * 5 + 160
+        case 162:
+            r := x * 6 + 161
+        case 163:
+            r := x * 7 + 162
+        case 164:
+            r := x * 8 + 163
+        case 165:
+            r := x * 9 + 164
+        case 166:
+            r := x * 10 + 165
+        case 167:
+            r := x * 11 + 166
+        case 168:
+            r := x * 12 + 167
+        case 169:
+            r := x * 13 + 168
+        case 170:
+            r := x * 1 + 169
+        case 171:
+            r := x * 2 + 170
+        case 172:
+            r := x * 3 + 171
+        case 173:
+            r := x * 4 + 172
+        case 174:
+            r := x * 5 + 173
+        case 175:
+            r := x * 6 + 174
+        case 176:
+            r := x * 7 + 175
+        case 177:
+            r := x * 8 + 176
+        case 178:
+            r := x * 9 + 177
+        case 179:
+            r := x * 10 + 178
+        case 180:
+            r := x * 11 + 179
+        case 181:
+            r := x * 12 + 180
+        case 182:
+            r := x * 13 + 181
+        case 183:
+            r := x * 1 + 182
+        case 184:
+            r := x * 2 + 183
+        case 185:
+            r := x * 3 + 184
+        case 186:
+            r := x * 4 + 185
+        case 187:
+            r := x * 5 + 186
+        case 188:
+            r := x * 6 + 187
+        case 189:
+            r := x * 7 + 188
+        case 190:
+            r := x * 8 + 189
+        case 191:
+            r := x * 9 + 190
+        case 192:
+            r := x * 10 + 191
+        case 193:
+            r := x * 11 + 192
+        case 194:
+            r := x * 12 + 193
+        case 195:
+            r := x * 13 + 194
+        case 196:
+            r := x * 1 + 195
+        case 197:
+            r := x * 2 + 196
+        case 198:
+            r := x * 3 + 197
+        case 199:
+            r := x * 4 + 198
+        case 200:
+            r := x * 5 + 199
+        case 201:
+            r := x * 6 + 200
+        case 202:
+            r := x * 7 + 201
+        case 203:
+            r := x * 8 + 202
+        case 204:
+            r := x * 9 + 203
+        case 205:
+            r := x * 10 + 204
+        case 206:
+            r := x * 11 + 205
+        case 207:
+            r := x * 12 + 206
+        case 208:
+            r := x * 13 + 207
+        case 209:
+            r := x * 1 + 208
+        case 210:
+            r := x * 2 + 209
+        case 211:
+            r := x * 3 + 210
+        case 212:
+            r := x * 4 + 211
+        case 213:
+            r := x * 5 + 212
+        case 214:
+            r := x * 6 + 213
+        case 215:
+            r := x * 7 + 214
+        case 216:
+            r := x * 8 + 215
+        case 217:
+            r := x * 9 + 216
+        case 218:
+            r := x * 10 + 217
+        case 219:
+            r := x * 11 + 218
+        case 220:
+            r := x * 12 + 219
+        case 221:
+            r := x * 13 + 220
+        case 222:
+            r := x * 1 + 221
+        case 223:
+            r := x * 2 + 222
+        case 224:
+            r := x * 3 + 223
+        case 225:
+            r := x * 4 + 224
+        case 226:
+            r := x * 5 + 225
+        case 227:
+            r := x * 6 + 226
+        case 228:
+            r := x * 7 + 227
+        case 229:
+            r := x * 8 + 228
+        case 230:
+            r := x * 9 + 229
+        case 231:
+            r := x * 10 + 230
+        case 232:
+            r := x * 11 + 231
+        case 233:
+            r := x * 12 + 232
+        case 234:
+            r := x * 13 + 233
+        case 235:
+            r := x * 1 + 234
+        case 236:
+            r := x * 2 + 235
+        case 237:
+            r := x * 3 + 236
+        case 238:
+            r := x * 4 + 237
+        case 239:
+            r := x * 5 + 238
+        case 240:
+            r := x * 6 + 239
+        case 241:
+            r := x * 7 + 240
+        case 242:
+            r := x * 8 + 241
+        case 243:
+            r := x * 9 + 242
+        case 244:
+            r := x * 10 + 243
+        case 245:
+            r := x * 11 + 244
+        case 246:
+            r := x * 12 + 245
+        case 247:
+            r := x * 13 + 246
+        case 248:
+            r := x * 1 + 247
+        case 249:
+            r := x * 2 + 248
+        case 250:
+            r := x * 3 + 249
+        case 251:
+            r := x * 4 + 250
+        case 252:
+            r := x * 5 + 251
+        case 253:
+            r := x * 6 + 252
+        case 254:
+            r := x * 7 + 253
+        case 255:
+            r := x * 8 + 254
+        case 256:
+            r := x * 9 + 255
+        case 257:
+            r := x * 10 + 256
+        case 258:
+            r := x * 11 + 257
+        case 259:
+            r := x * 12 + 258
+        case 260:
+            r := x * 13 + 259
+        case 261:
+            r := x * 1 + 260
+        case 262:
+            r := x * 2 + 261
+        case 263:
+            r := x * 3 + 262
+        case 264:
+            r := x * 4 + 263
+        case 265:
+            r := x * 5 + 264
+        case 266:
+            r := x * 6 + 265
+        case 267:
+            r := x * 7 + 266
+        case 268:
+            r := x * 8 + 267
+        case 269:
+            r := x * 9 + 268
+        case 270:
+            r := x * 10 + 269
+        case 271:
+            r := x * 11 + 270
+        case 272:
+            r := x * 12 + 271
+        case 273:
+            r := x * 13 + 272
+        case 274:
+            r := x * 1 + 273
+        case 275:
+            r := x * 2 + 274
+        case 276:
+            r := x * 3 + 275
+        case 277:
+            r := x * 4 + 276
+        case 278:
+            r := x * 5 + 277
+        case 279:
+            r := x * 6 + 278
+        case 280:
+            r := x * 7 + 279
+        case 281:
+            r := x * 8 + 280
+        case 282:
+            r := x * 9 + 281
+        case 283:
+            r := x * 10 + 282
+        case 284:
+            r := x * 11 + 283
+        case 285:
+            r := x * 12 + 284
+        case 286:
+            r := x * 13 + 285
+        case 287:
+            r := x * 1 + 286
+        case 288:
+            r := x * 2 + 287
+        case 289:
+            r := x * 3 + 288
+        case 290:
+            r := x * 4 + 289
+        case 291:
+            r := x * 5 + 290
+        case 292:
+            r := x * 6 + 291
+        case 293:
+            r := x * 7 + 292
+        case 294:
+            r := x * 8 + 293
+        case 295:
+            r := x * 9 + 294
+        case 296:
+            r := x * 10 + 295
+        case 297:
+            r := x * 11 + 296
+        case 298:
+            r := x * 12 + 297
+        case 299:
+            r := x * 13 + 298
+        case 300:
+            r := x * 1 + 299
+        case 301:
+            r := x * 2 + 300
+        case 302:
+            r := x * 3 + 301
+        case 303:
+            r := x * 4 + 302
+        case 304:
+            r := x * 5 + 303
+        case 305:
+            r := x * 6 + 304
+        case 306:
+            r := x * 7 + 305
+        case 307:
+            r := x * 8 + 306
+        case 308:
+            r := x * 9 + 307
+        case 309:
+            r := x * 10 + 308
+        case 310:
+            r := x * 11 + 309
+        case 311:
+            r := x * 12 + 310
+        case 312:
+            r := x * 13 + 311
+        case 313:
+            r := x * 1 + 312
+        case 314:
+            r := x * 2 + 313
+        case 315:
+            r := x * 3 + 314
+        case 316:
+            r := x * 4 + 315
+        case 317:
+            r := x * 5 + 316
+        case 318:
+            r := x * 6 + 317
+        case 319:
+            r := x * 7 + 318
+        case 320:
+            r := x * 8 + 319
+        case 321:
+            r := x * 9 + 320
+        case 322:
+            r := x * 10 + 321
+        case 323:
+            r := x * 11 + 322
+        case 324:
+            r := x * 12 + 323
+        case 325:
+            r := x * 13 + 324
+        case 326:
+            r := x * 1 + 325
+        case 327:
+            r := x * 2 + 326
+        case 328:
+            r := x * 3 + 327
+        case 329:
+            r := x * 4 + 328
+        case 330:
+            r := x * 5 + 329
+        case 331:
+            r := x * 6 + 330
+        case 332:
+            r := x * 7 + 331
+        case 333:
+            r := x * 8 + 332
+        case 334:
+            r := x * 9 + 333
+        case 335:
+            r := x * 10 + 334
+        case 336:
+            r := x * 11 + 335
+        case 337:
+            r := x * 12 + 336
+        case 338:
+            r := x * 13 + 337
+        case 339:
+            r := x * 1 + 338
+        case 340:
+            r := x * 2 + 339
+        case 341:
+            r := x * 3 + 340
+        case 342:
+            r := x * 4 + 341
+        case 343:
+            r := x * 5 + 342
+        case 344:
+            r := x * 6 + 343
+        case 345:
+            r := x * 7 + 344
+        case 346:
+            r := x * 8 + 345
+        case 347:
+            r := x * 9 + 346
+        case 348:
+            r := x * 10 + 347
+        case 349:
+            r := x * 11 + 348
+        case 350:
+            r := x * 12 + 349
+        case 351:
+            r := x * 13 + 350
+        case 352:
+            r := x * 1 + 351
+        case 353:
+            r := x * 2 + 352
+        case 354:
+            r := x * 3 + 353
+        case 355:
+            r := x * 4 + 354
+        case 356:
+            r := x * 5 + 355
+        case 357:
+            r := x * 6 + 356
+        case 358:
+            r := x * 7 + 357
+        case 359:
+            r := x * 8 + 358
+        case 360:
+            r := x * 9 + 359
+        case 361:
+            r := x * 10 + 360
+        case 362:
+            r := x * 11 + 361
+        case 363:
+            r := x * 12 + 362
+        case 364:
+            r := x * 13 + 363
+        case 365:
+            r := x * 1 + 364
+        case 366:
+            r := x * 2 + 365
+        case 367:
+            r := x * 3 + 366
+        case 368:
+            r := x * 4 + 367
+        case 369:
+            r := x * 5 + 368
+        case 370:
+            r := x * 6 + 369
+        case 371:
+            r := x * 7 + 370
+        case 372:
+            r := x * 8 + 371
+        case 373:
+            r := x * 9 + 372
+        case 374:
+            r := x * 10 + 373
+        case 375:
+            r := x * 11 + 374
+        case 376:
+            r := x * 12 + 375
+        case 377:
+            r := x * 13 + 376
+        case 378:
+            r := x * 1 + 377
+        case 379:
+            r := x * 2 + 378
+        case 380:
+            r := x * 3 + 379
+        case 381:
+            r := x * 4 + 380
+        case 382:
+            r := x * 5 + 381
+        case 383:
+            r := x * 6 + 382
+        case 384:
+            r := x * 7 + 383
+        case 385:
+            r := x * 8 + 384
+        case 386:
+            r := x * 9 + 385
+        case 387:
+            r := x * 10 + 386
+        case 388:
+            r := x * 11 + 387
+        case 389:
+            r := x * 12 + 388
+        case 390:
+            r := x * 13 + 389
+        case 391:
+            r := x * 1 + 390
+        case 392:
+            r := x * 2 + 391
+        case 393:
+            r := x * 3 + 392
+        case 394:
+            r := x * 4 + 393
+        case 395:
+            r := x * 5 + 394
+        case 396:
+            r := x * 6 + 395
+        case 397:
+            r := x * 7 + 396
+        case 398:
+            r := x * 8 + 397
+        case 399:
+            r := x * 9 + 398
+        case 400:
+            r := x * 10 + 399
+        case 401:
+            r := x * 11 + 400
+        case 402:
+            r := x * 12 + 401
+        case 403:
+            r := x * 13 + 402
+        case 404:
+            r := x * 1 + 403
+        case 405:
+            r := x * 2 + 404
+        case 406:
+            r := x * 3 + 405
+        case 407:
+            r := x * 4 + 406
+        case 408:
+            r := x * 5 + 407
+        case 409:
+            r := x * 6 + 408
+        case 410:
+            r := x * 7 + 409
+        case 411:
+            r := x * 8 + 410
+        case 412:
+            r := x * 9 + 411
+        case 413:
+            r := x * 10 + 412
+        case 414:
+            r := x * 11 + 413
+        case 415:
+            r := x * 12 + 414
+        case 416:
+            r := x * 13 + 415
+        case 417:
+            r := x * 1 + 416
+        case 418:
+            r := x * 2 + 417
+        case 419:
+            r := x * 3 + 418
+        case 420:
+            r := x * 4 + 419
+        case 421:
+            r := x * 5 + 420
+        case 422:
+            r := x * 6 + 421
+        case 423:
+            r := x * 7 + 422
+        case 424:
+            r := x * 8 + 423
+        case 425:
+            r := x * 9 + 424
+        case 426:
+            r := x * 10 + 425
+        case 427:
+            r := x * 11 + 426
+        case 428:
+            r := x * 12 + 427
+        case 429:
+            r := x * 13 + 428
+        case 430:
+            r := x * 1 + 429
+        case 431:
+            r := x * 2 + 430
+        case 432:
+            r := x * 3 + 431
+        case 433:
+            r := x * 4 + 432
+        case 434:
+            r := x * 5 + 433
+        case 435:
+            r := x * 6 + 434
+        case 436:
+            r := x * 7 + 435
+        case 437:
+            r := x * 8 + 436
+        case 438:
+            r := x * 9 + 437
+        case 439:
+            r := x * 10 + 438
+        case 440:
+            r := x * 11 + 439
+        case 441:
+            r := x * 12 + 440
+        case 442:
+            r := x * 13 + 441
+        case 443:
+            r := x * 1 + 442
+        case 444:
+            r := x * 2 + 443
+        case 445:
+            r := x * 3 + 444
+        case 446:
+            r := x * 4 + 445
+        case 447:
+            r := x * 5 + 446
+        case 448:
+            r := x * 6 + 447
+        case 449:
+            r := x * 7 + 448
+        case 450:
+            r := x * 8 + 449
+        case 451:
+            r := x * 9 + 450
+        case 452:
+            r := x * 10 + 451
+        case 453:
+            r := x * 11 + 452
+        case 454:
+            r := x * 12 + 453
+        case 455:
+            r := x * 13 + 454
+        case 456:
+            r := x * 1 + 455
+        case 457:
+            r := x * 2 + 456
+        case 458:
+            r := x * 3 + 457
+        case 459:
+            r := x * 4 + 458
+        case 460:
+            r := x * 5 + 459
+        case 461:
+            r := x * 6 + 460
+        case 462:
+            r := x * 7 + 461
+        case 463:
+            r := x * 8 + 462
+        case 464:
+            r := x * 9 + 463
+        case 465:
+            r := x * 10 + 464
+        case 466:
+            r := x * 11 + 465
+        case 467:
+            r := x * 12 + 466
+        case 468:
+            r := x * 13 + 467
+        case 469:
+            r := x * 1 + 468
+        case 470:
+            r := x * 2 + 469
+        case 471:
+            r := x * 3 + 470
+        case 472:
+            r := x * 4 + 471
+        case 473:
+            r := x * 5 + 472
+        case 474:
+            r := x * 6 + 473
+        case 475:
+            r := x * 7 + 474
+        case 476:
+            r := x * 8 + 475
+        case 477:
+            r := x * 9 + 476
+        case 478:
+            r := x * 10 + 477
+        case 479:
+            r := x * 11 + 478
+        case 480:
+            r := x * 12 + 479
+        case 481:
+            r := x * 13 + 480
+        case 482:
+            r := x * 1 + 481
+        case 483:
+            r := x * 2 + 482
+        case 484:
+            r := x * 3 + 483
+        case 485:
+            r := x * 4 + 484
+        case 486:
+            r := x * 5 + 485
+        case 487:
+            r := x * 6 + 486
+        case 488:
+            r := x * 7 + 487
+        case 489:
+            r := x * 8 + 488
+        case 490:
+            r := x * 9 + 489
+        case 491:
+            r := x * 10 + 490
+        case 492:
+            r := x * 11 + 491
+        case 493:
+            r := x * 12 + 492
+        case 494:
+            r := x * 13 + 493
+        case 495:
+            r := x * 1 + 494
+        case 496:
+            r := x * 2 + 495
+        case 497:
+            r := x * 3 + 496
+        case 498:
+            r := x * 4 + 497
+        case 499:
+            r := x * 5 + 498
+        case 500:
+            r := x * 6 + 499
+        case 501:
+            r := x * 7 + 500
+        case 502:
+            r := x * 8 + 501
+        case 503:
+            r := x * 9 + 502
+        case 504:
+            r := x * 10 + 503
+        case 505:
+            r := x * 11 + 504
+        case 506:
+            r := x * 12 + 505
+        case 507:
+            r := x * 13 + 506
+        case 508:
+            r := x * 1 + 507
+        case 509:
+            r := x * 2 + 508
+        case 510:
+            r := x * 3 + 509
+        case 511:
+            r := x * 4 + 510
+        case 512:
+            r := x * 5 + 511
+        case 513:
+            r := x * 6 + 512
+        case 514:
+            r := x * 7 + 513
+        case 515:
+            r := x * 8 + 514
+        case 516:
+            r := x * 9 + 515
+        case 517:
+            r := x * 10 + 516
+        case 518:
+            r := x * 11 + 517
+        case 519:
+            r := x * 12 + 518
+        case 520:
+            r := x * 13 + 519
+        case 521:
+            r := x * 1 + 520
+        case 522:
+            r := x * 2 + 521
+        case 523:
+            r := x * 3 + 522
+        case 524:
+            r := x * 4 + 523
+        case 525:
+            r := x * 5 + 524
+        case 526:
+            r := x * 6 + 525
+        case 527:
+            r := x * 7 + 526
+        case 528:
+            r := x * 8 + 527
+        case 529:
+            r := x * 9 + 528
+        case 530:
+            r := x * 10 + 529
+        case 531:
+            r := x * 11 + 530
+        case 532:
+            r := x * 12 + 531
+        case 533:
+            r := x * 13 + 532
+        case 534:
+            r := x * 1 + 533
+        case 535:
+            r := x * 2 + 534
+        case 536:
+            r := x * 3 + 535
+        case 537:
+            r := x * 4 + 536
+        case 538:
+            r := x * 5 + 537
+        case 539:
+            r := x * 6 + 538
+        case 540:
+            r := x * 7 + 539
+        case 541:
+            r := x * 8 + 540
+        case 542:
+            r := x * 9 + 541
+        case 543:
+            r := x * 10 + 542
+        case 544:
+            r := x * 11 + 543
+        case 545:
+            r := x * 12 + 544
+        case 546:
+            r := x * 13 + 545
+        case 547:
+            r := x * 1 + 546
+        case 548:
+            r := x * 2 + 547
+        case 549:
+            r := x * 3 + 548
+        case 550:
+            r := x * 4 + 549
+        case 551:
+            r := x * 5 + 550
+        case 552:
+            r := x * 6 + 551
+        case 553:
+            r := x * 7 + 552
+        case 554:
+            r := x * 8 + 553
+        case 555:
+            r := x * 9 + 554
+        case 556:
+            r := x * 10 + 555
+        case 557:
+            r := x * 11 + 556
+        case 558:
+            r := x * 12 + 557
+        case 559:
+            r := x * 13 + 558
+        case 560:
+            r := x * 1 + 559
+        case 561:
+            r := x * 2 + 560
+        case 562:
+            r := x * 3 + 561
+        case 563:
+            r := x * 4 + 562
+        case 564:
+            r := x * 5 + 563
+        case 565:
+            r := x * 6 + 564
+        case 566:
+            r := x * 7 + 565
+        case 567:
+            r := x * 8 + 566
+        case 568:
+            r := x * 9 + 567
+        case 569:
+            r := x * 10 + 568
+        case 570:
+            r := x * 11 + 569
+        case 571:
+            r := x * 12 + 570
+        case 572:
+            r := x * 13 + 571
+        case 573:
+            r := x * 1 + 572
+        case 574:
+            r := x * 2 + 573
+        case 575:
+            r := x * 3 + 574
+        case 576:
+            r := x * 4 + 575
+        case 577:
+            r := x * 5 + 576
+        case 578:
+            r := x * 6 + 577
+        case 579:
+            r := x * 7 + 578
+        case 580:
+            r := x * 8 + 579
+        case 581:
+            r := x * 9 + 580
+        case 582:
+            r := x * 10 + 581
+        case 583:
+            r := x * 11 + 582
+        case 584:
+            r := x * 12 + 583
+        case 585:
+            r := x * 13 + 584
+        case 586:
+            r := x * 1 + 585
+        case 587:
+            r := x * 2 + 586
+        case 588:
+            r := x * 3 + 587
+        case 589:
+            r := x * 4 + 588
+        case 590:
+            r := x * 5 + 589
+        case 591:
+            r := x * 6 + 590
+        case 592:
+            r := x * 7 + 591
+        case 593:
+            r := x * 8 + 592
+        case 594:
+            r := x * 9 + 593
+        case 595:
+            r := x * 10 + 594
+        case 596:
+            r := x * 11 + 595
+        case 597:
+            r := x * 12 + 596
+        case 598:
+            r := x * 13 + 597
+        case 599:
+            r := x * 1 + 598
+        case 600:
+            r := x * 2 + 599
+        case 601:
+            r := x * 3 + 600
+        case 602:
+            r := x * 4 + 601
+        case 603:
+            r := x * 5 + 602
+        case 604:
+            r := x * 6 + 603
+        case 605:
+            r := x * 7 + 604
+        case 606:
+            r := x * 8 + 605
+        case 607:
+            r := x * 9 + 606
+        case 608:
+            r := x * 10 + 607
+        case 609:
+            r := x * 11 + 608
+        case 610:
+            r := x * 12 + 609
+        case 611:
+            r := x * 13 + 610
+        case 612:
+            r := x * 1 + 611
+        case 613:
+            r := x * 2 + 612
+        case 614:
+            r := x * 3 + 613
+        case 615:
+            r := x * 4 + 614
+        case 616:
+            r := x * 5 + 615
+        case 617:
+            r := x * 6 + 616
+        case 618:
+            r := x * 7 + 617
+        case 619:
+            r := x * 8 + 618
+        case 620:
+            r := x * 9 + 619
+        case 621:
+            r := x * 10 + 620
+        case 622:
+            r := x * 11 + 621
+        case 623:
+            r := x * 12 + 622
+        case 624:
+            r := x * 13 + 623
+        case 625:
+            r := x * 1 + 624
+        case 626:
+            r := x * 2 + 625
+        case 627:
+            r := x * 3 + 626
+        case 628:
+            r := x * 4 + 627
+        case 629:
+            r := x * 5 + 628
+        case 630:
+            r := x * 6 + 629
+        case 631:
+            r := x * 7 + 630
+        case 632:
+            r := x * 8 + 631
+        case 633:
+            r := x * 9 + 632
+        case 634:
+            r := x * 10 + 633
+        case 635:
+            r := x * 11 + 634
+        case 636:
+            r := x * 12 + 635
+        case 637:
+            r := x * 13 + 636
+        case 638:
+            r := x * 1 + 637
+        case 639:
+            r := x * 2 + 638
+        case 640:
+            r := x * 3 + 639
+        case 641:
+            r := x * 4 + 640
+        case 642:
+            r := x * 5 + 641
+        case 643:
+            r := x * 6 + 642
+        case 644:
+            r := x * 7 + 643
+        case 645:
+            r := x * 8 + 644
+        case 646:
+            r := x * 9 + 645
+        case 647:
+            r := x * 10 + 646
+        case 648:
+            r := x * 11 + 647
+        case 649:
+            r := x * 12 + 648
+        case 650:
+            r := x * 13 + 649
+        case 651:
+            r := x * 1 + 650
+        case 652:
+            r := x * 2 + 651
+        case 653:
+            r := x * 3 + 652
+        case 654:
+            r := x * 4 + 653
+        case 655:
+            r := x * 5 + 654
+        case 656:
+            r := x * 6 + 655
+        case 657:
+            r := x * 7 + 656
+        case 658:
+            r := x * 8 + 657
+        case 659:
+            r := x * 9 + 658
+        case 660:
+            r := x * 10 + 659
+        case 661:
+            r := x * 11 + 660
+        case 662:
+            r := x * 12 + 661
+        case 663:
+            r := x * 13 + 662
+        case 664:
+            r := x * 1 + 663
+        case 665:
+            r := x * 2 + 664
+        case 666:
+            r := x * 3 + 665
+        case 667:
+            r := x * 4 + 666
+        case 668:
+            r := x * 5 + 667
+        case 669:
+            r := x * 6 + 668
+        case 670:
+            r := x * 7 + 669
+        case 671:
+            r := x * 8 + 670
+        case 672:
+            r := x * 9 + 671
+        case 673:
+            r := x * 10 + 672
+        case 674:
+            r := x * 11 + 673
+        case 675:
+            r := x * 12 + 674
+        case 676:
+            r := x * 13 + 675
+        case 677:
+            r := x * 1 + 676
+        case 678:
+            r := x * 2 + 677
+        case 679:
+            r := x * 3 + 678
+        case 680:
+            r := x * 4 + 679
+        case 681:
+            r := x * 5 + 680
+        case 682:
+            r := x * 6 + 681
+        case 683:
+            r := x * 7 + 682
+        case 684:
+            r := x * 8 + 683
+        case 685:
+            r := x * 9 + 684
+        case 686:
+            r := x * 10 + 685
+        case 687:
+            r := x * 11 + 686
+        case 688:
+            r := x * 12 + 687
+        case 689:
+            r := x * 13 + 688
+        case 690:
+            r := x * 1 + 689
+        case 691:
+            r := x * 2 + 690
+        case 692:
+            r := x * 3 + 691
+        case 693:
+            r := x * 4 + 692
+        case 694:
+            r := x * 5 + 693
+        case 695:
+            r := x * 6 + 694
+        case 696:
+            r := x * 7 + 695
+        case 697:
+            r := x * 8 + 696
+        case 698:
+            r := x * 9 + 697
+        case 699:
+            r := x * 10 + 698
+        case 700:
+            r := x * 11 + 699
+        case 701:
+            r := x * 12 + 700
+        case 702:
+            r := x * 13 + 701
+        case 703:
+            r := x * 1 + 702
+        case 704:
+            r := x * 2 + 703
+        case 705:
+            r := x * 3 + 704
+        case 706:
+            r := x * 4 + 705
+        case 707:
+            r := x * 5 + 706
+        case 708:
+            r := x * 6 + 707
+        case 709:
+            r := x * 7 + 708
+        case 710:
+            r := x * 8 + 709
+        case 711:
+            r := x * 9 + 710
+        case 712:
+            r := x * 10 + 711
+        case 713:
+            r := x * 11 + 712
+        case 714:
+            r := x * 12 + 713
+        case 715:
+            r := x * 13 + 714
+        case 716:
+            r := x * 1 + 715
+        case 717:
+            r := x * 2 + 716
+        case 718:
+            r := x * 3 + 717
+        case 719:
+            r := x * 4 + 718
+        case 720:
+            r := x * 5 + 719
+        case 721:
+            r := x * 6 + 720
+        case 722:
+            r := x * 7 + 721
+        case 723:
+            r := x * 8 + 722
+        case 724:
+            r := x * 9 + 723
+        case 725:
+            r := x * 10 + 724
+        case 726:
+            r := x * 11 + 725
+        case 727:
+            r := x * 12 + 726
+        case 728:
+            r := x * 13 + 727
+        case 729:
+            r := x * 1 + 728
+        case 730:
+            r := x * 2 + 729
+        case 731:
+            r := x * 3 + 730
+        case 732:
+            r := x * 4 + 731
+        case 733:
+            r := x * 5 + 732
+        case 734:
+            r := x * 6 + 733
+        case 735:
+            r := x * 7 + 734
+        case 736:
+            r := x * 8 + 735
+        case 737:
+            r := x * 9 + 736
+        case 738:
+            r := x * 10 + 737
+        case 739:
+            r := x * 11 + 738
+        case 740:
+            r := x * 12 + 739
+        case 741:
+            r := x * 13 + 740
+        case 742:
+            r := x * 1 + 741
+        case 743:
+            r := x * 2 + 742
+        case 744:
+            r := x * 3 + 743
+        case 745:
+            r := x * 4 + 744
+        case 746:
+            r := x * 5 + 745
+        case 747:
+            r := x * 6 + 746
+        case 748:
+            r := x * 7 + 747
+        case 749:
+            r := x * 8 + 748
+        case 750:
+            r := x * 9 + 749
+        case 751:
+            r := x * 10 + 750
+        case 752:
+            r := x * 11 + 751
+        case 753:
+            r := x * 12 + 752
+        case 754:
+            r := x * 13 + 753
+        case 755:
+            r := x * 1 + 754
+        case 756:
+            r := x * 2 + 755
+        case 757:
+            r := x * 3 + 756
+        case 758:
+            r := x * 4 + 757
+        case 759:
+            r := x * 5 + 758
+        case 760:
+            r := x * 6 + 759
+        case 761:
+            r := x * 7 + 760
+        case 762:
+            r := x * 8 + 761
+        case 763:
+            r := x * 9 + 762
+        case 764:
+            r := x * 10 + 763
+        case 765:
+            r := x * 11 + 764
+        case 766:
+            r := x * 12 + 765
+        case 767:
+            r := x * 13 + 766
+        case 768:
+            r := x * 1 + 767
+        case 769:
+            r := x * 2 + 768
+        case 770:
+            r := x * 3 + 769
+        case 771:
+            r := x * 4 + 770
+        case 772:
+            r := x * 5 + 771
+        case 773:
+            r := x * 6 + 772
+        case 774:
+            r := x * 7 + 773
+        case 775:
+            r := x * 8 + 774
+        case 776:
+            r := x * 9 + 775
+        case 777:
+            r := x * 10 + 776
+        case 778:
+            r := x * 11 + 777
+        case 779:
+            r := x * 12 + 778
+        case 780:
+            r := x * 13 + 779
+        case 781:
+            r := x * 1 + 780
+        case 782:
+            r := x * 2 + 781
+        case 783:
+            r := x * 3 + 782
+        case 784:
+            r := x * 4 + 783
+        case 785:
+            r := x * 5 + 784
+        case 786:
+            r := x * 6 + 785
+        case 787:
+            r := x * 7 + 786
+        case 788:
+            r := x * 8 + 787
+        case 789:
+            r := x * 9 + 788
+        case 790:
+            r := x * 10 + 789
+        case 791:
+            r := x * 11 + 790
+        case 792:
+            r := x * 12 + 791
+        case 793:
+            r := x * 13 + 792
+        case 794:
+            r := x * 1 + 793
+        case 795:
+            r := x * 2 + 794
+        case 796:
+            r := x * 3 + 795
+        case 797:
+            r := x * 4 + 796
+        case 798:
+            r := x * 5 + 797
+        case 799:
+            r := x * 6 + 798
+        case 800:
+            r := x * 7 + 799
+        case 801:
+            r := x * 8 + 800
+        case 802:
+            r := x * 9 + 801
+        case 803:
+            r := x * 10 + 802
+        case 804:
+            r := x * 11 + 803
+        case 805:
+            r := x * 12 + 804
+        case 806:
+            r := x * 13 + 805
+        case 807:
+            r := x * 1 + 806
+        case 808:
+            r := x * 2 + 807
+        case 809:
+            r := x * 3 + 808
+        case 810:
+            r := x * 4 + 809
+        case 811:
+            r := x * 5 + 810
+        case 812:
+            r := x * 6 + 811
+        case 813:
+            r := x * 7 + 812
+        case 814:
+            r := x * 8 + 813
+        case 815:
+            r := x * 9 + 814
+        case 816:
+            r := x * 10 + 815
+        case 817:
+            r := x * 11 + 816
+        case 818:
+            r := x * 12 + 817
+        case 819:
+            r := x * 13 + 818
+        case 820:
+            r := x * 1 + 819
+        case 821:
+            r := x * 2 + 820
+        case 822:
+            r := x * 3 + 821
+        case 823:
+            r := x * 4 + 822
+        case 824:
+            r := x * 5 + 823
+        case 825:
+            r := x * 6 + 824
+        case 826:
+            r := x * 7 + 825
+        case 827:
+            r := x * 8 + 826
+        case 828:
+            r := x * 9 + 827
+        case 829:
+            r := x * 10 + 828
+        case 830:
+            r := x * 11 + 829
+        case 831:
+            r := x * 12 + 830
+        case 832:
+            r := x * 13 + 831
+        case 833:
+            r := x * 1 + 832
+        case 834:
+            r := x * 2 + 833
+        case 835:
+            r := x * 3 + 834
+        case 836:
+            r := x * 4 + 835
+        case 837:
+            r := x * 5 + 836
+        case 838:
+            r := x * 6 + 837
+        case 839:
+            r := x * 7 + 838
+        case 840:
+            r := x * 8 + 839
+        case 841:
+            r := x * 9 + 840
+        case 842:
+            r := x * 10 + 841
+        case 843:
+            r := x * 11 + 842
+        case 844:
+            r := x * 12 + 843
+        case 845:
+            r := x * 13 + 844
+        case 846:
+            r := x * 1 + 845
+        case 847:
+            r := x * 2 + 846
+        case 848:
+            r := x * 3 + 847
+        case 849:
+            r := x * 4 + 848
+        case 850:
+            r := x * 5 + 849
+        case 851:
+            r := x * 6 + 850
+        case 852:
+            r := x * 7 + 851
+        case 853:
+            r := x * 8 + 852
+        case 854:
+            r := x * 9 + 853
+        case 855:
+            r := x * 10 + 854
+        case 856:
+            r := x * 11 + 855
+        case 857:
+            r := x * 12 + 856
+        case 858:
+            r := x * 13 + 857
+        case 859:
+            r := x * 1 + 858
+        case 860:
+            r := x * 2 + 859
+        case 861:
+            r := x * 3 + 860
+        case 862:
+            r := x * 4 + 861
+        case 863:
+            r := x * 5 + 862
+        case 864:
+            r := x * 6 + 863
+        case 865:
+            r := x * 7 + 864
+        case 866:
+            r := x * 8 + 865
+        case 867:
+            r := x * 9 + 866
+        case 868:
+            r := x * 10 + 867
+        case 869:
+            r := x * 11 + 868
+        case 870:
+            r := x * 12 + 869
+        case 871:
+            r := x * 13 + 870
+        case 872:
+            r := x * 1 + 871
+        case 873:
+            r := x * 2 + 872
+        case 874:
+            r := x * 3 + 873
+        case 875:
+            r := x * 4 + 874
+        case 876:
+            r := x * 5 + 875
+        case 877:
+            r := x * 6 + 876
+        case 878:
+            r := x * 7 + 877
+        case 879:
+            r := x * 8 + 878
+        case 880:
+            r := x * 9 + 879
+        case 881:
+            r := x * 10 + 880
+        case 882:
+            r := x * 11 + 881
+        case 883:
+            r := x * 12 + 882
+        case 884:
+            r := x * 13 + 883
+        case 885:
+            r := x * 1 + 884
+        case 886:
+            r := x * 2 + 885
+        case 887:
+            r := x * 3 + 886
+        case 888:
+            r := x * 4 + 887
+        case 889:
+            r := x * 5 + 888
+        case 890:
+            r := x * 6 + 889
+        case 891:
+            r := x * 7 + 890
+        case 892:
+            r := x * 8 + 891
+        case 893:
+            r := x * 9 + 892
+        case 894:
+            r := x * 10 + 893
+        case 895:
+            r := x * 11 + 894
+        case 896:
+            r := x * 12 + 895
+        case 897:
+            r := x * 13 + 896
+        case 898:
+            r := x * 1 + 897
+        case 899:
+            r := x * 2 + 898
+        case 900:
+            r := x * 3 + 899
+        case 901:
+            r := x * 4 + 900
+        case 902:
+            r := x * 5 + 901
+        case 903:
+            r := x * 6 + 902
+        case 904:
+            r := x * 7 + 903
+        case 905:
+            r := x * 8 + 904
+        case 906:
+            r := x * 9 + 905
+        case 907:
+            r := x * 10 + 906
+        case 908:
+            r := x * 11 + 907
+        case 909:
+            r := x * 12 + 908
+        case 910:
+            r := x * 13 + 909
+        case 911:
+            r := x * 1 + 910
+        case 912:
+            r := x * 2 + 911
+        case 913:
+            r := x * 3 + 912
+        case 914:
+            r := x * 4 + 913
+        case 915:
+            r := x * 5 + 914
+        case 916:
+            r := x * 6 + 915
+        case 917:
+            r := x * 7 + 916
+        case 918:
+            r := x * 8 + 917
+        case 919:
+            r := x * 9 + 918
+        case 920:
+            r := x * 10 + 919
+        case 921:
+            r := x * 11 + 920
+        case 922:
+            r := x * 12 + 921
+        case 923:
+            r := x * 13 + 922
+        case 924:
+            r := x * 1 + 923
+        case 925:
+            r := x * 2 + 924
+        case 926:
+            r := x * 3 + 925
+        case 927:
+            r := x * 4 + 926
+        case 928:
+            r := x * 5 + 927
+        case 929:
+            r := x * 6 + 928
+        case 930:
+            r := x * 7 + 929
+        case 931:
+            r := x * 8 + 930
+        case 932:
+            r := x * 9 + 931
+        case 933:
+            r := x * 10 + 932
+        case 934:
+            r := x * 11 + 933
+        case 935:
+            r := x * 12 + 934
+        case 936:
+            r := x * 13 + 935
+        case 937:
+            r := x * 1 + 936
+        case 938:
+            r := x * 2 + 937
+        case 939:
+            r := x * 3 + 938
+        case 940:
+            r := x * 4 + 939
+        case 941:
+            r := x * 5 + 940
+        case 942:
+            r := x * 6 + 941
+        case 943:
+            r := x * 7 + 942
+        case 944:
+            r := x * 8 + 943
+        case 945:
+            r := x * 9 + 944
+        case 946:
+            r := x * 10 + 945
+        case 947:
+            r := x * 11 + 946
+        case 948:
+            r := x * 12 + 947
+        case 949:
+            r := x * 13 + 948
+        case 950:
+            r := x * 1 + 949
+        case 951:
+            r := x * 2 + 950
+        case 952:
+            r := x * 3 + 951
+        case 953:
+            r := x * 4 + 952
+        case 954:
+            r := x * 5 + 953
+        case 955:
+            r := x * 6 + 954
+        case 956:
+            r := x * 7 + 955
+        case 957:
+            r := x * 8 + 956
+        case 958:
+            r := x * 9 + 957
+        case 959:
+            r := x * 10 + 958
+        case 960:
+            r := x * 11 + 959
+        case 961:
+            r := x * 12 + 960
+        case 962:
+            r := x * 13 + 961
+        case 963:
+            r := x * 1 + 962
+        case 964:
+            r := x * 2 + 963
+        case 965:
+            r := x * 3 + 964
+        case 966:
+            r := x * 4 + 965
+        case 967:
+            r := x * 5 + 966
+        case 968:
+            r := x * 6 + 967
+        case 969:
+            r := x * 7 + 968
+        case 970:
+            r := x * 8 + 969
+        case 971:
+            r := x * 9 + 970
+        case 972:
+            r := x * 10 + 971
+        case 973:
+            r := x * 11 + 972
+        case 974:
+            r := x * 12 + 973
+        case 975:
+            r := x * 13 + 974
+        case 976:
+            r := x * 1 + 975
+        case 977:
+            r := x * 2 + 976
+        case 978:
+            r := x * 3 + 977
+        case 979:
+            r := x * 4 + 978
+        case 980:
+            r := x * 5 + 979
+        case 981:
+            r := x * 6 + 980
+        case 982:
+            r := x * 7 + 981
+        case 983:
+            r := x * 8 + 982
+        case 984:
+            r := x * 9 + 983
+        case 985:
+            r := x * 10 + 984
+        case 986:
+            r := x * 11 + 985
+        case 987:
+            r := x * 12 + 986
+        case 988:
+            r := x * 13 + 987
+        case 989:
+            r := x * 1 + 988
+        case 990:
+            r := x * 2 + 989
+        case 991:
+            r := x * 3 + 990
+        case 992:
+            r := x * 4 + 991
+        case 993:
+            r := x * 5 + 992
+        case 994:
+            r := x * 6 + 993
+        case 995:
+            r := x * 7 + 994
+        case 996:
+            r := x * 8 + 995
+        case 997:
+            r := x * 9 + 996
+        case 998:
+            r := x * 10 + 997
+        case 999:
+            r := x * 11 + 998
+        case 1000:
+            r := x * 12 + 999
+        case 1001:
+            r := x * 13 + 1000
+        case 1002:
+            r := x * 1 + 1001
+        case 1003:
+            r := x * 2 + 1002
+        case 1004:
+            r := x * 3 + 1003
+        case 1005:
+            r := x * 4 + 1004
+        case 1006:
+            r := x * 5 + 1005
+        case 1007:
+            r := x * 6 + 1006
+        case 1008:
+            r := x * 7 + 1007
+        case 1009:
+            r := x * 8 + 1008
+        case 1010:
+            r := x * 9 + 1009
+        case 1011:
+            r := x * 10 + 1010
+        case 1012:
+            r := x * 11 + 1011
+        case 1013:
+            r := x * 12 + 1012
+        case 1014:
+            r := x * 13 + 1013
+        case 1015:
+            r := x * 1 + 1014
+        case 1016:
+            r := x * 2 + 1015
+        case 1017:
+            r := x * 3 + 1016
+        case 1018:
+            r := x * 4 + 1017
+        case 1019:
+            r := x * 5 + 1018
+        case 1020:
+            r := x * 6 + 1019
+        case 1021:
+            r := x * 7 + 1020
+        case 1022:
+            r := x * 8 + 1021
+        case 1023:
+            r := x * 9 + 1022
+        case 1024:
+            r := x * 10 + 1023
+        case 1025:
+            r := x * 11 + 1024
+        case 1026:
+            r := x * 12 + 1025
+        case 1027:
+            r := x * 13 + 1026
+        case 1028:
+            r := x * 1 + 1027
+        case 1029:
+            r := x * 2 + 1028
+        case 1030:
+            r := x * 3 + 1029
+        case 1031:
+            r := x * 4 + 1030
+        case 1032:
+            r := x * 5 + 1031
+        case 1033:
+            r := x * 6 + 1032
+        case 1034:
+            r := x * 7 + 1033
+        case 1035:
+            r := x * 8 + 1034
+        case 1036:
+            r := x * 9 + 1035
+        case 1037:
+            r := x * 10 + 1036
+        case 1038:
+            r := x * 11 + 1037
+        case 1039:
+            r := x * 12 + 1038
+        case 1040:
+            r := x * 13 + 1039
+        case 1041:
+            r := x * 1 + 1040
+        case 1042:
+            r := x * 2 + 1041
+        case 1043:
+            r := x * 3 + 1042
+        case 1044:
+            r := x * 4 + 1043
+        case 1045:
+            r := x * 5 + 1044
+        case 1046:
+            r := x * 6 + 1045
+        case 1047:
+            r := x * 7 + 1046
+        case 1048:
+            r := x * 8 + 1047
+        case 1049:
+            r := x * 9 + 1048
+        case 1050:
+            r := x * 10 + 1049
+        case 1051:
+            r := x * 11 + 1050
+        case 1052:
+            r := x * 12 + 1051
+        case 1053:
+            r := x * 13 + 1052
+        case 1054:
+            r := x * 1 + 1053
+        case 1055:
+            r := x * 2 + 1054
+        case 1056:
+            r := x * 3 + 1055
+        case 1057:
+            r := x * 4 + 1056
+        case 1058:
+            r := x * 5 + 1057
+        case 1059:
+            r := x * 6 + 1058
+        case 1060:
+            r := x * 7 + 1059
+        case 1061:
+            r := x * 8 + 1060
+        case 1062:
+            r := x * 9 + 1061
+        case 1063:
+            r := x * 10 + 1062
+        case 1064:
+            r := x * 11 + 1063
+        case 1065:
+            r := x * 12 + 1064
+        case 1066:
+            r := x * 13 + 1065
+        case 1067:
+            r := x * 1 + 1066
+        case 1068:
+            r := x * 2 + 1067
+        case 1069:
+            r := x * 3 + 1068
+        case 1070:
+            r := x * 4 + 1069
+        case 1071:
+            r := x * 5 + 1070
+        case 1072:
+            r := x * 6 + 1071
+        case 1073:
+            r := x * 7 + 1072
+        case 1074:
+            r := x * 8 + 1073
+        case 1075:
+            r := x * 9 + 1074
+        case 1076:
+            r := x * 10 + 1075
+        case 1077:
+            r := x * 11 + 1076
+        case 1078:
+            r := x * 12 + 1077
+        case 1079:
+            r := x * 13 + 1078
+        case 1080:
+            r := x * 1 + 1079
+        case 1081:
+            r := x * 2 + 1080
+        case 1082:
+            r := x * 3 + 1081
+        case 1083:
+            r := x * 4 + 1082
+        case 1084:
+            r := x * 5 + 1083
+        case 1085:
+            r := x * 6 + 1084
+        case 1086:
+            r := x * 7 + 1085
+        case 1087:
+            r := x * 8 + 1086
+        case 1088:
+            r := x * 9 + 1087
+        case 1089:
+            r := x * 10 + 1088
+        case 1090:
+            r := x * 11 + 1089
+        case 1091:
+            r := x * 12 + 1090
+        case 1092:
+            r := x * 13 + 1091
+        case 1093:
+            r := x * 1 + 1092
+        case 1094:
+            r := x * 2 + 1093
+        case 1095:
+            r := x * 3 + 1094
+        case 1096:
+            r := x * 4 + 1095
+        case 1097:
+            r := x * 5 + 1096
+        case 1098:
+            r := x * 6 + 1097
+        case 1099:
+            r := x * 7 + 1098
+        case 1100:
+            r := x * 8 + 1099
+        case 1101:
+            r := x * 9 + 1100
+        case 1102:
+            r := x * 10 + 1101
+        case 1103:
+            r := x * 11 + 1102
+        case 1104:
+            r := x * 12 + 1103
+        case 1105:
+            r := x * 13 + 1104
+        case 1106:
+            r := x * 1 + 1105
+        case 1107:
+            r := x * 2 + 1106
+        case 1108:
+            r := x * 3 + 1107
+        case 1109:
+            r := x * 4 + 1108
+        case 1110:
+            r := x * 5 + 1109
+        case 1111:
+            r := x * 6 + 1110
+        case 1112:
+            r := x * 7 + 1111
+        case 1113:
+            r := x * 8 + 1112
+        case 1114:
+            r := x * 9 + 1113
+        case 1115:
+            r := x * 10 + 1114
+        case 1116:
+            r := x * 11 + 1115
+        case 1117:
+            r := x * 12 + 1116
+        case 1118:
+            r := x * 13 + 1117
+        case 1119:
+            r := x * 1 + 1118
+        case 1120:
+            r := x * 2 + 1119
+        case 1121:
+            r := x * 3 + 1120
+        case 1122:
+            r := x * 4 + 1121
+        case 1123:
+            r := x * 5 + 1122
+        case 1124:
+            r := x * 6 + 1123
+        case 1125:
+            r := x * 7 + 1124
+        case 1126:
+            r := x * 8 + 1125
+        case 1127:
+            r := x * 9 + 1126
+        case 1128:
+            r := x * 10 + 1127
+        case 1129:
+            r := x * 11 + 1128
+        case 1130:
+            r := x * 12 + 1129
+        case 1131:
+            r := x * 13 + 1130
+        case 1132:
+            r := x * 1 + 1131
+        case 1133:
+            r := x * 2 + 1132
+        case 1134:
+            r := x * 3 + 1133
+        case 1135:
+            r := x * 4 + 1134
+        case 1136:
+            r := x * 5 + 1135
+        case 1137:
+            r := x * 6 + 1136
+        case 1138:
+            r := x * 7 + 1137
+        case 1139:
+            r := x * 8 + 1138
+        case 1140:
+            r := x * 9 + 1139
+        case 1141:
+            r := x * 10 + 1140
+        case 1142:
+            r := x * 11 + 1141
+        case 1143:
+            r := x * 12 + 1142
+        case 1144:
+            r := x * 13 + 1143
+        case 1145:
+            r := x * 1 + 1144
+        case 1146:
+            r := x * 2 + 1145
+        case 1147:
+            r := x * 3 + 1146
+        case 1148:
+            r := x * 4 + 1147
+        case 1149:
+            r := x * 5 + 1148
+        case 1150:
+            r := x * 6 + 1149
+        case 1151:
+            r := x * 7 + 1150
+        case 1152:
+            r := x * 8 + 1151
+        case 1153:
+            r := x * 9 + 1152
+        case 1154:
+            r := x * 10 + 1153
+        case 1155:
+            r := x * 11 + 1154
+        case 1156:
+            r := x * 12 + 1155
+        case 1157:
+            r := x * 13 + 1156
+        case 1158:
+            r := x * 1 + 1157
+        case 1159:
+            r := x * 2 + 1158
+        case 1160:
+            r := x * 3 + 1159
+        case 1161:
+            r := x * 4 + 1160
+        case 1162:
+            r := x * 5 + 1161
+        case 1163:
+            r := x * 6 + 1162
+        case 1164:
+            r := x * 7 + 1163
+        case 1165:
+            r := x * 8 + 1164
+        case 1166:
+            r := x * 9 + 1165
+        case 1167:
+            r := x * 10 + 1166
+        case 1168:
+            r := x * 11 + 1167
+        case 1169:
+            r := x * 12 + 1168
+        case 1170:
+            r := x * 13 + 1169
+        case 1171:
+            r := x * 1 + 1170
+        case 1172:
+            r := x * 2 + 1171
+        case 1173:
+            r := x * 3 + 1172
+        case 1174:
+            r := x * 4 + 1173
+        case 1175:
+            r := x * 5 + 1174
+        case 1176:
+            r := x * 6 + 1175
+        case 1177:
+            r := x * 7 + 1176
+        case 1178:
+            r := x * 8 + 1177
+        case 1179:
+            r := x * 9 + 1178
+        case 1180:
+            r := x * 10 + 1179
+        case 1181:
+            r := x * 11 + 1180
+        case 1182:
+            r := x * 12 + 1181
+        case 1183:
+            r := x * 13 + 1182
+        case 1184:
+            r := x * 1 + 1183
+        case 1185:
+            r := x * 2 + 1184
+        case 1186:
+            r := x * 3 + 1185
+        case 1187:
+            r := x * 4 + 1186
+        case 1188:
+            r := x * 5 + 1187
+        case 1189:
+            r := x * 6 + 1188
+        case 1190:
+            r := x * 7 + 1189
+        case 1191:
+            r := x * 8 + 1190
+        case 1192:
+            r := x * 9 + 1191
+        case 1193:
+            r := x * 10 + 1192
+        case 1194:
+            r := x * 11 + 1193
+        case 1195:
+            r := x * 12 + 1194
+        case 1196:
+            r := x * 13 + 1195
+        case 1197:
+            r := x * 1 + 1196
+        case 1198:
+            r := x * 2 + 1197
+        case 1199:
+            r := x * 3 + 1198
+        case 1200:
+            r := x * 4 + 1199
+        case 1201:
+            r := x * 5 + 1200
+        case 1202:
+            r := x * 6 + 1201
+        case 1203:
+            r := x * 7 + 1202
+        case 1204:
+            r := x * 8 + 1203
+        case 1205:
+            r := x * 9 + 1204
+        case 1206:
+            r := x * 10 + 1205
+        case 1207:
+            r := x * 11 + 1206
+        case 1208:
+            r := x * 12 + 1207
+        case 1209:
+            r := x * 13 + 1208
+        case 1210:
+            r := x * 1 + 1209
+        case 1211:
+            r := x * 2 + 1210
+        case 1212:
+            r := x * 3 + 1211
+        case 1213:
+            r := x * 4 + 1212
+        case 1214:
+            r := x * 5 + 1213
+        case 1215:
+            r := x * 6 + 1214
+        case 1216:
+            r := x * 7 + 1215
+        case 1217:
+            r := x * 8 + 1216
+        case 1218:
+            r := x * 9 + 1217
+        case 1219:
+            r := x * 10 + 1218
+        case 1220:
+            r := x * 11 + 1219
+        case 1221:
+            r := x * 12 + 1220
+        case 1222:
+            r := x * 13 + 1221
+        case 1223:
+            r := x * 1 + 1222
+        case 1224:
+            r := x * 2 + 1223
+        case 1225:
+            r := x * 3 + 1224
+        case 1226:
+            r := x * 4 + 1225
+        case 1227:
+            r := x * 5 + 1226
+        case 1228:
+            r := x * 6 + 1227
+        case 1229:
+            r := x * 7 + 1228
+        case 1230:
+            r := x * 8 + 1229
+        case 1231:
+            r := x * 9 + 1230
+        case 1232:
+            r := x * 10 + 1231
+        case 1233:
+            r := x * 11 + 1232
+        case 1234:
+            r := x * 12 + 1233
+        case 1235:
+            r := x * 13 + 1234
+        case 1236:
+            r := x * 1 + 1235
+        case 1237:
+            r := x * 2 + 1236
+        case 1238:
+            r := x * 3 + 1237
+        case 1239:
+            r := x * 4 + 1238
+        case 1240:
+            r := x * 5 + 1239
+        case 1241:
+            r := x * 6 + 1240
+        case 1242:
+            r := x * 7 + 1241
+        case 1243:
+            r := x * 8 + 1242
+        case 1244:
+            r := x * 9 + 1243
+        case 1245:
+            r := x * 10 + 1244
+        case 1246:
+            r := x * 11 + 1245
+        case 1247:
+            r := x * 12 + 1246
+        case 1248:
+            r := x * 13 + 1247
+        case 1249:
+            r := x * 1 + 1248
+        case 1250:
+            r := x * 2 + 1249
+        case 1251:
+            r := x * 3 + 1250
+        case 1252:
+            r := x * 4 + 1251
+        case 1253:
+            r := x * 5 + 1252
+        case 1254:
+            r := x * 6 + 1253
+        case 1255:
+            r := x * 7 + 1254
+        case 1256:
+            r := x * 8 + 1255
+        case 1257:
+            r := x * 9 + 1256
+        case 1258:
+            r := x * 10 + 1257
+        case 1259:
+            r := x * 11 + 1258
+        case 1260:
+            r := x * 12 + 1259
+        case 1261:
+            r := x * 13 + 1260
+        case 1262:
+            r := x * 1 + 1261
+        case 1263:
+            r := x * 2 + 1262
+        case 1264:
+            r := x * 3 + 1263
+        case 1265:
+            r := x * 4 + 1264
+        case 1266:
+            r := x * 5 + 1265
+        case 1267:
+            r := x * 6 + 1266
+        case 1268:
+            r := x * 7 + 1267
+        case 1269:
+            r := x * 8 + 1268
+        case 1270:
+            r := x * 9 + 1269
+        case 1271:
+            r := x * 10 + 1270
+        case 1272:
+            r := x * 11 + 1271
+        case 1273:
+            r := x * 12 + 1272
+        case 1274:
+            r := x * 13 + 1273
+        case 1275:
+            r := x * 1 + 1274
+        case 1276:
+            r := x * 2 + 1275
+        case 1277:
+            r := x * 3 + 1276
+        case 1278:
+            r := x * 4 + 1277
+        case 1279:
+            r := x * 5 + 1278
+        case 1280:
+            r := x * 6 + 1279
+        case 1281:
+            r := x * 7 + 1280
+        case 1282:
+            r := x * 8 + 1281
+        case 1283:
+            r := x * 9 + 1282
+        case 1284:
+            r := x * 10 + 1283
+        case 1285:
+            r := x * 11 + 1284
+        case 1286:
+            r := x * 12 + 1285
+        case 1287:
+            r := x * 13 + 1286
+        case 1288:
+            r := x * 1 + 1287
+        case 1289:
+            r := x * 2 + 1288
+        case 1290:
+            r := x * 3 + 1289
+        case 1291:
+            r := x * 4 + 1290
+        case 1292:
+            r := x * 5 + 1291
+        case 1293:
+            r := x * 6 + 1292
+        case 1294:
+            r := x * 7 + 1293
+        case 1295:
+            r := x * 8 + 1294
+        case 1296:
+            r := x * 9 + 1295
+        case 1297:
+            r := x * 10 + 1296
+        case 1298:
+            r := x * 11 + 1297
+        case 1299:
+            r := x * 12 + 1298
+        case 1300:
+            r := x * 13 + 1299
+        case 1301:
+            r := x * 1 + 1300
+        case 1302:
+            r := x * 2 + 1301
+        case 1303:
+            r := x * 3 + 1302
+        case 1304:
+            r := x * 4 + 1303
+        case 1305:
+            r := x * 5 + 1304
+        case 1306:
+            r := x * 6 + 1305
+        case 1307:
+            r := x * 7 + 1306
+        case 1308:
+            r := x * 8 + 1307
+        case 1309:
+            r := x * 9 + 1308
+        case 1310:
+            r := x * 10 + 1309
+        case 1311:
+            r := x * 11 + 1310
+        case 1312:
+            r := x * 12 + 1311
+        case 1313:
+            r := x * 13 + 1312
+        case 1314:
+            r := x * 1 + 1313
+        case 1315:
+            r := x * 2 + 1314
+        case 1316:
+            r := x * 3 + 1315
+        case 1317:
+            r := x * 4 + 1316
+        case 1318:
+            r := x * 5 + 1317
+        case 1319:
+            r := x * 6 + 1318
+        case 1320:
+            r := x * 7 + 1319
+        case 1321:
+            r := x * 8 + 1320
+        case 1322:
+            r := x * 9 + 1321
+        case 1323:
+            r := x * 10 + 1322
+        case 1324:
+            r := x * 11 + 1323
+        case 1325:
+            r := x * 12 + 1324
+        case 1326:
+            r := x * 13 + 1325
+        case 1327:
+            r := x * 1 + 1326
+        case 1328:
+            r := x * 2 + 1327
+        case 1329:
+            r := x * 3 + 1328
+        case 1330:
+            r := x * 4 + 1329
+        case 1331:
+            r := x * 5 + 1330
+        case 1332:
+            r := x * 6 + 1331
+        case 1333:
+            r := x * 7 + 1332
+        case 1334:
+            r := x * 8 + 1333
+        case 1335:
+            r := x * 9 + 1334
+        case 1336:
+            r := x * 10 + 1335
+        case 1337:
+            r := x * 11 + 1336
+        case 1338:
+            r := x * 12 + 1337
+        case 1339:
+            r := x * 13 + 1338
+        case 1340:
+            r := x * 1 + 1339
+        case 1341:
+            r := x * 2 + 1340
+        case 1342:
+            r := x * 3 + 1341
+        case 1343:
+            r := x * 4 + 1342
+        case 1344:
+            r := x * 5 + 1343
+        case 1345:
+            r := x * 6 + 1344
+        case 1346:
+            r := x * 7 + 1345
+        case 1347:
+            r := x * 8 + 1346
+        case 1348:
+            r := x * 9 + 1347
+        case 1349:
+            r := x * 10 + 1348
+        case 1350:
+            r := x * 11 + 1349
+        case 1351:
+            r := x * 12 + 1350
+        case 1352:
+            r := x * 13 + 1351
+        case 1353:
+            r := x * 1 + 1352
+        case 1354:
+            r := x * 2 + 1353
+        case 1355:
+            r := x * 3 + 1354
+        case 1356:
+            r := x * 4 + 1355
+        case 1357:
+            r := x * 5 + 1356
+        case 1358:
+            r := x * 6 + 1357
+        case 1359:
+            r := x * 7 + 1358
+        case 1360:
+            r := x * 8 + 1359
+        case 1361:
+            r := x * 9 + 1360
+        case 1362:
+            r := x * 10 + 1361
+        case 1363:
+            r := x * 11 + 1362
+        case 1364:
+            r := x * 12 + 1363
+        case 1365:
+            r := x * 13 + 1364
+        case 1366:
+            r := x * 1 + 1365
+        case 1367:
+            r := x * 2 + 1366
+        case 1368:
+            r := x * 3 + 1367
+        case 1369:
+            r := x * 4 + 1368
+        case 1370:
+            r := x * 5 + 1369
+        case 1371:
+            r := x * 6 + 1370
+        case 1372:
+            r := x * 7 + 1371
+        case 1373:
+            r := x * 8 + 1372
+        case 1374:
+            r := x * 9 + 1373
+        case 1375:
+            r := x * 10 + 1374
+        case 1376:
+            r := x * 11 + 1375
+        case 1377:
+            r := x * 12 + 1376
+        case 1378:
+            r := x * 13 + 1377
+        case 1379:
+            r := x * 1 + 1378
+        case 1380:
+            r := x * 2 + 1379
+        case 1381:
+            r := x * 3 + 1380
+        case 1382:
+            r := x * 4 + 1381
+        case 1383:
+            r := x * 5 + 1382
+        case 1384:
+            r := x * 6 + 1383
+        case 1385:
+            r := x * 7 + 1384
+        case 1386:
+            r := x * 8 + 1385
+        case 1387:
+            r := x * 9 + 1386
+        case 1388:
+            r := x * 10 + 1387
+        case 1389:
+            r := x * 11 + 1388
+        case 1390:
+            r := x * 12 + 1389
+        case 1391:
+            r := x * 13 + 1390
+        case 1392:
+            r := x * 1 + 1391
+        case 1393:
+            r := x * 2 + 1392
+        case 1394:
+            r := x * 3 + 1393
+        case 1395:
+            r := x * 4 + 1394
+        case 1396:
+            r := x * 5 + 1395
+        case 1397:
+            r := x * 6 + 1396
+        case 1398:
+            r := x * 7 + 1397
+        case 1399:
+            r := x * 8 + 1398
+        case 1400:
+            r := x * 9 + 1399
+        case 1401:
+            r := x * 10 + 1400
+        case 1402:
+            r := x * 11 + 1401
+        case 1403:
+            r := x * 12 + 1402
+        case 1404:
+            r := x * 13 + 1403
+        case 1405:
+            r := x * 1 + 1404
+        case 1406:
+            r := x * 2 + 1405
+        case 1407:
+            r := x * 3 + 1406
+        case 1408:
+            r := x * 4 + 1407
+        case 1409:
+            r := x * 5 + 1408
+        case 1410:
+            r := x * 6 + 1409
+        case 1411:
+            r := x * 7 + 1410
+        case 1412:
+            r := x * 8 + 1411
+        case 1413:
+            r := x * 9 + 1412
+        case 1414:
+            r := x * 10 + 1413
+        case 1415:
+            r := x * 11 + 1414
+        case 1416:
+            r := x * 12 + 1415
+        case 1417:
+            r := x * 13 + 1416
+        case 1418:
+            r := x * 1 + 1417
+        case 1419:
+            r := x * 2 + 1418
+        case 1420:
+            r := x * 3 + 1419
+        case 1421:
+            r := x * 4 + 1420
+        case 1422:
+            r := x * 5 + 1421
+        case 1423:
+            r := x * 6 + 1422
+        case 1424:
+            r := x * 7 + 1423
+        case 1425:
+            r := x * 8 + 1424
+        case 1426:
+            r := x * 9 + 1425
+        case 1427:
+            r := x * 10 + 1426
+        case 1428:
+            r := x * 11 + 1427
+        case 1429:
+            r := x * 12 + 1428
+        case 1430:
+            r := x * 13 + 1429
+        case 1431:
+            r := x * 1 + 1430
+        case 1432:
+            r := x * 2 + 1431
+        case 1433:
+            r := x * 3 + 1432
+        case 1434:
+            r := x * 4 + 1433
+        case 1435:
+            r := x * 5 + 1434
+        case 1436:
+            r := x * 6 + 1435
+        case 1437:
+            r := x * 7 + 1436
+        case 1438:
+            r := x * 8 + 1437
+        case 1439:
+            r := x * 9 + 1438
+        case 1440:
+            r := x * 10 + 1439
+        case 1441:
+            r := x * 11 + 1440
+        case 1442:
+            r := x * 12 + 1441
+        case 1443:
+            r := x * 13 + 1442
+        case 1444:
+            r := x * 1 + 1443
+        case 1445:
+            r := x * 2 + 1444
+        case 1446:
+            r := x * 3 + 1445
+        case 1447:
+            r := x * 4 + 1446
+        case 1448:
+            r := x * 5 + 1447
+        case 1449:
+            r := x * 6 + 1448
+        case 1450:
+            r := x * 7 + 1449
+        case 1451:
+            r := x * 8 + 1450
+        case 1452:
+            r := x * 9 + 1451
+        case 1453:
+            r := x * 10 + 1452
+        case 1454:
+            r := x * 11 + 1453
+        case 1455:
+            r := x * 12 + 1454
+        case 1456:
+            r := x * 13 + 1455
+        case 1457:
+            r := x * 1 + 1456
+        case 1458:
+            r := x * 2 + 1457
+        case 1459:
+            r := x * 3 + 1458
+        case 1460:
+            r := x * 4 + 1459
+        case 1461:
+            r := x * 5 + 1460
+        case 1462:
+            r := x * 6 + 1461
+        case 1463:
+            r := x * 7 + 1462
+        case 1464:
+            r := x * 8 + 1463
+        case 1465:
+            r := x * 9 + 1464
+        case 1466:
+            r := x * 10 + 1465
+        case 1467:
+            r := x * 11 + 1466
+        case 1468:
+            r := x * 12 + 1467
+        case 1469:
+            r := x * 13 + 1468
+        case 1470:
+            r := x * 1 + 1469
+        case 1471:
+            r := x * 2 + 1470
+        case 1472:
+            r := x * 3 + 1471
+        case 1473:
+            r := x * 4 + 1472
+        case 1474:
+            r := x * 5 + 1473
+        case 1475:
+            r := x * 6 + 1474
+        case 1476:
+            r := x * 7 + 1475
+        case 1477:
+            r := x * 8 + 1476
+        case 1478:
+            r := x * 9 + 1477
+        case 1479:
+            r := x * 10 + 1478
+        case 1480:
+            r := x * 11 + 1479
+        case 1481:
+            r := x * 12 + 1480
+        case 1482:
+            r := x * 13 + 1481
+        case 1483:
+            r := x * 1 + 1482
+        case 1484:
+            r := x * 2 + 1483
+        case 1485:
+            r := x * 3 + 1484
+        case 1486:
+            r := x * 4 + 1485
+        case 1487:
+            r := x * 5 + 1486
+        case 1488:
+            r := x * 6 + 1487
+        case 1489:
+            r := x * 7 + 1488
+        case 1490:
+            r := x * 8 + 1489
+        case 1491:
+            r := x * 9 + 1490
+        case 1492:
+            r := x * 10 + 1491
+        case 1493:
+            r := x * 11 + 1492
+        case 1494:
+            r := x * 12 + 1493
+        case 1495:
+            r := x * 13 + 1494
+        case 1496:
+            r := x * 1 + 1495
+        case 1497:
+            r := x * 2 + 1496
+        case 1498:
+            r := x * 3 + 1497
+        case 1499:
+            r := x * 4 + 1498
+        case 1500:
+            r := x * 5 + 1499
+        case 1501:
+            r := x * 6 + 1500
+        case 1502:
+            r := x * 7 + 1501
+        case 1503:
+            r := x * 8 + 1502
+        case 1504:
+            r := x * 9 + 1503
+        case 1505:
+            r := x * 10 + 1504
+        case 1506:
+            r := x * 11 + 1505
+        case 1507:
+            r := x * 12 + 1506
+        case 1508:
+            r := x * 13 + 1507
+        case 1509:
+            r := x * 1 + 1508
+        case 1510:
+            r := x * 2 + 1509
+        case 1511:
+            r := x * 3 + 1510
+        case 1512:
+            r := x * 4 + 1511
+        case 1513:
+            r := x * 5 + 1512
+        case 1514:
+            r := x * 6 + 1513
+        case 1515:
+            r := x * 7 + 1514
+        case 1516:
+            r := x * 8 + 1515
+        case 1517:
+            r := x * 9 + 1516
+        case 1518:
+            r := x * 10 + 1517
+        case 1519:
+            r := x * 11 + 1518
+        case 1520:
+            r := x * 12 + 1519
+        case 1521:
+            r := x * 13 + 1520
+        case 1522:
+            r := x * 1 + 1521
+        case 1523:
+            r := x * 2 + 1522
+        case 1524:
+            r := x * 3 + 1523
+        case 1525:
+            r := x * 4 + 1524
+        case 1526:
+            r := x * 5 + 1525
+        case 1527:
+            r := x * 6 + 1526
+        case 1528:
+            r := x * 7 + 1527
+        case 1529:
+            r := x * 8 + 1528
+        case 1530:
+            r := x * 9 + 1529
+        case 1531:
+            r := x * 10 + 1530
+        case 1532:
+            r := x * 11 + 1531
+        case 1533:
+            r := x * 12 + 1532
+        case 1534:
+            r := x * 13 + 1533
+        case 1535:
+            r := x * 1 + 1534
+        case 1536:
+            r := x * 2 + 1535
+        case 1537:
+            r := x * 3 + 1536
+        case 1538:
+            r := x * 4 + 1537
+        case 1539:
+            r := x * 5 + 1538
+        case 1540:
+            r := x * 6 + 1539
+        case 1541:
+            r := x * 7 + 1540
+        case 1542:
+            r := x * 8 + 1541
+        case 1543:
+            r := x * 9 + 1542
+        case 1544:
+            r := x * 10 + 1543
+        case 1545:
+            r := x * 11 + 1544
+        case 1546:
+            r := x * 12 + 1545
+        case 1547:
+            r := x * 13 + 1546
+        case 1548:
+            r := x * 1 + 1547
+        case 1549:
+            r := x * 2 + 1548
+        case 1550:
+            r := x * 3 + 1549
+        case 1551:
+            r := x * 4 + 1550
+        case 1552:
+            r := x * 5 + 1551
+        case 1553:
+            r := x * 6 + 1552
+        case 1554:
+            r := x * 7 + 1553
+        case 1555:
+            r := x * 8 + 1554
+        case 1556:
+            r := x * 9 + 1555
+        case 1557:
+            r := x * 10 + 1556
+        case 1558:
+            r := x * 11 + 1557
+        case 1559:
+            r := x * 12 + 1558
+        case 1560:
+            r := x * 13 + 1559
+        case 1561:
+            r := x * 1 + 1560
+        case 1562:
+            r := x * 2 + 1561
+        case 1563:
+            r := x * 3 + 1562
+        case 1564:
+            r := x * 4 + 1563
+        case 1565:
+            r := x * 5 + 1564
+        case 1566:
+            r := x * 6 + 1565
+        case 1567:
+            r := x * 7 + 1566
+        case 1568:
+            r := x * 8 + 1567
+        case 1569:
+            r := x * 9 + 1568
+        case 1570:
+            r := x * 10 + 1569
+        case 1571:
+            r := x * 11 + 1570
+        case 1572:
+            r := x * 12 + 1571
+        case 1573:
+            r := x * 13 + 1572
+        case 1574:
+            r := x * 1 + 1573
+        case 1575:
+            r := x * 2 + 1574
+        case 1576:
+            r := x * 3 + 1575
+        case 1577:
+            r := x * 4 + 1576
+        case 1578:
+            r := x * 5 + 1577
+        case 1579:
+            r := x * 6 + 1578
+        case 1580:
+            r := x * 7 + 1579
+        case 1581:
+            r := x * 8 + 1580
+        case 1582:
+            r := x * 9 + 1581
+        case 1583:
+            r := x * 10 + 1582
+        case 1584:
+            r := x * 11 + 1583
+        case 1585:
+            r := x * 12 + 1584
+        case 1586:
+            r := x * 13 + 1585
+        case 1587:
+            r := x * 1 + 1586
+        case 1588:
+            r := x * 2 + 1587
+        case 1589:
+            r := x * 3 + 1588
+        case 1590:
+            r := x * 4 + 1589
+        case 1591:
+            r := x * 5 + 1590
+        case 1592:
+            r := x * 6 + 1591
+        case 1593:
+            r := x * 7 + 1592
+        case 1594:
+            r := x * 8 + 1593
+        case 1595:
+            r := x * 9 + 1594
+        case 1596:
+            r := x * 10 + 1595
+        case 1597:
+            r := x * 11 + 1596
+        case 1598:
+            r := x * 12 + 1597
+        case 1599:
+            r := x * 13 + 1598
+        case 1600:
+            r := x * 1 + 1599
+        case 1601:
+            r := x * 2 + 1600
+        case 1602:
+            r := x * 3 + 1601
+        case 1603:
+            r := x * 4 + 1602
+        case 1604:
+            r := x * 5 + 1603
+        case 1605:
+            r := x * 6 + 1604
+        case 1606:
+            r := x * 7 + 1605
+        case 1607:
+            r := x * 8 + 1606
+        case 1608:
+            r := x * 9 + 1607
+        case 1609:
+            r := x * 10 + 1608
+        case 1610:
+            r := x * 11 + 1609
+        case 1611:
+            r := x * 12 + 1610
+        case 1612:
+            r := x * 13 + 1611
+        case 1613:
+            r := x * 1 + 1612
+        case 1614:
+            r := x * 2 + 1613
+        case 1615:
+            r := x * 3 + 1614
+        case 1616:
+            r := x * 4 + 1615
+        case 1617:
+            r := x * 5 + 1616
+        case 1618:
+            r := x * 6 + 1617
+        case 1619:
+            r := x * 7 + 1618
+        case 1620:
+            r := x * 8 + 1619
+        case 1621:
+            r := x * 9 + 1620
+        case 1622:
+            r := x * 10 + 1621
+        case 1623:
+            r := x * 11 + 1622
+        case 1624:
+            r := x * 12 + 1623
+        case 1625:
+            r := x * 13 + 1624
+        case 1626:
+            r := x * 1 + 1625
+        case 1627:
+            r := x * 2 + 1626
+        case 1628:
+            r := x * 3 + 1627
+        case 1629:
+            r := x * 4 + 1628
+        case 1630:
+            r := x * 5 + 1629
+        case 1631:
+            r := x * 6 + 1630
+        case 1632:
+            r := x * 7 + 1631
+        case 1633:
+            r := x * 8 + 1632
+        case 1634:
+            r := x * 9 + 1633
+        case 1635:
+            r := x * 10 + 1634
+        case 1636:
+            r := x * 11 + 1635
+        case 1637:
+            r := x * 12 + 1636
+        case 1638:
+            r := x * 13 + 1637
+        case 1639:
+            r := x * 1 + 1638
+        case 1640:
+            r := x * 2 + 1639
+        case 1641:
+            r := x * 3 + 1640
+        case 1642:
+            r := x * 4 + 1641
+        case 1643:
+            r := x * 5 + 1642
+        case 1644:
+            r := x * 6 + 1643
+        case 1645:
+            r := x * 7 + 1644
+        case 1646:
+            r := x * 8 + 1645
+        case 1647:
+            r := x * 9 + 1646
+        case 1648:
+            r := x * 10 + 1647
+        case 1649:
+            r := x * 11 + 1648
+        case 1650:
+            r := x * 12 + 1649
+        case 1651:
+            r := x * 13 + 1650
+        case 1652:
+            r := x * 1 + 1651
+        case 1653:
+            r := x * 2 + 1652
+        case 1654:
+            r := x * 3 + 1653
+        case 1655:
+            r := x * 4 + 1654
+        case 1656:
+            r := x * 5 + 1655
+        case 1657:
+            r := x * 6 + 1656
+        case 1658:
+            r := x * 7 + 1657
+        case 1659:
+            r := x * 8 + 1658
+        case 1660:
+            r := x * 9 + 1659
+        case 1661:
+            r := x * 10 + 1660
+        case 1662:
+            r := x * 11 + 1661
+        case 1663:
+            r := x * 12 + 1662
+        case 1664:
+            r := x * 13 + 1663
+        case 1665:
+            r := x * 1 + 1664
+        case 1666:
+            r := x * 2 + 1665
+        case 1667:
+            r := x * 3 + 1666
+        case 1668:
+            r := x * 4 + 1667
+        case 1669:
+            r := x * 5 + 1668
+        case 1670:
+            r := x * 6 + 1669
+        case 1671:
+            r := x * 7 + 1670
+        case 1672:
+            r := x * 8 + 1671
+        case 1673:
+            r := x * 9 + 1672
+        case 1674:
+            r := x * 10 + 1673
+        case 1675:
+            r := x * 11 + 1674
+        case 1676:
+            r := x * 12 + 1675
+        case 1677:
+            r := x * 13 + 1676
+        case 1678:
+            r := x * 1 + 1677
+        case 1679:
+            r := x * 2 + 1678
+        case 1680:
+            r := x * 3 + 1679
+        case 1681:
+            r := x * 4 + 1680
+        case 1682:
+            r := x * 5 + 1681
+        case 1683:
+            r := x * 6 + 1682
+        case 1684:
+            r := x * 7 + 1683
+        case 1685:
+            r := x * 8 + 1684
+        case 1686:
+            r := x * 9 + 1685
+        case 1687:
+            r := x * 10 + 1686
+        case 1688:
+            r := x * 11 + 1687
+        case 1689:
+            r := x * 12 + 1688
+        case 1690:
+            r := x * 13 + 1689
+        case 1691:
+            r := x * 1 + 1690
+        case 1692:
+            r := x * 2 + 1691
+        case 1693:
+            r := x * 3 + 1692
+        case 1694:
+            r := x * 4 + 1693
+        case 1695:
+            r := x * 5 + 1694
+        case 1696:
+            r := x * 6 + 1695
+        case 1697:
+            r := x * 7 + 1696
+        case 1698:
+            r := x * 8 + 1697
+        case 1699:
+            r := x * 9 + 1698
+        case 1700:
+            r := x * 10 + 1699
+        case 1701:
+            r := x * 11 + 1700
+        case 1702:
+            r := x * 12 + 1701
+        case 1703:
+            r := x * 13 + 1702
+        case 1704:
+            r := x * 1 + 1703
+        case 1705:
+            r := x * 2 + 1704
+        case 1706:
+            r := x * 3 + 1705
+        case 1707:
+            r := x * 4 + 1706
+        case 1708:
+            r := x * 5 + 1707
+        case 1709:
+            r := x * 6 + 1708
+        case 1710:
+            r := x * 7 + 1709
+        case 1711:
+            r := x * 8 + 1710
+        case 1712:
+            r := x * 9 + 1711
+        case 1713:
+            r := x * 10 + 1712
+        case 1714:
+            r := x * 11 + 1713
+        case 1715:
+            r := x * 12 + 1714
+        case 1716:
+            r := x * 13 + 1715
+        case 1717:
+            r := x * 1 + 1716
+        case 1718:
+            r := x * 2 + 1717
+        case 1719:
+            r := x * 3 + 1718
+        case 1720:
+            r := x * 4 + 1719
+        case 1721:
+            r := x * 5 + 1720
+        case 1722:
+            r := x * 6 + 1721
+        case 1723:
+            r := x * 7 + 1722
+        case 1724:
+            r := x * 8 + 1723
+        case 1725:
+            r := x * 9 + 1724
+        case 1726:
+            r := x * 10 + 1725
+        case 1727:
+            r := x * 11 + 1726
+        case 1728:
+            r := x * 12 + 1727
+        case 1729:
+            r := x * 13 + 1728
+        case 1730:
+            r := x * 1 + 1729
+        case 1731:
+            r := x * 2 + 1730
+        case 1732:
+            r := x * 3 + 1731
+        case 1733:
+            r := x * 4 + 1732
+        case 1734:
+            r := x * 5 + 1733
+        case 1735:
+            r := x * 6 + 1734
+        case 1736:
+            r := x * 7 + 1735
+        case 1737:
+            r := x * 8 + 1736
+        case 1738:
+            r := x * 9 + 1737
+        case 1739:
+            r := x * 10 + 1738
+        case 1740:
+            r := x * 11 + 1739
+        case 1741:
+            r := x * 12 + 1740
+        case 1742:
+            r := x * 13 + 1741
+        case 1743:
+            r := x * 1 + 1742
+        case 1744:
+            r := x * 2 + 1743
+        case 1745:
+            r := x * 3 + 1744
+        case 1746:
+            r := x * 4 + 1745
+        case 1747:
+            r := x * 5 + 1746
+        case 1748:
+            r := x * 6 + 1747
+        case 1749:
+            r := x * 7 + 1748
+        case 1750:
+            r := x * 8 + 1749
+        case 1751:
+            r := x * 9 + 1750
+        case 1752:
+            r := x * 10 + 1751
+        case 1753:
+            r := x * 11 + 1752
+        case 1754:
+            r := x * 12 + 1753
+        case 1755:
+            r := x * 13 + 1754
+        case 1756:
+            r := x * 1 + 1755
+        case 1757:
+            r := x * 2 + 1756
+        case 1758:
+            r := x * 3 + 1757
+        case 1759:
+            r := x * 4 + 1758
+        case 1760:
+            r := x * 5 + 1759
+        case 1761:
+            r := x * 6 + 1760
+        case 1762:
+            r := x * 7 + 1761
+        case 1763:
+            r := x * 8 + 1762
+        case 1764:
+            r := x * 9 + 1763
+        case 1765:
+            r := x * 10 + 1764
+        case 1766:
+            r := x * 11 + 1765
+        case 1767:
+            r := x * 12 + 1766
+        case 1768:
+            r := x * 13 + 1767
+        case 1769:
+            r := x * 1 + 1768
+        case 1770:
+            r := x * 2 + 1769
+        case 1771:
+            r := x * 3 + 1770
+        case 1772:
+            r := x * 4 + 1771
+        case 1773:
+            r := x * 5 + 1772
+        case 1774:
+            r := x * 6 + 1773
+        case 1775:
+            r := x * 7 + 1774
+        case 1776:
+            r := x * 8 + 1775
+        case 1777:
+            r := x * 9 + 1776
+        case 1778:
+            r := x * 10 + 1777
+        case 1779:
+            r := x * 11 + 1778
+        case 1780:
+            r := x * 12 + 1779
+        case 1781:
+            r := x * 13 + 1780
+        case 1782:
+            r := x * 1 + 1781
+        case 1783:
+            r := x * 2 + 1782
+        case 1784:
+            r := x * 3 + 1783
+        case 1785:
+            r := x * 4 + 1784
+        case 1786:
+            r := x * 5 + 1785
+        case 1787:
+            r := x * 6 + 1786
+        case 1788:
+            r := x * 7 + 1787
+        case 1789:
+            r := x * 8 + 1788
+        case 1790:
+            r := x * 9 + 1789
+        case 1791:
+            r := x * 10 + 1790
+        case 1792:
+            r := x * 11 + 1791
+        case 1793:
+            r := x * 12 + 1792
+        case 1794:
+            r := x * 13 + 1793
+        case 1795:
+            r := x * 1 + 1794
+        case 1796:
+            r := x * 2 + 1795
+        case 1797:
+            r := x * 3 + 1796
+        case 1798:
+            r := x * 4 + 1797
+        case 1799:
+            r := x * 5 + 1798
+        case 1800:
+            r := x * 6 + 1799
+        case 1801:
+            r := x * 7 + 1800
+        case 1802:
+            r := x * 8 + 1801
+        case 1803:
+            r := x * 9 + 1802
+        case 1804:
+            r := x * 10 + 1803
+        case 1805:
+            r := x * 11 + 1804
+        case 1806:
+            r := x * 12 + 1805
+        case 1807:
+            r := x * 13 + 1806
+        case 1808:
+            r := x * 1 + 1807
+        case 1809:
+            r := x * 2 + 1808
+        case 1810:
+            r := x * 3 + 1809
+        case 1811:
+            r := x * 4 + 1810
+        case 1812:
+            r := x * 5 + 1811
+        case 1813:
+            r := x * 6 + 1812
+        case 1814:
+            r := x * 7 + 1813
+        case 1815:
+            r := x * 8 + 1814
+        case 1816:
+            r := x * 9 + 1815
+        case 1817:
+            r := x * 10 + 1816
+        case 1818:
+            r := x * 11 + 1817
+        case 1819:
+            r := x * 12 + 1818
+        case 1820:
+            r := x * 13 + 1819
+        case 1821:
+            r := x * 1 + 1820
+        case 1822:
+            r := x * 2 + 1821
+        case 1823:
+            r := x * 3 + 1822
+        case 1824:
+            r := x * 4 + 1823
+        case 1825:
+            r := x * 5 + 1824
+        case 1826:
+            r := x * 6 + 1825
+        case 1827:
+            r := x * 7 + 1826
+        case 1828:
+            r := x * 8 + 1827
+        case 1829:
+            r := x * 9 + 1828
+        case 1830:
+            r := x * 10 + 1829
+        case 1831:
+            r := x * 11 + 1830
+        case 1832:
+            r := x * 12 + 1831
+        case 1833:
+            r := x * 13 + 1832
+        case 1834:
+            r := x * 1 + 1833
+        case 1835:
+            r := x * 2 + 1834
+        case 1836:
+            r := x * 3 + 1835
+        case 1837:
+            r := x * 4 + 1836
+        case 1838:
+            r := x * 5 + 1837
+        case 1839:
+            r := x * 6 + 1838
+        case 1840:
+            r := x * 7 + 1839
+        case 1841:
+            r := x * 8 + 1840
+        case 1842:
+            r := x * 9 + 1841
+        case 1843:
+            r := x * 10 + 1842
+        case 1844:
+            r := x * 11 + 1843
+        case 1845:
+            r := x * 12 + 1844
+        case 1846:
+            r := x * 13 + 1845
+        case 1847:
+            r := x * 1 + 1846
+        case 1848:
+            r := x * 2 + 1847
+        case 1849:
+            r := x * 3 + 1848
+        case 1850:
+            r := x * 4 + 1849
+        case 1851:
+            r := x * 5 + 1850
+        case 1852:
+            r := x * 6 + 1851
+        case 1853:
+            r := x * 7 + 1852
+        case 1854:
+            r := x * 8 + 1853
+        case 1855:
+            r := x * 9 + 1854
+        case 1856:
+            r := x * 10 + 1855
+        case 1857:
+            r := x * 11 + 1856
+        case 1858:
+            r := x * 12 + 1857
+        case 1859:
+            r := x * 13 + 1858
+        case 1860:
+            r := x * 1 + 1859
+        case 1861:
+            r := x * 2 + 1860
+        case 1862:
+            r := x * 3 + 1861
+        case 1863:
+            r := x * 4 + 1862
+        case 1864:
+            r := x * 5 + 1863
+        case 1865:
+            r := x * 6 + 1864
+        case 1866:
+            r := x * 7 + 1865
+        case 1867:
+            r := x * 8 + 1866
+        case 1868:
+            r := x * 9 + 1867
+        case 1869:
+            r := x * 10 + 1868
+        case 1870:
+            r := x * 11 + 1869
+        case 1871:
+            r := x * 12 + 1870
+        case 1872:
+            r := x * 13 + 1871
+        case 1873:
+            r := x * 1 + 1872
+        case 1874:
+            r := x * 2 + 1873
+        case 1875:
+            r := x * 3 + 1874
+        case 1876:
+            r := x * 4 + 1875
+        case 1877:
+            r := x * 5 + 1876
+        case 1878:
+            r := x * 6 + 1877
+        case 1879:
+            r := x * 7 + 1878
+        case 1880:
+            r := x * 8 + 1879
+        case 1881:
+            r := x * 9 + 1880
+        case 1882:
+            r := x * 10 + 1881
+        case 1883:
+            r := x * 11 + 1882
+        case 1884:
+            r := x * 12 + 1883
+        case 1885:
+            r := x * 13 + 1884
+        case 1886:
+            r := x * 1 + 1885
+        case 1887:
+            r := x * 2 + 1886
+        case 1888:
+            r := x * 3 + 1887
+        case 1889:
+            r := x * 4 + 1888
+        case 1890:
+            r := x * 5 + 1889
+        case 1891:
+            r := x * 6 + 1890
+        case 1892:
+            r := x * 7 + 1891
+        case 1893:
+            r := x * 8 + 1892
+        case 1894:
+            r := x * 9 + 1893
+        case 1895:
+            r := x * 10 + 1894
+        case 1896:
+            r := x * 11 + 1895
+        case 1897:
+            r := x * 12 + 1896
+        case 1898:
+            r := x * 13 + 1897
+        case 1899:
+            r := x * 1 + 1898
+        case 1900:
+            r := x * 2 + 1899
+        case 1901:
+            r := x * 3 + 1900
+        case 1902:
+            r := x * 4 + 1901
+        case 1903:
+            r := x * 5 + 1902
+        case 1904:
+            r := x * 6 + 1903
+        case 1905:
+            r := x * 7 + 1904
+        case 1906:
+            r := x * 8 + 1905
+        case 1907:
+            r := x * 9 + 1906
+        case 1908:
+            r := x * 10 + 1907
+        case 1909:
+            r := x * 11 + 1908
+        case 1910:
+            r := x * 12 + 1909
+        case 1911:
+            r := x * 13 + 1910
+        case 1912:
+            r := x * 1 + 1911
+        case 1913:
+            r := x * 2 + 1912
+        case 1914:
+            r := x * 3 + 1913
+        case 1915:
+            r := x * 4 + 1914
+        case 1916:
+            r := x * 5 + 1915
+        case 1917:
+            r := x * 6 + 1916
+        case 1918:
+            r := x * 7 + 1917
+        case 1919:
+            r := x * 8 + 1918
+        case 1920:
+            r := x * 9 + 1919
+        case 1921:
+            r := x * 10 + 1920
+        case 1922:
+            r := x * 11 + 1921
+        case 1923:
+            r := x * 12 + 1922
+        case 1924:
+            r := x * 13 + 1923
+        case 1925:
+            r := x * 1 + 1924
+        case 1926:
+            r := x * 2 + 1925
+        case 1927:
+            r := x * 3 + 1926
+        case 1928:
+            r := x * 4 + 1927
+        case 1929:
+            r := x * 5 + 1928
+        case 1930:
+            r := x * 6 + 1929
+        case 1931:
+            r := x * 7 + 1930
+        case 1932:
+            r := x * 8 + 1931
+        case 1933:
+            r := x * 9 + 1932
+        case 1934:
+            r := x * 10 + 1933
+        case 1935:
+            r := x * 11 + 1934
+        case 1936:
+            r := x * 12 + 1935
+        case 1937:
+            r := x * 13 + 1936
+        case 1938:
+            r := x * 1 + 1937
+        case 1939:
+            r := x * 2 + 1938
+        case 1940:
+            r := x * 3 + 1939
+        case 1941:
+            r := x * 4 + 1940
+        case 1942:
+            r := x * 5 + 1941
+        case 1943:
+            r := x * 6 + 1942
+        case 1944:
+            r := x * 7 + 1943
+        case 1945:
+            r := x * 8 + 1944
+        case 1946:
+            r := x * 9 + 1945
+        case 1947:
+            r := x * 10 + 1946
+        case 1948:
+            r := x * 11 + 1947
+        case 1949:
+            r := x * 12 + 1948
+        case 1950:
+            r := x * 13 + 1949
+        case 1951:
+            r := x * 1 + 1950
+        case 1952:
+            r := x * 2 + 1951
+        case 1953:
+            r := x * 3 + 1952
+        case 1954:
+            r := x * 4 + 1953
+        case 1955:
+            r := x * 5 + 1954
+        case 1956:
+            r := x * 6 + 1955
+        case 1957:
+            r := x * 7 + 1956
+        case 1958:
+            r := x * 8 + 1957
+        case 1959:
+            r := x * 9 + 1958
+        case 1960:
+            r := x * 10 + 1959
+        case 1961:
+            r := x * 11 + 1960
+        case 1962:
+            r := x * 12 + 1961
+        case 1963:
+            r := x * 13 + 1962
+        case 1964:
+            r := x * 1 + 1963
+        case 1965:
+            r := x * 2 + 1964
+        case 1966:
+            r := x * 3 + 1965
+        case 1967:
+            r := x * 4 + 1966
+        case 1968:
+            r := x * 5 + 1967
+        case 1969:
+            r := x * 6 + 1968
+        case 1970:
+            r := x * 7 + 1969
+        case 1971:
+            r := x * 8 + 1970
+        case 1972:
+            r := x * 9 + 1971
+        case 1973:
+            r := x * 10 + 1972
+        case 1974:
+            r := x * 11 + 1973
+        case 1975:
+            r := x * 12 + 1974
+        case 1976:
+            r := x * 13 + 1975
+        case 1977:
+            r := x * 1 + 1976
+        case 1978:
+            r := x * 2 + 1977
+        case 1979:
+            r := x * 3 + 1978
+        case 1980:
+            r := x * 4 + 1979
+        case 1981:
+            r := x * 5 + 1980
+        case 1982:
+            r := x * 6 + 1981
+        case 1983:
+            r := x * 7 + 1982
+        case 1984:
+            r := x * 8 + 1983
+        case 1985:
+            r := x * 9 + 1984
+        case 1986:
+            r := x * 10 + 1985
+        case 1987:
+            r := x * 11 + 1986
+        case 1988:
+            r := x * 12 + 1987
+        case 1989:
+            r := x * 13 + 1988
+        case 1990:
+            r := x * 1 + 1989
+        case 1991:
+            r := x * 2 + 1990
+        case 1992:
+            r := x * 3 + 1991
+        case 1993:
+            r := x * 4 + 1992
+        case 1994:
+            r := x * 5 + 1993
+        case 1995:
+            r := x * 6 + 1994
+        case 1996:
+            r := x * 7 + 1995
+        case 1997:
+            r := x * 8 + 1996
+        case 1998:
+            r := x * 9 + 1997
+        case 1999:
+            r := x * 10 + 1998
+        case 2000:
+            r := x * 11 + 1999
+        default:
+            r := 0
+    }
+}
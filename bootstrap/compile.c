@@ -23,9 +23,12 @@
 
 #include "syntax.h"
 #include "compile.h"
+#include "report.h"
+#include "intern.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 
 #define COMPILE_ERROR_RETURN(c, msg)        \
     do {                                    \
@@ -38,10 +41,6 @@
 /* Declarations */
 static compiler_error_t *
 _error_new(compiler_error_code_t, pos_t);
-static compiler_instr_t *
-_instr_new(void);
-static void
-_instr_delete(compiler_instr_t *);
 static compiler_var_table_t *
 _var_table_initialize(compiler_var_table_t *);
 static void
@@ -50,6 +49,10 @@ static compiler_env_t *
 _env_new(compiler_t *);
 static void
 _env_delete(compiler_env_t *);
+static compiler_env_t *
+_env_push(compiler_t *, compiler_env_t *);
+static void
+_env_pop(compiler_env_t *);
 static compiler_val_t *
 _expr(compiler_t *, compiler_env_t *, expr_t *);
 static compiler_val_t *
@@ -90,40 +93,23 @@ _error_new(compiler_error_code_t code, pos_t pos)
 }
 
 /*
- * _instr_new -- allocate a new instruction
+ * _var_table_init -- initialize a variable table
  */
-static compiler_instr_t *
-_instr_new(void)
+static compiler_var_table_t *
+_var_table_initialize(compiler_var_table_t *t)
 {
-    compiler_instr_t *instr;
+    compiler_var_t **buckets;
 
-    instr = malloc(sizeof(compiler_instr_t));
-    if ( instr == NULL ) {
+    buckets = malloc(sizeof(compiler_var_t *) * COMPILER_VAR_TABLE_INIT_SIZE);
+    if ( buckets == NULL ) {
         return NULL;
     }
-    memset(instr, 0, sizeof(compiler_instr_t));
-
-    return instr;
-}
+    memset(buckets, 0, sizeof(compiler_var_t *) * COMPILER_VAR_TABLE_INIT_SIZE);
 
-/*
- * _instr_delete -- delete an instruction
- */
-static void
-_instr_delete(compiler_instr_t *instr)
-{
-    free(instr);
-}
-
-/*
- * _var_table_init -- initialize a variable table
- */
-static compiler_var_table_t *
-_var_table_initialize(compiler_var_table_t *t)
-{
     if ( t == NULL ) {
         t = malloc(sizeof(compiler_var_table_t));
         if ( t == NULL ) {
+            free(buckets);
             return NULL;
         }
         t->_allocated = 1;
@@ -131,6 +117,11 @@ _var_table_initialize(compiler_var_table_t *t)
         t->_allocated = 0;
     }
     t->top = NULL;
+    t->dead = NULL;
+    t->depth = 0;
+    t->n = 0;
+    t->size = COMPILER_VAR_TABLE_INIT_SIZE;
+    t->buckets = buckets;
 
     return t;
 }
@@ -141,31 +132,97 @@ _var_table_initialize(compiler_var_table_t *t)
 static void
 _var_table_release(compiler_var_table_t *t)
 {
+    compiler_var_t *var;
+    compiler_var_t *next;
+
+    /* Release all the variables including those in the closed scopes */
+    var = t->top;
+    while ( var != NULL ) {
+        next = var->next;
+        free(var);
+        var = next;
+    }
+    var = t->dead;
+    while ( var != NULL ) {
+        next = var->next;
+        free(var);
+        var = next;
+    }
+    free(t->buckets);
+
     if ( t->_allocated ) {
         free(t);
     }
 }
 
 /*
- * _symbol_add -- add a symbol
+ * _var_hash -- compute the bucket index of an (interned) identifier
+ */
+static __inline__ size_t
+_var_hash(compiler_var_table_t *t, const char *id)
+{
+    return intern_hash(id) & (t->size - 1);
+}
+
+/*
+ * _var_table_resize -- double the number of buckets of a variable table
  */
 static int
-_symbol_add(compiler_t *c, compiler_symbol_t *s)
+_var_table_resize(compiler_var_table_t *t)
 {
+    compiler_var_t **buckets;
+    compiler_var_t **obuckets;
+    compiler_var_t *var;
+    compiler_var_t *rev;
+    compiler_var_t *next;
+    size_t osize;
     size_t i;
-    size_t n;
-    compiler_symbol_t **symbols;
+    size_t idx;
 
-    i = c->symbols.n;
-    n = i + 1;
-    symbols = realloc(c->symbols.symbols, sizeof(compiler_symbol_t *) * n);
-    if ( symbols == NULL ) {
+    buckets = malloc(sizeof(compiler_var_t *) * t->size * 2);
+    if ( buckets == NULL ) {
         return -1;
     }
-    symbols[i] = s;
+    memset(buckets, 0, sizeof(compiler_var_t *) * t->size * 2);
+    obuckets = t->buckets;
+    osize = t->size;
+    t->buckets = buckets;
+    t->size = osize * 2;
+
+    for ( i = 0; i < osize; i++ ) {
+        /* Reverse the chain to re-insert from the outermost scope so that the
+           innermost declaration stays at the head of the new chain */
+        rev = NULL;
+        var = obuckets[i];
+        while ( var != NULL ) {
+            next = var->bnext;
+            var->bnext = rev;
+            rev = var;
+            var = next;
+        }
+        var = rev;
+        while ( var != NULL ) {
+            next = var->bnext;
+            idx = _var_hash(t, var->id);
+            var->bnext = buckets[idx];
+            buckets[idx] = var;
+            var = next;
+        }
+    }
+    free(obuckets);
+
+    return 0;
+}
 
-    c->symbols.symbols = symbols;
-    c->symbols.n = n;
+/*
+ * _symbol_add -- add a symbol
+ */
+static int
+_symbol_add(compiler_t *c, compiler_symbol_t *s)
+{
+    if ( symbol_table_add(&c->symbols, s) < 0 ) {
+        return -1;
+    }
 
     return 0;
 }
@@ -190,14 +247,19 @@ _env_new(compiler_t *c)
         return NULL;
     }
 
+    env->code = malloc(sizeof(compiler_code_t));
+    if ( env->code == NULL ) {
+        _var_table_release(env->vars);
+        free(env);
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    env->code->func = NULL;
+    env->code->block = -1;
+
     env->prev = NULL;
     env->retval = NULL;
 
-    env->code.head = NULL;
-    env->code.tail = NULL;
-
-    env->opt.max_reg_id = -1;
-
     return env;
 }
 
@@ -207,8 +269,65 @@ _env_new(compiler_t *c)
 static void
 _env_delete(compiler_env_t *env)
 {
-    /* Delete the variables */
-    _var_table_release(env->vars);
+    /* Delete the variables and the code; they are owned by the outermost
+       scope */
+    if ( env->prev == NULL ) {
+        _var_table_release(env->vars);
+        free(env->code);
+    }
+    free(env);
+}
+
+/*
+ * _env_push -- open a new scope nested in the specified environment
+ */
+static compiler_env_t *
+_env_push(compiler_t *c, compiler_env_t *env)
+{
+    compiler_env_t *nenv;
+
+    nenv = malloc(sizeof(compiler_env_t));
+    if ( nenv == NULL ) {
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+
+    /* Share the variable table and the code with the enclosing scopes */
+    nenv->vars = env->vars;
+    nenv->vars->depth++;
+    nenv->code = env->code;
+
+    nenv->prev = env;
+    nenv->retval = NULL;
+
+    return nenv;
+}
+
+/*
+ * _env_pop -- close the scope opened by _env_push()
+ */
+static void
+_env_pop(compiler_env_t *env)
+{
+    compiler_var_table_t *t;
+    compiler_var_t *var;
+    size_t idx;
+
+    /* Unlink the variables declared in this scope.  They are always at the
+       heads of the buckets because inner declarations are inserted later. */
+    t = env->vars;
+    while ( t->top != NULL && t->top->depth == t->depth ) {
+        var = t->top;
+        idx = _var_hash(t, var->id);
+        t->buckets[idx] = var->bnext;
+        t->top = var->next;
+        t->n--;
+        /* Values may still refer to the variable; keep it until release */
+        var->next = t->dead;
+        t->dead = var;
+    }
+    t->depth--;
+
     free(env);
 }
 
@@ -256,22 +375,29 @@ _type2reg(compiler_t *c, type_t *type)
     rtype = IR_REG_UNDEF;
     switch ( type->type ) {
     case TYPE_PRIMITIVE_I8:
-    case TYPE_PRIMITIVE_U8:
         rtype = IR_REG_I8;
         break;
+    case TYPE_PRIMITIVE_U8:
+        rtype = IR_REG_U8;
+        break;
     case TYPE_PRIMITIVE_I16:
-    case TYPE_PRIMITIVE_U16:
         rtype = IR_REG_I16;
         break;
+    case TYPE_PRIMITIVE_U16:
+        rtype = IR_REG_U16;
+        break;
     case TYPE_PRIMITIVE_I32:
-    case TYPE_PRIMITIVE_U32:
         rtype = IR_REG_I32;
         break;
-
+    case TYPE_PRIMITIVE_U32:
+        rtype = IR_REG_U32;
+        break;
     case TYPE_PRIMITIVE_I64:
-    case TYPE_PRIMITIVE_U64:
         rtype = IR_REG_I64;
         break;
+    case TYPE_PRIMITIVE_U64:
+        rtype = IR_REG_U64;
+        break;
     case TYPE_PRIMITIVE_FP32:
         rtype = IR_REG_FP32;
         break;
@@ -311,16 +437,19 @@ _var_new(compiler_t *c, const char *id, type_t *type)
     /* Resolve the register type from the specified type */
     rtype = _type2reg(c, type);
     if ( rtype == IR_REG_UNDEF ) {
+        free(var);
         return NULL;
     }
-    var->irreg.type = rtype;
-    var->irreg.assigned = 1;
-    var->irreg.id = strdup(id);
+    var->id = id;
+    var->reg = -1;
+    var->regtype = rtype;
 
     var->type = type;
     var->arg = 0;
     var->ret = 0;
+    var->depth = 0;
     var->next = NULL;
+    var->bnext = NULL;
 
     return var;
 }
@@ -331,49 +460,69 @@ _var_new(compiler_t *c, const char *id, type_t *type)
 static void
 _var_delete(compiler_var_t *var)
 {
-    free(var->irreg.id);
     free(var);
 }
 
 /*
- * _var_add -- add a variable to the stack
+ * _var_add -- add a variable to the current scope
  */
 static int
 _var_add(compiler_env_t *env, compiler_var_t *var)
 {
+    compiler_var_table_t *t;
     compiler_var_t *v;
+    size_t idx;
 
-    /* Duplicate check */
-    v = env->vars->top;
+    t = env->vars;
+
+    /* Duplicate check; the first entry found in the bucket is the innermost
+       declaration (identifiers are interned) */
+    idx = _var_hash(t, var->id);
+    v = t->buckets[idx];
     while ( v != NULL ) {
-        /* Duplication check */
-        if ( strcmp(var->irreg.id, v->irreg.id) == 0 ) {
-            return -1;
+        if ( var->id == v->id ) {
+            if ( v->depth == t->depth ) {
+                /* Duplicate declaration in the same scope */
+                return -1;
+            }
+            /* Shadowing a variable in an enclosing scope */
+            break;
         }
-        v = v->next;
+        v = v->bnext;
+    }
+
+    /* Grow the table (keep the current size if it fails) */
+    if ( t->n >= t->size && _var_table_resize(t) == 0 ) {
+        idx = _var_hash(t, var->id);
     }
 
-    var->next = env->vars->top;
-    env->vars->top = var;
+    var->depth = t->depth;
+    var->bnext = t->buckets[idx];
+    t->buckets[idx] = var;
+    var->next = t->top;
+    t->top = var;
+    t->n++;
 
     return 0;
 }
 
 /*
- * _var_search -- search a variable from the stack
+ * _var_search -- search a variable from the current and enclosing scopes
  */
 static compiler_var_t *
 _var_search(compiler_env_t *env, const char *id)
 {
+    compiler_var_table_t *t;
     compiler_var_t *var;
 
-    var = env->vars->top;
+    t = env->vars;
+    var = t->buckets[_var_hash(t, id)];
     while ( var != NULL ) {
-        if ( strcmp(id, var->irreg.id) == 0 ) {
+        if ( id == var->id ) {
             /* Found a variable with the specified identifier */
             return var;
         }
-        var = var->next;
+        var = var->bnext;
     }
 
     /* Not found */
@@ -416,35 +565,24 @@ _val_new_nil(void)
 }
 
 /*
- * _val_new_reg -- allocate a new register value
+ * _val_new_reg -- allocate a new register value with a new virtual register
  */
 static compiler_val_t *
-_val_new_reg(compiler_env_t *env)
+_val_new_reg(compiler_env_t *env, ir_reg_type_t type)
 {
     compiler_val_t *val;
+    int reg;
 
-    val = _val_new();
-    if ( val == NULL ) {
+    reg = ir_func_reg_new(env->code->func, type, NULL);
+    if ( reg < 0 ) {
         return NULL;
     }
-    val->type = VAL_REG;
-
-    return val;
-}
-
-/*
- * _val_new_reg_set -- allocate a new register set value
- */
-static compiler_val_t *
-_val_new_reg_set(compiler_env_t *env)
-{
-    compiler_val_t *val;
-
     val = _val_new();
     if ( val == NULL ) {
         return NULL;
     }
-    val->type = VAL_REG_SET;
+    val->type = VAL_REG;
+    val->u.reg = reg;
 
     return val;
 }
@@ -485,39 +623,6 @@ _val_new_literal(literal_t *lit)
     return val;
 }
 
-/*
- * _val_new_cond -- allocate a new value condition set
- */
-static compiler_val_t *
-_val_new_cond(int n)
-{
-    compiler_val_t *val;
-    compiler_val_cond_t *cset;
-
-    cset = malloc(sizeof(compiler_val_cond_t));
-    if ( cset == NULL ) {
-        return NULL;
-    }
-    cset->n = n;
-    cset->vals = malloc(sizeof(compiler_val_t *) * n);
-    if ( cset->vals == NULL ) {
-        free(cset);
-        return NULL;
-    }
-    memset(cset->vals, 0, sizeof(compiler_val_t *) * n);
-
-    val = _val_new();
-    if ( val == NULL ) {
-        free(cset->vals);
-        free(cset);
-        return NULL;
-    }
-    val->type = VAL_COND;
-    val->u.conds = cset;
-
-    return val;
-}
-
 /*
  * _val_delete -- delete a value
  */
@@ -590,98 +695,187 @@ _val_list_delete(compiler_val_list_t *l)
 }
 
 /*
- * _append_instr
+ * _emit -- append an instruction to the current block
  */
 static int
-_append_instr(compiler_code_t *code, compiler_instr_t *instr)
+_emit(compiler_t *c, compiler_env_t *env, ir_instr_t *instr)
 {
-    if ( code->head == NULL ) {
-        code->head = instr;
-        code->tail = instr;
-    } else {
-        code->tail->next = instr;
-        code->tail = instr;
+    if ( ir_block_append(env->code->func, env->code->block, instr) < 0 ) {
+        c->err.code = COMPILER_NOMEM;
+        return -1;
     }
 
     return 0;
 }
 
 /*
- * _instr_mov -- allocate a new mov instruction
+ * _block_new -- allocate a new block in the current function
  */
-static compiler_instr_t *
-_instr_mov(operand_t *op0, operand_t *op1)
+static int
+_block_new(compiler_t *c, compiler_env_t *env)
 {
-    compiler_instr_t *instr;
+    int b;
 
-    instr = _instr_new();
-    if ( instr == NULL ) {
-        return NULL;
+    b = ir_func_block_new(env->code->func);
+    if ( b < 0 ) {
+        c->err.code = COMPILER_NOMEM;
+        return -1;
     }
-    instr->ir.opcode = IR_OPCODE_MOV;
-    memcpy(&instr->operands[0], op0, sizeof(operand_t));
-    memcpy(&instr->operands[1], op1, sizeof(operand_t));
 
-    return instr;
+    return b;
 }
 
 /*
- * _instr_alloca -- allocate a new alloca instruction
+ * _jmp -- terminate the current block with a jump
  */
-static ir_instr_t *
-_instr_alloca(ir_operand_t *op0)
+static int
+_jmp(compiler_t *c, compiler_env_t *env, int target)
 {
-    ir_instr_t *instr;
+    ir_instr_t instr;
+    ir_operand_t op;
 
-    instr = ir_instr_new();
-    if ( instr == NULL ) {
-        return NULL;
-    }
-    instr->opcode = IR_OPCODE_ALLOCA;
-    // instr->results[0];
-    // instr->operands[0];
+    ir_instr_init(&instr, IR_OPCODE_JMP, &op);
+    instr.noperands = 1;
+    ir_operand_block(&instr.operands[0], target);
 
-    return instr;
+    return _emit(c, env, &instr);
 }
 
 /*
- * _instr_add -- allocate a new add insruction
+ * _br -- terminate the current block with a conditional branch
  */
-static ir_instr_t *
-_instr_add(ir_operand_t *op0, ir_operand_t *op1)
+static int
+_br(compiler_t *c, compiler_env_t *env, ir_operand_t *cond, int bthen,
+    int belse)
 {
-    return NULL;
+    ir_instr_t instr;
+    ir_operand_t ops[3];
+
+    ir_instr_init(&instr, IR_OPCODE_BR, ops);
+    instr.noperands = 3;
+    memcpy(&instr.operands[0], cond, sizeof(ir_operand_t));
+    ir_operand_block(&instr.operands[1], bthen);
+    ir_operand_block(&instr.operands[2], belse);
+
+    return _emit(c, env, &instr);
 }
 
 /*
- * _instr_infix -- allocate a new infix instruction
+ * _parse_int -- parse the digits of an integer literal in the source text
  */
-static ir_instr_t *
-_instr_infix(ir_opcode_t opcode, ir_operand_t *op0, ir_operand_t *op1,
-             ir_result_t *result)
+static int
+_parse_int(slice_t n, int base, uint64_t *v)
 {
-    ir_instr_t *instr;
+    size_t i;
+    int d;
+
+    *v = 0;
+    for ( i = 0; i < n.len; i++ ) {
+        if ( n.s[i] >= '0' && n.s[i] <= '9' ) {
+            d = n.s[i] - '0';
+        } else if ( n.s[i] >= 'a' && n.s[i] <= 'f' ) {
+            d = n.s[i] - 'a' + 10;
+        } else if ( n.s[i] >= 'A' && n.s[i] <= 'F' ) {
+            d = n.s[i] - 'A' + 10;
+        } else {
+            return -1;
+        }
+        if ( d >= base ) {
+            return -1;
+        }
+        *v = *v * base + d;
+    }
 
-    /* Add an instruction */
-    instr = ir_instr_new();
-    if ( instr == NULL ) {
-        return NULL;
+    return 0;
+}
+
+/*
+ * _literal_operand -- convert a literal to an immediate operand in the
+ * canonical form of the register type that it is operated with (see ir.h)
+ */
+static int
+_literal_operand(compiler_t *c, literal_t *lit, ir_reg_type_t type,
+                 ir_operand_t *op)
+{
+    uint64_t v;
+    int ret;
+
+    switch ( lit->type ) {
+    case LIT_HEXINT:
+        ret = _parse_int(lit->u.n, 16, &v);
+        break;
+    case LIT_DECINT:
+        ret = _parse_int(lit->u.n, 10, &v);
+        break;
+    case LIT_OCTINT:
+        ret = _parse_int(lit->u.n, 8, &v);
+        break;
+    case LIT_BOOL:
+        v = lit->u.b == BOOL_TRUE ? 1 : 0;
+        ret = 0;
+        break;
+    case LIT_NIL:
+        v = 0;
+        ret = 0;
+        break;
+    default:
+        /* Floating-point numbers and strings are not supported yet */
+        c->err.code = COMPILER_UNSUPPORTED;
+        return -1;
+    }
+    if ( ret < 0 ) {
+        c->err.code = COMPILER_SYNTAX_ERROR;
+        return -1;
     }
-    instr->opcode = opcode;
-    //memcpy(&instr->operands[0], op0, sizeof(operand_t));
-    //memcpy(&instr->operands[1], op1, sizeof(operand_t));
-    //memcpy(&instr->operands[2], op2, sizeof(operand_t));
+    if ( type != IR_REG_UNDEF ) {
+        v = ir_reg_type_ext(type, v);
+    }
+    ir_operand_imm(op, IR_IMM_I64, v);
 
-    return instr;
+    return 0;
 }
 
 /*
- * _operand -- convert a variable to an operand
+ * _operand -- convert a value to an operand of the register type
  */
 static int
-_operand(compiler_t *c, compiler_env_t *env, ir_operand_t *operand)
+_operand(compiler_t *c, compiler_env_t *env, compiler_val_t *val,
+         ir_reg_type_t type, ir_operand_t *op)
 {
-    return -1;
+    switch ( val->type ) {
+    case VAL_VAR:
+        ir_operand_reg(op, val->u.var->reg);
+        return 0;
+    case VAL_REG:
+        ir_operand_reg(op, val->u.reg);
+        return 0;
+    case VAL_LITERAL:
+        return _literal_operand(c, val->u.lit, type, op);
+    default:
+        c->err.code = COMPILER_UNSUPPORTED;
+        return -1;
+    }
+}
+
+/*
+ * _val_regtype -- resolve the register type of a value
+ */
+static ir_reg_type_t
+_val_regtype(compiler_env_t *env, compiler_val_t *val)
+{
+    switch ( val->type ) {
+    case VAL_VAR:
+        return val->u.var->regtype;
+    case VAL_REG:
+        return env->code->func->reg.regs[val->u.reg].type;
+    case VAL_LITERAL:
+        if ( val->u.lit->type == LIT_BOOL ) {
+            return IR_REG_BOOL;
+        }
+        return IR_REG_UNDEF;
+    default:
+        return IR_REG_UNDEF;
+    }
 }
 
 /*
@@ -724,7 +918,7 @@ _literal(compiler_t *c, compiler_env_t *env, literal_t *lit)
  */
 static compiler_val_t *
 _decl(compiler_t *c, compiler_env_t *env, decl_t *decl, pos_t pos, int arg,
-      int retflag)
+      int retidx)
 {
     compiler_val_t *val;
     compiler_var_t *var;
@@ -738,11 +932,8 @@ _decl(compiler_t *c, compiler_env_t *env, decl_t *decl, pos_t pos, int arg,
         memcpy(&c->err.pos, &pos, sizeof(pos_t));
         return NULL;
     }
-    var->arg = arg;
-    var->ret = retflag;
-    if ( arg ) {
-        var->irreg.assigned = 1;
-    }
+    var->arg = arg >= 0;
+    var->ret = retidx >= 0;
 
     /* Add the variable to the table */
     ret = _var_add(env, var);
@@ -763,6 +954,19 @@ _decl(compiler_t *c, compiler_env_t *env, decl_t *decl, pos_t pos, int arg,
         return NULL;
     }
 
+    /* Allocate a virtual register for the variable */
+    var->reg = ir_func_reg_new(env->code->func, var->regtype, var->id);
+    if ( var->reg < 0 ) {
+        c->err.code = COMPILER_NOMEM;
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
+        return NULL;
+    }
+    env->code->func->reg.regs[var->reg].arg = arg;
+    env->code->func->reg.regs[var->reg].ret = retidx;
+    if ( arg >= 0 ) {
+        env->code->func->reg.regs[var->reg].assigned = 1;
+    }
+
     /* Allocate a new value */
     val = _val_new_var(env, var);
     if ( val == NULL ) {
@@ -782,13 +986,15 @@ _args(compiler_t *c, compiler_env_t *env, arg_list_t *args, int retvals)
 {
     arg_t *a;
     compiler_val_t *val;
+    int i;
 
+    i = 0;
     a = args->head;
     while ( a != NULL ) {
         if ( retvals ) {
-            val = _decl(c, env, a->decl, a->pos, 0, 1);
+            val = _decl(c, env, a->decl, a->pos, -1, i);
         } else {
-            val = _decl(c, env, a->decl, a->pos, 1, 0);
+            val = _decl(c, env, a->decl, a->pos, i, -1);
         }
         if ( val == NULL ) {
             return -1;
@@ -796,6 +1002,7 @@ _args(compiler_t *c, compiler_env_t *env, arg_list_t *args, int retvals)
         /* Release the unused value */
         _val_delete(val);
         a = a->next;
+        i++;
     }
 
     return 0;
@@ -809,10 +1016,8 @@ _assign(compiler_t *c, compiler_env_t *env, op_t *op, pos_t pos)
 {
     compiler_val_t *v0;
     compiler_val_t *v1;
-    operand_t op0;
-    operand_t op1;
-    compiler_instr_t *instr;
-    int ret;
+    ir_instr_t instr;
+    ir_operand_t src;
 
     /* Syntax check */
     if ( op->fix != FIX_INFIX ) {
@@ -824,7 +1029,14 @@ _assign(compiler_t *c, compiler_env_t *env, op_t *op, pos_t pos)
 
     /* Evaluate the expressions */
     v0 = _expr(c, env, op->e0);
+    if ( v0 == NULL ) {
+        return NULL;
+    }
     v1 = _expr(c, env, op->e1);
+    if ( v1 == NULL ) {
+        _val_delete(v0);
+        return NULL;
+    }
     if ( v0->type != VAL_VAR ) {
         /* Syntax error */
         _val_delete(v0);
@@ -835,19 +1047,19 @@ _assign(compiler_t *c, compiler_env_t *env, op_t *op, pos_t pos)
     }
 
     /* Assign */
-    op0.type = OPERAND_VAL;
-    op0.u.val = v1;
-    op1.type = OPERAND_VAL;
-    op1.u.val = v0;
-    instr = _instr_mov(&op0, &op1);
-    if ( instr == NULL ) {
+    ir_instr_init(&instr, IR_OPCODE_MOV, &src);
+    instr.result.n = 1;
+    instr.result.reg[0] = v0->u.var->reg;
+    instr.noperands = 1;
+    if ( _operand(c, env, v1, v0->u.var->regtype, &instr.operands[0]) < 0 ) {
         _val_delete(v0);
         _val_delete(v1);
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
         return NULL;
     }
-    ret = _append_instr(&env->code, instr);
-    if ( ret < 0 ) {
-        /* FIXME: delete the instruction */
+    _val_delete(v1);
+    if ( _emit(c, env, &instr) < 0 ) {
+        _val_delete(v0);
         return NULL;
     }
 
@@ -864,11 +1076,10 @@ _op_infix(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
     compiler_val_t *vr;
     compiler_val_t *v0;
     compiler_val_t *v1;
-    ir_instr_t *instr;
-    operand_t op0;
-    operand_t op1;
-    operand_t op2;
-    int ret;
+    ir_reg_type_t otype;
+    ir_reg_type_t type;
+    ir_instr_t instr;
+    ir_operand_t ops[2];
 
     if ( op->fix != FIX_INFIX ) {
         return NULL;
@@ -876,40 +1087,64 @@ _op_infix(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
 
     /* Evaluate the expressions */
     v0 = _expr(c, env, op->e0);
+    if ( v0 == NULL ) {
+        return NULL;
+    }
     v1 = _expr(c, env, op->e1);
-
-    /* Allocate a new value */
-    vr = _val_new_reg(env);
-    if ( vr == NULL ) {
+    if ( v1 == NULL ) {
         _val_delete(v0);
-        _val_delete(v1);
         return NULL;
     }
-    /* FIXME: val to reg */
-
-    /* Prepare operands */
-    op0.type = OPERAND_VAL;
-    op0.u.val = v0;
-    op1.type = OPERAND_VAL;
-    op1.u.val = v1;
-    op2.type = OPERAND_VAL;
-    op2.u.val = vr;
 
-    ir_operand_t irop0;
-    ir_operand_t irop1;
-    ir_result_t res;
+    /* Resolve the type of the operands, and the type of the result */
+    otype = _val_regtype(env, v0);
+    if ( otype == IR_REG_UNDEF ) {
+        otype = _val_regtype(env, v1);
+    }
+    if ( otype == IR_REG_UNDEF ) {
+        /* Both are literals */
+        otype = IR_REG_I64;
+    }
+    switch ( opcode ) {
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        type = IR_REG_BOOL;
+        break;
+    default:
+        type = otype;
+    }
 
-    /* Add an instruction */
-    instr = _instr_infix(opcode, &irop0, &irop1, &res);
-    if ( instr == NULL ) {
+    /* Prepare operands */
+    ir_instr_init(&instr, opcode, ops);
+    instr.noperands = 2;
+    if ( _operand(c, env, v0, otype, &instr.operands[0]) < 0
+         || _operand(c, env, v1, otype, &instr.operands[1]) < 0 ) {
         _val_delete(v0);
         _val_delete(v1);
-        _val_delete(vr);
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
         return NULL;
     }
-    ret = _append_instr(&env->code, instr);
-    if ( ret < 0 ) {
-        /* FIXME: delete the instruction */
+    _val_delete(v0);
+    _val_delete(v1);
+
+    /* Allocate a new value */
+    vr = _val_new_reg(env, type);
+    if ( vr == NULL ) {
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    instr.result.n = 1;
+    instr.result.reg[0] = vr->u.reg;
+
+    /* Add an instruction */
+    if ( _emit(c, env, &instr) < 0 ) {
+        _val_delete(vr);
         return NULL;
     }
 
@@ -925,8 +1160,10 @@ _op_prefix(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
 {
     compiler_val_t *vr;
     compiler_val_t *v;
-    compiler_instr_t *instr;
-    int ret;
+    ir_reg_type_t otype;
+    ir_reg_type_t type;
+    ir_instr_t instr;
+    ir_operand_t src;
 
     if ( op->fix != FIX_PREFIX ) {
         return NULL;
@@ -934,152 +1171,115 @@ _op_prefix(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
 
     /* Evaluate the expressions */
     v = _expr(c, env, op->e0);
+    if ( v == NULL ) {
+        return NULL;
+    }
+    otype = _val_regtype(env, v);
+    if ( otype == IR_REG_UNDEF ) {
+        otype = IR_REG_I64;
+    }
+    type = opcode == IR_OPCODE_NOT ? IR_REG_BOOL : otype;
+
+    ir_instr_init(&instr, opcode, &src);
+    instr.noperands = 1;
+    if ( _operand(c, env, v, otype, &instr.operands[0]) < 0 ) {
+        _val_delete(v);
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
+        return NULL;
+    }
+    _val_delete(v);
 
     /* Allocate a new value */
-    vr = _val_new_reg(env);
+    vr = _val_new_reg(env, type);
     if ( vr == NULL ) {
-        _val_delete(v);
+        c->err.code = COMPILER_NOMEM;
         return NULL;
     }
-    /* FIXME: val to reg */
+    instr.result.n = 1;
+    instr.result.reg[0] = vr->u.reg;
 
     /* Add an instruction */
-    instr = _instr_new();
-    if ( instr == NULL ) {
-        _val_delete(v);
+    if ( _emit(c, env, &instr) < 0 ) {
         _val_delete(vr);
         return NULL;
     }
-    instr->ir.opcode = opcode;
-    instr->operands[0].type = OPERAND_VAL;
-    instr->operands[0].u.val = v;
-    instr->operands[1].type = OPERAND_VAL;
-    instr->operands[1].u.val = vr;
-    ret = _append_instr(&env->code, instr);
-    if ( ret < 0 ) {
-        /* FIXME: delete the instruction */
-        return NULL;
-    }
 
     return vr;
 }
 
 /*
- * _divmod -- paser a divide/modulo operation
+ * _incdec -- parse an increment/decrement instruction
  */
 static compiler_val_t *
-_divmod(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
+_incdec(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
         pos_t pos)
 {
+    ir_instr_t instr;
+    ir_operand_t src;
+    compiler_val_t *val;
     compiler_val_t *vr;
-    compiler_val_t *v0;
-    compiler_val_t *v1;
-    ir_instr_t *instr;
-    int ret;
-
-    if ( op->fix != FIX_INFIX ) {
-        return NULL;
-    }
-
-    /* Evaluate the expressions */
-    v0 = _expr(c, env, op->e0);
-    v1 = _expr(c, env, op->e1);
-
-    /* Allocate a new value */
-    vr = _val_new_reg_set(env);
-    if ( vr == NULL ) {
-        _val_delete(v0);
-        _val_delete(v1);
-        return NULL;
-    }
-    /* FIXME: val to reg */
 
-    instr = ir_instr_new();
-    if ( instr == NULL ) {
-        _val_delete(v0);
-        _val_delete(v1);
-        _val_delete(vr);
+    val = _expr(c, env, op->e0);
+    if ( val == NULL ) {
         return NULL;
     }
-    instr->opcode = opcode;
-    instr->operands[0].type = OPERAND_TYPE_REG;
-    //instr->operands[0].u.val = v0;
-    //instr->operands[1].type = OPERAND_VAL;
-    //instr->operands[1].u.val = v1;
-    //instr->operands[2].type = OPERAND_VAL;
-    //instr->operands[2].u.val = vr;
-    //ret = _append_instr(&env->code, instr);
-    //if ( ret < 0 ) {
-    //    /* FIXME: delete the instruction */
-    //    return NULL;
-    //}
-
-    return vr;
-}
-
-/*
- * _incdec -- parse an increment/decrement instruction
- */
-static compiler_val_t *
-_incdec(compiler_t *c, compiler_env_t *env, op_t *op, ir_opcode_t opcode,
-        pos_t pos)
-{
-    compiler_instr_t *instr;
-    compiler_val_t *val;
-    compiler_val_t *vr;
-    operand_t op0;
-    operand_t op1;
-    int ret;
-
-    val = _expr(c, env, op->e0);
     if ( VAL_VAR != val->type ) {
         /* Only variable is allowed for this operation. */
+        _val_delete(val);
+        c->err.code = COMPILER_SYNTAX_ERROR;
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
         return NULL;
     }
 
+    vr = NULL;
     if ( FIX_SUFFIX == op->fix ) {
         /* Suffix: return the original value, then apply the operation to the
            variable */
-        vr = _val_new_reg(env);
+        vr = _val_new_reg(env, val->u.var->regtype);
         if ( vr == NULL ) {
+            _val_delete(val);
+            c->err.code = COMPILER_NOMEM;
             return NULL;
         }
 
         /* Copy the value to a register */
-        op0.type = OPERAND_VAL;
-        op0.u.val = val;
-        op1.type = OPERAND_VAL;
-        op1.u.val = vr;
-        instr = _instr_mov(&op0, &op1);
-        if ( instr == NULL  ) {
+        ir_instr_init(&instr, IR_OPCODE_MOV, &src);
+        instr.result.n = 1;
+        instr.result.reg[0] = vr->u.reg;
+        instr.noperands = 1;
+        ir_operand_reg(&instr.operands[0], val->u.var->reg);
+        if ( _emit(c, env, &instr) < 0 ) {
             _val_delete(val);
             _val_delete(vr);
             return NULL;
         }
-        ret = _append_instr(&env->code, instr);
-        if ( ret < 0 ) {
-            return NULL;
-        }
     } else if ( FIX_PREFIX == op->fix ) {
         /* Prefix: apply the operation to the variable, then return the value */
     } else {
         /* Other than above, then raise an error */
+        _val_delete(val);
+        c->err.code = COMPILER_SYNTAX_ERROR;
+        memcpy(&c->err.pos, &pos, sizeof(pos_t));
         return NULL;
     }
 
     /* Add the inc/dec instruction */
-    instr = _instr_new();
-    if ( instr == NULL ) {
-        /* FIXME: delete the values */
+    ir_instr_init(&instr, opcode, &src);
+    instr.result.n = 1;
+    instr.result.reg[0] = val->u.var->reg;
+    instr.noperands = 1;
+    ir_operand_reg(&instr.operands[0], val->u.var->reg);
+    if ( _emit(c, env, &instr) < 0 ) {
+        _val_delete(val);
+        if ( vr != NULL ) {
+            _val_delete(vr);
+        }
         return NULL;
     }
-    instr->ir.opcode = opcode;
-    instr->operands[0].type = OPERAND_VAL;
-    instr->operands[0].u.val = val;
-    ret = _append_instr(&env->code, instr);
-    if ( ret < 0 ) {
-        /* FIXME: delete the instruction */
-        return NULL;
+
+    if ( vr != NULL ) {
+        _val_delete(val);
+        return vr;
     }
 
     return val;
@@ -1108,10 +1308,10 @@ _op(compiler_t *c, compiler_env_t *env, op_t *op, pos_t pos)
         val = _op_infix(c, env, op, IR_OPCODE_MUL, pos);
         break;
     case OP_DIV:
-        val = _divmod(c, env, op, IR_OPCODE_DIV, pos);
+        val = _op_infix(c, env, op, IR_OPCODE_DIV, pos);
         break;
     case OP_MOD:
-        val = _divmod(c, env, op, IR_OPCODE_MOD, pos);
+        val = _op_infix(c, env, op, IR_OPCODE_MOD, pos);
         break;
     case OP_NOT:
         val = _op_prefix(c, env, op, IR_OPCODE_NOT, pos);
@@ -1170,53 +1370,221 @@ _op(compiler_t *c, compiler_env_t *env, op_t *op, pos_t pos)
 }
 
 /*
- * _switch -- parse a switch expression
+ * _merge -- move the value of a branch to the register holding the value of
+ * the conditional expression; the expression has no value if any branch has
+ * no value
+ */
+static int
+_merge(compiler_t *c, compiler_env_t *env, compiler_val_t *val,
+       compiler_val_t **rv)
+{
+    ir_instr_t instr;
+    ir_operand_t src;
+    ir_reg_type_t type;
+
+    if ( *rv != NULL && (*rv)->type == VAL_NIL ) {
+        return 0;
+    }
+    if ( val->type != VAL_VAR && val->type != VAL_REG
+         && val->type != VAL_LITERAL ) {
+        if ( *rv == NULL ) {
+            *rv = _val_new_nil();
+            if ( *rv == NULL ) {
+                c->err.code = COMPILER_NOMEM;
+                return -1;
+            }
+        } else {
+            (*rv)->type = VAL_NIL;
+        }
+        return 0;
+    }
+
+    if ( *rv == NULL ) {
+        type = _val_regtype(env, val);
+        if ( type == IR_REG_UNDEF ) {
+            type = IR_REG_I64;
+        }
+        *rv = _val_new_reg(env, type);
+        if ( *rv == NULL ) {
+            c->err.code = COMPILER_NOMEM;
+            return -1;
+        }
+    }
+
+    ir_instr_init(&instr, IR_OPCODE_MOV, &src);
+    instr.result.n = 1;
+    instr.result.reg[0] = (*rv)->u.reg;
+    instr.noperands = 1;
+    type = env->code->func->reg.regs[(*rv)->u.reg].type;
+    if ( _operand(c, env, val, type, &instr.operands[0]) < 0 ) {
+        return -1;
+    }
+
+    return _emit(c, env, &instr);
+}
+
+/*
+ * _branch -- parse the code block of a branch in its own scope, and jump to
+ * the join block
+ */
+static int
+_branch(compiler_t *c, compiler_env_t *env, inner_block_t *block,
+        compiler_val_t **rv, int join)
+{
+    compiler_env_t *nenv;
+    compiler_val_t *val;
+    int ret;
+
+    nenv = _env_push(c, env);
+    if ( nenv == NULL ) {
+        return -1;
+    }
+    val = _inner_block(c, nenv, block);
+    if ( val == NULL ) {
+        _env_pop(nenv);
+        return -1;
+    }
+    ret = _merge(c, nenv, val, rv);
+    _val_delete(val);
+    _env_pop(nenv);
+    if ( ret < 0 ) {
+        return -1;
+    }
+
+    return _jmp(c, env, join);
+}
+
+/*
+ * _switch -- parse a switch expression; the cases are tested in order
  */
 static compiler_val_t *
 _switch(compiler_t *c, compiler_env_t *env, switch_t *sw)
 {
     compiler_val_t *cond;
     compiler_val_t *rv;
-    compiler_env_t *nenv;
     switch_case_t *cs;
-    literal_set_t *lset;
-    ssize_t n;
+    switch_case_t *dflt;
+    literal_t *lit;
+    ir_reg_type_t type;
+    ir_instr_t instr;
+    ir_operand_t ops[2];
+    ir_operand_t op;
+    int bjoin;
+    int bbody;
+    int bnext;
+    int reg;
 
-    /* Create a new environemt */
-    nenv = _env_new(c);
-    if ( nenv == NULL ) {
+    /* Parse the condition */
+    cond = _expr(c, env, sw->cond);
+    if ( cond == NULL ) {
         return NULL;
     }
-    nenv->prev = env;
+    type = _val_regtype(env, cond);
+    if ( type == IR_REG_UNDEF ) {
+        type = IR_REG_I64;
+    }
+    if ( _operand(c, env, cond, type, &op) < 0 ) {
+        _val_delete(cond);
+        return NULL;
+    }
+    _val_delete(cond);
 
-    /* Parse the condition */
-    cond = _expr(c, env, sw->cond);
+    bjoin = _block_new(c, env);
+    if ( bjoin < 0 ) {
+        return NULL;
+    }
 
-    /* Count the number of cases */
-    n = 0;
+    rv = NULL;
+    dflt = NULL;
     cs = sw->block->head;
     while ( cs != NULL ) {
-        n++;
+        if ( cs->lset == NULL ) {
+            /* Default */
+            if ( dflt != NULL ) {
+                c->err.code = COMPILER_SYNTAX_ERROR;
+                goto error;
+            }
+            dflt = cs;
+            cs = cs->next;
+            continue;
+        }
+
+        /* Test the literals of the case */
+        bbody = _block_new(c, env);
+        if ( bbody < 0 ) {
+            goto error;
+        }
+        lit = cs->lset->head;
+        while ( lit != NULL ) {
+            reg = ir_func_reg_new(env->code->func, IR_REG_BOOL, NULL);
+            if ( reg < 0 ) {
+                c->err.code = COMPILER_NOMEM;
+                goto error;
+            }
+            ir_instr_init(&instr, IR_OPCODE_CMP_EQ, ops);
+            instr.result.n = 1;
+            instr.result.reg[0] = reg;
+            instr.noperands = 2;
+            memcpy(&instr.operands[0], &op, sizeof(ir_operand_t));
+            if ( _literal_operand(c, lit, type, &instr.operands[1]) < 0 ) {
+                goto error;
+            }
+            if ( _emit(c, env, &instr) < 0 ) {
+                goto error;
+            }
+            bnext = _block_new(c, env);
+            if ( bnext < 0 ) {
+                goto error;
+            }
+            ir_operand_reg(&instr.operands[0], reg);
+            if ( _br(c, env, &instr.operands[0], bbody, bnext) < 0 ) {
+                goto error;
+            }
+            env->code->block = bnext;
+            lit = lit->next;
+        }
+
+        /* Parse the code block of the case */
+        bnext = env->code->block;
+        env->code->block = bbody;
+        if ( _branch(c, env, cs->block, &rv, bjoin) < 0 ) {
+            goto error;
+        }
+        env->code->block = bnext;
+
         cs = cs->next;
     }
 
-    /* Initialize the return value with a n-conditional-value set value */
-    rv = _val_new_cond(n);
-    if ( rv == NULL ) {
-        return NULL;
+    /* No case matched */
+    if ( dflt != NULL ) {
+        if ( _branch(c, env, dflt->block, &rv, bjoin) < 0 ) {
+            goto error;
+        }
+    } else {
+        if ( _jmp(c, env, bjoin) < 0 ) {
+            goto error;
+        }
+        if ( rv != NULL ) {
+            rv->type = VAL_NIL;
+        }
     }
+    env->code->block = bjoin;
 
-    /* Parse the code block */
-    n = 0;
-    cs = sw->block->head;
-    while ( cs != NULL ) {
-        lset = cs->lset;
-        rv->u.conds->vals[n] = _inner_block(c, nenv, cs->block);
-        n++;
-        cs = cs->next;
+    if ( rv == NULL ) {
+        rv = _val_new_nil();
+        if ( rv == NULL ) {
+            c->err.code = COMPILER_NOMEM;
+            return NULL;
+        }
     }
 
     return rv;
+
+error:
+    if ( rv != NULL ) {
+        _val_delete(rv);
+    }
+    return NULL;
 }
 
 /*
@@ -1227,29 +1595,66 @@ _if(compiler_t *c, compiler_env_t *env, if_t *ife)
 {
     compiler_val_t *cond;
     compiler_val_t *rv;
-    compiler_env_t *nenv;
-
-    /* Create a new environment */
-    nenv = _env_new(c);
-    if ( nenv == NULL ) {
-        return NULL;
-    }
-    nenv->prev = env;
+    ir_operand_t op;
+    int bthen;
+    int belse;
+    int bjoin;
 
     /* Parse the condition */
     cond = _expr(c, env, ife->cond);
+    if ( cond == NULL ) {
+        return NULL;
+    }
+    if ( _operand(c, env, cond, IR_REG_BOOL, &op) < 0 ) {
+        _val_delete(cond);
+        return NULL;
+    }
+    _val_delete(cond);
 
-    /* Initialize the return value with a two-conditional-value set value */
-    rv = _val_new_cond(2);
-    if ( rv == NULL ) {
+    /* Blocks */
+    bthen = _block_new(c, env);
+    if ( bthen < 0 ) {
+        return NULL;
+    }
+    belse = -1;
+    if ( ife->belse != NULL ) {
+        belse = _block_new(c, env);
+        if ( belse < 0 ) {
+            return NULL;
+        }
+    }
+    bjoin = _block_new(c, env);
+    if ( bjoin < 0 ) {
+        return NULL;
+    }
+    if ( _br(c, env, &op, bthen, belse >= 0 ? belse : bjoin) < 0 ) {
         return NULL;
     }
 
-    /* Parse the code block */
-    rv->u.conds->vals[0] = _inner_block(c, nenv, ife->bif);
-    rv->u.conds->vals[1] = _inner_block(c, nenv, ife->belse);
+    /* Parse the code blocks, each in its own scope */
+    rv = NULL;
+    env->code->block = bthen;
+    if ( _branch(c, env, ife->bif, &rv, bjoin) < 0 ) {
+        goto error;
+    }
+    if ( ife->belse != NULL ) {
+        env->code->block = belse;
+        if ( _branch(c, env, ife->belse, &rv, bjoin) < 0 ) {
+            goto error;
+        }
+    } else {
+        /* No value without the else block */
+        rv->type = VAL_NIL;
+    }
+    env->code->block = bjoin;
 
     return rv;
+
+error:
+    if ( rv != NULL ) {
+        _val_delete(rv);
+    }
+    return NULL;
 }
 
 /*
@@ -1262,15 +1667,16 @@ _call(compiler_t *c, compiler_env_t *env, call_t *call)
     compiler_env_t *nenv;
 
     /* Create a new environment */
-    nenv = _env_new(c);
+    nenv = _env_push(c, env);
     if ( nenv == NULL ) {
         return NULL;
     }
-    nenv->prev = env;
 
     /* Initialize the return value */
     rv = NULL;
 
+    _env_pop(nenv);
+
     return rv;
 }
 
@@ -1342,7 +1748,7 @@ _expr(compiler_t *c, compiler_env_t *env, expr_t *e)
         val = _id(c, env, e->u.id);
         break;
     case EXPR_DECL:
-        val = _decl(c, env, e->u.decl, e->pos, 0, 0);
+        val = _decl(c, env, e->u.decl, e->pos, -1, -1);
         break;
     case EXPR_LITERAL:
         val = _literal(c, env, e->u.lit);
@@ -1419,40 +1825,192 @@ _expr_list(compiler_t *c, compiler_env_t *env, expr_list_t *exprs)
 static compiler_val_t *
 _while(compiler_t *c, compiler_env_t *env, stmt_while_t *w)
 {
-    return NULL;
+    compiler_env_t *nenv;
+    compiler_val_t *cond;
+    compiler_val_t *val;
+    ir_operand_t op;
+    int bcond;
+    int bbody;
+    int bexit;
+
+    /* Blocks */
+    bcond = _block_new(c, env);
+    if ( bcond < 0 ) {
+        return NULL;
+    }
+    bbody = _block_new(c, env);
+    if ( bbody < 0 ) {
+        return NULL;
+    }
+    bexit = _block_new(c, env);
+    if ( bexit < 0 ) {
+        return NULL;
+    }
+    if ( _jmp(c, env, bcond) < 0 ) {
+        return NULL;
+    }
+
+    /* Parse the condition */
+    env->code->block = bcond;
+    cond = _expr(c, env, w->cond);
+    if ( cond == NULL ) {
+        return NULL;
+    }
+    if ( _operand(c, env, cond, IR_REG_BOOL, &op) < 0 ) {
+        _val_delete(cond);
+        return NULL;
+    }
+    _val_delete(cond);
+    if ( _br(c, env, &op, bbody, bexit) < 0 ) {
+        return NULL;
+    }
+
+    /* Parse the loop body in its own scope */
+    env->code->block = bbody;
+    nenv = _env_push(c, env);
+    if ( nenv == NULL ) {
+        return NULL;
+    }
+    val = _inner_block(c, nenv, w->block);
+    _env_pop(nenv);
+    if ( val == NULL ) {
+        return NULL;
+    }
+    _val_delete(val);
+    if ( _jmp(c, env, bcond) < 0 ) {
+        return NULL;
+    }
+    env->code->block = bexit;
+
+    val = _val_new_nil();
+    if ( val == NULL ) {
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+
+    return val;
 }
 
 /*
- * _return -- parse a return statement
+ * _ret -- emit a return or a yield instruction; the value of the expression
+ * is moved to the first return value, and the operands are the return values
  */
 static compiler_val_t *
-_return(compiler_t *c, compiler_env_t *env, expr_t *e)
+_ret(compiler_t *c, compiler_env_t *env, expr_t *e, ir_opcode_t opcode)
 {
-    compiler_instr_t *instr;
+    ir_func_t *f;
+    ir_instr_t instr;
+    ir_operand_t *ops;
+    ir_operand_t src;
     compiler_val_t *val;
+    ir_reg_type_t type;
+    size_t n;
+    size_t i;
 
+    f = env->code->func;
     if ( e == NULL ) {
         /* FIXME: Get the last statement value */
-        val = NULL;
+        val = _val_new_nil();
+        if ( val == NULL ) {
+            c->err.code = COMPILER_NOMEM;
+            return NULL;
+        }
     } else {
         val = _expr(c, env, e);
         if ( val == NULL ) {
             return NULL;
         }
+        /* Move the value to the first return value */
+        for ( i = 0; i < f->reg.n; i++ ) {
+            if ( f->reg.regs[i].ret == 0 ) {
+                break;
+            }
+        }
+        if ( i < f->reg.n ) {
+            ir_instr_init(&instr, IR_OPCODE_MOV, &src);
+            instr.result.n = 1;
+            instr.result.reg[0] = i;
+            instr.noperands = 1;
+            type = f->reg.regs[i].type;
+            if ( _operand(c, env, val, type, &instr.operands[0]) < 0
+                 || _emit(c, env, &instr) < 0 ) {
+                _val_delete(val);
+                return NULL;
+            }
+        }
+    }
+
+    /* The operands are the return values */
+    n = 0;
+    for ( i = 0; i < f->reg.n; i++ ) {
+        if ( f->reg.regs[i].ret >= 0 ) {
+            n++;
+        }
+    }
+    ops = malloc(sizeof(ir_operand_t) * (n > 0 ? n : 1));
+    if ( ops == NULL ) {
+        _val_delete(val);
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    ir_instr_init(&instr, opcode, ops);
+    for ( i = 0; i < f->reg.n; i++ ) {
+        if ( f->reg.regs[i].ret < 0 ) {
+            continue;
+        }
+        ir_operand_reg(&instr.operands[instr.noperands], i);
+        instr.noperands++;
+    }
+    if ( _emit(c, env, &instr) < 0 ) {
+        free(ops);
+        _val_delete(val);
+        return NULL;
     }
+    free(ops);
 
-    /* return instruction */
-    instr = _instr_new();
-    if ( instr == NULL ) {
+    return val;
+}
+
+/*
+ * _return -- parse a return statement
+ */
+static compiler_val_t *
+_return(compiler_t *c, compiler_env_t *env, expr_t *e)
+{
+    compiler_val_t *val;
+
+    val = _ret(c, env, e, IR_OPCODE_RET);
+    if ( val == NULL ) {
+        return NULL;
+    }
+
+    /* The code following the return statement is unreachable; put it in a
+       new block to keep the return instruction the terminator */
+    env->code->block = _block_new(c, env);
+    if ( env->code->block < 0 ) {
+        _val_delete(val);
         return NULL;
     }
-    instr->ir.opcode = IR_OPCODE_RET;
-    instr->operands[0].type = OPERAND_VAL;
-    instr->operands[0].u.val = val;
 
     return val;
 }
 
+/*
+ * _yield -- parse a yield statement; the coroutine returns the values to the
+ * caller, and resumes from the following code at the next call
+ */
+static compiler_val_t *
+_yield(compiler_t *c, compiler_env_t *env, expr_t *e)
+{
+    if ( env->code->func->type != IR_FUNC_COROUTINE ) {
+        /* Yield is allowed only in coroutines */
+        c->err.code = COMPILER_SYNTAX_ERROR;
+        return NULL;
+    }
+
+    return _ret(c, env, e, IR_OPCODE_YIELD);
+}
+
 /*
  * _stmt -- parse a statement
  */
@@ -1478,12 +2036,12 @@ _stmt(compiler_t *c, compiler_env_t *env, stmt_t *stmt)
         break;
     case STMT_BLOCK:
         /* Create a new environemt (scope) */
-        nenv = _env_new(c);
+        nenv = _env_push(c, env);
         if ( nenv == NULL ) {
             return NULL;
         }
-        nenv->prev = env;
         val = _inner_block(c, nenv, stmt->u.block);
+        _env_pop(nenv);
         if ( val == NULL ) {
             return NULL;
         }
@@ -1491,6 +2049,9 @@ _stmt(compiler_t *c, compiler_env_t *env, stmt_t *stmt)
     case STMT_RETURN:
         val = _return(c, env, stmt->u.expr);
         break;
+    case STMT_YIELD:
+        val = _yield(c, env, stmt->u.expr);
+        break;
     }
 
     return val;
@@ -1517,6 +2078,53 @@ _inner_block(compiler_t *c, compiler_env_t *env, inner_block_t *block)
     return rv;
 }
 
+/*
+ * _lower -- run the passes on the IR of a function; the function is converted
+ * to the SSA form, optimized, and back to the form with copies, and then the
+ * physical registers are allocated after the dead code is removed and the
+ * coroutine is lowered to a state machine
+ */
+static int
+_lower(compiler_t *c, ir_func_t *f)
+{
+    static const struct {
+        report_phase_t phase;
+        int (*pass)(ir_func_t *);
+    } passes[] = {
+        { REPORT_TO_SSA, ir_func_to_ssa },
+        { REPORT_SCCP, ir_func_sccp },
+        { REPORT_GVN, ir_func_gvn },
+        { REPORT_DIVMOD, ir_func_divmod },
+        { REPORT_FROM_SSA, ir_func_from_ssa },
+        { REPORT_DCE, ir_func_dce },
+        { REPORT_CORO, ir_func_coroutine },
+    };
+    report_span_t span;
+    size_t i;
+    int ret;
+
+    for ( i = 0; i < sizeof(passes) / sizeof(passes[0]); i++ ) {
+        report_begin(&span, passes[i].phase);
+        ret = passes[i].pass(f);
+        report_end(&span);
+        if ( ret < 0 ) {
+            c->err.code = COMPILER_NOMEM;
+            return -1;
+        }
+    }
+    if ( c->regset != NULL ) {
+        report_begin(&span, REPORT_REGALLOC);
+        ret = regalloc(f, c->regset);
+        report_end(&span);
+        if ( ret < 0 ) {
+            c->err.code = COMPILER_NOMEM;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 /*
  * _func -- parse a function definition
  */
@@ -1532,13 +2140,24 @@ _func(compiler_t *c, func_t *fn)
     /* Allocate a new function IR */
     irfunc = ir_func_new();
     if ( irfunc == NULL ) {
+        c->err.code = COMPILER_NOMEM;
         return NULL;
     }
+    irfunc->name = fn->id;
     irfunc->type = IR_FUNC_FUNC;
 
     /* Allocate a new environment */
     env = _env_new(c);
     if ( env == NULL ) {
+        ir_func_delete(irfunc);
+        return NULL;
+    }
+    env->code->func = irfunc;
+    env->code->block = ir_func_block_new(irfunc);
+    if ( env->code->block < 0 ) {
+        _env_delete(env);
+        ir_func_delete(irfunc);
+        c->err.code = COMPILER_NOMEM;
         return NULL;
     }
 
@@ -1546,11 +2165,13 @@ _func(compiler_t *c, func_t *fn)
     ret = _args(c, env, fn->args, 0);
     if ( ret < 0 ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
     ret = _args(c, env, fn->rets, 1);
     if ( ret < 0 ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
 
@@ -1558,6 +2179,26 @@ _func(compiler_t *c, func_t *fn)
     val = _inner_block(c, env, fn->block);
     if ( val == NULL ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
+        return NULL;
+    }
+
+    /* Terminate the function with a return instruction if missing */
+    ret = ir_block_last(irfunc, env->code->block);
+    if ( ret < 0 || irfunc->instr.instrs[ret].opcode != IR_OPCODE_RET ) {
+        val = _return(c, env, NULL);
+        if ( val == NULL ) {
+            _env_delete(env);
+            ir_func_delete(irfunc);
+            return NULL;
+        }
+        _val_delete(val);
+    }
+
+    /* Lower the IR of the function for the backend */
+    if ( _lower(c, irfunc) < 0 ) {
+        _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
 
@@ -1566,13 +2207,10 @@ _func(compiler_t *c, func_t *fn)
     if ( block == NULL ) {
         /* FIXME: free val */
         _env_delete(env);
+        ir_func_delete(irfunc);
         c->err.code = COMPILER_NOMEM;
         return NULL;
     }
-    irfunc->name = strdup(fn->id);
-    if ( irfunc->name == NULL ) {
-        return NULL;
-    }
     block->type = BLOCK_FUNC;
     block->env = env;
     block->next = NULL;
@@ -1588,21 +2226,55 @@ static compiler_block_t *
 _coroutine(compiler_t *c, coroutine_t *cr)
 {
     int ret;
+    int n;
     compiler_env_t *env;
     compiler_block_t *block;
     compiler_val_t *val;
+    compiler_error_t *err;
     ir_func_t *irfunc;
+    arg_t *a;
+
+    /* The return values are yielded in a packet of the runtime, which takes
+       at most COMPILER_MAX_PACKET values */
+    n = 0;
+    for ( a = cr->rets->head; a != NULL; a = a->next ) {
+        if ( ++n <= COMPILER_MAX_PACKET ) {
+            continue;
+        }
+        err = _error_new(COMPILER_TOO_MANY_VALUES, a->pos);
+        if ( err == NULL ) {
+            c->err_pool.err = COMPILER_NOMEM;
+            c->err_pool.pos = a->pos;
+        } else {
+            err->next = c->err_stack;
+            c->err_stack = err;
+        }
+        c->err.code = COMPILER_TOO_MANY_VALUES;
+        memcpy(&c->err.pos, &a->pos, sizeof(pos_t));
+        return NULL;
+    }
 
     /* Allocate a new function IR */
     irfunc = ir_func_new();
     if ( irfunc == NULL ) {
+        c->err.code = COMPILER_NOMEM;
         return NULL;
     }
+    irfunc->name = cr->id;
     irfunc->type = IR_FUNC_COROUTINE;
 
     /* Allocate a new environment */
     env = _env_new(c);
     if ( env == NULL ) {
+        ir_func_delete(irfunc);
+        return NULL;
+    }
+    env->code->func = irfunc;
+    env->code->block = ir_func_block_new(irfunc);
+    if ( env->code->block < 0 ) {
+        _env_delete(env);
+        ir_func_delete(irfunc);
+        c->err.code = COMPILER_NOMEM;
         return NULL;
     }
 
@@ -1610,11 +2282,13 @@ _coroutine(compiler_t *c, coroutine_t *cr)
     ret = _args(c, env, cr->args, 0);
     if ( ret < 0 ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
     ret = _args(c, env, cr->rets, 1);
     if ( ret < 0 ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
 
@@ -1622,6 +2296,26 @@ _coroutine(compiler_t *c, coroutine_t *cr)
     val = _inner_block(c, env, cr->block);
     if ( val == NULL ) {
         _env_delete(env);
+        ir_func_delete(irfunc);
+        return NULL;
+    }
+
+    /* Terminate the function with a return instruction if missing */
+    ret = ir_block_last(irfunc, env->code->block);
+    if ( ret < 0 || irfunc->instr.instrs[ret].opcode != IR_OPCODE_RET ) {
+        val = _return(c, env, NULL);
+        if ( val == NULL ) {
+            _env_delete(env);
+            ir_func_delete(irfunc);
+            return NULL;
+        }
+        _val_delete(val);
+    }
+
+    /* Lower the IR of the function for the backend */
+    if ( _lower(c, irfunc) < 0 ) {
+        _env_delete(env);
+        ir_func_delete(irfunc);
         return NULL;
     }
 
@@ -1630,13 +2324,10 @@ _coroutine(compiler_t *c, coroutine_t *cr)
     if ( block == NULL ) {
         /* FIXME: free val */
         _env_delete(env);
+        ir_func_delete(irfunc);
         c->err.code = COMPILER_NOMEM;
         return NULL;
     }
-    irfunc->name = strdup(cr->id);
-    if ( irfunc->name == NULL ) {
-        return NULL;
-    }
     block->type = BLOCK_COROUTINE;
     block->env = env;
     block->next = NULL;
@@ -1777,24 +2468,6 @@ _outer_block_entry(compiler_t *c, outer_block_entry_t *e)
     return block;
 }
 
-/*
- * _free_instrs -- release the instructions
- */
-static void
-_free_instrs(compiler_t *c, compiler_instr_t *instrs)
-{
-    compiler_instr_t *i;
-    compiler_instr_t *ni;
-
-    i = instrs;
-    while ( i != NULL ) {
-        ni = i->next;
-        /* Review: free values referred from this instruction */
-        free(i);
-        i = ni;
-    }
-}
-
 /*
  * _free_blocks -- release the blocks
  */
@@ -1804,6 +2477,10 @@ _free_blocks(compiler_t *c, compiler_block_t *b)
     compiler_env_t *env;
     compiler_env_t *penv;
 
+    if ( b == NULL ) {
+        return;
+    }
+
     switch ( b->type ) {
     case BLOCK_FUNC:
     case BLOCK_COROUTINE:
@@ -1815,12 +2492,249 @@ _free_blocks(compiler_t *c, compiler_block_t *b)
             env = penv;
         }
         b->env = NULL;
+        ir_func_delete(b->func);
+        b->func = NULL;
         break;
     }
     _free_blocks(c, b->next);
     free(b);
 }
 
+/*
+ * Task to compile a function or coroutine in a worker thread
+ */
+typedef struct {
+    /* Outer block entry to compile */
+    outer_block_entry_t *e;
+    /* Per-task compiler (error stack and symbols are not shared) */
+    compiler_t c;
+    /* Compiled block */
+    compiler_block_t *block;
+} compiler_task_t;
+
+/*
+ * Task queue shared by the worker threads
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    size_t next;
+    size_t n;
+    compiler_task_t *tasks;
+} compiler_task_queue_t;
+
+/*
+ * _worker -- compile the tasks in the queue until it becomes empty
+ */
+static void *
+_worker(void *arg)
+{
+    compiler_task_queue_t *q;
+    compiler_task_t *t;
+
+    q = arg;
+    for ( ;; ) {
+        /* Take the next task */
+        pthread_mutex_lock(&q->mutex);
+        if ( q->next >= q->n ) {
+            pthread_mutex_unlock(&q->mutex);
+            break;
+        }
+        t = &q->tasks[q->next];
+        q->next++;
+        pthread_mutex_unlock(&q->mutex);
+
+        t->block = _outer_block_entry(&t->c, t->e);
+    }
+
+    return NULL;
+}
+
+/*
+ * _merge_task -- merge the error stack and symbols of a task into the compiler
+ */
+static int
+_merge_task(compiler_t *c, compiler_task_t *t)
+{
+    compiler_error_t *err;
+    size_t i;
+    int ret;
+
+    /* Errors are pushed in the same order as the serial compilation */
+    if ( t->c.err_stack != NULL ) {
+        err = t->c.err_stack;
+        while ( err->next != NULL ) {
+            err = err->next;
+        }
+        err->next = c->err_stack;
+        c->err_stack = t->c.err_stack;
+        t->c.err_stack = NULL;
+    }
+    if ( t->c.err_pool.err != COMPILER_ERROR_UNKNOWN ) {
+        c->err_pool = t->c.err_pool;
+    }
+    if ( t->c.err.code != COMPILER_ERROR_UNKNOWN ) {
+        c->err = t->c.err;
+    }
+
+    /* Symbols */
+    ret = 0;
+    for ( i = 0; i < t->c.symbols.n; i++ ) {
+        if ( _symbol_add(c, symbol_table_get(&t->c.symbols, i)) < 0 ) {
+            ret = -1;
+        }
+    }
+    symbol_table_release(&t->c.symbols);
+
+    return ret;
+}
+
+/*
+ * _release_task -- release the results of a task that are not merged
+ */
+static void
+_release_task(compiler_t *c, compiler_task_t *t)
+{
+    compiler_error_t *err;
+
+    while ( t->c.err_stack != NULL ) {
+        err = t->c.err_stack;
+        t->c.err_stack = err->next;
+        free(err);
+    }
+    symbol_table_release(&t->c.symbols);
+    _free_blocks(c, t->block);
+    t->block = NULL;
+}
+
+/*
+ * _outer_block_parallel -- compile the functions and coroutines in an outer
+ * block with the worker threads
+ *
+ * Functions and coroutines are independent of each other, so each one is
+ * compiled with its own environment by a worker thread.  The other entries
+ * and the results of the workers are then processed in the source order, so
+ * the output is the same as the serial compilation.
+ */
+static compiler_block_t *
+_outer_block_parallel(compiler_t *c, outer_block_t *block)
+{
+    compiler_task_queue_t q;
+    compiler_task_t *t;
+    compiler_block_t *b;
+    compiler_block_t *tb;
+    compiler_block_t *pb;
+    outer_block_entry_t *e;
+    pthread_t *threads;
+    size_t i;
+    size_t j;
+    int nthreads;
+    int failed;
+
+    /* Count the functions and coroutines */
+    q.n = 0;
+    for ( e = block->head; e != NULL; e = e->next ) {
+        if ( e->type == OUTER_BLOCK_FUNC || e->type == OUTER_BLOCK_COROUTINE ) {
+            q.n++;
+        }
+    }
+    q.next = 0;
+    q.tasks = malloc(sizeof(compiler_task_t) * (q.n > 0 ? q.n : 1));
+    if ( q.tasks == NULL ) {
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    i = 0;
+    for ( e = block->head; e != NULL; e = e->next ) {
+        if ( e->type == OUTER_BLOCK_FUNC || e->type == OUTER_BLOCK_COROUTINE ) {
+            t = &q.tasks[i];
+            memset(&t->c, 0, sizeof(compiler_t));
+            t->c.err.code = COMPILER_ERROR_UNKNOWN;
+            t->c.err_pool.err = COMPILER_ERROR_UNKNOWN;
+            symbol_table_init(&t->c.symbols);
+            t->c.jobs = 1;
+            t->c.regset = c->regset;
+            t->e = e;
+            t->block = NULL;
+            i++;
+        }
+    }
+
+    /* Run the worker threads */
+    nthreads = c->jobs;
+    if ( (size_t)nthreads > q.n ) {
+        nthreads = q.n;
+    }
+    threads = malloc(sizeof(pthread_t) * (nthreads > 0 ? nthreads : 1));
+    if ( threads == NULL ) {
+        free(q.tasks);
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    pthread_mutex_init(&q.mutex, NULL);
+    intern_shared(1);
+    for ( i = 0; i < (size_t)nthreads; i++ ) {
+        if ( pthread_create(&threads[i], NULL, _worker, &q) != 0 ) {
+            break;
+        }
+    }
+    if ( i == 0 ) {
+        /* No thread is available, then compile them in this thread */
+        _worker(&q);
+    }
+    for ( j = 0; j < i; j++ ) {
+        pthread_join(threads[j], NULL);
+    }
+    intern_shared(0);
+    pthread_mutex_destroy(&q.mutex);
+    free(threads);
+
+    /* Link the blocks in the source order */
+    failed = 0;
+    pb = NULL;
+    tb = NULL;
+    i = 0;
+    for ( e = block->head; e != NULL; e = e->next ) {
+        if ( e->type == OUTER_BLOCK_FUNC || e->type == OUTER_BLOCK_COROUTINE ) {
+            t = &q.tasks[i++];
+            if ( failed ) {
+                /* Discard the results following the first error */
+                _release_task(c, t);
+                continue;
+            }
+            if ( _merge_task(c, t) < 0 ) {
+                _free_blocks(c, t->block);
+                failed = 1;
+                continue;
+            }
+            b = t->block;
+        } else {
+            if ( failed ) {
+                continue;
+            }
+            b = _outer_block_entry(c, e);
+        }
+        if ( b == NULL ) {
+            failed = 1;
+            continue;
+        }
+        /* Link to the block list */
+        if ( pb != NULL ) {
+            pb->next = b;
+        } else {
+            tb = b;
+        }
+        pb = b;
+    }
+    free(q.tasks);
+
+    if ( failed ) {
+        _free_blocks(c, tb);
+        return NULL;
+    }
+
+    return tb;
+}
+
 /*
  * _outer_block -- compile an outer block
  */
@@ -1832,6 +2746,10 @@ _outer_block(compiler_t *c, outer_block_t *block)
     compiler_block_t *pb;
     outer_block_entry_t *e;
 
+    if ( c->jobs > 1 ) {
+        return _outer_block_parallel(c, block);
+    }
+
     /* Parse all outer block entries */
     e = block->head;
     pb = NULL;
@@ -1867,13 +2785,16 @@ _st(compiler_t *c, st_t *st)
 }
 
 /*
- * compile -- compiile a syntax tree to the intermediate representation
+ * minica_compile_parallel -- compile a syntax tree to the intermediate
+ * representation with the specified number of threads
  */
 compiler_t *
-minica_compile(st_t *st)
+minica_compile_parallel(st_t *st, int jobs)
 {
     compiler_t *c;
     compiler_block_t *b;
+    ir_func_t **f;
+    report_span_t span;
 
     /* Allocate a compiler instance */
     c = malloc(sizeof(compiler_t));
@@ -1883,9 +2804,10 @@ minica_compile(st_t *st)
     c->irobj = NULL;
     c->fout = NULL;
     c->blocks = NULL;
-    c->symbols.n = 0;
-    c->symbols.symbols = NULL;
+    symbol_table_init(&c->symbols);
     c->err_stack = NULL;
+    c->jobs = jobs;
+    c->regset = &regalloc_x86_64;
 
     /* Initialize the error handler */
     c->err.code = COMPILER_ERROR_UNKNOWN;
@@ -1895,15 +2817,43 @@ minica_compile(st_t *st)
     c->err_pool.err = COMPILER_ERROR_UNKNOWN;
 
     /* Compile the syntax tree */
+    report_begin(&span, REPORT_COMPILE);
     b = _st(c, st);
+    report_end(&span);
     if ( b == NULL ) {
         return NULL;
     }
     c->blocks = b;
 
+    /* Link the functions to the IR object in the order of the source code */
+    c->irobj = ir_object_new();
+    if ( c->irobj == NULL ) {
+        c->err.code = COMPILER_NOMEM;
+        return NULL;
+    }
+    f = &c->irobj->funcs;
+    for ( ; b != NULL; b = b->next ) {
+        if ( b->func == NULL ) {
+            continue;
+        }
+        b->func->next = NULL;
+        *f = b->func;
+        f = &b->func->next;
+        c->irobj->nfuncs++;
+    }
+
     return c;
 }
 
+/*
+ * compile -- compiile a syntax tree to the intermediate representation
+ */
+compiler_t *
+minica_compile(st_t *st)
+{
+    return minica_compile_parallel(st, 1);
+}
+
 /*
  * Local variables:
  * tab-width: 4
@@ -26,6 +26,7 @@
 
 #include "syntax.h"
 #include "ir.h"
+#include "symbol.h"
 #include <stdio.h>
 #include <stdint.h>
 
@@ -33,44 +34,6 @@ typedef struct _var compiler_var_t;
 typedef struct _val compiler_val_t;
 typedef struct _env compiler_env_t;
 
-/*
- * Reference operand
- */
-typedef struct {
-    compiler_val_t *val;
-    compiler_val_t *off;
-} operand_ref_val_t;
-
-/*
- * Reference operand
- */
-typedef struct {
-    compiler_val_t *val;
-    int off;
-} operand_ref_imm_t;
-
-/*
- * Operand
- */
-typedef struct {
-    operand_type_t type;
-    union {
-        compiler_val_t *val;
-        operand_ref_val_t *refval;
-        operand_ref_imm_t *refimm;
-    } u;
-} operand_t;
-
-/*
- * Instruction
- */
-typedef struct _instr compiler_instr_t;
-struct _instr {
-    ir_instr_t ir;
-    operand_t operands[4];
-    compiler_instr_t *next;
-};
-
 /*
  * Block type
  */
@@ -91,11 +54,12 @@ struct _compiler_block {
 };
 
 /*
- * Code
+ * Code (function being compiled and the block to append instructions to),
+ * shared by the nested scopes
  */
 typedef struct {
-    compiler_instr_t *head;
-    compiler_instr_t *tail;
+    ir_func_t *func;
+    int block;
 } compiler_code_t;
 
 /*
@@ -119,19 +83,31 @@ typedef enum {
  * Variable
  */
 struct _var {
-    ir_reg_t irreg;
+    const char *id;         /* Interned */
+    int reg;                /* Virtual register */
+    ir_reg_type_t regtype;
     type_t *type;
     int arg;
     int ret;
+    /* Depth of the scope where the variable is declared */
+    int depth;
     /* For a variable table (stack) */
     compiler_var_t *next;
+    /* For a hash bucket of the variable table */
+    compiler_var_t *bnext;
 };
 
 /*
- * Variable table
+ * Variable table (scoped hash table shared by the nested scopes)
  */
+#define COMPILER_VAR_TABLE_INIT_SIZE    64
 typedef struct {
-    compiler_var_t *top;    /* Stack */
+    compiler_var_t *top;    /* Stack of the variables in the live scopes */
+    compiler_var_t *dead;   /* Variables in the closed scopes */
+    int depth;              /* Depth of the current scope */
+    size_t n;               /* Number of the variables in the live scopes */
+    size_t size;            /* Number of the buckets (power of two) */
+    compiler_var_t **buckets;
     int _allocated;
 } compiler_var_table_t;
 
@@ -143,9 +119,7 @@ typedef enum {
     VAL_VAR,
     VAL_LITERAL,
     VAL_REG,
-    VAL_REG_SET,
     VAL_LIST,
-    VAL_COND,
 } compiler_val_type_t;
 
 /*
@@ -155,16 +129,12 @@ typedef struct {
     compiler_val_t *head;
     compiler_val_t *tail;
 } compiler_val_list_t;
-typedef struct {
-    int n;
-    compiler_val_t **vals;
-} compiler_val_cond_t;
 struct _val {
     compiler_val_type_t type;
     union {
         compiler_var_t *var;
+        int reg;
         compiler_val_list_t *list;
-        compiler_val_cond_t *conds;
         literal_t *lit;
     } u;
     /* Linked list */
@@ -172,21 +142,64 @@ struct _val {
 };
 
 /*
- * Interference graph
+ * Interference graph; the vertices are the virtual registers of a function,
+ * and the edges are looked up in the adjacency matrix for a small graph, or
+ * in the hashed edge set otherwise
  */
+#define COMPILER_IG_MATRIX_MAX          2048
+#define COMPILER_IG_EDGES_INIT_SIZE     64
 typedef struct {
     int pair[2];
 } compiler_edge_t;
 typedef struct {
+    int n;
+    int size;
+    int *vs;
+} compiler_ig_adj_t;
+typedef struct {
+    /* Vertices */
+    size_t n;
+    compiler_ig_adj_t *adj;
+    /* Adjacency matrix (n x n bits), or NULL */
+    uint64_t *matrix;
+    /* Edge set (open addressing; the key of a < b is a << 32 | b, and zero
+       for an empty slot) */
     struct {
         size_t n;
-        compiler_val_t **vals;
-    } v;
+        size_t size;
+        uint64_t *keys;
+    } edges;
+    /* Move-related pairs (candidates for coalescing) */
     struct {
+        size_t n;
+        size_t size;
         compiler_edge_t *edges;
-    } e;
+    } moves;
 } compiler_ig_t;
 
+/*
+ * Physical registers for the register allocation
+ */
+typedef struct {
+    /* Allocatable registers in the order of preference */
+    int n;
+    const int *regs;
+    const char **names;
+    /* Registers of the arguments and the return values */
+    int nargs;
+    const int *args;
+    int nrets;
+    const int *rets;
+    /* Fixed registers of the quotient and the remainder of a division */
+    int div_quot;
+    int div_rem;
+    /* Fixed registers of the high and the low halves of a multiplication */
+    int mul_hi;
+    int mul_lo;
+    /* Fixed register of the shift count */
+    int shift_count;
+} compiler_regset_t;
+
 /*
  * Constant values
  */
@@ -221,16 +234,11 @@ struct _env {
     /* Variables */
     compiler_var_table_t *vars;
     /* Instructions */
-    compiler_code_t code;
+    compiler_code_t *code;
     /* Pointer to the stacked environement below */
     compiler_env_t *prev;
     /* Value of the latest statement */
     compiler_val_t *retval;
-    /* For optimization */
-    struct {
-        int max_reg_id; /* Maximum ID for register values */
-    } opt;
-    compiler_ig_t ig;
 };
 
 /*
@@ -241,6 +249,12 @@ typedef struct {
     size_t size;
 } compiler_type_t;
 
+/*
+ * Maximum number of the return values of a coroutine, which are yielded in a
+ * packet of the runtime (RT_MAX_VALUES)
+ */
+#define COMPILER_MAX_PACKET             4
+
 /*
  * Error code
  */
@@ -249,6 +263,8 @@ typedef enum {
     COMPILER_NOMEM,
     COMPILER_DUPLICATE_VARIABLE,
     COMPILER_SYNTAX_ERROR,
+    COMPILER_UNSUPPORTED,
+    COMPILER_TOO_MANY_VALUES,
 } compiler_error_code_t;
 
 /*
@@ -261,61 +277,6 @@ struct _error {
     compiler_error_t *next;
 };
 
-/*
- * Symbol type
- */
-typedef enum {
-    COMPILER_SYMBOL_CODE,
-    COMPILER_SYMBOL_DATA,
-    COMPILER_SYMBOL_RODATA,
-    COMPILER_SYMBOL_BSS,
-} compiler_symbol_type_t;
-
-/*
- * Code symbol
- */
-typedef struct {
-    size_t n;
-    ir_instr_t *code;
-} compiler_symbol_code_t;
-
-/*
- * Data/rodata symbol
- */
-typedef struct {
-    size_t n;
-    uint8_t *data;
-} compiler_symbol_data_t;
-
-/*
- * BSS symbol
- */
-typedef struct {
-    size_t n;
-} compiler_symbol_bss_t;
-
-/*
- * Symbols
- */
-typedef struct {
-    char *label;
-    compiler_symbol_type_t type;
-    union {
-        compiler_symbol_code_t code;
-        compiler_symbol_data_t data;
-        compiler_symbol_data_t rodata;
-        compiler_symbol_bss_t bss;
-    } u;
-} compiler_symbol_t;
-
-/*
- * Symbol table
- */
-typedef struct {
-    size_t n;
-    compiler_symbol_t **symbols;
-} compiler_symbol_table_t;
-
 /*
  * Compiler
  */
@@ -337,6 +298,10 @@ typedef struct {
     } err;
     compiler_error_t *err_stack;
     compiler_error_t err_pool;
+    /* Number of threads compiling functions and coroutines */
+    int jobs;
+    /* Target registers, or NULL not to allocate registers */
+    const compiler_regset_t *regset;
 } compiler_t;
 
 #ifdef __cplusplus
@@ -344,6 +309,11 @@ extern "C" {
 #endif
 
     compiler_t * minica_compile(st_t *);
+    compiler_t * minica_compile_parallel(st_t *, int);
+
+    /* regalloc.c */
+    extern const compiler_regset_t regalloc_x86_64;
+    int regalloc(ir_func_t *, const compiler_regset_t *);
 
 #ifdef __cplusplus
 }
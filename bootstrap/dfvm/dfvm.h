@@ -0,0 +1,183 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _DFVM_H
+#define _DFVM_H
+
+#include "../ir.h"
+#include "../arch.h"
+#include "../compile.h"
+#include <stdint.h>
+
+/*
+ * Data flow virtual machine (see dfvm/Instruction.md).  The bytecode of a
+ * function is the header followed by the instructions, and is referred to
+ * by the symbol of the function.  The header is the number of the registers
+ * of the window (u16), the number of the arguments (u8), the type (u8), and
+ * the register of each argument (u16).  The operands of an instruction follow
+ * the opcode (u8):
+ *
+ *   r  register (u16)
+ *   s  register (u16), or immediate (zigzag LEB128) if the bit of the source
+ *      is set in the mode (u8) following the opcode
+ *   b  bits (u8)
+ *   t  target; offset from the first instruction (i32)
+ *   m  width in bytes (u8), base (u16), index (u16), scale (u8), and
+ *      displacement (zigzag LEB128); DFVM_NOREG for no base or index
+ *
+ * The multi-byte values are in the little endian.
+ */
+#define DFVM_NOREG          0xffff
+#define DFVM_MAX_REGS       0xfffe
+#define DFVM_MAX_RETS       2
+#define DFVM_STACK_SIZE     65536
+
+/*
+ * Type of function
+ */
+#define DFVM_FUNC           0
+#define DFVM_COROUTINE      1
+
+/*
+ * Opcodes
+ */
+typedef enum {
+    DFVM_NOP = 0,       /* */
+    DFVM_MOV,           /* r s */
+    DFVM_ADD,           /* r s s */
+    DFVM_SUB,           /* r s s */
+    DFVM_MUL,           /* r s s */
+    DFVM_DIV,           /* r s s */
+    DFVM_MOD,           /* r s s */
+    DFVM_DIVMOD,        /* r r s s (quotient and remainder) */
+    DFVM_MULH,          /* r s s b (high bits of the product) */
+    DFVM_MULHL,         /* r r s s b (high and low bits) */
+    DFVM_DIVU,          /* r s s (unsigned) */
+    DFVM_MODU,          /* r s s (unsigned) */
+    DFVM_DIVMODU,       /* r r s s (unsigned) */
+    DFVM_MULHU,         /* r s s b (unsigned) */
+    DFVM_MULHLU,        /* r r s s b (unsigned) */
+    DFVM_INC,           /* r s */
+    DFVM_DEC,           /* r s */
+    DFVM_NOT,           /* r s */
+    DFVM_COMP,          /* r s */
+    DFVM_LAND,          /* r s s */
+    DFVM_LOR,           /* r s s */
+    DFVM_AND,           /* r s s */
+    DFVM_OR,            /* r s s */
+    DFVM_XOR,           /* r s s */
+    DFVM_SHL,           /* r s s */
+    DFVM_SHR,           /* r s s (arithmetic) */
+    DFVM_SHRU,          /* r s s (logical) */
+    DFVM_EQ,            /* r s s */
+    DFVM_NEQ,           /* r s s */
+    DFVM_GT,            /* r s s */
+    DFVM_LT,            /* r s s */
+    DFVM_GEQ,           /* r s s */
+    DFVM_LEQ,           /* r s s */
+    DFVM_GTU,           /* r s s (unsigned) */
+    DFVM_LTU,           /* r s s (unsigned) */
+    DFVM_GEQU,          /* r s s (unsigned) */
+    DFVM_LEQU,          /* r s s (unsigned) */
+    DFVM_EXT,           /* r b (sign-extend from the bits) */
+    DFVM_EXTU,          /* r b (zero-extend from the bits) */
+    DFVM_LOAD,          /* r m */
+    DFVM_STORE,         /* s m */
+    DFVM_JMP,           /* t */
+    DFVM_BR,            /* s t t */
+    DFVM_RET,           /* n (u8) s...s */
+    DFVM_YIELD,         /* */
+    DFVM_DISPATCH,      /* r n (u8) t...t (by the state of the frame at r) */
+    DFVM_NOPS,
+} dfvm_opcode_t;
+
+/*
+ * Word of the threaded code; the handler, or an operand of the instruction
+ */
+typedef union _dfvm_word dfvm_word_t;
+union _dfvm_word {
+    const void *h;
+    int64_t i;
+    const dfvm_word_t *t;
+};
+
+/*
+ * Function loaded
+ */
+typedef struct {
+    const char *name;
+    int type;
+    int nregs;
+    int nargs;
+    int *args;
+    /* Threaded code */
+    size_t n;
+    dfvm_word_t *code;
+    /* Profile */
+    uint64_t calls;
+} dfvm_func_t;
+
+/*
+ * Virtual machine; the windows of the calls are stacked on the registers
+ */
+typedef struct {
+    struct {
+        size_t n;
+        size_t size;
+        int64_t *regs;
+    } stack;
+    int nfuncs;
+    dfvm_func_t *funcs;
+} dfvm_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* dfvm/encode.c */
+int
+dfvm_assemble(ir_object_t *, const compiler_regset_t *, arch_code_t *);
+
+/* dfvm/vm.c */
+dfvm_t *
+dfvm_new(const arch_code_t *);
+void
+dfvm_delete(dfvm_t *);
+dfvm_func_t *
+dfvm_func(dfvm_t *, const char *);
+int
+dfvm_call(dfvm_t *, dfvm_func_t *, const int64_t *, int, int64_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _DFVM_H */
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,1019 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dfvm.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Operand referring to the k-th scratch register of the window
+ */
+#define SCRATCH(k)      (-1 - (k))
+
+/*
+ * Branch to fix up
+ */
+struct dfvm_fixup {
+    off_t pos;
+    int block;
+};
+
+/*
+ * Encoder
+ */
+struct dfvm_enc {
+    arch_code_t *code;
+    /* Allocated sizes of the text and the symbols */
+    size_t tsize;
+    int ssize;
+    /* Physical registers allocated, or NULL */
+    const compiler_regset_t *rs;
+    /* Function being encoded, and the physical registers of it */
+    ir_func_t *func;
+    int *hregs;
+    int nhregs;
+    /* Register of the window for each register of the function, the size of
+       the window, and the first of the scratch registers */
+    int *map;
+    int nregs;
+    int scratch;
+    /* First instruction, and the offset of each block from it */
+    off_t start;
+    off_t *blocks;
+    struct {
+        size_t n;
+        size_t size;
+        struct dfvm_fixup *fixups;
+    } fixup;
+    /* Dispatch table of the coroutine, and the number of the yields */
+    off_t table;
+    int nyields;
+};
+
+/*
+ * Opcodes of the IR arithmetic
+ */
+static const dfvm_opcode_t _ops[] = {
+    [IR_OPCODE_MOV] = DFVM_MOV,
+    [IR_OPCODE_ADD] = DFVM_ADD,
+    [IR_OPCODE_SUB] = DFVM_SUB,
+    [IR_OPCODE_MUL] = DFVM_MUL,
+    [IR_OPCODE_DIV] = DFVM_DIV,
+    [IR_OPCODE_MOD] = DFVM_MOD,
+    [IR_OPCODE_INC] = DFVM_INC,
+    [IR_OPCODE_DEC] = DFVM_DEC,
+    [IR_OPCODE_NOT] = DFVM_NOT,
+    [IR_OPCODE_COMP] = DFVM_COMP,
+    [IR_OPCODE_LAND] = DFVM_LAND,
+    [IR_OPCODE_LOR] = DFVM_LOR,
+    [IR_OPCODE_AND] = DFVM_AND,
+    [IR_OPCODE_OR] = DFVM_OR,
+    [IR_OPCODE_XOR] = DFVM_XOR,
+    [IR_OPCODE_LSHIFT] = DFVM_SHL,
+    [IR_OPCODE_RSHIFT] = DFVM_SHR,
+    [IR_OPCODE_CMP_EQ] = DFVM_EQ,
+    [IR_OPCODE_CMP_NEQ] = DFVM_NEQ,
+    [IR_OPCODE_CMP_GT] = DFVM_GT,
+    [IR_OPCODE_CMP_LT] = DFVM_LT,
+    [IR_OPCODE_CMP_GEQ] = DFVM_GEQ,
+    [IR_OPCODE_CMP_LEQ] = DFVM_LEQ,
+};
+
+/*
+ * _reserve -- reserve the space of the text
+ */
+static int
+_reserve(struct dfvm_enc *enc, size_t len)
+{
+    arch_code_t *code;
+    uint8_t *s;
+    size_t nsize;
+
+    code = enc->code;
+    if ( code->text.size + len <= enc->tsize ) {
+        return 0;
+    }
+    nsize = enc->tsize ? enc->tsize : 4096;
+    while ( nsize < code->text.size + len ) {
+        nsize <<= 1;
+    }
+    s = realloc(code->text.s, nsize);
+    if ( s == NULL ) {
+        return -1;
+    }
+    code->text.s = s;
+    enc->tsize = nsize;
+
+    return 0;
+}
+
+/*
+ * _bytes -- append the bytes to the text
+ */
+static int
+_bytes(struct dfvm_enc *enc, const void *s, size_t len)
+{
+    if ( _reserve(enc, len) < 0 ) {
+        return -1;
+    }
+    memcpy(enc->code->text.s + enc->code->text.size, s, len);
+    enc->code->text.size += len;
+
+    return 0;
+}
+
+/*
+ * _u8 -- append a byte
+ */
+static int
+_u8(struct dfvm_enc *enc, int v)
+{
+    uint8_t b;
+
+    b = v;
+
+    return _bytes(enc, &b, 1);
+}
+
+/*
+ * _u16 -- append a 16-bit value
+ */
+static int
+_u16(struct dfvm_enc *enc, int v)
+{
+    uint8_t b[2];
+
+    b[0] = v & 0xff;
+    b[1] = (v >> 8) & 0xff;
+
+    return _bytes(enc, b, 2);
+}
+
+/*
+ * _i32 -- append a 32-bit value
+ */
+static int
+_i32(struct dfvm_enc *enc, int32_t v)
+{
+    uint8_t b[4];
+    int i;
+
+    for ( i = 0; i < 4; i++ ) {
+        b[i] = ((uint32_t)v >> (8 * i)) & 0xff;
+    }
+
+    return _bytes(enc, b, 4);
+}
+
+/*
+ * _leb -- append a signed value in the zigzag LEB128
+ */
+static int
+_leb(struct dfvm_enc *enc, int64_t v)
+{
+    uint8_t b[10];
+    uint64_t z;
+    int n;
+
+    z = ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+    n = 0;
+    do {
+        b[n] = z & 0x7f;
+        z >>= 7;
+        if ( z ) {
+            b[n] |= 0x80;
+        }
+        n++;
+    } while ( z );
+
+    return _bytes(enc, b, n);
+}
+
+/*
+ * _target -- append the target of a branch to fix up
+ */
+static int
+_target(struct dfvm_enc *enc, int block)
+{
+    struct dfvm_fixup *fixups;
+    size_t nsize;
+
+    if ( enc->fixup.n >= enc->fixup.size ) {
+        nsize = enc->fixup.size ? enc->fixup.size * 2 : 64;
+        fixups = realloc(enc->fixup.fixups,
+                         sizeof(struct dfvm_fixup) * nsize);
+        if ( fixups == NULL ) {
+            return -1;
+        }
+        enc->fixup.fixups = fixups;
+        enc->fixup.size = nsize;
+    }
+    enc->fixup.fixups[enc->fixup.n].pos = enc->code->text.size;
+    enc->fixup.fixups[enc->fixup.n].block = block;
+    enc->fixup.n++;
+
+    return _i32(enc, 0);
+}
+
+/*
+ * _patch -- write a 32-bit value at the position
+ */
+static void
+_patch(struct dfvm_enc *enc, off_t pos, int32_t v)
+{
+    int i;
+
+    for ( i = 0; i < 4; i++ ) {
+        enc->code->text.s[pos + i] = ((uint32_t)v >> (8 * i)) & 0xff;
+    }
+}
+
+/*
+ * _sym -- add a symbol
+ */
+static int
+_sym(struct dfvm_enc *enc, const char *label, off_t pos, size_t size)
+{
+    arch_code_t *code;
+    arch_sym_t *syms;
+    int nsize;
+
+    code = enc->code;
+    if ( code->sym.n >= enc->ssize ) {
+        nsize = enc->ssize ? enc->ssize * 2 : 16;
+        syms = realloc(code->sym.syms, sizeof(arch_sym_t) * nsize);
+        if ( syms == NULL ) {
+            return -1;
+        }
+        code->sym.syms = syms;
+        enc->ssize = nsize;
+    }
+    code->sym.syms[code->sym.n].type = ARCH_SYM_FUNC;
+    code->sym.syms[code->sym.n].label = label;
+    code->sym.syms[code->sym.n].pos = pos;
+    code->sym.syms[code->sym.n].size = size;
+    code->sym.syms[code->sym.n].ref = NULL;
+    code->sym.n++;
+
+    return 0;
+}
+
+/*
+ * _map -- map the registers of the function to the window; the allocated
+ * registers share the register of the physical register or the spill slot,
+ * and the others take their own
+ */
+static int
+_map(struct dfvm_enc *enc)
+{
+    ir_func_t *func;
+    ir_reg_t *reg;
+    int *hregs;
+    int nhregs;
+    int n;
+    int i;
+    int j;
+
+    func = enc->func;
+    free(enc->map);
+    free(enc->hregs);
+    enc->map = malloc(sizeof(int) * (func->reg.n + 1));
+    enc->hregs = malloc(sizeof(int) * (func->reg.n + 1));
+    if ( enc->map == NULL || enc->hregs == NULL ) {
+        return -1;
+    }
+    hregs = enc->hregs;
+    nhregs = 0;
+    for ( i = 0; i < (int)func->reg.n; i++ ) {
+        reg = &func->reg.regs[i];
+        if ( reg->hreg < 0 ) {
+            continue;
+        }
+        for ( j = 0; j < nhregs && hregs[j] != reg->hreg; j++ ) {
+        }
+        if ( j >= nhregs ) {
+            hregs[nhregs++] = reg->hreg;
+        }
+        enc->map[i] = j;
+    }
+    enc->nhregs = nhregs;
+    n = nhregs + func->nslots;
+    for ( i = 0; i < (int)func->reg.n; i++ ) {
+        reg = &func->reg.regs[i];
+        if ( reg->hreg >= 0 ) {
+            continue;
+        }
+        if ( reg->slot >= 0 ) {
+            enc->map[i] = nhregs + reg->slot;
+        } else {
+            enc->map[i] = n++;
+        }
+    }
+    /* Two scratch registers */
+    enc->scratch = n;
+    n += 2;
+    enc->nregs = n;
+    if ( n > DFVM_MAX_REGS ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _arg -- get the register of the window of the k-th argument; the argument
+ * is in the physical register of the calling convention if the registers are
+ * allocated (see _constrain_args() of regalloc.c), and the unused one is in
+ * the scratch register
+ */
+static int
+_arg(struct dfvm_enc *enc, int k)
+{
+    ir_func_t *func;
+    size_t i;
+    int j;
+
+    func = enc->func;
+    if ( enc->rs != NULL ) {
+        if ( k >= enc->rs->nargs ) {
+            return -1;
+        }
+        for ( j = 0; j < enc->nhregs; j++ ) {
+            if ( enc->hregs[j] == enc->rs->args[k] ) {
+                return j;
+            }
+        }
+        return enc->scratch;
+    }
+    for ( i = 0; i < func->reg.n; i++ ) {
+        if ( func->reg.regs[i].arg == k ) {
+            return enc->map[i];
+        }
+    }
+
+    return enc->scratch;
+}
+
+/*
+ * _bits -- get the width of a register in bits; the registers narrower than
+ * 64 bits are operated in 32 bits as the native code generator does, and are
+ * kept in the canonical form of the type (see ir.h)
+ */
+static int
+_bits(ir_func_t *func, int r)
+{
+    switch ( func->reg.regs[r].type ) {
+    case IR_REG_PTR:
+    case IR_REG_I64:
+    case IR_REG_U64:
+        return 64;
+    default:
+        return 32;
+    }
+}
+
+/*
+ * _optype -- get the register of the operation of an instruction; the first
+ * register operand for a comparison, or the result, or -1 if none
+ */
+static int
+_optype(ir_func_t *func, const ir_instr_t *p, dfvm_opcode_t op)
+{
+    int i;
+
+    if ( op >= DFVM_EQ && op <= DFVM_LEQU ) {
+        for ( i = 0; i < p->noperands; i++ ) {
+            if ( p->operands[i].type == OPERAND_TYPE_REG ) {
+                return p->operands[i].u.reg;
+            }
+        }
+        return -1;
+    }
+
+    return p->result.reg[0];
+}
+
+/*
+ * _unsigned -- get the opcode of the operation on the unsigned values
+ */
+static dfvm_opcode_t
+_unsigned(dfvm_opcode_t op)
+{
+    switch ( op ) {
+    case DFVM_DIV:
+        return DFVM_DIVU;
+    case DFVM_MOD:
+        return DFVM_MODU;
+    case DFVM_DIVMOD:
+        return DFVM_DIVMODU;
+    case DFVM_MULH:
+        return DFVM_MULHU;
+    case DFVM_MULHL:
+        return DFVM_MULHLU;
+    case DFVM_SHR:
+        return DFVM_SHRU;
+    case DFVM_GT:
+        return DFVM_GTU;
+    case DFVM_LT:
+        return DFVM_LTU;
+    case DFVM_GEQ:
+        return DFVM_GEQU;
+    case DFVM_LEQ:
+        return DFVM_LEQU;
+    default:
+        return op;
+    }
+}
+
+/*
+ * _imm -- get the value of an immediate operand of the register type
+ */
+static int64_t
+_imm(const ir_imm_t *imm, ir_reg_type_t type)
+{
+    int64_t v;
+
+    switch ( imm->type ) {
+    case IR_IMM_I8:
+        v = imm->u.u8;
+        break;
+    case IR_IMM_S8:
+        v = imm->u.s8;
+        break;
+    case IR_IMM_I16:
+        v = imm->u.u16;
+        break;
+    case IR_IMM_S16:
+        v = imm->u.s16;
+        break;
+    case IR_IMM_I32:
+        v = imm->u.u32;
+        break;
+    case IR_IMM_S32:
+        v = imm->u.s32;
+        break;
+    default:
+        v = imm->u.s64;
+        break;
+    }
+
+    return ir_reg_type_ext(type, v);
+}
+
+/*
+ * _reg -- append a register
+ */
+static int
+_reg(struct dfvm_enc *enc, int r)
+{
+    if ( r < 0 || (size_t)r >= enc->func->reg.n ) {
+        return -1;
+    }
+
+    return _u16(enc, enc->map[r]);
+}
+
+/*
+ * _mode -- append the mode of the source operands
+ */
+static int
+_mode(struct dfvm_enc *enc, const ir_operand_t *ops, int n)
+{
+    int mode;
+    int i;
+
+    mode = 0;
+    for ( i = 0; i < n; i++ ) {
+        if ( ops[i].type == OPERAND_TYPE_IMM ) {
+            mode |= 1 << i;
+        } else if ( ops[i].type != OPERAND_TYPE_REG ) {
+            return -1;
+        }
+    }
+
+    return _u8(enc, mode);
+}
+
+/*
+ * _src -- append a source operand of the operation of the register type
+ */
+static int
+_src(struct dfvm_enc *enc, const ir_operand_t *op, ir_reg_type_t type)
+{
+    if ( op->type == OPERAND_TYPE_IMM ) {
+        return _leb(enc, _imm(&op->u.imm, type));
+    }
+    if ( op->type == OPERAND_TYPE_REG && op->u.reg < 0 ) {
+        return _u16(enc, enc->scratch + SCRATCH(0) - op->u.reg);
+    }
+
+    return _reg(enc, op->u.reg);
+}
+
+/*
+ * _ext -- truncate the result narrower than 64 bits, and sign- or
+ * zero-extend it by the type
+ */
+static int
+_ext(struct dfvm_enc *enc, int r)
+{
+    ir_reg_type_t type;
+    int bits;
+
+    type = enc->func->reg.regs[r].type;
+    bits = ir_reg_type_bits(type);
+    if ( bits >= 64 || type == IR_REG_BOOL ) {
+        return 0;
+    }
+    if ( _u8(enc, ir_reg_type_unsigned(type) ? DFVM_EXTU : DFVM_EXT) < 0
+         || _reg(enc, r) < 0 || _u8(enc, bits) < 0 ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _mem -- append a memory operand of bytes
+ */
+static int
+_mem(struct dfvm_enc *enc, const ir_operand_t *op, int bytes)
+{
+    const ir_ref_t *ref;
+
+    if ( op->type != OPERAND_TYPE_REF ) {
+        return -1;
+    }
+    ref = &op->u.ref;
+    if ( _u8(enc, bytes) < 0 ) {
+        return -1;
+    }
+    if ( (ref->base >= 0 ? _reg(enc, ref->base) : _u16(enc, DFVM_NOREG)) < 0
+         || (ref->index >= 0 ? _reg(enc, ref->index)
+             : _u16(enc, DFVM_NOREG)) < 0
+         || _u8(enc, ref->scale) < 0 || _leb(enc, ref->disp) < 0 ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _load -- move the first source operand to the scratch register if it is an
+ * immediate, so that the first source of an operation is a register
+ */
+static int
+_load(struct dfvm_enc *enc, ir_operand_t *op, ir_reg_type_t type)
+{
+    if ( op->type != OPERAND_TYPE_IMM ) {
+        return 0;
+    }
+    if ( _u8(enc, DFVM_MOV) < 0 || _u8(enc, 1) < 0
+         || _u16(enc, enc->scratch) < 0 || _src(enc, op, type) < 0 ) {
+        return -1;
+    }
+    ir_operand_reg(op, SCRATCH(0));
+
+    return 0;
+}
+
+/*
+ * _arith -- encode an arithmetic, logical, or comparison instruction
+ */
+static int
+_arith(struct dfvm_enc *enc, const ir_instr_t *p, dfvm_opcode_t op)
+{
+    ir_operand_t ops[2];
+    ir_reg_type_t type;
+    int bits;
+    int r;
+    int i;
+
+    if ( p->result.n != 1 || p->noperands < 1 || p->noperands > 2 ) {
+        return -1;
+    }
+    r = _optype(enc->func, p, op);
+    type = r >= 0 ? enc->func->reg.regs[r].type : IR_REG_I64;
+    bits = r >= 0 ? _bits(enc->func, r) : 64;
+    if ( ir_reg_type_unsigned(type) ) {
+        op = _unsigned(op);
+    }
+    memcpy(ops, p->operands, sizeof(ir_operand_t) * p->noperands);
+    if ( _load(enc, &ops[0], type) < 0 ) {
+        return -1;
+    }
+    if ( op == DFVM_SHL || op == DFVM_SHR || op == DFVM_SHRU ) {
+        /* The count is masked as the native code does */
+        if ( ops[1].type == OPERAND_TYPE_IMM ) {
+            ir_operand_imm(&ops[1], IR_IMM_I64,
+                           _imm(&ops[1].u.imm, type) & (bits - 1));
+        } else if ( bits < 64 ) {
+            if ( _u8(enc, DFVM_AND) < 0 || _u8(enc, 2) < 0
+                 || _u16(enc, enc->scratch + 1) < 0
+                 || _src(enc, &ops[1], type) < 0 || _leb(enc, 31) < 0 ) {
+                return -1;
+            }
+            ir_operand_reg(&ops[1], SCRATCH(1));
+        }
+    }
+
+    if ( _u8(enc, op) < 0 || _mode(enc, ops, p->noperands) < 0
+         || _reg(enc, p->result.reg[0]) < 0 ) {
+        return -1;
+    }
+    for ( i = 0; i < p->noperands; i++ ) {
+        if ( _src(enc, &ops[i], type) < 0 ) {
+            return -1;
+        }
+    }
+
+    return _ext(enc, p->result.reg[0]);
+}
+
+/*
+ * _divmod -- encode a division or multiplication with two results
+ */
+static int
+_divmod(struct dfvm_enc *enc, const ir_instr_t *p)
+{
+    ir_operand_t ops[2];
+    ir_reg_type_t type;
+    dfvm_opcode_t op;
+    int bits;
+    int r0;
+    int r1;
+
+    if ( p->result.n == 1 && p->opcode != IR_OPCODE_MULH ) {
+        return _arith(enc, p, _ops[p->opcode]);
+    }
+    if ( p->result.n < 1 || p->result.n > 2 || p->noperands != 2 ) {
+        return -1;
+    }
+    type = enc->func->reg.regs[p->result.reg[0]].type;
+    bits = _bits(enc->func, p->result.reg[0]);
+    memcpy(ops, p->operands, sizeof(ir_operand_t) * 2);
+    if ( _load(enc, &ops[0], type) < 0 ) {
+        return -1;
+    }
+    r0 = p->result.reg[0];
+    r1 = p->result.n > 1 ? p->result.reg[1] : -1;
+    if ( p->opcode == IR_OPCODE_MOD ) {
+        /* The remainder first */
+        r0 = p->result.reg[1];
+        r1 = p->result.reg[0];
+    }
+    if ( p->opcode == IR_OPCODE_MULH ) {
+        op = r1 >= 0 ? DFVM_MULHL : DFVM_MULH;
+    } else {
+        op = DFVM_DIVMOD;
+    }
+    if ( ir_reg_type_unsigned(type) ) {
+        op = _unsigned(op);
+    }
+    if ( _u8(enc, op) < 0 ) {
+        return -1;
+    }
+    if ( _mode(enc, ops, 2) < 0 || _reg(enc, r0) < 0
+         || (r1 >= 0 && _reg(enc, r1) < 0) || _src(enc, &ops[0], type) < 0
+         || _src(enc, &ops[1], type) < 0 ) {
+        return -1;
+    }
+    if ( p->opcode == IR_OPCODE_MULH && _u8(enc, bits) < 0 ) {
+        return -1;
+    }
+    if ( _ext(enc, r0) < 0 || (r1 >= 0 && _ext(enc, r1) < 0) ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _bytes_of -- get the width of the memory access of a register, or of an
+ * immediate as the native code generator does
+ */
+static int
+_bytes_of(ir_func_t *func, const ir_operand_t *op)
+{
+    if ( op->type == OPERAND_TYPE_REG ) {
+        return _bits(func, op->u.reg) / 8;
+    }
+    if ( op->type == OPERAND_TYPE_IMM
+         && (op->u.imm.type == IR_IMM_I64 || op->u.imm.type == IR_IMM_S64) ) {
+        return 8;
+    }
+
+    return 4;
+}
+
+/*
+ * _instr -- encode an instruction; next is the block placed next
+ */
+static int
+_instr(struct dfvm_enc *enc, const ir_instr_t *p, int next)
+{
+    ir_func_t *func;
+    ir_reg_type_t stype;
+    ir_reg_type_t type;
+    int bits;
+    int i;
+
+    func = enc->func;
+    switch ( p->opcode ) {
+    case IR_OPCODE_LOAD:
+        if ( p->result.n != 1 || p->noperands != 1 ) {
+            return -1;
+        }
+        bits = _bits(func, p->result.reg[0]);
+        if ( _u8(enc, DFVM_LOAD) < 0 || _reg(enc, p->result.reg[0]) < 0
+             || _mem(enc, &p->operands[0], bits / 8) < 0 ) {
+            return -1;
+        }
+        if ( func->reg.regs[p->result.reg[0]].type == IR_REG_U32 ) {
+            /* Loaded sign-extended */
+            return _ext(enc, p->result.reg[0]);
+        }
+        return 0;
+    case IR_OPCODE_STORE:
+        if ( p->noperands != 2 ) {
+            return -1;
+        }
+        bits = _bytes_of(func, &p->operands[0]) * 8;
+        if ( _u8(enc, DFVM_STORE) < 0 || _mode(enc, p->operands, 1) < 0
+             || _src(enc, &p->operands[0],
+                     bits < 64 ? IR_REG_I32 : IR_REG_I64) < 0
+             || _mem(enc, &p->operands[1], bits / 8) < 0 ) {
+            return -1;
+        }
+        return 0;
+    case IR_OPCODE_MOV:
+        if ( p->result.n != 1 || p->noperands != 1 ) {
+            return -1;
+        }
+        type = func->reg.regs[p->result.reg[0]].type;
+        if ( _u8(enc, DFVM_MOV) < 0 || _mode(enc, p->operands, 1) < 0
+             || _reg(enc, p->result.reg[0]) < 0
+             || _src(enc, &p->operands[0], type) < 0 ) {
+            return -1;
+        }
+        if ( p->operands[0].type != OPERAND_TYPE_REG ) {
+            return 0;
+        }
+        stype = func->reg.regs[p->operands[0].u.reg].type;
+        if ( ir_reg_type_bits(stype) > ir_reg_type_bits(type)
+             || ir_reg_type_unsigned(stype) != ir_reg_type_unsigned(type) ) {
+            /* Truncated, or extended by the other signedness */
+            return _ext(enc, p->result.reg[0]);
+        }
+        return 0;
+    case IR_OPCODE_DIV:
+    case IR_OPCODE_MOD:
+    case IR_OPCODE_MULH:
+        return _divmod(enc, p);
+    case IR_OPCODE_ADD:
+    case IR_OPCODE_SUB:
+    case IR_OPCODE_MUL:
+    case IR_OPCODE_INC:
+    case IR_OPCODE_DEC:
+    case IR_OPCODE_NOT:
+    case IR_OPCODE_COMP:
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_AND:
+    case IR_OPCODE_OR:
+    case IR_OPCODE_XOR:
+    case IR_OPCODE_LSHIFT:
+    case IR_OPCODE_RSHIFT:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        return _arith(enc, p, _ops[p->opcode]);
+    case IR_OPCODE_RET:
+        if ( p->noperands > DFVM_MAX_RETS ) {
+            return -1;
+        }
+        if ( _u8(enc, DFVM_RET) < 0 || _u8(enc, p->noperands) < 0
+             || _mode(enc, p->operands, p->noperands) < 0 ) {
+            return -1;
+        }
+        for ( i = 0; i < p->noperands; i++ ) {
+            if ( _src(enc, &p->operands[i], IR_REG_I64) < 0 ) {
+                return -1;
+            }
+        }
+        return 0;
+    case IR_OPCODE_YIELD:
+        /* The values are in the packet (see ir_coro.c) */
+        if ( p->noperands != 0 || _u8(enc, DFVM_YIELD) < 0 ) {
+            return -1;
+        }
+        enc->nyields++;
+        if ( enc->nyields >= func->frame.states ) {
+            return -1;
+        }
+        _patch(enc, enc->table + 4 * enc->nyields,
+               enc->code->text.size - enc->start);
+        return 0;
+    case IR_OPCODE_JMP:
+        if ( p->operands[0].u.block == next ) {
+            /* Fall through */
+            return 0;
+        }
+        if ( _u8(enc, DFVM_JMP) < 0
+             || _target(enc, p->operands[0].u.block) < 0 ) {
+            return -1;
+        }
+        return 0;
+    case IR_OPCODE_BR:
+        if ( _u8(enc, DFVM_BR) < 0 || _mode(enc, p->operands, 1) < 0
+             || _src(enc, &p->operands[0], IR_REG_I64) < 0
+             || _target(enc, p->operands[1].u.block) < 0
+             || _target(enc, p->operands[2].u.block) < 0 ) {
+            return -1;
+        }
+        return 0;
+    default:
+        /* Not supported */
+        return -1;
+    }
+}
+
+/*
+ * _dispatch -- encode the dispatch of a coroutine by the state of the frame;
+ * the first target is the start, and the others are the points following
+ * the yields
+ */
+static int
+_dispatch(struct dfvm_enc *enc)
+{
+    ir_func_t *func;
+    int k;
+
+    func = enc->func;
+    if ( func->frame.states <= 0 || func->frame.states > 255 ) {
+        return -1;
+    }
+    if ( _u8(enc, DFVM_DISPATCH) < 0 || _u16(enc, _arg(enc, 0)) < 0
+         || _u8(enc, func->frame.states) < 0 ) {
+        return -1;
+    }
+    enc->table = enc->code->text.size;
+    enc->nyields = 0;
+    for ( k = 0; k < func->frame.states; k++ ) {
+        if ( _i32(enc, 0) < 0 ) {
+            return -1;
+        }
+    }
+    _patch(enc, enc->table, enc->code->text.size - enc->start);
+
+    return 0;
+}
+
+/*
+ * _func -- encode a function
+ */
+static int
+_func(struct dfvm_enc *enc, ir_func_t *func)
+{
+    ir_instr_t *p;
+    off_t pos;
+    size_t i;
+    int nargs;
+    int next;
+    int b;
+
+    enc->func = func;
+    if ( _map(enc) < 0 ) {
+        return -1;
+    }
+    free(enc->blocks);
+    enc->blocks = malloc(sizeof(off_t) * (func->block.n + 1));
+    if ( enc->blocks == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < func->block.n; i++ ) {
+        enc->blocks[i] = -1;
+    }
+    enc->fixup.n = 0;
+
+    /* Header */
+    pos = enc->code->text.size;
+    nargs = 0;
+    for ( i = 0; i < func->reg.n; i++ ) {
+        if ( func->reg.regs[i].arg >= nargs ) {
+            nargs = func->reg.regs[i].arg + 1;
+        }
+    }
+    if ( nargs > 255 || _u16(enc, enc->nregs) < 0 || _u8(enc, nargs) < 0
+         || _u8(enc, func->type == IR_FUNC_COROUTINE
+                ? DFVM_COROUTINE : DFVM_FUNC) < 0 ) {
+        return -1;
+    }
+    for ( b = 0; b < nargs; b++ ) {
+        if ( _arg(enc, b) < 0 || _u16(enc, _arg(enc, b)) < 0 ) {
+            return -1;
+        }
+    }
+    enc->start = enc->code->text.size;
+    if ( func->type == IR_FUNC_COROUTINE && _dispatch(enc) < 0 ) {
+        return -1;
+    }
+
+    /* Blocks in the order of the function */
+    for ( b = 0; b < (int)func->block.n; b++ ) {
+        if ( func->block.blocks[b].head < 0 ) {
+            continue;
+        }
+        for ( next = b + 1; next < (int)func->block.n; next++ ) {
+            if ( func->block.blocks[next].head >= 0 ) {
+                break;
+            }
+        }
+        enc->blocks[b] = enc->code->text.size - enc->start;
+        for ( i = func->block.blocks[b].head; (int)i >= 0; i = p->next ) {
+            p = &func->instr.instrs[i];
+            if ( _instr(enc, p, next) < 0 ) {
+                return -1;
+            }
+        }
+    }
+
+    /* Resolve the branches */
+    for ( i = 0; i < enc->fixup.n; i++ ) {
+        b = enc->fixup.fixups[i].block;
+        if ( b < 0 || b >= (int)func->block.n || enc->blocks[b] < 0 ) {
+            return -1;
+        }
+        _patch(enc, enc->fixup.fixups[i].pos, enc->blocks[b]);
+    }
+
+    return _sym(enc, func->name, pos, enc->code->text.size - pos);
+}
+
+/*
+ * dfvm_assemble -- encode the IR to the bytecode; the functions are referred
+ * to by the symbols, and the registers allocated to the physical registers of
+ * rs (or NULL if not allocated) share the registers of the windows
+ */
+int
+dfvm_assemble(ir_object_t *obj, const compiler_regset_t *rs,
+              arch_code_t *code)
+{
+    struct dfvm_enc enc;
+    ir_func_t *func;
+    int ret;
+
+    memset(code, 0, sizeof(arch_code_t));
+    code->cpu = ARCH_CPU_DFVM;
+    memset(&enc, 0, sizeof(struct dfvm_enc));
+    enc.code = code;
+    enc.rs = rs;
+
+    ret = 0;
+    for ( func = obj->funcs; func != NULL; func = func->next ) {
+        if ( _func(&enc, func) < 0 ) {
+            ret = -1;
+            break;
+        }
+    }
+    free(enc.map);
+    free(enc.hregs);
+    free(enc.blocks);
+    free(enc.fixup.fixups);
+    if ( ret < 0 ) {
+        arch_code_release(code);
+    }
+
+    return ret;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,1106 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "dfvm.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * The bytecode is translated to the threaded code when loaded; an instruction
+ * is the handler specialized for the kinds of its operands, followed by the
+ * registers, the immediate values, and the targets.  The handlers are jumped
+ * to directly from one to the next with the labels as values of GCC, or
+ * dispatched by a switch otherwise.
+ */
+#if defined(__GNUC__) && !defined(DFVM_SWITCH)
+#define DFVM_THREADED   1
+#endif
+
+/*
+ * Handlers; RR for the register operands, and RI for the second immediate
+ * operand, M for the memory operand of the base and the displacement, and MX
+ * for the general one
+ */
+#define DFVM_HANDLERS(X)                                                \
+    X(MOV_R) X(MOV_I)                                                   \
+    X(ADD_RR) X(ADD_RI) X(SUB_RR) X(SUB_RI) X(MUL_RR) X(MUL_RI)         \
+    X(DIV_RR) X(DIV_RI) X(MOD_RR) X(MOD_RI) X(LAND_RR) X(LAND_RI)       \
+    X(LOR_RR) X(LOR_RI) X(AND_RR) X(AND_RI) X(OR_RR) X(OR_RI)           \
+    X(XOR_RR) X(XOR_RI) X(SHL_RR) X(SHL_RI) X(SHR_RR) X(SHR_RI)         \
+    X(SHRU_RR) X(SHRU_RI)                                               \
+    X(EQ_RR) X(EQ_RI) X(NEQ_RR) X(NEQ_RI) X(GT_RR) X(GT_RI)             \
+    X(LT_RR) X(LT_RI) X(GEQ_RR) X(GEQ_RI) X(LEQ_RR) X(LEQ_RI)           \
+    X(GTU_RR) X(GTU_RI) X(LTU_RR) X(LTU_RI) X(GEQU_RR) X(GEQU_RI)       \
+    X(LEQU_RR) X(LEQU_RI)                                               \
+    X(DIVMOD_RR) X(DIVMOD_RI) X(MULH_RR) X(MULH_RI)                     \
+    X(MULHL_RR) X(MULHL_RI)                                             \
+    X(DIVU_RR) X(DIVU_RI) X(MODU_RR) X(MODU_RI)                         \
+    X(DIVMODU_RR) X(DIVMODU_RI) X(MULHU_RR) X(MULHU_RI)                 \
+    X(MULHLU_RR) X(MULHLU_RI)                                           \
+    X(INC) X(DEC) X(NOT) X(COMP) X(EXT) X(EXTU)                         \
+    X(LOAD4_M) X(LOAD8_M) X(LOAD4_MX) X(LOAD8_MX)                       \
+    X(STORE4_RM) X(STORE8_RM) X(STORE4_IM) X(STORE8_IM)                 \
+    X(STORE4_RMX) X(STORE8_RMX) X(STORE4_IMX) X(STORE8_IMX)             \
+    X(JMP) X(BR) X(RET) X(DISPATCH)
+
+#define DFVM_HANDLER_ENUM(h)    H_##h,
+enum {
+    DFVM_HANDLERS(DFVM_HANDLER_ENUM)
+    H_NUM
+};
+
+/*
+ * Translator of the bytecode of a function; the threaded code is counted
+ * without being written if code is NULL
+ */
+struct dfvm_tr {
+    const uint8_t *s;
+    size_t len;
+    size_t pos;
+    int err;
+    int nregs;
+    /* Index to the threaded code of the offset of each instruction */
+    int *map;
+    dfvm_word_t *code;
+    size_t n;
+    const void *const *table;
+};
+
+/*
+ * Operands of the threaded code
+ */
+#define R(k)    regs[pc[(k)].i]
+#define I(k)    (pc[(k)].i)
+#define T(k)    (pc[(k)].t)
+
+#if DFVM_THREADED
+#define TARGET(h)   L_##h:
+#define NEXT(k)     do { pc += (k); goto *pc->h; } while ( 0 )
+#else
+#define TARGET(h)   case H_##h:
+#define NEXT(k)     do { pc += (k); goto next; } while ( 0 )
+#endif
+
+/*
+ * Binary operations of the registers, and of the register and the immediate
+ */
+#define BINOP(op, expr)                                                 \
+    TARGET(op##_RR)                                                     \
+        a = R(2);                                                       \
+        b = R(3);                                                       \
+        R(1) = (expr);                                                  \
+        NEXT(4);                                                        \
+    TARGET(op##_RI)                                                     \
+        a = R(2);                                                       \
+        b = I(3);                                                       \
+        R(1) = (expr);                                                  \
+        NEXT(4);
+#define DIVOP(op, expr)                                                 \
+    TARGET(op##_RR)                                                     \
+        a = R(2);                                                       \
+        b = R(3);                                                       \
+        if ( b == 0 ) {                                                 \
+            return -1;                                                  \
+        }                                                               \
+        R(1) = (expr);                                                  \
+        NEXT(4);                                                        \
+    TARGET(op##_RI)                                                     \
+        a = R(2);                                                       \
+        b = I(3);                                                       \
+        if ( b == 0 ) {                                                 \
+            return -1;                                                  \
+        }                                                               \
+        R(1) = (expr);                                                  \
+        NEXT(4);
+
+/* Quotient and remainder wrapped around as the physical machine does not
+   trap on the overflow of the narrower registers */
+#define QUO(a, b)   ((b) == -1 ? (int64_t)(0 - (uint64_t)(a)) : (a) / (b))
+#define REM(a, b)   ((b) == -1 ? 0 : (a) % (b))
+#define WRAP(expr)  ((int64_t)(expr))
+
+/*
+ * Memory operands; the base and the displacement, or the general one
+ */
+#define ADDR_M(k)   ((uint8_t *)(intptr_t)R(k) + I((k) + 1))
+#define ADDR_MX(k)                                                      \
+    ((uint8_t *)(intptr_t)((I(k) >= 0 ? R(k) : 0)                       \
+                           + (I((k) + 1) >= 0 ? R((k) + 1) : 0)         \
+                           * I((k) + 2) + I((k) + 3)))
+
+/*
+ * _mulhu -- get the high half of the unsigned product of 64-bit values
+ */
+static uint64_t
+_mulhu(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    return (uint64_t)(((unsigned __int128)a * b) >> 64);
+#else
+    uint64_t al;
+    uint64_t ah;
+    uint64_t bl;
+    uint64_t bh;
+    uint64_t t;
+    uint64_t w1;
+    uint64_t w2;
+
+    /* Product of the halves */
+    al = a & 0xffffffff;
+    ah = a >> 32;
+    bl = b & 0xffffffff;
+    bh = b >> 32;
+    t = ah * bl + ((al * bl) >> 32);
+    w1 = (t & 0xffffffff) + al * bh;
+    w2 = t >> 32;
+    return ah * bh + w2 + (w1 >> 32);
+#endif
+}
+
+/*
+ * _mulh -- get the high half of the signed product of 64-bit values
+ */
+static int64_t
+_mulh(int64_t a, int64_t b)
+{
+#ifdef __SIZEOF_INT128__
+    return (int64_t)(((__int128)a * b) >> 64);
+#else
+    uint64_t hi;
+
+    /* Unsigned product, and then the correction of the sign */
+    hi = _mulhu(a, b);
+    if ( a < 0 ) {
+        hi -= (uint64_t)b;
+    }
+    if ( b < 0 ) {
+        hi -= (uint64_t)a;
+    }
+    return (int64_t)hi;
+#endif
+}
+
+/*
+ * _exec -- execute the threaded code from pc on the window of the registers,
+ * and return the number of the values returned to rets, or -1 on the fault;
+ * the table of the handlers is returned to table if pc is NULL
+ */
+static int
+_exec(const dfvm_word_t *pc, int64_t *regs, int64_t *rets,
+      const void *const **table)
+{
+    int64_t a;
+    int64_t b;
+    int64_t v;
+    int i;
+
+#if DFVM_THREADED
+#define DFVM_HANDLER_LABEL(h)   [H_##h] = &&L_##h,
+    static const void *const labels[H_NUM] = {
+        DFVM_HANDLERS(DFVM_HANDLER_LABEL)
+    };
+
+    if ( pc == NULL ) {
+        *table = labels;
+        return 0;
+    }
+    goto *pc->h;
+#else
+    if ( pc == NULL ) {
+        *table = NULL;
+        return 0;
+    }
+next:
+    switch ( pc->i ) {
+#endif
+
+    TARGET(MOV_R)
+        R(1) = R(2);
+        NEXT(3);
+    TARGET(MOV_I)
+        R(1) = I(2);
+        NEXT(3);
+
+    BINOP(ADD, WRAP((uint64_t)a + (uint64_t)b))
+    BINOP(SUB, WRAP((uint64_t)a - (uint64_t)b))
+    BINOP(MUL, WRAP((uint64_t)a * (uint64_t)b))
+    DIVOP(DIV, QUO(a, b))
+    DIVOP(MOD, REM(a, b))
+    BINOP(LAND, a & b)
+    BINOP(LOR, a | b)
+    BINOP(AND, a & b)
+    BINOP(OR, a | b)
+    BINOP(XOR, a ^ b)
+    BINOP(SHL, WRAP((uint64_t)a << (b & 63)))
+    BINOP(SHR, a >> (b & 63))
+    BINOP(SHRU, WRAP((uint64_t)a >> (b & 63)))
+    BINOP(EQ, a == b)
+    BINOP(NEQ, a != b)
+    BINOP(GT, a > b)
+    BINOP(LT, a < b)
+    BINOP(GEQ, a >= b)
+    BINOP(LEQ, a <= b)
+    BINOP(GTU, (uint64_t)a > (uint64_t)b)
+    BINOP(LTU, (uint64_t)a < (uint64_t)b)
+    BINOP(GEQU, (uint64_t)a >= (uint64_t)b)
+    BINOP(LEQU, (uint64_t)a <= (uint64_t)b)
+
+    TARGET(DIVMOD_RR)
+        a = R(3);
+        b = R(4);
+        goto divmod;
+    TARGET(DIVMOD_RI)
+        a = R(3);
+        b = I(4);
+    divmod:
+        if ( b == 0 ) {
+            return -1;
+        }
+        v = REM(a, b);
+        R(1) = QUO(a, b);
+        R(2) = v;
+        NEXT(5);
+    TARGET(MULH_RR)
+        a = R(2);
+        b = R(3);
+        goto mulh;
+    TARGET(MULH_RI)
+        a = R(2);
+        b = I(3);
+    mulh:
+        R(1) = I(4) < 64 ? (a * b) >> I(4) : _mulh(a, b);
+        NEXT(5);
+    TARGET(MULHL_RR)
+        a = R(3);
+        b = R(4);
+        goto mulhl;
+    TARGET(MULHL_RI)
+        a = R(3);
+        b = I(4);
+    mulhl:
+        v = WRAP((uint64_t)a * (uint64_t)b);
+        R(1) = I(5) < 64 ? (a * b) >> I(5) : _mulh(a, b);
+        R(2) = v;
+        NEXT(6);
+
+    DIVOP(DIVU, WRAP((uint64_t)a / (uint64_t)b))
+    DIVOP(MODU, WRAP((uint64_t)a % (uint64_t)b))
+    TARGET(DIVMODU_RR)
+        a = R(3);
+        b = R(4);
+        goto divmodu;
+    TARGET(DIVMODU_RI)
+        a = R(3);
+        b = I(4);
+    divmodu:
+        if ( b == 0 ) {
+            return -1;
+        }
+        v = WRAP((uint64_t)a % (uint64_t)b);
+        R(1) = WRAP((uint64_t)a / (uint64_t)b);
+        R(2) = v;
+        NEXT(5);
+    TARGET(MULHU_RR)
+        a = R(2);
+        b = R(3);
+        goto mulhu;
+    TARGET(MULHU_RI)
+        a = R(2);
+        b = I(3);
+    mulhu:
+        R(1) = WRAP(I(4) < 64 ? ((uint64_t)a * (uint64_t)b) >> I(4)
+                    : _mulhu(a, b));
+        NEXT(5);
+    TARGET(MULHLU_RR)
+        a = R(3);
+        b = R(4);
+        goto mulhlu;
+    TARGET(MULHLU_RI)
+        a = R(3);
+        b = I(4);
+    mulhlu:
+        v = WRAP((uint64_t)a * (uint64_t)b);
+        R(1) = WRAP(I(5) < 64 ? ((uint64_t)a * (uint64_t)b) >> I(5)
+                    : _mulhu(a, b));
+        R(2) = v;
+        NEXT(6);
+
+    TARGET(INC)
+        R(1) = WRAP((uint64_t)R(2) + 1);
+        NEXT(3);
+    TARGET(DEC)
+        R(1) = WRAP((uint64_t)R(2) - 1);
+        NEXT(3);
+    TARGET(NOT)
+        R(1) = !R(2);
+        NEXT(3);
+    TARGET(COMP)
+        R(1) = ~R(2);
+        NEXT(3);
+    TARGET(EXT)
+        /* Shifted by 64 less the bits */
+        R(1) = WRAP((uint64_t)R(1) << I(2)) >> I(2);
+        NEXT(3);
+    TARGET(EXTU)
+        R(1) = WRAP(((uint64_t)R(1) << I(2)) >> I(2));
+        NEXT(3);
+
+    TARGET(LOAD4_M)
+        {
+            int32_t x;
+            memcpy(&x, ADDR_M(2), 4);
+            R(1) = x;
+        }
+        NEXT(4);
+    TARGET(LOAD8_M)
+        memcpy(&R(1), ADDR_M(2), 8);
+        NEXT(4);
+    TARGET(LOAD4_MX)
+        {
+            int32_t x;
+            memcpy(&x, ADDR_MX(2), 4);
+            R(1) = x;
+        }
+        NEXT(6);
+    TARGET(LOAD8_MX)
+        memcpy(&R(1), ADDR_MX(2), 8);
+        NEXT(6);
+    TARGET(STORE4_RM)
+        {
+            int32_t x = R(1);
+            memcpy(ADDR_M(2), &x, 4);
+        }
+        NEXT(4);
+    TARGET(STORE8_RM)
+        memcpy(ADDR_M(2), &R(1), 8);
+        NEXT(4);
+    TARGET(STORE4_IM)
+        {
+            int32_t x = I(1);
+            memcpy(ADDR_M(2), &x, 4);
+        }
+        NEXT(4);
+    TARGET(STORE8_IM)
+        memcpy(ADDR_M(2), &I(1), 8);
+        NEXT(4);
+    TARGET(STORE4_RMX)
+        {
+            int32_t x = R(1);
+            memcpy(ADDR_MX(2), &x, 4);
+        }
+        NEXT(6);
+    TARGET(STORE8_RMX)
+        memcpy(ADDR_MX(2), &R(1), 8);
+        NEXT(6);
+    TARGET(STORE4_IMX)
+        {
+            int32_t x = I(1);
+            memcpy(ADDR_MX(2), &x, 4);
+        }
+        NEXT(6);
+    TARGET(STORE8_IMX)
+        memcpy(ADDR_MX(2), &I(1), 8);
+        NEXT(6);
+
+    TARGET(JMP)
+        pc = T(1);
+        NEXT(0);
+    TARGET(BR)
+        pc = R(1) ? T(2) : T(3);
+        NEXT(0);
+    TARGET(RET)
+        /* The number of the values, and the kind and the value of each */
+        for ( i = 0; i < I(1); i++ ) {
+            rets[i] = I(2 + 2 * i) ? I(3 + 2 * i) : regs[I(3 + 2 * i)];
+        }
+        return I(1);
+    TARGET(DISPATCH)
+        memcpy(&v, (void *)(intptr_t)R(1), 8);
+        if ( v < 0 || v >= I(2) ) {
+            return -1;
+        }
+        pc = T(3 + v);
+        NEXT(0);
+
+#if !DFVM_THREADED
+    default:
+        break;
+    }
+#endif
+
+    return -1;
+}
+
+/*
+ * _u8 -- read a byte
+ */
+static int
+_u8(struct dfvm_tr *tr)
+{
+    if ( tr->pos + 1 > tr->len ) {
+        tr->err = 1;
+        return 0;
+    }
+
+    return tr->s[tr->pos++];
+}
+
+/*
+ * _u16 -- read a 16-bit value
+ */
+static int
+_u16(struct dfvm_tr *tr)
+{
+    int v;
+
+    v = _u8(tr);
+    v |= _u8(tr) << 8;
+
+    return v;
+}
+
+/*
+ * _i32 -- read a 32-bit value
+ */
+static int32_t
+_i32(struct dfvm_tr *tr)
+{
+    uint32_t v;
+    int i;
+
+    v = 0;
+    for ( i = 0; i < 4; i++ ) {
+        v |= (uint32_t)_u8(tr) << (8 * i);
+    }
+
+    return (int32_t)v;
+}
+
+/*
+ * _leb -- read a signed value in the zigzag LEB128
+ */
+static int64_t
+_leb(struct dfvm_tr *tr)
+{
+    uint64_t z;
+    int shift;
+    int b;
+
+    z = 0;
+    for ( shift = 0; shift < 64; shift += 7 ) {
+        b = _u8(tr);
+        z |= (uint64_t)(b & 0x7f) << shift;
+        if ( !(b & 0x80) ) {
+            return (int64_t)(z >> 1) ^ -(int64_t)(z & 1);
+        }
+    }
+    tr->err = 1;
+
+    return 0;
+}
+
+/*
+ * _word -- put a word of the value
+ */
+static void
+_word(struct dfvm_tr *tr, int64_t v)
+{
+    if ( tr->code != NULL ) {
+        tr->code[tr->n].i = v;
+    }
+    tr->n++;
+}
+
+/*
+ * _handler -- put the handler
+ */
+static void
+_handler(struct dfvm_tr *tr, int h)
+{
+    if ( tr->code != NULL && tr->table != NULL ) {
+        tr->code[tr->n].h = tr->table[h];
+        tr->n++;
+    } else {
+        _word(tr, h);
+    }
+}
+
+/*
+ * _reg -- read a register, and put it
+ */
+static int
+_reg(struct dfvm_tr *tr)
+{
+    int r;
+
+    r = _u16(tr);
+    if ( r >= tr->nregs ) {
+        tr->err = 1;
+        return 0;
+    }
+    _word(tr, r);
+
+    return r;
+}
+
+/*
+ * _src -- read a source operand of the kind of the bit of the mode, and put
+ * it
+ */
+static void
+_src(struct dfvm_tr *tr, int mode, int bit)
+{
+    if ( mode & (1 << bit) ) {
+        _word(tr, _leb(tr));
+    } else {
+        _reg(tr);
+    }
+}
+
+/*
+ * _target -- read a target, and put it
+ */
+static void
+_target(struct dfvm_tr *tr)
+{
+    int32_t t;
+
+    t = _i32(tr);
+    if ( t < 0 || (size_t)t >= tr->len ) {
+        tr->err = 1;
+        return;
+    }
+    if ( tr->code != NULL ) {
+        /* The targets are known in the second pass */
+        if ( tr->map[t] < 0 ) {
+            tr->err = 1;
+            return;
+        }
+        tr->code[tr->n].t = tr->code + tr->map[t];
+    }
+    tr->n++;
+}
+
+/*
+ * _mem -- read a memory operand to the words of the base, the index, the
+ * scale, and the displacement; returns the width in bytes, and sets general
+ * if it is not only of the base and the displacement
+ */
+static int
+_mem(struct dfvm_tr *tr, int64_t *words, int *general)
+{
+    int bytes;
+    int base;
+    int index;
+
+    bytes = _u8(tr);
+    base = _u16(tr);
+    index = _u16(tr);
+    words[2] = _u8(tr);
+    words[3] = _leb(tr);
+    if ( (bytes != 4 && bytes != 8)
+         || (base != DFVM_NOREG && base >= tr->nregs)
+         || (index != DFVM_NOREG && index >= tr->nregs) ) {
+        tr->err = 1;
+    }
+    words[0] = base == DFVM_NOREG ? -1 : base;
+    words[1] = index == DFVM_NOREG ? -1 : index;
+    *general = base == DFVM_NOREG || index != DFVM_NOREG;
+
+    return bytes;
+}
+
+/*
+ * _memop -- translate a load (mode < 0) or a store
+ */
+static void
+_memop(struct dfvm_tr *tr, int mode)
+{
+    int64_t words[4];
+    int64_t v;
+    int general;
+    int bytes;
+    int h;
+
+    if ( mode < 0 ) {
+        v = _u16(tr);
+        if ( v >= tr->nregs ) {
+            tr->err = 1;
+        }
+    } else if ( mode & 1 ) {
+        v = _leb(tr);
+    } else {
+        v = _u16(tr);
+        if ( v >= tr->nregs ) {
+            tr->err = 1;
+        }
+    }
+    bytes = _mem(tr, words, &general);
+    if ( mode < 0 ) {
+        h = general ? (bytes == 8 ? H_LOAD8_MX : H_LOAD4_MX)
+            : (bytes == 8 ? H_LOAD8_M : H_LOAD4_M);
+    } else if ( mode & 1 ) {
+        h = general ? (bytes == 8 ? H_STORE8_IMX : H_STORE4_IMX)
+            : (bytes == 8 ? H_STORE8_IM : H_STORE4_IM);
+    } else {
+        h = general ? (bytes == 8 ? H_STORE8_RMX : H_STORE4_RMX)
+            : (bytes == 8 ? H_STORE8_RM : H_STORE4_RM);
+    }
+    _handler(tr, h);
+    _word(tr, v);
+    if ( general ) {
+        _word(tr, words[0]);
+        _word(tr, words[1]);
+        _word(tr, words[2]);
+    } else {
+        _word(tr, words[0]);
+    }
+    _word(tr, words[3]);
+}
+
+/*
+ * Handlers of the binary operations of the registers; the ones of the
+ * immediate follow them
+ */
+static const int _binops[DFVM_NOPS] = {
+    [DFVM_ADD] = H_ADD_RR,
+    [DFVM_SUB] = H_SUB_RR,
+    [DFVM_MUL] = H_MUL_RR,
+    [DFVM_DIV] = H_DIV_RR,
+    [DFVM_MOD] = H_MOD_RR,
+    [DFVM_LAND] = H_LAND_RR,
+    [DFVM_LOR] = H_LOR_RR,
+    [DFVM_AND] = H_AND_RR,
+    [DFVM_OR] = H_OR_RR,
+    [DFVM_XOR] = H_XOR_RR,
+    [DFVM_SHL] = H_SHL_RR,
+    [DFVM_SHR] = H_SHR_RR,
+    [DFVM_SHRU] = H_SHRU_RR,
+    [DFVM_EQ] = H_EQ_RR,
+    [DFVM_NEQ] = H_NEQ_RR,
+    [DFVM_GT] = H_GT_RR,
+    [DFVM_LT] = H_LT_RR,
+    [DFVM_GEQ] = H_GEQ_RR,
+    [DFVM_LEQ] = H_LEQ_RR,
+    [DFVM_GTU] = H_GTU_RR,
+    [DFVM_LTU] = H_LTU_RR,
+    [DFVM_GEQU] = H_GEQU_RR,
+    [DFVM_LEQU] = H_LEQU_RR,
+    [DFVM_DIVMOD] = H_DIVMOD_RR,
+    [DFVM_MULH] = H_MULH_RR,
+    [DFVM_MULHL] = H_MULHL_RR,
+    [DFVM_DIVU] = H_DIVU_RR,
+    [DFVM_MODU] = H_MODU_RR,
+    [DFVM_DIVMODU] = H_DIVMODU_RR,
+    [DFVM_MULHU] = H_MULHU_RR,
+    [DFVM_MULHLU] = H_MULHLU_RR,
+};
+
+/*
+ * Handlers of the unary operations
+ */
+static const int _unops[DFVM_NOPS] = {
+    [DFVM_INC] = H_INC,
+    [DFVM_DEC] = H_DEC,
+    [DFVM_NOT] = H_NOT,
+    [DFVM_COMP] = H_COMP,
+};
+
+/*
+ * _instr -- translate an instruction
+ */
+static void
+_instr(struct dfvm_tr *tr)
+{
+    int64_t v;
+    int mode;
+    int op;
+    int n;
+    int i;
+
+    op = _u8(tr);
+    switch ( op ) {
+    case DFVM_NOP:
+        break;
+    case DFVM_MOV:
+        mode = _u8(tr);
+        _handler(tr, mode & 1 ? H_MOV_I : H_MOV_R);
+        _reg(tr);
+        _src(tr, mode, 0);
+        break;
+    case DFVM_ADD:
+    case DFVM_SUB:
+    case DFVM_MUL:
+    case DFVM_DIV:
+    case DFVM_MOD:
+    case DFVM_LAND:
+    case DFVM_LOR:
+    case DFVM_AND:
+    case DFVM_OR:
+    case DFVM_XOR:
+    case DFVM_SHL:
+    case DFVM_SHR:
+    case DFVM_SHRU:
+    case DFVM_EQ:
+    case DFVM_NEQ:
+    case DFVM_GT:
+    case DFVM_LT:
+    case DFVM_GEQ:
+    case DFVM_LEQ:
+    case DFVM_GTU:
+    case DFVM_LTU:
+    case DFVM_GEQU:
+    case DFVM_LEQU:
+    case DFVM_DIVMOD:
+    case DFVM_MULH:
+    case DFVM_MULHL:
+    case DFVM_DIVU:
+    case DFVM_MODU:
+    case DFVM_DIVMODU:
+    case DFVM_MULHU:
+    case DFVM_MULHLU:
+        /* The first source is a register (see dfvm/encode.c) */
+        mode = _u8(tr);
+        if ( mode & 1 ) {
+            tr->err = 1;
+        }
+        _handler(tr, _binops[op] + ((mode & 2) ? 1 : 0));
+        _reg(tr);
+        if ( op == DFVM_DIVMOD || op == DFVM_MULHL || op == DFVM_DIVMODU
+             || op == DFVM_MULHLU ) {
+            _reg(tr);
+        }
+        _reg(tr);
+        _src(tr, mode, 1);
+        if ( op == DFVM_MULH || op == DFVM_MULHL || op == DFVM_MULHU
+             || op == DFVM_MULHLU ) {
+            _word(tr, _u8(tr));
+        }
+        break;
+    case DFVM_INC:
+    case DFVM_DEC:
+    case DFVM_NOT:
+    case DFVM_COMP:
+        mode = _u8(tr);
+        if ( mode != 0 ) {
+            tr->err = 1;
+        }
+        _handler(tr, _unops[op]);
+        _reg(tr);
+        _reg(tr);
+        break;
+    case DFVM_EXT:
+    case DFVM_EXTU:
+        _handler(tr, op == DFVM_EXT ? H_EXT : H_EXTU);
+        _reg(tr);
+        v = _u8(tr);
+        if ( v < 1 || v > 64 ) {
+            tr->err = 1;
+        }
+        _word(tr, 64 - v);
+        break;
+    case DFVM_LOAD:
+        _memop(tr, -1);
+        break;
+    case DFVM_STORE:
+        _memop(tr, _u8(tr));
+        break;
+    case DFVM_JMP:
+        _handler(tr, H_JMP);
+        _target(tr);
+        break;
+    case DFVM_BR:
+        mode = _u8(tr);
+        if ( mode & 1 ) {
+            /* Constant */
+            v = _leb(tr);
+            _handler(tr, H_JMP);
+            if ( v ) {
+                _target(tr);
+                _i32(tr);
+            } else {
+                _i32(tr);
+                _target(tr);
+            }
+            break;
+        }
+        _handler(tr, H_BR);
+        _reg(tr);
+        _target(tr);
+        _target(tr);
+        break;
+    case DFVM_RET:
+    case DFVM_YIELD:
+        /* The values of a yield are in the packet */
+        n = op == DFVM_RET ? _u8(tr) : 0;
+        mode = op == DFVM_RET ? _u8(tr) : 0;
+        if ( n > DFVM_MAX_RETS ) {
+            tr->err = 1;
+        }
+        _handler(tr, H_RET);
+        _word(tr, n);
+        for ( i = 0; i < n; i++ ) {
+            _word(tr, (mode >> i) & 1);
+            _src(tr, mode, i);
+        }
+        break;
+    case DFVM_DISPATCH:
+        _handler(tr, H_DISPATCH);
+        _reg(tr);
+        n = _u8(tr);
+        _word(tr, n);
+        for ( i = 0; i < n; i++ ) {
+            _target(tr);
+        }
+        break;
+    default:
+        tr->err = 1;
+    }
+}
+
+/*
+ * _translate -- translate the instructions of a function; the instructions
+ * are counted in the first pass, and written in the second pass
+ */
+static int
+_translate(dfvm_func_t *f, const uint8_t *s, size_t len,
+           const void *const *table)
+{
+    struct dfvm_tr tr;
+    size_t i;
+    int pass;
+
+    memset(&tr, 0, sizeof(struct dfvm_tr));
+    tr.s = s;
+    tr.len = len;
+    tr.nregs = f->nregs;
+    tr.table = table;
+    tr.map = malloc(sizeof(int) * (len + 1));
+    if ( tr.map == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i <= len; i++ ) {
+        tr.map[i] = -1;
+    }
+    for ( pass = 0; pass < 2; pass++ ) {
+        tr.pos = 0;
+        tr.n = 0;
+        while ( tr.pos < len && !tr.err ) {
+            tr.map[tr.pos] = tr.n;
+            _instr(&tr);
+        }
+        if ( tr.err ) {
+            break;
+        }
+        if ( pass == 0 ) {
+            tr.code = malloc(sizeof(dfvm_word_t) * (tr.n + 1));
+            if ( tr.code == NULL ) {
+                tr.err = 1;
+                break;
+            }
+        }
+    }
+    free(tr.map);
+    if ( tr.err ) {
+        free(tr.code);
+        return -1;
+    }
+    f->code = tr.code;
+    f->n = tr.n;
+
+    return 0;
+}
+
+/*
+ * _load -- load the function of the bytecode of the symbol
+ */
+static int
+_load(dfvm_func_t *f, const arch_code_t *code, const arch_sym_t *sym,
+      const void *const *table)
+{
+    const uint8_t *s;
+    size_t len;
+    size_t hdr;
+    int i;
+
+    if ( sym->pos < 0 || sym->size < 4
+         || (size_t)sym->pos + sym->size > code->text.size ) {
+        return -1;
+    }
+    s = code->text.s + sym->pos;
+    len = sym->size;
+    f->name = sym->label;
+    f->nregs = s[0] | (s[1] << 8);
+    f->nargs = s[2];
+    f->type = s[3];
+    hdr = 4 + 2 * f->nargs;
+    if ( hdr > len || f->nregs > DFVM_MAX_REGS ) {
+        return -1;
+    }
+    f->args = malloc(sizeof(int) * (f->nargs + 1));
+    if ( f->args == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < f->nargs; i++ ) {
+        f->args[i] = s[4 + 2 * i] | (s[5 + 2 * i] << 8);
+        if ( f->args[i] >= f->nregs ) {
+            return -1;
+        }
+    }
+
+    return _translate(f, s + hdr, len - hdr, table);
+}
+
+/*
+ * dfvm_new -- load the bytecode to a new virtual machine
+ */
+dfvm_t *
+dfvm_new(const arch_code_t *code)
+{
+    const void *const *table;
+    dfvm_t *vm;
+    int i;
+
+    if ( code->cpu != ARCH_CPU_DFVM ) {
+        return NULL;
+    }
+    vm = malloc(sizeof(dfvm_t));
+    if ( vm == NULL ) {
+        return NULL;
+    }
+    memset(vm, 0, sizeof(dfvm_t));
+    vm->funcs = malloc(sizeof(dfvm_func_t) * (code->sym.n + 1));
+    if ( vm->funcs == NULL ) {
+        free(vm);
+        return NULL;
+    }
+    _exec(NULL, NULL, NULL, &table);
+    for ( i = 0; i < code->sym.n; i++ ) {
+        if ( code->sym.syms[i].type != ARCH_SYM_FUNC ) {
+            continue;
+        }
+        memset(&vm->funcs[vm->nfuncs], 0, sizeof(dfvm_func_t));
+        if ( _load(&vm->funcs[vm->nfuncs], code, &code->sym.syms[i],
+                   table) < 0 ) {
+            free(vm->funcs[vm->nfuncs].args);
+            dfvm_delete(vm);
+            return NULL;
+        }
+        vm->nfuncs++;
+    }
+
+    return vm;
+}
+
+/*
+ * dfvm_delete -- delete the virtual machine
+ */
+void
+dfvm_delete(dfvm_t *vm)
+{
+    int i;
+
+    for ( i = 0; i < vm->nfuncs; i++ ) {
+        free(vm->funcs[i].args);
+        free(vm->funcs[i].code);
+    }
+    free(vm->funcs);
+    free(vm->stack.regs);
+    free(vm);
+}
+
+/*
+ * dfvm_func -- find the function of the name
+ */
+dfvm_func_t *
+dfvm_func(dfvm_t *vm, const char *name)
+{
+    int i;
+
+    for ( i = 0; i < vm->nfuncs; i++ ) {
+        if ( 0 == strcmp(vm->funcs[i].name, name) ) {
+            return &vm->funcs[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * dfvm_call -- call the function with the arguments on a new window of the
+ * registers, and return the number of the values returned to rets (at most
+ * DFVM_MAX_RETS), or -1 on the fault; a coroutine takes the frame as the
+ * first argument, and returns no value at a yield
+ */
+int
+dfvm_call(dfvm_t *vm, dfvm_func_t *f, const int64_t *args, int nargs,
+          int64_t *rets)
+{
+    int64_t vals[DFVM_MAX_RETS];
+    int64_t *regs;
+    size_t nsize;
+    int ret;
+    int i;
+
+    if ( nargs > f->nargs ) {
+        return -1;
+    }
+    if ( vm->stack.n + f->nregs > vm->stack.size ) {
+        nsize = vm->stack.size ? vm->stack.size : 1024;
+        while ( nsize < vm->stack.n + f->nregs ) {
+            nsize <<= 1;
+        }
+        if ( nsize > DFVM_STACK_SIZE ) {
+            return -1;
+        }
+        regs = realloc(vm->stack.regs, sizeof(int64_t) * nsize);
+        if ( regs == NULL ) {
+            return -1;
+        }
+        vm->stack.regs = regs;
+        vm->stack.size = nsize;
+    }
+    regs = vm->stack.regs + vm->stack.n;
+    memset(regs, 0, sizeof(int64_t) * f->nregs);
+    for ( i = 0; i < nargs; i++ ) {
+        regs[f->args[i]] = args[i];
+    }
+
+    vm->stack.n += f->nregs;
+    f->calls++;
+    ret = _exec(f->code, regs, vals, NULL);
+    vm->stack.n -= f->nregs;
+    for ( i = 0; i < ret; i++ ) {
+        rets[i] = vals[i];
+    }
+
+    return ret;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
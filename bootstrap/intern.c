@@ -0,0 +1,237 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "intern.h"
+#include <string.h>
+#include <pthread.h>
+
+/* Global interning table shared by the lexer, the parser, and the compiler;
+   the lock serializes the threads only while they share the table (see
+   intern_shared()) */
+static intern_table_t *_table = NULL;
+static pthread_mutex_t _lock = PTHREAD_MUTEX_INITIALIZER;
+static int _shared = 0;
+
+/*
+ * _hash -- compute the FNV-1a hash of a string
+ */
+static uint32_t
+_hash(const char *s, size_t len)
+{
+    uint32_t h;
+    size_t i;
+
+    h = 2166136261U;
+    for ( i = 0; i < len; i++ ) {
+        h ^= (uint8_t)s[i];
+        h *= 16777619U;
+    }
+
+    return h;
+}
+
+/*
+ * _table_new -- allocate a new interning table
+ */
+static intern_table_t *
+_table_new(void)
+{
+    intern_table_t *t;
+
+    t = malloc(sizeof(intern_table_t));
+    if ( NULL == t ) {
+        return NULL;
+    }
+    t->arena = arena_new();
+    if ( NULL == t->arena ) {
+        free(t);
+        return NULL;
+    }
+    t->buckets = malloc(sizeof(intern_ent_t *) * INTERN_INIT_SIZE);
+    if ( NULL == t->buckets ) {
+        arena_release(t->arena);
+        free(t);
+        return NULL;
+    }
+    memset(t->buckets, 0, sizeof(intern_ent_t *) * INTERN_INIT_SIZE);
+    t->size = INTERN_INIT_SIZE;
+    t->n = 0;
+
+    return t;
+}
+
+/*
+ * _resize -- double the number of buckets
+ */
+static int
+_resize(intern_table_t *t)
+{
+    intern_ent_t **buckets;
+    intern_ent_t *ent;
+    intern_ent_t *next;
+    size_t size;
+    size_t i;
+
+    size = t->size << 1;
+    buckets = malloc(sizeof(intern_ent_t *) * size);
+    if ( NULL == buckets ) {
+        return -1;
+    }
+    memset(buckets, 0, sizeof(intern_ent_t *) * size);
+
+    for ( i = 0; i < t->size; i++ ) {
+        ent = t->buckets[i];
+        while ( NULL != ent ) {
+            next = ent->next;
+            ent->next = buckets[ent->hash & (size - 1)];
+            buckets[ent->hash & (size - 1)] = ent;
+            ent = next;
+        }
+    }
+    free(t->buckets);
+    t->buckets = buckets;
+    t->size = size;
+
+    return 0;
+}
+
+/*
+ * _intern_n -- intern a string of len bytes (the lock must be held)
+ */
+static const char *
+_intern_n(const char *s, size_t len)
+{
+    intern_ent_t *ent;
+    uint32_t h;
+    size_t idx;
+    char *str;
+
+    if ( NULL == _table ) {
+        _table = _table_new();
+        if ( NULL == _table ) {
+            return NULL;
+        }
+    }
+
+    /* Search the table */
+    h = _hash(s, len);
+    idx = h & (_table->size - 1);
+    ent = _table->buckets[idx];
+    while ( NULL != ent ) {
+        if ( ent->hash == h && ent->len == len
+             && 0 == memcmp(ent->s, s, len) ) {
+            /* Found */
+            return ent->s;
+        }
+        ent = ent->next;
+    }
+
+    /* Not found, then add a new entry */
+    if ( _table->n >= _table->size ) {
+        if ( _resize(_table) < 0 ) {
+            return NULL;
+        }
+        idx = h & (_table->size - 1);
+    }
+    ent = arena_alloc(_table->arena, sizeof(intern_ent_t));
+    if ( NULL == ent ) {
+        return NULL;
+    }
+    str = arena_alloc(_table->arena, len + 1);
+    if ( NULL == str ) {
+        return NULL;
+    }
+    memcpy(str, s, len);
+    str[len] = '\0';
+    ent->s = str;
+    ent->len = len;
+    ent->hash = h;
+    ent->next = _table->buckets[idx];
+    _table->buckets[idx] = ent;
+    _table->n++;
+
+    return ent->s;
+}
+
+/*
+ * intern_n -- intern a string of len bytes and return the canonical pointer
+ */
+const char *
+intern_n(const char *s, size_t len)
+{
+    const char *ret;
+
+    if ( !_shared ) {
+        return _intern_n(s, len);
+    }
+    pthread_mutex_lock(&_lock);
+    ret = _intern_n(s, len);
+    pthread_mutex_unlock(&_lock);
+
+    return ret;
+}
+
+/*
+ * intern_shared -- start (non-zero) or stop (zero) serializing the interning
+ * by the lock; called by the thread creating the other threads interning
+ * strings before it creates them, and after it joins them all
+ */
+void
+intern_shared(int shared)
+{
+    _shared = shared;
+}
+
+/*
+ * intern -- intern a NUL-terminated string
+ */
+const char *
+intern(const char *s)
+{
+    return intern_n(s, strlen(s));
+}
+
+/*
+ * intern_release -- release all the interned strings
+ */
+void
+intern_release(void)
+{
+    pthread_mutex_lock(&_lock);
+    if ( NULL != _table ) {
+        arena_release(_table->arena);
+        free(_table->buckets);
+        free(_table);
+        _table = NULL;
+    }
+    pthread_mutex_unlock(&_lock);
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,97 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _INTERN_H
+#define _INTERN_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "arena.h"
+
+#define INTERN_INIT_SIZE    1024
+
+/*
+ * Interned string entry
+ */
+typedef struct _intern_ent intern_ent_t;
+struct _intern_ent {
+    const char *s;
+    size_t len;
+    uint32_t hash;
+    intern_ent_t *next;
+};
+
+/*
+ * String interning table; each distinct string is stored once in the arena so
+ * that interned strings can be compared by their pointers.
+ */
+typedef struct {
+    arena_t *arena;
+    size_t n;
+    size_t size;
+    intern_ent_t **buckets;
+} intern_table_t;
+
+/*
+ * intern_hash -- hash an interned string by its pointer; tables keyed by
+ * interned strings use this instead of rehashing the characters
+ */
+static __inline__ size_t
+intern_hash(const char *s)
+{
+    uint64_t h;
+
+    h = (uint64_t)(uintptr_t)s;
+    h = (h >> 4) * 0x9e3779b97f4a7c15ULL;
+
+    return (size_t)(h >> 32);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* intern.c */
+const char *
+intern(const char *);
+const char *
+intern_n(const char *, size_t);
+void
+intern_release(void);
+void
+intern_shared(int);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _INTERN_H */
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -42,6 +42,29 @@ ir_object_new(void)
     return obj;
 }
 
+/*
+ * ir_object_delete -- delete an object and the functions in it
+ */
+void
+ir_object_delete(ir_object_t *obj)
+{
+    ir_func_t *f;
+    ir_func_t *nf;
+    size_t i;
+
+    f = obj->funcs;
+    while ( f != NULL ) {
+        nf = f->next;
+        ir_func_delete(f);
+        f = nf;
+    }
+    for ( i = 0; i < obj->data.used; i++ ) {
+        free(obj->data.entries[i].d);
+    }
+    free(obj->data.entries);
+    free(obj);
+}
+
 /*
  * ir_func_new -- allocate a new function
  */
@@ -60,46 +83,447 @@ ir_func_new(void)
 }
 
 /*
- * ir_instr_new -- allocate a new instruction
+ * ir_func_delete -- delete a function; all the instructions, blocks, and
+ * registers are released at once
+ */
+void
+ir_func_delete(ir_func_t *func)
+{
+    size_t i;
+
+    for ( i = 0; i < func->block.n; i++ ) {
+        free(func->block.blocks[i].pred.blocks);
+    }
+    free(func->rpo.blocks);
+    if ( func->arena != NULL ) {
+        arena_release(func->arena);
+    }
+    free(func->instr.instrs);
+    free(func->block.blocks);
+    free(func->reg.regs);
+    free(func);
+}
+
+/*
+ * _grow -- double the capacity of an array of a function
+ */
+static int
+_grow(void **ptr, size_t *size, size_t elemsize)
+{
+    size_t nsize;
+    void *nptr;
+
+    nsize = *size ? *size * 2 : IR_FUNC_INIT_SIZE;
+    nptr = realloc(*ptr, elemsize * nsize);
+    if ( nptr == NULL ) {
+        return -1;
+    }
+    *ptr = nptr;
+    *size = nsize;
+
+    return 0;
+}
+
+/*
+ * ir_func_reg_new -- allocate a new virtual register and return its index
+ */
+int
+ir_func_reg_new(ir_func_t *func, ir_reg_type_t type, const char *id)
+{
+    ir_reg_t *reg;
+
+    if ( func->reg.n >= func->reg.size ) {
+        if ( _grow((void **)&func->reg.regs, &func->reg.size,
+                   sizeof(ir_reg_t)) < 0 ) {
+            return -1;
+        }
+    }
+    reg = &func->reg.regs[func->reg.n];
+    reg->type = type;
+    reg->assigned = 0;
+    reg->id = id;
+    reg->arg = -1;
+    reg->ret = -1;
+    reg->hreg = -1;
+    reg->slot = -1;
+
+    return func->reg.n++;
+}
+
+/*
+ * ir_func_block_new -- allocate a new empty block and return its index
+ */
+int
+ir_func_block_new(ir_func_t *func)
+{
+    ir_block_t *b;
+
+    if ( func->block.n >= func->block.size ) {
+        if ( _grow((void **)&func->block.blocks, &func->block.size,
+                   sizeof(ir_block_t)) < 0 ) {
+            return -1;
+        }
+    }
+    b = &func->block.blocks[func->block.n];
+    b->head = -1;
+    b->tail = -1;
+    b->ninstrs = 0;
+    b->nsuccs = 0;
+    b->succs[0] = -1;
+    b->succs[1] = -1;
+    b->pred.n = 0;
+    b->pred.size = 0;
+    b->pred.blocks = NULL;
+    b->rpo = -1;
+    b->idom = -1;
+
+    return func->block.n++;
+}
+
+/*
+ * _instr_new -- copy an instruction to a new slot of the instruction array;
+ * the operands are copied to the arena of the function
+ */
+static int
+_instr_new(ir_func_t *func, const ir_instr_t *instr)
+{
+    ir_operand_t *operands;
+    size_t size;
+
+    operands = NULL;
+    if ( instr->noperands > 0 ) {
+        if ( func->arena == NULL ) {
+            func->arena = arena_new();
+            if ( func->arena == NULL ) {
+                return -1;
+            }
+        }
+        size = sizeof(ir_operand_t) * instr->noperands;
+        operands = arena_alloc(func->arena, size);
+        if ( operands == NULL ) {
+            return -1;
+        }
+        memcpy(operands, instr->operands, size);
+    }
+    if ( func->instr.n >= func->instr.size ) {
+        if ( _grow((void **)&func->instr.instrs, &func->instr.size,
+                   sizeof(ir_instr_t)) < 0 ) {
+            return -1;
+        }
+    }
+    memcpy(&func->instr.instrs[func->instr.n], instr, sizeof(ir_instr_t));
+    func->instr.instrs[func->instr.n].operands = operands;
+
+    return func->instr.n++;
+}
+
+/*
+ * _link -- link an instruction between prev and next in a block
+ */
+static void
+_link(ir_func_t *func, int block, int i, int prev, int next)
+{
+    ir_instr_t *instrs;
+    ir_block_t *b;
+
+    instrs = func->instr.instrs;
+    b = &func->block.blocks[block];
+    instrs[i].block = block;
+    instrs[i].prev = prev;
+    instrs[i].next = next;
+    if ( prev >= 0 ) {
+        instrs[prev].next = i;
+    } else {
+        b->head = i;
+    }
+    if ( next >= 0 ) {
+        instrs[next].prev = i;
+    } else {
+        b->tail = i;
+    }
+    b->ninstrs++;
+}
+
+/*
+ * ir_func_compact -- rearrange the instruction array so that the instructions
+ * of each block are contiguous in the block order, and drop the removed ones
+ */
+int
+ir_func_compact(ir_func_t *func)
+{
+    ir_instr_t *instrs;
+    size_t n;
+    size_t size;
+    size_t b;
+    int i;
+    int j;
+
+    size = func->instr.size;
+    instrs = malloc(sizeof(ir_instr_t) * (size > 0 ? size : 1));
+    if ( instrs == NULL ) {
+        return -1;
+    }
+    n = 0;
+    for ( b = 0; b < func->block.n; b++ ) {
+        i = func->block.blocks[b].head;
+        if ( i < 0 ) {
+            continue;
+        }
+        func->block.blocks[b].head = n;
+        while ( i >= 0 ) {
+            j = func->instr.instrs[i].next;
+            memcpy(&instrs[n], &func->instr.instrs[i], sizeof(ir_instr_t));
+            instrs[n].prev = func->block.blocks[b].head == (int)n ? -1 : n - 1;
+            instrs[n].next = j >= 0 ? n + 1 : -1;
+            n++;
+            i = j;
+        }
+        func->block.blocks[b].tail = n - 1;
+    }
+    free(func->instr.instrs);
+    func->instr.instrs = instrs;
+    func->instr.n = n;
+
+    return 0;
+}
+
+/*
+ * ir_instr_init -- initialize an instruction (not linked to any block) on the
+ * operand buffer of the caller; the operands are copied when the instruction
+ * is added to a function
  */
 ir_instr_t *
-ir_instr_new(void)
+ir_instr_init(ir_instr_t *instr, ir_opcode_t opcode, ir_operand_t *operands)
 {
-    ir_instr_t *i;
+    memset(instr, 0, sizeof(ir_instr_t));
+    instr->opcode = opcode;
+    instr->operands = operands;
+    instr->result.n = 0;
+    instr->result.reg[0] = -1;
+    instr->result.reg[1] = -1;
+    instr->noperands = 0;
+    instr->block = -1;
+    instr->prev = -1;
+    instr->next = -1;
 
-    i = malloc(sizeof(ir_instr_t));
-    if ( i == NULL ) {
-        return NULL;
+    return instr;
+}
+
+/*
+ * ir_instr_at -- get the instruction at the index; the pointer is valid until
+ * the next insertion to the function
+ */
+ir_instr_t *
+ir_instr_at(ir_func_t *func, int i)
+{
+    return &func->instr.instrs[i];
+}
+
+/*
+ * ir_block_append -- append a copy of the instruction to the block and return
+ * its index
+ */
+int
+ir_block_append(ir_func_t *func, int block, const ir_instr_t *instr)
+{
+    int i;
+
+    i = _instr_new(func, instr);
+    if ( i < 0 ) {
+        return -1;
     }
-    memset(i, 0, sizeof(ir_instr_t));
+    _link(func, block, i, func->block.blocks[block].tail, -1);
 
     return i;
 }
 
 /*
- * ir_instr_delete -- delete an instruction
+ * ir_instr_insert_before -- insert a copy of the instruction before the
+ * instruction at pos and return its index
  */
-void
-ir_instr_delete(ir_instr_t *i)
+int
+ir_instr_insert_before(ir_func_t *func, int pos, const ir_instr_t *instr)
 {
-    free(i);
+    ir_instr_t *p;
+    int i;
+
+    i = _instr_new(func, instr);
+    if ( i < 0 ) {
+        return -1;
+    }
+    p = &func->instr.instrs[pos];
+    _link(func, p->block, i, p->prev, pos);
+
+    return i;
 }
 
 /*
- * ir_reg_init -- initialize a new register
+ * ir_instr_insert_after -- insert a copy of the instruction after the
+ * instruction at pos and return its index
  */
-ir_reg_t *
-ir_reg_init(ir_reg_t *reg)
+int
+ir_instr_insert_after(ir_func_t *func, int pos, const ir_instr_t *instr)
 {
-    return reg;
+    ir_instr_t *p;
+    int i;
+
+    i = _instr_new(func, instr);
+    if ( i < 0 ) {
+        return -1;
+    }
+    p = &func->instr.instrs[pos];
+    _link(func, p->block, i, pos, p->next);
+
+    return i;
 }
 
 /*
- * ir_reg_release -- destruct a register
+ * ir_instr_remove -- unlink the instruction from its block; the slot is
+ * reclaimed by ir_func_compact()
  */
 void
-ir_reg_release(ir_reg_t *reg)
+ir_instr_remove(ir_func_t *func, int pos)
+{
+    ir_instr_t *instrs;
+    ir_block_t *b;
+    ir_instr_t *p;
+
+    instrs = func->instr.instrs;
+    p = &instrs[pos];
+    if ( p->block < 0 ) {
+        /* Already removed */
+        return;
+    }
+    b = &func->block.blocks[p->block];
+    if ( p->prev >= 0 ) {
+        instrs[p->prev].next = p->next;
+    } else {
+        b->head = p->next;
+    }
+    if ( p->next >= 0 ) {
+        instrs[p->next].prev = p->prev;
+    } else {
+        b->tail = p->prev;
+    }
+    b->ninstrs--;
+    p->block = -1;
+    p->prev = -1;
+    p->next = -1;
+}
+
+/*
+ * ir_block_first -- get the first instruction of the block, or -1
+ */
+int
+ir_block_first(ir_func_t *func, int block)
+{
+    return func->block.blocks[block].head;
+}
+
+/*
+ * ir_block_last -- get the last instruction of the block, or -1
+ */
+int
+ir_block_last(ir_func_t *func, int block)
+{
+    return func->block.blocks[block].tail;
+}
+
+/*
+ * ir_instr_next -- get the next instruction in the block, or -1
+ */
+int
+ir_instr_next(ir_func_t *func, int i)
+{
+    return func->instr.instrs[i].next;
+}
+
+/*
+ * ir_instr_prev -- get the previous instruction in the block, or -1
+ */
+int
+ir_instr_prev(ir_func_t *func, int i)
 {
+    return func->instr.instrs[i].prev;
+}
+
+/*
+ * ir_operand_reg -- initialize a register operand
+ */
+ir_operand_t *
+ir_operand_reg(ir_operand_t *op, int reg)
+{
+    memset(op, 0, sizeof(ir_operand_t));
+    op->type = OPERAND_TYPE_REG;
+    op->u.reg = reg;
+
+    return op;
+}
+
+/*
+ * ir_operand_imm -- initialize an immediate operand
+ */
+ir_operand_t *
+ir_operand_imm(ir_operand_t *op, ir_imm_type_t type, uint64_t v)
+{
+    memset(op, 0, sizeof(ir_operand_t));
+    op->type = OPERAND_TYPE_IMM;
+    ir_imm_init(&op->u.imm, type);
+    op->u.imm.u.u64 = v;
+
+    return op;
+}
+
+/*
+ * ir_operand_block -- initialize a block operand (a branch target)
+ */
+ir_operand_t *
+ir_operand_block(ir_operand_t *op, int block)
+{
+    memset(op, 0, sizeof(ir_operand_t));
+    op->type = OPERAND_TYPE_BLOCK;
+    op->u.block = block;
+
+    return op;
+}
+
+/*
+ * ir_operand_ref -- initialize a reference operand of base + index * scale +
+ * disp; the index is -1 if none
+ */
+ir_operand_t *
+ir_operand_ref(ir_operand_t *op, int base, int index, int scale, int64_t disp)
+{
+    memset(op, 0, sizeof(ir_operand_t));
+    op->type = OPERAND_TYPE_REF;
+    op->u.ref.base = base;
+    op->u.ref.index = index;
+    op->u.ref.scale = scale;
+    op->u.ref.disp = disp;
+
+    return op;
+}
+
+/*
+ * ir_operand_use -- get the k-th register read by the operand, or NULL if no
+ * more; a reference has two (base and index), which may be -1
+ */
+int *
+ir_operand_use(ir_operand_t *op, int k)
+{
+    switch ( op->type ) {
+    case OPERAND_TYPE_REG:
+        return k == 0 ? &op->u.reg : NULL;
+    case OPERAND_TYPE_REF:
+        if ( k == 0 ) {
+            return &op->u.ref.base;
+        } else if ( k == 1 ) {
+            return &op->u.ref.index;
+        }
+        return NULL;
+    default:
+        return NULL;
+    }
 }
 
 /*
@@ -126,29 +550,70 @@ ir_imm_release(ir_imm_t *imm)
 }
 
 /*
- * ir_operand_new -- allocate a new operand
+ * ir_reg_type_bits -- get the width of the values of a register type in bits
  */
-ir_operand_t *
-ir_operand_new(void)
+int
+ir_reg_type_bits(ir_reg_type_t type)
 {
-    ir_operand_t *o;
-
-    o = malloc(sizeof(ir_operand_t));
-    if ( o == NULL ) {
-        return NULL;
+    switch ( type ) {
+    case IR_REG_I8:
+    case IR_REG_U8:
+    case IR_REG_BOOL:
+        return 8;
+    case IR_REG_I16:
+    case IR_REG_U16:
+        return 16;
+    case IR_REG_I32:
+    case IR_REG_U32:
+    case IR_REG_FP32:
+        return 32;
+    default:
+        return 64;
     }
-    memset(o, 0, sizeof(ir_operand_t));
+}
 
-    return o;
+/*
+ * ir_reg_type_unsigned -- check if the values of a register type are
+ * unsigned; pointers and booleans are
+ */
+int
+ir_reg_type_unsigned(ir_reg_type_t type)
+{
+    switch ( type ) {
+    case IR_REG_PTR:
+    case IR_REG_BOOL:
+    case IR_REG_U8:
+    case IR_REG_U16:
+    case IR_REG_U32:
+    case IR_REG_U64:
+        return 1;
+    default:
+        return 0;
+    }
 }
 
 /*
- * ir_operand_delete -- delete an operand
+ * ir_reg_type_ext -- get the value that a register of the type holds; the
+ * value is truncated to the width, and then sign- or zero-extended, or is
+ * tested for a boolean
  */
-void
-ir_operand_delete(ir_operand_t *o)
+int64_t
+ir_reg_type_ext(ir_reg_type_t type, int64_t v)
 {
-    free(o);
+    int bits;
+
+    if ( type == IR_REG_BOOL ) {
+        return v != 0;
+    }
+    bits = ir_reg_type_bits(type);
+    if ( bits >= 64 ) {
+        return v;
+    }
+    if ( ir_reg_type_unsigned(type) ) {
+        return (int64_t)((uint64_t)v & ((UINT64_C(1) << bits) - 1));
+    }
+
+    return (int64_t)((uint64_t)v << (64 - bits)) >> (64 - bits);
 }
 
 /*
@@ -161,10 +626,39 @@ ir_num_results(ir_opcode_t opcode)
 
     switch ( opcode ) {
     case IR_OPCODE_STORE:
+    case IR_OPCODE_RET:
+    case IR_OPCODE_YIELD:
+    case IR_OPCODE_JMP:
+    case IR_OPCODE_BR:
         cnt = 0;
         break;
+    case IR_OPCODE_PHI:
     case IR_OPCODE_ALLOCA:
     case IR_OPCODE_LOAD:
+    case IR_OPCODE_MOV:
+    case IR_OPCODE_ADD:
+    case IR_OPCODE_SUB:
+    case IR_OPCODE_MUL:
+    case IR_OPCODE_DIV:
+    case IR_OPCODE_MOD:
+    case IR_OPCODE_MULH:
+    case IR_OPCODE_INC:
+    case IR_OPCODE_DEC:
+    case IR_OPCODE_NOT:
+    case IR_OPCODE_COMP:
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_AND:
+    case IR_OPCODE_OR:
+    case IR_OPCODE_XOR:
+    case IR_OPCODE_LSHIFT:
+    case IR_OPCODE_RSHIFT:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
         cnt = 1;
         break;
     default:
@@ -175,7 +669,8 @@ ir_num_results(ir_opcode_t opcode)
 }
 
 /*
- * ir_num_operands -- return the number of operands for the specified opcode
+ * ir_num_operands -- return the number of operands for the specified opcode;
+ * -1 if the number is variable (e.g., return)
  */
 int
 ir_num_operands(ir_opcode_t opcode)
@@ -183,18 +678,41 @@ ir_num_operands(ir_opcode_t opcode)
     int cnt;
 
     switch ( opcode ) {
+    case IR_OPCODE_ALLOCA:
+        cnt = 0;
+        break;
+    case IR_OPCODE_LOAD:
+    case IR_OPCODE_MOV:
+    case IR_OPCODE_JMP:
     case IR_OPCODE_INC:
     case IR_OPCODE_DEC:
+    case IR_OPCODE_NOT:
+    case IR_OPCODE_COMP:
         cnt = 1;
         break;
-    case IR_OPCODE_MOV:
-        cnt = 2;
-        break;
+    case IR_OPCODE_STORE:
     case IR_OPCODE_ADD:
     case IR_OPCODE_SUB:
     case IR_OPCODE_MUL:
     case IR_OPCODE_DIV:
     case IR_OPCODE_MOD:
+    case IR_OPCODE_MULH:
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_AND:
+    case IR_OPCODE_OR:
+    case IR_OPCODE_XOR:
+    case IR_OPCODE_LSHIFT:
+    case IR_OPCODE_RSHIFT:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        cnt = 2;
+        break;
+    case IR_OPCODE_BR:
         cnt = 3;
         break;
     default:
@@ -24,6 +24,7 @@
 #ifndef _IR_H
 #define _IR_H
 
+#include "arena.h"
 #include <stdint.h>
 #include <unistd.h>
 
@@ -35,35 +36,40 @@ typedef enum {
     IR_OPCODE_ALLOCA,   /* %reg = alloca <type> */
     IR_OPCODE_LOAD,     /* %reg = load <type>* <ptr> */
     IR_OPCODE_STORE,    /* store <type> <value> <type>* <ptr> */
-    IR_OPCODE_MOV,      /* src,dst */
+    IR_OPCODE_MOV,      /* %dst = src */
     /* Arithmetic operations */
-    IR_OPCODE_ADD,      /* %reg = %op1,%op2 */
+    IR_OPCODE_ADD,      /* %reg = op1,op2 */
     IR_OPCODE_SUB,      /* %reg = op1,op2 */
     IR_OPCODE_MUL,      /* %reg = op1,op2 */
-    IR_OPCODE_DIV,      /* %q,%r = op1,op2 */
-    IR_OPCODE_MOD,      /* %r,%q = op1,op2 */
-    IR_OPCODE_INC,      /* op */
-    IR_OPCODE_DEC,      /* op */
+    IR_OPCODE_DIV,      /* %q[,%r] = op1,op2 */
+    IR_OPCODE_MOD,      /* %r[,%q] = op1,op2 */
+    IR_OPCODE_MULH,     /* %hi[,%lo] = op1,op2 (signed) */
+    IR_OPCODE_INC,      /* %reg = op */
+    IR_OPCODE_DEC,      /* %reg = op */
     /* Logical operations */
-    IR_OPCODE_NOT,      /* op,dst */
-    IR_OPCODE_COMP,     /* op,dst */
-    IR_OPCODE_LAND,     /* op1,op2,dst */
-    IR_OPCODE_LOR,      /* op1,op2,dst */
+    IR_OPCODE_NOT,      /* %reg = op */
+    IR_OPCODE_COMP,     /* %reg = op */
+    IR_OPCODE_LAND,     /* %reg = op1,op2 */
+    IR_OPCODE_LOR,      /* %reg = op1,op2 */
     /* Bit-wise operations */
-    IR_OPCODE_AND,      /* op1,op2,dst */
-    IR_OPCODE_OR,       /* op1,op2,dst */
-    IR_OPCODE_XOR,      /* op1,op2,dst */
-    IR_OPCODE_LSHIFT,   /* op1,op2,dst */
-    IR_OPCODE_RSHIFT,   /* op1,op2,dst */
+    IR_OPCODE_AND,      /* %reg = op1,op2 */
+    IR_OPCODE_OR,       /* %reg = op1,op2 */
+    IR_OPCODE_XOR,      /* %reg = op1,op2 */
+    IR_OPCODE_LSHIFT,   /* %reg = op1,op2 */
+    IR_OPCODE_RSHIFT,   /* %reg = op1,op2 */
     /* Controls */
-    IR_OPCODE_CMP_EQ,   /* op1,op2,dst */
-    IR_OPCODE_CMP_NEQ,  /* op1,op2,dst */
-    IR_OPCODE_CMP_GT,   /* op1,op2,dst */
-    IR_OPCODE_CMP_LT,   /* op1,op2,dst */
-    IR_OPCODE_CMP_GEQ,  /* op1,op2,dst */
-    IR_OPCODE_CMP_LEQ,  /* op1,op2,dst */
-    IR_OPCODE_RET,      /* no operands */
-    IR_OPCODE_YIELD,    /* no operands */
+    IR_OPCODE_CMP_EQ,   /* %reg = op1,op2 */
+    IR_OPCODE_CMP_NEQ,  /* %reg = op1,op2 */
+    IR_OPCODE_CMP_GT,   /* %reg = op1,op2 */
+    IR_OPCODE_CMP_LT,   /* %reg = op1,op2 */
+    IR_OPCODE_CMP_GEQ,  /* %reg = op1,op2 */
+    IR_OPCODE_CMP_LEQ,  /* %reg = op1,op2 */
+    IR_OPCODE_RET,      /* return values */
+    IR_OPCODE_YIELD,    /* [%fp =] yield values (see ir_coro.c) */
+    IR_OPCODE_JMP,      /* jmp <block> */
+    IR_OPCODE_BR,       /* br op, <then-block>, <else-block> */
+    /* SSA */
+    IR_OPCODE_PHI,      /* %reg = phi op1,...,opN (one for each predecessor) */
 } ir_opcode_t;
 
 /*
@@ -87,6 +93,7 @@ typedef enum {
     OPERAND_TYPE_REG,
     OPERAND_TYPE_REF,
     OPERAND_TYPE_IMM,
+    OPERAND_TYPE_BLOCK,
 } ir_operand_type_t;
 
 /*
@@ -126,7 +133,9 @@ typedef enum {
 } ir_data_type_t;
 
 /*
- * Register type
+ * Register type; a register holds the value of its type truncated to the
+ * width, and sign-extended for the signed integers or zero-extended for the
+ * others (see ir_reg_type_ext())
  */
 typedef enum {
     IR_REG_UNDEF = -1,
@@ -138,15 +147,24 @@ typedef enum {
     IR_REG_FP32,
     IR_REG_FP64,
     IR_REG_BOOL,
+    IR_REG_U8,
+    IR_REG_U16,
+    IR_REG_U32,
+    IR_REG_U64,
 } ir_reg_type_t;
 
 /*
- * Register
+ * Virtual register; an entry of the register table of a function.  Operands
+ * and results refer to registers by their indices to the table.
  */
 typedef struct {
     ir_reg_type_t type;
     int assigned;
-    char *id;
+    const char *id;     /* Variable name (interned), or NULL if temporary */
+    int arg;            /* Index of the argument, or -1 */
+    int ret;            /* Index of the return value, or -1 */
+    int hreg;           /* Allocated (or fixed) physical register, or -1 */
+    int slot;           /* Spill slot, or -1 */
 } ir_reg_t;
 
 /*
@@ -168,11 +186,11 @@ typedef struct {
 } ir_imm_t;
 
 /*
- * Reference (pointer)
+ * Reference (pointer); registers are the indices to the register table, or -1
  */
 typedef struct {
-    ir_reg_t base;
-    ir_reg_t index;
+    int base;
+    int index;
     int scale;
     int64_t disp;
 } ir_ref_t;
@@ -183,9 +201,10 @@ typedef struct {
 typedef struct {
     ir_operand_type_t type;
     union {
-        ir_reg_t reg;
+        int reg;
         ir_imm_t imm;
         ir_ref_t ref;
+        int block;
     } u;
 } ir_operand_t;
 
@@ -194,45 +213,50 @@ typedef struct {
  */
 typedef struct {
     int n;
-    ir_reg_t reg[2];
+    int reg[2];
 } ir_result_t;
 
 /*
- * Instruction
+ * Instruction; instructions of a function are stored in an array, and the
+ * instructions of a block are linked by their indices to the array.  The
+ * operands are stored out of line in the arena of the function, so that an
+ * instruction takes any number of them (e.g., a phi function of many
+ * predecessors); they may be rewritten in place, but not increased.
  */
 typedef struct {
     ir_opcode_t opcode;
     ir_result_t result;
-    ir_operand_t operands[4];
+    int noperands;
+    ir_operand_t *operands;
+    /* Block that the instruction belongs to, or -1 if removed */
+    int block;
+    /* Previous and next instructions in the block, or -1 */
+    int prev;
+    int next;
 } ir_instr_t;
 
-typedef struct _instr_ent ir_instr_ent_t;
-typedef struct _block ir_block_t;
 /*
- * Instruction entry
- */
-struct _instr_ent {
-    ir_instr_t inst;
-    ir_instr_ent_t *next;
-};
-
-/*
- * Label
+ * Block; every block ends with a terminator (jmp, br, or ret), which gives
+ * the successors of the block
  */
 typedef struct {
-    char *label;
-    ir_block_t *block;
-} ir_label_t;
-
-/*
- * Block
- */
-struct _block {
-    ir_label_t *label;
-    size_t ninstr;
-    /* Pointer to the insstruction */
-    ir_instr_ent_t *instrs;
-};
+    /* First and last instructions, or -1 if empty */
+    int head;
+    int tail;
+    size_t ninstrs;
+    /* Control flow graph (built by ir_func_cfg()) */
+    int nsuccs;
+    int succs[2];
+    struct {
+        size_t n;
+        size_t size;
+        int *blocks;
+    } pred;
+    /* Index in the reverse postorder, or -1 if unreachable */
+    int rpo;
+    /* Immediate dominator (built by ir_func_dom()), or -1 for the entry */
+    int idom;
+} ir_block_t;
 
 /*
  * Type of function
@@ -243,14 +267,62 @@ typedef enum {
 } ir_func_type_t;
 
 /*
- * Function / Coroutine
+ * Function / Coroutine; the frame of a coroutine is the state (0 at the start,
+ * or k to resume from the k-th yield), the pointer to the packet that a yield
+ * writes the values to, and the slots, one for each value live across a yield
  */
+#define IR_FUNC_INIT_SIZE   64
+#define IR_FRAME_SLOT_SIZE  8
+#define IR_FRAME_STATE      0
+#define IR_FRAME_PACKET     8
+#define IR_FRAME_SLOTS      16
 typedef struct _func ir_func_t;
 struct _func {
-    char *name;
+    const char *name;
     ir_func_type_t type;
-    size_t nblocks;
-    ir_block_t *blocks;
+    /* Operands of the instructions */
+    arena_t *arena;
+    /* Instructions */
+    struct {
+        size_t n;
+        size_t size;
+        ir_instr_t *instrs;
+    } instr;
+    /* Blocks; the first block is the entry */
+    struct {
+        size_t n;
+        size_t size;
+        ir_block_t *blocks;
+    } block;
+    /* Registers */
+    struct {
+        size_t n;
+        size_t size;
+        ir_reg_t *regs;
+    } reg;
+    /* Reachable blocks in the reverse postorder */
+    struct {
+        size_t n;
+        int *blocks;
+    } rpo;
+    /* Non-zero if the function is in the SSA form */
+    int ssa;
+    /* Number of the spill slots */
+    int nslots;
+    /* Dead code removed by ir_func_dce() */
+    struct {
+        int copies;
+        int instrs;
+        int blocks;
+    } dead;
+    /* Frame of a coroutine (built by ir_func_coroutine()); the number of the
+       states (the start and the yields), the size in bytes, and the number of
+       the values of a packet */
+    struct {
+        int states;
+        int size;
+        int packet;
+    } frame;
     ir_func_t *next;
 };
 
@@ -287,30 +359,104 @@ extern "C" {
 /* ir.c */
 ir_object_t *
 ir_object_new(void);
+void
+ir_object_delete(ir_object_t *);
 ir_func_t *
 ir_func_new(void);
-ir_instr_t *
-ir_instr_new(void);
 void
-ir_instr_delete(ir_instr_t *);
-ir_reg_t *
-ir_reg_init(ir_reg_t *);
+ir_func_delete(ir_func_t *);
+int
+ir_func_reg_new(ir_func_t *, ir_reg_type_t, const char *);
+int
+ir_func_block_new(ir_func_t *);
+int
+ir_func_compact(ir_func_t *);
+ir_instr_t *
+ir_instr_init(ir_instr_t *, ir_opcode_t, ir_operand_t *);
+ir_instr_t *
+ir_instr_at(ir_func_t *, int);
+int
+ir_block_append(ir_func_t *, int, const ir_instr_t *);
+int
+ir_instr_insert_before(ir_func_t *, int, const ir_instr_t *);
+int
+ir_instr_insert_after(ir_func_t *, int, const ir_instr_t *);
 void
-ir_reg_release(ir_reg_t *);
+ir_instr_remove(ir_func_t *, int);
+int
+ir_block_first(ir_func_t *, int);
+int
+ir_block_last(ir_func_t *, int);
+int
+ir_instr_next(ir_func_t *, int);
+int
+ir_instr_prev(ir_func_t *, int);
+ir_operand_t *
+ir_operand_reg(ir_operand_t *, int);
+ir_operand_t *
+ir_operand_imm(ir_operand_t *, ir_imm_type_t, uint64_t);
+ir_operand_t *
+ir_operand_block(ir_operand_t *, int);
+ir_operand_t *
+ir_operand_ref(ir_operand_t *, int, int, int, int64_t);
+int *
+ir_operand_use(ir_operand_t *, int);
 ir_imm_t *
 ir_imm_init(ir_imm_t *, ir_imm_type_t type);
 void
 ir_imm_release(ir_imm_t *);
-ir_operand_t *
-ir_operand_new(void);
-void
-ir_operand_delete(ir_operand_t *);
+int
+ir_reg_type_bits(ir_reg_type_t);
+int
+ir_reg_type_unsigned(ir_reg_type_t);
+int64_t
+ir_reg_type_ext(ir_reg_type_t, int64_t);
 int
 ir_num_results(ir_opcode_t);
 int
 ir_num_operands(ir_opcode_t);
 
+/* ir_cfg.c */
+int
+ir_func_cfg(ir_func_t *);
+int
+ir_func_dom(ir_func_t *);
+int
+ir_block_pred_index(ir_func_t *, int, int);
+int
+ir_block_dominates(ir_func_t *, int, int);
+
+/* ir_ssa.c */
+int
+ir_func_to_ssa(ir_func_t *);
+int
+ir_func_from_ssa(ir_func_t *);
+
+/* ir_sccp.c */
+int
+ir_func_sccp(ir_func_t *);
+
+/* ir_gvn.c */
+int
+ir_func_gvn(ir_func_t *);
+
+/* ir_divmod.c */
+int
+ir_func_divmod(ir_func_t *);
+
+/* ir_dce.c */
+int
+ir_func_dce(ir_func_t *);
+
+/* ir_coro.c */
+int
+ir_func_coroutine(ir_func_t *);
+
 /* ir_debug.c */
+const char *
+ir_opcode_name(ir_opcode_t);
+int
+ir_print_func(ir_func_t *);
 int
 ir_print_code(ir_object_t *);
 
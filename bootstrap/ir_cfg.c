@@ -0,0 +1,289 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _pred_add -- add a predecessor to the block
+ */
+static int
+_pred_add(ir_block_t *b, int pred)
+{
+    size_t nsize;
+    int *blocks;
+
+    if ( b->pred.n >= b->pred.size ) {
+        nsize = b->pred.size ? b->pred.size * 2 : 2;
+        blocks = realloc(b->pred.blocks, sizeof(int) * nsize);
+        if ( blocks == NULL ) {
+            return -1;
+        }
+        b->pred.blocks = blocks;
+        b->pred.size = nsize;
+    }
+    b->pred.blocks[b->pred.n++] = pred;
+
+    return 0;
+}
+
+/*
+ * _succs -- resolve the successors of the block from its terminator
+ */
+static void
+_succs(ir_func_t *func, ir_block_t *b)
+{
+    ir_instr_t *t;
+
+    b->nsuccs = 0;
+    b->succs[0] = -1;
+    b->succs[1] = -1;
+    if ( b->tail < 0 ) {
+        return;
+    }
+    t = &func->instr.instrs[b->tail];
+    switch ( t->opcode ) {
+    case IR_OPCODE_JMP:
+        b->succs[0] = t->operands[0].u.block;
+        b->nsuccs = 1;
+        break;
+    case IR_OPCODE_BR:
+        b->succs[0] = t->operands[1].u.block;
+        b->succs[1] = t->operands[2].u.block;
+        b->nsuccs = 2;
+        break;
+    default:
+        /* No successor */
+        break;
+    }
+}
+
+/*
+ * ir_func_cfg -- build the control flow graph of the function; the blocks
+ * unreachable from the entry are emptied
+ */
+int
+ir_func_cfg(ir_func_t *func)
+{
+    ir_block_t *blocks;
+    ir_block_t *b;
+    int *stack;
+    int *next;
+    int *post;
+    size_t npost;
+    ssize_t sp;
+    size_t i;
+    int s;
+    int k;
+
+    blocks = func->block.blocks;
+    if ( func->block.n == 0 ) {
+        return 0;
+    }
+
+    /* Resolve the successors */
+    for ( i = 0; i < func->block.n; i++ ) {
+        _succs(func, &blocks[i]);
+        blocks[i].pred.n = 0;
+        blocks[i].rpo = -1;
+        blocks[i].idom = -1;
+    }
+
+    /* Depth-first search from the entry to compute the postorder */
+    stack = malloc(sizeof(int) * func->block.n * 3);
+    if ( stack == NULL ) {
+        return -1;
+    }
+    next = stack + func->block.n;
+    post = next + func->block.n;
+    memset(next, 0, sizeof(int) * func->block.n);
+    npost = 0;
+    sp = 0;
+    stack[0] = 0;
+    blocks[0].rpo = 0;      /* Mark visited */
+    while ( sp >= 0 ) {
+        b = &blocks[stack[sp]];
+        k = next[stack[sp]]++;
+        if ( k < b->nsuccs ) {
+            s = b->succs[k];
+            if ( blocks[s].rpo < 0 ) {
+                blocks[s].rpo = 0;
+                stack[++sp] = s;
+            }
+        } else {
+            post[npost++] = stack[sp--];
+        }
+    }
+
+    /* Reverse postorder */
+    free(func->rpo.blocks);
+    func->rpo.blocks = malloc(sizeof(int) * npost);
+    if ( func->rpo.blocks == NULL ) {
+        func->rpo.n = 0;
+        free(stack);
+        return -1;
+    }
+    func->rpo.n = npost;
+    for ( i = 0; i < npost; i++ ) {
+        func->rpo.blocks[i] = post[npost - i - 1];
+        blocks[post[npost - i - 1]].rpo = i;
+    }
+    free(stack);
+
+    /* Empty the unreachable blocks, and link the predecessors */
+    for ( i = 0; i < func->block.n; i++ ) {
+        b = &blocks[i];
+        if ( b->rpo < 0 ) {
+            while ( b->head >= 0 ) {
+                ir_instr_remove(func, b->head);
+            }
+            b->nsuccs = 0;
+            continue;
+        }
+        for ( k = 0; k < b->nsuccs; k++ ) {
+            if ( _pred_add(&blocks[b->succs[k]], i) < 0 ) {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _intersect -- find the nearest common dominator of two blocks
+ */
+static int
+_intersect(ir_block_t *blocks, int b1, int b2)
+{
+    while ( b1 != b2 ) {
+        while ( blocks[b1].rpo > blocks[b2].rpo ) {
+            b1 = blocks[b1].idom;
+        }
+        while ( blocks[b2].rpo > blocks[b1].rpo ) {
+            b2 = blocks[b2].idom;
+        }
+    }
+
+    return b1;
+}
+
+/*
+ * ir_func_dom -- compute the immediate dominators of the blocks with the
+ * iterative algorithm by Cooper, Harvey, and Kennedy; the control flow graph
+ * must have been built
+ */
+int
+ir_func_dom(ir_func_t *func)
+{
+    ir_block_t *blocks;
+    ir_block_t *b;
+    size_t i;
+    size_t k;
+    int changed;
+    int idom;
+    int p;
+
+    if ( func->rpo.n == 0 ) {
+        return 0;
+    }
+    blocks = func->block.blocks;
+    for ( i = 0; i < func->block.n; i++ ) {
+        blocks[i].idom = -1;
+    }
+
+    /* The entry is temporarily dominated by itself to stop the iteration */
+    blocks[func->rpo.blocks[0]].idom = func->rpo.blocks[0];
+    do {
+        changed = 0;
+        for ( i = 1; i < func->rpo.n; i++ ) {
+            b = &blocks[func->rpo.blocks[i]];
+            idom = -1;
+            for ( k = 0; k < b->pred.n; k++ ) {
+                p = b->pred.blocks[k];
+                if ( blocks[p].idom < 0 ) {
+                    /* Not processed yet */
+                    continue;
+                }
+                if ( idom < 0 ) {
+                    idom = p;
+                } else {
+                    idom = _intersect(blocks, p, idom);
+                }
+            }
+            if ( b->idom != idom ) {
+                b->idom = idom;
+                changed = 1;
+            }
+        }
+    } while ( changed );
+    blocks[func->rpo.blocks[0]].idom = -1;
+
+    return 0;
+}
+
+/*
+ * ir_block_pred_index -- get the index of pred in the predecessors of the
+ * block, or -1
+ */
+int
+ir_block_pred_index(ir_func_t *func, int block, int pred)
+{
+    ir_block_t *b;
+    size_t i;
+
+    b = &func->block.blocks[block];
+    for ( i = 0; i < b->pred.n; i++ ) {
+        if ( b->pred.blocks[i] == pred ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * ir_block_dominates -- check if block a dominates block b
+ */
+int
+ir_block_dominates(ir_func_t *func, int a, int b)
+{
+    while ( b >= 0 ) {
+        if ( a == b ) {
+            return 1;
+        }
+        b = func->block.blocks[b].idom;
+    }
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,528 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _bit_test -- test a bit of a bit set
+ */
+static int
+_bit_test(const uint64_t *bs, size_t i)
+{
+    return (bs[i / 64] >> (i % 64)) & 1;
+}
+
+/*
+ * _bit_set -- set a bit of a bit set
+ */
+static void
+_bit_set(uint64_t *bs, size_t i)
+{
+    bs[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+/*
+ * _bit_clear -- clear a bit of a bit set
+ */
+static void
+_bit_clear(uint64_t *bs, size_t i)
+{
+    bs[i / 64] &= ~((uint64_t)1 << (i % 64));
+}
+
+/*
+ * Context of the coroutine lowering
+ */
+typedef struct {
+    ir_func_t *func;
+    /* Bit sets of the registers (nwords words each) */
+    size_t nregs;
+    size_t nwords;
+    uint64_t *in;       /* Live at the entry of each block */
+    uint64_t *out;      /* Live at the exit of each block */
+    uint64_t *use;      /* Used before defined in each block */
+    uint64_t *def;      /* Defined in each block */
+    uint64_t *live;     /* Working set */
+    /* Yields in the order of the code, and the registers live across each */
+    struct {
+        int n;
+        int *pos;
+        uint64_t *across;
+    } yield;
+    /* Slot of each register in the frame, or -1 */
+    int *slots;
+    int nslots;
+    /* Number of the values of a packet */
+    int packet;
+    /* Frame pointer */
+    int fp;
+} coro_ctx_t;
+
+/*
+ * _liveness -- compute the registers live at the entry and the exit of each
+ * block
+ */
+static void
+_liveness(coro_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_block_t *b;
+    ir_instr_t *p;
+    uint64_t *use;
+    uint64_t *def;
+    uint64_t *out;
+    uint64_t v;
+    size_t nw;
+    size_t i;
+    size_t w;
+    int changed;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int s;
+
+    func = ctx->func;
+    nw = ctx->nwords;
+    memset(ctx->in, 0, sizeof(uint64_t) * nw * func->block.n * 4);
+
+    /* Registers used before defined, and defined in each block */
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        s = func->rpo.blocks[i];
+        use = ctx->use + nw * s;
+        def = ctx->def + nw * s;
+        for ( pos = func->block.blocks[s].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *r >= 0 && !_bit_test(def, *r) ) {
+                        _bit_set(use, *r);
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                _bit_set(def, p->result.reg[j]);
+            }
+        }
+    }
+
+    /* Solve the backward data-flow equations in the postorder */
+    do {
+        changed = 0;
+        for ( i = func->rpo.n; i > 0; i-- ) {
+            s = func->rpo.blocks[i - 1];
+            b = &func->block.blocks[s];
+            out = ctx->out + nw * s;
+            for ( j = 0; j < b->nsuccs; j++ ) {
+                for ( w = 0; w < nw; w++ ) {
+                    out[w] |= ctx->in[nw * b->succs[j] + w];
+                }
+            }
+            for ( w = 0; w < nw; w++ ) {
+                v = ctx->use[nw * s + w] | (out[w] & ~ctx->def[nw * s + w]);
+                if ( v != ctx->in[nw * s + w] ) {
+                    ctx->in[nw * s + w] = v;
+                    changed = 1;
+                }
+            }
+        }
+    } while ( changed );
+}
+
+/*
+ * _across -- find the registers live across each yield walking the blocks
+ * backward from the exits; the yields are numbered in the order of the code
+ */
+static void
+_across(coro_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    uint64_t *live;
+    size_t nw;
+    size_t b;
+    int pos;
+    int *r;
+    int i;
+    int j;
+    int k;
+    int m;
+    int n;
+
+    func = ctx->func;
+    nw = ctx->nwords;
+    live = ctx->live;
+    i = 0;
+    for ( b = 0; b < func->block.n; b++ ) {
+        n = 0;
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode == IR_OPCODE_YIELD ) {
+                ctx->yield.pos[i + n] = pos;
+                n++;
+            }
+        }
+        if ( n == 0 ) {
+            continue;
+        }
+        memcpy(live, ctx->out + nw * b, sizeof(uint64_t) * nw);
+        i += n;
+        k = i;
+        for ( pos = func->block.blocks[b].tail; pos >= 0; pos = p->prev ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode == IR_OPCODE_YIELD ) {
+                k--;
+                memcpy(ctx->yield.across + nw * k, live,
+                       sizeof(uint64_t) * nw);
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                _bit_clear(live, p->result.reg[j]);
+            }
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( m = 0; (r = ir_operand_use(&p->operands[j], m)) != NULL;
+                      m++ ) {
+                    if ( *r >= 0 ) {
+                        _bit_set(live, *r);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * _assign -- assign the slots of the frame to the registers live across the
+ * yields; a register takes the lowest slot not taken by the registers live
+ * across the same yields, so that the registers never live at the same time
+ * share a slot
+ */
+static int
+_assign(coro_ctx_t *ctx)
+{
+    uint64_t *across;
+    char *busy;
+    size_t r;
+    size_t t;
+    int k;
+    int s;
+
+    busy = malloc(ctx->nregs + 1);
+    if ( busy == NULL ) {
+        return -1;
+    }
+    for ( r = 0; r < ctx->nregs; r++ ) {
+        ctx->slots[r] = -1;
+    }
+    ctx->nslots = 0;
+    for ( r = 0; r < ctx->nregs; r++ ) {
+        for ( k = 0; k < ctx->yield.n; k++ ) {
+            if ( _bit_test(ctx->yield.across + ctx->nwords * k, r) ) {
+                break;
+            }
+        }
+        if ( k >= ctx->yield.n ) {
+            /* Not live across any yield */
+            continue;
+        }
+        memset(busy, 0, ctx->nregs + 1);
+        for ( ; k < ctx->yield.n; k++ ) {
+            across = ctx->yield.across + ctx->nwords * k;
+            if ( !_bit_test(across, r) ) {
+                continue;
+            }
+            for ( t = 0; t < ctx->nregs; t++ ) {
+                if ( _bit_test(across, t) && ctx->slots[t] >= 0 ) {
+                    busy[ctx->slots[t]] = 1;
+                }
+            }
+        }
+        for ( s = 0; busy[s]; s++ ) {
+        }
+        ctx->slots[r] = s;
+        if ( s >= ctx->nslots ) {
+            ctx->nslots = s + 1;
+        }
+    }
+    free(busy);
+
+    return 0;
+}
+
+/*
+ * _store -- insert a store to the frame before the instruction
+ */
+static int
+_store(coro_ctx_t *ctx, int pos, const ir_operand_t *src, int64_t disp)
+{
+    ir_instr_t instr;
+    ir_operand_t ops[2];
+
+    ir_instr_init(&instr, IR_OPCODE_STORE, ops);
+    instr.noperands = 2;
+    memcpy(&instr.operands[0], src, sizeof(ir_operand_t));
+    ir_operand_ref(&instr.operands[1], ctx->fp, -1, 1, disp);
+
+    return ir_instr_insert_before(ctx->func, pos, &instr);
+}
+
+/*
+ * _packet -- write the values of the yield at pos to the packet, so that the
+ * runtime streams them without copying (see runtime/chan.c)
+ */
+static int
+_packet(coro_ctx_t *ctx, int pos)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_operand_t ops[2];
+    int ptr;
+    int i;
+
+    func = ctx->func;
+    p = &func->instr.instrs[pos];
+    if ( p->noperands == 0 ) {
+        return 0;
+    }
+    if ( p->noperands > ctx->packet ) {
+        ctx->packet = p->noperands;
+    }
+    ptr = ir_func_reg_new(func, IR_REG_PTR, NULL);
+    if ( ptr < 0 ) {
+        return -1;
+    }
+    ir_instr_init(&instr, IR_OPCODE_LOAD, ops);
+    instr.result.n = 1;
+    instr.result.reg[0] = ptr;
+    instr.noperands = 1;
+    ir_operand_ref(&instr.operands[0], ctx->fp, -1, 1, IR_FRAME_PACKET);
+    if ( ir_instr_insert_before(func, pos, &instr) < 0 ) {
+        return -1;
+    }
+    for ( i = 0; i < func->instr.instrs[pos].noperands; i++ ) {
+        ir_instr_init(&instr, IR_OPCODE_STORE, ops);
+        instr.noperands = 2;
+        memcpy(&instr.operands[0], &func->instr.instrs[pos].operands[i],
+               sizeof(ir_operand_t));
+        ir_operand_ref(&instr.operands[1], ptr, -1, 1,
+                       IR_FRAME_SLOT_SIZE * i);
+        if ( ir_instr_insert_before(func, pos, &instr) < 0 ) {
+            return -1;
+        }
+    }
+    func->instr.instrs[pos].noperands = 0;
+
+    return 0;
+}
+
+/*
+ * _yield -- lower the k-th yield; the values are written to the packet, and
+ * the registers live across it are saved to the frame with the state to
+ * resume from, and restored after it.  The yield defines the frame pointer
+ * passed at the resume.
+ */
+static int
+_yield(coro_ctx_t *ctx, int k)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_operand_t op;
+    ir_operand_t src;
+    uint64_t *across;
+    int64_t disp;
+    size_t r;
+    int pos;
+
+    func = ctx->func;
+    pos = ctx->yield.pos[k];
+    across = ctx->yield.across + ctx->nwords * k;
+    if ( _packet(ctx, pos) < 0 ) {
+        return -1;
+    }
+
+    /* Save */
+    for ( r = 0; r < ctx->nregs; r++ ) {
+        if ( !_bit_test(across, r) ) {
+            continue;
+        }
+        disp = IR_FRAME_SLOTS + IR_FRAME_SLOT_SIZE * ctx->slots[r];
+        if ( _store(ctx, pos, ir_operand_reg(&op, r), disp) < 0 ) {
+            return -1;
+        }
+    }
+    if ( _store(ctx, pos, ir_operand_imm(&op, IR_IMM_I64, k + 1),
+                IR_FRAME_STATE) < 0 ) {
+        return -1;
+    }
+    p = &func->instr.instrs[pos];
+    p->result.n = 1;
+    p->result.reg[0] = ctx->fp;
+
+    /* Restore */
+    for ( r = 0; r < ctx->nregs; r++ ) {
+        if ( !_bit_test(across, r) ) {
+            continue;
+        }
+        ir_instr_init(&instr, IR_OPCODE_LOAD, &src);
+        instr.result.n = 1;
+        instr.result.reg[0] = r;
+        instr.noperands = 1;
+        disp = IR_FRAME_SLOTS + IR_FRAME_SLOT_SIZE * ctx->slots[r];
+        ir_operand_ref(&instr.operands[0], ctx->fp, -1, 1, disp);
+        pos = ir_instr_insert_after(func, pos, &instr);
+        if ( pos < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _return -- reset the state before the returns, so that the next call starts
+ * the coroutine over
+ */
+static int
+_return(coro_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_operand_t op;
+    size_t b;
+    int pos;
+
+    func = ctx->func;
+    for ( b = 0; b < func->block.n; b++ ) {
+        pos = func->block.blocks[b].tail;
+        if ( pos < 0 || func->instr.instrs[pos].opcode != IR_OPCODE_RET ) {
+            continue;
+        }
+        if ( _store(ctx, pos, ir_operand_imm(&op, IR_IMM_I64, 0),
+                    IR_FRAME_STATE) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * ir_func_coroutine -- lower a coroutine not in the SSA form to a stackless
+ * state machine.  The coroutine takes the pointer to its frame as the first
+ * argument; a yield writes the values to the packet pointed by the frame,
+ * saves the registers live across it and the state to the frame, and
+ * returns, and the next call resumes from the state (see the dispatch of the
+ * code generator) restoring the registers.  The frame is allocated by the
+ * caller, and the state is zero at the start and after the return, which
+ * returns the values in the registers as a function does.
+ */
+int
+ir_func_coroutine(ir_func_t *func)
+{
+    coro_ctx_t ctx;
+    ir_instr_t *p;
+    size_t nw;
+    size_t i;
+    int pos;
+    int ret;
+    int k;
+
+    if ( func->type != IR_FUNC_COROUTINE || func->ssa ) {
+        return 0;
+    }
+
+    /* The frame pointer is the first argument */
+    memset(&ctx, 0, sizeof(coro_ctx_t));
+    ctx.func = func;
+    ctx.fp = ir_func_reg_new(func, IR_REG_PTR, NULL);
+    if ( ctx.fp < 0 ) {
+        return -1;
+    }
+    for ( i = 0; i < func->reg.n; i++ ) {
+        if ( func->reg.regs[i].arg >= 0 ) {
+            func->reg.regs[i].arg++;
+        }
+    }
+    func->reg.regs[ctx.fp].arg = 0;
+
+    for ( i = 0; i < func->block.n; i++ ) {
+        for ( pos = func->block.blocks[i].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            ctx.yield.n += p->opcode == IR_OPCODE_YIELD;
+        }
+    }
+
+    ret = -1;
+    ctx.nregs = func->reg.n;
+    nw = (ctx.nregs + 63) / 64;
+    ctx.nwords = nw;
+    ctx.in = malloc(sizeof(uint64_t)
+                    * (nw * (func->block.n * 4 + ctx.yield.n) + nw + 1));
+    ctx.yield.pos = malloc(sizeof(int) * (ctx.yield.n + 1));
+    ctx.slots = malloc(sizeof(int) * (ctx.nregs + 1));
+    if ( ctx.in == NULL || ctx.yield.pos == NULL || ctx.slots == NULL ) {
+        goto done;
+    }
+    ctx.out = ctx.in + nw * func->block.n;
+    ctx.use = ctx.out + nw * func->block.n;
+    ctx.def = ctx.use + nw * func->block.n;
+    ctx.live = ctx.def + nw * func->block.n;
+    ctx.yield.across = ctx.live + nw;
+
+    _liveness(&ctx);
+    _across(&ctx);
+    if ( _assign(&ctx) < 0 ) {
+        goto done;
+    }
+    for ( k = 0; k < ctx.yield.n; k++ ) {
+        if ( _yield(&ctx, k) < 0 ) {
+            goto done;
+        }
+    }
+    if ( _return(&ctx) < 0 ) {
+        goto done;
+    }
+    func->frame.states = ctx.yield.n + 1;
+    func->frame.size = IR_FRAME_SLOTS + IR_FRAME_SLOT_SIZE * ctx.nslots;
+    func->frame.packet = ctx.packet;
+    ret = 0;
+
+done:
+    free(ctx.in);
+    free(ctx.yield.pos);
+    free(ctx.slots);
+
+    return ret;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
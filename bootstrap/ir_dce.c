@@ -0,0 +1,377 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _bit_test -- test a bit of a bit set
+ */
+static int
+_bit_test(const uint64_t *bs, size_t i)
+{
+    return (bs[i / 64] >> (i % 64)) & 1;
+}
+
+/*
+ * _bit_set -- set a bit of a bit set
+ */
+static void
+_bit_set(uint64_t *bs, size_t i)
+{
+    bs[i / 64] |= (uint64_t)1 << (i % 64);
+}
+
+/*
+ * _bit_clear -- clear a bit of a bit set
+ */
+static void
+_bit_clear(uint64_t *bs, size_t i)
+{
+    bs[i / 64] &= ~((uint64_t)1 << (i % 64));
+}
+
+/*
+ * _critical -- check if the instruction has an effect other than its results
+ */
+static int
+_critical(const ir_instr_t *p)
+{
+    switch ( p->opcode ) {
+    case IR_OPCODE_STORE:
+    case IR_OPCODE_RET:
+    case IR_OPCODE_YIELD:
+    case IR_OPCODE_JMP:
+    case IR_OPCODE_BR:
+        return 1;
+    default:
+        return p->result.n == 0;
+    }
+}
+
+/*
+ * _dead -- check if the instruction is dead; none of its results is live, or
+ * it is a copy to itself
+ */
+static int
+_dead(const uint64_t *live, const ir_instr_t *p)
+{
+    int j;
+
+    if ( _critical(p) ) {
+        return 0;
+    }
+    if ( p->opcode == IR_OPCODE_MOV && p->operands[0].type == OPERAND_TYPE_REG
+         && p->operands[0].u.reg == p->result.reg[0] ) {
+        return 1;
+    }
+    for ( j = 0; j < p->result.n; j++ ) {
+        if ( _bit_test(live, p->result.reg[j]) ) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * Context of the dead code elimination; the sets of the blocks have the bits
+ * of the global registers only, and the working set has those of all the
+ * registers
+ */
+typedef struct {
+    ir_func_t *func;
+    /* Global registers; the index of each register, or -1 if local, and the
+       register of each index */
+    int *index;
+    int *globals;
+    size_t nglobals;
+    /* Bit sets of the global registers (nwords words each) */
+    size_t nwords;
+    uint64_t *in;       /* Live at the entry of each block */
+    uint64_t *out;      /* Live at the exit of each block */
+    uint64_t *use;      /* Used before defined in each block */
+    uint64_t *def;      /* Defined in each block */
+    uint64_t *live;     /* Working set of all the registers */
+} dce_ctx_t;
+
+/*
+ * _globals -- index the registers used before defined in a block; the others
+ * are never live at the entry of a block, nor at the exit, so that their
+ * liveness is found in the block defining them
+ */
+static int
+_globals(dce_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    int *defined;
+    size_t i;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int s;
+
+    func = ctx->func;
+    ctx->index = malloc(sizeof(int) * (func->reg.n * 3 + 1));
+    if ( ctx->index == NULL ) {
+        return -1;
+    }
+    ctx->globals = ctx->index + func->reg.n;
+    defined = ctx->globals + func->reg.n;
+    memset(ctx->index, 0xff, sizeof(int) * func->reg.n);
+    memset(defined, 0xff, sizeof(int) * func->reg.n);
+    ctx->nglobals = 0;
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        s = func->rpo.blocks[i];
+        for ( pos = func->block.blocks[s].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *r >= 0 && defined[*r] != s && ctx->index[*r] < 0 ) {
+                        ctx->index[*r] = ctx->nglobals;
+                        ctx->globals[ctx->nglobals++] = *r;
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                defined[p->result.reg[j]] = s;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _liveness -- compute the registers live at the entry and the exit of each
+ * block
+ */
+static void
+_liveness(dce_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_block_t *b;
+    ir_instr_t *p;
+    uint64_t *use;
+    uint64_t *def;
+    uint64_t *out;
+    uint64_t v;
+    size_t nw;
+    size_t i;
+    size_t w;
+    int changed;
+    int pos;
+    int *r;
+    int g;
+    int j;
+    int k;
+    int s;
+
+    func = ctx->func;
+    nw = ctx->nwords;
+    memset(ctx->in, 0, sizeof(uint64_t) * nw * func->block.n * 4);
+
+    /* Registers used before defined, and defined in each block */
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        s = func->rpo.blocks[i];
+        use = ctx->use + nw * s;
+        def = ctx->def + nw * s;
+        for ( pos = func->block.blocks[s].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    g = *r >= 0 ? ctx->index[*r] : -1;
+                    if ( g >= 0 && !_bit_test(def, g) ) {
+                        _bit_set(use, g);
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                g = ctx->index[p->result.reg[j]];
+                if ( g >= 0 ) {
+                    _bit_set(def, g);
+                }
+            }
+        }
+    }
+
+    /* Solve the backward data-flow equations in the postorder */
+    do {
+        changed = 0;
+        for ( i = func->rpo.n; i > 0; i-- ) {
+            s = func->rpo.blocks[i - 1];
+            b = &func->block.blocks[s];
+            out = ctx->out + nw * s;
+            for ( j = 0; j < b->nsuccs; j++ ) {
+                for ( w = 0; w < nw; w++ ) {
+                    out[w] |= ctx->in[nw * b->succs[j] + w];
+                }
+            }
+            for ( w = 0; w < nw; w++ ) {
+                v = ctx->use[nw * s + w] | (out[w] & ~ctx->def[nw * s + w]);
+                if ( v != ctx->in[nw * s + w] ) {
+                    ctx->in[nw * s + w] = v;
+                    changed = 1;
+                }
+            }
+        }
+    } while ( changed );
+}
+
+/*
+ * _sweep -- remove the instructions of the block whose results are not live
+ * walking the block backward from the exit, and return the number of the
+ * removed instructions
+ */
+static int
+_sweep(dce_ctx_t *ctx, int block)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    uint64_t *live;
+    uint64_t *out;
+    uint64_t v;
+    size_t w;
+    int removed;
+    int prev;
+    int pos;
+    int *r;
+    int j;
+    int k;
+
+    func = ctx->func;
+    live = ctx->live;
+    memset(live, 0, sizeof(uint64_t) * ((func->reg.n + 63) / 64));
+    out = ctx->out + ctx->nwords * block;
+    for ( w = 0; w < ctx->nwords; w++ ) {
+        for ( v = out[w]; v; v &= v - 1 ) {
+            _bit_set(live, ctx->globals[w * 64 + __builtin_ctzll(v)]);
+        }
+    }
+    removed = 0;
+    for ( pos = func->block.blocks[block].tail; pos >= 0; pos = prev ) {
+        p = &func->instr.instrs[pos];
+        prev = p->prev;
+        if ( _dead(live, p) ) {
+            if ( p->opcode == IR_OPCODE_MOV ) {
+                func->dead.copies++;
+            } else {
+                func->dead.instrs++;
+            }
+            ir_instr_remove(func, pos);
+            removed++;
+            continue;
+        }
+        for ( j = 0; j < p->result.n; j++ ) {
+            _bit_clear(live, p->result.reg[j]);
+        }
+        for ( j = 0; j < p->noperands; j++ ) {
+            for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                  k++ ) {
+                if ( *r >= 0 ) {
+                    _bit_set(live, *r);
+                }
+            }
+        }
+    }
+
+    return removed;
+}
+
+/*
+ * ir_func_dce -- remove the dead code of a function not in the SSA form; the
+ * blocks unreachable from the entry, and the instructions without an effect
+ * other than their results that are never read (e.g., copies to variables
+ * overwritten or never used afterward) are removed, and counted in func->dead
+ */
+int
+ir_func_dce(ir_func_t *func)
+{
+    dce_ctx_t ctx;
+    size_t nw;
+    size_t i;
+    int removed;
+    int n;
+
+    if ( func->ssa || func->block.n == 0 ) {
+        return 0;
+    }
+
+    /* Unreachable blocks are emptied by rebuilding the control flow graph */
+    n = 0;
+    for ( i = 0; i < func->block.n; i++ ) {
+        n += func->block.blocks[i].head >= 0;
+    }
+    if ( ir_func_cfg(func) < 0 ) {
+        return -1;
+    }
+    for ( i = 0; i < func->block.n; i++ ) {
+        n -= func->block.blocks[i].head >= 0;
+    }
+    func->dead.blocks += n;
+
+    memset(&ctx, 0, sizeof(dce_ctx_t));
+    ctx.func = func;
+    if ( _globals(&ctx) < 0 ) {
+        return -1;
+    }
+    nw = (ctx.nglobals + 63) / 64;
+    ctx.nwords = nw;
+    ctx.in = malloc(sizeof(uint64_t) * (nw * func->block.n * 4
+                                        + (func->reg.n + 63) / 64 + 1));
+    if ( ctx.in == NULL ) {
+        free(ctx.index);
+        return -1;
+    }
+    ctx.out = ctx.in + nw * func->block.n;
+    ctx.use = ctx.out + nw * func->block.n;
+    ctx.def = ctx.use + nw * func->block.n;
+    ctx.live = ctx.def + nw * func->block.n;
+
+    /* Removing an instruction may make the others dead */
+    do {
+        _liveness(&ctx);
+        removed = 0;
+        for ( i = 0; i < func->rpo.n; i++ ) {
+            removed += _sweep(&ctx, func->rpo.blocks[i]);
+        }
+    } while ( removed > 0 );
+    free(ctx.in);
+    free(ctx.index);
+
+    return ir_func_dom(func);
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -22,6 +22,275 @@
  */
 
 #include "ir.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+/*
+ * ir_opcode_name -- get the mnemonic of the opcode
+ */
+const char *
+ir_opcode_name(ir_opcode_t opcode)
+{
+    switch ( opcode ) {
+    case IR_OPCODE_ALLOCA:
+        return "alloca";
+    case IR_OPCODE_LOAD:
+        return "load";
+    case IR_OPCODE_STORE:
+        return "store";
+    case IR_OPCODE_MOV:
+        return "mov";
+    case IR_OPCODE_ADD:
+        return "add";
+    case IR_OPCODE_SUB:
+        return "sub";
+    case IR_OPCODE_MUL:
+        return "mul";
+    case IR_OPCODE_DIV:
+        return "div";
+    case IR_OPCODE_MOD:
+        return "mod";
+    case IR_OPCODE_MULH:
+        return "mulh";
+    case IR_OPCODE_INC:
+        return "inc";
+    case IR_OPCODE_DEC:
+        return "dec";
+    case IR_OPCODE_NOT:
+        return "not";
+    case IR_OPCODE_COMP:
+        return "comp";
+    case IR_OPCODE_LAND:
+        return "land";
+    case IR_OPCODE_LOR:
+        return "lor";
+    case IR_OPCODE_AND:
+        return "and";
+    case IR_OPCODE_OR:
+        return "or";
+    case IR_OPCODE_XOR:
+        return "xor";
+    case IR_OPCODE_LSHIFT:
+        return "lshift";
+    case IR_OPCODE_RSHIFT:
+        return "rshift";
+    case IR_OPCODE_CMP_EQ:
+        return "cmp_eq";
+    case IR_OPCODE_CMP_NEQ:
+        return "cmp_neq";
+    case IR_OPCODE_CMP_GT:
+        return "cmp_gt";
+    case IR_OPCODE_CMP_LT:
+        return "cmp_lt";
+    case IR_OPCODE_CMP_GEQ:
+        return "cmp_geq";
+    case IR_OPCODE_CMP_LEQ:
+        return "cmp_leq";
+    case IR_OPCODE_RET:
+        return "ret";
+    case IR_OPCODE_YIELD:
+        return "yield";
+    case IR_OPCODE_JMP:
+        return "jmp";
+    case IR_OPCODE_BR:
+        return "br";
+    case IR_OPCODE_PHI:
+        return "phi";
+    }
+
+    return "(unknown)";
+}
+
+/*
+ * _regtype -- get the name of the register type
+ */
+static const char *
+_regtype(ir_reg_type_t type)
+{
+    switch ( type ) {
+    case IR_REG_PTR:
+        return "ptr";
+    case IR_REG_I8:
+        return "i8";
+    case IR_REG_I16:
+        return "i16";
+    case IR_REG_I32:
+        return "i32";
+    case IR_REG_I64:
+        return "i64";
+    case IR_REG_FP32:
+        return "fp32";
+    case IR_REG_FP64:
+        return "fp64";
+    case IR_REG_BOOL:
+        return "bool";
+    case IR_REG_U8:
+        return "u8";
+    case IR_REG_U16:
+        return "u16";
+    case IR_REG_U32:
+        return "u32";
+    case IR_REG_U64:
+        return "u64";
+    default:
+        return "(unknown)";
+    }
+}
+
+/*
+ * _print_imm -- print an immediate value
+ */
+static void
+_print_imm(ir_imm_t *imm)
+{
+    switch ( imm->type ) {
+    case IR_IMM_I8:
+        printf("%" PRIu8, imm->u.u8);
+        break;
+    case IR_IMM_S8:
+        printf("%" PRId8, imm->u.s8);
+        break;
+    case IR_IMM_I16:
+        printf("%" PRIu16, imm->u.u16);
+        break;
+    case IR_IMM_S16:
+        printf("%" PRId16, imm->u.s16);
+        break;
+    case IR_IMM_I32:
+        printf("%" PRIu32, imm->u.u32);
+        break;
+    case IR_IMM_S32:
+        printf("%" PRId32, imm->u.s32);
+        break;
+    case IR_IMM_I64:
+        printf("%" PRIu64, imm->u.u64);
+        break;
+    case IR_IMM_S64:
+        printf("%" PRId64, imm->u.s64);
+        break;
+    }
+}
+
+/*
+ * _print_operand -- print an operand
+ */
+static void
+_print_operand(ir_operand_t *op)
+{
+    switch ( op->type ) {
+    case OPERAND_TYPE_REG:
+        printf("%%%d", op->u.reg);
+        break;
+    case OPERAND_TYPE_REF:
+        printf("[");
+        if ( op->u.ref.base >= 0 ) {
+            printf("%%%d", op->u.ref.base);
+        }
+        if ( op->u.ref.index >= 0 ) {
+            printf("+%%%d*%d", op->u.ref.index, op->u.ref.scale);
+        }
+        printf("%+" PRId64 "]", op->u.ref.disp);
+        break;
+    case OPERAND_TYPE_IMM:
+        _print_imm(&op->u.imm);
+        break;
+    case OPERAND_TYPE_BLOCK:
+        printf("b%d", op->u.block);
+        break;
+    }
+}
+
+/*
+ * _print_instr -- print an instruction
+ */
+static void
+_print_instr(ir_instr_t *instr)
+{
+    int i;
+
+    printf("    ");
+    for ( i = 0; i < instr->result.n; i++ ) {
+        printf("%s%%%d", i > 0 ? "," : "", instr->result.reg[i]);
+    }
+    if ( instr->result.n > 0 ) {
+        printf(" = ");
+    }
+    printf("%s", ir_opcode_name(instr->opcode));
+    for ( i = 0; i < instr->noperands; i++ ) {
+        printf("%s", i > 0 ? ", " : " ");
+        _print_operand(&instr->operands[i]);
+    }
+    printf("\n");
+}
+
+/*
+ * ir_print_func -- print the given IR function
+ */
+int
+ir_print_func(ir_func_t *func)
+{
+    ir_reg_t *reg;
+    ir_block_t *blk;
+    size_t b;
+    size_t r;
+    size_t p;
+    int i;
+
+    printf("%s %s\n", func->type == IR_FUNC_COROUTINE ? "coroutine" : "fn",
+           func->name);
+
+    /* Registers */
+    for ( r = 0; r < func->reg.n; r++ ) {
+        reg = &func->reg.regs[r];
+        printf("  %%%zu: %s", r, _regtype(reg->type));
+        if ( reg->id != NULL ) {
+            printf(" %s", reg->id);
+        }
+        if ( reg->arg >= 0 ) {
+            printf(" (arg:%d)", reg->arg);
+        }
+        if ( reg->ret >= 0 ) {
+            printf(" (ret:%d)", reg->ret);
+        }
+        if ( reg->slot >= 0 ) {
+            printf(" (slot:%d)", reg->slot);
+        }
+        printf("\n");
+    }
+
+    /* Dead code removed */
+    if ( func->dead.copies > 0 || func->dead.instrs > 0
+         || func->dead.blocks > 0 ) {
+        printf("  ; dead code removed: copies=%d instrs=%d blocks=%d\n",
+               func->dead.copies, func->dead.instrs, func->dead.blocks);
+    }
+
+    /* Coroutine frame */
+    if ( func->type == IR_FUNC_COROUTINE && func->frame.size > 0 ) {
+        printf("  ; coroutine frame: size=%d states=%d packet=%d\n",
+               func->frame.size, func->frame.states, func->frame.packet);
+    }
+
+    /* Blocks */
+    for ( b = 0; b < func->block.n; b++ ) {
+        blk = &func->block.blocks[b];
+        if ( blk->rpo < 0 && blk->head < 0 ) {
+            /* Skip the empty unreachable block */
+            continue;
+        }
+        printf("  b%zu:", b);
+        for ( p = 0; p < blk->pred.n; p++ ) {
+            printf("%s b%d", p > 0 ? "," : " ; preds", blk->pred.blocks[p]);
+        }
+        printf("\n");
+        for ( i = ir_block_first(func, b); i >= 0;
+              i = ir_instr_next(func, i) ) {
+            _print_instr(ir_instr_at(func, i));
+        }
+    }
+
+    return 0;
+}
 
 /*
  * ir_print_code -- print the given IR code
@@ -29,7 +298,15 @@
 int
 ir_print_code(ir_object_t *obj)
 {
-    return -1;
+    ir_func_t *f;
+
+    for ( f = obj->funcs; f != NULL; f = f->next ) {
+        if ( ir_print_func(f) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
 }
 
 /*
@@ -0,0 +1,594 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _bits -- get the width of the register as the code generator computes in;
+ * the registers narrower than 32 bits are computed in 32 bits
+ */
+static int
+_bits(ir_func_t *func, int r)
+{
+    switch ( func->reg.regs[r].type ) {
+    case IR_REG_PTR:
+    case IR_REG_I64:
+    case IR_REG_U64:
+        return 64;
+    default:
+        return 32;
+    }
+}
+
+/*
+ * _sext -- sign-extend the value of the width
+ */
+static int64_t
+_sext(uint64_t v, int bits)
+{
+    if ( bits < 64 ) {
+        return (int32_t)(uint32_t)v;
+    }
+
+    return v;
+}
+
+/*
+ * _same -- check if two operands are the same value
+ */
+static int
+_same(const ir_operand_t *a, const ir_operand_t *b)
+{
+    if ( a->type != b->type ) {
+        return 0;
+    }
+    switch ( a->type ) {
+    case OPERAND_TYPE_REG:
+        return a->u.reg == b->u.reg;
+    case OPERAND_TYPE_IMM:
+        return a->u.imm.type == b->u.imm.type
+            && a->u.imm.u.u64 == b->u.imm.u.u64;
+    default:
+        return 0;
+    }
+}
+
+/*
+ * _combine -- merge a division and a modulo of the same operands into the one
+ * computing both the quotient and the remainder, where the first one
+ * dominates the second
+ */
+static int
+_combine(ir_func_t *func)
+{
+    ir_instr_t *p;
+    ir_instr_t *q;
+    int *divs;
+    size_t n;
+    size_t i;
+    size_t j;
+    int pos;
+    int b;
+
+    divs = malloc(sizeof(int) * (func->instr.n + 1));
+    if ( divs == NULL ) {
+        return -1;
+    }
+
+    /* Divisions in the reverse postorder, so that a dominator comes first */
+    n = 0;
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        b = func->rpo.blocks[i];
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( (p->opcode == IR_OPCODE_DIV || p->opcode == IR_OPCODE_MOD)
+                 && p->result.n == 1 ) {
+                divs[n++] = pos;
+            }
+        }
+    }
+
+    for ( i = 0; i < n; i++ ) {
+        p = &func->instr.instrs[divs[i]];
+        if ( p->block < 0 || p->result.n != 1 ) {
+            continue;
+        }
+        for ( j = i + 1; j < n; j++ ) {
+            q = &func->instr.instrs[divs[j]];
+            if ( q->block < 0 || q->result.n != 1 || q->opcode == p->opcode
+                 || !_same(&p->operands[0], &q->operands[0])
+                 || !_same(&p->operands[1], &q->operands[1])
+                 || !ir_block_dominates(func, p->block, q->block) ) {
+                continue;
+            }
+            /* In the same block, p precedes q in the reverse postorder */
+            p->result.reg[1] = q->result.reg[0];
+            p->result.n = 2;
+            ir_instr_remove(func, divs[j]);
+            break;
+        }
+    }
+    free(divs);
+
+    return 0;
+}
+
+/*
+ * _magic -- compute the magic number and the shift amount of the signed
+ * division by the constant d (2 <= |d| < 2^(bits-1)) as a multiplication, by
+ * the algorithm in Hacker's Delight (10-4)
+ */
+static void
+_magic(int64_t d, int bits, int64_t *m, int *s)
+{
+    uint64_t mask;
+    uint64_t two;
+    uint64_t ad;
+    uint64_t anc;
+    uint64_t delta;
+    uint64_t q1;
+    uint64_t r1;
+    uint64_t q2;
+    uint64_t r2;
+    uint64_t t;
+    int p;
+
+    mask = bits < 64 ? ((uint64_t)1 << bits) - 1 : ~(uint64_t)0;
+    two = (uint64_t)1 << (bits - 1);
+    ad = d < 0 ? -(uint64_t)d : (uint64_t)d;
+    t = two + (d < 0);
+    anc = t - 1 - t % ad;
+    p = bits - 1;
+    q1 = two / anc;
+    r1 = two - q1 * anc;
+    q2 = two / ad;
+    r2 = two - q2 * ad;
+    do {
+        p++;
+        q1 = (q1 << 1) & mask;
+        r1 = (r1 << 1) & mask;
+        if ( r1 >= anc ) {
+            q1 = (q1 + 1) & mask;
+            r1 = (r1 - anc) & mask;
+        }
+        q2 = (q2 << 1) & mask;
+        r2 = (r2 << 1) & mask;
+        if ( r2 >= ad ) {
+            q2 = (q2 + 1) & mask;
+            r2 = (r2 - ad) & mask;
+        }
+        delta = ad - r2;
+    } while ( q1 < delta || (q1 == delta && r1 == 0) );
+
+    *m = _sext(q2 + 1, bits);
+    if ( d < 0 ) {
+        *m = _sext(-(uint64_t)*m, bits);
+    }
+    *s = p - bits;
+}
+
+/*
+ * _magicu -- compute the magic number, the add indicator, and the shift amount
+ * of the unsigned division by the constant d (2 <= d < 2^(bits-1)) as a
+ * multiplication, by the algorithm in Hacker's Delight (10-8)
+ */
+static void
+_magicu(uint64_t d, int bits, uint64_t *m, int *a, int *s)
+{
+    uint64_t mask;
+    uint64_t two;
+    uint64_t nc;
+    uint64_t delta;
+    uint64_t q1;
+    uint64_t r1;
+    uint64_t q2;
+    uint64_t r2;
+    int p;
+
+    mask = bits < 64 ? ((uint64_t)1 << bits) - 1 : ~(uint64_t)0;
+    two = (uint64_t)1 << (bits - 1);
+    *a = 0;
+    nc = mask - (-d & mask) % d;
+    p = bits - 1;
+    q1 = two / nc;
+    r1 = two - q1 * nc;
+    q2 = (two - 1) / d;
+    r2 = (two - 1) - q2 * d;
+    do {
+        p++;
+        if ( r1 >= nc - r1 ) {
+            q1 = (2 * q1 + 1) & mask;
+            r1 = (2 * r1 - nc) & mask;
+        } else {
+            q1 = (2 * q1) & mask;
+            r1 = (2 * r1) & mask;
+        }
+        if ( r2 + 1 >= d - r2 ) {
+            if ( q2 >= two - 1 ) {
+                *a = 1;
+            }
+            q2 = (2 * q2 + 1) & mask;
+            r2 = (2 * r2 + 1 - d) & mask;
+        } else {
+            if ( q2 >= two ) {
+                *a = 1;
+            }
+            q2 = (2 * q2) & mask;
+            r2 = (2 * r2 + 1) & mask;
+        }
+        delta = d - 1 - r2;
+    } while ( p < 2 * bits && (q1 < delta || (q1 == delta && r1 == 0)) );
+
+    *m = (q2 + 1) & mask;
+    *s = p - bits;
+}
+
+/*
+ * _insert -- insert r = a op b before the instruction; b may be NULL
+ */
+static int
+_insert(ir_func_t *func, int pos, ir_opcode_t opcode, int r,
+        const ir_operand_t *a, const ir_operand_t *b)
+{
+    ir_instr_t instr;
+    ir_operand_t ops[2];
+
+    ir_instr_init(&instr, opcode, ops);
+    instr.result.n = 1;
+    instr.result.reg[0] = r;
+    instr.noperands = b != NULL ? 2 : 1;
+    instr.operands[0] = *a;
+    if ( b != NULL ) {
+        instr.operands[1] = *b;
+    }
+
+    return ir_instr_insert_before(func, pos, &instr);
+}
+
+/*
+ * _emit -- insert r = a op b of the type to a new register r before the
+ * instruction, and return r
+ */
+static int
+_emit(ir_func_t *func, int pos, ir_opcode_t opcode, ir_reg_type_t type,
+      const ir_operand_t *a, const ir_operand_t *b)
+{
+    int r;
+
+    r = ir_func_reg_new(func, type, NULL);
+    if ( r < 0 ) {
+        return -1;
+    }
+    if ( _insert(func, pos, opcode, r, a, b) < 0 ) {
+        return -1;
+    }
+
+    return r;
+}
+
+/*
+ * _quotient -- insert the computation of the quotient of x by the constant d
+ * (d != 0, and d is not the minimum value) without a division, and return
+ * the register of the quotient; the dividend rounded toward zero to the
+ * multiple of |d| is also returned to t if d is a power of two, or -1
+ */
+static int
+_quotient(ir_func_t *func, int pos, ir_reg_type_t type, int bits,
+          const ir_operand_t *x, int64_t d, int *t)
+{
+    ir_operand_t a;
+    ir_operand_t b;
+    uint64_t ad;
+    int64_t m;
+    int s;
+    int k;
+    int q;
+    int r;
+
+    *t = -1;
+    ad = d < 0 ? -(uint64_t)d : (uint64_t)d;
+    ir_operand_imm(&a, IR_IMM_I64, 0);
+    if ( ad == 1 ) {
+        /* x or -x */
+        return _emit(func, pos, d > 0 ? IR_OPCODE_MOV : IR_OPCODE_SUB, type,
+                     d > 0 ? x : &a, d > 0 ? NULL : x);
+    }
+
+    if ( (ad & (ad - 1)) == 0 ) {
+        /* Power of two; add |d| - 1 to a negative dividend to round toward
+           zero, and shift */
+        for ( k = 0; ((uint64_t)1 << k) != ad; k++ ) {
+        }
+        r = _emit(func, pos, IR_OPCODE_RSHIFT, type, x,
+                  ir_operand_imm(&b, IR_IMM_I64, bits - 1));
+        if ( r < 0 ) {
+            return -1;
+        }
+        r = _emit(func, pos, IR_OPCODE_AND, type, ir_operand_reg(&a, r),
+                  ir_operand_imm(&b, IR_IMM_I64, ad - 1));
+        if ( r < 0 ) {
+            return -1;
+        }
+        r = _emit(func, pos, IR_OPCODE_ADD, type, x, ir_operand_reg(&a, r));
+        if ( r < 0 ) {
+            return -1;
+        }
+        *t = r;
+        q = _emit(func, pos, IR_OPCODE_RSHIFT, type, ir_operand_reg(&a, r),
+                  ir_operand_imm(&b, IR_IMM_I64, k));
+        if ( q < 0 || d > 0 ) {
+            return q;
+        }
+        return _emit(func, pos, IR_OPCODE_SUB, type,
+                     ir_operand_imm(&a, IR_IMM_I64, 0), ir_operand_reg(&b, q));
+    }
+
+    /* Multiply by the magic number, take the high half, correct it, shift,
+       and add one if negative */
+    _magic(d, bits, &m, &s);
+    q = _emit(func, pos, IR_OPCODE_MULH, type, x,
+              ir_operand_imm(&b, IR_IMM_I64, m));
+    if ( q < 0 ) {
+        return -1;
+    }
+    if ( (d > 0 && m < 0) || (d < 0 && m > 0) ) {
+        q = _emit(func, pos, d > 0 ? IR_OPCODE_ADD : IR_OPCODE_SUB, type,
+                  ir_operand_reg(&a, q), x);
+        if ( q < 0 ) {
+            return -1;
+        }
+    }
+    if ( s > 0 ) {
+        q = _emit(func, pos, IR_OPCODE_RSHIFT, type, ir_operand_reg(&a, q),
+                  ir_operand_imm(&b, IR_IMM_I64, s));
+        if ( q < 0 ) {
+            return -1;
+        }
+    }
+    r = _emit(func, pos, IR_OPCODE_RSHIFT, type, ir_operand_reg(&a, q),
+              ir_operand_imm(&b, IR_IMM_I64, bits - 1));
+    if ( r < 0 ) {
+        return -1;
+    }
+
+    return _emit(func, pos, IR_OPCODE_SUB, type, ir_operand_reg(&a, q),
+                 ir_operand_reg(&b, r));
+}
+
+/*
+ * _quotientu -- insert the computation of the unsigned quotient of x by the
+ * constant d (d != 0) without a division, and return the register of the
+ * quotient; the register of x is also returned to t if d is a power of two,
+ * or -1
+ */
+static int
+_quotientu(ir_func_t *func, int pos, ir_reg_type_t type, int bits,
+           const ir_operand_t *x, uint64_t d, int *t)
+{
+    ir_operand_t a;
+    ir_operand_t b;
+    uint64_t m;
+    int add;
+    int s;
+    int k;
+    int q;
+    int r;
+
+    *t = -1;
+    if ( d == 1 ) {
+        return _emit(func, pos, IR_OPCODE_MOV, type, x, NULL);
+    }
+
+    if ( (d & (d - 1)) == 0 ) {
+        /* Power of two; the logical shift */
+        for ( k = 0; ((uint64_t)1 << k) != d; k++ ) {
+        }
+        *t = x->u.reg;
+        return _emit(func, pos, IR_OPCODE_RSHIFT, type, x,
+                     ir_operand_imm(&b, IR_IMM_I64, k));
+    }
+
+    if ( d >> (bits - 1) ) {
+        /* The quotient is one or zero */
+        r = _emit(func, pos, IR_OPCODE_CMP_GEQ, IR_REG_BOOL, x,
+                  ir_operand_imm(&b, IR_IMM_I64, d));
+        if ( r < 0 ) {
+            return -1;
+        }
+        return _emit(func, pos, IR_OPCODE_MOV, type, ir_operand_reg(&a, r),
+                     NULL);
+    }
+
+    /* Multiply by the magic number and take the high half, and add the
+       dividend without overflowing if the magic number does not fit the
+       width, and shift */
+    _magicu(d, bits, &m, &add, &s);
+    q = _emit(func, pos, IR_OPCODE_MULH, type, x,
+              ir_operand_imm(&b, IR_IMM_I64, m));
+    if ( q < 0 ) {
+        return -1;
+    }
+    if ( add ) {
+        r = _emit(func, pos, IR_OPCODE_SUB, type, x, ir_operand_reg(&b, q));
+        if ( r < 0 ) {
+            return -1;
+        }
+        r = _emit(func, pos, IR_OPCODE_RSHIFT, type, ir_operand_reg(&a, r),
+                  ir_operand_imm(&b, IR_IMM_I64, 1));
+        if ( r < 0 ) {
+            return -1;
+        }
+        q = _emit(func, pos, IR_OPCODE_ADD, type, ir_operand_reg(&a, r),
+                  ir_operand_reg(&b, q));
+        if ( q < 0 ) {
+            return -1;
+        }
+        s--;
+    }
+    if ( s > 0 ) {
+        q = _emit(func, pos, IR_OPCODE_RSHIFT, type, ir_operand_reg(&a, q),
+                  ir_operand_imm(&b, IR_IMM_I64, s));
+    }
+
+    return q;
+}
+
+/*
+ * _reduce -- replace the division and/or the modulo by a constant with the
+ * multiplication and the shifts
+ */
+static int
+_reduce(ir_func_t *func, int pos)
+{
+    ir_instr_t *p;
+    ir_operand_t x;
+    ir_operand_t a;
+    ir_operand_t b;
+    ir_reg_type_t type;
+    uint64_t ad;
+    int64_t d;
+    int unsig;
+    int quot;
+    int rem;
+    int bits;
+    int q;
+    int t;
+    int j;
+
+    p = &func->instr.instrs[pos];
+    type = func->reg.regs[p->result.reg[0]].type;
+    bits = _bits(func, p->result.reg[0]);
+    unsig = ir_reg_type_unsigned(type);
+    d = ir_reg_type_ext(type, (int64_t)p->operands[1].u.imm.u.u64);
+    if ( d == 0
+         || (!unsig && d == _sext((uint64_t)1 << (bits - 1), bits)) ) {
+        /* Trap, or the minimum value */
+        return 0;
+    }
+    x = p->operands[0];
+    if ( ir_reg_type_bits(type) < bits ) {
+        /* The magic number of 32 bits does not fit a narrower register, so
+           the dividend is extended to 32 bits, and the results are
+           truncated by the moves to the result registers */
+        type = unsig ? IR_REG_U32 : IR_REG_I32;
+        q = _emit(func, pos, IR_OPCODE_MOV, type, &x, NULL);
+        if ( q < 0 ) {
+            return -1;
+        }
+        ir_operand_reg(&x, q);
+    }
+    quot = -1;
+    rem = -1;
+    for ( j = 0; j < p->result.n; j++ ) {
+        if ( (p->opcode == IR_OPCODE_DIV) == (j == 0) ) {
+            quot = p->result.reg[j];
+        } else {
+            rem = p->result.reg[j];
+        }
+    }
+
+    if ( unsig ) {
+        q = _quotientu(func, pos, type, bits, &x, d, &t);
+    } else {
+        q = _quotient(func, pos, type, bits, &x, d, &t);
+    }
+    if ( q < 0 ) {
+        return -1;
+    }
+    if ( quot >= 0
+         && _insert(func, pos, IR_OPCODE_MOV, quot, ir_operand_reg(&a, q),
+                    NULL) < 0 ) {
+        return -1;
+    }
+    if ( rem >= 0 ) {
+        /* x - q * d, where q * d is the rounded dividend for a power of
+           two */
+        if ( t >= 0 ) {
+            ad = !unsig && d < 0 ? -(uint64_t)d : (uint64_t)d;
+            t = _emit(func, pos, IR_OPCODE_AND, type, ir_operand_reg(&a, t),
+                      ir_operand_imm(&b, IR_IMM_I64, ~(ad - 1)));
+        } else {
+            t = _emit(func, pos, IR_OPCODE_MUL, type, ir_operand_reg(&a, q),
+                      ir_operand_imm(&b, IR_IMM_I64, d));
+        }
+        if ( t < 0 ) {
+            return -1;
+        }
+        if ( _insert(func, pos, IR_OPCODE_SUB, rem, &x,
+                     ir_operand_reg(&b, t)) < 0 ) {
+            return -1;
+        }
+    }
+    ir_instr_remove(func, pos);
+
+    return 0;
+}
+
+/*
+ * ir_func_divmod -- lower the divisions and the modulos of a function in the
+ * SSA form; a division and a modulo of the same operands are computed by one
+ * instruction, and those by a constant are replaced with the multiplication
+ * by the reciprocal (or the shifts for a power of two)
+ */
+int
+ir_func_divmod(ir_func_t *func)
+{
+    ir_instr_t *p;
+    size_t n;
+    size_t i;
+
+    if ( !func->ssa ) {
+        return 0;
+    }
+    if ( _combine(func) < 0 ) {
+        return -1;
+    }
+
+    /* The instructions inserted are not divisions */
+    n = func->instr.n;
+    for ( i = 0; i < n; i++ ) {
+        p = &func->instr.instrs[i];
+        if ( p->block < 0
+             || (p->opcode != IR_OPCODE_DIV && p->opcode != IR_OPCODE_MOD)
+             || p->operands[0].type != OPERAND_TYPE_REG
+             || p->operands[1].type != OPERAND_TYPE_IMM ) {
+            continue;
+        }
+        if ( _reduce(func, i) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
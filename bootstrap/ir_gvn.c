@@ -0,0 +1,549 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Entry of the table of the available expressions; chained in a bucket by
+ * the index to the entries
+ */
+typedef struct {
+    int pos;            /* Instruction computing the expression */
+    uint32_t hash;
+    int next;
+} gvn_ent_t;
+
+/*
+ * Context of the value numbering
+ */
+typedef struct {
+    ir_func_t *func;
+    /* Representative register of the value of each register */
+    int *vn;
+    /* Scoped hash table; entries are popped when leaving the scope */
+    size_t nbuckets;
+    int *buckets;
+    struct {
+        size_t n;
+        size_t size;
+        gvn_ent_t *ents;
+    } ent;
+    /* Children in the dominator tree (children[off[b]] to [off[b + 1]]) */
+    int *off;
+    int *children;
+} gvn_ctx_t;
+
+/*
+ * _find -- get the representative register of the value
+ */
+static int
+_find(gvn_ctx_t *ctx, int r)
+{
+    while ( ctx->vn[r] != r ) {
+        r = ctx->vn[r];
+    }
+
+    return r;
+}
+
+/*
+ * _pure -- check if the instruction computes a value only from its operands
+ */
+static int
+_pure(const ir_instr_t *p)
+{
+    switch ( p->opcode ) {
+    case IR_OPCODE_MOV:
+    case IR_OPCODE_ADD:
+    case IR_OPCODE_SUB:
+    case IR_OPCODE_MUL:
+    case IR_OPCODE_DIV:
+    case IR_OPCODE_MOD:
+    case IR_OPCODE_MULH:
+    case IR_OPCODE_INC:
+    case IR_OPCODE_DEC:
+    case IR_OPCODE_NOT:
+    case IR_OPCODE_COMP:
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_AND:
+    case IR_OPCODE_OR:
+    case IR_OPCODE_XOR:
+    case IR_OPCODE_LSHIFT:
+    case IR_OPCODE_RSHIFT:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        return p->result.n == 1;
+    default:
+        return 0;
+    }
+}
+
+/*
+ * _commutative -- check if the operands of the opcode can be swapped
+ */
+static int
+_commutative(ir_opcode_t opcode)
+{
+    switch ( opcode ) {
+    case IR_OPCODE_ADD:
+    case IR_OPCODE_MUL:
+    case IR_OPCODE_MULH:
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_AND:
+    case IR_OPCODE_OR:
+    case IR_OPCODE_XOR:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/*
+ * _same -- check if two operands are the same value
+ */
+static int
+_same(const ir_operand_t *a, const ir_operand_t *b)
+{
+    if ( a->type != b->type ) {
+        return 0;
+    }
+    switch ( a->type ) {
+    case OPERAND_TYPE_REG:
+        return a->u.reg == b->u.reg;
+    case OPERAND_TYPE_IMM:
+        return a->u.imm.type == b->u.imm.type
+            && a->u.imm.u.u64 == b->u.imm.u.u64;
+    case OPERAND_TYPE_REF:
+        return a->u.ref.base == b->u.ref.base
+            && a->u.ref.index == b->u.ref.index
+            && a->u.ref.scale == b->u.ref.scale
+            && a->u.ref.disp == b->u.ref.disp;
+    default:
+        return 0;
+    }
+}
+
+/*
+ * _hash_operand -- compute the FNV-1a hash of an operand
+ */
+static uint32_t
+_hash_operand(const ir_operand_t *op)
+{
+    uint64_t vs[4];
+    uint32_t h;
+    int n;
+    int i;
+
+    vs[0] = op->type;
+    switch ( op->type ) {
+    case OPERAND_TYPE_REG:
+        vs[1] = op->u.reg;
+        n = 2;
+        break;
+    case OPERAND_TYPE_IMM:
+        vs[1] = op->u.imm.u.u64;
+        n = 2;
+        break;
+    case OPERAND_TYPE_REF:
+        vs[1] = ((uint64_t)op->u.ref.base << 32) | (uint32_t)op->u.ref.index;
+        vs[2] = op->u.ref.scale;
+        vs[3] = op->u.ref.disp;
+        n = 4;
+        break;
+    default:
+        n = 1;
+    }
+    h = 2166136261U;
+    for ( i = 0; i < n; i++ ) {
+        h ^= (uint32_t)vs[i] ^ (uint32_t)(vs[i] >> 32);
+        h *= 16777619U;
+    }
+
+    return h;
+}
+
+/*
+ * _hash -- compute the hash of the expression; the hashes of the operands of
+ * a commutative operation are combined independently of the order
+ */
+static uint32_t
+_hash(ir_func_t *func, const ir_instr_t *p)
+{
+    uint32_t h;
+    int j;
+
+    h = 2166136261U;
+    h ^= p->opcode;
+    h *= 16777619U;
+    h ^= func->reg.regs[p->result.reg[0]].type;
+    h *= 16777619U;
+    for ( j = 0; j < p->noperands; j++ ) {
+        if ( _commutative(p->opcode) ) {
+            h += _hash_operand(&p->operands[j]);
+        } else {
+            h ^= _hash_operand(&p->operands[j]);
+            h *= 16777619U;
+        }
+    }
+
+    return h;
+}
+
+/*
+ * _equal -- check if two instructions compute the same expression
+ */
+static int
+_equal(ir_func_t *func, const ir_instr_t *p, const ir_instr_t *q)
+{
+    int j;
+
+    if ( p->opcode != q->opcode || p->noperands != q->noperands
+         || func->reg.regs[p->result.reg[0]].type
+         != func->reg.regs[q->result.reg[0]].type ) {
+        return 0;
+    }
+    for ( j = 0; j < p->noperands; j++ ) {
+        if ( !_same(&p->operands[j], &q->operands[j]) ) {
+            break;
+        }
+    }
+    if ( j == p->noperands ) {
+        return 1;
+    }
+
+    return _commutative(p->opcode) && p->noperands == 2
+        && _same(&p->operands[0], &q->operands[1])
+        && _same(&p->operands[1], &q->operands[0]);
+}
+
+/*
+ * _lookup -- find the available instruction computing the same expression,
+ * or add the instruction to the table and return -1
+ */
+static int
+_lookup(gvn_ctx_t *ctx, int pos)
+{
+    ir_instr_t *instrs;
+    gvn_ent_t *ent;
+    uint32_t h;
+    size_t b;
+    int i;
+
+    instrs = ctx->func->instr.instrs;
+    h = _hash(ctx->func, &instrs[pos]);
+    b = h & (ctx->nbuckets - 1);
+    for ( i = ctx->buckets[b]; i >= 0; i = ctx->ent.ents[i].next ) {
+        ent = &ctx->ent.ents[i];
+        if ( ent->hash == h
+             && _equal(ctx->func, &instrs[ent->pos], &instrs[pos]) ) {
+            return ent->pos;
+        }
+    }
+
+    /* Not found; the table has an entry for each instruction at most */
+    ent = &ctx->ent.ents[ctx->ent.n];
+    ent->pos = pos;
+    ent->hash = h;
+    ent->next = ctx->buckets[b];
+    ctx->buckets[b] = ctx->ent.n++;
+
+    return -1;
+}
+
+/*
+ * _pop -- remove the entries added after the n-th entry in the reverse order
+ */
+static void
+_pop(gvn_ctx_t *ctx, size_t n)
+{
+    gvn_ent_t *ent;
+    size_t b;
+
+    while ( ctx->ent.n > n ) {
+        ent = &ctx->ent.ents[--ctx->ent.n];
+        b = ent->hash & (ctx->nbuckets - 1);
+        ctx->buckets[b] = ent->next;
+    }
+}
+
+/*
+ * _phi -- get the value of a PHI function if all the operands other than the
+ * result itself are the same register, or -1
+ */
+static int
+_phi(gvn_ctx_t *ctx, const ir_instr_t *p)
+{
+    int v;
+    int r;
+    int j;
+
+    v = -1;
+    for ( j = 0; j < p->noperands; j++ ) {
+        if ( p->operands[j].type != OPERAND_TYPE_REG ) {
+            return -1;
+        }
+        r = _find(ctx, p->operands[j].u.reg);
+        if ( r == p->result.reg[0] ) {
+            continue;
+        }
+        if ( v >= 0 && v != r ) {
+            return -1;
+        }
+        v = r;
+    }
+
+    return v;
+}
+
+/*
+ * _block -- number the values of the block; redundant instructions are
+ * removed and their results are mapped to the available ones
+ */
+static void
+_block(gvn_ctx_t *ctx, int block)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    int next;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int v;
+
+    func = ctx->func;
+    for ( pos = func->block.blocks[block].head; pos >= 0; pos = next ) {
+        p = &func->instr.instrs[pos];
+        next = p->next;
+
+        /* Replace the operands with the representatives */
+        for ( j = 0; j < p->noperands; j++ ) {
+            for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                  k++ ) {
+                if ( *r >= 0 ) {
+                    *r = _find(ctx, *r);
+                }
+            }
+        }
+
+        if ( p->opcode == IR_OPCODE_PHI ) {
+            v = _phi(ctx, p);
+        } else if ( p->opcode == IR_OPCODE_MOV
+                    && p->operands[0].type == OPERAND_TYPE_REG
+                    && func->reg.regs[p->operands[0].u.reg].type
+                    == func->reg.regs[p->result.reg[0]].type ) {
+            /* Copy */
+            v = p->operands[0].u.reg;
+        } else if ( _pure(p) ) {
+            v = _lookup(ctx, pos);
+            if ( v >= 0 ) {
+                v = func->instr.instrs[v].result.reg[0];
+            }
+        } else {
+            v = -1;
+        }
+        if ( v >= 0 ) {
+            ctx->vn[p->result.reg[0]] = v;
+            ir_instr_remove(func, pos);
+        }
+    }
+}
+
+/*
+ * _domtree -- build the children of each block in the dominator tree
+ */
+static int
+_domtree(gvn_ctx_t *ctx)
+{
+    ir_func_t *func;
+    size_t i;
+    int b;
+    int d;
+
+    func = ctx->func;
+    ctx->off = malloc(sizeof(int) * (func->block.n + 1));
+    ctx->children = malloc(sizeof(int) * (func->block.n + 1));
+    if ( ctx->off == NULL || ctx->children == NULL ) {
+        return -1;
+    }
+    memset(ctx->off, 0, sizeof(int) * (func->block.n + 1));
+    for ( i = 1; i < func->rpo.n; i++ ) {
+        d = func->block.blocks[func->rpo.blocks[i]].idom;
+        ctx->off[d + 1]++;
+    }
+    for ( i = 0; i < func->block.n; i++ ) {
+        ctx->off[i + 1] += ctx->off[i];
+    }
+    /* Fill in advancing off[d] to the end, and shift back to the heads */
+    for ( i = 1; i < func->rpo.n; i++ ) {
+        b = func->rpo.blocks[i];
+        d = func->block.blocks[b].idom;
+        ctx->children[ctx->off[d]++] = b;
+    }
+    for ( i = func->block.n; i > 0; i-- ) {
+        ctx->off[i] = ctx->off[i - 1];
+    }
+    ctx->off[0] = 0;
+
+    return 0;
+}
+
+/*
+ * _walk -- number the values in the preorder of the dominator tree, where
+ * the expressions computed in the dominators are available
+ */
+static int
+_walk(gvn_ctx_t *ctx)
+{
+    ir_func_t *func;
+    int *stack;
+    size_t *marks;
+    int *next;
+    ssize_t sp;
+    int b;
+    int c;
+
+    func = ctx->func;
+    stack = malloc(sizeof(int) * func->block.n * 2);
+    marks = malloc(sizeof(size_t) * func->block.n);
+    if ( stack == NULL || marks == NULL ) {
+        free(stack);
+        free(marks);
+        return -1;
+    }
+    next = stack + func->block.n;
+
+    sp = 0;
+    stack[0] = 0;
+    next[0] = ctx->off[0];
+    marks[0] = ctx->ent.n;
+    _block(ctx, 0);
+    while ( sp >= 0 ) {
+        b = stack[sp];
+        if ( next[sp] < ctx->off[b + 1] ) {
+            c = ctx->children[next[sp]++];
+            sp++;
+            stack[sp] = c;
+            next[sp] = ctx->off[c];
+            marks[sp] = ctx->ent.n;
+            _block(ctx, c);
+        } else {
+            _pop(ctx, marks[sp]);
+            sp--;
+        }
+    }
+    free(stack);
+    free(marks);
+
+    return 0;
+}
+
+/*
+ * ir_func_gvn -- eliminate the redundant computations of a function in the
+ * SSA form by the value numbering over the dominator tree; an expression of
+ * the same opcode and operands as the one computed in a dominator (and a
+ * copy, or a PHI function of a single value) is replaced with the available
+ * value
+ */
+int
+ir_func_gvn(ir_func_t *func)
+{
+    gvn_ctx_t ctx;
+    ir_instr_t *p;
+    size_t i;
+    int ret;
+    int *r;
+    int j;
+    int k;
+
+    if ( !func->ssa || func->block.n == 0 ) {
+        return 0;
+    }
+
+    memset(&ctx, 0, sizeof(gvn_ctx_t));
+    ctx.func = func;
+    ret = -1;
+    ctx.vn = malloc(sizeof(int) * (func->reg.n + 1));
+    ctx.ent.size = func->instr.n + 1;
+    ctx.ent.ents = malloc(sizeof(gvn_ent_t) * ctx.ent.size);
+    for ( ctx.nbuckets = 16; ctx.nbuckets < func->instr.n * 2;
+          ctx.nbuckets <<= 1 ) {
+    }
+    ctx.buckets = malloc(sizeof(int) * ctx.nbuckets);
+    if ( ctx.vn == NULL || ctx.ent.ents == NULL || ctx.buckets == NULL ) {
+        goto done;
+    }
+    for ( i = 0; i < func->reg.n; i++ ) {
+        ctx.vn[i] = i;
+    }
+    memset(ctx.buckets, 0xff, sizeof(int) * ctx.nbuckets);
+    if ( _domtree(&ctx) < 0 || _walk(&ctx) < 0 ) {
+        goto done;
+    }
+
+    /* Replace the remaining uses of the removed results, e.g., the operands
+       of the PHI functions from the back edges */
+    for ( i = 0; i < func->instr.n; i++ ) {
+        p = &func->instr.instrs[i];
+        if ( p->block < 0 ) {
+            continue;
+        }
+        for ( j = 0; j < p->noperands; j++ ) {
+            for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                  k++ ) {
+                if ( *r >= 0 ) {
+                    *r = _find(&ctx, *r);
+                }
+            }
+        }
+    }
+    ret = 0;
+
+done:
+    free(ctx.vn);
+    free(ctx.ent.ents);
+    free(ctx.buckets);
+    free(ctx.off);
+    free(ctx.children);
+
+    return ret;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,767 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Lattice value of a register; a register is undetermined (top) until its
+ * definition is evaluated, and is overdefined (bottom) once it is known to
+ * have more than one value
+ */
+typedef enum {
+    SCCP_TOP,
+    SCCP_CONST,
+    SCCP_BOTTOM,
+} sccp_state_t;
+typedef struct {
+    sccp_state_t state;
+    int64_t v;
+} sccp_val_t;
+
+/*
+ * Context of the sparse conditional constant propagation
+ */
+typedef struct {
+    ir_func_t *func;
+    /* Values of the registers */
+    sccp_val_t *vals;
+    /* Reached blocks */
+    uint8_t *reached;
+    /* Executable edges (bit k of a block for its k-th successor) */
+    uint8_t *edges;
+    /* Instructions reading each register (uses[off[r]] to uses[off[r + 1]]) */
+    int *off;
+    int *uses;
+    /* Instructions to be evaluated */
+    struct {
+        size_t n;
+        size_t size;
+        int *instrs;
+    } work;
+} sccp_ctx_t;
+
+/*
+ * _push -- add an instruction to the worklist
+ */
+static int
+_push(sccp_ctx_t *ctx, int pos)
+{
+    size_t nsize;
+    int *instrs;
+
+    if ( ctx->work.n >= ctx->work.size ) {
+        nsize = ctx->work.size ? ctx->work.size * 2 : IR_FUNC_INIT_SIZE;
+        instrs = realloc(ctx->work.instrs, sizeof(int) * nsize);
+        if ( instrs == NULL ) {
+            return -1;
+        }
+        ctx->work.instrs = instrs;
+        ctx->work.size = nsize;
+    }
+    ctx->work.instrs[ctx->work.n++] = pos;
+
+    return 0;
+}
+
+/*
+ * _uses -- build the lists of the instructions reading each register
+ */
+static int
+_uses(sccp_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    size_t i;
+    int *r;
+    int j;
+    int k;
+
+    func = ctx->func;
+    ctx->off = malloc(sizeof(int) * (func->reg.n + 1));
+    if ( ctx->off == NULL ) {
+        return -1;
+    }
+    memset(ctx->off, 0, sizeof(int) * (func->reg.n + 1));
+    for ( i = 0; i < func->instr.n; i++ ) {
+        p = &func->instr.instrs[i];
+        if ( p->block < 0 ) {
+            continue;
+        }
+        for ( j = 0; j < p->noperands; j++ ) {
+            for ( k = 0; (r = ir_operand_use(&p->operands[j], k)); k++ ) {
+                if ( *r >= 0 ) {
+                    ctx->off[*r + 1]++;
+                }
+            }
+        }
+    }
+    for ( i = 0; i < func->reg.n; i++ ) {
+        ctx->off[i + 1] += ctx->off[i];
+    }
+    ctx->uses = malloc(sizeof(int) * (ctx->off[func->reg.n] + 1));
+    if ( ctx->uses == NULL ) {
+        return -1;
+    }
+    /* Fill in the lists advancing off[r] to the end of each list, and then
+       shift them back to the heads */
+    for ( i = 0; i < func->instr.n; i++ ) {
+        p = &func->instr.instrs[i];
+        if ( p->block < 0 ) {
+            continue;
+        }
+        for ( j = 0; j < p->noperands; j++ ) {
+            for ( k = 0; (r = ir_operand_use(&p->operands[j], k)); k++ ) {
+                if ( *r >= 0 ) {
+                    ctx->uses[ctx->off[*r]++] = i;
+                }
+            }
+        }
+    }
+    for ( i = func->reg.n; i > 0; i-- ) {
+        ctx->off[i] = ctx->off[i - 1];
+    }
+    ctx->off[0] = 0;
+
+    return 0;
+}
+
+/*
+ * _bits -- get the width that the code generator computes the values of the
+ * register type in; the types narrower than 64 bits are computed in 32 bits
+ */
+static int
+_bits(ir_reg_type_t type)
+{
+    return ir_reg_type_bits(type) < 64 ? 32 : 64;
+}
+
+/*
+ * _imm -- get the value of an immediate
+ */
+static int64_t
+_imm(const ir_imm_t *imm)
+{
+    switch ( imm->type ) {
+    case IR_IMM_I8:
+        return imm->u.u8;
+    case IR_IMM_S8:
+        return imm->u.s8;
+    case IR_IMM_I16:
+        return imm->u.u16;
+    case IR_IMM_S16:
+        return imm->u.s16;
+    case IR_IMM_I32:
+        return imm->u.u32;
+    case IR_IMM_S32:
+        return imm->u.s32;
+    default:
+        return imm->u.s64;
+    }
+}
+
+/*
+ * _value -- get the lattice value of an operand
+ */
+static sccp_val_t
+_value(sccp_ctx_t *ctx, const ir_operand_t *op)
+{
+    sccp_val_t val;
+
+    switch ( op->type ) {
+    case OPERAND_TYPE_REG:
+        return ctx->vals[op->u.reg];
+    case OPERAND_TYPE_IMM:
+        val.state = SCCP_CONST;
+        val.v = _imm(&op->u.imm);
+        return val;
+    default:
+        val.state = SCCP_BOTTOM;
+        val.v = 0;
+        return val;
+    }
+}
+
+/*
+ * _meet -- compute the meet of two lattice values
+ */
+static sccp_val_t
+_meet(sccp_val_t a, sccp_val_t b)
+{
+    if ( a.state == SCCP_TOP ) {
+        return b;
+    }
+    if ( b.state == SCCP_TOP ) {
+        return a;
+    }
+    if ( a.state == SCCP_CONST && b.state == SCCP_CONST && a.v == b.v ) {
+        return a;
+    }
+    a.state = SCCP_BOTTOM;
+    a.v = 0;
+
+    return a;
+}
+
+/*
+ * _update -- lower the value of the register and revisit its uses if changed
+ */
+static int
+_update(sccp_ctx_t *ctx, int r, sccp_val_t val)
+{
+    sccp_val_t cur;
+    int i;
+
+    cur = ctx->vals[r];
+    val = _meet(cur, val);
+    if ( val.state == cur.state && val.v == cur.v ) {
+        return 0;
+    }
+    ctx->vals[r] = val;
+    for ( i = ctx->off[r]; i < ctx->off[r + 1]; i++ ) {
+        if ( _push(ctx, ctx->uses[i]) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _fold -- compute r = a op b of the register type, or return -1 if not
+ * foldable (e.g., division by zero, or an opcode without a constant result);
+ * the result is not truncated to the type of the result
+ */
+static int
+_fold(ir_opcode_t opcode, int64_t a, int64_t b, ir_reg_type_t type,
+      int64_t *r)
+{
+    uint64_t ua;
+    uint64_t ub;
+    int bits;
+
+    bits = _bits(type);
+    a = ir_reg_type_ext(type, a);
+    b = ir_reg_type_ext(type, b);
+    ua = a;
+    ub = b;
+    switch ( opcode ) {
+    case IR_OPCODE_MOV:
+        *r = a;
+        break;
+    case IR_OPCODE_ADD:
+        *r = ua + ub;
+        break;
+    case IR_OPCODE_SUB:
+        *r = ua - ub;
+        break;
+    case IR_OPCODE_MUL:
+        *r = ua * ub;
+        break;
+    case IR_OPCODE_DIV:
+    case IR_OPCODE_MOD:
+        /* Both trap on the processor */
+        if ( b == 0 ) {
+            return -1;
+        }
+        if ( ir_reg_type_unsigned(type) ) {
+            *r = opcode == IR_OPCODE_DIV ? ua / ub : ua % ub;
+            break;
+        }
+        if ( b == -1 && a == (bits < 64 ? INT32_MIN : INT64_MIN) ) {
+            return -1;
+        }
+        *r = opcode == IR_OPCODE_DIV ? a / b : a % b;
+        break;
+    case IR_OPCODE_INC:
+        *r = ua + 1;
+        break;
+    case IR_OPCODE_DEC:
+        *r = ua - 1;
+        break;
+    case IR_OPCODE_NOT:
+        *r = a == 0;
+        break;
+    case IR_OPCODE_COMP:
+        *r = ~ua;
+        break;
+    case IR_OPCODE_LAND:
+    case IR_OPCODE_AND:
+        /* Booleans are 0 or 1 */
+        *r = ua & ub;
+        break;
+    case IR_OPCODE_LOR:
+    case IR_OPCODE_OR:
+        *r = ua | ub;
+        break;
+    case IR_OPCODE_XOR:
+        *r = ua ^ ub;
+        break;
+    case IR_OPCODE_LSHIFT:
+        *r = ua << (b & (bits - 1));
+        break;
+    case IR_OPCODE_RSHIFT:
+        /* Logical shift for the unsigned types, and arithmetic otherwise */
+        if ( ir_reg_type_unsigned(type) ) {
+            *r = ua >> (b & (bits - 1));
+        } else {
+            *r = a >> (b & (bits - 1));
+        }
+        break;
+    case IR_OPCODE_CMP_EQ:
+        *r = a == b;
+        break;
+    case IR_OPCODE_CMP_NEQ:
+        *r = a != b;
+        break;
+    case IR_OPCODE_CMP_GT:
+        *r = ir_reg_type_unsigned(type) ? ua > ub : a > b;
+        break;
+    case IR_OPCODE_CMP_LT:
+        *r = ir_reg_type_unsigned(type) ? ua < ub : a < b;
+        break;
+    case IR_OPCODE_CMP_GEQ:
+        *r = ir_reg_type_unsigned(type) ? ua >= ub : a >= b;
+        break;
+    case IR_OPCODE_CMP_LEQ:
+        *r = ir_reg_type_unsigned(type) ? ua <= ub : a <= b;
+        break;
+    default:
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _in_edge -- get the executable-edge bit of the j-th incoming edge of the
+ * block; a predecessor branching to the block on both the edges appears twice
+ * in the predecessors
+ */
+static int
+_in_edge(sccp_ctx_t *ctx, int block, int j)
+{
+    ir_block_t *blocks;
+    int pred;
+    int dup;
+    int i;
+    int k;
+
+    blocks = ctx->func->block.blocks;
+    pred = blocks[block].pred.blocks[j];
+
+    /* Usually the predecessor branches to the block on one edge only, which
+       spares scanning the predecessors before the j-th one */
+    dup = -1;
+    for ( k = 0; k < blocks[pred].nsuccs; k++ ) {
+        if ( blocks[pred].succs[k] == block ) {
+            if ( dup >= 0 ) {
+                break;
+            }
+            dup = k;
+        }
+    }
+    if ( k >= blocks[pred].nsuccs ) {
+        return dup >= 0 ? ctx->edges[pred] & (1 << dup) : 0;
+    }
+
+    dup = 0;
+    for ( i = 0; i < j; i++ ) {
+        if ( blocks[block].pred.blocks[i] == pred ) {
+            dup++;
+        }
+    }
+    for ( k = 0; k < blocks[pred].nsuccs; k++ ) {
+        if ( blocks[pred].succs[k] == block && dup-- == 0 ) {
+            return ctx->edges[pred] & (1 << k);
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _mark -- mark the k-th outgoing edge of the block executable; the
+ * destination is evaluated entirely when first reached, or its PHI functions
+ * otherwise
+ */
+static int
+_mark(sccp_ctx_t *ctx, int block, int k)
+{
+    ir_func_t *func;
+    int succ;
+    int pos;
+
+    func = ctx->func;
+    if ( ctx->edges[block] & (1 << k) ) {
+        return 0;
+    }
+    ctx->edges[block] |= 1 << k;
+    succ = func->block.blocks[block].succs[k];
+    for ( pos = func->block.blocks[succ].head; pos >= 0;
+          pos = func->instr.instrs[pos].next ) {
+        if ( ctx->reached[succ]
+             && func->instr.instrs[pos].opcode != IR_OPCODE_PHI ) {
+            break;
+        }
+        if ( _push(ctx, pos) < 0 ) {
+            return -1;
+        }
+    }
+    ctx->reached[succ] = 1;
+
+    return 0;
+}
+
+/*
+ * _visit -- evaluate an instruction
+ */
+static int
+_visit(sccp_ctx_t *ctx, int pos)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    sccp_val_t a;
+    sccp_val_t b;
+    sccp_val_t val;
+    ir_reg_type_t type;
+    int64_t r;
+    int j;
+
+    func = ctx->func;
+    p = &func->instr.instrs[pos];
+    if ( !ctx->reached[p->block] ) {
+        return 0;
+    }
+
+    switch ( p->opcode ) {
+    case IR_OPCODE_PHI:
+        /* Meet over the executable incoming edges */
+        val.state = SCCP_TOP;
+        val.v = 0;
+        for ( j = 0; j < p->noperands; j++ ) {
+            if ( _in_edge(ctx, p->block, j) ) {
+                val = _meet(val, _value(ctx, &p->operands[j]));
+            }
+        }
+        return _update(ctx, p->result.reg[0], val);
+    case IR_OPCODE_JMP:
+        return _mark(ctx, p->block, 0);
+    case IR_OPCODE_BR:
+        a = _value(ctx, &p->operands[0]);
+        if ( a.state == SCCP_CONST ) {
+            return _mark(ctx, p->block, a.v != 0 ? 0 : 1);
+        } else if ( a.state == SCCP_BOTTOM ) {
+            if ( _mark(ctx, p->block, 0) < 0 ) {
+                return -1;
+            }
+            return _mark(ctx, p->block, 1);
+        }
+        return 0;
+    default:
+        break;
+    }
+    if ( p->result.n == 0 ) {
+        return 0;
+    }
+
+    /* The type of the computation */
+    type = func->reg.regs[p->result.reg[0]].type;
+    switch ( p->opcode ) {
+    case IR_OPCODE_NOT:
+    case IR_OPCODE_CMP_EQ:
+    case IR_OPCODE_CMP_NEQ:
+    case IR_OPCODE_CMP_GT:
+    case IR_OPCODE_CMP_LT:
+    case IR_OPCODE_CMP_GEQ:
+    case IR_OPCODE_CMP_LEQ:
+        /* Compare in the type of the register operand */
+        type = IR_REG_I64;
+        for ( j = 0; j < p->noperands; j++ ) {
+            if ( p->operands[j].type == OPERAND_TYPE_REG ) {
+                type = func->reg.regs[p->operands[j].u.reg].type;
+                break;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+
+    /* Evaluate the operands */
+    a.state = SCCP_BOTTOM;
+    a.v = 0;
+    b.state = SCCP_CONST;
+    b.v = 0;
+    if ( p->noperands >= 1 && p->noperands <= 2 ) {
+        a = _value(ctx, &p->operands[0]);
+    }
+    if ( p->noperands == 2 ) {
+        b = _value(ctx, &p->operands[1]);
+    }
+    if ( a.state == SCCP_TOP || b.state == SCCP_TOP ) {
+        /* Not yet determined */
+        return 0;
+    }
+    val.state = SCCP_BOTTOM;
+    val.v = 0;
+    if ( a.state == SCCP_CONST && b.state == SCCP_CONST
+         && _fold(p->opcode, a.v, b.v, type, &r) == 0 ) {
+        val.state = SCCP_CONST;
+        val.v = ir_reg_type_ext(func->reg.regs[p->result.reg[0]].type, r);
+    }
+    if ( _update(ctx, p->result.reg[0], val) < 0 ) {
+        return -1;
+    }
+    if ( p->result.n < 2 ) {
+        return 0;
+    }
+
+    /* The other result of the division */
+    if ( val.state == SCCP_CONST
+         && (p->opcode == IR_OPCODE_DIV || p->opcode == IR_OPCODE_MOD) ) {
+        _fold(p->opcode == IR_OPCODE_DIV ? IR_OPCODE_MOD : IR_OPCODE_DIV,
+              a.v, b.v, type, &r);
+        val.v = ir_reg_type_ext(func->reg.regs[p->result.reg[1]].type, r);
+    } else {
+        val.state = SCCP_BOTTOM;
+        val.v = 0;
+    }
+
+    return _update(ctx, p->result.reg[1], val);
+}
+
+/*
+ * _propagate -- propagate the constants over the executable edges from the
+ * entry
+ */
+static int
+_propagate(sccp_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    size_t i;
+    int j;
+
+    func = ctx->func;
+
+    /* Registers without a definition hold the values at the entry (e.g.,
+       arguments), which are unknown */
+    for ( i = 0; i < func->reg.n; i++ ) {
+        ctx->vals[i].state = SCCP_BOTTOM;
+        ctx->vals[i].v = 0;
+    }
+    for ( i = 0; i < func->instr.n; i++ ) {
+        p = &func->instr.instrs[i];
+        if ( p->block < 0 ) {
+            continue;
+        }
+        for ( j = 0; j < p->result.n; j++ ) {
+            ctx->vals[p->result.reg[j]].state = SCCP_TOP;
+        }
+    }
+
+    /* Start from the entry */
+    ctx->reached[0] = 1;
+    for ( j = func->block.blocks[0].head; j >= 0;
+          j = func->instr.instrs[j].next ) {
+        if ( _push(ctx, j) < 0 ) {
+            return -1;
+        }
+    }
+    while ( ctx->work.n > 0 ) {
+        if ( _visit(ctx, ctx->work.instrs[--ctx->work.n]) < 0 ) {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _prune -- remove the operands of the PHI functions for the edges never
+ * executed, in the order of the predecessors
+ */
+static void
+_prune(sccp_ctx_t *ctx, int block)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    int pos;
+    int n;
+    int j;
+
+    func = ctx->func;
+    for ( pos = func->block.blocks[block].head; pos >= 0; pos = p->next ) {
+        p = &func->instr.instrs[pos];
+        if ( p->opcode != IR_OPCODE_PHI ) {
+            break;
+        }
+        n = 0;
+        for ( j = 0; j < p->noperands; j++ ) {
+            if ( _in_edge(ctx, block, j) ) {
+                p->operands[n++] = p->operands[j];
+            }
+        }
+        p->noperands = n;
+    }
+}
+
+/*
+ * _rewrite -- replace the constant registers with immediate values, remove
+ * their definitions, and resolve the constant branches
+ */
+static int
+_rewrite(sccp_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    sccp_val_t val;
+    size_t b;
+    int next;
+    int pos;
+    int j;
+
+    func = ctx->func;
+
+    /* PHI operands must be pruned with the current predecessors */
+    for ( b = 0; b < func->block.n; b++ ) {
+        if ( ctx->reached[b] ) {
+            _prune(ctx, b);
+        }
+    }
+
+    for ( b = 0; b < func->block.n; b++ ) {
+        if ( !ctx->reached[b] ) {
+            continue;
+        }
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = next ) {
+            p = &func->instr.instrs[pos];
+            next = p->next;
+            for ( j = 0; j < p->result.n; j++ ) {
+                if ( ctx->vals[p->result.reg[j]].state != SCCP_CONST ) {
+                    break;
+                }
+            }
+            if ( p->result.n > 0 && j == p->result.n ) {
+                /* All the results are constants */
+                ir_instr_remove(func, pos);
+                continue;
+            }
+            for ( j = 0; j < p->noperands; j++ ) {
+                if ( p->operands[j].type != OPERAND_TYPE_REG ) {
+                    continue;
+                }
+                val = ctx->vals[p->operands[j].u.reg];
+                if ( val.state == SCCP_CONST ) {
+                    ir_operand_imm(&p->operands[j], IR_IMM_I64, val.v);
+                }
+            }
+            if ( p->opcode == IR_OPCODE_BR
+                 && p->operands[0].type == OPERAND_TYPE_IMM ) {
+                /* Take the executable edge */
+                p->opcode = IR_OPCODE_JMP;
+                p->noperands = 1;
+                p->operands[0]
+                    = p->operands[ctx->edges[b] & 1 ? 1 : 2];
+            }
+        }
+    }
+
+    /* The blocks never reached are emptied */
+    if ( ir_func_cfg(func) < 0 ) {
+        return -1;
+    }
+
+    /* PHI functions of a block with a single predecessor are copies */
+    for ( b = 0; b < func->block.n; b++ ) {
+        if ( func->block.blocks[b].pred.n != 1 ) {
+            continue;
+        }
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode != IR_OPCODE_PHI ) {
+                break;
+            }
+            p->opcode = IR_OPCODE_MOV;
+        }
+    }
+
+    return ir_func_dom(func);
+}
+
+/*
+ * ir_func_sccp -- fold the constants of a function in the SSA form by the
+ * sparse conditional constant propagation; the computations of constant
+ * values are removed, their uses are replaced with immediate values, and
+ * the branches never taken are removed with the blocks only reached by them
+ */
+int
+ir_func_sccp(ir_func_t *func)
+{
+    sccp_ctx_t ctx;
+    int ret;
+
+    if ( !func->ssa || func->block.n == 0 ) {
+        return 0;
+    }
+
+    memset(&ctx, 0, sizeof(sccp_ctx_t));
+    ctx.func = func;
+    ret = -1;
+    ctx.vals = malloc(sizeof(sccp_val_t) * (func->reg.n + 1));
+    ctx.reached = malloc(func->block.n);
+    ctx.edges = malloc(func->block.n);
+    if ( ctx.vals == NULL || ctx.reached == NULL || ctx.edges == NULL ) {
+        goto done;
+    }
+    memset(ctx.reached, 0, func->block.n);
+    memset(ctx.edges, 0, func->block.n);
+    if ( _uses(&ctx) < 0 ) {
+        goto done;
+    }
+    if ( _propagate(&ctx) < 0 ) {
+        goto done;
+    }
+    ret = _rewrite(&ctx);
+
+done:
+    free(ctx.vals);
+    free(ctx.reached);
+    free(ctx.edges);
+    free(ctx.off);
+    free(ctx.uses);
+    free(ctx.work.instrs);
+
+    return ret;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
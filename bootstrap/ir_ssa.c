@@ -0,0 +1,712 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ir.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * List of block indices
+ */
+typedef struct {
+    size_t n;
+    size_t size;
+    int *blocks;
+} ir_ssa_list_t;
+
+/*
+ * Context of the renaming
+ */
+typedef struct {
+    ir_func_t *func;
+    /* Number of the registers before the renaming */
+    size_t nregs;
+    /* Current version of each register */
+    int *top;
+    /* Log of the overwritten versions to restore them on the way back */
+    struct {
+        size_t n;
+        size_t size;
+        int *ents;              /* Pairs of a register and its old version */
+    } log;
+    /* Original register of each phi instruction */
+    int *phivar;
+    /* Dominator tree */
+    int *child;
+    int *sibling;
+} ir_ssa_rename_t;
+
+/*
+ * _list_add -- add a block to the list
+ */
+static int
+_list_add(ir_ssa_list_t *l, int b)
+{
+    size_t nsize;
+    int *blocks;
+
+    if ( l->n >= l->size ) {
+        nsize = l->size ? l->size * 2 : 4;
+        blocks = realloc(l->blocks, sizeof(int) * nsize);
+        if ( blocks == NULL ) {
+            return -1;
+        }
+        l->blocks = blocks;
+        l->size = nsize;
+    }
+    l->blocks[l->n++] = b;
+
+    return 0;
+}
+
+/*
+ * _lists_delete -- release the lists
+ */
+static void
+_lists_delete(ir_ssa_list_t *lists, size_t n)
+{
+    size_t i;
+
+    for ( i = 0; i < n; i++ ) {
+        free(lists[i].blocks);
+    }
+    free(lists);
+}
+
+/*
+ * _frontiers -- compute the dominance frontier of each block
+ */
+static ir_ssa_list_t *
+_frontiers(ir_func_t *func)
+{
+    ir_ssa_list_t *df;
+    ir_block_t *b;
+    size_t i;
+    size_t k;
+    int runner;
+
+    df = malloc(sizeof(ir_ssa_list_t) * func->block.n);
+    if ( df == NULL ) {
+        return NULL;
+    }
+    memset(df, 0, sizeof(ir_ssa_list_t) * func->block.n);
+
+    for ( i = 0; i < func->block.n; i++ ) {
+        b = &func->block.blocks[i];
+        if ( b->pred.n < 2 ) {
+            continue;
+        }
+        for ( k = 0; k < b->pred.n; k++ ) {
+            runner = b->pred.blocks[k];
+            while ( runner >= 0 && runner != b->idom ) {
+                if ( df[runner].n == 0
+                     || df[runner].blocks[df[runner].n - 1] != (int)i ) {
+                    if ( _list_add(&df[runner], i) < 0 ) {
+                        _lists_delete(df, func->block.n);
+                        return NULL;
+                    }
+                }
+                runner = func->block.blocks[runner].idom;
+            }
+        }
+    }
+
+    return df;
+}
+
+/*
+ * _insert_phis -- insert phi instructions for the registers that are live
+ * across blocks (semi-pruned SSA)
+ */
+static int
+_insert_phis(ir_func_t *func, ir_ssa_list_t *df)
+{
+    ir_ssa_list_t *defs;
+    ir_ssa_list_t work;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_block_t *b;
+    ir_operand_t *ops;
+    size_t nregs;
+    size_t nblocks;
+    size_t npreds;
+    size_t r;
+    size_t i;
+    size_t k;
+    char *global;
+    int *killed;
+    int *hasphi;
+    int *inwork;
+    int *reg;
+    int pos;
+    int d;
+    int j;
+
+    nregs = func->reg.n;
+    nblocks = func->block.n;
+    npreds = 0;
+    for ( i = 0; i < nblocks; i++ ) {
+        if ( func->block.blocks[i].pred.n > npreds ) {
+            npreds = func->block.blocks[i].pred.n;
+        }
+    }
+    defs = malloc(sizeof(ir_ssa_list_t) * nregs);
+    global = malloc(nregs);
+    killed = malloc(sizeof(int) * (nregs + nblocks * 2));
+    /* Operands of a phi instruction, one for each predecessor */
+    ops = malloc(sizeof(ir_operand_t) * (npreds + 1));
+    if ( defs == NULL || global == NULL || killed == NULL || ops == NULL ) {
+        free(defs);
+        free(global);
+        free(killed);
+        free(ops);
+        return -1;
+    }
+    memset(defs, 0, sizeof(ir_ssa_list_t) * nregs);
+    memset(global, 0, nregs);
+    hasphi = killed + nregs;
+    inwork = hasphi + nblocks;
+    for ( r = 0; r < nregs; r++ ) {
+        killed[r] = -1;
+    }
+    for ( i = 0; i < nblocks; i++ ) {
+        hasphi[i] = -1;
+        inwork[i] = -1;
+    }
+    memset(&work, 0, sizeof(ir_ssa_list_t));
+
+    /* Find the registers used before defined in a block, and the blocks
+       defining each register */
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        b = &func->block.blocks[func->rpo.blocks[i]];
+        for ( pos = b->head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0;
+                      (reg = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *reg >= 0 && killed[*reg] != func->rpo.blocks[i] ) {
+                        global[*reg] = 1;
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                r = p->result.reg[j];
+                if ( killed[r] != func->rpo.blocks[i] ) {
+                    killed[r] = func->rpo.blocks[i];
+                    if ( _list_add(&defs[r], func->rpo.blocks[i]) < 0 ) {
+                        goto error;
+                    }
+                }
+            }
+        }
+    }
+
+    /* Place the phi instructions on the iterated dominance frontiers */
+    for ( r = 0; r < nregs; r++ ) {
+        if ( !global[r] ) {
+            continue;
+        }
+        work.n = 0;
+        for ( i = 0; i < defs[r].n; i++ ) {
+            inwork[defs[r].blocks[i]] = r;
+            if ( _list_add(&work, defs[r].blocks[i]) < 0 ) {
+                goto error;
+            }
+        }
+        while ( work.n > 0 ) {
+            j = work.blocks[--work.n];
+            for ( i = 0; i < df[j].n; i++ ) {
+                d = df[j].blocks[i];
+                if ( hasphi[d] == (int)r ) {
+                    continue;
+                }
+                b = &func->block.blocks[d];
+                ir_instr_init(&instr, IR_OPCODE_PHI, ops);
+                instr.result.n = 1;
+                instr.result.reg[0] = r;
+                instr.noperands = b->pred.n;
+                for ( k = 0; k < b->pred.n; k++ ) {
+                    ir_operand_reg(&instr.operands[k], r);
+                }
+                /* Insert after the phi instructions at the head */
+                for ( pos = b->head;
+                      func->instr.instrs[pos].opcode == IR_OPCODE_PHI;
+                      pos = func->instr.instrs[pos].next ) {
+                }
+                if ( ir_instr_insert_before(func, pos, &instr) < 0 ) {
+                    goto error;
+                }
+                hasphi[d] = r;
+                if ( inwork[d] != (int)r ) {
+                    inwork[d] = r;
+                    if ( _list_add(&work, d) < 0 ) {
+                        goto error;
+                    }
+                }
+            }
+        }
+    }
+
+    free(work.blocks);
+    _lists_delete(defs, nregs);
+    free(global);
+    free(killed);
+    free(ops);
+    return 0;
+
+error:
+    free(work.blocks);
+    _lists_delete(defs, nregs);
+    free(global);
+    free(killed);
+    free(ops);
+    return -1;
+}
+
+/*
+ * _push -- set a new version of the register and log the old one
+ */
+static int
+_push(ir_ssa_rename_t *ctx, int r, int v)
+{
+    size_t nsize;
+    int *ents;
+
+    if ( ctx->log.n + 2 > ctx->log.size ) {
+        nsize = ctx->log.size ? ctx->log.size * 2 : 64;
+        ents = realloc(ctx->log.ents, sizeof(int) * nsize);
+        if ( ents == NULL ) {
+            return -1;
+        }
+        ctx->log.ents = ents;
+        ctx->log.size = nsize;
+    }
+    ctx->log.ents[ctx->log.n++] = r;
+    ctx->log.ents[ctx->log.n++] = ctx->top[r];
+    ctx->top[r] = v;
+
+    return 0;
+}
+
+/*
+ * _rename -- rename the registers in the block and the blocks dominated by it
+ */
+static int
+_rename(ir_ssa_rename_t *ctx, int block)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    ir_block_t *b;
+    ir_reg_type_t type;
+    const char *id;
+    size_t mark;
+    int pos;
+    int *reg;
+    int r;
+    int v;
+    int i;
+    int j;
+    int k;
+    int s;
+    int c;
+
+    func = ctx->func;
+    mark = ctx->log.n;
+    for ( pos = func->block.blocks[block].head; pos >= 0; pos = p->next ) {
+        p = &func->instr.instrs[pos];
+        if ( p->opcode != IR_OPCODE_PHI ) {
+            /* Uses */
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0;
+                      (reg = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *reg >= 0 ) {
+                        *reg = ctx->top[*reg];
+                    }
+                }
+            }
+        }
+        /* Definitions */
+        for ( j = 0; j < p->result.n; j++ ) {
+            r = p->result.reg[j];
+            type = func->reg.regs[r].type;
+            id = func->reg.regs[r].id;
+            v = ir_func_reg_new(func, type, id);
+            if ( v < 0 ) {
+                return -1;
+            }
+            if ( _push(ctx, r, v) < 0 ) {
+                return -1;
+            }
+            p->result.reg[j] = v;
+        }
+    }
+
+    /* Fill the operands of the phi instructions in the successors */
+    b = &func->block.blocks[block];
+    for ( i = 0; i < b->nsuccs; i++ ) {
+        s = b->succs[i];
+        /* Find the i-th edge from this block */
+        c = (i == 1 && b->succs[0] == s) ? 1 : 0;
+        for ( j = 0; j < (int)func->block.blocks[s].pred.n; j++ ) {
+            if ( func->block.blocks[s].pred.blocks[j] == block && c-- == 0 ) {
+                break;
+            }
+        }
+        for ( pos = func->block.blocks[s].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode != IR_OPCODE_PHI ) {
+                break;
+            }
+            ir_operand_reg(&p->operands[j], ctx->top[ctx->phivar[pos]]);
+        }
+    }
+
+    /* Blocks immediately dominated by this block */
+    for ( c = ctx->child[block]; c >= 0; c = ctx->sibling[c] ) {
+        if ( _rename(ctx, c) < 0 ) {
+            return -1;
+        }
+    }
+
+    /* Restore the versions */
+    while ( ctx->log.n > mark ) {
+        ctx->log.n -= 2;
+        ctx->top[ctx->log.ents[ctx->log.n]] = ctx->log.ents[ctx->log.n + 1];
+    }
+
+    return 0;
+}
+
+/*
+ * ir_func_to_ssa -- convert the function to the SSA form; the original
+ * registers stand for the values at the entry (e.g., the arguments), and
+ * every definition gets a new register
+ */
+int
+ir_func_to_ssa(ir_func_t *func)
+{
+    ir_ssa_rename_t ctx;
+    ir_ssa_list_t *df;
+    size_t nblocks;
+    size_t i;
+    int b;
+    int d;
+    int ret;
+
+    if ( func->ssa || func->block.n == 0 ) {
+        return 0;
+    }
+
+    /* Control flow graph and dominator tree */
+    if ( ir_func_cfg(func) < 0 ) {
+        return -1;
+    }
+    if ( ir_func_dom(func) < 0 ) {
+        return -1;
+    }
+
+    /* Insert phi instructions */
+    nblocks = func->block.n;
+    df = _frontiers(func);
+    if ( df == NULL ) {
+        return -1;
+    }
+    ret = _insert_phis(func, df);
+    _lists_delete(df, nblocks);
+    if ( ret < 0 ) {
+        return -1;
+    }
+
+    /* Prepare the renaming */
+    memset(&ctx, 0, sizeof(ir_ssa_rename_t));
+    ctx.func = func;
+    ctx.nregs = func->reg.n;
+    ctx.top = malloc(sizeof(int) * ctx.nregs);
+    ctx.phivar = malloc(sizeof(int) * func->instr.n);
+    ctx.child = malloc(sizeof(int) * nblocks * 2);
+    if ( ctx.top == NULL || ctx.phivar == NULL || ctx.child == NULL ) {
+        free(ctx.top);
+        free(ctx.phivar);
+        free(ctx.child);
+        return -1;
+    }
+    ctx.sibling = ctx.child + nblocks;
+    for ( i = 0; i < ctx.nregs; i++ ) {
+        ctx.top[i] = i;
+    }
+    for ( i = 0; i < func->instr.n; i++ ) {
+        ctx.phivar[i] = func->instr.instrs[i].opcode == IR_OPCODE_PHI
+            ? func->instr.instrs[i].result.reg[0] : -1;
+    }
+    for ( i = 0; i < nblocks; i++ ) {
+        ctx.child[i] = -1;
+        ctx.sibling[i] = -1;
+    }
+    /* Children in the reverse postorder */
+    for ( i = func->rpo.n; i > 1; i-- ) {
+        b = func->rpo.blocks[i - 1];
+        d = func->block.blocks[b].idom;
+        ctx.sibling[b] = ctx.child[d];
+        ctx.child[d] = b;
+    }
+
+    /* Rename the registers along the dominator tree */
+    ret = _rename(&ctx, func->rpo.blocks[0]);
+    free(ctx.top);
+    free(ctx.phivar);
+    free(ctx.child);
+    free(ctx.log.ents);
+    if ( ret < 0 ) {
+        return -1;
+    }
+    func->ssa = 1;
+
+    return 0;
+}
+
+/*
+ * _copies -- insert a parallel copy before the terminator of the block as a
+ * sequence of moves; a temporary register breaks a cycle of the copies
+ */
+static int
+_copies(ir_func_t *func, int block, int *dsts, ir_operand_t *srcs, int n)
+{
+    ir_instr_t instr;
+    ir_operand_t op;
+    int progress;
+    int i;
+    int j;
+    int t;
+
+    /* Drop the self-copies */
+    for ( i = 0; i < n; i++ ) {
+        if ( srcs[i].type == OPERAND_TYPE_REG && srcs[i].u.reg == dsts[i] ) {
+            dsts[i] = -1;
+        }
+    }
+
+    for ( ;; ) {
+        progress = 0;
+        for ( i = 0; i < n; i++ ) {
+            if ( dsts[i] < 0 ) {
+                continue;
+            }
+            /* Check if the destination is still read by another copy */
+            for ( j = 0; j < n; j++ ) {
+                if ( j != i && dsts[j] >= 0
+                     && srcs[j].type == OPERAND_TYPE_REG
+                     && srcs[j].u.reg == dsts[i] ) {
+                    break;
+                }
+            }
+            if ( j < n ) {
+                continue;
+            }
+            ir_instr_init(&instr, IR_OPCODE_MOV, &srcs[i]);
+            instr.result.n = 1;
+            instr.result.reg[0] = dsts[i];
+            instr.noperands = 1;
+            if ( ir_instr_insert_before(func, func->block.blocks[block].tail,
+                                        &instr) < 0 ) {
+                return -1;
+            }
+            dsts[i] = -1;
+            progress = 1;
+        }
+        if ( progress ) {
+            continue;
+        }
+
+        /* All the remaining copies are in cycles */
+        for ( i = 0; i < n && dsts[i] < 0; i++ ) {
+        }
+        if ( i >= n ) {
+            break;
+        }
+        t = ir_func_reg_new(func, func->reg.regs[dsts[i]].type, NULL);
+        if ( t < 0 ) {
+            return -1;
+        }
+        ir_instr_init(&instr, IR_OPCODE_MOV, &op);
+        instr.result.n = 1;
+        instr.result.reg[0] = t;
+        instr.noperands = 1;
+        ir_operand_reg(&instr.operands[0], dsts[i]);
+        if ( ir_instr_insert_before(func, func->block.blocks[block].tail,
+                                    &instr) < 0 ) {
+            return -1;
+        }
+        for ( j = 0; j < n; j++ ) {
+            if ( dsts[j] >= 0 && srcs[j].type == OPERAND_TYPE_REG
+                 && srcs[j].u.reg == dsts[i] ) {
+                srcs[j].u.reg = t;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _split_edge -- insert a new block on the j-th incoming edge of the block
+ * and return it
+ */
+static int
+_split_edge(ir_func_t *func, int block, int j)
+{
+    ir_instr_t instr;
+    ir_operand_t op;
+    ir_instr_t *t;
+    ir_block_t *b;
+    int p;
+    int e;
+    int k;
+
+    e = ir_func_block_new(func);
+    if ( e < 0 ) {
+        return -1;
+    }
+    ir_instr_init(&instr, IR_OPCODE_JMP, &op);
+    instr.noperands = 1;
+    ir_operand_block(&instr.operands[0], block);
+    if ( ir_block_append(func, e, &instr) < 0 ) {
+        return -1;
+    }
+
+    /* Retarget the first branch of the predecessor still going to the
+       block; the edges from a predecessor are ordered */
+    b = &func->block.blocks[block];
+    p = b->pred.blocks[j];
+    t = &func->instr.instrs[func->block.blocks[p].tail];
+    for ( k = 0; k < t->noperands; k++ ) {
+        if ( t->operands[k].type == OPERAND_TYPE_BLOCK
+             && t->operands[k].u.block == block ) {
+            t->operands[k].u.block = e;
+            break;
+        }
+    }
+    for ( k = 0; k < func->block.blocks[p].nsuccs; k++ ) {
+        if ( func->block.blocks[p].succs[k] == block ) {
+            func->block.blocks[p].succs[k] = e;
+            break;
+        }
+    }
+    b->pred.blocks[j] = e;
+    func->block.blocks[e].nsuccs = 1;
+    func->block.blocks[e].succs[0] = block;
+
+    return e;
+}
+
+/*
+ * ir_func_from_ssa -- convert the function out of the SSA form by replacing
+ * the phi instructions with copies in the predecessors; the control flow
+ * graph must be up to date
+ */
+int
+ir_func_from_ssa(ir_func_t *func)
+{
+    ir_operand_t *srcs;
+    ir_instr_t *p;
+    int *dsts;
+    size_t nblocks;
+    size_t i;
+    size_t j;
+    int pos;
+    int n;
+    int e;
+
+    if ( !func->ssa ) {
+        return 0;
+    }
+
+    nblocks = func->block.n;
+    for ( i = 0; i < nblocks; i++ ) {
+        /* Count the phi instructions */
+        n = 0;
+        for ( pos = func->block.blocks[i].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode != IR_OPCODE_PHI ) {
+                break;
+            }
+            n++;
+        }
+        if ( n == 0 ) {
+            continue;
+        }
+        srcs = malloc((sizeof(ir_operand_t) + sizeof(int)) * n);
+        if ( srcs == NULL ) {
+            return -1;
+        }
+        dsts = (int *)(srcs + n);
+
+        for ( j = 0; j < func->block.blocks[i].pred.n; j++ ) {
+            e = func->block.blocks[i].pred.blocks[j];
+            if ( func->block.blocks[e].nsuccs > 1 ) {
+                /* Split the critical edge */
+                e = _split_edge(func, i, j);
+                if ( e < 0 ) {
+                    free(srcs);
+                    return -1;
+                }
+            }
+            n = 0;
+            for ( pos = func->block.blocks[i].head; pos >= 0; pos = p->next ) {
+                p = &func->instr.instrs[pos];
+                if ( p->opcode != IR_OPCODE_PHI ) {
+                    break;
+                }
+                dsts[n] = p->result.reg[0];
+                memcpy(&srcs[n], &p->operands[j], sizeof(ir_operand_t));
+                n++;
+            }
+            if ( _copies(func, e, dsts, srcs, n) < 0 ) {
+                free(srcs);
+                return -1;
+            }
+        }
+        free(srcs);
+
+        /* Remove the phi instructions */
+        while ( func->block.blocks[i].head >= 0
+                && func->instr.instrs[func->block.blocks[i].head].opcode
+                == IR_OPCODE_PHI ) {
+            ir_instr_remove(func, func->block.blocks[i].head);
+        }
+    }
+    func->ssa = 0;
+
+    /* Rebuild the control flow graph with the split edges */
+    return ir_func_cfg(func);
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -22,9 +22,11 @@
  */
 
 #include "../../arch.h"
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/uio.h>
 
 typedef uint32_t Elf32_Addr;
 typedef uint16_t Elf32_Half;
@@ -405,356 +407,544 @@ elf64_hash(const unsigned char *name)
 }
 
 /*
- * General export function
+ * String table
  */
-static int
-_export(FILE *fp, arch_code_t *code)
-{
+typedef struct {
+    size_t len;
+    size_t size;
+    char *s;
+} elf_strtab_t;
+
+/*
+ * Section; the data is referred to, not copied, and written as it is
+ */
+typedef struct {
+    Elf64_Shdr shdr;
+    const void *data;
+} elf_sect_t;
+
+/*
+ * Object builder; the sections are added in the order of the section header
+ * table, and the layout is computed once all the sections are added
+ */
+#define ELF_IOV_MAX     1024
+typedef struct {
     Elf64_Ehdr hdr;
-    char *strtab;
-    size_t strtablen;
-    ssize_t stroff;
-    char shstrtab[256];
-    size_t shstrtablen;
-    off_t shoff;
-    int i;
-    ssize_t nw;
-    int nsects;
-    Elf64_Sym *syms;
-    Elf64_Rela *rela;
+    struct {
+        int n;
+        int size;
+        elf_sect_t *sects;
+    } sect;
+    elf_strtab_t shstrtab;
+    elf_strtab_t strtab;
+    /* Section header table */
+    Elf64_Shdr *shdrs;
+} elf_builder_t;
+
+/* Zeros for the padding */
+static const uint8_t _zeros[16];
 
-    /* Build the sections */
-    shstrtablen = 0;
-    Elf64_Shdr shdr_null = {
-        .sh_name = 0,
-        .sh_type = SHT_NULL,
-        .sh_flags = 0,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 0,
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, "");
-    shstrtablen += strlen("") + 1;
-
-    Elf64_Shdr shdr_text = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_PROGBITS,
-        .sh_flags = SHF_ALLOC | SHF_EXECINSTR,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = code->text.size,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 8, /* 2^3 */
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, ".text");
-    shstrtablen += strlen(".text") + 1;
-
-    Elf64_Shdr shdr_rela = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_RELA,
-        .sh_flags = SHF_WRITE | SHF_ALLOC,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 6,         /* Symbol table reference by relocations */
-        .sh_info = 1,         /* Section index of section to which the
-                                 relocations apply */
-        .sh_addralign = 8, /* 2^3 */
-        .sh_entsize = sizeof(Elf64_Rela),
-    };
-    strcpy(shstrtab + shstrtablen, ".text.rela");
-    shstrtablen += strlen(".text.rela") + 1;
-
-    Elf64_Shdr shdr_data = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_PROGBITS,
-        .sh_flags = SHF_WRITE | SHF_ALLOC,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 1,
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, ".data");
-    shstrtablen += strlen(".data") + 1;
-
-    Elf64_Shdr shdr_bss = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_NOBITS,
-        .sh_flags = SHF_WRITE | SHF_ALLOC,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 1,
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, ".bss");
-    shstrtablen += strlen(".bss") + 1;
-
-    Elf64_Shdr shdr_shstrtab = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_STRTAB,
-        .sh_flags = 0,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0x100,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 1,
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, ".shstrtab");
-    shstrtablen += strlen(".shstrtab") + 1;
-
-    Elf64_Shdr shdr_symtab = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_SYMTAB,
-        .sh_flags = 0,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 7,
-        .sh_info = 4,           /* Index of first non-local symbol */
-        .sh_addralign = 1,
-        .sh_entsize = sizeof(Elf64_Sym),
-    };
-    strcpy(shstrtab + shstrtablen, ".symtab");
-    shstrtablen += strlen(".symtab") + 1;
-
-    Elf64_Shdr shdr_strtab = {
-        .sh_name = shstrtablen,
-        .sh_type = SHT_STRTAB,
-        .sh_flags = 0,
-        .sh_addr = 0,
-        .sh_offset = 0,
-        .sh_size = 0,
-        .sh_link = 0,
-        .sh_info = 0,
-        .sh_addralign = 1,
-        .sh_entsize = 0,
-    };
-    strcpy(shstrtab + shstrtablen, ".strtab");
-    shstrtablen += strlen(".strtab") + 1;
-
-    /* Align */
-    shstrtablen = ((shstrtablen + 7) / 8) * 8;
-
-    /* FIXME: Relocation */
-    rela = alloca(sizeof(Elf64_Rela) * 1);
-    if ( NULL == rela ) {
-        return -1;
+/*
+ * _strtab_add -- add a string to the string table and return the offset
+ */
+static ssize_t
+_strtab_add(elf_strtab_t *tab, const char *str)
+{
+    size_t len;
+    size_t nsize;
+    char *s;
+
+    len = strlen(str) + 1;
+    if ( tab->len + len > tab->size ) {
+        nsize = tab->size ? tab->size : 256;
+        while ( tab->len + len > nsize ) {
+            nsize <<= 1;
+        }
+        s = realloc(tab->s, nsize);
+        if ( NULL == s ) {
+            return -1;
+        }
+        tab->s = s;
+        tab->size = nsize;
     }
-    rela[0].r_offset = 27;
-    rela[0].r_info = ELF64_R_INFO(3, R_X86_64_PC32); /* .bss */
-    rela[0].r_addend = -4;
+    memcpy(tab->s + tab->len, str, len);
+    tab->len += len;
 
-    /* .strtab */
-    strtablen = 1;
-    for ( i = 0; i < code->sym.n; i++ ) {
-        /* Add the length of the label */
-        strtablen += strlen(code->sym.syms[i].label) + 1;
-    }
-    /* Align */
-    strtablen = ((strtablen + 7) / 8) * 8;
+    return tab->len - len;
+}
 
-    nsects = 8;
-    shdr_text.sh_offset = sizeof(Elf64_Ehdr);
+/*
+ * _builder_init -- initialize the builder with the null section
+ */
+static int
+_builder_init(elf_builder_t *b)
+{
+    memset(b, 0, sizeof(elf_builder_t));
 
-    /* Allocate */
-    strtab = alloca(strtablen);
-    if ( NULL == strtab ) {
+    /* Both string tables start with the null string */
+    if ( _strtab_add(&b->shstrtab, "") < 0
+         || _strtab_add(&b->strtab, "") < 0 ) {
         return -1;
     }
-    memset(strtab, 0, strtablen);
-    syms = alloca(sizeof(Elf64_Sym) * (code->sym.n + 4));
-    if ( NULL == syms ) {
+
+    /* Null section */
+    b->sect.size = 8;
+    b->sect.sects = malloc(sizeof(elf_sect_t) * b->sect.size);
+    if ( NULL == b->sect.sects ) {
         return -1;
     }
-    /* Null */
-    syms[0].st_name = 0;
-    syms[0].st_info = 0;
-    syms[0].st_other = 0;
-    syms[0].st_shndx = 0;
-    syms[0].st_value = 0;
-    syms[0].st_size = 0;
-
-    /* .text */
-    syms[1].st_name = 0;
-    syms[1].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
-    syms[1].st_other = 0;
-    syms[1].st_shndx = 1;
-    syms[1].st_value = shdr_text.sh_offset;
-    syms[1].st_size = 0;
+    memset(&b->sect.sects[0], 0, sizeof(elf_sect_t));
+    b->sect.n = 1;
 
-    /* .data */
-    syms[2].st_name = 0;
-    syms[2].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
-    syms[2].st_other = 0;
-    syms[2].st_shndx = 3;
-    syms[2].st_value = 0;
-    syms[2].st_size = 0;
+    return 0;
+}
 
-    /* .bss */
-    syms[3].st_name = 0;
-    syms[3].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
-    syms[3].st_other = 0;
-    syms[3].st_shndx = 4;
-    syms[3].st_value = 0;
-    syms[3].st_size = 0;
+/*
+ * _builder_release -- release the builder
+ */
+static void
+_builder_release(elf_builder_t *b)
+{
+    free(b->sect.sects);
+    free(b->shstrtab.s);
+    free(b->strtab.s);
+    free(b->shdrs);
+}
 
-    stroff = 1;
-    for ( i = 0; i < code->sym.n; i++ ) {
-        /* nlist_64: Describes an entry in the symbol table for 64-bit
-           architectures. */
-        syms[i + 4].st_name = stroff;
-        switch ( code->sym.syms[i].type ) {
-        case ARCH_SYM_LOCAL:
-            syms[i + 4].st_info = ELF64_ST_INFO(STB_LOCAL, STT_NOTYPE);
-            break;
-        case ARCH_SYM_GLOBAL:
-            syms[i + 4].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE);
-            break;
-        case ARCH_SYM_FUNC:
-            syms[i + 4].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_FUNC);
-            break;
-        default:
+/*
+ * _sect_add -- add a section and return the section index
+ */
+static int
+_sect_add(elf_builder_t *b, const char *name, Elf64_Word type,
+          Elf64_Xword flags, Elf64_Xword align, Elf64_Xword entsize,
+          const void *data, size_t size)
+{
+    elf_sect_t *sects;
+    elf_sect_t *s;
+    ssize_t off;
+    int nsize;
+
+    if ( b->sect.n >= b->sect.size ) {
+        nsize = b->sect.size << 1;
+        sects = realloc(b->sect.sects, sizeof(elf_sect_t) * nsize);
+        if ( NULL == sects ) {
             return -1;
         }
-        syms[i + 4].st_other = 0;
-        syms[i + 4].st_shndx = 1; /* .text */
-        syms[i + 4].st_value = code->sym.syms[i].pos;
-        syms[i + 4].st_size = code->sym.syms[i].size;
-
-        /* Symbol table */
-        strcpy(strtab + stroff, code->sym.syms[i].label);
-        stroff += strlen(code->sym.syms[i].label) + 1;
+        b->sect.sects = sects;
+        b->sect.size = nsize;
     }
+    off = _strtab_add(&b->shstrtab, name);
+    if ( off < 0 ) {
+        return -1;
+    }
+    s = &b->sect.sects[b->sect.n];
+    memset(s, 0, sizeof(elf_sect_t));
+    s->shdr.sh_name = off;
+    s->shdr.sh_type = type;
+    s->shdr.sh_flags = flags;
+    s->shdr.sh_size = size;
+    s->shdr.sh_addralign = align;
+    s->shdr.sh_entsize = entsize;
+    s->data = data;
+
+    return b->sect.n++;
+}
 
-    /* FIXME */
-    shdr_bss.sh_offset = sizeof(Elf64_Ehdr) + code->text.size;
-    shdr_bss.sh_size = 8;
-    shdr_rela.sh_offset = sizeof(Elf64_Ehdr) + code->text.size + 8;
-    shdr_rela.sh_size = sizeof(Elf64_Rela) * 1;
-    shoff = sizeof(Elf64_Ehdr) + code->text.size + 8 + sizeof(Elf64_Rela) * 1;
-    shdr_shstrtab.sh_offset = shoff + sizeof(Elf64_Shdr) * nsects;
-    shdr_shstrtab.sh_size = shstrtablen;
-    shdr_symtab.sh_offset = shdr_shstrtab.sh_offset + shstrtablen;
-    shdr_symtab.sh_size = sizeof(Elf64_Sym) * (code->sym.n + 4);
-    shdr_strtab.sh_offset = shdr_symtab.sh_offset + shdr_symtab.sh_size;
-    shdr_strtab.sh_size = strtablen;
+/*
+ * _align -- align the offset
+ */
+static off_t
+_align(off_t off, Elf64_Xword align)
+{
+    if ( align <= 1 ) {
+        return off;
+    }
 
-    /* ELF header */
-    hdr.e_ident[EI_MAG0] = '\x7f';
-    hdr.e_ident[EI_MAG1] = 'E';
-    hdr.e_ident[EI_MAG2] = 'L';
-    hdr.e_ident[EI_MAG3] = 'F';
-    hdr.e_ident[EI_CLASS] = ELFCLASS64;
-    hdr.e_ident[EI_DATA] = ELFDATA2LSB;
-    hdr.e_ident[EI_VERSION] = EV_CURRENT;
-    hdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
-    hdr.e_ident[EI_ABIVERSION] = 0;
-    hdr.e_ident[EI_PAD] = 0;
-    hdr.e_type = ET_REL;
-    hdr.e_machine = EM_X86_64;
-    hdr.e_version = 1;
-    hdr.e_entry = 0;
-    hdr.e_phoff = 0;
-    hdr.e_shoff = shoff;
-    hdr.e_flags = 0;
-    hdr.e_ehsize = sizeof(Elf64_Ehdr);
-    hdr.e_phentsize = 0;
-    hdr.e_phnum = 0;
-    hdr.e_shentsize = sizeof(Elf64_Shdr);
-    hdr.e_shnum = nsects;
-    hdr.e_shstrndx = 5;
-
-    /* Write the header */
-    nw = fwrite(&hdr, sizeof(Elf64_Ehdr), 1, fp);
-    if ( nw != 1 ) {
+    return (off + align - 1) / align * align;
+}
+
+/*
+ * _layout -- compute the offsets of the sections and the section header
+ * table, and build the section header table
+ */
+static off_t
+_layout(elf_builder_t *b)
+{
+    off_t off;
+    int i;
+
+    b->shdrs = malloc(sizeof(Elf64_Shdr) * b->sect.n);
+    if ( NULL == b->shdrs ) {
         return -1;
     }
+    off = sizeof(Elf64_Ehdr);
+    for ( i = 1; i < b->sect.n; i++ ) {
+        off = _align(off, b->sect.sects[i].shdr.sh_addralign);
+        b->sect.sects[i].shdr.sh_offset = off;
+        if ( SHT_NOBITS != b->sect.sects[i].shdr.sh_type ) {
+            off += b->sect.sects[i].shdr.sh_size;
+        }
+    }
+    off = _align(off, 8);
+    for ( i = 0; i < b->sect.n; i++ ) {
+        memcpy(&b->shdrs[i], &b->sect.sects[i].shdr, sizeof(Elf64_Shdr));
+    }
 
-    /* Write the program */
-    nw = fwrite(code->text.s, 1, code->text.size, fp);
-    if ( nw != (ssize_t)code->text.size ) {
-        return -1;
+    return off;
+}
+
+/*
+ * _writev -- write all the buffers; partial and interrupted writes are
+ * resumed
+ */
+static int
+_writev(int fd, struct iovec *iov, int n)
+{
+    ssize_t nw;
+    int cnt;
+
+    while ( n > 0 ) {
+        cnt = n < ELF_IOV_MAX ? n : ELF_IOV_MAX;
+        nw = writev(fd, iov, cnt);
+        if ( nw < 0 ) {
+            if ( EINTR == errno ) {
+                continue;
+            }
+            return -1;
+        }
+        /* Skip the written buffers */
+        while ( n > 0 && (size_t)nw >= iov->iov_len ) {
+            nw -= iov->iov_len;
+            iov++;
+            n--;
+        }
+        if ( n > 0 ) {
+            iov->iov_base = (uint8_t *)iov->iov_base + nw;
+            iov->iov_len -= nw;
+        }
     }
 
-    /* FIXME: Write the relocation */
-    uint8_t buf[8];
-    memset(buf, 0, 8);
-    nw = fwrite(buf, 1, 8, fp);
-    if ( nw != (ssize_t)8 ) {
+    return 0;
+}
+
+/*
+ * _write -- write the object; the header, the sections, and the section
+ * header table are gathered to a single write
+ */
+static int
+_write(FILE *fp, elf_builder_t *b, off_t shoff)
+{
+    struct iovec *iov;
+    off_t off;
+    off_t pad;
+    int ret;
+    int n;
+    int i;
+
+    iov = malloc(sizeof(struct iovec) * (b->sect.n * 2 + 2));
+    if ( NULL == iov ) {
         return -1;
     }
-    nw = fwrite(rela, sizeof(Elf64_Rela), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    n = 0;
+    iov[n].iov_base = &b->hdr;
+    iov[n].iov_len = sizeof(Elf64_Ehdr);
+    n++;
+    off = sizeof(Elf64_Ehdr);
+    for ( i = 1; i <= b->sect.n; i++ ) {
+        /* Padding to the next section or the section header table */
+        pad = (i < b->sect.n ? (off_t)b->sect.sects[i].shdr.sh_offset : shoff)
+            - off;
+        if ( pad > 0 ) {
+            iov[n].iov_base = (void *)_zeros;
+            iov[n].iov_len = pad;
+            n++;
+            off += pad;
+        }
+        if ( i == b->sect.n ) {
+            break;
+        }
+        if ( SHT_NOBITS == b->sect.sects[i].shdr.sh_type
+             || 0 == b->sect.sects[i].shdr.sh_size ) {
+            continue;
+        }
+        iov[n].iov_base = (void *)b->sect.sects[i].data;
+        iov[n].iov_len = b->sect.sects[i].shdr.sh_size;
+        n++;
+        off += b->sect.sects[i].shdr.sh_size;
+    }
+    iov[n].iov_base = b->shdrs;
+    iov[n].iov_len = sizeof(Elf64_Shdr) * b->sect.n;
+    n++;
+
+    /* Flush the buffered stream not to interleave */
+    ret = fflush(fp);
+    if ( 0 == ret ) {
+        ret = _writev(fileno(fp), iov, n);
     }
+    free(iov);
 
-    /* Write the section headers */
-    nw = fwrite(&shdr_null, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    return ret;
+}
+
+/*
+ * _symbols -- build the symbol table; the local symbols precede the others
+ * as required, and map is the index of each symbol of the code in the table;
+ * an external symbol defined in the code is mapped to the definition
+ */
+static Elf64_Sym *
+_symbols(elf_builder_t *b, arch_code_t *code, const arch_symidx_t *idx,
+         int *map, int *nlocal, int *nsyms, int text, int data, int bss)
+{
+    Elf64_Sym *syms;
+    ssize_t off;
+    int pass;
+    int n;
+    int i;
+
+    syms = malloc(sizeof(Elf64_Sym) * (code->sym.n + 4));
+    if ( NULL == syms ) {
+        return NULL;
     }
-    nw = fwrite(&shdr_text, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    memset(syms, 0, sizeof(Elf64_Sym) * 4);
+
+    /* Null and the section symbols */
+    syms[1].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    syms[1].st_shndx = text;
+    syms[2].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    syms[2].st_shndx = data;
+    syms[3].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    syms[3].st_shndx = bss;
+    n = 4;
+
+    for ( pass = 0; pass < 2; pass++ ) {
+        if ( 1 == pass ) {
+            *nlocal = n;
+        }
+        for ( i = 0; i < code->sym.n; i++ ) {
+            if ( (ARCH_SYM_LOCAL == code->sym.syms[i].type) != (0 == pass)
+                 || idx->res[i] != i ) {
+                continue;
+            }
+            off = _strtab_add(&b->strtab, code->sym.syms[i].label);
+            if ( off < 0 ) {
+                free(syms);
+                return NULL;
+            }
+            syms[n].st_name = off;
+            syms[n].st_other = 0;
+            syms[n].st_value = code->sym.syms[i].pos;
+            syms[n].st_size = code->sym.syms[i].size;
+            switch ( code->sym.syms[i].type ) {
+            case ARCH_SYM_LOCAL:
+                syms[n].st_info = ELF64_ST_INFO(STB_LOCAL, STT_OBJECT);
+                syms[n].st_shndx = bss;
+                break;
+            case ARCH_SYM_GLOBAL:
+                syms[n].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_OBJECT);
+                syms[n].st_shndx = data;
+                break;
+            case ARCH_SYM_FUNC:
+                syms[n].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_FUNC);
+                syms[n].st_shndx = text;
+                break;
+            case ARCH_SYM_EXTERN:
+                /* Undefined; resolved by the linker */
+                syms[n].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE);
+                syms[n].st_shndx = SHN_UNDEF;
+                syms[n].st_value = 0;
+                syms[n].st_size = 0;
+                break;
+            default:
+                free(syms);
+                return NULL;
+            }
+            map[i] = n;
+            n++;
+        }
     }
-    nw = fwrite(&shdr_rela, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    for ( i = 0; i < code->sym.n; i++ ) {
+        map[i] = map[idx->res[i]];
     }
-    nw = fwrite(&shdr_data, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    *nsyms = n;
+
+    return syms;
+}
+
+/*
+ * _relocations -- build the relocation entries of the text
+ */
+static Elf64_Rela *
+_relocations(arch_code_t *code, const int *map)
+{
+    Elf64_Rela *rela;
+    int sym;
+    int i;
+
+    rela = malloc(sizeof(Elf64_Rela) * (code->rel.n + 1));
+    if ( NULL == rela ) {
+        return NULL;
     }
-    nw = fwrite(&shdr_bss, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    for ( i = 0; i < code->rel.n; i++ ) {
+        sym = code->rel.rels[i].sym;
+        if ( sym < 0 || sym >= code->sym.n ) {
+            free(rela);
+            return NULL;
+        }
+        rela[i].r_offset = code->rel.rels[i].pos;
+        switch ( code->rel.rels[i].type ) {
+        case ARCH_REL_PC32:
+            rela[i].r_info = ELF64_R_INFO(map[sym], R_X86_64_PC32);
+            break;
+        case ARCH_REL_BRANCH:
+            rela[i].r_info = ELF64_R_INFO(map[sym], R_X86_64_PLT32);
+            break;
+        default:
+            free(rela);
+            return NULL;
+        }
+        /* The displacement is relative to the end of the 32-bit field */
+        rela[i].r_addend = -4;
     }
-    nw = fwrite(&shdr_shstrtab, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
+
+    return rela;
+}
+
+/*
+ * General export function
+ */
+static int
+_export(FILE *fp, arch_code_t *code)
+{
+    elf_builder_t b;
+    Elf64_Sym *syms;
+    Elf64_Rela *rela;
+    arch_symidx_t idx;
+    size_t bsssize;
+    off_t shoff;
+    int *map;
+    int nlocal;
+    int nsyms;
+    int text;
+    int relatext;
+    int data;
+    int bss;
+    int note;
+    int symtab;
+    int strtab;
+    int shstrtab;
+    int ret;
+    int i;
+
+    if ( _builder_init(&b) < 0 ) {
+        _builder_release(&b);
         return -1;
     }
-    nw = fwrite(&shdr_symtab, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
+    /* Resolve the labels; a label defined twice is rejected */
+    if ( arch_symidx_init(&idx, code) < 0 ) {
+        _builder_release(&b);
         return -1;
     }
-    nw = fwrite(&shdr_strtab, sizeof(Elf64_Shdr), 1, fp);
-    if ( nw != 1 ) {
-        return -1;
+    syms = NULL;
+    rela = NULL;
+    ret = -1;
+    map = malloc(sizeof(int) * (code->sym.n + 1));
+    if ( NULL == map ) {
+        goto error;
     }
 
-    /* Write the section header string table */
-    nw = fwrite(shstrtab, 1, shstrtablen, fp);
-    if ( nw != (ssize_t)shstrtablen ) {
-        return -1;
+    /* The size of the bss section covers the local symbols */
+    bsssize = 0;
+    for ( i = 0; i < code->sym.n; i++ ) {
+        if ( ARCH_SYM_LOCAL == code->sym.syms[i].type
+             && code->sym.syms[i].pos + code->sym.syms[i].size > bsssize ) {
+            bsssize = code->sym.syms[i].pos + code->sym.syms[i].size;
+        }
     }
 
-    /* Write the symbol headers */
-    nw = fwrite(syms, sizeof(Elf64_Sym), code->sym.n + 4, fp);
-    if ( nw != (ssize_t)(code->sym.n + 4) ) {
-        return -1;
+    /* Sections; the contents of the symbol and the relocation tables are
+       filled in once the indices of the sections are determined */
+    text = _sect_add(&b, ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+                     16, 0, code->text.s, code->text.size);
+    relatext = _sect_add(&b, ".rela.text", SHT_RELA, SHF_INFO, 8,
+                         sizeof(Elf64_Rela), NULL,
+                         sizeof(Elf64_Rela) * code->rel.n);
+    data = _sect_add(&b, ".data", SHT_PROGBITS, SHF_WRITE | SHF_ALLOC, 8, 0,
+                     code->data.s, code->data.size);
+    bss = _sect_add(&b, ".bss", SHT_NOBITS, SHF_WRITE | SHF_ALLOC, 8, 0,
+                    NULL, bsssize);
+    /* The empty note marks the stack not executable */
+    note = _sect_add(&b, ".note.GNU-stack", SHT_PROGBITS, 0, 1, 0, NULL, 0);
+    symtab = _sect_add(&b, ".symtab", SHT_SYMTAB, 0, 8, sizeof(Elf64_Sym),
+                       NULL, sizeof(Elf64_Sym) * (code->sym.n + 4));
+    strtab = _sect_add(&b, ".strtab", SHT_STRTAB, 0, 1, 0, NULL, 0);
+    shstrtab = _sect_add(&b, ".shstrtab", SHT_STRTAB, 0, 1, 0, NULL, 0);
+    if ( text < 0 || relatext < 0 || data < 0 || bss < 0 || note < 0
+         || symtab < 0 || strtab < 0 || shstrtab < 0 ) {
+        goto error;
     }
 
-    /* Write the string table */
-    nw = fwrite(strtab, 1, strtablen, fp);
-    if ( nw != (ssize_t)strtablen ) {
-        return -1;
+    /* Symbols and relocations */
+    syms = _symbols(&b, code, &idx, map, &nlocal, &nsyms, text, data, bss);
+    if ( NULL == syms ) {
+        goto error;
+    }
+    rela = _relocations(code, map);
+    if ( NULL == rela ) {
+        goto error;
+    }
+    b.sect.sects[relatext].data = rela;
+    b.sect.sects[relatext].shdr.sh_link = symtab;
+    b.sect.sects[relatext].shdr.sh_info = text;
+    b.sect.sects[symtab].data = syms;
+    b.sect.sects[symtab].shdr.sh_size = sizeof(Elf64_Sym) * nsyms;
+    b.sect.sects[symtab].shdr.sh_link = strtab;
+    b.sect.sects[symtab].shdr.sh_info = nlocal;
+    b.sect.sects[strtab].data = b.strtab.s;
+    b.sect.sects[strtab].shdr.sh_size = b.strtab.len;
+    b.sect.sects[shstrtab].data = b.shstrtab.s;
+    b.sect.sects[shstrtab].shdr.sh_size = b.shstrtab.len;
+
+    /* Layout */
+    shoff = _layout(&b);
+    if ( shoff < 0 ) {
+        goto error;
     }
 
-    return 0;
+    /* ELF header */
+    memset(&b.hdr, 0, sizeof(Elf64_Ehdr));
+    b.hdr.e_ident[EI_MAG0] = '\x7f';
+    b.hdr.e_ident[EI_MAG1] = 'E';
+    b.hdr.e_ident[EI_MAG2] = 'L';
+    b.hdr.e_ident[EI_MAG3] = 'F';
+    b.hdr.e_ident[EI_CLASS] = ELFCLASS64;
+    b.hdr.e_ident[EI_DATA] = ELFDATA2LSB;
+    b.hdr.e_ident[EI_VERSION] = EV_CURRENT;
+    b.hdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    b.hdr.e_ident[EI_ABIVERSION] = 0;
+    b.hdr.e_type = ET_REL;
+    b.hdr.e_machine = EM_X86_64;
+    b.hdr.e_version = EV_CURRENT;
+    b.hdr.e_entry = 0;
+    b.hdr.e_phoff = 0;
+    b.hdr.e_shoff = shoff;
+    b.hdr.e_flags = 0;
+    b.hdr.e_ehsize = sizeof(Elf64_Ehdr);
+    b.hdr.e_phentsize = 0;
+    b.hdr.e_phnum = 0;
+    b.hdr.e_shentsize = sizeof(Elf64_Shdr);
+    b.hdr.e_shnum = b.sect.n;
+    b.hdr.e_shstrndx = shstrtab;
+
+    ret = _write(fp, &b, shoff);
+
+error:
+    free(map);
+    free(syms);
+    free(rela);
+    arch_symidx_release(&idx);
+    _builder_release(&b);
+
+    return ret;
 }
 
 /*
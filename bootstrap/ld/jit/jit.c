@@ -0,0 +1,282 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../../arch.h"
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+
+/*
+ * Stub of a branch out of the range of the 32-bit displacement on x86-64;
+ * jmp *0(%rip) followed by the absolute address
+ */
+#define JIT_STUB_SIZE   16
+static const uint8_t _stub[] = { 0xff, 0x25, 0x00, 0x00, 0x00, 0x00 };
+
+/*
+ * _align -- align the size up to the power of 2
+ */
+static size_t
+_align(size_t size, size_t align)
+{
+    return (size + align - 1) & ~(align - 1);
+}
+
+/*
+ * _bss -- get the size of the bss of the local symbols
+ */
+static size_t
+_bss(const arch_code_t *code)
+{
+    size_t size;
+    int i;
+
+    size = 0;
+    for ( i = 0; i < code->sym.n; i++ ) {
+        if ( code->sym.syms[i].type == ARCH_SYM_LOCAL
+             && code->sym.syms[i].pos + code->sym.syms[i].size > size ) {
+            size = code->sym.syms[i].pos + code->sym.syms[i].size;
+        }
+    }
+
+    return size;
+}
+
+/*
+ * _resolve -- build the symbol table of the addresses; the external symbols
+ * not defined in the code are resolved by the resolver
+ */
+static int
+_resolve(arch_jit_t *jit, const arch_code_t *code,
+         void *(*resolver)(const char *))
+{
+    const arch_sym_t *sym;
+    int i;
+
+    if ( arch_symidx_init(&jit->sym.idx, code) < 0 ) {
+        return -1;
+    }
+    jit->sym.addrs = malloc(sizeof(void *) * (code->sym.n + 1));
+    if ( jit->sym.addrs == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < code->sym.n; i++ ) {
+        sym = &code->sym.syms[i];
+        switch ( sym->type ) {
+        case ARCH_SYM_LOCAL:
+            jit->sym.addrs[i] = jit->bss.s + sym->pos;
+            break;
+        case ARCH_SYM_GLOBAL:
+            jit->sym.addrs[i] = jit->data.s + sym->pos;
+            break;
+        case ARCH_SYM_FUNC:
+            jit->sym.addrs[i] = jit->text.s + sym->pos;
+            break;
+        case ARCH_SYM_EXTERN:
+            /* Resolved below if defined in the code; checked when referred
+               to */
+            jit->sym.addrs[i] = NULL;
+            if ( jit->sym.idx.res[i] == i && resolver != NULL ) {
+                jit->sym.addrs[i] = resolver(sym->label);
+            }
+            break;
+        default:
+            return -1;
+        }
+    }
+    for ( i = 0; i < code->sym.n; i++ ) {
+        if ( jit->sym.idx.res[i] != i ) {
+            jit->sym.addrs[i] = jit->sym.addrs[jit->sym.idx.res[i]];
+        }
+    }
+    jit->sym.n = code->sym.n;
+
+    return 0;
+}
+
+/*
+ * _relocate -- apply the relocations to the text; the displacement is
+ * relative to the end of the 32-bit field, and a branch out of the range is
+ * redirected to a stub following the text
+ */
+static int
+_relocate(arch_jit_t *jit, const arch_code_t *code)
+{
+    const arch_rel_t *rel;
+    uint8_t *stub;
+    uint8_t *p;
+    intptr_t disp;
+    int32_t d;
+    int i;
+
+    stub = jit->text.s + _align(code->text.size, JIT_STUB_SIZE);
+    for ( i = 0; i < code->rel.n; i++ ) {
+        rel = &code->rel.rels[i];
+        if ( rel->sym < 0 || rel->sym >= jit->sym.n || rel->pos < 0
+             || (size_t)rel->pos + 4 > code->text.size
+             || jit->sym.addrs[rel->sym] == NULL ) {
+            return -1;
+        }
+        p = jit->text.s + rel->pos;
+        disp = (uint8_t *)jit->sym.addrs[rel->sym] - (p + 4);
+        if ( disp < INT32_MIN || disp > INT32_MAX ) {
+            if ( rel->type != ARCH_REL_BRANCH
+                 || code->cpu != ARCH_CPU_X86_64 ) {
+                return -1;
+            }
+            memcpy(stub, _stub, sizeof(_stub));
+            memcpy(stub + sizeof(_stub), &jit->sym.addrs[rel->sym],
+                   sizeof(void *));
+            disp = stub - (p + 4);
+            stub += JIT_STUB_SIZE;
+        }
+        switch ( rel->type ) {
+        case ARCH_REL_PC32:
+        case ARCH_REL_BRANCH:
+            d = disp;
+            memcpy(p, &d, 4);
+            break;
+        default:
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * jit_load -- load the code to the memory, and make the text executable; the
+ * text and the data are mapped next to each other, so that they refer to
+ * each other by the 32-bit displacements, and no page is writable and
+ * executable at the same time
+ */
+arch_jit_t *
+jit_load(const arch_code_t *code, void *(*resolver)(const char *))
+{
+    arch_jit_t *jit;
+    size_t pagesize;
+    size_t tsize;
+    size_t dsize;
+    size_t bsize;
+    int nstubs;
+    int i;
+
+    jit = malloc(sizeof(arch_jit_t));
+    if ( jit == NULL ) {
+        return NULL;
+    }
+    memset(jit, 0, sizeof(arch_jit_t));
+
+    /* The stubs for the external branches */
+    nstubs = 0;
+    for ( i = 0; i < code->rel.n; i++ ) {
+        if ( code->rel.rels[i].type == ARCH_REL_BRANCH
+             && code->rel.rels[i].sym >= 0
+             && code->rel.rels[i].sym < code->sym.n
+             && code->sym.syms[code->rel.rels[i].sym].type
+             == ARCH_SYM_EXTERN ) {
+            nstubs++;
+        }
+    }
+
+    pagesize = sysconf(_SC_PAGESIZE);
+    tsize = _align(code->text.size, JIT_STUB_SIZE) + JIT_STUB_SIZE * nstubs;
+    bsize = _bss(code);
+    dsize = _align(code->data.size, 16) + bsize;
+    jit->size = _align(tsize, pagesize) + _align(dsize, pagesize);
+    if ( jit->size == 0 ) {
+        jit->size = pagesize;
+    }
+    jit->base = mmap(NULL, jit->size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ( jit->base == MAP_FAILED ) {
+        free(jit);
+        return NULL;
+    }
+    jit->text.s = jit->base;
+    jit->text.size = tsize;
+    jit->data.s = jit->base + _align(tsize, pagesize);
+    jit->data.size = code->data.size;
+    jit->bss.s = jit->data.s + _align(code->data.size, 16);
+    jit->bss.size = bsize;
+    if ( code->text.size > 0 ) {
+        memcpy(jit->text.s, code->text.s, code->text.size);
+    }
+    if ( code->data.size > 0 ) {
+        memcpy(jit->data.s, code->data.s, code->data.size);
+    }
+
+    /* Link, and then seal the text */
+    if ( _resolve(jit, code, resolver) < 0 || _relocate(jit, code) < 0 ) {
+        jit_release(jit);
+        return NULL;
+    }
+    if ( tsize > 0 && mprotect(jit->text.s, _align(tsize, pagesize),
+                               PROT_READ | PROT_EXEC) < 0 ) {
+        jit_release(jit);
+        return NULL;
+    }
+#ifdef __GNUC__
+    __builtin___clear_cache((char *)jit->text.s,
+                            (char *)jit->text.s + tsize);
+#endif
+
+    return jit;
+}
+
+/*
+ * jit_sym -- get the address of the symbol, or NULL if not found
+ */
+void *
+jit_sym(const arch_jit_t *jit, const char *label)
+{
+    int i;
+
+    i = arch_symidx_lookup(&jit->sym.idx, label);
+    if ( i < 0 ) {
+        return NULL;
+    }
+
+    return jit->sym.addrs[i];
+}
+
+/*
+ * jit_release -- unmap the code loaded
+ */
+void
+jit_release(arch_jit_t *jit)
+{
+    munmap(jit->base, jit->size);
+    arch_symidx_release(&jit->sym.idx);
+    free(jit->sym.addrs);
+    free(jit);
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
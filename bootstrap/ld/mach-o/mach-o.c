@@ -229,10 +229,11 @@ struct nlist_64 {
 } __attribute__ ((packed));
 
 /*
- * General export function
+ * General export function; the relocations refer to the symbols defining
+ * their labels
  */
 static int
-_export(FILE *fp, arch_code_t *code)
+_export(FILE *fp, arch_code_t *code, const arch_symidx_t *idx)
 {
     struct mach_header_64 hdr;
     struct segment_command_64 seg;
@@ -296,7 +297,11 @@ _export(FILE *fp, arch_code_t *code)
     }
     for ( i = 0; i < code->rel.n; i++ ) {
         relocinfo[i].r_address = code->rel.rels[i].pos;
-        relocinfo[i].r_symbolnum = code->rel.rels[i].sym;
+        if ( code->rel.rels[i].sym < 0
+             || code->rel.rels[i].sym >= code->sym.n ) {
+            return -1;
+        }
+        relocinfo[i].r_symbolnum = idx->res[code->rel.rels[i].sym];
         relocinfo[i].r_extern = 1;
         switch ( code->rel.rels[i].type ) {
         case ARCH_REL_PC32:
@@ -305,6 +310,10 @@ _export(FILE *fp, arch_code_t *code)
             relocinfo[i].r_type = X86_64_RELOC_SIGNED;
             break;
         case ARCH_REL_BRANCH:
+            relocinfo[i].r_pcrel = 1;
+            relocinfo[i].r_length = 2;
+            relocinfo[i].r_type = X86_64_RELOC_BRANCH;
+            break;
         default:
             fprintf(stderr, "Unknown relocation type (%d).\n",
                     code->rel.rels[i].type);
@@ -352,8 +361,18 @@ _export(FILE *fp, arch_code_t *code)
             nl[i].n_sect = 0x01;
             nl[i].n_value = code->sym.syms[i].pos;
             break;
+        case ARCH_SYM_EXTERN:
+            /* Undefined; resolved by the linker */
+            nl[i].n_type = N_UNDF | N_EXT;
+            nl[i].n_sect = 0;
+            nl[i].n_value = 0;
+            break;
+        }
+        if ( code->sym.syms[i].type == ARCH_SYM_EXTERN ) {
+            nl[i].n_desc = REFERENCE_FLAG_UNDEFINED_NON_LAZY;
+        } else {
+            nl[i].n_desc = REFERENCE_FLAG_DEFINED;
         }
-        nl[i].n_desc = REFERENCE_FLAG_DEFINED;
 
         /* Symbol table */
         strcpy(strtab + stroff, code->sym.syms[i].label);
@@ -500,7 +519,7 @@ _export(FILE *fp, arch_code_t *code)
 
     /* Write the relocation info */
     nw = fwrite(relocinfo, sizeof(struct relocation_info), code->rel.n, fp);
-    if ( nw != 1 ) {
+    if ( nw != (ssize_t)code->rel.n ) {
         return -1;
     }
 
@@ -529,7 +548,17 @@ _export(FILE *fp, arch_code_t *code)
 int
 mach_o_export(FILE *fp, arch_code_t *code)
 {
-    return _export(fp, code);
+    arch_symidx_t idx;
+    int ret;
+
+    /* Resolve the labels; a label defined twice is rejected */
+    if ( arch_symidx_init(&idx, code) < 0 ) {
+        return -1;
+    }
+    ret = _export(fp, code, &idx);
+    arch_symidx_release(&idx);
+
+    return ret;
 }
 
 /*
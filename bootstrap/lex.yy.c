@@ -0,0 +1,294 @@
+/* Hand-written stand-in for the flex scanner generated from minica.l.
+   Test harness only; actions mirror minica.l. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "compile.h"
+#include "y.tab.h"
+#include "lex.yy.h"
+
+#include "/tmp/fakeflex/fake_actions.h"
+
+struct fake_buffer {
+    char *base;
+    size_t len;
+    int owned;
+};
+
+struct scanner {
+    void *extra;
+    FILE *in;
+    struct fake_buffer *buf;
+    size_t pos;
+    YYLTYPE *lloc;
+    int lineno;
+    char *text;
+    int leng;
+    char hold;
+};
+
+int yylex_init_extra(void *extra, yyscan_t *s)
+{
+    struct scanner *sc = calloc(1, sizeof(*sc));
+    sc->extra = extra;
+    sc->lineno = 1;
+    *s = sc;
+    return 0;
+}
+int yylex_init(yyscan_t *s) { return yylex_init_extra(NULL, s); }
+void yyset_in(FILE *fp, yyscan_t s) { ((struct scanner *)s)->in = fp; }
+void *yyget_extra(yyscan_t s) { return ((struct scanner *)s)->extra; }
+void yyset_extra(void *e, yyscan_t s) { ((struct scanner *)s)->extra = e; }
+YYLTYPE *yyget_lloc(yyscan_t s) { return ((struct scanner *)s)->lloc; }
+int yyget_lineno(yyscan_t s) { return ((struct scanner *)s)->lineno; }
+char *yyget_text(yyscan_t s) { return ((struct scanner *)s)->text; }
+int yyget_leng(yyscan_t s) { return ((struct scanner *)s)->leng; }
+
+YY_BUFFER_STATE yy_scan_buffer(char *base, yy_size_t size, yyscan_t s)
+{
+    struct scanner *sc = s;
+    struct fake_buffer *b;
+    if ( size < 2 || base[size - 2] || base[size - 1] ) {
+        return NULL;
+    }
+    b = calloc(1, sizeof(*b));
+    b->base = base;
+    b->len = size - 2;
+    sc->buf = b;
+    sc->pos = 0;
+    return b;
+}
+YY_BUFFER_STATE yy_scan_bytes(const char *bytes, int len, yyscan_t s)
+{
+    char *p = malloc(len + 2);
+    struct fake_buffer *b;
+    memcpy(p, bytes, len);
+    p[len] = p[len + 1] = 0;
+    b = yy_scan_buffer(p, len + 2, s);
+    b->owned = 1;
+    return b;
+}
+YY_BUFFER_STATE yy_scan_string(const char *str, yyscan_t s)
+{
+    return yy_scan_bytes(str, strlen(str), s);
+}
+void yy_delete_buffer(YY_BUFFER_STATE b, yyscan_t s)
+{
+    struct scanner *sc = s;
+    if ( !b ) return;
+    if ( b->owned ) free(b->base);
+    if ( sc->buf == b ) sc->buf = NULL;
+    free(b);
+}
+int yylex_destroy(yyscan_t s)
+{
+    struct scanner *sc = s;
+    if ( sc->buf && sc->buf->owned ) {
+        yy_delete_buffer(sc->buf, s);
+    }
+    free(sc);
+    return 0;
+}
+
+static void _load(struct scanner *sc)
+{
+    size_t cap = 4096, n = 0, r;
+    char *p;
+    if ( sc->buf ) return;
+    p = malloc(cap);
+    while ( (r = fread(p + n, 1, cap - n - 2, sc->in ? sc->in : stdin)) > 0 ) {
+        n += r;
+        if ( cap - n - 2 == 0 ) { cap *= 2; p = realloc(p, cap); }
+    }
+    p[n] = p[n + 1] = 0;
+    sc->buf = calloc(1, sizeof(struct fake_buffer));
+    sc->buf->base = p;
+    sc->buf->len = n;
+    sc->buf->owned = 1;
+}
+
+static void _update_locations(YYLTYPE *loc, const char *s, int n)
+{
+    int i;
+    loc->first_line = loc->last_line;
+    loc->first_column = loc->last_column;
+    for ( i = 0; i < n; i++ ) {
+        if ( s[i] == '\n' ) { loc->last_line++; loc->last_column = 0; }
+        else loc->last_column++;
+    }
+}
+
+/* consume n bytes as the current lexeme; yytext NUL terminated like flex */
+static char *_take(struct scanner *sc, size_t n)
+{
+    char *base = sc->buf->base;
+    size_t i;
+    if ( sc->text ) {
+        sc->text[sc->leng] = sc->hold;
+    }
+    sc->text = base + sc->pos;
+    sc->leng = n;
+    sc->hold = sc->text[n];
+    sc->text[n] = '\0';
+    for ( i = 0; i < n; i++ ) if ( sc->text[i] == '\n' ) sc->lineno++;
+    sc->pos += n;
+    _update_locations(sc->lloc, sc->text, n);
+    return sc->text;
+}
+
+static const struct { const char *s; int tok; } kw[] = {
+    {"i8", TOK_TYPE_I8}, {"i16", TOK_TYPE_I16}, {"i32", TOK_TYPE_I32},
+    {"i64", TOK_TYPE_I64}, {"u8", TOK_TYPE_U8}, {"u16", TOK_TYPE_U16},
+    {"u32", TOK_TYPE_U32}, {"u64", TOK_TYPE_U64}, {"fp32", TOK_TYPE_FP32},
+    {"fp64", TOK_TYPE_FP64}, {"string", TOK_TYPE_STRING},
+    {"bool", TOK_TYPE_BOOL}, {"mod", TOK_MODULE}, {"use", TOK_USE},
+    {"include", TOK_INCLUDE}, {"fn", TOK_FN}, {"coroutine", TOK_COROUTINE},
+    {"return", TOK_RETURN}, {"yield", TOK_YIELD}, {"type", TOK_TYPE}, {"typedef", TOK_TYPEDEF},
+    {"struct", TOK_STRUCT}, {"union", TOK_UNION}, {"enum", TOK_ENUM},
+    {"if", TOK_IF}, {"else", TOK_ELSE}, {"while", TOK_WHILE},
+    {"switch", TOK_SWITCH}, {"case", TOK_CASE}, {"default", TOK_DEFAULT},
+    {"nil", TOK_NIL}, {"true", TOK_TRUE}, {"false", TOK_FALSE},
+#ifdef TOK_YIELD
+    {"yield", TOK_YIELD},
+#endif
+    {NULL, 0}
+};
+
+static const struct { const char *s; int tok; } ops[] = {
+    {":=", TOK_DEF}, {"==", TOK_EQ_EQ}, {"!=", TOK_NEQ}, {"<=", TOK_LEQ},
+    {">=", TOK_GEQ}, {"++", TOK_INC}, {"--", TOK_DEC}, {"||", TOK_LOR},
+    {"&&", TOK_LAND}, {"<<", TOK_BIT_LSHIFT}, {">>", TOK_BIT_RSHIFT},
+    {"+", TOK_ADD}, {"-", TOK_SUB}, {"*", TOK_MUL}, {"/", TOK_DIV},
+    {"%", TOK_MOD}, {"|", TOK_BIT_OR}, {"&", TOK_BIT_AND},
+    {"^", TOK_BIT_XOR}, {"~", TOK_BIT_NOT}, {"!", TOK_NOT},
+    {"(", TOK_LPAREN}, {")", TOK_RPAREN}, {"{", TOK_LBRACE},
+    {"}", TOK_RBRACE}, {"[", TOK_LBRACKET}, {"]", TOK_RBRACKET},
+    {",", TOK_COMMA}, {".", TOK_DOT}, {"@", TOK_ATMARK},
+    {"<", TOK_LCHEVRON}, {">", TOK_RCHEVRON}, {"=", TOK_EQ},
+    {":", TOK_COLON}, {";", TOK_SEMICOLON}, {NULL, 0}
+};
+
+int yylex(YYSTYPE *yylval, YYLTYPE *yylloc, yyscan_t yyscanner)
+{
+    struct scanner *sc = yyscanner;
+    const char *p;
+    size_t n, i;
+
+    sc->lloc = yylloc;
+    _load(sc);
+    for ( ;; ) {
+        p = sc->buf->base + sc->pos;
+        if ( sc->text ) { sc->text[sc->leng] = sc->hold; sc->text = NULL; }
+        if ( *p == '\0' ) {
+            return 0;
+        }
+        if ( *p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' ) {
+            _take(sc, 1);
+            continue;
+        }
+        if ( p[0] == '/' && p[1] == '/' ) {
+            _take(sc, 2);
+            sc->text[sc->leng] = sc->hold; sc->text = NULL;
+            p = sc->buf->base + sc->pos;
+            for ( n = 0; p[n] && p[n] != '\n'; n++ ) ;
+            if ( p[n] == '\n' ) n++;
+            _take(sc, n);
+            continue;
+        }
+        if ( p[0] == '/' && p[1] == '*' ) {
+            const char *e;
+            _take(sc, 2);
+            sc->text[sc->leng] = sc->hold; sc->text = NULL;
+            p = sc->buf->base + sc->pos;
+            /* flex rule: .*\*\/ (no newline, greedy) */
+            e = NULL;
+            for ( n = 0; p[n] && p[n] != '\n'; n++ ) {
+                if ( p[n] == '*' && p[n + 1] == '/' ) e = p + n + 2;
+            }
+            if ( e ) {
+                _take(sc, e - p);
+            }
+            continue;
+        }
+        /* identifiers / keywords */
+        if ( isalpha((unsigned char)*p) || *p == '_' ) {
+            for ( n = 1; isalnum((unsigned char)p[n]) || p[n] == '_'; n++ ) ;
+            _take(sc, n);
+            for ( i = 0; kw[i].s; i++ ) {
+                if ( strlen(kw[i].s) == n && !memcmp(kw[i].s, sc->text, n) ) {
+                    return kw[i].tok;
+                }
+            }
+            return fake_action_id(yylval, yyscanner, sc->text, sc->leng);
+        }
+        /* numbers */
+        if ( isdigit((unsigned char)*p) || (*p == '.' && isdigit((unsigned char)p[1])) ) {
+            size_t d = 0;
+            while ( isdigit((unsigned char)p[d]) ) d++;
+            if ( p[d] == '.' ) {
+                n = d + 1;
+                while ( isdigit((unsigned char)p[n]) ) n++;
+                _take(sc, n);
+                return fake_action_float(yylval, yyscanner, sc->text, sc->leng);
+            }
+            if ( p[0] == '0' && p[1] == 'x' && isxdigit((unsigned char)p[2]) ) {
+                n = 2;
+                while ( isxdigit((unsigned char)p[n]) ) n++;
+                _take(sc, n);
+                return fake_action_hex(yylval, yyscanner, sc->text, sc->leng);
+            }
+            if ( p[0] == '0' ) {
+                n = 1;
+                while ( p[n] >= '0' && p[n] <= '7' ) n++;
+                _take(sc, n);
+                return fake_action_oct(yylval, yyscanner, sc->text, sc->leng);
+            }
+            _take(sc, d);
+            return fake_action_dec(yylval, yyscanner, sc->text, sc->leng);
+        }
+        if ( *p == '"' ) {
+            _take(sc, 1);
+            sc->text[sc->leng] = sc->hold; sc->text = NULL;
+            fake_action_str_begin(yylval, yyscanner);
+            for ( ;; ) {
+                if ( sc->text ) { sc->text[sc->leng] = sc->hold; sc->text = NULL; }
+                p = sc->buf->base + sc->pos;
+                if ( *p == '"' ) {
+                    _take(sc, 1);
+                    return fake_action_str_end(yylval, yyscanner);
+                } else if ( *p == '\\' && p[1] >= '0' && p[1] <= '7' ) {
+                    n = 2;
+                    while ( n < 4 && p[n] >= '0' && p[n] <= '7' ) n++;
+                    _take(sc, n);
+                    fake_action_str_char(yylval, yyscanner, strtol(sc->text + 1, 0, 8));
+                } else if ( *p == '\\' && p[1] == 'x' && isxdigit((unsigned char)p[2]) ) {
+                    n = 3;
+                    if ( isxdigit((unsigned char)p[3]) ) n = 4;
+                    _take(sc, n);
+                    fake_action_str_char(yylval, yyscanner, strtol(sc->text + 2, 0, 16));
+                } else if ( *p == '\\' && (p[1] == '\\' || p[1] == '"') ) {
+                    _take(sc, 2);
+                    fake_action_str_char(yylval, yyscanner, sc->text[1]);
+                } else if ( *p == '\0' || *p == '\n' || *p == '\\' ) {
+                    fprintf(stderr, "fakelex: bad string\n");
+                    exit(1);
+                } else {
+                    for ( n = 0; p[n] && p[n] != '\\' && p[n] != '"' && p[n] != '\n'; n++ ) ;
+                    _take(sc, n);
+                    fake_action_str_str(yylval, yyscanner, sc->text);
+                }
+            }
+        }
+        for ( i = 0; ops[i].s; i++ ) {
+            n = strlen(ops[i].s);
+            if ( !strncmp(p, ops[i].s, n) ) {
+                _take(sc, n);
+                return ops[i].tok;
+            }
+        }
+        /* flex default rule: echo */
+        _take(sc, 1);
+        fputc(*sc->text, stdout);
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef FAKE_LEX_YY_H
+#define FAKE_LEX_YY_H
+#include <stdio.h>
+#include <stddef.h>
+typedef void *yyscan_t;
+typedef struct fake_buffer *YY_BUFFER_STATE;
+typedef size_t yy_size_t;
+#define YY_EXTRA_TYPE void *
+int yylex_init_extra(void *, yyscan_t *);
+int yylex_init(yyscan_t *);
+void yyset_in(FILE *, yyscan_t);
+int yylex_destroy(yyscan_t);
+void *yyget_extra(yyscan_t);
+void yyset_extra(void *, yyscan_t);
+YYLTYPE *yyget_lloc(yyscan_t);
+int yyget_lineno(yyscan_t);
+char *yyget_text(yyscan_t);
+int yyget_leng(yyscan_t);
+int yylex(YYSTYPE *, YYLTYPE *, yyscan_t);
+YY_BUFFER_STATE yy_scan_buffer(char *, yy_size_t, yyscan_t);
+YY_BUFFER_STATE yy_scan_bytes(const char *, int, yyscan_t);
+YY_BUFFER_STATE yy_scan_string(const char *, yyscan_t);
+void yy_delete_buffer(YY_BUFFER_STATE, yyscan_t);
+#endif
@@ -24,6 +24,8 @@
 #ifndef _MINICA_H
 #define _MINICA_H
 
+#include <sys/types.h>
+
 /*
  * Compiler
  */
@@ -66,6 +68,9 @@ extern "C" {
 #endif
 
     st_t * minica_parse(FILE *);
+    st_t * minica_parse_buffer(const char *, size_t);
+    st_t * minica_parse_path(const char *);
+    ssize_t minica_scan_buffer(const char *, size_t);
 
 #ifdef __cplusplus
 }
@@ -25,14 +25,25 @@
 %{
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "syntax.h"
 #include "compile.h"
+#include "intern.h"
 #include "y.tab.h"
 #include "lex.yy.h"
 #include "minica.h"
+#include "report.h"
 
 void yyerror(YYLTYPE *, yyscan_t, const char *);
 
+/* Time the scanner called by the parser by sampling */
+#define yylex(lval, lloc, scanner)  _yylex_report(lval, lloc, scanner)
+static int _yylex_report(YYSTYPE *, YYLTYPE *, yyscan_t);
+
 #define ERROR_ON_NULL(val, msg)             \
     do {                                    \
         if ( NULL == (val) ) {              \
@@ -48,9 +59,9 @@ void yyerror(YYLTYPE *, yyscan_t, const char *);
     outer_block_t *oblock;
     outer_block_entry_t *obent;
     inner_block_t *iblock;
-    char *numval;
-    char *idval;
-    char *strval;
+    slice_t numval;
+    const char *idval;
+    const char *strval;
     type_t *type;
     directive_t *directive;
     decl_t *decl;
@@ -83,6 +94,7 @@ void yyerror(YYLTYPE *, yyscan_t, const char *);
 %token TOK_EQ_EQ TOK_NEQ TOK_LEQ TOK_GEQ
 %token TOK_EQ TOK_COMMA TOK_DOT TOK_ATMARK
 %token TOK_MODULE TOK_USE TOK_INCLUDE TOK_FN TOK_COROUTINE TOK_RETURN
+%token TOK_YIELD
 %token TOK_BIT_OR TOK_BIT_AND TOK_BIT_XOR TOK_BIT_LSHIFT TOK_BIT_RSHIFT
 %token TOK_BIT_NOT
 %token TOK_TYPE_I8 TOK_TYPE_I16 TOK_TYPE_I32 TOK_TYPE_I64
@@ -114,7 +126,7 @@ void yyerror(YYLTYPE *, yyscan_t, const char *);
 %type <swcase> switch_case
 %type <func> fndef
 %type <coroutine> crdef
-%type <stmt> statement stmt_while stmt_expr_list stmt_return
+%type <stmt> statement stmt_while stmt_expr_list stmt_return stmt_yield
 %type <stmts> statements
 %type <lit> literal
 %type <lset> literal_set
@@ -159,14 +171,14 @@ start:          file
                 ;
 file:           outer_block
                 {
-                    $$ = st_new($1);
+                    $$ = st_new(scanner, $1);
                 }
                 ;
 
 /* Outer blocks */
 outer_block:    outer_entry
                 {
-                    $$ = outer_block_new($1);
+                    $$ = outer_block_new(scanner, $1);
                 }
         |       outer_block outer_entry
                 {
@@ -178,28 +190,32 @@ outer_block:    outer_entry
 outer_entry:    directive
                 {
                     outer_block_entry_t *block;
-                    block = outer_block_entry_new(OUTER_BLOCK_DIRECTIVE);
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_DIRECTIVE);
                     block->u.dr = $1;
                     $$ = block;
                 }
         |       crdef
                 {
                     outer_block_entry_t *block;
-                    block = outer_block_entry_new(OUTER_BLOCK_COROUTINE);
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_COROUTINE);
                     block->u.cr = $1;
                     $$ = block;
                 }
         |       fndef
                 {
                     outer_block_entry_t *block;
-                    block = outer_block_entry_new(OUTER_BLOCK_FUNC);
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_FUNC);
                     block->u.fn = $1;
                     $$ = block;
                 }
         |       module
                 {
                     outer_block_entry_t *block;
-                    block = outer_block_entry_new(OUTER_BLOCK_MODULE);
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_MODULE);
                     block->u.md = $1;
                     $$ = block;
                 }
@@ -276,11 +292,11 @@ decl_list:      decl_list declaration
                 }
         |       declaration TOK_SEMICOLON
                 {
-                    $$ = decl_list_new($1);
+                    $$ = decl_list_new(scanner, $1);
                 }
         |       declaration
                 {
-                    $$ = decl_list_new($1);
+                    $$ = decl_list_new(scanner, $1);
                 }
                 ;
 enum_def:       TOK_ENUM identifier TOK_LBRACE enum_list TOK_RBRACE
@@ -299,7 +315,7 @@ enum_list:      enum_elem TOK_COMMA enum_list
                 ;
 enum_elem:      identifier
                 {
-                    $$ = enum_elem_new($1);
+                    $$ = enum_elem_new(scanner, $1);
                 }
                 ;
 
@@ -309,7 +325,7 @@ module:         TOK_MODULE identifier TOK_LBRACE outer_block TOK_RBRACE
                     context_t *context;
                     module_t *module;
                     module_t *cur;
-                    module = module_new($2, $4);
+                    module = module_new(scanner, $2, $4);
                     ERROR_ON_NULL(module, "Cannot initialize a new module.");
                     context = yyget_extra(scanner);
                     cur = context->cur;
@@ -322,12 +338,12 @@ module:         TOK_MODULE identifier TOK_LBRACE outer_block TOK_RBRACE
 /* Coroutine & function */
 crdef:          TOK_COROUTINE identifier funcargs retvals suite
                 {
-                    $$ = coroutine_new($2, $3, $4, $5);
+                    $$ = coroutine_new(scanner, $2, $3, $4, $5);
                 }
                 ;
 fndef:          TOK_FN identifier funcargs retvals suite
                 {
-                    $$ = func_new($2, $3, $4, $5);
+                    $$ = func_new(scanner, $2, $3, $4, $5);
                 }
                 ;
 funcargs:       TOK_LPAREN args TOK_RPAREN
@@ -345,7 +361,7 @@ retvals:        TOK_LPAREN args TOK_RPAREN
                 }
 args:           arg
                 {
-                    $$ = arg_list_new($1);
+                    $$ = arg_list_new(scanner, $1);
                 }
         |       args TOK_COMMA arg
                 {
@@ -353,7 +369,7 @@ args:           arg
                 }
         |
                 {
-                    $$ = arg_list_new(NULL);
+                    $$ = arg_list_new(scanner, NULL);
                 }
                 ;
 arg:            declaration
@@ -371,16 +387,16 @@ suite:          TOK_LBRACE inner_block TOK_RBRACE
 /* Inner block */
 inner_block:    statements
                 {
-                    $$ = inner_block_new($1);
+                    $$ = inner_block_new(scanner, $1);
                 }
                 ;
 statements:     statement
                 {
-                    $$ = stmt_list_new($1);
+                    $$ = stmt_list_new(scanner, $1);
                 }
         |       statement TOK_SEMICOLON
                 {
-                    $$ = stmt_list_new($1);
+                    $$ = stmt_list_new(scanner, $1);
                 }
         |       statements statement
                 {
@@ -401,28 +417,41 @@ statement:      stmt_while
                 {
                     $$ = $1;
                 }
+        |       stmt_yield
+                {
+                    $$ = $1;
+                }
         |       suite
                 {
-                    $$ = stmt_new_block($1);
+                    $$ = stmt_new_block(scanner, $1);
                 }
                 ;
 stmt_while:     TOK_WHILE expression TOK_LBRACE inner_block TOK_RBRACE
                 {
-                    $$ = stmt_new_while($2, $4);
+                    $$ = stmt_new_while(scanner, $2, $4);
                 }
                 ;
 stmt_expr_list: expr_list
                 {
-                    $$ = stmt_new_expr_list($1);
+                    $$ = stmt_new_expr_list(scanner, $1);
                 }
                 ;
 stmt_return:    TOK_RETURN expression
                 {
-                    $$ = stmt_new_return($2);
+                    $$ = stmt_new_return(scanner, $2);
                 }
         |       TOK_RETURN TOK_SEMICOLON
                 {
-                    $$ = stmt_new_return(NULL);
+                    $$ = stmt_new_return(scanner, NULL);
+                }
+                ;
+stmt_yield:     TOK_YIELD expression
+                {
+                    $$ = stmt_new_yield(scanner, $2);
+                }
+        |       TOK_YIELD TOK_SEMICOLON
+                {
+                    $$ = stmt_new_yield(scanner, NULL);
                 }
                 ;
 
@@ -430,7 +459,7 @@ stmt_return:    TOK_RETURN expression
 expr_list:      expression
                 {
                     expr_list_t *list;
-                    list = expr_list_new();
+                    list = expr_list_new(scanner);
                     ERROR_ON_NULL(list, "Memory error: expr_list_new()");
                     $$ = expr_list_append(list, $1);
                 }
@@ -470,7 +499,9 @@ else_block:     TOK_ELSE suite
                 }
         |       TOK_ELSE if_expr
                 {
-                    $$ = inner_block_new(stmt_list_new(stmt_new_expr($2)));
+                    stmt_t *stmt;
+                    stmt = stmt_new_expr(scanner, $2);
+                    $$ = inner_block_new(scanner, stmt_list_new(scanner, stmt));
                 }
         |       %prec ELSENOP
                 {
@@ -489,7 +520,7 @@ switch_block:   switch_block switch_case
         |       switch_case
                 {
                     switch_block_t *block;
-                    block = switch_block_new();
+                    block = switch_block_new(scanner);
                     ERROR_ON_NULL(block, "Parse error: switch");
                     $$ = switch_block_append(block, $1);
                 }
@@ -497,11 +528,11 @@ switch_block:   switch_block switch_case
 switch_case:    TOK_CASE literal_set TOK_COLON inner_block
                 {
                     ERROR_ON_NULL($2, "Parse error: case");
-                    $$ = switch_case_new($2, $4);
+                    $$ = switch_case_new(scanner, $2, $4);
                 }
         |       TOK_DEFAULT TOK_COLON inner_block
                 {
-                    $$ = switch_case_new(NULL, $3);
+                    $$ = switch_case_new(scanner, NULL, $3);
                 }
                 ;
 assign_expr:    primary TOK_DEF assign_expr
@@ -714,7 +745,7 @@ primary:        atom
                 }
         |       TOK_LPAREN expr_list TOK_RPAREN
                 {
-                    $$ = expr_new_list($2);
+                    $$ = expr_new_list(scanner, $2);
                 }
                 ;
 
@@ -733,7 +764,7 @@ atom:           literal
                 ;
 declaration:    identifier TOK_COLON type
                 {
-                    $$ = decl_new($1, $3);
+                    $$ = decl_new(scanner, $1, $3);
                 }
                 ;
 identifier:     TOK_ID
@@ -749,68 +780,68 @@ type:           primitive_type
                 }
         |       TOK_STRUCT identifier
                 {
-                    $$ = type_new_struct($2);
+                    $$ = type_new_struct(scanner, $2);
                 }
         |       TOK_UNION identifier
                 {
-                    $$ = type_new_union($2);
+                    $$ = type_new_union(scanner, $2);
                 }
         |       TOK_ENUM identifier
                 {
-                    $$ = type_new_enum($2);
+                    $$ = type_new_enum(scanner, $2);
                 }
         |       identifier
                 {
-                    $$ = type_new_id($1);
+                    $$ = type_new_id(scanner, $1);
                 }
                 ;
 primitive_type: TOK_TYPE_I8
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_I8);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_I8);
                 }
         |       TOK_TYPE_U8
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_U8);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_U8);
                 }
         |       TOK_TYPE_I16
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_I16);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_I16);
                 }
         |       TOK_TYPE_U16
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_U16);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_U16);
                 }
         |       TOK_TYPE_I32
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_I32);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_I32);
                 }
         |       TOK_TYPE_U32
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_U32);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_U32);
                 }
         |       TOK_TYPE_I64
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_I64);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_I64);
                 }
         |       TOK_TYPE_U64
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_U64);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_U64);
                 }
         |       TOK_TYPE_FP32
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_FP32);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_FP32);
                 }
         |       TOK_TYPE_FP64
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_FP64);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_FP64);
                 }
         |       TOK_TYPE_STRING
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_STRING);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_STRING);
                 }
         |       TOK_TYPE_BOOL
                 {
-                    $$ = type_new_primitive(TYPE_PRIMITIVE_BOOL);
+                    $$ = type_new_primitive(scanner, TYPE_PRIMITIVE_BOOL);
                 }
                 ;
 
@@ -821,7 +852,7 @@ literal_set:    literal_set TOK_COMMA literal
                 }
         |       literal
                 {
-                    $$ = literal_set_new();
+                    $$ = literal_set_new(scanner);
                     $$ = literal_set_add($$, $1);
                 }
                 ;
@@ -875,46 +906,329 @@ yyerror(YYLTYPE *yylloc, yyscan_t scanner, const char *str)
 }
 
 /*
- * minica_parse -- parse the specified file
+ * _yylex_report -- scan a token; one in REPORT_SAMPLE tokens is timed in the
+ * lexing phase of the report for all of them, since timing each token would
+ * take longer than scanning it.  The allocations of the tokens not timed are
+ * counted to the parsing phase.
  */
-st_t *
-minica_parse(FILE *fp)
+static int
+_yylex_report(YYSTYPE *lval, YYLTYPE *lloc, yyscan_t scanner)
 {
-    yyscan_t scanner;
     context_t *context;
+    report_span_t span;
+    int tok;
+
+    context = yyget_extra(scanner);
+    if ( !report_enabled() || context->ntokens++ % REPORT_SAMPLE ) {
+        return (yylex)(lval, lloc, scanner);
+    }
+    report_begin(&span, REPORT_LEX);
+    tok = (yylex)(lval, lloc, scanner);
+    report_sample(&span, REPORT_SAMPLE);
+
+    return tok;
+}
+
+/*
+ * _release_source -- release the source text
+ */
+static void
+_release_source(source_t *src)
+{
+    if ( src->maplen ) {
+        munmap(src->buf, src->maplen);
+    } else {
+        free(src->buf);
+    }
+}
+
+/*
+ * _parse -- parse the source text in the context
+ *
+ * The source text must be terminated by two NUL characters so that the
+ * scanner works on it in place without copying.  The text is owned by the
+ * syntax tree returned on success, and released by st_release().
+ */
+static st_t *
+_parse(context_t *context)
+{
+    yyscan_t scanner;
+    YY_BUFFER_STATE bs;
     module_t *module;
+    st_t *st;
+    report_span_t span;
 
-    /* Allocate space for context */
-    context = malloc(sizeof(context_t));
-    if ( NULL == context ) {
+    /* Allocate an arena for the syntax tree */
+    context->arena = arena_new();
+    if ( NULL == context->arena ) {
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
+
+    /* Initialize the scanner with the extra data context */
+    if ( yylex_init_extra(context, &scanner) ) {
+        arena_release(context->arena);
+        _release_source(&context->src);
+        free(context);
         return NULL;
     }
-    memset(context, 0, sizeof(context_t));
 
     /* New module */
-    module = module_new("", NULL);
+    module = module_new(scanner, intern(""), NULL);
     if ( NULL == module ) {
+        yylex_destroy(scanner);
+        arena_release(context->arena);
+        _release_source(&context->src);
         free(context);
         return NULL;
     }
     context->cur = module;
 
-    /* Initialize the scanner with the extra data context */
-    yylex_init_extra(context, &scanner);
-
-    /* Set the file pointer */
-    yyset_in(fp, scanner);
+    /* Scan the source text in place */
+    bs = yy_scan_buffer(context->src.buf, context->src.len + 2, scanner);
+    if ( NULL == bs ) {
+        yylex_destroy(scanner);
+        arena_release(context->arena);
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
 
     /* Parse the input file */
+    report_begin(&span, REPORT_PARSE);
     if ( yyparse(scanner) ) {
         fprintf(stderr, "Parse error: yyparse()\n");
         exit(EXIT_FAILURE);
     }
+    report_end(&span);
 
     /* Destroy the scanner */
+    yy_delete_buffer(bs, scanner);
     yylex_destroy(scanner);
 
-    return context->st;
+    /* The tree owns the arena and the source text from here; the context is
+       no longer used */
+    st = context->st;
+    if ( NULL == st ) {
+        arena_release(context->arena);
+        _release_source(&context->src);
+    }
+    free(context->buffer.buf);
+    free(context);
+
+    return st;
+}
+
+/*
+ * _context_new -- allocate a new parser context
+ */
+static context_t *
+_context_new(void)
+{
+    context_t *context;
+
+    context = malloc(sizeof(context_t));
+    if ( NULL == context ) {
+        return NULL;
+    }
+    memset(context, 0, sizeof(context_t));
+
+    return context;
+}
+
+/*
+ * minica_parse_buffer -- parse the source text in the specified buffer
+ */
+st_t *
+minica_parse_buffer(const char *buf, size_t len)
+{
+    context_t *context;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return NULL;
+    }
+
+    /* The scanner writes into its buffer, so copy the text once here */
+    context->src.buf = malloc(len + 2);
+    if ( NULL == context->src.buf ) {
+        free(context);
+        return NULL;
+    }
+    memcpy(context->src.buf, buf, len);
+    context->src.buf[len] = '\0';
+    context->src.buf[len + 1] = '\0';
+    context->src.len = len;
+    context->src.maplen = 0;
+
+    return _parse(context);
+}
+
+/*
+ * minica_scan_buffer -- scan the source text in the specified buffer without
+ * parsing it, and return the number of the tokens
+ */
+ssize_t
+minica_scan_buffer(const char *buf, size_t len)
+{
+    context_t *context;
+    yyscan_t scanner;
+    YY_BUFFER_STATE bs;
+    YYSTYPE lval;
+    YYLTYPE lloc;
+    ssize_t n;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return -1;
+    }
+    context->src.buf = malloc(len + 2);
+    if ( NULL == context->src.buf ) {
+        free(context);
+        return -1;
+    }
+    memcpy(context->src.buf, buf, len);
+    context->src.buf[len] = '\0';
+    context->src.buf[len + 1] = '\0';
+    context->src.len = len;
+
+    n = -1;
+    if ( 0 == yylex_init_extra(context, &scanner) ) {
+        bs = yy_scan_buffer(context->src.buf, len + 2, scanner);
+        if ( NULL != bs ) {
+            memset(&lloc, 0, sizeof(YYLTYPE));
+            n = 0;
+            while ( (yylex)(&lval, &lloc, scanner) ) {
+                n++;
+            }
+            yy_delete_buffer(bs, scanner);
+        }
+        yylex_destroy(scanner);
+    }
+    free(context->src.buf);
+    free(context->buffer.buf);
+    free(context);
+
+    return n;
+}
+
+/*
+ * minica_parse_path -- parse the specified file by mapping it into memory
+ */
+st_t *
+minica_parse_path(const char *path)
+{
+    context_t *context;
+    struct stat sb;
+    size_t pagesize;
+    size_t maplen;
+    void *ptr;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if ( fd < 0 ) {
+        return NULL;
+    }
+    if ( fstat(fd, &sb) < 0 ) {
+        close(fd);
+        return NULL;
+    }
+
+    context = _context_new();
+    if ( NULL == context ) {
+        close(fd);
+        return NULL;
+    }
+
+    /* Reserve a private, zero-filled region with room for the two trailing
+       NUL characters required by the scanner, then map the file over the
+       head of the region.  The bytes following the end of the file in its
+       last page are zero-filled, and so are the anonymous pages. */
+    pagesize = sysconf(_SC_PAGESIZE);
+    maplen = ((size_t)sb.st_size + 2 + pagesize - 1) & ~(pagesize - 1);
+    ptr = mmap(NULL, maplen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON,
+               -1, 0);
+    if ( MAP_FAILED == ptr ) {
+        free(context);
+        close(fd);
+        return NULL;
+    }
+    if ( sb.st_size > 0 ) {
+        if ( MAP_FAILED == mmap(ptr, sb.st_size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_FIXED, fd, 0) ) {
+            munmap(ptr, maplen);
+            free(context);
+            close(fd);
+            return NULL;
+        }
+    }
+    close(fd);
+
+    context->src.buf = ptr;
+    context->src.len = sb.st_size;
+    context->src.maplen = maplen;
+
+    return _parse(context);
+}
+
+/*
+ * minica_parse -- parse the specified file
+ */
+st_t *
+minica_parse(FILE *fp)
+{
+    context_t *context;
+    struct stat sb;
+    size_t size;
+    size_t len;
+    size_t n;
+    char *buf;
+    char *nbuf;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return NULL;
+    }
+
+    /* Use the file size as the initial buffer size when it is known */
+    size = 4096;
+    if ( 0 == fstat(fileno(fp), &sb) && S_ISREG(sb.st_mode) ) {
+        size = sb.st_size + 2;
+    }
+    buf = malloc(size);
+    if ( NULL == buf ) {
+        free(context);
+        return NULL;
+    }
+
+    /* Read the whole stream, doubling the buffer when it is full */
+    len = 0;
+    for ( ;; ) {
+        if ( len + 2 >= size ) {
+            nbuf = realloc(buf, size * 2);
+            if ( NULL == nbuf ) {
+                free(buf);
+                free(context);
+                return NULL;
+            }
+            buf = nbuf;
+            size *= 2;
+        }
+        n = fread(buf + len, 1, size - len - 2, fp);
+        if ( 0 == n ) {
+            break;
+        }
+        len += n;
+    }
+    buf[len] = '\0';
+    buf[len + 1] = '\0';
+
+    context->src.buf = buf;
+    context->src.len = len;
+    context->src.maplen = 0;
+
+    return _parse(context);
 }
 
 /*
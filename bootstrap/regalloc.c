@@ -0,0 +1,1452 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "compile.h"
+#include "arch/x86-64/reg.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define REGALLOC_MAX_ROUNDS     16
+
+/*
+ * x86-64 general-purpose registers; the caller-saved ones first.  The stack
+ * and frame pointers are not allocatable, and r11 is reserved as the scratch
+ * register of the code generator.
+ */
+static const int _x86_64_regs[] = {
+    REG_RAX, REG_RCX, REG_RDX, REG_RSI, REG_RDI, REG_R8, REG_R9, REG_R10,
+    REG_RBX, REG_R12, REG_R13, REG_R14, REG_R15,
+};
+static const char *_x86_64_names[] = {
+    "rax", "rcx", "rdx", "rsi", "rdi", "r8", "r9", "r10",
+    "rbx", "r12", "r13", "r14", "r15",
+};
+/* System V AMD64 calling convention */
+static const int _x86_64_args[] = {
+    REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9,
+};
+static const int _x86_64_rets[] = {
+    REG_RAX, REG_RDX,
+};
+const compiler_regset_t regalloc_x86_64 = {
+    .n = sizeof(_x86_64_regs) / sizeof(int),
+    .regs = _x86_64_regs,
+    .names = _x86_64_names,
+    .nargs = sizeof(_x86_64_args) / sizeof(int),
+    .args = _x86_64_args,
+    .nrets = sizeof(_x86_64_rets) / sizeof(int),
+    .rets = _x86_64_rets,
+    .div_quot = REG_RAX,
+    .div_rem = REG_RDX,
+    .mul_hi = REG_RDX,
+    .mul_lo = REG_RAX,
+    .shift_count = REG_RCX,
+};
+
+/*
+ * Context of the register allocation
+ */
+typedef struct {
+    ir_func_t *func;
+    const compiler_regset_t *rs;
+    /* Liveness (bit sets of the registers for each block) */
+    size_t nwords;
+    uint64_t *in;
+    uint64_t *out;
+    /* Interference graph */
+    compiler_ig_t ig;
+    /* Number of the occurrences of each register as the spill cost */
+    int *cost;
+    /* Registers that must not be spilled (e.g., spill temporaries) */
+    struct {
+        size_t n;
+        char *flags;
+    } nospill;
+} regalloc_ctx_t;
+
+/*
+ * _bit_test -- test a bit of the bit set
+ */
+static int
+_bit_test(const uint64_t *bs, size_t i)
+{
+    return (bs[i >> 6] >> (i & 63)) & 1;
+}
+
+/*
+ * _bit_set -- set a bit of the bit set
+ */
+static void
+_bit_set(uint64_t *bs, size_t i)
+{
+    bs[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+/*
+ * _bit_clear -- clear a bit of the bit set
+ */
+static void
+_bit_clear(uint64_t *bs, size_t i)
+{
+    bs[i >> 6] &= ~((uint64_t)1 << (i & 63));
+}
+
+/*
+ * _allocatable -- check if the register is allocated to a physical register
+ * (not spilled to the memory)
+ */
+static int
+_allocatable(ir_func_t *func, int r)
+{
+    return r >= 0 && func->reg.regs[r].slot < 0;
+}
+
+/*
+ * _copy -- check if the instruction is a move between the allocatable
+ * registers of the same type; a move to another type converts the value
+ */
+static int
+_copy(ir_func_t *func, const ir_instr_t *p)
+{
+    return p->opcode == IR_OPCODE_MOV
+        && p->operands[0].type == OPERAND_TYPE_REG
+        && _allocatable(func, p->operands[0].u.reg)
+        && _allocatable(func, p->result.reg[0])
+        && func->reg.regs[p->operands[0].u.reg].type
+        == func->reg.regs[p->result.reg[0]].type;
+}
+
+/*
+ * _fixed -- check if the register is fixed to a physical register
+ */
+static int
+_fixed(ir_func_t *func, int r)
+{
+    return func->reg.regs[r].hreg >= 0;
+}
+
+/*
+ * _index -- get the index of the physical register in the register set
+ */
+static int
+_index(const compiler_regset_t *rs, int hreg)
+{
+    int i;
+
+    for ( i = 0; i < rs->n; i++ ) {
+        if ( rs->regs[i] == hreg ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * _nospill -- mark the register not to be spilled
+ */
+static int
+_nospill(regalloc_ctx_t *ctx, int r)
+{
+    size_t nsize;
+    char *flags;
+
+    if ( (size_t)r >= ctx->nospill.n ) {
+        nsize = ctx->func->reg.size;
+        flags = realloc(ctx->nospill.flags, nsize);
+        if ( flags == NULL ) {
+            return -1;
+        }
+        memset(flags + ctx->nospill.n, 0, nsize - ctx->nospill.n);
+        ctx->nospill.flags = flags;
+        ctx->nospill.n = nsize;
+    }
+    ctx->nospill.flags[r] = 1;
+
+    return 0;
+}
+
+/*
+ * _reg_new -- allocate a new register not to be spilled
+ */
+static int
+_reg_new(regalloc_ctx_t *ctx, ir_reg_type_t type, int hreg)
+{
+    int r;
+
+    r = ir_func_reg_new(ctx->func, type, NULL);
+    if ( r < 0 ) {
+        return -1;
+    }
+    ctx->func->reg.regs[r].hreg = hreg;
+    if ( _nospill(ctx, r) < 0 ) {
+        return -1;
+    }
+
+    return r;
+}
+
+/*
+ * _mov -- initialize a register-to-register (or immediate) move; the source
+ * is copied when the move is inserted
+ */
+static ir_instr_t *
+_mov(ir_instr_t *instr, int dst, ir_operand_t *src)
+{
+    ir_instr_init(instr, IR_OPCODE_MOV, src);
+    instr->result.n = 1;
+    instr->result.reg[0] = dst;
+    instr->noperands = 1;
+
+    return instr;
+}
+
+/*
+ * _fix -- move the operand to a new register fixed to the physical register
+ * before the instruction
+ */
+static int
+_fix(regalloc_ctx_t *ctx, int pos, int j, ir_reg_type_t type, int hreg)
+{
+    ir_instr_t instr;
+    ir_instr_t *p;
+    int t;
+
+    t = _reg_new(ctx, type, hreg);
+    if ( t < 0 ) {
+        return -1;
+    }
+    p = &ctx->func->instr.instrs[pos];
+    if ( ir_instr_insert_before(ctx->func, pos,
+                                _mov(&instr, t, &p->operands[j])) < 0 ) {
+        return -1;
+    }
+    /* The array may be reallocated */
+    p = &ctx->func->instr.instrs[pos];
+    ir_operand_reg(&p->operands[j], t);
+
+    return 0;
+}
+
+/*
+ * _optype -- get the register type of the operand
+ */
+static ir_reg_type_t
+_optype(ir_func_t *func, const ir_operand_t *op)
+{
+    if ( op->type == OPERAND_TYPE_REG ) {
+        return func->reg.regs[op->u.reg].type;
+    }
+
+    return IR_REG_I64;
+}
+
+/*
+ * _constrain_args -- move the arguments from the registers of the calling
+ * convention at the entry
+ */
+static int
+_constrain_args(regalloc_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_operand_t op;
+    size_t i;
+    int head;
+    int arg;
+    int t;
+
+    func = ctx->func;
+    if ( func->block.n == 0 ) {
+        return 0;
+    }
+    for ( i = 0; i < func->reg.n; i++ ) {
+        arg = func->reg.regs[i].arg;
+        if ( arg < 0 || _fixed(func, i) ) {
+            continue;
+        }
+        if ( arg >= ctx->rs->nargs ) {
+            /* Arguments on the stack are not supported */
+            return -1;
+        }
+        t = _reg_new(ctx, func->reg.regs[i].type, ctx->rs->args[arg]);
+        if ( t < 0 ) {
+            return -1;
+        }
+        ir_operand_reg(&op, t);
+        head = func->block.blocks[0].head;
+        if ( head < 0 ) {
+            if ( ir_block_append(func, 0, _mov(&instr, i, &op)) < 0 ) {
+                return -1;
+            }
+        } else {
+            if ( ir_instr_insert_before(func, head, _mov(&instr, i, &op))
+                 < 0 ) {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _constrain_wide -- fix the registers of a division or a high-half
+ * multiplication, which takes the first operand in a fixed register and
+ * defines the pair of the fixed registers; return the position of the last
+ * instruction inserted
+ */
+static int
+_constrain_wide(regalloc_ctx_t *ctx, int pos)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_operand_t op;
+    ir_reg_type_t type;
+    int dsts[2];
+    int hregs[2];
+    int hin;
+    int n;
+    int j;
+
+    func = ctx->func;
+    p = &func->instr.instrs[pos];
+    hin = ctx->rs->div_quot;
+    switch ( p->opcode ) {
+    case IR_OPCODE_DIV:
+        hregs[0] = ctx->rs->div_quot;
+        hregs[1] = ctx->rs->div_rem;
+        break;
+    case IR_OPCODE_MOD:
+        hregs[0] = ctx->rs->div_rem;
+        hregs[1] = ctx->rs->div_quot;
+        break;
+    default:
+        hin = ctx->rs->mul_lo;
+        hregs[0] = ctx->rs->mul_hi;
+        hregs[1] = ctx->rs->mul_lo;
+        break;
+    }
+    n = p->result.n;
+    for ( j = 0; j < n; j++ ) {
+        dsts[j] = p->result.reg[j];
+    }
+    type = func->reg.regs[dsts[0]].type;
+
+    /* The first operand */
+    if ( _fix(ctx, pos, 0, type, hin) < 0 ) {
+        return -1;
+    }
+    p = &func->instr.instrs[pos];
+
+    /* The second operand must be a register */
+    if ( p->operands[1].type == OPERAND_TYPE_IMM ) {
+        if ( _fix(ctx, pos, 1, type, -1) < 0 ) {
+            return -1;
+        }
+        p = &func->instr.instrs[pos];
+    }
+
+    /* Results */
+    for ( j = 0; j < 2; j++ ) {
+        hregs[j] = _reg_new(ctx, type, hregs[j]);
+        if ( hregs[j] < 0 ) {
+            return -1;
+        }
+        p->result.reg[j] = hregs[j];
+    }
+    p->result.n = 2;
+    for ( j = 0; j < n; j++ ) {
+        ir_operand_reg(&op, hregs[j]);
+        pos = ir_instr_insert_after(func, pos, _mov(&instr, dsts[j], &op));
+        if ( pos < 0 ) {
+            return -1;
+        }
+    }
+
+    return pos;
+}
+
+/*
+ * _constrain -- apply the fixed-register constraints; the arguments and the
+ * return values are passed in the registers of the calling convention (a
+ * yield returns the values, and defines the frame pointer passed as the first
+ * argument at the resume), the dividend is moved to the quotient register and
+ * the division defines both the quotient and the remainder registers (as the
+ * high-half multiplication does with its registers), and the shift count is
+ * in the count register
+ */
+static int
+_constrain(regalloc_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_operand_t op;
+    ir_reg_type_t type;
+    size_t b;
+    int pos;
+    int j;
+    int t;
+
+    if ( _constrain_args(ctx) < 0 ) {
+        return -1;
+    }
+
+    func = ctx->func;
+    for ( b = 0; b < func->block.n; b++ ) {
+        for ( pos = func->block.blocks[b].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode == IR_OPCODE_RET
+                 || p->opcode == IR_OPCODE_YIELD ) {
+                /* Return values */
+                if ( p->noperands > ctx->rs->nrets ) {
+                    return -1;
+                }
+                for ( j = 0; j < p->noperands; j++ ) {
+                    type = _optype(func, &p->operands[j]);
+                    if ( _fix(ctx, pos, j, type, ctx->rs->rets[j]) < 0 ) {
+                        return -1;
+                    }
+                }
+                p = &func->instr.instrs[pos];
+                if ( p->opcode == IR_OPCODE_YIELD && p->result.n > 0 ) {
+                    /* Frame pointer at the resume */
+                    t = _reg_new(ctx, IR_REG_PTR, ctx->rs->args[0]);
+                    if ( t < 0 ) {
+                        return -1;
+                    }
+                    p = &func->instr.instrs[pos];
+                    ir_operand_reg(&op, t);
+                    _mov(&instr, p->result.reg[0], &op);
+                    p->result.reg[0] = t;
+                    pos = ir_instr_insert_after(func, pos, &instr);
+                    if ( pos < 0 ) {
+                        return -1;
+                    }
+                    p = &func->instr.instrs[pos];
+                }
+                continue;
+            }
+            if ( (p->opcode == IR_OPCODE_LSHIFT
+                  || p->opcode == IR_OPCODE_RSHIFT)
+                 && p->operands[1].type == OPERAND_TYPE_REG ) {
+                /* Shift count */
+                type = func->reg.regs[p->operands[1].u.reg].type;
+                if ( _fix(ctx, pos, 1, type, ctx->rs->shift_count) < 0 ) {
+                    return -1;
+                }
+                p = &func->instr.instrs[pos];
+                continue;
+            }
+            if ( p->opcode != IR_OPCODE_DIV && p->opcode != IR_OPCODE_MOD
+                 && p->opcode != IR_OPCODE_MULH ) {
+                continue;
+            }
+            pos = _constrain_wide(ctx, pos);
+            if ( pos < 0 ) {
+                return -1;
+            }
+            p = &func->instr.instrs[pos];
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _liveness -- compute the live-in and live-out registers of the blocks
+ */
+static int
+_liveness(regalloc_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_block_t *b;
+    ir_instr_t *p;
+    uint64_t *use;
+    uint64_t *def;
+    uint64_t *in;
+    uint64_t *out;
+    uint64_t v;
+    size_t nw;
+    size_t i;
+    size_t w;
+    int changed;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int s;
+
+    func = ctx->func;
+    nw = (func->reg.n + 63) / 64;
+    ctx->nwords = nw;
+    free(ctx->in);
+    ctx->in = malloc(sizeof(uint64_t) * nw * func->block.n * 4);
+    if ( ctx->in == NULL ) {
+        return -1;
+    }
+    memset(ctx->in, 0, sizeof(uint64_t) * nw * func->block.n * 4);
+    ctx->out = ctx->in + nw * func->block.n;
+    use = ctx->out + nw * func->block.n;
+    def = use + nw * func->block.n;
+
+    /* Registers used before defined, and defined in each block */
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        b = &func->block.blocks[func->rpo.blocks[i]];
+        in = use + nw * func->rpo.blocks[i];
+        out = def + nw * func->rpo.blocks[i];
+        for ( pos = b->head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( _allocatable(func, *r) && !_bit_test(out, *r) ) {
+                        _bit_set(in, *r);
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                if ( _allocatable(func, p->result.reg[j]) ) {
+                    _bit_set(out, p->result.reg[j]);
+                }
+            }
+        }
+    }
+
+    /* Solve the backward data-flow equations in the postorder */
+    do {
+        changed = 0;
+        for ( i = func->rpo.n; i > 0; i-- ) {
+            s = func->rpo.blocks[i - 1];
+            b = &func->block.blocks[s];
+            out = ctx->out + nw * s;
+            for ( j = 0; j < b->nsuccs; j++ ) {
+                in = ctx->in + nw * b->succs[j];
+                for ( w = 0; w < nw; w++ ) {
+                    out[w] |= in[w];
+                }
+            }
+            in = ctx->in + nw * s;
+            for ( w = 0; w < nw; w++ ) {
+                v = use[nw * s + w] | (out[w] & ~def[nw * s + w]);
+                if ( v != in[w] ) {
+                    in[w] = v;
+                    changed = 1;
+                }
+            }
+        }
+    } while ( changed );
+
+    return 0;
+}
+
+/*
+ * _ig_release -- release the interference graph
+ */
+static void
+_ig_release(compiler_ig_t *ig)
+{
+    size_t i;
+
+    if ( ig->adj != NULL ) {
+        for ( i = 0; i < ig->n; i++ ) {
+            free(ig->adj[i].vs);
+        }
+    }
+    free(ig->adj);
+    free(ig->matrix);
+    free(ig->edges.keys);
+    free(ig->moves.edges);
+    memset(ig, 0, sizeof(compiler_ig_t));
+}
+
+/*
+ * _ig_init -- initialize an interference graph of n vertices; the matrix of
+ * n x n bits is used only for a small graph
+ */
+static int
+_ig_init(compiler_ig_t *ig, size_t n)
+{
+    size_t nw;
+
+    memset(ig, 0, sizeof(compiler_ig_t));
+    ig->adj = malloc(sizeof(compiler_ig_adj_t) * (n > 0 ? n : 1));
+    if ( ig->adj == NULL ) {
+        return -1;
+    }
+    memset(ig->adj, 0, sizeof(compiler_ig_adj_t) * n);
+    ig->n = n;
+    if ( n <= COMPILER_IG_MATRIX_MAX ) {
+        nw = (n * n + 63) / 64;
+        ig->matrix = malloc(sizeof(uint64_t) * (nw > 0 ? nw : 1));
+        if ( ig->matrix == NULL ) {
+            _ig_release(ig);
+            return -1;
+        }
+        memset(ig->matrix, 0, sizeof(uint64_t) * nw);
+    } else {
+        ig->edges.size = COMPILER_IG_EDGES_INIT_SIZE;
+        ig->edges.keys = malloc(sizeof(uint64_t) * ig->edges.size);
+        if ( ig->edges.keys == NULL ) {
+            _ig_release(ig);
+            return -1;
+        }
+        memset(ig->edges.keys, 0, sizeof(uint64_t) * ig->edges.size);
+    }
+
+    return 0;
+}
+
+/*
+ * _edge_key -- get the key of an edge in the edge set
+ */
+static uint64_t
+_edge_key(int a, int b)
+{
+    if ( a > b ) {
+        return ((uint64_t)b << 32) | (uint32_t)a;
+    }
+
+    return ((uint64_t)a << 32) | (uint32_t)b;
+}
+
+/*
+ * _edge_slot -- get the slot of the key in the edge set, which is either the
+ * slot of the key or the empty one to insert it to
+ */
+static size_t
+_edge_slot(const uint64_t *keys, size_t size, uint64_t key)
+{
+    size_t i;
+
+    i = (size_t)((key * 0x9e3779b97f4a7c15ULL) >> 32) & (size - 1);
+    while ( keys[i] != 0 && keys[i] != key ) {
+        i = (i + 1) & (size - 1);
+    }
+
+    return i;
+}
+
+/*
+ * _edge_insert -- insert a key to the edge set, growing it up to the half
+ * full
+ */
+static int
+_edge_insert(compiler_ig_t *ig, uint64_t key)
+{
+    uint64_t *keys;
+    size_t nsize;
+    size_t i;
+
+    if ( (ig->edges.n + 1) * 2 > ig->edges.size ) {
+        nsize = ig->edges.size * 2;
+        keys = malloc(sizeof(uint64_t) * nsize);
+        if ( keys == NULL ) {
+            return -1;
+        }
+        memset(keys, 0, sizeof(uint64_t) * nsize);
+        for ( i = 0; i < ig->edges.size; i++ ) {
+            if ( ig->edges.keys[i] != 0 ) {
+                keys[_edge_slot(keys, nsize, ig->edges.keys[i])]
+                    = ig->edges.keys[i];
+            }
+        }
+        free(ig->edges.keys);
+        ig->edges.keys = keys;
+        ig->edges.size = nsize;
+    }
+    ig->edges.keys[_edge_slot(ig->edges.keys, ig->edges.size, key)] = key;
+    ig->edges.n++;
+
+    return 0;
+}
+
+/*
+ * _adj_add -- add a vertex to the adjacency list
+ */
+static int
+_adj_add(compiler_ig_adj_t *adj, int v)
+{
+    int nsize;
+    int *vs;
+
+    if ( adj->n >= adj->size ) {
+        nsize = adj->size ? adj->size * 2 : 8;
+        vs = realloc(adj->vs, sizeof(int) * nsize);
+        if ( vs == NULL ) {
+            return -1;
+        }
+        adj->vs = vs;
+        adj->size = nsize;
+    }
+    adj->vs[adj->n++] = v;
+
+    return 0;
+}
+
+/*
+ * _ig_interfere -- check if two vertices interfere
+ */
+static int
+_ig_interfere(compiler_ig_t *ig, int a, int b)
+{
+    uint64_t key;
+
+    if ( ig->matrix != NULL ) {
+        return _bit_test(ig->matrix, (size_t)a * ig->n + b);
+    }
+    if ( a == b ) {
+        return 0;
+    }
+    key = _edge_key(a, b);
+
+    return ig->edges.keys[_edge_slot(ig->edges.keys, ig->edges.size, key)]
+        == key;
+}
+
+/*
+ * _ig_edge -- add an edge between two vertices
+ */
+static int
+_ig_edge(compiler_ig_t *ig, int a, int b)
+{
+    if ( a == b || _ig_interfere(ig, a, b) ) {
+        return 0;
+    }
+    if ( ig->matrix != NULL ) {
+        _bit_set(ig->matrix, (size_t)a * ig->n + b);
+        _bit_set(ig->matrix, (size_t)b * ig->n + a);
+    } else if ( _edge_insert(ig, _edge_key(a, b)) < 0 ) {
+        return -1;
+    }
+    if ( _adj_add(&ig->adj[a], b) < 0 || _adj_add(&ig->adj[b], a) < 0 ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _ig_move -- record a move between two vertices
+ */
+static int
+_ig_move(compiler_ig_t *ig, int dst, int src)
+{
+    size_t nsize;
+    compiler_edge_t *edges;
+
+    if ( ig->moves.n >= ig->moves.size ) {
+        nsize = ig->moves.size ? ig->moves.size * 2 : 16;
+        edges = realloc(ig->moves.edges, sizeof(compiler_edge_t) * nsize);
+        if ( edges == NULL ) {
+            return -1;
+        }
+        ig->moves.edges = edges;
+        ig->moves.size = nsize;
+    }
+    ig->moves.edges[ig->moves.n].pair[0] = dst;
+    ig->moves.edges[ig->moves.n].pair[1] = src;
+    ig->moves.n++;
+
+    return 0;
+}
+
+/*
+ * _ig_live -- add edges between the register and the live registers
+ */
+static int
+_ig_live(regalloc_ctx_t *ctx, uint64_t *live, int r)
+{
+    uint64_t v;
+    size_t w;
+    int l;
+
+    for ( w = 0; w < ctx->nwords; w++ ) {
+        v = live[w];
+        while ( v ) {
+            l = w * 64 + __builtin_ctzll(v);
+            v &= v - 1;
+            if ( _ig_edge(&ctx->ig, r, l) < 0 ) {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * _build -- build the interference graph from the liveness
+ */
+static int
+_build(regalloc_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t *p;
+    uint64_t *live;
+    size_t nw;
+    size_t i;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int d;
+
+    func = ctx->func;
+    nw = ctx->nwords;
+    if ( _ig_init(&ctx->ig, func->reg.n) < 0 ) {
+        return -1;
+    }
+    free(ctx->cost);
+    ctx->cost = malloc(sizeof(int) * func->reg.n);
+    live = malloc(sizeof(uint64_t) * (nw > 0 ? nw : 1));
+    if ( ctx->cost == NULL || live == NULL ) {
+        free(live);
+        return -1;
+    }
+    memset(ctx->cost, 0, sizeof(int) * func->reg.n);
+
+    for ( i = 0; i < func->rpo.n; i++ ) {
+        memcpy(live, ctx->out + nw * func->rpo.blocks[i],
+               sizeof(uint64_t) * nw);
+        for ( pos = func->block.blocks[func->rpo.blocks[i]].tail; pos >= 0;
+              pos = p->prev ) {
+            p = &func->instr.instrs[pos];
+
+            /* The source and the destination of a move do not interfere */
+            if ( _copy(func, p) ) {
+                _bit_clear(live, p->operands[0].u.reg);
+                if ( _ig_move(&ctx->ig, p->result.reg[0],
+                              p->operands[0].u.reg) < 0 ) {
+                    goto error;
+                }
+            }
+
+            /* Definitions interfere with the live registers and with each
+               other */
+            for ( j = 0; j < p->result.n; j++ ) {
+                d = p->result.reg[j];
+                if ( !_allocatable(func, d) ) {
+                    continue;
+                }
+                ctx->cost[d]++;
+                if ( _ig_live(ctx, live, d) < 0 ) {
+                    goto error;
+                }
+                for ( k = 0; k < j; k++ ) {
+                    if ( _ig_edge(&ctx->ig, d, p->result.reg[k]) < 0 ) {
+                        goto error;
+                    }
+                }
+            }
+
+            /* The divisor must not be in the registers of the results, which
+               are overwritten before the division, nor the shift count in the
+               register of the result computed before the shift */
+            if ( ((p->opcode == IR_OPCODE_DIV || p->opcode == IR_OPCODE_MOD)
+                  && p->result.n == 2)
+                 || p->opcode == IR_OPCODE_LSHIFT
+                 || p->opcode == IR_OPCODE_RSHIFT ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[1], k)) != NULL;
+                      k++ ) {
+                    if ( !_allocatable(func, *r) ) {
+                        continue;
+                    }
+                    for ( j = 0; j < p->result.n; j++ ) {
+                        if ( _allocatable(func, p->result.reg[j])
+                             && _ig_edge(&ctx->ig, *r, p->result.reg[j])
+                             < 0 ) {
+                            goto error;
+                        }
+                    }
+                }
+            }
+
+            for ( j = 0; j < p->result.n; j++ ) {
+                if ( _allocatable(func, p->result.reg[j]) ) {
+                    _bit_clear(live, p->result.reg[j]);
+                }
+            }
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( _allocatable(func, *r) ) {
+                        ctx->cost[*r]++;
+                        _bit_set(live, *r);
+                    }
+                }
+            }
+        }
+    }
+
+    /* The registers live at the entry (e.g., the arguments) are defined at
+       the same time */
+    if ( func->rpo.n > 0 ) {
+        memcpy(live, ctx->in + nw * func->rpo.blocks[0],
+               sizeof(uint64_t) * nw);
+        for ( i = 0; i < func->reg.n; i++ ) {
+            if ( _bit_test(live, i) ) {
+                _bit_clear(live, i);
+                if ( _ig_live(ctx, live, i) < 0 ) {
+                    goto error;
+                }
+            }
+        }
+    }
+    free(live);
+
+    return 0;
+
+error:
+    free(live);
+    _ig_release(&ctx->ig);
+    return -1;
+}
+
+/*
+ * _find -- find the representative of the coalesced registers
+ */
+static int
+_find(int *alias, int r)
+{
+    while ( alias[r] != r ) {
+        alias[r] = alias[alias[r]];
+        r = alias[r];
+    }
+
+    return r;
+}
+
+/*
+ * _conservative -- check if coalescing y into x never makes the graph
+ * uncolorable; George's test against a fixed register, otherwise Briggs' test
+ */
+static int
+_conservative(regalloc_ctx_t *ctx, int *alias, int x, int y)
+{
+    compiler_ig_t *ig;
+    ir_func_t *func;
+    char *seen;
+    int k;
+    int i;
+    int t;
+    int cnt;
+    int ret;
+
+    func = ctx->func;
+    ig = &ctx->ig;
+    k = ctx->rs->n;
+
+    if ( _fixed(func, x) ) {
+        for ( i = 0; i < ig->adj[y].n; i++ ) {
+            t = _find(alias, ig->adj[y].vs[i]);
+            if ( _fixed(func, t) ) {
+                if ( func->reg.regs[t].hreg == func->reg.regs[x].hreg ) {
+                    return 0;
+                }
+            } else if ( ig->adj[t].n >= k && !_ig_interfere(ig, t, x) ) {
+                return 0;
+            }
+        }
+        return 1;
+    }
+
+    seen = malloc(ig->n);
+    if ( seen == NULL ) {
+        return 0;
+    }
+    memset(seen, 0, ig->n);
+    cnt = 0;
+    for ( i = 0; i < ig->adj[x].n + ig->adj[y].n; i++ ) {
+        if ( i < ig->adj[x].n ) {
+            t = _find(alias, ig->adj[x].vs[i]);
+        } else {
+            t = _find(alias, ig->adj[y].vs[i - ig->adj[x].n]);
+        }
+        if ( seen[t] || t == x || t == y ) {
+            continue;
+        }
+        seen[t] = 1;
+        if ( _fixed(func, t) || ig->adj[t].n >= k ) {
+            cnt++;
+        }
+    }
+    free(seen);
+    ret = cnt < k;
+
+    return ret;
+}
+
+/*
+ * _coalesce -- conservatively coalesce the move-related registers and rewrite
+ * the code; return the number of the coalesced moves
+ */
+static int
+_coalesce(regalloc_ctx_t *ctx)
+{
+    compiler_ig_t *ig;
+    ir_func_t *func;
+    ir_instr_t *p;
+    size_t i;
+    int *alias;
+    int *r;
+    int cnt;
+    int pos;
+    int x;
+    int y;
+    int t;
+    int j;
+    int k;
+
+    func = ctx->func;
+    ig = &ctx->ig;
+    alias = malloc(sizeof(int) * (ig->n > 0 ? ig->n : 1));
+    if ( alias == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < ig->n; i++ ) {
+        alias[i] = i;
+    }
+
+    cnt = 0;
+    for ( i = 0; i < ig->moves.n; i++ ) {
+        x = _find(alias, ig->moves.edges[i].pair[0]);
+        y = _find(alias, ig->moves.edges[i].pair[1]);
+        if ( x == y ) {
+            continue;
+        }
+        /* Keep the fixed register */
+        if ( _fixed(func, y) ) {
+            t = x;
+            x = y;
+            y = t;
+        }
+        if ( _fixed(func, y) ) {
+            continue;
+        }
+        if ( _ig_interfere(ig, x, y) ) {
+            continue;
+        }
+        if ( !_conservative(ctx, alias, x, y) ) {
+            continue;
+        }
+
+        /* Merge y into x */
+        alias[y] = x;
+        for ( j = 0; j < ig->adj[y].n; j++ ) {
+            if ( _ig_edge(ig, x, _find(alias, ig->adj[y].vs[j])) < 0 ) {
+                free(alias);
+                return -1;
+            }
+        }
+        cnt++;
+    }
+
+    if ( cnt == 0 ) {
+        free(alias);
+        return 0;
+    }
+
+    /* Rewrite the code, and remove the moves between the same register */
+    for ( i = 0; i < func->block.n; i++ ) {
+        pos = func->block.blocks[i].head;
+        while ( pos >= 0 ) {
+            p = &func->instr.instrs[pos];
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *r >= 0 && (size_t)*r < ig->n ) {
+                        *r = _find(alias, *r);
+                    }
+                }
+            }
+            for ( j = 0; j < p->result.n; j++ ) {
+                p->result.reg[j] = _find(alias, p->result.reg[j]);
+            }
+            t = p->next;
+            if ( p->opcode == IR_OPCODE_MOV
+                 && p->operands[0].type == OPERAND_TYPE_REG
+                 && p->operands[0].u.reg == p->result.reg[0] ) {
+                ir_instr_remove(func, pos);
+            }
+            pos = t;
+        }
+    }
+    free(alias);
+
+    return cnt;
+}
+
+/*
+ * _color -- color the interference graph by simplification and optimistic
+ * selection; return the number of the registers to spill, which are marked
+ * with -1 in the colors
+ */
+static int
+_color(regalloc_ctx_t *ctx, int *color)
+{
+    compiler_ig_t *ig;
+    ir_func_t *func;
+    uint64_t used;
+    int *degree;
+    int *stack;
+    int *queue;
+    char *removed;
+    size_t n;
+    size_t sp;
+    size_t qh;
+    size_t qt;
+    size_t i;
+    int nleft;
+    int nspills;
+    int k;
+    int v;
+    int t;
+    int j;
+
+    func = ctx->func;
+    ig = &ctx->ig;
+    n = ig->n;
+    k = ctx->rs->n;
+
+    degree = malloc(sizeof(int) * (n * 3 + 1));
+    removed = malloc(n + 1);
+    if ( degree == NULL || removed == NULL ) {
+        free(degree);
+        free(removed);
+        return -1;
+    }
+    stack = degree + n;
+    queue = stack + n;
+
+    /* Nodes are the allocatable registers appearing in the code */
+    nleft = 0;
+    qh = 0;
+    qt = 0;
+    for ( i = 0; i < n; i++ ) {
+        color[i] = -1;
+        if ( _fixed(func, i) ) {
+            color[i] = _index(ctx->rs, func->reg.regs[i].hreg);
+        }
+        degree[i] = ig->adj[i].n;
+        removed[i] = 1;
+        if ( _fixed(func, i) || !_allocatable(func, i) ) {
+            continue;
+        }
+        if ( ctx->cost[i] == 0 && ig->adj[i].n == 0 ) {
+            continue;
+        }
+        removed[i] = 0;
+        nleft++;
+        if ( degree[i] < k ) {
+            queue[qt++] = i;
+        }
+    }
+
+    /* Simplify */
+    sp = 0;
+    while ( nleft > 0 ) {
+        v = -1;
+        while ( qh < qt ) {
+            v = queue[qh++];
+            if ( !removed[v] ) {
+                break;
+            }
+            v = -1;
+        }
+        if ( v < 0 ) {
+            /* Select a spill candidate of the minimum cost per degree */
+            for ( i = 0; i < n; i++ ) {
+                if ( removed[i] ) {
+                    continue;
+                }
+                if ( v < 0 ) {
+                    v = i;
+                    continue;
+                }
+                if ( (i < ctx->nospill.n && ctx->nospill.flags[i])
+                     != (v < (int)ctx->nospill.n && ctx->nospill.flags[v]) ) {
+                    if ( i >= ctx->nospill.n || !ctx->nospill.flags[i] ) {
+                        v = i;
+                    }
+                    continue;
+                }
+                if ( (long)ctx->cost[i] * degree[v]
+                     < (long)ctx->cost[v] * degree[i] ) {
+                    v = i;
+                }
+            }
+        }
+        removed[v] = 1;
+        nleft--;
+        stack[sp++] = v;
+        for ( j = 0; j < ig->adj[v].n; j++ ) {
+            t = ig->adj[v].vs[j];
+            if ( removed[t] ) {
+                continue;
+            }
+            degree[t]--;
+            if ( degree[t] == k - 1 ) {
+                queue[qt++] = t;
+            }
+        }
+    }
+
+    /* Select */
+    nspills = 0;
+    while ( sp > 0 ) {
+        v = stack[--sp];
+        used = 0;
+        for ( j = 0; j < ig->adj[v].n; j++ ) {
+            t = ig->adj[v].vs[j];
+            if ( color[t] >= 0 ) {
+                used |= (uint64_t)1 << color[t];
+            }
+        }
+        for ( j = 0; j < k; j++ ) {
+            if ( !((used >> j) & 1) ) {
+                break;
+            }
+        }
+        if ( j < k ) {
+            color[v] = j;
+        } else {
+            /* Actual spill */
+            color[v] = -1;
+            ctx->cost[v] = -1;
+            nspills++;
+        }
+    }
+
+    free(degree);
+    free(removed);
+
+    return nspills;
+}
+
+/*
+ * _spill -- rewrite the code to keep the spilled registers in memory; a
+ * spilled register is read and written only by moves from/to short-lived
+ * temporaries
+ */
+static int
+_spill(regalloc_ctx_t *ctx)
+{
+    ir_func_t *func;
+    ir_instr_t instr;
+    ir_instr_t *p;
+    ir_operand_t op;
+    size_t nregs;
+    size_t i;
+    int pos;
+    int *r;
+    int j;
+    int k;
+    int t;
+
+    func = ctx->func;
+    nregs = ctx->ig.n;
+    for ( i = 0; i < nregs; i++ ) {
+        if ( ctx->cost[i] < 0 ) {
+            func->reg.regs[i].slot = func->nslots++;
+        }
+    }
+
+    for ( i = 0; i < func->block.n; i++ ) {
+        for ( pos = func->block.blocks[i].head; pos >= 0; pos = p->next ) {
+            p = &func->instr.instrs[pos];
+            if ( p->opcode == IR_OPCODE_MOV
+                 && (!_allocatable(func, p->result.reg[0])
+                     || (p->operands[0].type == OPERAND_TYPE_REG
+                         && !_allocatable(func, p->operands[0].u.reg)))
+                 && !(!_allocatable(func, p->result.reg[0])
+                      && p->operands[0].type == OPERAND_TYPE_REG
+                      && !_allocatable(func, p->operands[0].u.reg)) ) {
+                /* A load or store already */
+                continue;
+            }
+            /* Load before the use */
+            for ( j = 0; j < p->noperands; j++ ) {
+                for ( k = 0; (r = ir_operand_use(&p->operands[j], k)) != NULL;
+                      k++ ) {
+                    if ( *r < 0 || _allocatable(func, *r) ) {
+                        continue;
+                    }
+                    t = _reg_new(ctx, func->reg.regs[*r].type, -1);
+                    if ( t < 0 ) {
+                        return -1;
+                    }
+                    p = &func->instr.instrs[pos];
+                    r = ir_operand_use(&p->operands[j], k);
+                    ir_operand_reg(&op, *r);
+                    *r = t;
+                    if ( ir_instr_insert_before(func, pos,
+                                                _mov(&instr, t, &op)) < 0 ) {
+                        return -1;
+                    }
+                    p = &func->instr.instrs[pos];
+                }
+            }
+            /* Store after the definition */
+            for ( j = 0; j < p->result.n; j++ ) {
+                if ( _allocatable(func, p->result.reg[j]) ) {
+                    continue;
+                }
+                t = _reg_new(ctx, func->reg.regs[p->result.reg[j]].type, -1);
+                if ( t < 0 ) {
+                    return -1;
+                }
+                p = &func->instr.instrs[pos];
+                ir_operand_reg(&op, t);
+                _mov(&instr, p->result.reg[j], &op);
+                p->result.reg[j] = t;
+                pos = ir_instr_insert_after(func, pos, &instr);
+                if ( pos < 0 ) {
+                    return -1;
+                }
+                p = &func->instr.instrs[pos];
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * regalloc -- allocate the physical registers to the virtual registers of the
+ * function by graph coloring (Chaitin-Briggs with conservative coalescing);
+ * all the registers are allocated from the general-purpose registers
+ */
+int
+regalloc(ir_func_t *func, const compiler_regset_t *rs)
+{
+    regalloc_ctx_t ctx;
+    ir_instr_t *p;
+    int *color;
+    size_t i;
+    int round;
+    int ret;
+    int pos;
+    int t;
+
+    if ( func->ssa || rs->n > 64 ) {
+        return -1;
+    }
+    memset(&ctx, 0, sizeof(regalloc_ctx_t));
+    ctx.func = func;
+    ctx.rs = rs;
+    color = NULL;
+
+    if ( _constrain(&ctx) < 0 ) {
+        goto error;
+    }
+
+    for ( round = 0; round < REGALLOC_MAX_ROUNDS; round++ ) {
+        /* Build and coalesce until no more moves are coalesced */
+        for ( ;; ) {
+            if ( _liveness(&ctx) < 0 || _build(&ctx) < 0 ) {
+                goto error;
+            }
+            ret = _coalesce(&ctx);
+            if ( ret < 0 ) {
+                goto error;
+            }
+            if ( ret == 0 ) {
+                break;
+            }
+            _ig_release(&ctx.ig);
+        }
+
+        /* Color */
+        free(color);
+        color = malloc(sizeof(int) * (ctx.ig.n > 0 ? ctx.ig.n : 1));
+        if ( color == NULL ) {
+            goto error;
+        }
+        ret = _color(&ctx, color);
+        if ( ret < 0 ) {
+            goto error;
+        }
+        if ( ret == 0 ) {
+            break;
+        }
+
+        /* Spill and retry */
+        if ( _spill(&ctx) < 0 ) {
+            goto error;
+        }
+        _ig_release(&ctx.ig);
+    }
+    if ( round >= REGALLOC_MAX_ROUNDS ) {
+        goto error;
+    }
+
+    /* Assign the colors */
+    for ( i = 0; i < ctx.ig.n; i++ ) {
+        if ( _allocatable(func, i) && !_fixed(func, i) && color[i] >= 0 ) {
+            func->reg.regs[i].hreg = rs->regs[color[i]];
+        }
+    }
+
+    /* Remove the moves between the same physical registers */
+    for ( i = 0; i < func->block.n; i++ ) {
+        pos = func->block.blocks[i].head;
+        while ( pos >= 0 ) {
+            p = &func->instr.instrs[pos];
+            t = p->next;
+            if ( _copy(func, p)
+                 && func->reg.regs[p->operands[0].u.reg].hreg
+                 == func->reg.regs[p->result.reg[0]].hreg ) {
+                ir_instr_remove(func, pos);
+            }
+            pos = t;
+        }
+    }
+
+    _ig_release(&ctx.ig);
+    free(color);
+    free(ctx.in);
+    free(ctx.cost);
+    free(ctx.nospill.flags);
+
+    return 0;
+
+error:
+    _ig_release(&ctx.ig);
+    free(color);
+    free(ctx.in);
+    free(ctx.cost);
+    free(ctx.nospill.flags);
+    return -1;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,320 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "report.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Names of the phases
+ */
+static const char *_names[REPORT_NPHASES] = {
+    [REPORT_LEX] = "lex",
+    [REPORT_PARSE] = "parse",
+    [REPORT_COMPILE] = "compile",
+    [REPORT_TO_SSA] = "to_ssa",
+    [REPORT_SCCP] = "sccp",
+    [REPORT_GVN] = "gvn",
+    [REPORT_DIVMOD] = "divmod",
+    [REPORT_FROM_SSA] = "from_ssa",
+    [REPORT_DCE] = "dce",
+    [REPORT_CORO] = "coroutine",
+    [REPORT_REGALLOC] = "regalloc",
+    [REPORT_ASSEMBLE] = "assemble",
+    [REPORT_EXPORT] = "export",
+};
+
+/* Flags, the statistics, and the time enabled */
+static atomic_int _flags;
+static report_stat_t _stats[REPORT_NPHASES];
+static uint64_t _start;
+
+/* Bytes of the heap in use, and the outermost phase running, which the
+   allocations of the threads out of any phase (e.g., the workers compiling
+   the functions) are counted to */
+static atomic_uint_least64_t _inuse;
+static atomic_int _global = -1;
+
+/* Innermost phase of the thread */
+static _Thread_local int _phase = -1;
+
+/*
+ * _now -- get the monotonic time in nanoseconds
+ */
+static uint64_t
+_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*
+ * _peak -- raise the peak of the phase to the bytes in use
+ */
+static void
+_peak(int phase, uint64_t inuse)
+{
+    uint64_t peak;
+
+    peak = atomic_load_explicit(&_stats[phase].peak, memory_order_relaxed);
+    while ( peak < inuse
+            && !atomic_compare_exchange_weak_explicit(&_stats[phase].peak,
+                                                      &peak, inuse,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed) ) {
+    }
+}
+
+/*
+ * report_alloc -- count an allocation of the bytes to the current phase;
+ * called by the allocator replaced (see report_malloc.c)
+ */
+void
+report_alloc(size_t size)
+{
+    uint64_t inuse;
+    int phase;
+
+    if ( !(atomic_load_explicit(&_flags, memory_order_relaxed)
+           & REPORT_MEM) ) {
+        return;
+    }
+    inuse = atomic_fetch_add_explicit(&_inuse, size, memory_order_relaxed)
+        + size;
+    phase = _phase >= 0 ? _phase
+        : atomic_load_explicit(&_global, memory_order_relaxed);
+    if ( phase >= 0 ) {
+        atomic_fetch_add_explicit(&_stats[phase].allocs, 1,
+                                  memory_order_relaxed);
+        atomic_fetch_add_explicit(&_stats[phase].bytes, size,
+                                  memory_order_relaxed);
+        _peak(phase, inuse);
+    }
+}
+
+/*
+ * report_free -- uncount the bytes of a block to be freed; the blocks
+ * allocated before enabled are not subtracted below zero
+ */
+void
+report_free(size_t size)
+{
+    uint64_t inuse;
+
+    if ( !(atomic_load_explicit(&_flags, memory_order_relaxed)
+           & REPORT_MEM) ) {
+        return;
+    }
+    inuse = atomic_load_explicit(&_inuse, memory_order_relaxed);
+    do {
+        if ( inuse < size ) {
+            size = inuse;
+        }
+    } while ( !atomic_compare_exchange_weak_explicit(&_inuse, &inuse,
+                                                     inuse - size,
+                                                     memory_order_relaxed,
+                                                     memory_order_relaxed) );
+}
+
+/*
+ * report_enable -- enable the report of the time and/or the memory
+ * (REPORT_TIME and REPORT_MEM), and reset the statistics
+ */
+void
+report_enable(int flags)
+{
+    int i;
+
+    for ( i = 0; i < REPORT_NPHASES; i++ ) {
+        atomic_store(&_stats[i].calls, 0);
+        atomic_store(&_stats[i].ns, 0);
+        atomic_store(&_stats[i].allocs, 0);
+        atomic_store(&_stats[i].bytes, 0);
+        atomic_store(&_stats[i].peak, 0);
+    }
+    atomic_store(&_inuse, 0);
+    _start = _now();
+    atomic_store(&_flags, flags);
+}
+
+/*
+ * report_enabled -- check if the report is enabled
+ */
+int
+report_enabled(void)
+{
+    return atomic_load_explicit(&_flags, memory_order_relaxed);
+}
+
+/*
+ * report_begin -- begin a phase on the thread
+ */
+void
+report_begin(report_span_t *span, report_phase_t phase)
+{
+    int global;
+
+    span->phase = -1;
+    if ( !atomic_load_explicit(&_flags, memory_order_relaxed) ) {
+        return;
+    }
+    span->phase = phase;
+    span->prev = _phase;
+    span->global = 0;
+    _phase = phase;
+    if ( span->prev < 0 ) {
+        /* The outermost phase of all the threads */
+        global = -1;
+        span->global = atomic_compare_exchange_strong(&_global, &global,
+                                                      phase);
+    }
+    _peak(phase, atomic_load_explicit(&_inuse, memory_order_relaxed));
+    span->start = _now();
+}
+
+/*
+ * report_end -- end the phase begun by report_begin()
+ */
+void
+report_end(report_span_t *span)
+{
+    report_sample(span, 1);
+}
+
+/*
+ * report_sample -- end the phase begun by report_begin() as the sample of n
+ * runs of the phase; the time and the calls are counted n times
+ */
+void
+report_sample(report_span_t *span, uint64_t n)
+{
+    uint64_t ns;
+
+    if ( span->phase < 0 ) {
+        return;
+    }
+    ns = _now() - span->start;
+    atomic_fetch_add_explicit(&_stats[span->phase].ns, ns * n,
+                              memory_order_relaxed);
+    atomic_fetch_add_explicit(&_stats[span->phase].calls, n,
+                              memory_order_relaxed);
+    _phase = span->prev;
+    if ( span->global ) {
+        atomic_store(&_global, -1);
+    }
+}
+
+/*
+ * report_name -- get the name of a phase
+ */
+const char *
+report_name(report_phase_t phase)
+{
+    return _names[phase];
+}
+
+/*
+ * report_ns -- get the time of a phase in nanoseconds
+ */
+uint64_t
+report_ns(report_phase_t phase)
+{
+    return atomic_load(&_stats[phase].ns);
+}
+
+/*
+ * report_print -- print the statistics as a table
+ */
+void
+report_print(FILE *fp)
+{
+    uint64_t total;
+    uint64_t ns;
+    int flags;
+    int i;
+
+    flags = report_enabled();
+    total = _now() - _start;
+    fprintf(fp, "%-10s %8s", "phase", "calls");
+    if ( flags & REPORT_TIME ) {
+        fprintf(fp, " %12s %6s", "wall (ms)", "%");
+    }
+    if ( flags & REPORT_MEM ) {
+        fprintf(fp, " %10s %12s %12s", "allocs", "bytes", "peak");
+    }
+    fprintf(fp, "\n");
+    for ( i = 0; i < REPORT_NPHASES; i++ ) {
+        fprintf(fp, "%-10s %8llu", _names[i],
+                (unsigned long long)atomic_load(&_stats[i].calls));
+        if ( flags & REPORT_TIME ) {
+            ns = atomic_load(&_stats[i].ns);
+            fprintf(fp, " %12.3f %6.1f", ns / 1e6,
+                    total ? 100.0 * ns / total : 0.0);
+        }
+        if ( flags & REPORT_MEM ) {
+            fprintf(fp, " %10llu %12llu %12llu",
+                    (unsigned long long)atomic_load(&_stats[i].allocs),
+                    (unsigned long long)atomic_load(&_stats[i].bytes),
+                    (unsigned long long)atomic_load(&_stats[i].peak));
+        }
+        fprintf(fp, "\n");
+    }
+    if ( flags & REPORT_TIME ) {
+        fprintf(fp, "%-10s %8s %12.3f\n", "total", "", total / 1e6);
+    }
+}
+
+/*
+ * report_json -- print the statistics as a JSON object
+ */
+void
+report_json(FILE *fp)
+{
+    int i;
+
+    fprintf(fp, "{\"total_ns\": %llu, \"phases\": [",
+            (unsigned long long)(_now() - _start));
+    for ( i = 0; i < REPORT_NPHASES; i++ ) {
+        fprintf(fp, "%s\n  {\"name\": \"%s\", \"calls\": %llu, "
+                "\"ns\": %llu, \"allocs\": %llu, \"bytes\": %llu, "
+                "\"peak\": %llu}", i ? "," : "", _names[i],
+                (unsigned long long)atomic_load(&_stats[i].calls),
+                (unsigned long long)atomic_load(&_stats[i].ns),
+                (unsigned long long)atomic_load(&_stats[i].allocs),
+                (unsigned long long)atomic_load(&_stats[i].bytes),
+                (unsigned long long)atomic_load(&_stats[i].peak));
+    }
+    fprintf(fp, "\n]}\n");
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,125 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _REPORT_H
+#define _REPORT_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+/*
+ * Phases of the compiler
+ */
+typedef enum {
+    REPORT_LEX,
+    REPORT_PARSE,
+    REPORT_COMPILE,
+    REPORT_TO_SSA,
+    REPORT_SCCP,
+    REPORT_GVN,
+    REPORT_DIVMOD,
+    REPORT_FROM_SSA,
+    REPORT_DCE,
+    REPORT_CORO,
+    REPORT_REGALLOC,
+    REPORT_ASSEMBLE,
+    REPORT_EXPORT,
+    REPORT_NPHASES,
+} report_phase_t;
+
+/*
+ * Report flags
+ */
+#define REPORT_TIME     1
+#define REPORT_MEM      2
+
+/* Runs of a short phase (e.g., scanning a token) per one timed */
+#define REPORT_SAMPLE   64
+
+/*
+ * Statistics of a phase; the time includes the nested phases, and sums up
+ * the threads running the phase at the same time, while the allocations are
+ * counted to the innermost phase of the thread.  The peak is the largest
+ * number of the bytes of the heap in use while the phase is running.
+ */
+typedef struct {
+    atomic_uint_least64_t calls;
+    atomic_uint_least64_t ns;
+    atomic_uint_least64_t allocs;
+    atomic_uint_least64_t bytes;
+    atomic_uint_least64_t peak;
+} report_stat_t;
+
+/*
+ * Span of a phase running on a thread
+ */
+typedef struct {
+    int phase;
+    int prev;
+    int global;
+    uint64_t start;
+} report_span_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* report.c */
+void
+report_enable(int);
+int
+report_enabled(void);
+void
+report_begin(report_span_t *, report_phase_t);
+void
+report_end(report_span_t *);
+void
+report_sample(report_span_t *, uint64_t);
+const char *
+report_name(report_phase_t);
+uint64_t
+report_ns(report_phase_t);
+void
+report_print(FILE *);
+void
+report_json(FILE *);
+void
+report_alloc(size_t);
+void
+report_free(size_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _REPORT_H */
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,140 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "report.h"
+#include <stdlib.h>
+#include <errno.h>
+
+/*
+ * The allocations are counted by replacing the allocator of the GNU C
+ * library, which looks up the size of a block by malloc_usable_size();
+ * without it (or under the sanitizers), only the time is reported.  This is
+ * linked only to the programs reporting the memory.
+ */
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) \
+    && !defined(__SANITIZE_THREAD__) && !defined(REPORT_NO_MALLOC)
+#include <malloc.h>
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void *__libc_memalign(size_t, size_t);
+void __libc_free(void *);
+
+/*
+ * _alloc -- count an allocation of the block
+ */
+static void *
+_alloc(void *ptr)
+{
+    if ( ptr != NULL && (report_enabled() & REPORT_MEM) ) {
+        report_alloc(malloc_usable_size(ptr));
+    }
+
+    return ptr;
+}
+
+/*
+ * _free -- uncount a block to be freed
+ */
+static void
+_free(void *ptr)
+{
+    if ( ptr != NULL && (report_enabled() & REPORT_MEM) ) {
+        report_free(malloc_usable_size(ptr));
+    }
+}
+
+void *
+malloc(size_t size)
+{
+    return _alloc(__libc_malloc(size));
+}
+
+void *
+calloc(size_t n, size_t size)
+{
+    return _alloc(__libc_calloc(n, size));
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+    size_t old;
+    void *p;
+
+    /* The block is intact if failed, and freed if the size is zero */
+    old = ptr != NULL && (report_enabled() & REPORT_MEM)
+        ? malloc_usable_size(ptr) : 0;
+    p = __libc_realloc(ptr, size);
+    if ( p == NULL && size > 0 ) {
+        return NULL;
+    }
+    if ( old > 0 ) {
+        report_free(old);
+    }
+
+    return _alloc(p);
+}
+
+void *
+memalign(size_t align, size_t size)
+{
+    return _alloc(__libc_memalign(align, size));
+}
+
+void *
+aligned_alloc(size_t align, size_t size)
+{
+    return _alloc(__libc_memalign(align, size));
+}
+
+int
+posix_memalign(void **ptr, size_t align, size_t size)
+{
+    void *p;
+
+    p = _alloc(__libc_memalign(align, size));
+    if ( p == NULL ) {
+        return ENOMEM;
+    }
+    *ptr = p;
+
+    return 0;
+}
+
+void
+free(void *ptr)
+{
+    _free(ptr);
+    __libc_free(ptr);
+}
+#endif
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,330 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "runtime.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _put -- copy n packets to the ring from the position
+ */
+static void
+_put(rt_chan_t *ch, int64_t pos, const int64_t *packets, int64_t n)
+{
+    int64_t i;
+    int64_t m;
+
+    i = pos & (ch->size - 1);
+    m = ch->size - i < n ? ch->size - i : n;
+    memcpy(ch->packets + ch->width * i, packets,
+           sizeof(int64_t) * ch->width * m);
+    memcpy(ch->packets, packets + ch->width * m,
+           sizeof(int64_t) * ch->width * (n - m));
+}
+
+/*
+ * _get -- copy n packets from the ring from the position
+ */
+static void
+_get(rt_chan_t *ch, int64_t pos, int64_t *packets, int64_t n)
+{
+    int64_t i;
+    int64_t m;
+
+    i = pos & (ch->size - 1);
+    m = ch->size - i < n ? ch->size - i : n;
+    memcpy(packets, ch->packets + ch->width * i,
+           sizeof(int64_t) * ch->width * m);
+    memcpy(packets + ch->width * m, ch->packets,
+           sizeof(int64_t) * ch->width * (n - m));
+}
+
+/*
+ * _spsc_enqueue -- enqueue up to n packets (by the producer)
+ */
+static int
+_spsc_enqueue(rt_chan_t *ch, const int64_t *packets, int n)
+{
+    int64_t t;
+    int64_t k;
+
+    t = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    k = ch->size - (t - ch->head_cache);
+    if ( k < n ) {
+        ch->head_cache = atomic_load_explicit(&ch->head,
+                                              memory_order_acquire);
+        k = ch->size - (t - ch->head_cache);
+    }
+    if ( k > n ) {
+        k = n;
+    }
+    _put(ch, t, packets, k);
+    atomic_store_explicit(&ch->tail, t + k, memory_order_release);
+
+    return k;
+}
+
+/*
+ * _spsc_dequeue -- dequeue up to n packets (by the consumer)
+ */
+static int
+_spsc_dequeue(rt_chan_t *ch, int64_t *packets, int n)
+{
+    int64_t h;
+    int64_t k;
+
+    h = atomic_load_explicit(&ch->head, memory_order_relaxed);
+    k = ch->tail_cache - h;
+    if ( k < n ) {
+        ch->tail_cache = atomic_load_explicit(&ch->tail,
+                                              memory_order_acquire);
+        k = ch->tail_cache - h;
+    }
+    if ( k > n ) {
+        k = n;
+    }
+    _get(ch, h, packets, k);
+    atomic_store_explicit(&ch->head, h + k, memory_order_release);
+
+    return k;
+}
+
+/*
+ * _mpmc_enqueue -- enqueue up to n packets; claim the consecutive entries
+ * released by the consumers, then release them to the consumers one by one
+ */
+static int
+_mpmc_enqueue(rt_chan_t *ch, const int64_t *packets, int n)
+{
+    int64_t pos;
+    int64_t seq;
+    int64_t k;
+    int64_t i;
+
+    pos = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    for ( ;; ) {
+        for ( k = 0; k < n; k++ ) {
+            seq = atomic_load_explicit(&ch->seqs[(pos + k) & (ch->size - 1)],
+                                       memory_order_acquire);
+            if ( seq != pos + k ) {
+                break;
+            }
+        }
+        if ( k == 0 ) {
+            if ( seq < pos ) {
+                /* Full */
+                return 0;
+            }
+            /* Claimed by another producer */
+            pos = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+            continue;
+        }
+        if ( atomic_compare_exchange_weak_explicit(&ch->tail, &pos, pos + k,
+                                                   memory_order_relaxed,
+                                                   memory_order_relaxed) ) {
+            break;
+        }
+    }
+    _put(ch, pos, packets, k);
+    for ( i = 0; i < k; i++ ) {
+        atomic_store_explicit(&ch->seqs[(pos + i) & (ch->size - 1)],
+                              pos + i + 1, memory_order_release);
+    }
+
+    return k;
+}
+
+/*
+ * _mpmc_dequeue -- dequeue up to n packets; claim the consecutive entries
+ * released by the producers, then release them to the producers one by one
+ */
+static int
+_mpmc_dequeue(rt_chan_t *ch, int64_t *packets, int n)
+{
+    int64_t pos;
+    int64_t seq;
+    int64_t k;
+    int64_t i;
+
+    pos = atomic_load_explicit(&ch->head, memory_order_relaxed);
+    for ( ;; ) {
+        for ( k = 0; k < n; k++ ) {
+            seq = atomic_load_explicit(&ch->seqs[(pos + k) & (ch->size - 1)],
+                                       memory_order_acquire);
+            if ( seq != pos + k + 1 ) {
+                break;
+            }
+        }
+        if ( k == 0 ) {
+            if ( seq < pos + 1 ) {
+                /* Empty */
+                return 0;
+            }
+            /* Claimed by another consumer */
+            pos = atomic_load_explicit(&ch->head, memory_order_relaxed);
+            continue;
+        }
+        if ( atomic_compare_exchange_weak_explicit(&ch->head, &pos, pos + k,
+                                                   memory_order_relaxed,
+                                                   memory_order_relaxed) ) {
+            break;
+        }
+    }
+    _get(ch, pos, packets, k);
+    for ( i = 0; i < k; i++ ) {
+        atomic_store_explicit(&ch->seqs[(pos + i) & (ch->size - 1)],
+                              pos + i + ch->size, memory_order_release);
+    }
+
+    return k;
+}
+
+/*
+ * rt_chan_new -- create a channel of size (a power of 2) packets of width
+ * values each
+ */
+rt_chan_t *
+rt_chan_new(rt_chan_type_t type, int64_t size, int width)
+{
+    rt_chan_t *ch;
+    int64_t i;
+
+    if ( size <= 0 || (size & (size - 1)) || width <= 0
+         || width > RT_MAX_VALUES ) {
+        return NULL;
+    }
+    ch = aligned_alloc(RT_CACHE_LINE, sizeof(rt_chan_t));
+    if ( NULL == ch ) {
+        return NULL;
+    }
+    memset(ch, 0, sizeof(rt_chan_t));
+    ch->type = type;
+    ch->width = width;
+    ch->size = size;
+    ch->packets = malloc(sizeof(int64_t) * width * size);
+    if ( NULL == ch->packets ) {
+        free(ch);
+        return NULL;
+    }
+    if ( RT_CHAN_MPMC == type ) {
+        ch->seqs = malloc(sizeof(atomic_int_least64_t) * size);
+        if ( NULL == ch->seqs ) {
+            free(ch->packets);
+            free(ch);
+            return NULL;
+        }
+        for ( i = 0; i < size; i++ ) {
+            atomic_init(&ch->seqs[i], i);
+        }
+    }
+    atomic_init(&ch->tail, 0);
+    atomic_init(&ch->head, 0);
+
+    return ch;
+}
+
+/*
+ * rt_chan_delete -- delete the channel
+ */
+void
+rt_chan_delete(rt_chan_t *ch)
+{
+    free(ch->packets);
+    free(ch->seqs);
+    free(ch);
+}
+
+/*
+ * rt_chan_enqueue -- enqueue up to n packets; return the number of the
+ * packets enqueued, 0 if full
+ */
+int
+rt_chan_enqueue(rt_chan_t *ch, const int64_t *packets, int n)
+{
+    if ( n <= 0 ) {
+        return 0;
+    }
+    if ( RT_CHAN_SPSC == ch->type ) {
+        return _spsc_enqueue(ch, packets, n);
+    }
+
+    return _mpmc_enqueue(ch, packets, n);
+}
+
+/*
+ * rt_chan_dequeue -- dequeue up to n packets; return the number of the
+ * packets dequeued, 0 if empty
+ */
+int
+rt_chan_dequeue(rt_chan_t *ch, int64_t *packets, int n)
+{
+    if ( n <= 0 ) {
+        return 0;
+    }
+    if ( RT_CHAN_SPSC == ch->type ) {
+        return _spsc_dequeue(ch, packets, n);
+    }
+
+    return _mpmc_dequeue(ch, packets, n);
+}
+
+/*
+ * rt_chan_reserve -- return the entry at the tail of the SPSC channel to
+ * write a packet to in place, or NULL if full; rt_chan_commit() enqueues it
+ */
+int64_t *
+rt_chan_reserve(rt_chan_t *ch)
+{
+    int64_t t;
+
+    t = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    if ( t - ch->head_cache >= ch->size ) {
+        ch->head_cache = atomic_load_explicit(&ch->head,
+                                              memory_order_acquire);
+        if ( t - ch->head_cache >= ch->size ) {
+            return NULL;
+        }
+    }
+
+    return ch->packets + ch->width * (t & (ch->size - 1));
+}
+
+/*
+ * rt_chan_commit -- enqueue the packet written to the entry reserved
+ */
+void
+rt_chan_commit(rt_chan_t *ch)
+{
+    int64_t t;
+
+    t = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    atomic_store_explicit(&ch->tail, t + 1, memory_order_release);
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,242 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _RUNTIME_H
+#define _RUNTIME_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+/* Size of a cache line; the data shared by the workers are padded to it */
+#define RT_CACHE_LINE       64
+/* Initial number of the entries of a run queue (a power of 2) */
+#define RT_QUEUE_INIT_SIZE  256
+/* Number of the resumes of a coroutine before it goes back to the queue */
+#define RT_BUDGET           64
+/* Maximum number of the arguments of a coroutine; the frame takes the first
+   of the six argument registers */
+#define RT_MAX_ARGS         5
+/* Maximum number of the values of a packet; the compiler rejects the
+   coroutines of more return values (COMPILER_MAX_PACKET) */
+#define RT_MAX_VALUES       4
+
+/* Words of the frame header (IR_FRAME_STATE and IR_FRAME_PACKET) */
+#define RT_FRAME_STATE      0
+#define RT_FRAME_PACKET     1
+
+/*
+ * Values returned by a coroutine (the two return registers); a yield writes
+ * the values to the packet pointed by the frame instead.  The values narrower
+ * than 64 bits are not extended.
+ */
+typedef struct {
+    int64_t v[2];
+} rt_values_t;
+
+/*
+ * Entry point of a coroutine compiled from IR_FUNC_COROUTINE; the frame
+ * followed by the arguments
+ */
+typedef rt_values_t (*rt_entry_t)(void *, int64_t, int64_t, int64_t, int64_t,
+                                  int64_t);
+
+typedef struct _rt rt_t;
+typedef struct _rt_coro rt_coro_t;
+
+/*
+ * Type of channel
+ */
+typedef enum {
+    RT_CHAN_SPSC,
+    RT_CHAN_MPMC,
+} rt_chan_type_t;
+
+/*
+ * Channel; a bounded ring of the packets of width values each.  The producers
+ * enqueue at the tail, and the consumers dequeue at the head.  The SPSC
+ * channel caches the index of the other side to read its cache line only
+ * when the ring looks full or empty, and the MPMC channel orders the packets
+ * by the sequence number of each entry.
+ */
+typedef struct {
+    rt_chan_type_t type;
+    int width;
+    int64_t size;
+    int64_t *packets;
+    atomic_int_least64_t *seqs;
+    /* Producer side */
+    _Alignas(RT_CACHE_LINE) atomic_int_least64_t tail;
+    int64_t head_cache;
+    /* Consumer side */
+    _Alignas(RT_CACHE_LINE) atomic_int_least64_t head;
+    int64_t tail_cache;
+} rt_chan_t;
+
+/*
+ * Callback for the values yielded (done = 0) or returned (done = 1)
+ */
+typedef void (*rt_sink_t)(rt_coro_t *, const int64_t *, int, void *);
+
+/*
+ * Coroutine handle; the frame (the state, the pointer to the packet, and the
+ * slots, see ir_coro.c) is allocated with the handle.  The packets yielded go
+ * to the channel if any, or to the sink.
+ */
+struct _rt_coro {
+    rt_entry_t entry;
+    int64_t args[RT_MAX_ARGS];
+    /* Number of the values of a packet */
+    int packet;
+    /* Sink of the values and its data */
+    rt_sink_t sink;
+    void *data;
+    /* Channel and the packet not enqueued to it yet */
+    rt_chan_t *chan;
+    int pending;
+    int64_t values[RT_MAX_VALUES];
+    /* Next in the injection queue */
+    rt_coro_t *next;
+    /* Frame; the state is 0 at the start and after the return */
+    int64_t *frame;
+};
+
+/*
+ * Array of a run queue; replaced arrays are kept until the runtime is
+ * deleted as the thieves may still read them
+ */
+typedef struct _rt_array rt_array_t;
+struct _rt_array {
+    int64_t size;
+    rt_array_t *next;
+    _Atomic(rt_coro_t *) coros[];
+};
+
+/*
+ * Run queue (Chase-Lev work-stealing deque); the owner pushes and takes at
+ * the bottom, and the thieves steal from the top
+ */
+typedef struct {
+    _Alignas(RT_CACHE_LINE) atomic_int_least64_t top;
+    _Alignas(RT_CACHE_LINE) atomic_int_least64_t bottom;
+    _Atomic(rt_array_t *) array;
+    rt_array_t *retired;
+} rt_deque_t;
+
+/*
+ * Worker; one for each core
+ */
+typedef struct {
+    _Alignas(RT_CACHE_LINE) rt_t *rt;
+    int id;
+    pthread_t thread;
+    uint64_t seed;
+    rt_deque_t q;
+    /* Statistics */
+    struct {
+        uint64_t resumes;
+        uint64_t steals;
+        uint64_t blocks;
+    } stat;
+} rt_worker_t;
+
+/*
+ * Runtime
+ */
+struct _rt {
+    int nworkers;
+    rt_worker_t *workers;
+    /* Coroutines spawned by non-worker threads */
+    struct {
+        pthread_mutex_t lock;
+        atomic_int n;
+        rt_coro_t *head;
+        rt_coro_t *tail;
+    } inject;
+    /* Number of the coroutines not returned yet */
+    _Alignas(RT_CACHE_LINE) atomic_long live;
+};
+
+/*
+ * Declare the coroutine compiled to the symbol name, and the size of its
+ * frame and the number of the values of its packet exported as name_frame
+ * and name_packet by the assembler
+ */
+#define RT_COROUTINE(name)                      \
+    extern rt_values_t name();                  \
+    extern const int64_t name##_frame;          \
+    extern const int64_t name##_packet
+
+/*
+ * Create a handle of the coroutine declared by RT_COROUTINE()
+ */
+#define RT_CORO_NEW(name, args, nargs)                                  \
+    rt_coro_new((rt_entry_t)name, (size_t)name##_frame,                 \
+                (int)name##_packet, (args), (nargs))
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* sched.c */
+rt_t *
+rt_new(int);
+void
+rt_delete(rt_t *);
+rt_coro_t *
+rt_coro_new(rt_entry_t, size_t, int, const int64_t *, int);
+void
+rt_coro_delete(rt_coro_t *);
+int
+rt_spawn(rt_t *, rt_coro_t *);
+int
+rt_run(rt_t *);
+
+/* chan.c */
+rt_chan_t *
+rt_chan_new(rt_chan_type_t, int64_t, int);
+void
+rt_chan_delete(rt_chan_t *);
+int
+rt_chan_enqueue(rt_chan_t *, const int64_t *, int);
+int
+rt_chan_dequeue(rt_chan_t *, int64_t *, int);
+int64_t *
+rt_chan_reserve(rt_chan_t *);
+void
+rt_chan_commit(rt_chan_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RUNTIME_H */
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
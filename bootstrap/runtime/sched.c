@@ -0,0 +1,546 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "runtime.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <unistd.h>
+
+/* Worker running on the current thread, or NULL */
+static _Thread_local rt_worker_t *_self = NULL;
+
+/*
+ * _array_new -- allocate an array of a run queue
+ */
+static rt_array_t *
+_array_new(int64_t size)
+{
+    rt_array_t *a;
+
+    a = malloc(sizeof(rt_array_t) + sizeof(_Atomic(rt_coro_t *)) * size);
+    if ( NULL == a ) {
+        return NULL;
+    }
+    a->size = size;
+    a->next = NULL;
+
+    return a;
+}
+
+/*
+ * _grow -- double the array of the run queue (by the owner)
+ */
+static rt_array_t *
+_grow(rt_deque_t *q, rt_array_t *a, int64_t t, int64_t b)
+{
+    rt_array_t *na;
+    rt_coro_t *c;
+    int64_t i;
+
+    na = _array_new(a->size << 1);
+    if ( NULL == na ) {
+        return NULL;
+    }
+    for ( i = t; i < b; i++ ) {
+        c = atomic_load_explicit(&a->coros[i & (a->size - 1)],
+                                 memory_order_relaxed);
+        atomic_store_explicit(&na->coros[i & (na->size - 1)], c,
+                              memory_order_relaxed);
+    }
+    atomic_store_explicit(&q->array, na, memory_order_release);
+    a->next = q->retired;
+    q->retired = a;
+
+    return na;
+}
+
+/*
+ * _push -- push a coroutine at the bottom of the run queue (by the owner)
+ */
+static int
+_push(rt_deque_t *q, rt_coro_t *c)
+{
+    rt_array_t *a;
+    int64_t b;
+    int64_t t;
+
+    b = atomic_load_explicit(&q->bottom, memory_order_relaxed);
+    t = atomic_load_explicit(&q->top, memory_order_acquire);
+    a = atomic_load_explicit(&q->array, memory_order_relaxed);
+    if ( b - t > a->size - 1 ) {
+        /* Full */
+        a = _grow(q, a, t, b);
+        if ( NULL == a ) {
+            return -1;
+        }
+    }
+    atomic_store_explicit(&a->coros[b & (a->size - 1)], c,
+                          memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, b + 1, memory_order_release);
+
+    return 0;
+}
+
+/*
+ * _take -- take a coroutine from the bottom of the run queue (by the owner)
+ */
+static rt_coro_t *
+_take(rt_deque_t *q)
+{
+    rt_array_t *a;
+    rt_coro_t *c;
+    int64_t b;
+    int64_t t;
+
+    b = atomic_load_explicit(&q->bottom, memory_order_relaxed) - 1;
+    a = atomic_load_explicit(&q->array, memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    t = atomic_load_explicit(&q->top, memory_order_relaxed);
+    if ( t > b ) {
+        /* Empty */
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+        return NULL;
+    }
+    c = atomic_load_explicit(&a->coros[b & (a->size - 1)],
+                             memory_order_relaxed);
+    if ( t == b ) {
+        /* The last one; race against the thieves */
+        if ( !atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+                                                      memory_order_seq_cst,
+                                                      memory_order_relaxed) ) {
+            c = NULL;
+        }
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    }
+
+    return c;
+}
+
+/*
+ * _steal -- steal a coroutine from the top of the run queue (by a thief)
+ */
+static rt_coro_t *
+_steal(rt_deque_t *q)
+{
+    rt_array_t *a;
+    rt_coro_t *c;
+    int64_t b;
+    int64_t t;
+
+    t = atomic_load_explicit(&q->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    b = atomic_load_explicit(&q->bottom, memory_order_acquire);
+    if ( t >= b ) {
+        /* Empty */
+        return NULL;
+    }
+    a = atomic_load_explicit(&q->array, memory_order_acquire);
+    c = atomic_load_explicit(&a->coros[t & (a->size - 1)],
+                             memory_order_relaxed);
+    if ( !atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+                                                  memory_order_seq_cst,
+                                                  memory_order_relaxed) ) {
+        /* Lost the race */
+        return NULL;
+    }
+
+    return c;
+}
+
+/*
+ * _inject -- put a coroutine to the injection queue
+ */
+static void
+_inject(rt_t *rt, rt_coro_t *c)
+{
+    c->next = NULL;
+    pthread_mutex_lock(&rt->inject.lock);
+    if ( NULL == rt->inject.tail ) {
+        rt->inject.head = c;
+    } else {
+        rt->inject.tail->next = c;
+    }
+    rt->inject.tail = c;
+    atomic_fetch_add_explicit(&rt->inject.n, 1, memory_order_release);
+    pthread_mutex_unlock(&rt->inject.lock);
+}
+
+/*
+ * _uninject -- get a coroutine from the injection queue, or NULL
+ */
+static rt_coro_t *
+_uninject(rt_t *rt)
+{
+    rt_coro_t *c;
+
+    if ( 0 == atomic_load_explicit(&rt->inject.n, memory_order_acquire) ) {
+        return NULL;
+    }
+    pthread_mutex_lock(&rt->inject.lock);
+    c = rt->inject.head;
+    if ( NULL != c ) {
+        rt->inject.head = c->next;
+        if ( NULL == rt->inject.head ) {
+            rt->inject.tail = NULL;
+        }
+        atomic_fetch_sub_explicit(&rt->inject.n, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&rt->inject.lock);
+
+    return c;
+}
+
+/*
+ * _victim -- pick a victim other than the worker itself at random (xorshift)
+ */
+static rt_worker_t *
+_victim(rt_worker_t *w)
+{
+    uint64_t x;
+    int i;
+
+    x = w->seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    w->seed = x;
+    i = x % (w->rt->nworkers - 1);
+    if ( i >= w->id ) {
+        i++;
+    }
+
+    return &w->rt->workers[i];
+}
+
+/*
+ * _find -- find a coroutine to run; the own queue, the injection queue, then
+ * the queues of the others
+ */
+static rt_coro_t *
+_find(rt_worker_t *w)
+{
+    rt_coro_t *c;
+    int i;
+
+    c = _take(&w->q);
+    if ( NULL != c ) {
+        return c;
+    }
+    c = _uninject(w->rt);
+    if ( NULL != c ) {
+        return c;
+    }
+    for ( i = 1; i < w->rt->nworkers; i++ ) {
+        c = _steal(&_victim(w)->q);
+        if ( NULL != c ) {
+            w->stat.steals++;
+            return c;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * _resume -- resume the coroutine until it returns, uses up the budget, or
+ * blocks on the full channel; return 1 if blocked
+ */
+static int
+_resume(rt_worker_t *w, rt_coro_t *c)
+{
+    rt_values_t v;
+    rt_chan_t *ch;
+    int64_t *packet;
+    int i;
+
+    ch = c->chan;
+    for ( i = 0; i < RT_BUDGET; i++ ) {
+        if ( c->pending ) {
+            if ( rt_chan_enqueue(ch, c->values, 1) < 1 ) {
+                goto blocked;
+            }
+            c->pending = 0;
+        }
+        if ( NULL != ch && RT_CHAN_SPSC == ch->type ) {
+            /* The yield writes the packet to the channel in place */
+            packet = rt_chan_reserve(ch);
+            if ( NULL == packet ) {
+                goto blocked;
+            }
+        } else {
+            packet = c->values;
+        }
+        c->frame[RT_FRAME_PACKET] = (intptr_t)packet;
+        v = c->entry(c->frame, c->args[0], c->args[1], c->args[2],
+                     c->args[3], c->args[4]);
+        w->stat.resumes++;
+        if ( 0 == c->frame[RT_FRAME_STATE] ) {
+            /* Returned */
+            if ( NULL != c->sink ) {
+                c->sink(c, v.v, 1, c->data);
+            }
+            rt_coro_delete(c);
+            atomic_fetch_sub_explicit(&w->rt->live, 1, memory_order_release);
+            return 0;
+        }
+        if ( NULL == ch ) {
+            if ( NULL != c->sink ) {
+                c->sink(c, packet, 0, c->data);
+            }
+        } else if ( packet != c->values ) {
+            rt_chan_commit(ch);
+        } else if ( rt_chan_enqueue(ch, packet, 1) < 1 ) {
+            c->pending = 1;
+            goto blocked;
+        }
+    }
+
+    /* Let the others run, or steal it */
+    return _push(&w->q, c);
+
+blocked:
+    /* Behind the others not to spin on the full channel */
+    w->stat.blocks++;
+    _inject(w->rt, c);
+
+    return 1;
+}
+
+/*
+ * _worker -- run the coroutines until all of them return
+ */
+static void *
+_worker(void *arg)
+{
+    rt_worker_t *w;
+    rt_coro_t *c;
+    int ret;
+
+    w = arg;
+    _self = w;
+    while ( atomic_load_explicit(&w->rt->live, memory_order_acquire) > 0 ) {
+        c = _find(w);
+        if ( NULL == c ) {
+            sched_yield();
+            continue;
+        }
+        ret = _resume(w, c);
+        while ( ret < 0 ) {
+            /* Cannot requeue; keep it running on this worker */
+            ret = _resume(w, c);
+        }
+        if ( ret > 0 ) {
+            /* Let the consumers run */
+            sched_yield();
+        }
+    }
+    _self = NULL;
+
+    return NULL;
+}
+
+/*
+ * rt_new -- create a runtime with the workers, one for each core if 0
+ */
+rt_t *
+rt_new(int nworkers)
+{
+    rt_t *rt;
+    rt_array_t *a;
+    int i;
+
+    if ( nworkers <= 0 ) {
+        nworkers = sysconf(_SC_NPROCESSORS_ONLN);
+        if ( nworkers <= 0 ) {
+            nworkers = 1;
+        }
+    }
+    rt = aligned_alloc(RT_CACHE_LINE, sizeof(rt_t));
+    if ( NULL == rt ) {
+        return NULL;
+    }
+    memset(rt, 0, sizeof(rt_t));
+    rt->workers = aligned_alloc(RT_CACHE_LINE,
+                                sizeof(rt_worker_t) * nworkers);
+    if ( NULL == rt->workers ) {
+        free(rt);
+        return NULL;
+    }
+    memset(rt->workers, 0, sizeof(rt_worker_t) * nworkers);
+    rt->nworkers = nworkers;
+    pthread_mutex_init(&rt->inject.lock, NULL);
+    atomic_init(&rt->inject.n, 0);
+    atomic_init(&rt->live, 0);
+    for ( i = 0; i < nworkers; i++ ) {
+        a = _array_new(RT_QUEUE_INIT_SIZE);
+        if ( NULL == a ) {
+            rt_delete(rt);
+            return NULL;
+        }
+        rt->workers[i].rt = rt;
+        rt->workers[i].id = i;
+        rt->workers[i].seed = 0x9e3779b97f4a7c15ULL * (i + 1);
+        atomic_init(&rt->workers[i].q.top, 0);
+        atomic_init(&rt->workers[i].q.bottom, 0);
+        atomic_init(&rt->workers[i].q.array, a);
+    }
+
+    return rt;
+}
+
+/*
+ * rt_delete -- delete the runtime; the coroutines not run are deleted
+ */
+void
+rt_delete(rt_t *rt)
+{
+    rt_array_t *a;
+    rt_coro_t *c;
+    int i;
+
+    for ( i = 0; i < rt->nworkers; i++ ) {
+        a = atomic_load(&rt->workers[i].q.array);
+        if ( NULL == a ) {
+            continue;
+        }
+        while ( NULL != (c = _take(&rt->workers[i].q)) ) {
+            rt_coro_delete(c);
+        }
+        free(a);
+        while ( NULL != (a = rt->workers[i].q.retired) ) {
+            rt->workers[i].q.retired = a->next;
+            free(a);
+        }
+    }
+    while ( NULL != (c = rt->inject.head) ) {
+        rt->inject.head = c->next;
+        rt_coro_delete(c);
+    }
+    pthread_mutex_destroy(&rt->inject.lock);
+    free(rt->workers);
+    free(rt);
+}
+
+/*
+ * rt_coro_new -- create a handle of a coroutine with the entry point, the
+ * size of the frame, the number of the values of a packet, and the arguments
+ */
+rt_coro_t *
+rt_coro_new(rt_entry_t entry, size_t framesize, int packet,
+            const int64_t *args, int nargs)
+{
+    rt_coro_t *c;
+    size_t size;
+
+    if ( nargs < 0 || nargs > RT_MAX_ARGS || packet < 0
+         || packet > RT_MAX_VALUES
+         || framesize < sizeof(int64_t) * (RT_FRAME_PACKET + 1) ) {
+        return NULL;
+    }
+
+    /* The handles of the workers do not share cache lines */
+    size = sizeof(rt_coro_t) + framesize;
+    size = (size + RT_CACHE_LINE - 1) & ~(size_t)(RT_CACHE_LINE - 1);
+    c = aligned_alloc(RT_CACHE_LINE, size);
+    if ( NULL == c ) {
+        return NULL;
+    }
+    memset(c, 0, size);
+    c->entry = entry;
+    c->packet = packet;
+    memcpy(c->args, args, sizeof(int64_t) * nargs);
+    c->frame = (int64_t *)(c + 1);
+
+    return c;
+}
+
+/*
+ * rt_coro_delete -- delete the handle of a coroutine
+ */
+void
+rt_coro_delete(rt_coro_t *c)
+{
+    free(c);
+}
+
+/*
+ * rt_spawn -- schedule a coroutine; the runtime deletes it when it returns.
+ * An SPSC channel takes the packets of one coroutine.
+ */
+int
+rt_spawn(rt_t *rt, rt_coro_t *c)
+{
+    if ( NULL != c->chan && c->chan->width < c->packet ) {
+        /* The packets do not fit */
+        return -1;
+    }
+    atomic_fetch_add_explicit(&rt->live, 1, memory_order_relaxed);
+    if ( NULL != _self && _self->rt == rt ) {
+        /* On the own queue of the worker */
+        if ( _push(&_self->q, c) < 0 ) {
+            atomic_fetch_sub_explicit(&rt->live, 1, memory_order_relaxed);
+            return -1;
+        }
+        return 0;
+    }
+    _inject(rt, c);
+
+    return 0;
+}
+
+/*
+ * rt_run -- run the spawned coroutines on the workers until all of them
+ * return; the calling thread is the first worker
+ */
+int
+rt_run(rt_t *rt)
+{
+    int ret;
+    int i;
+
+    ret = 0;
+    for ( i = 1; i < rt->nworkers; i++ ) {
+        if ( 0 != pthread_create(&rt->workers[i].thread, NULL, _worker,
+                                 &rt->workers[i]) ) {
+            /* Run with the workers started */
+            ret = -1;
+            break;
+        }
+    }
+    _worker(&rt->workers[0]);
+    while ( --i > 0 ) {
+        pthread_join(rt->workers[i].thread, NULL);
+    }
+
+    return ret;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,241 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "symbol.h"
+#include "intern.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * _hash -- compute the bucket index of an (interned) label
+ */
+static __inline__ size_t
+_hash(const compiler_symbol_table_t *t, const char *label)
+{
+    return intern_hash(label) & (t->nbuckets - 1);
+}
+
+/*
+ * _search -- search the bucket of the label
+ */
+static size_t
+_search(const compiler_symbol_table_t *t, const char *label)
+{
+    size_t idx;
+
+    /* Linear probing; the load factor is kept at most 1/2 */
+    idx = _hash(t, label);
+    while ( t->buckets[idx] >= 0 ) {
+        if ( t->symbols[t->buckets[idx]]->label == label ) {
+            break;
+        }
+        idx = (idx + 1) & (t->nbuckets - 1);
+    }
+
+    return idx;
+}
+
+/*
+ * _grow -- double the capacity of the symbol table
+ */
+static int
+_grow(compiler_symbol_table_t *t)
+{
+    compiler_symbol_t **symbols;
+    ssize_t *buckets;
+    ssize_t *obuckets;
+    size_t size;
+    size_t nbuckets;
+    size_t i;
+
+    size = t->size ? t->size * 2 : COMPILER_SYMBOL_TABLE_INIT_SIZE;
+    nbuckets = size * 2;
+
+    symbols = realloc(t->symbols, sizeof(compiler_symbol_t *) * size);
+    if ( symbols == NULL ) {
+        return -1;
+    }
+    t->symbols = symbols;
+
+    buckets = malloc(sizeof(ssize_t) * nbuckets);
+    if ( buckets == NULL ) {
+        return -1;
+    }
+    memset(buckets, 0xff, sizeof(ssize_t) * nbuckets);
+    obuckets = t->buckets;
+    t->buckets = buckets;
+    t->nbuckets = nbuckets;
+    t->size = size;
+
+    /* Rehash */
+    for ( i = 0; i < t->n; i++ ) {
+        t->buckets[_search(t, t->symbols[i]->label)] = i;
+    }
+    free(obuckets);
+
+    return 0;
+}
+
+/*
+ * _part_append -- append a symbol index to a partition
+ */
+static int
+_part_append(compiler_symbol_part_t *p, size_t i)
+{
+    size_t *idx;
+    size_t size;
+
+    if ( p->n >= p->size ) {
+        size = p->size ? p->size * 2 : COMPILER_SYMBOL_TABLE_INIT_SIZE;
+        idx = realloc(p->idx, sizeof(size_t) * size);
+        if ( idx == NULL ) {
+            return -1;
+        }
+        p->idx = idx;
+        p->size = size;
+    }
+    p->idx[p->n] = i;
+    p->n++;
+
+    return 0;
+}
+
+/*
+ * symbol_table_init -- initialize a symbol table
+ */
+compiler_symbol_table_t *
+symbol_table_init(compiler_symbol_table_t *t)
+{
+    if ( t == NULL ) {
+        t = malloc(sizeof(compiler_symbol_table_t));
+        if ( t == NULL ) {
+            return NULL;
+        }
+        memset(t, 0, sizeof(compiler_symbol_table_t));
+        t->_allocated = 1;
+    } else {
+        memset(t, 0, sizeof(compiler_symbol_table_t));
+        t->_allocated = 0;
+    }
+
+    return t;
+}
+
+/*
+ * symbol_table_release -- release a symbol table (the symbols themselves are
+ * not released)
+ */
+void
+symbol_table_release(compiler_symbol_table_t *t)
+{
+    int i;
+
+    for ( i = 0; i <= COMPILER_SYMBOL_EXTERN; i++ ) {
+        free(t->parts[i].idx);
+        t->parts[i].idx = NULL;
+        t->parts[i].n = 0;
+        t->parts[i].size = 0;
+    }
+    free(t->symbols);
+    free(t->buckets);
+    t->symbols = NULL;
+    t->buckets = NULL;
+    t->n = 0;
+    t->size = 0;
+    t->nbuckets = 0;
+
+    if ( t->_allocated ) {
+        free(t);
+    }
+}
+
+/*
+ * symbol_table_add -- add a symbol and return its index, or -1 if the label
+ * already exists or no memory is available
+ */
+ssize_t
+symbol_table_add(compiler_symbol_table_t *t, compiler_symbol_t *s)
+{
+    size_t idx;
+    size_t i;
+
+    if ( t->n >= t->size ) {
+        if ( _grow(t) < 0 ) {
+            return -1;
+        }
+    }
+
+    /* Duplicate check */
+    idx = _search(t, s->label);
+    if ( t->buckets[idx] >= 0 ) {
+        return -1;
+    }
+
+    /* Add to the partition of the type first so that a failure leaves the
+       table unchanged */
+    i = t->n;
+    if ( _part_append(&t->parts[s->type], i) < 0 ) {
+        return -1;
+    }
+    t->symbols[i] = s;
+    t->buckets[idx] = i;
+    t->n++;
+
+    return i;
+}
+
+/*
+ * symbol_table_lookup -- search the index of the symbol of an interned label;
+ * -1 if not found
+ */
+ssize_t
+symbol_table_lookup(const compiler_symbol_table_t *t, const char *label)
+{
+    if ( t->n == 0 ) {
+        return -1;
+    }
+
+    return t->buckets[_search(t, label)];
+}
+
+/*
+ * symbol_table_get -- get the symbol at the specified index
+ */
+compiler_symbol_t *
+symbol_table_get(const compiler_symbol_table_t *t, size_t i)
+{
+    if ( i >= t->n ) {
+        return NULL;
+    }
+
+    return t->symbols[i];
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,134 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _SYMBOL_H
+#define _SYMBOL_H
+
+#include "ir.h"
+#include <stdint.h>
+#include <unistd.h>
+
+/*
+ * Symbol type
+ */
+typedef enum {
+    COMPILER_SYMBOL_CODE,
+    COMPILER_SYMBOL_DATA,
+    COMPILER_SYMBOL_RODATA,
+    COMPILER_SYMBOL_BSS,
+    COMPILER_SYMBOL_EXTERN,
+} compiler_symbol_type_t;
+
+/*
+ * Code symbol
+ */
+typedef struct {
+    size_t n;
+    ir_instr_t *code;
+} compiler_symbol_code_t;
+
+/*
+ * Data/rodata symbol
+ */
+typedef struct {
+    size_t n;
+    uint8_t *data;
+} compiler_symbol_data_t;
+
+/*
+ * BSS symbol
+ */
+typedef struct {
+    size_t n;
+} compiler_symbol_bss_t;
+
+/*
+ * Symbols
+ */
+typedef struct {
+    const char *label;      /* Interned */
+    compiler_symbol_type_t type;
+    union {
+        compiler_symbol_code_t code;
+        compiler_symbol_data_t data;
+        compiler_symbol_data_t rodata;
+        compiler_symbol_bss_t bss;
+    } u;
+} compiler_symbol_t;
+
+/*
+ * Partition of the symbol table (indices of the symbols of a type in the
+ * order of insertion)
+ */
+typedef struct {
+    size_t n;
+    size_t size;
+    size_t *idx;
+} compiler_symbol_part_t;
+
+/*
+ * Symbol table; symbols are stored in the order of insertion and indexed by
+ * their labels with an open-addressing hash table
+ */
+#define COMPILER_SYMBOL_TABLE_INIT_SIZE     16
+typedef struct {
+    size_t n;               /* Number of the symbols */
+    size_t size;            /* Capacity of the symbol array */
+    compiler_symbol_t **symbols;
+    size_t nbuckets;        /* Number of the buckets (power of two) */
+    ssize_t *buckets;       /* Index to the symbol array or -1 */
+    /* Partitions (code, data, rodata, bss, and extern) */
+    compiler_symbol_part_t parts[COMPILER_SYMBOL_EXTERN + 1];
+    int _allocated;
+} compiler_symbol_table_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* symbol.c */
+compiler_symbol_table_t *
+symbol_table_init(compiler_symbol_table_t *);
+void
+symbol_table_release(compiler_symbol_table_t *);
+ssize_t
+symbol_table_add(compiler_symbol_table_t *, compiler_symbol_t *);
+ssize_t
+symbol_table_lookup(const compiler_symbol_table_t *, const char *);
+compiler_symbol_t *
+symbol_table_get(const compiler_symbol_table_t *, size_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYMBOL_H */
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
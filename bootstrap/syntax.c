@@ -22,18 +22,35 @@
  */
 
 #include "syntax.h"
+#include "arena.h"
 #include "y.tab.h"
 #include "lex.yy.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 
 /* Prototype declarations */
+static void *
+_alloc(void *, size_t);
 static literal_t *
 _literal_new(void *scanner);
 static expr_t *
 _expr_new(void *);
 
+/*
+ * _alloc -- allocate memory from the arena of the parser context
+ */
+static void *
+_alloc(void *scanner, size_t size)
+{
+    context_t *context;
+
+    context = yyget_extra(scanner);
+
+    return arena_alloc(context->arena, size);
+}
+
 /*
  * _literal_new -- allocate a new literal
  */
@@ -43,7 +60,7 @@ _literal_new(void *scanner)
     literal_t *lit;
     YYLTYPE *loc;
 
-    lit = malloc(sizeof(literal_t));
+    lit = _alloc(scanner, sizeof(literal_t));
     if ( lit == NULL ) {
         return NULL;
     }
@@ -68,7 +85,7 @@ _expr_new(void *scanner)
     YYLTYPE *loc;
 
     /* Allocate an expression */
-    e = malloc(sizeof(expr_t));
+    e = _alloc(scanner, sizeof(expr_t));
     if ( e == NULL ) {
         return NULL;
     }
@@ -88,7 +105,7 @@ _expr_new(void *scanner)
  * literal_new_int -- allocate an integer literal
  */
 literal_t *
-literal_new_int(void *scanner, const char *v, int type)
+literal_new_int(void *scanner, slice_t v, int type)
 {
     literal_t *lit;
 
@@ -97,11 +114,7 @@ literal_new_int(void *scanner, const char *v, int type)
         return NULL;
     }
     lit->type = type;
-    lit->u.n = strdup(v);
-    if ( lit->u.n == NULL ) {
-        free(lit);
-        return NULL;
-    }
+    lit->u.n = v;
 
     return lit;
 }
@@ -110,7 +123,7 @@ literal_new_int(void *scanner, const char *v, int type)
  * literal_new_float -- allocate a float literal
  */
 literal_t *
-literal_new_float(void *scanner, const char *v)
+literal_new_float(void *scanner, slice_t v)
 {
     literal_t *lit;
 
@@ -119,11 +132,7 @@ literal_new_float(void *scanner, const char *v)
         return NULL;
     }
     lit->type = LIT_FLOAT;
-    lit->u.n = strdup(v);
-    if ( NULL == lit->u.n ) {
-        free(lit);
-        return NULL;
-    }
+    lit->u.n = v;
 
     return lit;
 }
@@ -141,11 +150,7 @@ literal_new_string(void *scanner, const char *v)
         return NULL;
     }
     lit->type = LIT_STRING;
-    lit->u.s = strdup(v);;
-    if ( lit->u.s == NULL ) {
-        free(lit);
-        return NULL;
-    }
+    lit->u.s = v;
 
     return lit;
 }
@@ -185,38 +190,15 @@ literal_new_nil(void *scanner)
     return lit;
 }
 
-/*
- * literal_release -- free a literal
- */
-void
-literal_release(literal_t *lit)
-{
-    switch ( lit->type ) {
-    case LIT_OCTINT:
-    case LIT_DECINT:
-    case LIT_HEXINT:
-    case LIT_FLOAT:
-        free(lit->u.n);
-        break;
-    case LIT_STRING:
-        free(lit->u.s);
-        break;
-    case LIT_BOOL:
-    case LIT_NIL:
-        break;
-    }
-    free(lit);
-}
-
 /*
  * literal_set_new -- allocate a literal set
  */
 literal_set_t *
-literal_set_new(void)
+literal_set_new(void *scanner)
 {
     literal_set_t *set;
 
-    set = malloc(sizeof(literal_set_t));
+    set = _alloc(scanner, sizeof(literal_set_t));
     if ( NULL == set ) {
         return NULL;
     }
@@ -247,11 +229,11 @@ literal_set_add(literal_set_t *set, literal_t *lit)
  * type_new_primitive -- allocate a type
  */
 type_t *
-type_new_primitive(type_type_t tt)
+type_new_primitive(void *scanner, type_type_t tt)
 {
     type_t *t;
 
-    t = malloc(sizeof(type_t));
+    t = _alloc(scanner, sizeof(type_t));
     if ( NULL == t ) {
         return NULL;
     }
@@ -264,20 +246,16 @@ type_new_primitive(type_type_t tt)
  * type_new_struct -- allocate a new struct type
  */
 type_t *
-type_new_struct(const char *id)
+type_new_struct(void *scanner, const char *id)
 {
     type_t *t;
 
-    t = malloc(sizeof(type_t));
+    t = _alloc(scanner, sizeof(type_t));
     if ( NULL == t ) {
         return NULL;
     }
     t->type = TYPE_STRUCT;
-    t->u.id = strdup(id);
-    if ( NULL == t->u.id ) {
-        free(t);
-        return NULL;
-    }
+    t->u.id = id;
 
     return t;
 }
@@ -286,20 +264,16 @@ type_new_struct(const char *id)
  * type_new_union -- allocate a new union type
  */
 type_t *
-type_new_union(const char *id)
+type_new_union(void *scanner, const char *id)
 {
     type_t *t;
 
-    t = malloc(sizeof(type_t));
+    t = _alloc(scanner, sizeof(type_t));
     if ( NULL == t ) {
         return NULL;
     }
     t->type = TYPE_UNION;
-    t->u.id = strdup(id);
-    if ( NULL == t->u.id ) {
-        free(t);
-        return NULL;
-    }
+    t->u.id = id;
 
     return t;
 }
@@ -308,20 +282,16 @@ type_new_union(const char *id)
  * type_new_enum -- allocate a new enum type
  */
 type_t *
-type_new_enum(const char *id)
+type_new_enum(void *scanner, const char *id)
 {
     type_t *t;
 
-    t = malloc(sizeof(type_t));
+    t = _alloc(scanner, sizeof(type_t));
     if ( NULL == t ) {
         return NULL;
     }
     t->type = TYPE_ENUM;
-    t->u.id = strdup(id);
-    if ( NULL == t->u.id ) {
-        free(t);
-        return NULL;
-    }
+    t->u.id = id;
 
     return t;
 }
@@ -330,20 +300,16 @@ type_new_enum(const char *id)
  * type_new_id -- allocate a type
  */
 type_t *
-type_new_id(const char *id)
+type_new_id(void *scanner, const char *id)
 {
     type_t *t;
 
-    t = malloc(sizeof(type_t));
+    t = _alloc(scanner, sizeof(type_t));
     if ( NULL == t ) {
         return NULL;
     }
     t->type = TYPE_ID;
-    t->u.id = strdup(id);
-    if ( NULL == t->u.id ) {
-        free(t);
-        return NULL;
-    }
+    t->u.id = id;
 
     return t;
 }
@@ -352,19 +318,15 @@ type_new_id(const char *id)
  * decl_new -- allocate a declaration
  */
 decl_t *
-decl_new(const char *id, type_t *type)
+decl_new(void *scanner, const char *id, type_t *type)
 {
     decl_t *dcl;
 
-    dcl = malloc(sizeof(decl_t));
+    dcl = _alloc(scanner, sizeof(decl_t));
     if ( NULL == dcl ) {
         return NULL;
     }
-    dcl->id = strdup(id);
-    if ( NULL == dcl->id ) {
-        free(dcl);
-        return NULL;
-    }
+    dcl->id = id;
     dcl->type = type;
     dcl->next = NULL;
 
@@ -375,11 +337,11 @@ decl_new(const char *id, type_t *type)
  * decl_list_new -- alloate a declaration entry
  */
 decl_list_t *
-decl_list_new(decl_t *dcl)
+decl_list_new(void *scanner, decl_t *dcl)
 {
     decl_list_t *list;
 
-    list = malloc(sizeof(decl_list_t));
+    list = _alloc(scanner, sizeof(decl_list_t));
     if ( NULL == list ) {
         return NULL;
     }
@@ -415,7 +377,7 @@ arg_new(void *scanner, decl_t *dcl)
     arg_t *arg;
     YYLTYPE *loc;
 
-    arg = malloc(sizeof(arg_t));
+    arg = _alloc(scanner, sizeof(arg_t));
     if ( NULL == arg ) {
         return NULL;
     }
@@ -435,11 +397,11 @@ arg_new(void *scanner, decl_t *dcl)
  * arg_list_new -- allocate an argument list
  */
 arg_list_t *
-arg_list_new(arg_t *arg)
+arg_list_new(void *scanner, arg_t *arg)
 {
     arg_list_t *list;
 
-    list = malloc(sizeof(arg_list_t));
+    list = _alloc(scanner, sizeof(arg_list_t));
     if ( NULL == list ) {
         return NULL;
     }
@@ -479,20 +441,12 @@ directive_struct_new(void *scanner, const char *id, decl_list_t *list)
     directive_t *dir;
     YYLTYPE *loc;
 
-    dir = malloc(sizeof(directive_t));
+    dir = _alloc(scanner, sizeof(directive_t));
     if ( NULL == dir ) {
         return NULL;
     }
     dir->type = DIRECTIVE_STRUCT;
-    if ( NULL != id ) {
-        dir->u.st.id = strdup(id);
-        if ( NULL == dir->u.st.id ) {
-            free(dir);
-            return NULL;
-        }
-    } else {
-        dir->u.st.id = NULL;
-    }
+    dir->u.st.id = id;
     dir->u.st.list = list;
 
     loc = yyget_lloc(scanner);
@@ -513,20 +467,12 @@ directive_union_new(void *scanner, const char *id, decl_list_t *list)
     directive_t *dir;
     YYLTYPE *loc;
 
-    dir = malloc(sizeof(directive_t));
+    dir = _alloc(scanner, sizeof(directive_t));
     if ( NULL == dir ) {
         return NULL;
     }
     dir->type = DIRECTIVE_UNION;
-    if ( NULL != id ) {
-        dir->u.un.id = strdup(id);
-        if ( NULL == dir->u.un.id ) {
-            free(dir);
-            return NULL;
-        }
-    } else {
-        dir->u.un.id = NULL;
-    }
+    dir->u.un.id = id;
     dir->u.un.list = list;
 
     loc = yyget_lloc(scanner);
@@ -547,16 +493,12 @@ directive_enum_new(void *scanner, const char *id, enum_elem_t *list)
     directive_t *dir;
     YYLTYPE *loc;
 
-    dir = malloc(sizeof(directive_t));
+    dir = _alloc(scanner, sizeof(directive_t));
     if ( NULL == dir ) {
         return NULL;
     }
     dir->type = DIRECTIVE_ENUM;
-    dir->u.en.id = strdup(id);
-    if ( NULL == dir->u.en.id ) {
-        free(dir);
-        return NULL;
-    }
+    dir->u.en.id = id;
     dir->u.en.list = list;
 
     loc = yyget_lloc(scanner);
@@ -577,17 +519,13 @@ directive_typedef_new(void *scanner, type_t *src, const char *dst)
     directive_t *dir;
     YYLTYPE *loc;
 
-    dir = malloc(sizeof(directive_t));
+    dir = _alloc(scanner, sizeof(directive_t));
     if ( NULL == dir ) {
         return NULL;
     }
     dir->type = DIRECTIVE_TYPEDEF;
     dir->u.td.src = src;
-    dir->u.td.dst = strdup(dst);
-    if ( NULL == dir->u.td.dst ) {
-        free(dir);
-        return NULL;
-    }
+    dir->u.td.dst = dst;
 
     loc = yyget_lloc(scanner);
     dir->pos.first_line = loc->first_line;
@@ -607,16 +545,12 @@ directive_use_new(void *scanner, const char *id)
     directive_t *dir;
     YYLTYPE *loc;
 
-    dir = malloc(sizeof(directive_t));
+    dir = _alloc(scanner, sizeof(directive_t));
     if ( NULL == dir ) {
         return NULL;
     }
     dir->type = DIRECTIVE_USE;
-    dir->u.use.id = strdup(id);
-    if ( NULL == dir->u.use.id ) {
-        free(dir);
-        return NULL;
-    }
+    dir->u.use.id = id;
 
     loc = yyget_lloc(scanner);
     dir->pos.first_line = loc->first_line;
@@ -631,19 +565,15 @@ directive_use_new(void *scanner, const char *id)
  * enum_elem_new -- allocate a new enumerate element
  */
 enum_elem_t *
-enum_elem_new(const char *id)
+enum_elem_new(void *scanner, const char *id)
 {
     enum_elem_t *elem;
 
-    elem = malloc(sizeof(enum_elem_t));
+    elem = _alloc(scanner, sizeof(enum_elem_t));
     if ( NULL == elem ) {
         return NULL;
     }
-    elem->id = strdup(id);
-    if ( NULL == elem->id ) {
-        free(elem);
-        return NULL;
-    }
+    elem->id = id;
     elem->next = NULL;
 
     return elem;
@@ -672,11 +602,7 @@ expr_new_id(void *scanner, const char *id)
         return NULL;
     }
     e->type = EXPR_ID;
-    e->u.id = strdup(id);
-    if ( e->u.id == NULL ) {
-        free(e);
-        return NULL;
-    }
+    e->u.id = id;
 
     return e;
 }
@@ -731,11 +657,7 @@ expr_new_member(void *scanner, expr_t *pe, const char *id)
     }
     e->type = EXPR_MEMBER;
     e->u.mem.e = pe;
-    e->u.mem.id = strdup(id);
-    if ( NULL == e->u.mem.id ) {
-        free(e);
-        return NULL;
-    }
+    e->u.mem.id = id;
 
     return e;
 }
@@ -752,18 +674,12 @@ expr_new_call(void *scanner, const char *callee, expr_list_t *exprs)
     if ( e == NULL ) {
         return NULL;
     }
-    e->u.call = malloc(sizeof(call_t));
-    if ( e->u.call ) {
-        free(e);
+    e->u.call = _alloc(scanner, sizeof(call_t));
+    if ( NULL == e->u.call ) {
         return NULL;
     }
     e->type = EXPR_CALL;
-    e->u.call->callee = strdup(callee);
-    if ( e->u.call->callee == NULL ) {
-        free(e);
-        free(e->u.call);
-        return NULL;
-    }
+    e->u.call->callee = callee;
     e->u.call->exprs = exprs;
 
     return e;
@@ -781,9 +697,8 @@ expr_new_ref(void *scanner, expr_t *var, expr_t *expr)
     if ( e == NULL ) {
         return NULL;
     }
-    e->u.ref = malloc(sizeof(ref_t));
-    if ( e->u.call ) {
-        free(e);
+    e->u.ref = _alloc(scanner, sizeof(ref_t));
+    if ( NULL == e->u.ref ) {
         return NULL;
     }
     e->type = EXPR_REF;
@@ -837,11 +752,11 @@ expr_new_if(void *scanner, expr_t *cond, inner_block_t *bif,
  * expr_new_list
  */
 expr_t *
-expr_new_list(expr_list_t *list)
+expr_new_list(void *scanner, expr_list_t *list)
 {
     expr_t *e;
 
-    e = malloc(sizeof(expr_t));
+    e = _alloc(scanner, sizeof(expr_t));
     if ( NULL == e ) {
         return NULL;
     }
@@ -856,11 +771,11 @@ expr_new_list(expr_list_t *list)
  * expr_list_new -- allocate an expression list
  */
 expr_list_t *
-expr_list_new(void)
+expr_list_new(void *scanner)
 {
     expr_list_t *list;
 
-    list = malloc(sizeof(expr_list_t));
+    list = _alloc(scanner, sizeof(expr_list_t));
     if ( NULL == list ) {
         return NULL;
     }
@@ -891,11 +806,11 @@ expr_list_append(expr_list_t *exprs, expr_t *expr)
  * op_new_infix -- allocate an infix operation
  */
 op_t *
-op_new_infix(expr_t *e0, expr_t *e1, op_type_t type)
+op_new_infix(void *scanner, expr_t *e0, expr_t *e1, op_type_t type)
 {
     op_t *op;
 
-    op = malloc(sizeof(op_t));
+    op = _alloc(scanner, sizeof(op_t));
     if ( NULL == op ) {
         return NULL;
     }
@@ -911,11 +826,11 @@ op_new_infix(expr_t *e0, expr_t *e1, op_type_t type)
  * op_new_prefix -- allocate a prefixed operation
  */
 op_t *
-op_new_prefix(expr_t *e0, op_type_t type)
+op_new_prefix(void *scanner, expr_t *e0, op_type_t type)
 {
     op_t *op;
 
-    op = malloc(sizeof(op_t));
+    op = _alloc(scanner, sizeof(op_t));
     if ( NULL == op ) {
         return NULL;
     }
@@ -931,11 +846,11 @@ op_new_prefix(expr_t *e0, op_type_t type)
  * op_new_suffix -- allocate a suffixed operation
  */
 op_t *
-op_new_suffix(expr_t *e0, op_type_t type)
+op_new_suffix(void *scanner, expr_t *e0, op_type_t type)
 {
     op_t *op;
 
-    op = malloc(sizeof(op_t));
+    op = _alloc(scanner, sizeof(op_t));
     if ( NULL == op ) {
         return NULL;
     }
@@ -957,13 +872,12 @@ expr_op_new_infix(void *scanner, expr_t *e0, expr_t *e1, op_type_t type)
     expr_t *e;
     YYLTYPE *loc;
 
-    e = malloc(sizeof(expr_t));
+    e = _alloc(scanner, sizeof(expr_t));
     if ( NULL == e ) {
         return NULL;
     }
-    op = op_new_infix(e0, e1, type);
+    op = op_new_infix(scanner, e0, e1, type);
     if ( NULL == op ) {
-        free(e);
         return NULL;
     }
     e->type = EXPR_OP;
@@ -989,13 +903,12 @@ expr_op_new_prefix(void *scanner, expr_t *e0, op_type_t type)
     expr_t *e;
     YYLTYPE *loc;
 
-    e = malloc(sizeof(expr_t));
+    e = _alloc(scanner, sizeof(expr_t));
     if ( NULL == e ) {
         return NULL;
     }
-    op = op_new_prefix(e0, type);
+    op = op_new_prefix(scanner, e0, type);
     if ( NULL == op ) {
-        free(e);
         return NULL;
     }
     e->type = EXPR_OP;
@@ -1021,13 +934,12 @@ expr_op_new_suffix(void *scanner, expr_t *e0, op_type_t type)
     expr_t *e;
     YYLTYPE *loc;
 
-    e = malloc(sizeof(expr_t));
+    e = _alloc(scanner, sizeof(expr_t));
     if ( NULL == e ) {
         return NULL;
     }
-    op = op_new_suffix(e0, type);
+    op = op_new_suffix(scanner, e0, type);
     if ( NULL == op ) {
-        free(e);
         return NULL;
     }
     e->type = EXPR_OP;
@@ -1047,20 +959,16 @@ expr_op_new_suffix(void *scanner, expr_t *e0, op_type_t type)
  * func_new -- allocate a function
  */
 func_t *
-func_new(const char *id, arg_list_t *args, arg_list_t *rets,
+func_new(void *scanner, const char *id, arg_list_t *args, arg_list_t *rets,
          inner_block_t *block)
 {
     func_t *f;
 
-    f = malloc(sizeof(func_t));
+    f = _alloc(scanner, sizeof(func_t));
     if ( NULL == f ) {
         return NULL;
     }
-    f->id = strdup(id);
-    if ( NULL == f->id ) {
-        free(f);
-        return NULL;
-    }
+    f->id = id;
     f->args = args;
     f->rets = rets;
     f->block = block;
@@ -1072,20 +980,16 @@ func_new(const char *id, arg_list_t *args, arg_list_t *rets,
  * coroutine_new -- allocate a coroutine
  */
 coroutine_t *
-coroutine_new(const char *id, arg_list_t *args, arg_list_t *rets,
-              inner_block_t *block)
+coroutine_new(void *scanner, const char *id, arg_list_t *args,
+              arg_list_t *rets, inner_block_t *block)
 {
     coroutine_t *cr;
 
-    cr = malloc(sizeof(coroutine_t));
+    cr = _alloc(scanner, sizeof(coroutine_t));
     if ( NULL == cr ) {
         return NULL;
     }
-    cr->id = strdup(id);
-    if ( NULL == cr->id ) {
-        free(cr);
-        return NULL;
-    }
+    cr->id = id;
     cr->args = args;
     cr->rets = rets;
     cr->block = block;
@@ -1097,19 +1001,15 @@ coroutine_new(const char *id, arg_list_t *args, arg_list_t *rets,
  * module_new -- allocate a module
  */
 module_t *
-module_new(const char *id, outer_block_t *block)
+module_new(void *scanner, const char *id, outer_block_t *block)
 {
     module_t *m;
 
-    m = malloc(sizeof(module_t));
+    m = _alloc(scanner, sizeof(module_t));
     if ( NULL == m ) {
         return NULL;
     }
-    m->id = strdup(id);
-    if ( NULL == m->id ) {
-        free(m);
-        return NULL;
-    }
+    m->id = id;
     m->block = block;
 
     return m;
@@ -1120,11 +1020,11 @@ module_new(const char *id, outer_block_t *block)
  * type
  */
 outer_block_entry_t *
-outer_block_entry_new(outer_block_entry_type_t type)
+outer_block_entry_new(void *scanner, outer_block_entry_type_t type)
 {
     outer_block_entry_t *block;
 
-    block = malloc(sizeof(outer_block_entry_t));
+    block = _alloc(scanner, sizeof(outer_block_entry_t));
     if ( NULL == block ) {
         return NULL;
     }
@@ -1134,24 +1034,15 @@ outer_block_entry_new(outer_block_entry_type_t type)
     return block;
 }
 
-/*
- * outer_block_entry_delete -- delete the outer block entry
- */
-void
-outer_block_entry_delete(outer_block_entry_t *block)
-{
-    free(block);
-}
-
 /*
  * outer_block_new -- allocate an outer block with the specified entry
  */
 outer_block_t *
-outer_block_new(outer_block_entry_t *ent)
+outer_block_new(void *scanner, outer_block_entry_t *ent)
 {
     outer_block_t *block;
 
-    block = malloc(sizeof(outer_block_t));
+    block = _alloc(scanner, sizeof(outer_block_t));
     if ( NULL == block ) {
         return NULL;
     }
@@ -1165,11 +1056,11 @@ outer_block_new(outer_block_entry_t *ent)
  * inner_block_new -- allocate an inner block with the specified statements
  */
 inner_block_t *
-inner_block_new(stmt_list_t *stmts)
+inner_block_new(void *scanner, stmt_list_t *stmts)
 {
     inner_block_t *block;
 
-    block = malloc(sizeof(inner_block_t));
+    block = _alloc(scanner, sizeof(inner_block_t));
     if ( NULL == block ) {
         return NULL;
     }
@@ -1183,11 +1074,11 @@ inner_block_new(stmt_list_t *stmts)
  * stmt_new_while
  */
 stmt_t *
-stmt_new_while(expr_t *cond, inner_block_t *block)
+stmt_new_while(void *scanner, expr_t *cond, inner_block_t *block)
 {
     stmt_t *stmt;
 
-    stmt = malloc(sizeof(stmt_t));
+    stmt = _alloc(scanner, sizeof(stmt_t));
     if ( NULL == stmt ) {
         return NULL;
     }
@@ -1203,11 +1094,11 @@ stmt_new_while(expr_t *cond, inner_block_t *block)
  * stmt_new_expr -- allocate an expression statement
  */
 stmt_t *
-stmt_new_expr(expr_t *e)
+stmt_new_expr(void *scanner, expr_t *e)
 {
     stmt_t *stmt;
 
-    stmt = malloc(sizeof(stmt_t));
+    stmt = _alloc(scanner, sizeof(stmt_t));
     if ( NULL == stmt ) {
         return NULL;
     }
@@ -1222,11 +1113,11 @@ stmt_new_expr(expr_t *e)
  * stmt_new_expr_list -- allocate an expression list statement
  */
 stmt_t *
-stmt_new_expr_list(expr_list_t *e)
+stmt_new_expr_list(void *scanner, expr_list_t *e)
 {
     stmt_t *stmt;
 
-    stmt = malloc(sizeof(stmt_t));
+    stmt = _alloc(scanner, sizeof(stmt_t));
     if ( NULL == stmt ) {
         return NULL;
     }
@@ -1241,11 +1132,11 @@ stmt_new_expr_list(expr_list_t *e)
  * stmt_new_return -- allocate a return statement
  */
 stmt_t *
-stmt_new_return(expr_t *e)
+stmt_new_return(void *scanner, expr_t *e)
 {
     stmt_t *stmt;
 
-    stmt = malloc(sizeof(stmt_t));
+    stmt = _alloc(scanner, sizeof(stmt_t));
     if ( NULL == stmt ) {
         return NULL;
     }
@@ -1256,15 +1147,34 @@ stmt_new_return(expr_t *e)
     return stmt;
 }
 
+/*
+ * stmt_new_yield -- allocate a yield statement
+ */
+stmt_t *
+stmt_new_yield(void *scanner, expr_t *e)
+{
+    stmt_t *stmt;
+
+    stmt = _alloc(scanner, sizeof(stmt_t));
+    if ( NULL == stmt ) {
+        return NULL;
+    }
+    stmt->type = STMT_YIELD;
+    stmt->u.ret = e;
+    stmt->next = NULL;
+
+    return stmt;
+}
+
 /*
  * stmt_new_block -- allocate a block
  */
 stmt_t *
-stmt_new_block(inner_block_t *block)
+stmt_new_block(void *scanner, inner_block_t *block)
 {
     stmt_t *stmt;
 
-    stmt = malloc(sizeof(stmt_t));
+    stmt = _alloc(scanner, sizeof(stmt_t));
     if ( NULL == stmt ) {
         return NULL;
     }
@@ -1279,11 +1189,11 @@ stmt_new_block(inner_block_t *block)
  * stmt_list_new -- create a new statement list
  */
 stmt_list_t *
-stmt_list_new(stmt_t *stmt)
+stmt_list_new(void *scanner, stmt_t *stmt)
 {
     stmt_list_t *block;
 
-    block = malloc(sizeof(stmt_list_t));
+    block = _alloc(scanner, sizeof(stmt_list_t));
     if ( NULL == block ) {
         return NULL;
     }
@@ -1314,11 +1224,11 @@ stmt_list_append(stmt_list_t *block, stmt_t *stmt)
  * switch_case_new -- allocate a new case block
  */
 switch_case_t *
-switch_case_new(literal_set_t *set, inner_block_t *block)
+switch_case_new(void *scanner, literal_set_t *set, inner_block_t *block)
 {
     switch_case_t *c;
 
-    c = malloc(sizeof(switch_case_t));
+    c = _alloc(scanner, sizeof(switch_case_t));
     if ( NULL == c ) {
         return NULL;
     }
@@ -1333,11 +1243,11 @@ switch_case_new(literal_set_t *set, inner_block_t *block)
  * switch_block_new -- allocate a new switch block
  */
 switch_block_t *
-switch_block_new(void)
+switch_block_new(void *scanner)
 {
     switch_block_t *block;
 
-    block = malloc(sizeof(switch_block_t));
+    block = _alloc(scanner, sizeof(switch_block_t));
     if ( NULL == block ) {
         return NULL;
     }
@@ -1393,19 +1303,43 @@ module_vec_add(module_vec_t *vec, module_t *module)
  * st_new -- allocate a new syntax tree
  */
 st_t *
-st_new(outer_block_t *block)
+st_new(void *scanner, outer_block_t *block)
 {
     st_t *st;
+    context_t *context;
 
-    st = malloc(sizeof(st_t));
+    context = yyget_extra(scanner);
+
+    st = _alloc(scanner, sizeof(st_t));
     if ( NULL == st ) {
         return NULL;
     }
     st->block = block;
+    st->data = NULL;
+    /* The tree takes over the arena and the source text */
+    st->arena = context->arena;
+    st->src = context->src;
 
     return st;
 }
 
+/*
+ * st_release -- release the syntax tree and all the nodes at once
+ */
+void
+st_release(st_t *st)
+{
+    /* Release the source text */
+    if ( st->src.maplen ) {
+        munmap(st->src.buf, st->src.maplen);
+    } else {
+        free(st->src.buf);
+    }
+
+    /* The tree itself is allocated from the arena */
+    arena_release(st->arena);
+}
+
 /*
  * Local variables:
  * tab-width: 4
@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <unistd.h>
+#include "arena.h"
 
 #define VECTOR_INIT_SIZE    32
 #define VECTOR_DELTA        32
@@ -53,6 +54,24 @@ typedef struct {
     off_t last_column;
 } pos_t;
 
+/*
+ * Slice of the source text (not NUL-terminated)
+ */
+typedef struct {
+    const char *s;
+    size_t len;
+} slice_t;
+
+/*
+ * Source text; the buffer is followed by two NUL bytes for the scanner
+ */
+typedef struct {
+    char *buf;
+    size_t len;
+    /* Length of the memory mapping, or 0 if the buffer is malloc'ed */
+    size_t maplen;
+} source_t;
+
 /*
  * Literal types
  */
@@ -81,8 +100,8 @@ typedef struct _literal literal_t;
 struct _literal {
     literal_type_t type;
     union {
-        char *n;
-        char *s;
+        slice_t n;          /* Refers to the source text */
+        const char *s;
         bool_t b;
     } u;
     pos_t pos;
@@ -125,7 +144,7 @@ typedef enum {
 typedef struct {
     type_type_t type;
     union {
-        char *id;
+        const char *id;
     } u;
 } type_t;
 
@@ -134,7 +153,7 @@ typedef struct {
  */
 typedef struct {
     type_t type;
-    char *id;
+    const char *id;
 } type_def_t;
 
 /*
@@ -147,7 +166,7 @@ typedef struct {
  * Declarations
  */
 struct _decl {
-    char *id;
+    const char *id;
     type_t *type;
     decl_t *next;
 };
@@ -164,7 +183,7 @@ typedef struct {
  * Function call
  */
 typedef struct {
-    char *callee;
+    const char *callee;
     expr_list_t *exprs;
 } call_t;
 
@@ -214,7 +233,7 @@ typedef struct {
  * Struct data structure
  */
 typedef struct {
-    char *id;
+    const char *id;
     decl_list_t *list;
 } struct_t;
 
@@ -222,7 +241,7 @@ typedef struct {
  * Union data structure
  */
 typedef struct {
-    char *id;
+    const char *id;
     decl_list_t *list;
 } union_t;
 
@@ -231,7 +250,7 @@ typedef struct {
  */
 typedef struct _enum_elem enum_elem_t;
 struct _enum_elem {
-    char *id;
+    const char *id;
     enum_elem_t *next;
 };
 
@@ -239,7 +258,7 @@ struct _enum_elem {
  * Enumerate
  */
 typedef struct {
-    char *id;
+    const char *id;
     enum_elem_t *list;
 } enum_t;
 
@@ -248,14 +267,14 @@ typedef struct {
  */
 typedef struct {
     type_t *src;
-    char *dst;
+    const char *dst;
 } typedef_t;
 
 /*
  * Function
  */
 typedef struct {
-    char *id;
+    const char *id;
     arg_list_t *args;
     arg_list_t *rets;
     inner_block_t *block;
@@ -265,7 +284,7 @@ typedef struct {
  * Coroutine
  */
 typedef struct {
-    char *id;
+    const char *id;
     arg_list_t *args;
     arg_list_t *rets;
     inner_block_t *block;
@@ -377,7 +396,7 @@ typedef struct {
  */
 typedef struct {
     expr_t *e;
-    char *id;
+    const char *id;
 } member_t;
 
 /*
@@ -386,7 +405,7 @@ typedef struct {
 struct _expr {
     expr_type_t type;
     union {
-        char *id;
+        const char *id;
         decl_t *decl;
         literal_t *lit;
         op_t *op;
@@ -418,6 +437,7 @@ typedef enum {
     STMT_EXPR_LIST,
     STMT_BLOCK,
     STMT_RETURN,
+    STMT_YIELD,
 } stmt_type_t;
 
 /*
@@ -455,7 +475,7 @@ struct _stmt_list {
  * Use
  */
 typedef struct {
-    char *id;
+    const char *id;
 } use_t;
 
 /*
@@ -533,7 +553,7 @@ typedef enum {
  * Module
  */
 struct _module {
-    char *id;
+    const char *id;
     outer_block_t *block;
     module_t *parent;           /* Stack */
 };
@@ -566,6 +586,10 @@ struct _outer_block {
 typedef struct {
     outer_block_t *block;
     void *data;
+    /* Arena holding all the nodes of this tree */
+    arena_t *arena;
+    /* Source text referred to by the slices in the tree */
+    source_t src;
 } st_t;
 
 /*
@@ -621,8 +645,14 @@ typedef struct {
  * Compiler context for lexer and parser
  */
 typedef struct {
+    /* Arena for the syntax tree */
+    arena_t *arena;
+    /* Source text */
+    source_t src;
     /* Lexer string buffer */
     string_t buffer;
+    /* Number of the tokens scanned for the parser */
+    size_t ntokens;
     /* Parser's context */
     st_t *st;
     module_t *cur;
@@ -638,10 +668,13 @@ extern "C" {
 #endif
 
 /* syntax.c */
+/* N.B., identifiers and literal strings passed to the constructors must be
+   interned by intern() so that they can be compared by their pointers, and
+   slices must refer to the source text owned by the tree. */
 literal_t *
-literal_new_int(void *, const char *, int);
+literal_new_int(void *, slice_t, int);
 literal_t *
-literal_new_float(void *, const char *);
+literal_new_float(void *, slice_t);
 literal_t *
 literal_new_string(void *, const char *);
 literal_t *
@@ -649,28 +682,29 @@ literal_new_bool(void *, bool_t);
 literal_t *
 literal_new_nil(void *);
 literal_set_t *
-literal_set_new(void);
+literal_set_new(void *);
 literal_set_t *
 literal_set_add(literal_set_t *, literal_t *);
-type_t *type_new_primitive(type_type_t);
 type_t *
-type_new_struct(const char *);
+type_new_primitive(void *, type_type_t);
+type_t *
+type_new_struct(void *, const char *);
 type_t *
-type_new_union(const char *);
+type_new_union(void *, const char *);
 type_t *
-type_new_enum(const char *);
+type_new_enum(void *, const char *);
 type_t *
-type_new_id(const char *);
+type_new_id(void *, const char *);
 decl_t *
-decl_new(const char *, type_t *);
+decl_new(void *, const char *, type_t *);
 decl_list_t *
-decl_list_new(decl_t *);
+decl_list_new(void *, decl_t *);
 decl_list_t *
 decl_list_append(decl_list_t *, decl_t *);
 arg_t *
 arg_new(void *, decl_t *);
 arg_list_t *
-arg_list_new(arg_t *);
+arg_list_new(void *, arg_t *);
 arg_list_t *
 arg_list_append(arg_list_t *, arg_t *);
 directive_t *
@@ -684,40 +718,45 @@ directive_typedef_new(void *, type_t *, const char *);
 directive_t *
 directive_use_new(void *, const char *);
 enum_elem_t *
-enum_elem_new(const char *);
+enum_elem_new(void *, const char *);
 enum_elem_t *
 enum_elem_prepend(enum_elem_t *, enum_elem_t *);
 func_t *
-func_new(const char *, arg_list_t *, arg_list_t *, inner_block_t *);
+func_new(void *, const char *, arg_list_t *, arg_list_t *,
+         inner_block_t *);
 coroutine_t *
-coroutine_new(const char *, arg_list_t *, arg_list_t *, inner_block_t *);
+coroutine_new(void *, const char *, arg_list_t *, arg_list_t *,
+              inner_block_t *);
 module_t *
-module_new(const char *, outer_block_t *);
-outer_block_entry_t *outer_block_entry_new(outer_block_entry_type_t);
+module_new(void *, const char *, outer_block_t *);
+outer_block_entry_t *
+outer_block_entry_new(void *, outer_block_entry_type_t);
 outer_block_t *
-outer_block_new(outer_block_entry_t *);
+outer_block_new(void *, outer_block_entry_t *);
 inner_block_t *
-inner_block_new(stmt_list_t *);
+inner_block_new(void *, stmt_list_t *);
+stmt_t *
+stmt_new_while(void *, expr_t *, inner_block_t *);
 stmt_t *
-stmt_new_while(expr_t *, inner_block_t *);
+stmt_new_expr(void *, expr_t *);
 stmt_t *
-stmt_new_expr(expr_t *);
+stmt_new_expr_list(void *, expr_list_t *);
 stmt_t *
-stmt_new_expr_list(expr_list_t *);
+stmt_new_return(void *, expr_t *);
 stmt_t *
-stmt_new_return(expr_t *);
+stmt_new_yield(void *, expr_t *);
 stmt_t *
-stmt_new_block(inner_block_t *);
+stmt_new_block(void *, inner_block_t *);
 stmt_list_t *
-stmt_list_new(stmt_t *);
+stmt_list_new(void *, stmt_t *);
 stmt_list_t *
 stmt_list_append(stmt_list_t *, stmt_t *);
 op_t *
-op_new_infix(expr_t *, expr_t *, op_type_t);
+op_new_infix(void *, expr_t *, expr_t *, op_type_t);
 op_t *
-op_new_prefix(expr_t *, op_type_t);
+op_new_prefix(void *, expr_t *, op_type_t);
 op_t *
-op_new_suffix(expr_t *, op_type_t);
+op_new_suffix(void *, expr_t *, op_type_t);
 expr_t *
 expr_new_id(void *, const char *);
 expr_t *
@@ -741,19 +780,21 @@ expr_new_switch(void *, expr_t *, switch_block_t *);
 expr_t *
 expr_new_if(void *, expr_t *, inner_block_t *, inner_block_t *);
 expr_t *
-expr_new_list(expr_list_t *);
+expr_new_list(void *, expr_list_t *);
 expr_list_t *
-expr_list_new(void);
+expr_list_new(void *);
 expr_list_t *
 expr_list_append(expr_list_t *, expr_t *);
 switch_case_t *
-switch_case_new(literal_set_t *, inner_block_t *);
+switch_case_new(void *, literal_set_t *, inner_block_t *);
 switch_block_t *
-switch_block_new(void);
+switch_block_new(void *);
 switch_block_t *
 switch_block_append(switch_block_t *, switch_case_t *);
 st_t *
-st_new(outer_block_t *);
+st_new(void *, outer_block_t *);
+void
+st_release(st_t *);
 
 /* syntax_debug.c */
 int
@@ -51,7 +51,7 @@ _suffix(const char *op, expr_t *e)
     printf(" %s", op);
 }
 
-static char *
+static const char *
 _type(type_t *t)
 {
     switch ( t->type ) {
@@ -296,16 +296,16 @@ _literal(literal_t *lit)
 {
     switch ( lit->type ) {
     case LIT_HEXINT:
-        printf("0x%s", lit->u.n);
+        printf("0x%.*s", (int)lit->u.n.len, lit->u.n.s);
         break;
     case LIT_DECINT:
-        printf("%s", lit->u.n);
+        printf("%.*s", (int)lit->u.n.len, lit->u.n.s);
         break;
     case LIT_OCTINT:
-        printf("0%s", lit->u.n);
+        printf("0%.*s", (int)lit->u.n.len, lit->u.n.s);
         break;
     case LIT_FLOAT:
-        printf("%s", lit->u.n);
+        printf("%.*s", (int)lit->u.n.len, lit->u.n.s);
         break;
     case LIT_STRING:
         printf("%s", lit->u.s);
@@ -392,6 +392,16 @@ _return(expr_t *e)
     printf("\n");
 }
 
+static void
+_yield(expr_t *e)
+{
+    printf("yield ");
+    if ( NULL != e ) {
+        _expr(e);
+    }
+    printf("\n");
+}
+
 static void
 _stmt(stmt_t *stmt)
 {
@@ -411,6 +421,9 @@ _stmt(stmt_t *stmt)
     case STMT_RETURN:
         _return(stmt->u.expr);
         break;
+    case STMT_YIELD:
+        _yield(stmt->u.expr);
+        break;
     }
     printf("\n");
 }
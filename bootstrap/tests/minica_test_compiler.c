@@ -22,12 +22,12 @@
  */
 
 #include "../compile.h"
+#include "../arch.h"
 #include "../minica.h"
+#include "../report.h"
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdint.h>
 #include <string.h>
-#include <inttypes.h>
 
 /*
  * usage -- print usage and exit
@@ -35,414 +35,557 @@
 void
 usage(const char *prog)
 {
-    fprintf(stderr, "Usage: %s <alang-file>\n", prog);
+    fprintf(stderr, "Usage: %s [-j <jobs>] [-o <object-file>] [-ftime-report] "
+            "[-fmem-report] [-freport-json=<file>] <alang-file>\n"
+            "       %s -t\n", prog, prog);
     exit(EXIT_FAILURE);
 }
 
-/* Declarations */
-static void
-_display_literal(literal_t *);
-static void
-_display_val(compiler_env_t *, compiler_val_t *);
-
-static int
-_is_reg(operand_t *op)
+/*
+ * _regtype -- display the register type
+ */
+static const char *
+_regtype(ir_reg_type_t type)
 {
-    if ( OPERAND_VAL == op->type ) {
-        if ( VAL_REG == op->u.val->type ) {
-            return 1;
-        }
+    switch ( type ) {
+    case IR_REG_PTR:
+        return "ptr";
+    case IR_REG_I8:
+        return "i8";
+    case IR_REG_I16:
+        return "i16";
+    case IR_REG_I32:
+        return "i32";
+    case IR_REG_I64:
+        return "i64";
+    case IR_REG_FP32:
+        return "fp32";
+    case IR_REG_FP64:
+        return "fp64";
+    case IR_REG_BOOL:
+        return "bool";
+    case IR_REG_U8:
+        return "u8";
+    case IR_REG_U16:
+        return "u16";
+    case IR_REG_U32:
+        return "u32";
+    case IR_REG_U64:
+        return "u64";
+    default:
+        return "(unknown)";
     }
-    return 0;
 }
 
 /*
- * _display_literal -- display a literal value
+ * _display_env -- display the environment
  */
 static void
-_display_literal(literal_t *lit)
+_display_env(compiler_env_t *env)
 {
-    switch ( lit->type ) {
-    case LIT_HEXINT:
-        printf("0x%s", lit->u.n);
-        break;
-    case LIT_DECINT:
-        printf("%s", lit->u.n);
-        break;
-    case LIT_OCTINT:
-        printf("0%s", lit->u.n);
-        break;
-    case LIT_FLOAT:
-        printf("%s", lit->u.n);
-        break;
-    case LIT_STRING:
-        printf("%s", lit->u.s);
-        break;
-    case LIT_BOOL:
-        printf("%s", lit->u.b == BOOL_TRUE ? "true" : "false");
-        break;
-    case LIT_NIL:
-        printf("nil");
-        break;
+    compiler_var_t *var;
+
+    /* Variables */
+    printf("variables:\n");
+    var = env->vars->top;
+    while ( NULL != var ) {
+        printf("var: %s (%s, arg:%d/ret:%d) -> %%%d\n", var->id,
+               _regtype(var->regtype), var->arg, var->ret, var->reg);
+        var = var->next;
     }
 }
 
 /*
- * _display_val_list -- display a list of values
+ * _display_regs -- display the allocated physical registers
  */
 static void
-_display_val_list(compiler_env_t *env, compiler_val_list_t *list)
+_display_regs(ir_func_t *func, const compiler_regset_t *rs)
 {
-    compiler_val_t *cur;
+    size_t i;
+    int j;
 
-    cur = list->head;
-    while ( cur != NULL ) {
-        _display_val(env, cur);
-        cur = cur->next;
+    printf("registers:\n");
+    for ( i = 0; i < func->reg.n; i++ ) {
+        for ( j = 0; j < rs->n; j++ ) {
+            if ( rs->regs[j] == func->reg.regs[i].hreg ) {
+                printf("reg: %%%zu -> %s\n", i, rs->names[j]);
+                break;
+            }
+        }
     }
 }
 
 /*
- * _display_val -- display a value
+ * _display_code -- display the compiled syntax tree
  */
 static void
-_display_val(compiler_env_t *env, compiler_val_t *val)
+_display_code(compiler_block_t *blocks, const compiler_regset_t *rs)
 {
-    switch ( val->type ) {
-    case VAL_NIL:
-        printf("nil");
-        break;
-    case VAL_VAR:
-        /* Variable */
-        printf("[var]");
-        break;
-    case VAL_LITERAL:
-        _display_literal(val->u.lit);
-        break;
-    case VAL_REG:
-        printf("%%");
-        break;
-    case VAL_REG_SET:
-        printf("(%%,%%)");
-        break;
-    case VAL_LIST:
-        _display_val_list(env, val->u.list);
-        break;
-    case VAL_COND:
-        printf("[cond]");
-        break;
+    compiler_block_t *b;
+
+    b = blocks;
+    while ( NULL != b ) {
+        switch ( b->type ) {
+        case BLOCK_FUNC:
+        case BLOCK_COROUTINE:
+            _display_env(b->env);
+            printf("code:\n");
+            ir_print_func(b->func);
+            if ( rs != NULL ) {
+                _display_regs(b->func, rs);
+            }
+            break;
+        }
+        b = b->next;
     }
 }
 
-static void
-_analyze_operand(compiler_env_t *env, operand_t *operand, compiler_ig_t *ig)
+/*
+ * _export -- assemble the compiled code and export it to an ELF object
+ */
+static int
+_export(compiler_t *c, const char *fname)
 {
-    if ( _is_reg(operand) ) {
+    arch_code_t code;
+    arch_t *arch;
+    report_span_t span;
+    FILE *fp;
+    int ret;
+
+    arch = arch_init(ARCH_CPU_X86_64, ARCH_LD_ELF);
+    if ( arch == NULL ) {
+        return -1;
     }
-    if ( OPERAND_VAL == operand->type ) {
-        if ( operand->u.val->opt.id < 0 ) {
-            operand->u.val->opt.id = ++env->opt.max_var_id;
-        }
-        if ( NULL != ig ) {
-            ig->v.vals[operand->u.val->opt.id] = operand->u.val;
-        }
+    report_begin(&span, REPORT_ASSEMBLE);
+    ret = arch->assemble(c->irobj, &code);
+    report_end(&span);
+    if ( ret < 0 ) {
+        free(arch);
+        return -1;
+    }
+    fp = fopen(fname, "w");
+    if ( fp == NULL ) {
+        arch_code_release(&code);
+        free(arch);
+        return -1;
     }
+    report_begin(&span, REPORT_EXPORT);
+    ret = arch->export(fp, &code);
+    fclose(fp);
+    report_end(&span);
+    arch_code_release(&code);
+    free(arch);
+
+    return ret;
 }
 
-static void
-_analyze_instruction(compiler_env_t *env, compiler_instr_t *instr,
-                     compiler_ig_t *ig)
+/*
+ * _append -- append r = op a,b,c to the block of the function; r is -1 for no
+ * result, and the operands end at the first NULL
+ */
+static int
+_append(ir_func_t *func, int block, ir_opcode_t opcode, int r,
+        const ir_operand_t *a, const ir_operand_t *b, const ir_operand_t *c)
 {
-    switch ( instr->ir.opcode ) {
-    case IR_OPCODE_MOV:
-        _analyze_operand(env, &instr->operands[0], ig);
-        _analyze_operand(env, &instr->operands[1], ig);
-        break;
-    case IR_OPCODE_ADD:
-        _analyze_operand(env, &instr->operands[0], ig);
-        _analyze_operand(env, &instr->operands[1], ig);
-        _analyze_operand(env, &instr->operands[2], ig);
-        break;
-    case IR_OPCODE_SUB:
-        _analyze_operand(env, &instr->operands[0], ig);
-        _analyze_operand(env, &instr->operands[1], ig);
-        _analyze_operand(env, &instr->operands[2], ig);
-        break;
-    case IR_OPCODE_MUL:
-        _analyze_operand(env, &instr->operands[0], ig);
-        _analyze_operand(env, &instr->operands[1], ig);
-        _analyze_operand(env, &instr->operands[2], ig);
-        break;
-    case IR_OPCODE_DIV:
-        _analyze_operand(env, &instr->operands[0], ig);
-        _analyze_operand(env, &instr->operands[1], ig);
-        _analyze_operand(env, &instr->operands[2], ig);
-        break;
-    case IR_OPCODE_INC:
-        _analyze_operand(env, &instr->operands[0], ig);
-        break;
-    case IR_OPCODE_DEC:
-        _analyze_operand(env, &instr->operands[0], ig);
-        break;
-    default:
-        ;
+    const ir_operand_t *args[3];
+    ir_operand_t ops[3];
+    ir_instr_t instr;
+    int i;
+
+    ir_instr_init(&instr, opcode, ops);
+    if ( r >= 0 ) {
+        instr.result.n = 1;
+        instr.result.reg[0] = r;
     }
+    args[0] = a;
+    args[1] = b;
+    args[2] = c;
+    for ( i = 0; i < 3 && args[i] != NULL; i++ ) {
+        ops[instr.noperands++] = *args[i];
+    }
+
+    return ir_block_append(func, block, &instr);
 }
 
 /*
- * _analyze_registers -- analyze registers
+ * _count -- count the instructions of the opcode in the function
  */
-static void
-_analyze_registers(compiler_env_t *env)
+static int
+_count(ir_func_t *func, ir_opcode_t opcode)
 {
-    compiler_instr_t *instr;
+    size_t i;
+    int n;
 
-    /* Count the number of values (registers) */
-    instr = env->code.head;
-    while ( NULL != instr ) {
-        _analyze_instruction(env, instr, NULL);
-        instr = instr->next;
+    n = 0;
+    for ( i = 0; i < func->instr.n; i++ ) {
+        if ( func->instr.instrs[i].block >= 0
+             && func->instr.instrs[i].opcode == opcode ) {
+            n++;
+        }
     }
 
-    printf("max_var_id: %d\n", env->opt.max_var_id);
-
-    /* Build an interference graph */
-    compiler_ig_t ig;
-    ig.v.n = env->opt.max_var_id;
-    ig.v.vals = malloc(sizeof(compiler_val_t *) * ig.v.n);
-    if ( NULL == ig.v.vals ) {
-        return;
-    }
-    /* Register to ID */
-    instr = env->code.head;
-    while ( NULL != instr ) {
-        _analyze_instruction(env, instr, &ig);
-        instr = instr->next;
-    }
+    return n;
 }
 
 /*
- * _display_operand -- display an operand
+ * _first -- get the first instruction of the opcode in the function, or NULL
  */
-static void
-_display_operand(ir_operand_t *op)
+static ir_instr_t *
+_first(ir_func_t *func, ir_opcode_t opcode)
 {
-    switch ( op->type ) {
-    case OPERAND_TYPE_REG:
-        printf("(reg:%d)", op->u.reg.nr);
-        break;
-    case OPERAND_TYPE_REF:
-        printf("(ref)");
-        break;
-    case OPERAND_TYPE_IMM:
-        switch ( op->u.imm.type ) {
-        case IR_IMM_I8:
-            printf("(%" PRIu8 ")", op->u.imm.u.u8);
-            break;
-        case IR_IMM_S8:
-            printf("(%" PRId8 ")", op->u.imm.u.s8);
-            break;
-        case IR_IMM_I16:
-            printf("(%" PRIu16 ")", op->u.imm.u.u16);
-            break;
-        case IR_IMM_S16:
-            printf("(%" PRId16 ")", op->u.imm.u.s16);
-            break;
-        case IR_IMM_I32:
-            printf("(%" PRId32 ")", op->u.imm.u.u32);
-            break;
-        case IR_IMM_S32:
-            printf("(%" PRId32 ")", op->u.imm.u.s32);
-            break;
-        case IR_IMM_I64:
-            printf("(%" PRIu64 ")", op->u.imm.u.u64);
-            break;
-        case IR_IMM_S64:
-            printf("(%" PRId64 ")", op->u.imm.u.s64);
-            break;
+    size_t i;
+
+    for ( i = 0; i < func->instr.n; i++ ) {
+        if ( func->instr.instrs[i].block >= 0
+             && func->instr.instrs[i].opcode == opcode ) {
+            return &func->instr.instrs[i];
         }
-        break;
     }
+
+    return NULL;
 }
 
-#if 0
-static void
-_display_instr(compiler_env_t *env, compiler_instr_t *instr)
+/*
+ * _test_sccp -- fold a constant branch, and a PHI function of the same
+ * constant from the both sides of a branch not folded:
+ *
+ *   b0: %1 = 2; %2 = %1 + 3; %3 = %2 < 10; br %3, b1, b2
+ *   b1: %4 = %0 > 0; br %4, b3, b4
+ *   b2: ret 0
+ *   b3: %5 = 7; jmp b5
+ *   b4: %5 = 7; jmp b5
+ *   b5: %6 = %5 + %2; %7 = %0 + %6; ret %7
+ *
+ * to ret %0 + 12 through the branch of b1
+ */
+static int
+_test_sccp(void)
 {
-    switch ( instr->ir.opcode ) {
-    case IR_OPCODE_MOV:
-        printf("mov");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        break;
-    case IR_OPCODE_ADD:
-        printf("add");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        _display_operand(env, &instr->operands[2]);
-        break;
-    case IR_OPCODE_SUB:
-        printf("sub");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        _display_operand(env, &instr->operands[2]);
-        break;
-    case IR_OPCODE_MUL:
-        printf("mul");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        _display_operand(env, &instr->operands[2]);
-        break;
-    case IR_OPCODE_DIV:
-        printf("div");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        _display_operand(env, &instr->operands[2]);
-        break;
-    case IR_OPCODE_MOD:
-        printf("mod");
-        _display_operand(env, &instr->operands[0]);
-        _display_operand(env, &instr->operands[1]);
-        _display_operand(env, &instr->operands[2]);
-        break;
-    case IR_OPCODE_INC:
-        printf("inc\n");
-        break;
-    case IR_OPCODE_DEC:
-        printf("dec\n");
-        break;
-    default:
-        printf("opcode %d\n", instr->ir.opcode);
+    ir_func_t *func;
+    ir_instr_t *p;
+    ir_operand_t a;
+    ir_operand_t b;
+    ir_operand_t c;
+    int blocks[6];
+    int regs[8];
+    int ret;
+    int i;
+
+    func = ir_func_new();
+    if ( func == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < 6; i++ ) {
+        blocks[i] = ir_func_block_new(func);
+    }
+    for ( i = 0; i < 8; i++ ) {
+        regs[i] = ir_func_reg_new(func, i == 3 || i == 4 ? IR_REG_BOOL
+                                  : IR_REG_I64, i == 5 ? "y" : NULL);
     }
-    printf("\n");
+    func->reg.regs[regs[0]].arg = 0;
+    ret = _append(func, blocks[0], IR_OPCODE_MOV, regs[1],
+                  ir_operand_imm(&a, IR_IMM_I64, 2), NULL, NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_ADD, regs[2],
+                   ir_operand_reg(&a, regs[1]),
+                   ir_operand_imm(&b, IR_IMM_I64, 3), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_CMP_LT, regs[3],
+                   ir_operand_reg(&a, regs[2]),
+                   ir_operand_imm(&b, IR_IMM_I64, 10), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_BR, -1,
+                   ir_operand_reg(&a, regs[3]),
+                   ir_operand_block(&b, blocks[1]),
+                   ir_operand_block(&c, blocks[2])) < 0
+        || _append(func, blocks[1], IR_OPCODE_CMP_GT, regs[4],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 0), NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_BR, -1,
+                   ir_operand_reg(&a, regs[4]),
+                   ir_operand_block(&b, blocks[3]),
+                   ir_operand_block(&c, blocks[4])) < 0
+        || _append(func, blocks[2], IR_OPCODE_RET, -1,
+                   ir_operand_imm(&a, IR_IMM_I64, 0), NULL, NULL) < 0;
+    for ( i = 3; i <= 4; i++ ) {
+        ret = ret
+            || _append(func, blocks[i], IR_OPCODE_MOV, regs[5],
+                       ir_operand_imm(&a, IR_IMM_I64, 7), NULL, NULL) < 0
+            || _append(func, blocks[i], IR_OPCODE_JMP, -1,
+                       ir_operand_block(&a, blocks[5]), NULL, NULL) < 0;
+    }
+    ret = ret
+        || _append(func, blocks[5], IR_OPCODE_ADD, regs[6],
+                   ir_operand_reg(&a, regs[5]), ir_operand_reg(&b, regs[2]),
+                   NULL) < 0
+        || _append(func, blocks[5], IR_OPCODE_ADD, regs[7],
+                   ir_operand_reg(&a, regs[0]), ir_operand_reg(&b, regs[6]),
+                   NULL) < 0
+        || _append(func, blocks[5], IR_OPCODE_RET, -1,
+                   ir_operand_reg(&a, regs[7]), NULL, NULL) < 0
+        || ir_func_to_ssa(func) < 0 || ir_func_sccp(func) < 0;
+    if ( ret ) {
+        ir_func_delete(func);
+        return -1;
+    }
+
+    /* The first branch and b2, the comparisons, and the PHI function are
+       removed, and the sum of the constants is folded */
+    p = _first(func, IR_OPCODE_ADD);
+    printf("sccp: br=%d cmp=%d phi=%d ret=%d add=%d\n",
+           _count(func, IR_OPCODE_BR), _count(func, IR_OPCODE_CMP_LT),
+           _count(func, IR_OPCODE_PHI), _count(func, IR_OPCODE_RET),
+           _count(func, IR_OPCODE_ADD));
+    ret = _count(func, IR_OPCODE_BR) != 1
+        || _count(func, IR_OPCODE_CMP_LT) != 0
+        || _count(func, IR_OPCODE_PHI) != 0
+        || _count(func, IR_OPCODE_RET) != 1
+        || _count(func, IR_OPCODE_ADD) != 1
+        || p->operands[1].type != OPERAND_TYPE_IMM
+        || p->operands[1].u.imm.u.u64 != 12;
+    ir_func_delete(func);
+
+    return ret ? -1 : 0;
 }
-#endif
 
 /*
- * _regtype -- display the register type
+ * _test_dce -- remove the dead computations, the dead copies, and the block
+ * never reached, but not the variable carried by the loop:
+ *
+ *   b0: %1 = %0 + 1; %2 = %0 * %0; %3 = %2; %3 = %0 + 2; %4 = %4; %5 = 0;
+ *       jmp b1
+ *   b1: %5 = %5 + %3; %6 = %5 < %0; br %6, b1, b2
+ *   b2: ret %5
+ *   b3: ret 0
  */
-static const char *
-_regtype(reg_type_t type)
+static int
+_test_dce(void)
 {
-    switch ( type ) {
-    case REG_I8:
-        return "i8";
-    case REG_I16:
-        return "i16";
-    case REG_I32:
-        return "i32";
-    case REG_I64:
-        return "i64";
-    case REG_FP32:
-        return "fp32";
-    case REG_FP64:
-        return "fp64";
-    case REG_BOOL:
-        return "bool";
-    default:
-        return "(unknown)";
+    ir_func_t *func;
+    ir_operand_t a;
+    ir_operand_t b;
+    ir_operand_t c;
+    int blocks[4];
+    int regs[7];
+    int ret;
+    int i;
+
+    func = ir_func_new();
+    if ( func == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < 4; i++ ) {
+        blocks[i] = ir_func_block_new(func);
     }
+    for ( i = 0; i < 7; i++ ) {
+        regs[i] = ir_func_reg_new(func, i == 6 ? IR_REG_BOOL : IR_REG_I64,
+                                  NULL);
+    }
+    func->reg.regs[regs[0]].arg = 0;
+    ret = _append(func, blocks[0], IR_OPCODE_ADD, regs[1],
+                  ir_operand_reg(&a, regs[0]),
+                  ir_operand_imm(&b, IR_IMM_I64, 1), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_MUL, regs[2],
+                   ir_operand_reg(&a, regs[0]), ir_operand_reg(&b, regs[0]),
+                   NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_MOV, regs[3],
+                   ir_operand_reg(&a, regs[2]), NULL, NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_ADD, regs[3],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 2), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_MOV, regs[4],
+                   ir_operand_reg(&a, regs[4]), NULL, NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_MOV, regs[5],
+                   ir_operand_imm(&a, IR_IMM_I64, 0), NULL, NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_JMP, -1,
+                   ir_operand_block(&a, blocks[1]), NULL, NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_ADD, regs[5],
+                   ir_operand_reg(&a, regs[5]), ir_operand_reg(&b, regs[3]),
+                   NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_CMP_LT, regs[6],
+                   ir_operand_reg(&a, regs[5]), ir_operand_reg(&b, regs[0]),
+                   NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_BR, -1,
+                   ir_operand_reg(&a, regs[6]),
+                   ir_operand_block(&b, blocks[1]),
+                   ir_operand_block(&c, blocks[2])) < 0
+        || _append(func, blocks[2], IR_OPCODE_RET, -1,
+                   ir_operand_reg(&a, regs[5]), NULL, NULL) < 0
+        || _append(func, blocks[3], IR_OPCODE_RET, -1,
+                   ir_operand_imm(&a, IR_IMM_I64, 0), NULL, NULL) < 0
+        || ir_func_dce(func) < 0;
+    if ( ret ) {
+        ir_func_delete(func);
+        return -1;
+    }
+
+    /* The first addition and the multiplication, the copy of the product
+       overwritten and the copy to itself, and b3 are removed */
+    printf("dce: copies=%d instrs=%d blocks=%d add=%d mov=%d ret=%d\n",
+           func->dead.copies, func->dead.instrs, func->dead.blocks,
+           _count(func, IR_OPCODE_ADD), _count(func, IR_OPCODE_MOV),
+           _count(func, IR_OPCODE_RET));
+    ret = func->dead.copies != 2 || func->dead.instrs != 2
+        || func->dead.blocks != 1 || _count(func, IR_OPCODE_ADD) != 2
+        || _count(func, IR_OPCODE_MUL) != 0
+        || _count(func, IR_OPCODE_MOV) != 1
+        || _count(func, IR_OPCODE_RET) != 1;
+    ir_func_delete(func);
+
+    return ret ? -1 : 0;
 }
 
 /*
- * _display_env -- display the environment
+ * _test_gvn -- remove the expressions computed in a dominator, including the
+ * commutated ones, but not those computed in a block not dominating:
+ *
+ *   b0: %1 = %0 + 1; %2 = 1 + %0; %3 = %1 * %2; %4 = %0 > 0; br %4, b1, b2
+ *   b1: %5 = %0 + 1; %6 = %5; jmp b3
+ *   b2: %6 = %0 - 1; jmp b3
+ *   b3: %7 = %0 - 1; %8 = %3 + %6; %9 = %8 + %7; ret %9
  */
-static void
-_display_env(compiler_env_t *env)
+static int
+_test_gvn(void)
 {
-    compiler_var_t *var;
-    compiler_instr_t *instr;
+    ir_func_t *func;
+    ir_instr_t *p;
+    ir_operand_t a;
+    ir_operand_t b;
+    ir_operand_t c;
+    int blocks[4];
+    int regs[10];
+    int ret;
+    int i;
 
-    /* Variables */
-    printf("variables:\n");
-    var = env->vars->top;
-    while ( NULL != var ) {
-        printf("var: %s (%s, arg:%d/ret:%d)\n", var->id, _regtype(var->regtype),
-               var->arg, var->ret);
-        var = var->next;
+    func = ir_func_new();
+    if ( func == NULL ) {
+        return -1;
+    }
+    for ( i = 0; i < 4; i++ ) {
+        blocks[i] = ir_func_block_new(func);
+    }
+    for ( i = 0; i < 10; i++ ) {
+        regs[i] = ir_func_reg_new(func, i == 4 ? IR_REG_BOOL : IR_REG_I64,
+                                  i == 6 ? "y" : NULL);
+    }
+    func->reg.regs[regs[0]].arg = 0;
+    ret = _append(func, blocks[0], IR_OPCODE_ADD, regs[1],
+                  ir_operand_reg(&a, regs[0]),
+                  ir_operand_imm(&b, IR_IMM_I64, 1), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_ADD, regs[2],
+                   ir_operand_imm(&a, IR_IMM_I64, 1),
+                   ir_operand_reg(&b, regs[0]), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_MUL, regs[3],
+                   ir_operand_reg(&a, regs[1]), ir_operand_reg(&b, regs[2]),
+                   NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_CMP_GT, regs[4],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 0), NULL) < 0
+        || _append(func, blocks[0], IR_OPCODE_BR, -1,
+                   ir_operand_reg(&a, regs[4]),
+                   ir_operand_block(&b, blocks[1]),
+                   ir_operand_block(&c, blocks[2])) < 0
+        || _append(func, blocks[1], IR_OPCODE_ADD, regs[5],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 1), NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_MOV, regs[6],
+                   ir_operand_reg(&a, regs[5]), NULL, NULL) < 0
+        || _append(func, blocks[1], IR_OPCODE_JMP, -1,
+                   ir_operand_block(&a, blocks[3]), NULL, NULL) < 0
+        || _append(func, blocks[2], IR_OPCODE_SUB, regs[6],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 1), NULL) < 0
+        || _append(func, blocks[2], IR_OPCODE_JMP, -1,
+                   ir_operand_block(&a, blocks[3]), NULL, NULL) < 0
+        || _append(func, blocks[3], IR_OPCODE_SUB, regs[7],
+                   ir_operand_reg(&a, regs[0]),
+                   ir_operand_imm(&b, IR_IMM_I64, 1), NULL) < 0
+        || _append(func, blocks[3], IR_OPCODE_ADD, regs[8],
+                   ir_operand_reg(&a, regs[3]), ir_operand_reg(&b, regs[6]),
+                   NULL) < 0
+        || _append(func, blocks[3], IR_OPCODE_ADD, regs[9],
+                   ir_operand_reg(&a, regs[8]), ir_operand_reg(&b, regs[7]),
+                   NULL) < 0
+        || _append(func, blocks[3], IR_OPCODE_RET, -1,
+                   ir_operand_reg(&a, regs[9]), NULL, NULL) < 0
+        || ir_func_to_ssa(func) < 0 || ir_func_gvn(func) < 0;
+    if ( ret ) {
+        ir_func_delete(func);
+        return -1;
     }
 
-    /* Analyze registers */
-    _analyze_registers(env);
+    /* %2, %5, and the copy are removed, and the product is the square of %1;
+       the subtractions are both kept */
+    p = _first(func, IR_OPCODE_MUL);
+    printf("gvn: add=%d sub=%d mov=%d phi=%d\n", _count(func, IR_OPCODE_ADD),
+           _count(func, IR_OPCODE_SUB), _count(func, IR_OPCODE_MOV),
+           _count(func, IR_OPCODE_PHI));
+    ret = _count(func, IR_OPCODE_ADD) != 3
+        || _count(func, IR_OPCODE_SUB) != 2
+        || _count(func, IR_OPCODE_MOV) != 0
+        || _count(func, IR_OPCODE_PHI) != 1
+        || p->operands[0].type != OPERAND_TYPE_REG
+        || p->operands[1].type != OPERAND_TYPE_REG
+        || p->operands[0].u.reg != p->operands[1].u.reg;
+    ir_func_delete(func);
 
-    /* Code */
-    printf("code:\n");
-    instr = env->code.head;
-    while ( NULL != instr ) {
-        switch ( instr->ir.opcode ) {
-        case IR_OPCODE_MOV:
-            printf("mov");
-            _display_operand(&instr->ir.operands[0]);
-            _display_operand(&instr->ir.operands[1]);
-            printf("\n");
-            break;
-        case IR_OPCODE_ADD:
-            printf("add");
-            _display_operand(&instr->ir.operands[0]);
-            _display_operand(&instr->ir.operands[1]);
-            _display_operand(&instr->ir.operands[2]);
-            printf("\n");
-            break;
-        case IR_OPCODE_SUB:
-            printf("sub");
-            _display_operand(&instr->ir.operands[0]);
-            _display_operand(&instr->ir.operands[1]);
-            _display_operand(&instr->ir.operands[2]);
-            printf("\n");
-            break;
-        case IR_OPCODE_MUL:
-            printf("mul");
-            _display_operand(&instr->ir.operands[0]);
-            _display_operand(&instr->ir.operands[1]);
-            _display_operand(&instr->ir.operands[2]);
-            printf("\n");
-            break;
-        case IR_OPCODE_DIV:
-            printf("div");
-            _display_operand(&instr->ir.operands[0]);
-            _display_operand(&instr->ir.operands[1]);
-            _display_operand(&instr->ir.operands[2]);
-            printf("\n");
-            break;
-        case IR_OPCODE_INC:
-            printf("inc");
-            _display_operand(&instr->ir.operands[0]);
-            printf("\n");
-            break;
-        case IR_OPCODE_DEC:
-            printf("inc");
-            _display_operand(&instr->ir.operands[0]);
-            printf("\n");
-            break;
-        default:
-            printf("opcode %d\n", instr->ir.opcode);
-        }
-        instr = instr->next;
+    return ret ? -1 : 0;
+}
+
+/*
+ * _compiles -- check if the source text compiles
+ */
+static int
+_compiles(const char *src)
+{
+    st_t *st;
+    int ret;
+
+    st = minica_parse_buffer(src, strlen(src));
+    if ( st == NULL ) {
+        return -1;
     }
+    ret = minica_compile(st) != NULL;
+    st_release(st);
+
+    return ret;
 }
 
 /*
- * _display_code -- display the compiled syntax tree
+ * _test_packet -- the return values of a coroutine fit in a packet of the
+ * runtime, and more are rejected by the compiler
  */
-static void
-_display_code(compiler_block_t *blocks)
+static int
+_test_packet(void)
 {
-    compiler_block_t *b;
+    static const char *two =
+        "coroutine f(n: i64) (a: i64, b: i64)\n"
+        "{\n"
+        "    yield n\n"
+        "}\n";
+    static const char *five =
+        "coroutine f(n: i64) (a: i64, b: i64, c: i64, d: i64, e: i64)\n"
+        "{\n"
+        "    yield n\n"
+        "}\n";
 
-    b = blocks;
-    while ( NULL != b ) {
-        switch ( b->type ) {
-        case BLOCK_FUNC:
-            printf("fn %s\n", b->label);
-            _display_env(b->env);
-            break;
-        case BLOCK_COROUTINE:
-            printf("coroutine %s\n", b->label);
-            _display_env(b->env);
-            break;
-        }
-        b = b->next;
+    if ( _compiles(two) != 1 || _compiles(five) != 0 ) {
+        return -1;
     }
+
+    return 0;
+}
+
+/*
+ * _test_passes -- run the tests of the passes on the IR built by hand
+ */
+static int
+_test_passes(void)
+{
+    if ( _test_sccp() < 0 || _test_dce() < 0 || _test_gvn() < 0
+         || _test_packet() < 0 ) {
+        fprintf(stderr, "Wrong output of the passes.\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
 }
 
 /*
@@ -454,20 +597,59 @@ main(int argc, const char *const argv[])
     FILE *fp;
     st_t *code;
     compiler_t *c;
+    const char *out;
+    const char *json;
+    int report;
+    int jobs;
+    int i;
 
-    if ( argc < 2 ) {
+    /* Parse the options */
+    jobs = 1;
+    out = NULL;
+    json = NULL;
+    report = 0;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-j") && i + 1 < argc ) {
+            jobs = atoi(argv[++i]);
+            if ( jobs < 1 ) {
+                usage(argv[0]);
+            }
+        } else if ( 0 == strcmp(argv[i], "-o") && i + 1 < argc ) {
+            out = argv[++i];
+        } else if ( 0 == strcmp(argv[i], "-ftime-report") ) {
+            report |= REPORT_TIME;
+        } else if ( 0 == strcmp(argv[i], "-fmem-report") ) {
+            report |= REPORT_MEM;
+        } else if ( 0 == strncmp(argv[i], "-freport-json=", 14) ) {
+            json = argv[i] + 14;
+        } else if ( 0 == strcmp(argv[i], "-t") && argc == 2 ) {
+            return _test_passes();
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    if ( i >= argc ) {
         fp = stdin;
         /* stdio is not supported. */
         usage(argv[0]);
     } else {
         /* Open the specified file */
-        fp = fopen(argv[1], "r");
+        fp = fopen(argv[i], "r");
         if ( NULL == fp ) {
             perror("fopen");
             exit(EXIT_FAILURE);
         }
     }
 
+    /* Collect both the time and the memory for the JSON report */
+    if ( json != NULL ) {
+        report = REPORT_TIME | REPORT_MEM;
+    }
+    if ( report ) {
+        report_enable(report);
+    }
+
     /* Parse the specified file */
     code = minica_parse(fp);
     if ( code == NULL ) {
@@ -476,7 +658,7 @@ main(int argc, const char *const argv[])
     }
 
     /* Try to compile the code */
-    c = minica_compile(code);
+    c = minica_compile_parallel(code, jobs);
     if ( c == NULL ) {
         fprintf(stderr, "Failed to compile the code.\n");
         return EXIT_FAILURE;
@@ -484,7 +666,27 @@ main(int argc, const char *const argv[])
 
     /* Print out the compiled code */
     printf("Print out the compiled code:\n");
-    _display_code(c->blocks);
+    _display_code(c->blocks, c->regset);
+
+    /* Export the object */
+    if ( out != NULL && _export(c, out) < 0 ) {
+        fprintf(stderr, "Failed to export the object.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Report the phases */
+    if ( report ) {
+        report_print(stderr);
+    }
+    if ( json != NULL ) {
+        fp = fopen(json, "w");
+        if ( NULL == fp ) {
+            perror("fopen");
+            return EXIT_FAILURE;
+        }
+        report_json(fp);
+        fclose(fp);
+    }
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,233 @@
+/*_
+ * Copyright (c) 2021-2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../compile.h"
+#include "../arch.h"
+#include "../minica.h"
+#include "../dfvm/dfvm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ARGS    8
+#define MAX_VALUES  4
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-e <expected>]... <alang-file> <function> "
+            "[<argument>...]\n", prog);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * _ir_func -- find the function of the IR
+ */
+static ir_func_t *
+_ir_func(ir_object_t *obj, const char *name)
+{
+    ir_func_t *func;
+
+    for ( func = obj->funcs; func != NULL; func = func->next ) {
+        if ( 0 == strcmp(func->name, name) ) {
+            return func;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * _print -- print the values
+ */
+static void
+_print(const char *label, const int64_t *vals, int n)
+{
+    int i;
+
+    printf("%s", label);
+    for ( i = 0; i < n; i++ ) {
+        printf("%s%lld", i ? ", " : " ", (long long)vals[i]);
+    }
+    printf("\n");
+}
+
+/*
+ * _resume -- resume the coroutine until it returns; the frame is the first
+ * argument, and a yield writes the values to the packet of the frame
+ */
+static int
+_resume(dfvm_t *vm, dfvm_func_t *f, ir_func_t *func, int64_t *args,
+        int nargs, int64_t *rets)
+{
+    int64_t packet[MAX_VALUES];
+    int64_t *frame;
+    int ret;
+
+    if ( func->frame.size <= 0 || func->frame.packet > MAX_VALUES ) {
+        return -1;
+    }
+    frame = calloc(1, func->frame.size);
+    if ( frame == NULL ) {
+        return -1;
+    }
+    frame[IR_FRAME_PACKET / 8] = (int64_t)(intptr_t)packet;
+    memmove(args + 1, args, sizeof(int64_t) * nargs);
+    args[0] = (int64_t)(intptr_t)frame;
+    for ( ;; ) {
+        ret = dfvm_call(vm, f, args, nargs + 1, rets);
+        if ( ret < 0 || frame[IR_FRAME_STATE / 8] == 0 ) {
+            break;
+        }
+        _print("yield:", packet, func->frame.packet);
+    }
+    free(frame);
+
+    return ret;
+}
+
+/*
+ * Main routine for the data flow virtual machine test
+ */
+int
+main(int argc, const char *const argv[])
+{
+    FILE *fp;
+    st_t *code;
+    compiler_t *c;
+    arch_code_t bc;
+    dfvm_t *vm;
+    dfvm_func_t *f;
+    ir_func_t *func;
+    int64_t args[MAX_ARGS + 1];
+    int64_t rets[DFVM_MAX_RETS];
+    int64_t expected[DFVM_MAX_RETS];
+    const char *file;
+    const char *name;
+    int nexpected;
+    int nargs;
+    int ret;
+    int i;
+    int j;
+
+    /* Parse the options; the expected return values */
+    nexpected = 0;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-e") && i + 1 < argc
+             && nexpected < DFVM_MAX_RETS ) {
+            expected[nexpected++] = strtoll(argv[++i], NULL, 0);
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if ( argc - i < 2 || argc - i - 2 > MAX_ARGS ) {
+        usage(argv[0]);
+    }
+    file = argv[i];
+    name = argv[i + 1];
+    nargs = argc - i - 2;
+    for ( j = 0; j < nargs; j++ ) {
+        args[j] = strtoll(argv[i + 2 + j], NULL, 0);
+    }
+
+    /* Parse the specified file */
+    fp = fopen(file, "r");
+    if ( NULL == fp ) {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    code = minica_parse(fp);
+    if ( code == NULL ) {
+        perror("minica_parse");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Compile the code, and encode it to the bytecode */
+    c = minica_compile_parallel(code, 1);
+    if ( c == NULL ) {
+        fprintf(stderr, "Failed to compile the code.\n");
+        return EXIT_FAILURE;
+    }
+    if ( dfvm_assemble(c->irobj, c->regset, &bc) < 0 ) {
+        fprintf(stderr, "Failed to encode the code.\n");
+        return EXIT_FAILURE;
+    }
+    vm = dfvm_new(&bc);
+    if ( vm == NULL ) {
+        fprintf(stderr, "Failed to load the bytecode.\n");
+        return EXIT_FAILURE;
+    }
+    printf("Loaded %d functions (%zu bytes)\n", vm->nfuncs, bc.text.size);
+
+    /* Call the function */
+    f = dfvm_func(vm, name);
+    func = _ir_func(c->irobj, name);
+    if ( f == NULL || func == NULL ) {
+        fprintf(stderr, "Function not found: %s\n", name);
+        return EXIT_FAILURE;
+    }
+    if ( f->type == DFVM_COROUTINE ) {
+        ret = _resume(vm, f, func, args, nargs, rets);
+    } else {
+        ret = dfvm_call(vm, f, args, nargs, rets);
+    }
+    if ( ret < 0 ) {
+        fprintf(stderr, "Failed to execute the function.\n");
+        return EXIT_FAILURE;
+    }
+    _print("return:", rets, ret);
+    printf("calls: %llu\n", (unsigned long long)f->calls);
+
+    dfvm_delete(vm);
+    arch_code_release(&bc);
+
+    /* Check the return values if expected */
+    if ( nexpected > 0 ) {
+        if ( ret != nexpected ) {
+            ret = -1;
+        }
+        for ( i = 0; ret >= 0 && i < nexpected; i++ ) {
+            if ( rets[i] != expected[i] ) {
+                ret = -1;
+            }
+        }
+        if ( ret < 0 ) {
+            _print("Wrong values; expected:", expected, nexpected);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
@@ -0,0 +1,382 @@
+/*_
+ * Copyright (c) 2021-2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../compile.h"
+#include "../arch.h"
+#include "../minica.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ARGS    6
+#define MAX_VALUES  4
+
+/*
+ * Values returned in rax and rdx
+ */
+typedef struct {
+    int64_t v[2];
+} values_t;
+
+/*
+ * Entry point of the compiled code; the unused arguments are ignored
+ */
+typedef values_t (*entry_t)(int64_t, int64_t, int64_t, int64_t, int64_t,
+                            int64_t);
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-e <expected>]... <alang-file> <function> "
+            "[<argument>...]\n"
+            "       %s -t\n", prog, prog);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * _ir_func -- find the function of the IR
+ */
+static ir_func_t *
+_ir_func(ir_object_t *obj, const char *name)
+{
+    ir_func_t *func;
+
+    for ( func = obj->funcs; func != NULL; func = func->next ) {
+        if ( 0 == strcmp(func->name, name) ) {
+            return func;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * _nrets -- get the number of the return values of the function
+ */
+static int
+_nrets(ir_func_t *func)
+{
+    size_t i;
+    int n;
+
+    n = 0;
+    for ( i = 0; i < func->reg.n; i++ ) {
+        if ( func->reg.regs[i].ret >= n ) {
+            n = func->reg.regs[i].ret + 1;
+        }
+    }
+
+    return n;
+}
+
+/*
+ * _print -- print the values
+ */
+static void
+_print(const char *label, const int64_t *vals, int n)
+{
+    int i;
+
+    printf("%s", label);
+    for ( i = 0; i < n; i++ ) {
+        printf("%s%lld", i ? ", " : " ", (long long)vals[i]);
+    }
+    printf("\n");
+}
+
+/*
+ * _data -- get the 64-bit data object <name><suffix> exported for the
+ * coroutine
+ */
+static int64_t
+_data(arch_jit_t *jit, const char *name, const char *suffix)
+{
+    char buf[256];
+    int64_t *p;
+
+    snprintf(buf, sizeof(buf), "%s%s", name, suffix);
+    p = jit_sym(jit, buf);
+
+    return p != NULL ? *p : -1;
+}
+
+/*
+ * _resume -- resume the coroutine until it returns; the frame is the first
+ * argument, and a yield writes the values to the packet of the frame
+ */
+static int
+_resume(arch_jit_t *jit, const char *name, entry_t entry, int64_t *args,
+        values_t *rets)
+{
+    int64_t packet[MAX_VALUES];
+    int64_t *frame;
+    int64_t size;
+    int64_t n;
+
+    size = _data(jit, name, "_frame");
+    n = _data(jit, name, "_packet");
+    if ( size < IR_FRAME_SLOTS || n < 0 || n > MAX_VALUES ) {
+        return -1;
+    }
+    frame = calloc(1, size);
+    if ( frame == NULL ) {
+        return -1;
+    }
+    frame[IR_FRAME_PACKET / 8] = (int64_t)(intptr_t)packet;
+    memmove(args + 1, args, sizeof(int64_t) * (MAX_ARGS - 1));
+    args[0] = (int64_t)(intptr_t)frame;
+    for ( ;; ) {
+        *rets = entry(args[0], args[1], args[2], args[3], args[4], args[5]);
+        if ( frame[IR_FRAME_STATE / 8] == 0 ) {
+            break;
+        }
+        _print("yield:", packet, n);
+    }
+    free(frame);
+
+    return 0;
+}
+
+/*
+ * _answer -- the external function called by the code of _test_link()
+ */
+static int64_t
+_answer(void)
+{
+    return 42;
+}
+
+/*
+ * _resolver -- resolve the external symbol "answer" only
+ */
+static void *
+_resolver(const char *label)
+{
+    if ( 0 == strcmp(label, "answer") ) {
+        return (void *)(intptr_t)_answer;
+    }
+
+    return NULL;
+}
+
+/*
+ * _test_link -- load the code calling an external function, which is out of
+ * the range of the 32-bit displacement from the text unless mapped nearby,
+ * and the code calling an external function not resolved
+ */
+static int
+_test_link(void)
+{
+    static uint8_t text[] = {
+        0x48, 0x83, 0xec, 0x08,         /* sub $8,%rsp */
+        0xe8, 0x00, 0x00, 0x00, 0x00,   /* call <extern> */
+        0x48, 0x83, 0xc4, 0x08,         /* add $8,%rsp */
+        0xc3,                           /* ret */
+    };
+    arch_sym_t syms[2];
+    arch_rel_t rel;
+    arch_code_t code;
+    arch_jit_t *jit;
+    values_t (*entry)(void);
+    intptr_t disp;
+    int32_t d;
+    int stub;
+    int64_t v;
+
+    memset(&code, 0, sizeof(arch_code_t));
+    memset(syms, 0, sizeof(syms));
+    code.cpu = ARCH_CPU_X86_64;
+    code.text.s = text;
+    code.text.size = sizeof(text);
+    syms[0].type = ARCH_SYM_FUNC;
+    syms[0].label = "entry";
+    syms[0].size = sizeof(text);
+    syms[1].type = ARCH_SYM_EXTERN;
+    syms[1].label = "answer";
+    code.sym.n = 2;
+    code.sym.syms = syms;
+    rel.type = ARCH_REL_BRANCH;
+    rel.pos = 5;
+    rel.sym = 1;
+    code.rel.n = 1;
+    code.rel.rels = &rel;
+
+    /* The branch goes through the stub following the text if far */
+    jit = jit_load(&code, _resolver);
+    if ( jit == NULL ) {
+        return -1;
+    }
+    disp = (uint8_t *)(intptr_t)_answer - (jit->text.s + 9);
+    memcpy(&d, jit->text.s + 5, 4);
+    stub = jit->text.s + 9 + d >= jit->text.s + sizeof(text);
+    entry = (values_t (*)(void))jit_sym(jit, "entry");
+    v = entry != NULL ? entry().v[0] : -1;
+    jit_release(jit);
+    printf("link: extern=%lld stub=%d\n", (long long)v, stub);
+    if ( v != 42 || stub != (disp < INT32_MIN || disp > INT32_MAX) ) {
+        return -1;
+    }
+
+    /* An external symbol not resolved fails the load */
+    syms[1].label = "question";
+    jit = jit_load(&code, _resolver);
+    if ( jit != NULL ) {
+        jit_release(jit);
+        return -1;
+    }
+    jit = jit_load(&code, NULL);
+    if ( jit != NULL ) {
+        jit_release(jit);
+        return -1;
+    }
+    printf("link: unresolved=rejected\n");
+
+    return 0;
+}
+
+/*
+ * Main routine for the JIT test
+ */
+int
+main(int argc, const char *const argv[])
+{
+    FILE *fp;
+    st_t *code;
+    compiler_t *c;
+    arch_code_t obj;
+    arch_jit_t *jit;
+    ir_func_t *func;
+    entry_t entry;
+    int64_t args[MAX_ARGS];
+    int64_t expected[2];
+    values_t rets;
+    const char *file;
+    const char *name;
+    int nexpected;
+    int nrets;
+    int i;
+    int j;
+
+    /* Parse the options; the expected return values */
+    nexpected = 0;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-e") && i + 1 < argc && nexpected < 2 ) {
+            expected[nexpected++] = strtoll(argv[++i], NULL, 0);
+        } else if ( 0 == strcmp(argv[i], "-t") && argc == 2 ) {
+            if ( _test_link() < 0 ) {
+                fprintf(stderr, "Failed to link the code.\n");
+                return EXIT_FAILURE;
+            }
+            return EXIT_SUCCESS;
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if ( argc - i < 2 || argc - i - 2 > MAX_ARGS - 1 ) {
+        usage(argv[0]);
+    }
+    file = argv[i];
+    name = argv[i + 1];
+    memset(args, 0, sizeof(args));
+    for ( j = 0; j < argc - i - 2; j++ ) {
+        args[j] = strtoll(argv[i + 2 + j], NULL, 0);
+    }
+
+    /* Parse the specified file */
+    fp = fopen(file, "r");
+    if ( NULL == fp ) {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    code = minica_parse(fp);
+    if ( code == NULL ) {
+        perror("minica_parse");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Compile the code, and load it to the memory */
+    c = minica_compile_parallel(code, 1);
+    if ( c == NULL ) {
+        fprintf(stderr, "Failed to compile the code.\n");
+        return EXIT_FAILURE;
+    }
+    if ( x86_64_assemble(c->irobj, &obj) < 0 ) {
+        fprintf(stderr, "Failed to assemble the code.\n");
+        return EXIT_FAILURE;
+    }
+    jit = jit_load(&obj, NULL);
+    if ( jit == NULL ) {
+        fprintf(stderr, "Failed to load the code.\n");
+        return EXIT_FAILURE;
+    }
+    printf("Loaded %d symbols (text %zu bytes, data %zu bytes)\n",
+           jit->sym.n, jit->text.size, jit->data.size);
+
+    /* Call the function */
+    entry = (entry_t)jit_sym(jit, name);
+    func = _ir_func(c->irobj, name);
+    if ( entry == NULL || func == NULL ) {
+        fprintf(stderr, "Function not found: %s\n", name);
+        return EXIT_FAILURE;
+    }
+    if ( func->type == IR_FUNC_COROUTINE ) {
+        if ( _resume(jit, name, entry, args, &rets) < 0 ) {
+            fprintf(stderr, "Failed to resume the coroutine.\n");
+            return EXIT_FAILURE;
+        }
+    } else {
+        rets = entry(args[0], args[1], args[2], args[3], args[4], args[5]);
+    }
+    nrets = _nrets(func);
+    _print("return:", rets.v, nrets);
+
+    jit_release(jit);
+    arch_code_release(&obj);
+
+    /* Check the return values if expected */
+    if ( nexpected > 0 ) {
+        for ( i = 0; i < nexpected && nrets == nexpected; i++ ) {
+            if ( rets.v[i] != expected[i] ) {
+                break;
+            }
+        }
+        if ( nrets != nexpected || i < nexpected ) {
+            _print("Wrong values; expected:", expected, nexpected);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
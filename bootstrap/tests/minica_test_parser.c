@@ -45,32 +45,26 @@ usage(const char *prog)
 int
 main(int argc, const char *const argv[])
 {
-    FILE *fp;
     st_t *code;
 
     if ( argc < 2 ) {
-        fp = stdin;
         /* stdio is not supported. */
         usage(argv[0]);
-    } else {
-        /* Open the specified file */
-        fp = fopen(argv[1], "r");
-        if ( NULL == fp ) {
-            perror("fopen");
-            exit(EXIT_FAILURE);
-        }
     }
 
     /* Parse the specified file */
-    code = minica_parse(fp);
+    code = minica_parse_path(argv[1]);
     if ( NULL == code ) {
-        perror("minica_parse");
+        perror("minica_parse_path");
         exit(EXIT_FAILURE);
     }
 
     /* Print out the AST */
     syntax_print_ast(code);
 
+    /* Release the syntax tree */
+    st_release(code);
+
     return EXIT_SUCCESS;
 }
 
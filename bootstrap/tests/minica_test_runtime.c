@@ -0,0 +1,416 @@
+/*_
+ * Copyright (c) 2024 Hirochika Asai <asai@jar.jp>
+ * All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "../runtime/runtime.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#define NCOROS      10000
+#define NFIB        50
+#define NSTREAM     100000
+#define NPRODUCERS  64
+#define NSQUARES    1000
+#define NCONSUMERS  2
+#define NBATCH      16
+
+/* Compiled from examples/coroutine1.al */
+RT_COROUTINE(counter);
+RT_COROUTINE(fib);
+RT_COROUTINE(squares);
+
+/*
+ * Sums of the values yielded and returned by the counters
+ */
+struct sum {
+    rt_t *rt;
+    atomic_long yields;
+    atomic_long rets;
+    atomic_long done;
+};
+
+/*
+ * Consumer of a channel
+ */
+struct consumer {
+    rt_chan_t *ch;
+    /* Number of the packets to dequeue by all the consumers */
+    long total;
+    atomic_long n;
+    /* Sums of the values, or the errors of the order */
+    atomic_long sums[2];
+    long errors;
+};
+
+/*
+ * usage -- print usage and exit
+ */
+void
+usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-j <workers>]\n", prog);
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * _sum -- sum up the values of the counters
+ */
+static void
+_sum(rt_coro_t *c, const int64_t *v, int done, void *data)
+{
+    struct sum *s;
+
+    s = data;
+    if ( done ) {
+        atomic_fetch_add(&s->rets, v[0]);
+        atomic_fetch_add(&s->done, 1);
+    } else {
+        atomic_fetch_add(&s->yields, v[0]);
+    }
+}
+
+/*
+ * _spawn -- spawn the other counters from a worker when the first one
+ * returns, so that the other workers steal them
+ */
+static void
+_spawn(rt_coro_t *c, const int64_t *v, int done, void *data)
+{
+    struct sum *s;
+    rt_coro_t *cc;
+    int64_t n;
+    int i;
+
+    _sum(c, v, done, data);
+    if ( !done ) {
+        return;
+    }
+    s = data;
+    for ( i = 1; i < NCOROS; i++ ) {
+        n = i % 100;
+        cc = RT_CORO_NEW(counter, &n, 1);
+        if ( NULL == cc ) {
+            abort();
+        }
+        cc->sink = _sum;
+        cc->data = s;
+        if ( rt_spawn(s->rt, cc) < 0 ) {
+            abort();
+        }
+    }
+}
+
+/*
+ * _fib -- check the Fibonacci numbers yielded in order
+ */
+static void
+_fib(rt_coro_t *c, const int64_t *v, int done, void *data)
+{
+    int64_t *seq;
+    int64_t t;
+
+    /* The next two numbers, and the number of the errors */
+    seq = data;
+    if ( v[0] != seq[0] ) {
+        seq[2]++;
+    }
+    if ( !done ) {
+        t = seq[0] + seq[1];
+        seq[0] = seq[1];
+        seq[1] = t;
+    }
+}
+
+/*
+ * _stream -- dequeue the packets of a counter from the SPSC channel in order
+ */
+static void *
+_stream(void *arg)
+{
+    struct consumer *cs;
+    int64_t packets[NBATCH];
+    long next;
+    int n;
+    int i;
+
+    cs = arg;
+    next = 0;
+    while ( next < cs->total ) {
+        n = rt_chan_dequeue(cs->ch, packets, NBATCH);
+        if ( n == 0 ) {
+            sched_yield();
+        }
+        for ( i = 0; i < n; i++ ) {
+            if ( packets[i] != next ) {
+                cs->errors++;
+            }
+            next++;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * _drain -- dequeue the packets of the squares from the MPMC channel
+ */
+static void *
+_drain(void *arg)
+{
+    struct consumer *cs;
+    int64_t packets[NBATCH * 2];
+    int n;
+    int i;
+
+    cs = arg;
+    while ( atomic_load(&cs->n) < cs->total ) {
+        n = rt_chan_dequeue(cs->ch, packets, NBATCH);
+        if ( n == 0 ) {
+            sched_yield();
+        }
+        for ( i = 0; i < n; i++ ) {
+            atomic_fetch_add(&cs->sums[0], packets[2 * i]);
+            atomic_fetch_add(&cs->sums[1], packets[2 * i + 1]);
+        }
+        atomic_fetch_add(&cs->n, n);
+    }
+
+    return NULL;
+}
+
+/*
+ * _test_sched -- run the counters spawned by a worker and a Fibonacci
+ * sequence
+ */
+static int
+_test_sched(rt_t *rt)
+{
+    struct sum s;
+    rt_coro_t *c;
+    int64_t seq[3];
+    int64_t yields;
+    int64_t rets;
+    int64_t n;
+    int i;
+
+    /* The first counter spawns the others */
+    s.rt = rt;
+    atomic_init(&s.yields, 0);
+    atomic_init(&s.rets, 0);
+    atomic_init(&s.done, 0);
+    n = 0;
+    c = RT_CORO_NEW(counter, &n, 1);
+    if ( NULL == c ) {
+        return -1;
+    }
+    c->sink = _spawn;
+    c->data = &s;
+    if ( rt_spawn(rt, c) < 0 ) {
+        return -1;
+    }
+
+    /* A Fibonacci sequence */
+    seq[0] = 0;
+    seq[1] = 1;
+    seq[2] = 0;
+    n = NFIB;
+    c = RT_CORO_NEW(fib, &n, 1);
+    if ( NULL == c ) {
+        return -1;
+    }
+    c->sink = _fib;
+    c->data = seq;
+    if ( rt_spawn(rt, c) < 0 || rt_run(rt) < 0 ) {
+        return -1;
+    }
+
+    /* Check the values; counter(n) yields 0 to n - 1 and returns n */
+    yields = 0;
+    rets = 0;
+    for ( i = 0; i < NCOROS; i++ ) {
+        n = i % 100;
+        yields += n * (n - 1) / 2;
+        rets += n;
+    }
+    printf("coroutines=%ld yields=%ld rets=%ld fib-errors=%lld\n",
+           (long)s.done, (long)s.yields, (long)s.rets, (long long)seq[2]);
+    if ( s.done != NCOROS || s.yields != yields || s.rets != rets
+         || seq[2] != 0 ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * _test_spsc -- stream the packets of a counter to a consumer thread
+ */
+static int
+_test_spsc(rt_t *rt)
+{
+    struct consumer cs;
+    pthread_t th;
+    rt_coro_t *c;
+    int64_t n;
+
+    memset(&cs, 0, sizeof(struct consumer));
+    cs.ch = rt_chan_new(RT_CHAN_SPSC, 64, 1);
+    if ( NULL == cs.ch ) {
+        return -1;
+    }
+    cs.total = NSTREAM;
+    n = NSTREAM;
+    c = RT_CORO_NEW(counter, &n, 1);
+    if ( NULL == c ) {
+        return -1;
+    }
+    c->chan = cs.ch;
+    if ( rt_spawn(rt, c) < 0
+         || 0 != pthread_create(&th, NULL, _stream, &cs) ) {
+        return -1;
+    }
+    if ( rt_run(rt) < 0 ) {
+        return -1;
+    }
+    pthread_join(th, NULL);
+    rt_chan_delete(cs.ch);
+
+    printf("spsc: packets=%ld errors=%ld\n", cs.total, cs.errors);
+
+    return cs.errors == 0 ? 0 : -1;
+}
+
+/*
+ * _test_mpmc -- stream the packets of the squares to the consumer threads
+ */
+static int
+_test_mpmc(rt_t *rt)
+{
+    struct consumer cs;
+    pthread_t th[NCONSUMERS];
+    rt_coro_t *c;
+    int64_t sums[2];
+    int64_t n;
+    int i;
+
+    memset(&cs, 0, sizeof(struct consumer));
+    cs.ch = rt_chan_new(RT_CHAN_MPMC, 256, 2);
+    if ( NULL == cs.ch ) {
+        return -1;
+    }
+    cs.total = (long)NPRODUCERS * NSQUARES;
+    for ( i = 0; i < NPRODUCERS; i++ ) {
+        n = NSQUARES;
+        c = RT_CORO_NEW(squares, &n, 1);
+        if ( NULL == c ) {
+            return -1;
+        }
+        c->chan = cs.ch;
+        if ( rt_spawn(rt, c) < 0 ) {
+            return -1;
+        }
+    }
+    for ( i = 0; i < NCONSUMERS; i++ ) {
+        if ( 0 != pthread_create(&th[i], NULL, _drain, &cs) ) {
+            return -1;
+        }
+    }
+    if ( rt_run(rt) < 0 ) {
+        return -1;
+    }
+    for ( i = 0; i < NCONSUMERS; i++ ) {
+        pthread_join(th[i], NULL);
+    }
+    rt_chan_delete(cs.ch);
+
+    sums[0] = 0;
+    sums[1] = 0;
+    for ( n = 0; n < NSQUARES; n++ ) {
+        sums[0] += NPRODUCERS * n;
+        sums[1] += NPRODUCERS * n * n;
+    }
+    printf("mpmc: packets=%ld sum=%ld squares=%ld\n", (long)cs.n,
+           (long)cs.sums[0], (long)cs.sums[1]);
+    if ( cs.sums[0] != sums[0] || cs.sums[1] != sums[1] ) {
+        return -1;
+    }
+
+    return 0;
+}
+
+/*
+ * Main routine for the runtime test
+ */
+int
+main(int argc, const char *const argv[])
+{
+    rt_t *rt;
+    int nworkers;
+    int ret;
+    int i;
+
+    /* Parse the options */
+    nworkers = 0;
+    for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+        if ( 0 == strcmp(argv[i], "-j") && i + 1 < argc ) {
+            nworkers = atoi(argv[++i]);
+            if ( nworkers < 1 ) {
+                usage(argv[0]);
+            }
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if ( i < argc ) {
+        usage(argv[0]);
+    }
+
+    rt = rt_new(nworkers);
+    if ( NULL == rt ) {
+        fprintf(stderr, "Failed to create the runtime.\n");
+        return EXIT_FAILURE;
+    }
+    ret = _test_sched(rt) < 0 || _test_spsc(rt) < 0 || _test_mpmc(rt) < 0;
+    for ( i = 0; i < rt->nworkers; i++ ) {
+        printf("worker %d: resumes=%llu steals=%llu blocks=%llu\n", i,
+               (unsigned long long)rt->workers[i].stat.resumes,
+               (unsigned long long)rt->workers[i].stat.steals,
+               (unsigned long long)rt->workers[i].stat.blocks);
+    }
+    rt_delete(rt);
+    if ( ret ) {
+        fprintf(stderr, "Wrong values.\n");
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
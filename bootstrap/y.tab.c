@@ -0,0 +1,3625 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 25 "minica.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "syntax.h"
+#include "compile.h"
+#include "intern.h"
+#include "y.tab.h"
+#include "lex.yy.h"
+#include "minica.h"
+#include "report.h"
+
+void yyerror(YYLTYPE *, yyscan_t, const char *);
+
+/* Time the scanner called by the parser by sampling */
+#define yylex(lval, lloc, scanner)  _yylex_report(lval, lloc, scanner)
+static int _yylex_report(YYSTYPE *, YYLTYPE *, yyscan_t);
+
+#define ERROR_ON_NULL(val, msg)             \
+    do {                                    \
+        if ( NULL == (val) ) {              \
+            yyerror(&yylloc, scanner, msg); \
+        }                                   \
+    } while ( 0 )
+
+
+#line 102 "y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Use api.header.include to #include this header
+   instead of duplicating it here.  */
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TOK_LIT_FLOAT = 258,           /* TOK_LIT_FLOAT  */
+    TOK_LIT_HEXINT = 259,          /* TOK_LIT_HEXINT  */
+    TOK_LIT_DECINT = 260,          /* TOK_LIT_DECINT  */
+    TOK_LIT_OCTINT = 261,          /* TOK_LIT_OCTINT  */
+    TOK_ID = 262,                  /* TOK_ID  */
+    TOK_LIT_STR = 263,             /* TOK_LIT_STR  */
+    TOK_ADD = 264,                 /* TOK_ADD  */
+    TOK_SUB = 265,                 /* TOK_SUB  */
+    TOK_MUL = 266,                 /* TOK_MUL  */
+    TOK_DIV = 267,                 /* TOK_DIV  */
+    TOK_MOD = 268,                 /* TOK_MOD  */
+    TOK_INC = 269,                 /* TOK_INC  */
+    TOK_DEC = 270,                 /* TOK_DEC  */
+    TOK_DEF = 271,                 /* TOK_DEF  */
+    TOK_LAND = 272,                /* TOK_LAND  */
+    TOK_LOR = 273,                 /* TOK_LOR  */
+    TOK_NOT = 274,                 /* TOK_NOT  */
+    TOK_LPAREN = 275,              /* TOK_LPAREN  */
+    TOK_RPAREN = 276,              /* TOK_RPAREN  */
+    TOK_LBRACE = 277,              /* TOK_LBRACE  */
+    TOK_RBRACE = 278,              /* TOK_RBRACE  */
+    TOK_LBRACKET = 279,            /* TOK_LBRACKET  */
+    TOK_RBRACKET = 280,            /* TOK_RBRACKET  */
+    TOK_LCHEVRON = 281,            /* TOK_LCHEVRON  */
+    TOK_RCHEVRON = 282,            /* TOK_RCHEVRON  */
+    TOK_IF = 283,                  /* TOK_IF  */
+    TOK_ELSE = 284,                /* TOK_ELSE  */
+    TOK_WHILE = 285,               /* TOK_WHILE  */
+    TOK_SWITCH = 286,              /* TOK_SWITCH  */
+    TOK_CASE = 287,                /* TOK_CASE  */
+    TOK_DEFAULT = 288,             /* TOK_DEFAULT  */
+    TOK_EQ_EQ = 289,               /* TOK_EQ_EQ  */
+    TOK_NEQ = 290,                 /* TOK_NEQ  */
+    TOK_LEQ = 291,                 /* TOK_LEQ  */
+    TOK_GEQ = 292,                 /* TOK_GEQ  */
+    TOK_EQ = 293,                  /* TOK_EQ  */
+    TOK_COMMA = 294,               /* TOK_COMMA  */
+    TOK_DOT = 295,                 /* TOK_DOT  */
+    TOK_ATMARK = 296,              /* TOK_ATMARK  */
+    TOK_MODULE = 297,              /* TOK_MODULE  */
+    TOK_USE = 298,                 /* TOK_USE  */
+    TOK_INCLUDE = 299,             /* TOK_INCLUDE  */
+    TOK_FN = 300,                  /* TOK_FN  */
+    TOK_COROUTINE = 301,           /* TOK_COROUTINE  */
+    TOK_RETURN = 302,              /* TOK_RETURN  */
+    TOK_YIELD = 303,               /* TOK_YIELD  */
+    TOK_BIT_OR = 304,              /* TOK_BIT_OR  */
+    TOK_BIT_AND = 305,             /* TOK_BIT_AND  */
+    TOK_BIT_XOR = 306,             /* TOK_BIT_XOR  */
+    TOK_BIT_LSHIFT = 307,          /* TOK_BIT_LSHIFT  */
+    TOK_BIT_RSHIFT = 308,          /* TOK_BIT_RSHIFT  */
+    TOK_BIT_NOT = 309,             /* TOK_BIT_NOT  */
+    TOK_TYPE_I8 = 310,             /* TOK_TYPE_I8  */
+    TOK_TYPE_I16 = 311,            /* TOK_TYPE_I16  */
+    TOK_TYPE_I32 = 312,            /* TOK_TYPE_I32  */
+    TOK_TYPE_I64 = 313,            /* TOK_TYPE_I64  */
+    TOK_TYPE_U8 = 314,             /* TOK_TYPE_U8  */
+    TOK_TYPE_U16 = 315,            /* TOK_TYPE_U16  */
+    TOK_TYPE_U32 = 316,            /* TOK_TYPE_U32  */
+    TOK_TYPE_U64 = 317,            /* TOK_TYPE_U64  */
+    TOK_TYPE = 318,                /* TOK_TYPE  */
+    TOK_TYPEDEF = 319,             /* TOK_TYPEDEF  */
+    TOK_STRUCT = 320,              /* TOK_STRUCT  */
+    TOK_UNION = 321,               /* TOK_UNION  */
+    TOK_ENUM = 322,                /* TOK_ENUM  */
+    TOK_TYPE_FP32 = 323,           /* TOK_TYPE_FP32  */
+    TOK_TYPE_FP64 = 324,           /* TOK_TYPE_FP64  */
+    TOK_TYPE_STRING = 325,         /* TOK_TYPE_STRING  */
+    TOK_TYPE_BOOL = 326,           /* TOK_TYPE_BOOL  */
+    TOK_NIL = 327,                 /* TOK_NIL  */
+    TOK_TRUE = 328,                /* TOK_TRUE  */
+    TOK_FALSE = 329,               /* TOK_FALSE  */
+    TOK_COLON = 330,               /* TOK_COLON  */
+    TOK_SEMICOLON = 331,           /* TOK_SEMICOLON  */
+    SNOP = 332,                    /* SNOP  */
+    UNOP = 333,                    /* UNOP  */
+    ELSENOP = 334,                 /* ELSENOP  */
+    RETNOP = 335                   /* RETNOP  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define TOK_LIT_FLOAT 258
+#define TOK_LIT_HEXINT 259
+#define TOK_LIT_DECINT 260
+#define TOK_LIT_OCTINT 261
+#define TOK_ID 262
+#define TOK_LIT_STR 263
+#define TOK_ADD 264
+#define TOK_SUB 265
+#define TOK_MUL 266
+#define TOK_DIV 267
+#define TOK_MOD 268
+#define TOK_INC 269
+#define TOK_DEC 270
+#define TOK_DEF 271
+#define TOK_LAND 272
+#define TOK_LOR 273
+#define TOK_NOT 274
+#define TOK_LPAREN 275
+#define TOK_RPAREN 276
+#define TOK_LBRACE 277
+#define TOK_RBRACE 278
+#define TOK_LBRACKET 279
+#define TOK_RBRACKET 280
+#define TOK_LCHEVRON 281
+#define TOK_RCHEVRON 282
+#define TOK_IF 283
+#define TOK_ELSE 284
+#define TOK_WHILE 285
+#define TOK_SWITCH 286
+#define TOK_CASE 287
+#define TOK_DEFAULT 288
+#define TOK_EQ_EQ 289
+#define TOK_NEQ 290
+#define TOK_LEQ 291
+#define TOK_GEQ 292
+#define TOK_EQ 293
+#define TOK_COMMA 294
+#define TOK_DOT 295
+#define TOK_ATMARK 296
+#define TOK_MODULE 297
+#define TOK_USE 298
+#define TOK_INCLUDE 299
+#define TOK_FN 300
+#define TOK_COROUTINE 301
+#define TOK_RETURN 302
+#define TOK_YIELD 303
+#define TOK_BIT_OR 304
+#define TOK_BIT_AND 305
+#define TOK_BIT_XOR 306
+#define TOK_BIT_LSHIFT 307
+#define TOK_BIT_RSHIFT 308
+#define TOK_BIT_NOT 309
+#define TOK_TYPE_I8 310
+#define TOK_TYPE_I16 311
+#define TOK_TYPE_I32 312
+#define TOK_TYPE_I64 313
+#define TOK_TYPE_U8 314
+#define TOK_TYPE_U16 315
+#define TOK_TYPE_U32 316
+#define TOK_TYPE_U64 317
+#define TOK_TYPE 318
+#define TOK_TYPEDEF 319
+#define TOK_STRUCT 320
+#define TOK_UNION 321
+#define TOK_ENUM 322
+#define TOK_TYPE_FP32 323
+#define TOK_TYPE_FP64 324
+#define TOK_TYPE_STRING 325
+#define TOK_TYPE_BOOL 326
+#define TOK_NIL 327
+#define TOK_TRUE 328
+#define TOK_FALSE 329
+#define TOK_COLON 330
+#define TOK_SEMICOLON 331
+#define SNOP 332
+#define UNOP 333
+#define ELSENOP 334
+#define RETNOP 335
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 56 "minica.y"
+
+    st_t *file;
+    module_t *module;
+    outer_block_t *oblock;
+    outer_block_entry_t *obent;
+    inner_block_t *iblock;
+    slice_t numval;
+    const char *idval;
+    const char *strval;
+    type_t *type;
+    directive_t *directive;
+    decl_t *decl;
+    decl_list_t *decl_list;
+    expr_list_t *exprs;
+    expr_t *expr;
+    switch_case_t *swcase;
+    switch_block_t *swblock;
+    literal_t *lit;
+    literal_set_t *lset;
+    arg_list_t *args;
+    arg_t *arg;
+    enum_elem_t *enum_elem;
+    coroutine_t *coroutine;
+    func_t *func;
+    stmt_t *stmt;
+    stmt_list_t *stmts;
+
+#line 343 "y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (void *scanner);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_TOK_LIT_FLOAT = 3,              /* TOK_LIT_FLOAT  */
+  YYSYMBOL_TOK_LIT_HEXINT = 4,             /* TOK_LIT_HEXINT  */
+  YYSYMBOL_TOK_LIT_DECINT = 5,             /* TOK_LIT_DECINT  */
+  YYSYMBOL_TOK_LIT_OCTINT = 6,             /* TOK_LIT_OCTINT  */
+  YYSYMBOL_TOK_ID = 7,                     /* TOK_ID  */
+  YYSYMBOL_TOK_LIT_STR = 8,                /* TOK_LIT_STR  */
+  YYSYMBOL_TOK_ADD = 9,                    /* TOK_ADD  */
+  YYSYMBOL_TOK_SUB = 10,                   /* TOK_SUB  */
+  YYSYMBOL_TOK_MUL = 11,                   /* TOK_MUL  */
+  YYSYMBOL_TOK_DIV = 12,                   /* TOK_DIV  */
+  YYSYMBOL_TOK_MOD = 13,                   /* TOK_MOD  */
+  YYSYMBOL_TOK_INC = 14,                   /* TOK_INC  */
+  YYSYMBOL_TOK_DEC = 15,                   /* TOK_DEC  */
+  YYSYMBOL_TOK_DEF = 16,                   /* TOK_DEF  */
+  YYSYMBOL_TOK_LAND = 17,                  /* TOK_LAND  */
+  YYSYMBOL_TOK_LOR = 18,                   /* TOK_LOR  */
+  YYSYMBOL_TOK_NOT = 19,                   /* TOK_NOT  */
+  YYSYMBOL_TOK_LPAREN = 20,                /* TOK_LPAREN  */
+  YYSYMBOL_TOK_RPAREN = 21,                /* TOK_RPAREN  */
+  YYSYMBOL_TOK_LBRACE = 22,                /* TOK_LBRACE  */
+  YYSYMBOL_TOK_RBRACE = 23,                /* TOK_RBRACE  */
+  YYSYMBOL_TOK_LBRACKET = 24,              /* TOK_LBRACKET  */
+  YYSYMBOL_TOK_RBRACKET = 25,              /* TOK_RBRACKET  */
+  YYSYMBOL_TOK_LCHEVRON = 26,              /* TOK_LCHEVRON  */
+  YYSYMBOL_TOK_RCHEVRON = 27,              /* TOK_RCHEVRON  */
+  YYSYMBOL_TOK_IF = 28,                    /* TOK_IF  */
+  YYSYMBOL_TOK_ELSE = 29,                  /* TOK_ELSE  */
+  YYSYMBOL_TOK_WHILE = 30,                 /* TOK_WHILE  */
+  YYSYMBOL_TOK_SWITCH = 31,                /* TOK_SWITCH  */
+  YYSYMBOL_TOK_CASE = 32,                  /* TOK_CASE  */
+  YYSYMBOL_TOK_DEFAULT = 33,               /* TOK_DEFAULT  */
+  YYSYMBOL_TOK_EQ_EQ = 34,                 /* TOK_EQ_EQ  */
+  YYSYMBOL_TOK_NEQ = 35,                   /* TOK_NEQ  */
+  YYSYMBOL_TOK_LEQ = 36,                   /* TOK_LEQ  */
+  YYSYMBOL_TOK_GEQ = 37,                   /* TOK_GEQ  */
+  YYSYMBOL_TOK_EQ = 38,                    /* TOK_EQ  */
+  YYSYMBOL_TOK_COMMA = 39,                 /* TOK_COMMA  */
+  YYSYMBOL_TOK_DOT = 40,                   /* TOK_DOT  */
+  YYSYMBOL_TOK_ATMARK = 41,                /* TOK_ATMARK  */
+  YYSYMBOL_TOK_MODULE = 42,                /* TOK_MODULE  */
+  YYSYMBOL_TOK_USE = 43,                   /* TOK_USE  */
+  YYSYMBOL_TOK_INCLUDE = 44,               /* TOK_INCLUDE  */
+  YYSYMBOL_TOK_FN = 45,                    /* TOK_FN  */
+  YYSYMBOL_TOK_COROUTINE = 46,             /* TOK_COROUTINE  */
+  YYSYMBOL_TOK_RETURN = 47,                /* TOK_RETURN  */
+  YYSYMBOL_TOK_YIELD = 48,                 /* TOK_YIELD  */
+  YYSYMBOL_TOK_BIT_OR = 49,                /* TOK_BIT_OR  */
+  YYSYMBOL_TOK_BIT_AND = 50,               /* TOK_BIT_AND  */
+  YYSYMBOL_TOK_BIT_XOR = 51,               /* TOK_BIT_XOR  */
+  YYSYMBOL_TOK_BIT_LSHIFT = 52,            /* TOK_BIT_LSHIFT  */
+  YYSYMBOL_TOK_BIT_RSHIFT = 53,            /* TOK_BIT_RSHIFT  */
+  YYSYMBOL_TOK_BIT_NOT = 54,               /* TOK_BIT_NOT  */
+  YYSYMBOL_TOK_TYPE_I8 = 55,               /* TOK_TYPE_I8  */
+  YYSYMBOL_TOK_TYPE_I16 = 56,              /* TOK_TYPE_I16  */
+  YYSYMBOL_TOK_TYPE_I32 = 57,              /* TOK_TYPE_I32  */
+  YYSYMBOL_TOK_TYPE_I64 = 58,              /* TOK_TYPE_I64  */
+  YYSYMBOL_TOK_TYPE_U8 = 59,               /* TOK_TYPE_U8  */
+  YYSYMBOL_TOK_TYPE_U16 = 60,              /* TOK_TYPE_U16  */
+  YYSYMBOL_TOK_TYPE_U32 = 61,              /* TOK_TYPE_U32  */
+  YYSYMBOL_TOK_TYPE_U64 = 62,              /* TOK_TYPE_U64  */
+  YYSYMBOL_TOK_TYPE = 63,                  /* TOK_TYPE  */
+  YYSYMBOL_TOK_TYPEDEF = 64,               /* TOK_TYPEDEF  */
+  YYSYMBOL_TOK_STRUCT = 65,                /* TOK_STRUCT  */
+  YYSYMBOL_TOK_UNION = 66,                 /* TOK_UNION  */
+  YYSYMBOL_TOK_ENUM = 67,                  /* TOK_ENUM  */
+  YYSYMBOL_TOK_TYPE_FP32 = 68,             /* TOK_TYPE_FP32  */
+  YYSYMBOL_TOK_TYPE_FP64 = 69,             /* TOK_TYPE_FP64  */
+  YYSYMBOL_TOK_TYPE_STRING = 70,           /* TOK_TYPE_STRING  */
+  YYSYMBOL_TOK_TYPE_BOOL = 71,             /* TOK_TYPE_BOOL  */
+  YYSYMBOL_TOK_NIL = 72,                   /* TOK_NIL  */
+  YYSYMBOL_TOK_TRUE = 73,                  /* TOK_TRUE  */
+  YYSYMBOL_TOK_FALSE = 74,                 /* TOK_FALSE  */
+  YYSYMBOL_TOK_COLON = 75,                 /* TOK_COLON  */
+  YYSYMBOL_TOK_SEMICOLON = 76,             /* TOK_SEMICOLON  */
+  YYSYMBOL_SNOP = 77,                      /* SNOP  */
+  YYSYMBOL_UNOP = 78,                      /* UNOP  */
+  YYSYMBOL_ELSENOP = 79,                   /* ELSENOP  */
+  YYSYMBOL_RETNOP = 80,                    /* RETNOP  */
+  YYSYMBOL_YYACCEPT = 81,                  /* $accept  */
+  YYSYMBOL_start = 82,                     /* start  */
+  YYSYMBOL_file = 83,                      /* file  */
+  YYSYMBOL_outer_block = 84,               /* outer_block  */
+  YYSYMBOL_outer_entry = 85,               /* outer_entry  */
+  YYSYMBOL_directive = 86,                 /* directive  */
+  YYSYMBOL_include = 87,                   /* include  */
+  YYSYMBOL_use = 88,                       /* use  */
+  YYSYMBOL_typedef = 89,                   /* typedef  */
+  YYSYMBOL_struct_def = 90,                /* struct_def  */
+  YYSYMBOL_union_def = 91,                 /* union_def  */
+  YYSYMBOL_decl_list = 92,                 /* decl_list  */
+  YYSYMBOL_enum_def = 93,                  /* enum_def  */
+  YYSYMBOL_enum_list = 94,                 /* enum_list  */
+  YYSYMBOL_enum_elem = 95,                 /* enum_elem  */
+  YYSYMBOL_module = 96,                    /* module  */
+  YYSYMBOL_crdef = 97,                     /* crdef  */
+  YYSYMBOL_fndef = 98,                     /* fndef  */
+  YYSYMBOL_funcargs = 99,                  /* funcargs  */
+  YYSYMBOL_retvals = 100,                  /* retvals  */
+  YYSYMBOL_args = 101,                     /* args  */
+  YYSYMBOL_arg = 102,                      /* arg  */
+  YYSYMBOL_suite = 103,                    /* suite  */
+  YYSYMBOL_inner_block = 104,              /* inner_block  */
+  YYSYMBOL_statements = 105,               /* statements  */
+  YYSYMBOL_statement = 106,                /* statement  */
+  YYSYMBOL_stmt_while = 107,               /* stmt_while  */
+  YYSYMBOL_stmt_expr_list = 108,           /* stmt_expr_list  */
+  YYSYMBOL_stmt_return = 109,              /* stmt_return  */
+  YYSYMBOL_stmt_yield = 110,               /* stmt_yield  */
+  YYSYMBOL_expr_list = 111,                /* expr_list  */
+  YYSYMBOL_expression = 112,               /* expression  */
+  YYSYMBOL_control_expr = 113,             /* control_expr  */
+  YYSYMBOL_if_expr = 114,                  /* if_expr  */
+  YYSYMBOL_else_block = 115,               /* else_block  */
+  YYSYMBOL_switch_expr = 116,              /* switch_expr  */
+  YYSYMBOL_switch_block = 117,             /* switch_block  */
+  YYSYMBOL_switch_case = 118,              /* switch_case  */
+  YYSYMBOL_assign_expr = 119,              /* assign_expr  */
+  YYSYMBOL_or_test = 120,                  /* or_test  */
+  YYSYMBOL_and_test = 121,                 /* and_test  */
+  YYSYMBOL_or_expr = 122,                  /* or_expr  */
+  YYSYMBOL_xor_expr = 123,                 /* xor_expr  */
+  YYSYMBOL_and_expr = 124,                 /* and_expr  */
+  YYSYMBOL_comparison_eq = 125,            /* comparison_eq  */
+  YYSYMBOL_comparison = 126,               /* comparison  */
+  YYSYMBOL_shift_expr = 127,               /* shift_expr  */
+  YYSYMBOL_a_expr = 128,                   /* a_expr  */
+  YYSYMBOL_m_expr = 129,                   /* m_expr  */
+  YYSYMBOL_u_expr = 130,                   /* u_expr  */
+  YYSYMBOL_p_expr = 131,                   /* p_expr  */
+  YYSYMBOL_primary = 132,                  /* primary  */
+  YYSYMBOL_atom = 133,                     /* atom  */
+  YYSYMBOL_declaration = 134,              /* declaration  */
+  YYSYMBOL_identifier = 135,               /* identifier  */
+  YYSYMBOL_type = 136,                     /* type  */
+  YYSYMBOL_primitive_type = 137,           /* primitive_type  */
+  YYSYMBOL_literal_set = 138,              /* literal_set  */
+  YYSYMBOL_literal = 139                   /* literal  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  55
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   443
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  81
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  59
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  151
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  255
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   335
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   165,   165,   172,   179,   183,   190,   198,   206,   214,
+     225,   229,   233,   237,   241,   245,   251,   257,   262,   266,
+     271,   275,   280,   284,   289,   293,   297,   302,   307,   311,
+     316,   323,   339,   344,   349,   354,   358,   362,   366,   371,
+     375,   382,   388,   393,   397,   401,   408,   412,   416,   420,
+     424,   429,   434,   439,   443,   448,   452,   459,   466,   472,
+     478,   482,   486,   491,   496,   500,   506,   511,   516,   520,
+     528,   533,   538,   542,   547,   552,   557,   562,   567,   572,
+     577,   582,   587,   592,   597,   603,   607,   611,   616,   620,
+     624,   628,   632,   637,   641,   645,   650,   654,   658,   663,
+     667,   671,   675,   680,   684,   688,   692,   696,   700,   704,
+     708,   712,   717,   721,   725,   729,   733,   737,   742,   746,
+     752,   756,   760,   765,   770,   777,   781,   785,   789,   793,
+     798,   802,   806,   810,   814,   818,   822,   826,   830,   834,
+     838,   842,   849,   853,   861,   865,   869,   873,   877,   881,
+     885,   889
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "TOK_LIT_FLOAT",
+  "TOK_LIT_HEXINT", "TOK_LIT_DECINT", "TOK_LIT_OCTINT", "TOK_ID",
+  "TOK_LIT_STR", "TOK_ADD", "TOK_SUB", "TOK_MUL", "TOK_DIV", "TOK_MOD",
+  "TOK_INC", "TOK_DEC", "TOK_DEF", "TOK_LAND", "TOK_LOR", "TOK_NOT",
+  "TOK_LPAREN", "TOK_RPAREN", "TOK_LBRACE", "TOK_RBRACE", "TOK_LBRACKET",
+  "TOK_RBRACKET", "TOK_LCHEVRON", "TOK_RCHEVRON", "TOK_IF", "TOK_ELSE",
+  "TOK_WHILE", "TOK_SWITCH", "TOK_CASE", "TOK_DEFAULT", "TOK_EQ_EQ",
+  "TOK_NEQ", "TOK_LEQ", "TOK_GEQ", "TOK_EQ", "TOK_COMMA", "TOK_DOT",
+  "TOK_ATMARK", "TOK_MODULE", "TOK_USE", "TOK_INCLUDE", "TOK_FN",
+  "TOK_COROUTINE", "TOK_RETURN", "TOK_YIELD", "TOK_BIT_OR", "TOK_BIT_AND",
+  "TOK_BIT_XOR", "TOK_BIT_LSHIFT", "TOK_BIT_RSHIFT", "TOK_BIT_NOT",
+  "TOK_TYPE_I8", "TOK_TYPE_I16", "TOK_TYPE_I32", "TOK_TYPE_I64",
+  "TOK_TYPE_U8", "TOK_TYPE_U16", "TOK_TYPE_U32", "TOK_TYPE_U64",
+  "TOK_TYPE", "TOK_TYPEDEF", "TOK_STRUCT", "TOK_UNION", "TOK_ENUM",
+  "TOK_TYPE_FP32", "TOK_TYPE_FP64", "TOK_TYPE_STRING", "TOK_TYPE_BOOL",
+  "TOK_NIL", "TOK_TRUE", "TOK_FALSE", "TOK_COLON", "TOK_SEMICOLON", "SNOP",
+  "UNOP", "ELSENOP", "RETNOP", "$accept", "start", "file", "outer_block",
+  "outer_entry", "directive", "include", "use", "typedef", "struct_def",
+  "union_def", "decl_list", "enum_def", "enum_list", "enum_elem", "module",
+  "crdef", "fndef", "funcargs", "retvals", "args", "arg", "suite",
+  "inner_block", "statements", "statement", "stmt_while", "stmt_expr_list",
+  "stmt_return", "stmt_yield", "expr_list", "expression", "control_expr",
+  "if_expr", "else_block", "switch_expr", "switch_block", "switch_case",
+  "assign_expr", "or_test", "and_test", "or_expr", "xor_expr", "and_expr",
+  "comparison_eq", "comparison", "shift_expr", "a_expr", "m_expr",
+  "u_expr", "p_expr", "primary", "atom", "declaration", "identifier",
+  "type", "primitive_type", "literal_set", "literal", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-186)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     300,    20,    20,    50,    20,    20,   328,   328,    19,    45,
+      20,    29,  -186,   300,  -186,  -186,  -186,  -186,  -186,  -186,
+    -186,  -186,  -186,  -186,  -186,  -186,    56,  -186,  -186,    62,
+      62,  -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,    20,
+      20,    20,  -186,  -186,  -186,  -186,  -186,    69,  -186,    20,
+      20,    94,    20,   116,   123,  -186,  -186,   300,    20,   140,
+     140,  -186,  -186,  -186,    20,  -186,    66,   107,   114,    20,
+      72,    20,    20,   142,    16,  -186,  -186,    20,   169,   169,
+    -186,  -186,  -186,  -186,   328,    74,  -186,    83,    73,   156,
+    -186,  -186,  -186,    20,    21,   223,  -186,  -186,  -186,  -186,
+    -186,  -186,    20,  -186,  -186,  -186,  -186,  -186,  -186,  -186,
+     308,   308,   308,   308,   308,   279,   279,   279,   279,   308,
+     120,   149,   308,   308,  -186,  -186,  -186,  -186,   174,   223,
+     122,  -186,  -186,  -186,  -186,   165,  -186,  -186,  -186,  -186,
+    -186,   192,   194,   163,   162,   164,   102,    84,     1,   137,
+     101,  -186,    10,     5,  -186,  -186,    -3,  -186,  -186,  -186,
+    -186,  -186,  -186,  -186,  -186,    25,   169,   193,   195,  -186,
+    -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,   279,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,  -186,  -186,
+     279,    20,   308,   308,   279,  -186,   187,   223,   117,  -186,
+    -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,
+    -186,  -186,  -186,  -186,  -186,  -186,  -186,  -186,   199,  -186,
+    -186,  -186,    35,    65,  -186,   196,    99,   143,    76,  -186,
+    -186,  -186,  -186,  -186,  -186,   -16,  -186,   223,  -186,  -186,
+      99,   223,  -186,  -186,  -186
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     2,     3,     4,     6,    10,    11,    15,    12,
+      13,    14,     9,     7,     8,   124,     0,    17,    16,     0,
+       0,   130,   132,   134,   136,   131,   133,   135,   137,     0,
+       0,     0,   138,   139,   140,   141,   129,     0,   125,     0,
+       0,     0,     0,     0,     0,     1,     5,     0,    39,    36,
+      36,   126,   127,   128,     0,    18,     0,    26,     0,     0,
+       0,     0,     0,     0,     0,    37,    40,    39,     0,     0,
+      19,    21,    24,    25,     0,     0,    23,     0,     0,    29,
+      30,    31,    34,     0,     0,     0,    33,    32,   123,    20,
+      22,    27,     0,    38,    35,   147,   144,   145,   146,   148,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   151,   149,   150,    50,     0,    42,
+      43,    46,    47,    48,    49,    52,    57,    59,    60,    61,
+      62,    74,    76,    78,    80,    82,    84,    87,    92,    95,
+      98,   102,   111,   117,   118,   122,   121,   120,    28,   104,
+     117,   103,   107,   108,   105,     0,     0,     0,     0,   110,
+      54,    53,    56,    55,   109,   106,    41,    45,    44,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   112,   113,
+       0,     0,     0,     0,     0,   119,    66,     0,     0,    58,
+      75,    77,    79,    81,    83,    85,    86,    88,    89,    90,
+      91,    93,    94,    96,    97,    99,   100,   101,     0,   114,
+      72,    73,     0,     0,    63,     0,     0,     0,     0,    69,
+     116,   115,    64,    65,    51,     0,   143,     0,    67,    68,
+       0,     0,    71,   142,    70
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -186,  -186,  -186,   177,     7,  -186,  -186,  -186,  -186,  -186,
+    -186,   -24,  -186,   118,  -186,  -186,  -186,  -186,   205,   176,
+     167,   146,   -66,  -185,  -186,   111,  -186,  -186,  -186,  -186,
+    -113,  -102,  -186,    23,  -186,  -186,  -186,     3,   -27,    77,
+      71,    78,    79,    81,    -7,   -46,   -10,     8,   -64,   136,
+    -186,   -85,  -186,   350,    -1,     4,  -186,  -186,  -175
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    66,    21,    88,    89,    22,    23,    24,    59,    78,
+      74,    75,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   234,   139,   238,   239,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   160,   154,   155,   156,    47,    48,   245,   157
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_uint8 yytable[] =
+{
+      26,    27,   165,    29,    30,    46,    46,    51,    53,    54,
+     153,    49,    96,    97,   166,   167,   168,   204,   171,   173,
+      56,   202,   235,   250,   198,   199,    25,    25,    70,    55,
+     153,   153,   153,   153,   200,   153,   153,    92,    61,    62,
+      63,    50,   104,   203,   153,    85,   205,    87,    65,    68,
+     201,    68,    25,   191,   192,    93,   241,    68,    28,   251,
+      93,   246,   252,    80,   179,    68,   254,    52,    68,    68,
+      68,    90,    84,    25,   179,   253,    68,   209,    57,    25,
+      56,    25,    58,    46,    68,    64,    68,    95,    98,    81,
+      25,   232,    68,   116,   153,    86,   101,    99,   228,   248,
+     206,    90,   105,   106,   107,   108,   100,   109,   236,   237,
+     187,   188,   195,   196,   197,   153,    69,   153,   153,   153,
+     189,   190,   153,   105,   106,   107,   108,    25,   109,   110,
+     111,   225,   226,   227,   112,   113,   185,   186,    71,   114,
+     115,   217,   218,   219,   220,    72,   193,   194,   116,   236,
+     237,   118,   105,   106,   107,   108,    25,   109,   110,   111,
+      77,   119,   153,   112,   113,    91,   153,   242,   114,   115,
+     122,   124,   125,   126,   123,   230,   231,   116,   215,   216,
+     118,   221,   222,    83,     1,     2,     3,     4,     5,    84,
+     119,    95,   124,   125,   126,   102,   170,   176,   178,   122,
+     229,   223,   224,   123,   179,     6,     7,     8,     9,    10,
+     180,   181,   182,   183,   184,   207,   233,   208,   247,   244,
+     158,   124,   125,   126,   240,   172,   105,   106,   107,   108,
+      25,   109,   110,   111,    73,    60,    79,   112,   113,   103,
+     177,   249,   114,   115,    94,    95,   159,   161,   162,   163,
+     164,   116,   211,   117,   118,   169,   243,   210,   174,   175,
+     212,     0,   213,     0,   119,   214,     0,     0,     0,     0,
+     120,   121,     0,   122,     0,     0,     0,   123,     0,     0,
+       0,     0,   105,   106,   107,   108,    25,   109,   110,   111,
+       0,     0,     0,   112,   113,   124,   125,   126,   114,   115,
+       0,     0,     0,     0,     0,     0,     0,   116,     0,     0,
+     118,   105,   106,   107,   108,    25,   109,   110,   111,     0,
+     119,     0,   112,   113,     0,     0,     0,   114,   115,   122,
+       0,     0,     0,   123,     0,    25,     0,     0,     0,     0,
+       0,     0,     1,     2,     3,     4,     5,     0,     0,   119,
+       0,   124,   125,   126,     0,     0,     0,     0,   122,     0,
+       0,     0,   123,     6,     7,     8,     9,    10,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     124,   125,   126,    31,    32,    33,    34,    35,    36,    37,
+      38,     0,     0,    39,    40,    41,    42,    43,    44,    45,
+      67,     0,    67,     0,     0,     0,     0,     0,    76,     0,
+       0,     0,     0,     0,     0,     0,    82,     0,     0,    67,
+      82,    67,     0,     0,     0,     0,     0,    76,     0,     0,
+       0,     0,     0,     0,     0,    82,     0,    82,     0,     0,
+       0,     0,     0,    76
+};
+
+static const yytype_int16 yycheck[] =
+{
+       1,     2,   115,     4,     5,     6,     7,     8,     9,    10,
+      95,     7,    78,    79,   116,   117,   118,    20,   120,   121,
+      13,    16,   207,    39,    14,    15,     7,     7,    52,     0,
+     115,   116,   117,   118,    24,   120,   121,    21,    39,    40,
+      41,    22,    21,    38,   129,    69,    21,    71,    49,    50,
+      40,    52,     7,    52,    53,    39,    21,    58,     8,    75,
+      39,   236,   247,    64,    39,    66,   251,    22,    69,    70,
+      71,    72,    75,     7,    39,   250,    77,   179,    22,     7,
+      73,     7,    20,    84,    85,    16,    87,    22,    84,    23,
+       7,   204,    93,    28,   179,    23,    23,    23,   200,    23,
+     166,   102,     3,     4,     5,     6,    23,     8,    32,    33,
+      26,    27,    11,    12,    13,   200,    22,   202,   203,   204,
+      36,    37,   207,     3,     4,     5,     6,     7,     8,     9,
+      10,   195,   196,   197,    14,    15,    34,    35,    22,    19,
+      20,   187,   188,   189,   190,    22,     9,    10,    28,    32,
+      33,    31,     3,     4,     5,     6,     7,     8,     9,    10,
+      20,    41,   247,    14,    15,    23,   251,   233,    19,    20,
+      50,    72,    73,    74,    54,   202,   203,    28,   185,   186,
+      31,   191,   192,    76,    42,    43,    44,    45,    46,    75,
+      41,    22,    72,    73,    74,    39,    76,    23,    76,    50,
+     201,   193,   194,    54,    39,    63,    64,    65,    66,    67,
+      18,    17,    49,    51,    50,    22,    29,    22,    75,    23,
+     102,    72,    73,    74,    25,    76,     3,     4,     5,     6,
+       7,     8,     9,    10,    57,    30,    60,    14,    15,    93,
+     129,   238,    19,    20,    77,    22,   110,   111,   112,   113,
+     114,    28,   181,    30,    31,   119,   233,   180,   122,   123,
+     182,    -1,   183,    -1,    41,   184,    -1,    -1,    -1,    -1,
+      47,    48,    -1,    50,    -1,    -1,    -1,    54,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,     7,     8,     9,    10,
+      -1,    -1,    -1,    14,    15,    72,    73,    74,    19,    20,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,
+      31,     3,     4,     5,     6,     7,     8,     9,    10,    -1,
+      41,    -1,    14,    15,    -1,    -1,    -1,    19,    20,    50,
+      -1,    -1,    -1,    54,    -1,     7,    -1,    -1,    -1,    -1,
+      -1,    -1,    42,    43,    44,    45,    46,    -1,    -1,    41,
+      -1,    72,    73,    74,    -1,    -1,    -1,    -1,    50,    -1,
+      -1,    -1,    54,    63,    64,    65,    66,    67,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      72,    73,    74,    55,    56,    57,    58,    59,    60,    61,
+      62,    -1,    -1,    65,    66,    67,    68,    69,    70,    71,
+      50,    -1,    52,    -1,    -1,    -1,    -1,    -1,    58,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    66,    -1,    -1,    69,
+      70,    71,    -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    85,    -1,    87,    -1,    -1,
+      -1,    -1,    -1,    93
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,    42,    43,    44,    45,    46,    63,    64,    65,    66,
+      67,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+      91,    93,    96,    97,    98,     7,   135,   135,     8,   135,
+     135,    55,    56,    57,    58,    59,    60,    61,    62,    65,
+      66,    67,    68,    69,    70,    71,   135,   136,   137,   136,
+      22,   135,    22,   135,   135,     0,    85,    22,    20,    99,
+      99,   135,   135,   135,    16,   135,    92,   134,   135,    22,
+      92,    22,    22,    84,   101,   102,   134,    20,   100,   100,
+     135,    23,   134,    76,    75,    92,    23,    92,    94,    95,
+     135,    23,    21,    39,   101,    22,   103,   103,   136,    23,
+      23,    23,    39,   102,    21,     3,     4,     5,     6,     8,
+       9,    10,    14,    15,    19,    20,    28,    30,    31,    41,
+      47,    48,    50,    54,    72,    73,    74,   103,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   116,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   139,    94,   130,
+     132,   130,   130,   130,   130,   111,   112,   112,   112,   130,
+      76,   112,    76,   112,   130,   130,    23,   106,    76,    39,
+      18,    17,    49,    51,    50,    34,    35,    26,    27,    36,
+      37,    52,    53,     9,    10,    11,    12,    13,    14,    15,
+      24,    40,    16,    38,    20,    21,   103,    22,    22,   112,
+     120,   121,   122,   123,   124,   125,   125,   126,   126,   126,
+     126,   127,   127,   128,   128,   129,   129,   129,   112,   135,
+     119,   119,   111,    29,   115,   104,    32,    33,   117,   118,
+      25,    21,   103,   114,    23,   138,   139,    75,    23,   118,
+      39,    75,   104,   139,   104
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    81,    82,    83,    84,    84,    85,    85,    85,    85,
+      86,    86,    86,    86,    86,    86,    87,    88,    89,    89,
+      90,    90,    91,    91,    92,    92,    92,    93,    94,    94,
+      95,    96,    97,    98,    99,   100,   100,   101,   101,   101,
+     102,   103,   104,   105,   105,   105,   106,   106,   106,   106,
+     106,   107,   108,   109,   109,   110,   110,   111,   111,   112,
+     113,   113,   113,   114,   115,   115,   115,   116,   117,   117,
+     118,   118,   119,   119,   119,   120,   120,   121,   121,   122,
+     122,   123,   123,   124,   124,   125,   125,   125,   126,   126,
+     126,   126,   126,   127,   127,   127,   128,   128,   128,   129,
+     129,   129,   129,   130,   130,   130,   130,   130,   130,   130,
+     130,   130,   131,   131,   131,   131,   131,   131,   132,   132,
+     133,   133,   133,   134,   135,   136,   136,   136,   136,   136,
+     137,   137,   137,   137,   137,   137,   137,   137,   137,   137,
+     137,   137,   138,   138,   139,   139,   139,   139,   139,   139,
+     139,   139
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     3,     4,
+       5,     4,     5,     4,     2,     2,     1,     5,     3,     1,
+       1,     5,     5,     5,     3,     3,     0,     1,     3,     0,
+       1,     3,     1,     1,     2,     2,     1,     1,     1,     1,
+       1,     5,     1,     2,     2,     2,     2,     1,     3,     1,
+       1,     1,     1,     4,     2,     2,     0,     5,     2,     1,
+       4,     3,     3,     3,     1,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     3,     1,     3,     3,
+       3,     3,     1,     3,     3,     1,     3,     3,     1,     3,
+       3,     3,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     1,     2,     2,     3,     4,     4,     1,     1,     3,
+       1,     1,     1,     3,     1,     1,     2,     2,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, scanner, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, scanner); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void *scanner)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, void *scanner)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, scanner);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, void *scanner)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), scanner);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, scanner); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, void *scanner)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (scanner);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void *scanner)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* start: file  */
+#line 166 "minica.y"
+                {
+                    context_t *context;
+                    context = yyget_extra(scanner);
+                    context->st = (yyvsp[0].file);
+                }
+#line 1841 "y.tab.c"
+    break;
+
+  case 3: /* file: outer_block  */
+#line 173 "minica.y"
+                {
+                    (yyval.file) = st_new(scanner, (yyvsp[0].oblock));
+                }
+#line 1849 "y.tab.c"
+    break;
+
+  case 4: /* outer_block: outer_entry  */
+#line 180 "minica.y"
+                {
+                    (yyval.oblock) = outer_block_new(scanner, (yyvsp[0].obent));
+                }
+#line 1857 "y.tab.c"
+    break;
+
+  case 5: /* outer_block: outer_block outer_entry  */
+#line 184 "minica.y"
+                {
+                    (yyvsp[-1].oblock)->tail->next = (yyvsp[0].obent);
+                    (yyvsp[-1].oblock)->tail = (yyvsp[0].obent);
+                    (yyval.oblock) = (yyvsp[-1].oblock);
+                }
+#line 1867 "y.tab.c"
+    break;
+
+  case 6: /* outer_entry: directive  */
+#line 191 "minica.y"
+                {
+                    outer_block_entry_t *block;
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_DIRECTIVE);
+                    block->u.dr = (yyvsp[0].directive);
+                    (yyval.obent) = block;
+                }
+#line 1879 "y.tab.c"
+    break;
+
+  case 7: /* outer_entry: crdef  */
+#line 199 "minica.y"
+                {
+                    outer_block_entry_t *block;
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_COROUTINE);
+                    block->u.cr = (yyvsp[0].coroutine);
+                    (yyval.obent) = block;
+                }
+#line 1891 "y.tab.c"
+    break;
+
+  case 8: /* outer_entry: fndef  */
+#line 207 "minica.y"
+                {
+                    outer_block_entry_t *block;
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_FUNC);
+                    block->u.fn = (yyvsp[0].func);
+                    (yyval.obent) = block;
+                }
+#line 1903 "y.tab.c"
+    break;
+
+  case 9: /* outer_entry: module  */
+#line 215 "minica.y"
+                {
+                    outer_block_entry_t *block;
+                    block = outer_block_entry_new(scanner,
+                                                  OUTER_BLOCK_MODULE);
+                    block->u.md = (yyvsp[0].module);
+                    (yyval.obent) = block;
+                }
+#line 1915 "y.tab.c"
+    break;
+
+  case 10: /* directive: include  */
+#line 226 "minica.y"
+                {
+                    (yyval.directive) = NULL;
+                }
+#line 1923 "y.tab.c"
+    break;
+
+  case 11: /* directive: use  */
+#line 230 "minica.y"
+                {
+                    (yyval.directive) = (yyvsp[0].directive);
+                }
+#line 1931 "y.tab.c"
+    break;
+
+  case 12: /* directive: struct_def  */
+#line 234 "minica.y"
+                {
+                    (yyval.directive) = (yyvsp[0].directive);
+                }
+#line 1939 "y.tab.c"
+    break;
+
+  case 13: /* directive: union_def  */
+#line 238 "minica.y"
+                {
+                    (yyval.directive) = (yyvsp[0].directive);
+                }
+#line 1947 "y.tab.c"
+    break;
+
+  case 14: /* directive: enum_def  */
+#line 242 "minica.y"
+                {
+                    (yyval.directive) = (yyvsp[0].directive);
+                }
+#line 1955 "y.tab.c"
+    break;
+
+  case 15: /* directive: typedef  */
+#line 246 "minica.y"
+                {
+                    (yyval.directive) = (yyvsp[0].directive);
+                }
+#line 1963 "y.tab.c"
+    break;
+
+  case 16: /* include: TOK_INCLUDE TOK_LIT_STR  */
+#line 252 "minica.y"
+                {
+                    yyerror(&yylloc, scanner,
+                            "The include directive is not implemented.");
+                }
+#line 1972 "y.tab.c"
+    break;
+
+  case 17: /* use: TOK_USE identifier  */
+#line 258 "minica.y"
+                {
+                    (yyval.directive) = directive_use_new(scanner, (yyvsp[0].idval));
+                }
+#line 1980 "y.tab.c"
+    break;
+
+  case 18: /* typedef: TOK_TYPEDEF type identifier  */
+#line 263 "minica.y"
+                {
+                    (yyval.directive) = directive_typedef_new(scanner, (yyvsp[-1].type), (yyvsp[0].idval));
+                }
+#line 1988 "y.tab.c"
+    break;
+
+  case 19: /* typedef: TOK_TYPE type TOK_DEF identifier  */
+#line 267 "minica.y"
+                {
+                    (yyval.directive) = directive_typedef_new(scanner, (yyvsp[-2].type), (yyvsp[0].idval));
+                }
+#line 1996 "y.tab.c"
+    break;
+
+  case 20: /* struct_def: TOK_STRUCT identifier TOK_LBRACE decl_list TOK_RBRACE  */
+#line 272 "minica.y"
+                {
+                    (yyval.directive) = directive_struct_new(scanner, (yyvsp[-3].idval), (yyvsp[-1].decl_list));
+                }
+#line 2004 "y.tab.c"
+    break;
+
+  case 21: /* struct_def: TOK_STRUCT TOK_LBRACE decl_list TOK_RBRACE  */
+#line 276 "minica.y"
+                {
+                    (yyval.directive) = directive_struct_new(scanner, NULL, (yyvsp[-1].decl_list));
+                }
+#line 2012 "y.tab.c"
+    break;
+
+  case 22: /* union_def: TOK_UNION identifier TOK_LBRACE decl_list TOK_RBRACE  */
+#line 281 "minica.y"
+                {
+                    (yyval.directive) = directive_union_new(scanner, (yyvsp[-3].idval), (yyvsp[-1].decl_list));
+                }
+#line 2020 "y.tab.c"
+    break;
+
+  case 23: /* union_def: TOK_UNION TOK_LBRACE decl_list TOK_RBRACE  */
+#line 285 "minica.y"
+                {
+                    (yyval.directive) = directive_union_new(scanner, NULL, (yyvsp[-1].decl_list));
+                }
+#line 2028 "y.tab.c"
+    break;
+
+  case 24: /* decl_list: decl_list declaration  */
+#line 290 "minica.y"
+                {
+                    (yyval.decl_list) = decl_list_append((yyvsp[-1].decl_list), (yyvsp[0].decl));
+                }
+#line 2036 "y.tab.c"
+    break;
+
+  case 25: /* decl_list: declaration TOK_SEMICOLON  */
+#line 294 "minica.y"
+                {
+                    (yyval.decl_list) = decl_list_new(scanner, (yyvsp[-1].decl));
+                }
+#line 2044 "y.tab.c"
+    break;
+
+  case 26: /* decl_list: declaration  */
+#line 298 "minica.y"
+                {
+                    (yyval.decl_list) = decl_list_new(scanner, (yyvsp[0].decl));
+                }
+#line 2052 "y.tab.c"
+    break;
+
+  case 27: /* enum_def: TOK_ENUM identifier TOK_LBRACE enum_list TOK_RBRACE  */
+#line 303 "minica.y"
+                {
+                    (yyval.directive) = directive_enum_new(scanner, (yyvsp[-3].idval), (yyvsp[-1].enum_elem));
+                }
+#line 2060 "y.tab.c"
+    break;
+
+  case 28: /* enum_list: enum_elem TOK_COMMA enum_list  */
+#line 308 "minica.y"
+                {
+                    (yyval.enum_elem) = enum_elem_prepend((yyvsp[-2].enum_elem), (yyvsp[0].enum_elem));
+                }
+#line 2068 "y.tab.c"
+    break;
+
+  case 29: /* enum_list: enum_elem  */
+#line 312 "minica.y"
+                {
+                    (yyval.enum_elem) = (yyvsp[0].enum_elem);
+                }
+#line 2076 "y.tab.c"
+    break;
+
+  case 30: /* enum_elem: identifier  */
+#line 317 "minica.y"
+                {
+                    (yyval.enum_elem) = enum_elem_new(scanner, (yyvsp[0].idval));
+                }
+#line 2084 "y.tab.c"
+    break;
+
+  case 31: /* module: TOK_MODULE identifier TOK_LBRACE outer_block TOK_RBRACE  */
+#line 324 "minica.y"
+                {
+                    context_t *context;
+                    module_t *module;
+                    module_t *cur;
+                    module = module_new(scanner, (yyvsp[-3].idval), (yyvsp[-1].oblock));
+                    ERROR_ON_NULL(module, "Cannot initialize a new module.");
+                    context = yyget_extra(scanner);
+                    cur = context->cur;
+                    context->cur = module;
+                    module->parent = cur;
+                    (yyval.module) = module;
+                }
+#line 2101 "y.tab.c"
+    break;
+
+  case 32: /* crdef: TOK_COROUTINE identifier funcargs retvals suite  */
+#line 340 "minica.y"
+                {
+                    (yyval.coroutine) = coroutine_new(scanner, (yyvsp[-3].idval), (yyvsp[-2].args), (yyvsp[-1].args), (yyvsp[0].iblock));
+                }
+#line 2109 "y.tab.c"
+    break;
+
+  case 33: /* fndef: TOK_FN identifier funcargs retvals suite  */
+#line 345 "minica.y"
+                {
+                    (yyval.func) = func_new(scanner, (yyvsp[-3].idval), (yyvsp[-2].args), (yyvsp[-1].args), (yyvsp[0].iblock));
+                }
+#line 2117 "y.tab.c"
+    break;
+
+  case 34: /* funcargs: TOK_LPAREN args TOK_RPAREN  */
+#line 350 "minica.y"
+                {
+                    (yyval.args) = (yyvsp[-1].args);
+                }
+#line 2125 "y.tab.c"
+    break;
+
+  case 35: /* retvals: TOK_LPAREN args TOK_RPAREN  */
+#line 355 "minica.y"
+                {
+                    (yyval.args) = (yyvsp[-1].args);
+                }
+#line 2133 "y.tab.c"
+    break;
+
+  case 36: /* retvals: %empty  */
+#line 359 "minica.y"
+                {
+                    (yyval.args) = NULL;
+                }
+#line 2141 "y.tab.c"
+    break;
+
+  case 37: /* args: arg  */
+#line 363 "minica.y"
+                {
+                    (yyval.args) = arg_list_new(scanner, (yyvsp[0].arg));
+                }
+#line 2149 "y.tab.c"
+    break;
+
+  case 38: /* args: args TOK_COMMA arg  */
+#line 367 "minica.y"
+                {
+                    (yyval.args) = arg_list_append((yyvsp[-2].args), (yyvsp[0].arg));
+                }
+#line 2157 "y.tab.c"
+    break;
+
+  case 39: /* args: %empty  */
+#line 371 "minica.y"
+                {
+                    (yyval.args) = arg_list_new(scanner, NULL);
+                }
+#line 2165 "y.tab.c"
+    break;
+
+  case 40: /* arg: declaration  */
+#line 376 "minica.y"
+                {
+                    (yyval.arg) = arg_new(scanner, (yyvsp[0].decl));
+                }
+#line 2173 "y.tab.c"
+    break;
+
+  case 41: /* suite: TOK_LBRACE inner_block TOK_RBRACE  */
+#line 383 "minica.y"
+                {
+                    (yyval.iblock) = (yyvsp[-1].iblock);
+                }
+#line 2181 "y.tab.c"
+    break;
+
+  case 42: /* inner_block: statements  */
+#line 389 "minica.y"
+                {
+                    (yyval.iblock) = inner_block_new(scanner, (yyvsp[0].stmts));
+                }
+#line 2189 "y.tab.c"
+    break;
+
+  case 43: /* statements: statement  */
+#line 394 "minica.y"
+                {
+                    (yyval.stmts) = stmt_list_new(scanner, (yyvsp[0].stmt));
+                }
+#line 2197 "y.tab.c"
+    break;
+
+  case 44: /* statements: statement TOK_SEMICOLON  */
+#line 398 "minica.y"
+                {
+                    (yyval.stmts) = stmt_list_new(scanner, (yyvsp[-1].stmt));
+                }
+#line 2205 "y.tab.c"
+    break;
+
+  case 45: /* statements: statements statement  */
+#line 402 "minica.y"
+                {
+                    (yyval.stmts) = stmt_list_append((yyvsp[-1].stmts), (yyvsp[0].stmt));
+                }
+#line 2213 "y.tab.c"
+    break;
+
+  case 46: /* statement: stmt_while  */
+#line 409 "minica.y"
+                {
+                    (yyval.stmt) = (yyvsp[0].stmt);
+                }
+#line 2221 "y.tab.c"
+    break;
+
+  case 47: /* statement: stmt_expr_list  */
+#line 413 "minica.y"
+                {
+                    (yyval.stmt) = (yyvsp[0].stmt);
+                }
+#line 2229 "y.tab.c"
+    break;
+
+  case 48: /* statement: stmt_return  */
+#line 417 "minica.y"
+                {
+                    (yyval.stmt) = (yyvsp[0].stmt);
+                }
+#line 2237 "y.tab.c"
+    break;
+
+  case 49: /* statement: stmt_yield  */
+#line 421 "minica.y"
+                {
+                    (yyval.stmt) = (yyvsp[0].stmt);
+                }
+#line 2245 "y.tab.c"
+    break;
+
+  case 50: /* statement: suite  */
+#line 425 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_block(scanner, (yyvsp[0].iblock));
+                }
+#line 2253 "y.tab.c"
+    break;
+
+  case 51: /* stmt_while: TOK_WHILE expression TOK_LBRACE inner_block TOK_RBRACE  */
+#line 430 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_while(scanner, (yyvsp[-3].expr), (yyvsp[-1].iblock));
+                }
+#line 2261 "y.tab.c"
+    break;
+
+  case 52: /* stmt_expr_list: expr_list  */
+#line 435 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_expr_list(scanner, (yyvsp[0].exprs));
+                }
+#line 2269 "y.tab.c"
+    break;
+
+  case 53: /* stmt_return: TOK_RETURN expression  */
+#line 440 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_return(scanner, (yyvsp[0].expr));
+                }
+#line 2277 "y.tab.c"
+    break;
+
+  case 54: /* stmt_return: TOK_RETURN TOK_SEMICOLON  */
+#line 444 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_return(scanner, NULL);
+                }
+#line 2285 "y.tab.c"
+    break;
+
+  case 55: /* stmt_yield: TOK_YIELD expression  */
+#line 449 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_yield(scanner, (yyvsp[0].expr));
+                }
+#line 2293 "y.tab.c"
+    break;
+
+  case 56: /* stmt_yield: TOK_YIELD TOK_SEMICOLON  */
+#line 453 "minica.y"
+                {
+                    (yyval.stmt) = stmt_new_yield(scanner, NULL);
+                }
+#line 2301 "y.tab.c"
+    break;
+
+  case 57: /* expr_list: expression  */
+#line 460 "minica.y"
+                {
+                    expr_list_t *list;
+                    list = expr_list_new(scanner);
+                    ERROR_ON_NULL(list, "Memory error: expr_list_new()");
+                    (yyval.exprs) = expr_list_append(list, (yyvsp[0].expr));
+                }
+#line 2312 "y.tab.c"
+    break;
+
+  case 58: /* expr_list: expr_list TOK_COMMA expression  */
+#line 467 "minica.y"
+                {
+                    (yyval.exprs) = expr_list_append((yyvsp[-2].exprs), (yyvsp[0].expr));
+                }
+#line 2320 "y.tab.c"
+    break;
+
+  case 59: /* expression: control_expr  */
+#line 473 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2328 "y.tab.c"
+    break;
+
+  case 60: /* control_expr: if_expr  */
+#line 479 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2336 "y.tab.c"
+    break;
+
+  case 61: /* control_expr: switch_expr  */
+#line 483 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2344 "y.tab.c"
+    break;
+
+  case 62: /* control_expr: assign_expr  */
+#line 487 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2352 "y.tab.c"
+    break;
+
+  case 63: /* if_expr: TOK_IF expression suite else_block  */
+#line 492 "minica.y"
+                {
+                    (yyval.expr) = expr_new_if(scanner, (yyvsp[-2].expr), (yyvsp[-1].iblock), (yyvsp[0].iblock));
+                }
+#line 2360 "y.tab.c"
+    break;
+
+  case 64: /* else_block: TOK_ELSE suite  */
+#line 497 "minica.y"
+                {
+                    (yyval.iblock) = (yyvsp[0].iblock);
+                }
+#line 2368 "y.tab.c"
+    break;
+
+  case 65: /* else_block: TOK_ELSE if_expr  */
+#line 501 "minica.y"
+                {
+                    stmt_t *stmt;
+                    stmt = stmt_new_expr(scanner, (yyvsp[0].expr));
+                    (yyval.iblock) = inner_block_new(scanner, stmt_list_new(scanner, stmt));
+                }
+#line 2378 "y.tab.c"
+    break;
+
+  case 66: /* else_block: %empty  */
+#line 507 "minica.y"
+                {
+                    (yyval.iblock) = NULL;
+                }
+#line 2386 "y.tab.c"
+    break;
+
+  case 67: /* switch_expr: TOK_SWITCH expression TOK_LBRACE switch_block TOK_RBRACE  */
+#line 512 "minica.y"
+                {
+                    (yyval.expr) = expr_new_switch(scanner, (yyvsp[-3].expr), (yyvsp[-1].swblock));
+                }
+#line 2394 "y.tab.c"
+    break;
+
+  case 68: /* switch_block: switch_block switch_case  */
+#line 517 "minica.y"
+                {
+                    (yyval.swblock) = switch_block_append((yyvsp[-1].swblock), (yyvsp[0].swcase));
+                }
+#line 2402 "y.tab.c"
+    break;
+
+  case 69: /* switch_block: switch_case  */
+#line 521 "minica.y"
+                {
+                    switch_block_t *block;
+                    block = switch_block_new(scanner);
+                    ERROR_ON_NULL(block, "Parse error: switch");
+                    (yyval.swblock) = switch_block_append(block, (yyvsp[0].swcase));
+                }
+#line 2413 "y.tab.c"
+    break;
+
+  case 70: /* switch_case: TOK_CASE literal_set TOK_COLON inner_block  */
+#line 529 "minica.y"
+                {
+                    ERROR_ON_NULL((yyvsp[-2].lset), "Parse error: case");
+                    (yyval.swcase) = switch_case_new(scanner, (yyvsp[-2].lset), (yyvsp[0].iblock));
+                }
+#line 2422 "y.tab.c"
+    break;
+
+  case 71: /* switch_case: TOK_DEFAULT TOK_COLON inner_block  */
+#line 534 "minica.y"
+                {
+                    (yyval.swcase) = switch_case_new(scanner, NULL, (yyvsp[0].iblock));
+                }
+#line 2430 "y.tab.c"
+    break;
+
+  case 72: /* assign_expr: primary TOK_DEF assign_expr  */
+#line 539 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_ASSIGN);
+                }
+#line 2438 "y.tab.c"
+    break;
+
+  case 73: /* assign_expr: primary TOK_EQ assign_expr  */
+#line 543 "minica.y"
+                {
+                    fprintf(stderr, "Warning: \"=\" is not recommended.\n");
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_ASSIGN);
+                }
+#line 2447 "y.tab.c"
+    break;
+
+  case 74: /* assign_expr: or_test  */
+#line 548 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2455 "y.tab.c"
+    break;
+
+  case 75: /* or_test: or_test TOK_LOR or_test  */
+#line 553 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_LOR);
+                    ERROR_ON_NULL((yyval.expr), "Parse error: ||");
+                }
+#line 2464 "y.tab.c"
+    break;
+
+  case 76: /* or_test: and_test  */
+#line 558 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2472 "y.tab.c"
+    break;
+
+  case 77: /* and_test: and_test TOK_LAND and_test  */
+#line 563 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_LAND);
+                    ERROR_ON_NULL((yyval.expr), "Parse error: &&");
+                }
+#line 2481 "y.tab.c"
+    break;
+
+  case 78: /* and_test: or_expr  */
+#line 568 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2489 "y.tab.c"
+    break;
+
+  case 79: /* or_expr: or_expr TOK_BIT_OR or_expr  */
+#line 573 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_OR);
+                    ERROR_ON_NULL((yyval.expr), "Parse error: ||");
+                }
+#line 2498 "y.tab.c"
+    break;
+
+  case 80: /* or_expr: xor_expr  */
+#line 578 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2506 "y.tab.c"
+    break;
+
+  case 81: /* xor_expr: xor_expr TOK_BIT_XOR xor_expr  */
+#line 583 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_XOR);
+                    ERROR_ON_NULL((yyval.expr), "Parse error: ^");
+                }
+#line 2515 "y.tab.c"
+    break;
+
+  case 82: /* xor_expr: and_expr  */
+#line 588 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2523 "y.tab.c"
+    break;
+
+  case 83: /* and_expr: and_expr TOK_BIT_AND and_expr  */
+#line 593 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_AND);
+                    ERROR_ON_NULL((yyval.expr), "Parse error: &");
+                }
+#line 2532 "y.tab.c"
+    break;
+
+  case 84: /* and_expr: comparison_eq  */
+#line 598 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2540 "y.tab.c"
+    break;
+
+  case 85: /* comparison_eq: comparison_eq TOK_EQ_EQ comparison_eq  */
+#line 604 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_EQ);
+                }
+#line 2548 "y.tab.c"
+    break;
+
+  case 86: /* comparison_eq: comparison_eq TOK_NEQ comparison_eq  */
+#line 608 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_NEQ);
+                }
+#line 2556 "y.tab.c"
+    break;
+
+  case 87: /* comparison_eq: comparison  */
+#line 612 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2564 "y.tab.c"
+    break;
+
+  case 88: /* comparison: comparison TOK_LCHEVRON comparison  */
+#line 617 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_LT);
+                }
+#line 2572 "y.tab.c"
+    break;
+
+  case 89: /* comparison: comparison TOK_RCHEVRON comparison  */
+#line 621 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_GT);
+                }
+#line 2580 "y.tab.c"
+    break;
+
+  case 90: /* comparison: comparison TOK_LEQ comparison  */
+#line 625 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_LEQ);
+                }
+#line 2588 "y.tab.c"
+    break;
+
+  case 91: /* comparison: comparison TOK_GEQ comparison  */
+#line 629 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_CMP_GEQ);
+                }
+#line 2596 "y.tab.c"
+    break;
+
+  case 92: /* comparison: shift_expr  */
+#line 633 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2604 "y.tab.c"
+    break;
+
+  case 93: /* shift_expr: shift_expr TOK_BIT_LSHIFT shift_expr  */
+#line 638 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_LSHIFT);
+                }
+#line 2612 "y.tab.c"
+    break;
+
+  case 94: /* shift_expr: shift_expr TOK_BIT_RSHIFT shift_expr  */
+#line 642 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_RSHIFT);
+                }
+#line 2620 "y.tab.c"
+    break;
+
+  case 95: /* shift_expr: a_expr  */
+#line 646 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2628 "y.tab.c"
+    break;
+
+  case 96: /* a_expr: a_expr TOK_ADD a_expr  */
+#line 651 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_ADD);
+                }
+#line 2636 "y.tab.c"
+    break;
+
+  case 97: /* a_expr: a_expr TOK_SUB a_expr  */
+#line 655 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_SUB);
+                }
+#line 2644 "y.tab.c"
+    break;
+
+  case 98: /* a_expr: m_expr  */
+#line 659 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2652 "y.tab.c"
+    break;
+
+  case 99: /* m_expr: m_expr TOK_MUL m_expr  */
+#line 664 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_MUL);
+                }
+#line 2660 "y.tab.c"
+    break;
+
+  case 100: /* m_expr: m_expr TOK_DIV m_expr  */
+#line 668 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_DIV);
+                }
+#line 2668 "y.tab.c"
+    break;
+
+  case 101: /* m_expr: m_expr TOK_MOD m_expr  */
+#line 672 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_infix(scanner, (yyvsp[-2].expr), (yyvsp[0].expr), OP_MOD);
+                }
+#line 2676 "y.tab.c"
+    break;
+
+  case 102: /* m_expr: u_expr  */
+#line 676 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2684 "y.tab.c"
+    break;
+
+  case 103: /* u_expr: TOK_SUB u_expr  */
+#line 681 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_SUB);
+                }
+#line 2692 "y.tab.c"
+    break;
+
+  case 104: /* u_expr: TOK_ADD u_expr  */
+#line 685 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_ADD);
+                }
+#line 2700 "y.tab.c"
+    break;
+
+  case 105: /* u_expr: TOK_NOT u_expr  */
+#line 689 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_NOT);
+                }
+#line 2708 "y.tab.c"
+    break;
+
+  case 106: /* u_expr: TOK_BIT_NOT u_expr  */
+#line 693 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_COMP);
+                }
+#line 2716 "y.tab.c"
+    break;
+
+  case 107: /* u_expr: TOK_INC u_expr  */
+#line 697 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_INC);
+                }
+#line 2724 "y.tab.c"
+    break;
+
+  case 108: /* u_expr: TOK_DEC u_expr  */
+#line 701 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_DEC);
+                }
+#line 2732 "y.tab.c"
+    break;
+
+  case 109: /* u_expr: TOK_BIT_AND u_expr  */
+#line 705 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_PTRREF);
+                }
+#line 2740 "y.tab.c"
+    break;
+
+  case 110: /* u_expr: TOK_ATMARK u_expr  */
+#line 709 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_prefix(scanner, (yyvsp[0].expr), OP_PTRIND);
+                }
+#line 2748 "y.tab.c"
+    break;
+
+  case 111: /* u_expr: p_expr  */
+#line 713 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2756 "y.tab.c"
+    break;
+
+  case 112: /* p_expr: p_expr TOK_INC  */
+#line 718 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_suffix(scanner, (yyvsp[-1].expr), OP_INC);
+                }
+#line 2764 "y.tab.c"
+    break;
+
+  case 113: /* p_expr: p_expr TOK_DEC  */
+#line 722 "minica.y"
+                {
+                    (yyval.expr) = expr_op_new_suffix(scanner, (yyvsp[-1].expr), OP_DEC);
+                }
+#line 2772 "y.tab.c"
+    break;
+
+  case 114: /* p_expr: p_expr TOK_DOT identifier  */
+#line 726 "minica.y"
+                {
+                    (yyval.expr) = expr_new_member(scanner, (yyvsp[-2].expr), (yyvsp[0].idval));
+                }
+#line 2780 "y.tab.c"
+    break;
+
+  case 115: /* p_expr: identifier TOK_LPAREN expr_list TOK_RPAREN  */
+#line 730 "minica.y"
+                {
+                    (yyval.expr) = expr_new_call(scanner, (yyvsp[-3].idval), (yyvsp[-1].exprs));
+                }
+#line 2788 "y.tab.c"
+    break;
+
+  case 116: /* p_expr: p_expr TOK_LBRACKET expression TOK_RBRACKET  */
+#line 734 "minica.y"
+                {
+                    (yyval.expr) = expr_new_ref(scanner, (yyvsp[-3].expr), (yyvsp[-1].expr));
+                }
+#line 2796 "y.tab.c"
+    break;
+
+  case 117: /* p_expr: primary  */
+#line 738 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2804 "y.tab.c"
+    break;
+
+  case 118: /* primary: atom  */
+#line 743 "minica.y"
+                {
+                    (yyval.expr) = (yyvsp[0].expr);
+                }
+#line 2812 "y.tab.c"
+    break;
+
+  case 119: /* primary: TOK_LPAREN expr_list TOK_RPAREN  */
+#line 747 "minica.y"
+                {
+                    (yyval.expr) = expr_new_list(scanner, (yyvsp[-1].exprs));
+                }
+#line 2820 "y.tab.c"
+    break;
+
+  case 120: /* atom: literal  */
+#line 753 "minica.y"
+                {
+                    (yyval.expr) = expr_new_literal(scanner, (yyvsp[0].lit));
+                }
+#line 2828 "y.tab.c"
+    break;
+
+  case 121: /* atom: identifier  */
+#line 757 "minica.y"
+                {
+                    (yyval.expr) = expr_new_id(scanner, (yyvsp[0].idval));
+                }
+#line 2836 "y.tab.c"
+    break;
+
+  case 122: /* atom: declaration  */
+#line 761 "minica.y"
+                {
+                    (yyval.expr) = expr_new_decl(scanner, (yyvsp[0].decl));
+                }
+#line 2844 "y.tab.c"
+    break;
+
+  case 123: /* declaration: identifier TOK_COLON type  */
+#line 766 "minica.y"
+                {
+                    (yyval.decl) = decl_new(scanner, (yyvsp[-2].idval), (yyvsp[0].type));
+                }
+#line 2852 "y.tab.c"
+    break;
+
+  case 124: /* identifier: TOK_ID  */
+#line 771 "minica.y"
+                {
+                    (yyval.idval) = (yyvsp[0].idval);
+                }
+#line 2860 "y.tab.c"
+    break;
+
+  case 125: /* type: primitive_type  */
+#line 778 "minica.y"
+                {
+                    (yyval.type) = (yyvsp[0].type);
+                }
+#line 2868 "y.tab.c"
+    break;
+
+  case 126: /* type: TOK_STRUCT identifier  */
+#line 782 "minica.y"
+                {
+                    (yyval.type) = type_new_struct(scanner, (yyvsp[0].idval));
+                }
+#line 2876 "y.tab.c"
+    break;
+
+  case 127: /* type: TOK_UNION identifier  */
+#line 786 "minica.y"
+                {
+                    (yyval.type) = type_new_union(scanner, (yyvsp[0].idval));
+                }
+#line 2884 "y.tab.c"
+    break;
+
+  case 128: /* type: TOK_ENUM identifier  */
+#line 790 "minica.y"
+                {
+                    (yyval.type) = type_new_enum(scanner, (yyvsp[0].idval));
+                }
+#line 2892 "y.tab.c"
+    break;
+
+  case 129: /* type: identifier  */
+#line 794 "minica.y"
+                {
+                    (yyval.type) = type_new_id(scanner, (yyvsp[0].idval));
+                }
+#line 2900 "y.tab.c"
+    break;
+
+  case 130: /* primitive_type: TOK_TYPE_I8  */
+#line 799 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_I8);
+                }
+#line 2908 "y.tab.c"
+    break;
+
+  case 131: /* primitive_type: TOK_TYPE_U8  */
+#line 803 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_U8);
+                }
+#line 2916 "y.tab.c"
+    break;
+
+  case 132: /* primitive_type: TOK_TYPE_I16  */
+#line 807 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_I16);
+                }
+#line 2924 "y.tab.c"
+    break;
+
+  case 133: /* primitive_type: TOK_TYPE_U16  */
+#line 811 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_U16);
+                }
+#line 2932 "y.tab.c"
+    break;
+
+  case 134: /* primitive_type: TOK_TYPE_I32  */
+#line 815 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_I32);
+                }
+#line 2940 "y.tab.c"
+    break;
+
+  case 135: /* primitive_type: TOK_TYPE_U32  */
+#line 819 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_U32);
+                }
+#line 2948 "y.tab.c"
+    break;
+
+  case 136: /* primitive_type: TOK_TYPE_I64  */
+#line 823 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_I64);
+                }
+#line 2956 "y.tab.c"
+    break;
+
+  case 137: /* primitive_type: TOK_TYPE_U64  */
+#line 827 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_U64);
+                }
+#line 2964 "y.tab.c"
+    break;
+
+  case 138: /* primitive_type: TOK_TYPE_FP32  */
+#line 831 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_FP32);
+                }
+#line 2972 "y.tab.c"
+    break;
+
+  case 139: /* primitive_type: TOK_TYPE_FP64  */
+#line 835 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_FP64);
+                }
+#line 2980 "y.tab.c"
+    break;
+
+  case 140: /* primitive_type: TOK_TYPE_STRING  */
+#line 839 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_STRING);
+                }
+#line 2988 "y.tab.c"
+    break;
+
+  case 141: /* primitive_type: TOK_TYPE_BOOL  */
+#line 843 "minica.y"
+                {
+                    (yyval.type) = type_new_primitive(scanner, TYPE_PRIMITIVE_BOOL);
+                }
+#line 2996 "y.tab.c"
+    break;
+
+  case 142: /* literal_set: literal_set TOK_COMMA literal  */
+#line 850 "minica.y"
+                {
+                    (yyval.lset) = literal_set_add((yyvsp[-2].lset), (yyvsp[0].lit));
+                }
+#line 3004 "y.tab.c"
+    break;
+
+  case 143: /* literal_set: literal  */
+#line 854 "minica.y"
+                {
+                    (yyval.lset) = literal_set_new(scanner);
+                    (yyval.lset) = literal_set_add((yyval.lset), (yyvsp[0].lit));
+                }
+#line 3013 "y.tab.c"
+    break;
+
+  case 144: /* literal: TOK_LIT_HEXINT  */
+#line 862 "minica.y"
+                {
+                    (yyval.lit) = literal_new_int(scanner, (yyvsp[0].numval), LIT_HEXINT);
+                }
+#line 3021 "y.tab.c"
+    break;
+
+  case 145: /* literal: TOK_LIT_DECINT  */
+#line 866 "minica.y"
+                {
+                    (yyval.lit) = literal_new_int(scanner, (yyvsp[0].numval), LIT_DECINT);
+                }
+#line 3029 "y.tab.c"
+    break;
+
+  case 146: /* literal: TOK_LIT_OCTINT  */
+#line 870 "minica.y"
+                {
+                    (yyval.lit) = literal_new_int(scanner, (yyvsp[0].numval), LIT_OCTINT);
+                }
+#line 3037 "y.tab.c"
+    break;
+
+  case 147: /* literal: TOK_LIT_FLOAT  */
+#line 874 "minica.y"
+                {
+                    (yyval.lit) = literal_new_float(scanner, (yyvsp[0].numval));
+                }
+#line 3045 "y.tab.c"
+    break;
+
+  case 148: /* literal: TOK_LIT_STR  */
+#line 878 "minica.y"
+                {
+                    (yyval.lit) = literal_new_string(scanner, (yyvsp[0].strval));
+                }
+#line 3053 "y.tab.c"
+    break;
+
+  case 149: /* literal: TOK_TRUE  */
+#line 882 "minica.y"
+                {
+                    (yyval.lit) = literal_new_bool(scanner, BOOL_TRUE);
+                }
+#line 3061 "y.tab.c"
+    break;
+
+  case 150: /* literal: TOK_FALSE  */
+#line 886 "minica.y"
+                {
+                    (yyval.lit) = literal_new_bool(scanner, BOOL_FALSE);
+                }
+#line 3069 "y.tab.c"
+    break;
+
+  case 151: /* literal: TOK_NIL  */
+#line 890 "minica.y"
+                {
+                    (yyval.lit) = literal_new_nil(scanner);
+                }
+#line 3077 "y.tab.c"
+    break;
+
+
+#line 3081 "y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (&yylloc, scanner, YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, scanner);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, scanner);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (&yylloc, scanner, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, scanner);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, scanner);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 895 "minica.y"
+
+
+/*
+ * yyerror -- error handler
+ */
+void
+yyerror(YYLTYPE *yylloc, yyscan_t scanner, const char *str)
+{
+    int lineno;
+    lineno = yyget_lineno(scanner);
+    fprintf(stderr, "Parser error near Line %d: %s\n", lineno, str);
+}
+
+/*
+ * _yylex_report -- scan a token; one in REPORT_SAMPLE tokens is timed in the
+ * lexing phase of the report for all of them, since timing each token would
+ * take longer than scanning it.  The allocations of the tokens not timed are
+ * counted to the parsing phase.
+ */
+static int
+_yylex_report(YYSTYPE *lval, YYLTYPE *lloc, yyscan_t scanner)
+{
+    context_t *context;
+    report_span_t span;
+    int tok;
+
+    context = yyget_extra(scanner);
+    if ( !report_enabled() || context->ntokens++ % REPORT_SAMPLE ) {
+        return (yylex)(lval, lloc, scanner);
+    }
+    report_begin(&span, REPORT_LEX);
+    tok = (yylex)(lval, lloc, scanner);
+    report_sample(&span, REPORT_SAMPLE);
+
+    return tok;
+}
+
+/*
+ * _release_source -- release the source text
+ */
+static void
+_release_source(source_t *src)
+{
+    if ( src->maplen ) {
+        munmap(src->buf, src->maplen);
+    } else {
+        free(src->buf);
+    }
+}
+
+/*
+ * _parse -- parse the source text in the context
+ *
+ * The source text must be terminated by two NUL characters so that the
+ * scanner works on it in place without copying.  The text is owned by the
+ * syntax tree returned on success, and released by st_release().
+ */
+static st_t *
+_parse(context_t *context)
+{
+    yyscan_t scanner;
+    YY_BUFFER_STATE bs;
+    module_t *module;
+    st_t *st;
+    report_span_t span;
+
+    /* Allocate an arena for the syntax tree */
+    context->arena = arena_new();
+    if ( NULL == context->arena ) {
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
+
+    /* Initialize the scanner with the extra data context */
+    if ( yylex_init_extra(context, &scanner) ) {
+        arena_release(context->arena);
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
+
+    /* New module */
+    module = module_new(scanner, intern(""), NULL);
+    if ( NULL == module ) {
+        yylex_destroy(scanner);
+        arena_release(context->arena);
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
+    context->cur = module;
+
+    /* Scan the source text in place */
+    bs = yy_scan_buffer(context->src.buf, context->src.len + 2, scanner);
+    if ( NULL == bs ) {
+        yylex_destroy(scanner);
+        arena_release(context->arena);
+        _release_source(&context->src);
+        free(context);
+        return NULL;
+    }
+
+    /* Parse the input file */
+    report_begin(&span, REPORT_PARSE);
+    if ( yyparse(scanner) ) {
+        fprintf(stderr, "Parse error: yyparse()\n");
+        exit(EXIT_FAILURE);
+    }
+    report_end(&span);
+
+    /* Destroy the scanner */
+    yy_delete_buffer(bs, scanner);
+    yylex_destroy(scanner);
+
+    /* The tree owns the arena and the source text from here; the context is
+       no longer used */
+    st = context->st;
+    if ( NULL == st ) {
+        arena_release(context->arena);
+        _release_source(&context->src);
+    }
+    free(context->buffer.buf);
+    free(context);
+
+    return st;
+}
+
+/*
+ * _context_new -- allocate a new parser context
+ */
+static context_t *
+_context_new(void)
+{
+    context_t *context;
+
+    context = malloc(sizeof(context_t));
+    if ( NULL == context ) {
+        return NULL;
+    }
+    memset(context, 0, sizeof(context_t));
+
+    return context;
+}
+
+/*
+ * minica_parse_buffer -- parse the source text in the specified buffer
+ */
+st_t *
+minica_parse_buffer(const char *buf, size_t len)
+{
+    context_t *context;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return NULL;
+    }
+
+    /* The scanner writes into its buffer, so copy the text once here */
+    context->src.buf = malloc(len + 2);
+    if ( NULL == context->src.buf ) {
+        free(context);
+        return NULL;
+    }
+    memcpy(context->src.buf, buf, len);
+    context->src.buf[len] = '\0';
+    context->src.buf[len + 1] = '\0';
+    context->src.len = len;
+    context->src.maplen = 0;
+
+    return _parse(context);
+}
+
+/*
+ * minica_scan_buffer -- scan the source text in the specified buffer without
+ * parsing it, and return the number of the tokens
+ */
+ssize_t
+minica_scan_buffer(const char *buf, size_t len)
+{
+    context_t *context;
+    yyscan_t scanner;
+    YY_BUFFER_STATE bs;
+    YYSTYPE lval;
+    YYLTYPE lloc;
+    ssize_t n;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return -1;
+    }
+    context->src.buf = malloc(len + 2);
+    if ( NULL == context->src.buf ) {
+        free(context);
+        return -1;
+    }
+    memcpy(context->src.buf, buf, len);
+    context->src.buf[len] = '\0';
+    context->src.buf[len + 1] = '\0';
+    context->src.len = len;
+
+    n = -1;
+    if ( 0 == yylex_init_extra(context, &scanner) ) {
+        bs = yy_scan_buffer(context->src.buf, len + 2, scanner);
+        if ( NULL != bs ) {
+            memset(&lloc, 0, sizeof(YYLTYPE));
+            n = 0;
+            while ( (yylex)(&lval, &lloc, scanner) ) {
+                n++;
+            }
+            yy_delete_buffer(bs, scanner);
+        }
+        yylex_destroy(scanner);
+    }
+    free(context->src.buf);
+    free(context->buffer.buf);
+    free(context);
+
+    return n;
+}
+
+/*
+ * minica_parse_path -- parse the specified file by mapping it into memory
+ */
+st_t *
+minica_parse_path(const char *path)
+{
+    context_t *context;
+    struct stat sb;
+    size_t pagesize;
+    size_t maplen;
+    void *ptr;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if ( fd < 0 ) {
+        return NULL;
+    }
+    if ( fstat(fd, &sb) < 0 ) {
+        close(fd);
+        return NULL;
+    }
+
+    context = _context_new();
+    if ( NULL == context ) {
+        close(fd);
+        return NULL;
+    }
+
+    /* Reserve a private, zero-filled region with room for the two trailing
+       NUL characters required by the scanner, then map the file over the
+       head of the region.  The bytes following the end of the file in its
+       last page are zero-filled, and so are the anonymous pages. */
+    pagesize = sysconf(_SC_PAGESIZE);
+    maplen = ((size_t)sb.st_size + 2 + pagesize - 1) & ~(pagesize - 1);
+    ptr = mmap(NULL, maplen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON,
+               -1, 0);
+    if ( MAP_FAILED == ptr ) {
+        free(context);
+        close(fd);
+        return NULL;
+    }
+    if ( sb.st_size > 0 ) {
+        if ( MAP_FAILED == mmap(ptr, sb.st_size, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_FIXED, fd, 0) ) {
+            munmap(ptr, maplen);
+            free(context);
+            close(fd);
+            return NULL;
+        }
+    }
+    close(fd);
+
+    context->src.buf = ptr;
+    context->src.len = sb.st_size;
+    context->src.maplen = maplen;
+
+    return _parse(context);
+}
+
+/*
+ * minica_parse -- parse the specified file
+ */
+st_t *
+minica_parse(FILE *fp)
+{
+    context_t *context;
+    struct stat sb;
+    size_t size;
+    size_t len;
+    size_t n;
+    char *buf;
+    char *nbuf;
+
+    context = _context_new();
+    if ( NULL == context ) {
+        return NULL;
+    }
+
+    /* Use the file size as the initial buffer size when it is known */
+    size = 4096;
+    if ( 0 == fstat(fileno(fp), &sb) && S_ISREG(sb.st_mode) ) {
+        size = sb.st_size + 2;
+    }
+    buf = malloc(size);
+    if ( NULL == buf ) {
+        free(context);
+        return NULL;
+    }
+
+    /* Read the whole stream, doubling the buffer when it is full */
+    len = 0;
+    for ( ;; ) {
+        if ( len + 2 >= size ) {
+            nbuf = realloc(buf, size * 2);
+            if ( NULL == nbuf ) {
+                free(buf);
+                free(context);
+                return NULL;
+            }
+            buf = nbuf;
+            size *= 2;
+        }
+        n = fread(buf + len, 1, size - len - 2, fp);
+        if ( 0 == n ) {
+            break;
+        }
+        len += n;
+    }
+    buf[len] = '\0';
+    buf[len + 1] = '\0';
+
+    context->src.buf = buf;
+    context->src.len = len;
+    context->src.maplen = 0;
+
+    return _parse(context);
+}
+
+/*
+ * Local variables:
+ * tab-width: 4
+ * c-basic-offset: 4
+ * End:
+ * vim600: sw=4 ts=4 fdm=marker
+ * vim<600: sw=4 ts=4
+ */
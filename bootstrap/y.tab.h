@@ -0,0 +1,282 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_Y_TAB_H_INCLUDED
+# define YY_YY_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    TOK_LIT_FLOAT = 258,           /* TOK_LIT_FLOAT  */
+    TOK_LIT_HEXINT = 259,          /* TOK_LIT_HEXINT  */
+    TOK_LIT_DECINT = 260,          /* TOK_LIT_DECINT  */
+    TOK_LIT_OCTINT = 261,          /* TOK_LIT_OCTINT  */
+    TOK_ID = 262,                  /* TOK_ID  */
+    TOK_LIT_STR = 263,             /* TOK_LIT_STR  */
+    TOK_ADD = 264,                 /* TOK_ADD  */
+    TOK_SUB = 265,                 /* TOK_SUB  */
+    TOK_MUL = 266,                 /* TOK_MUL  */
+    TOK_DIV = 267,                 /* TOK_DIV  */
+    TOK_MOD = 268,                 /* TOK_MOD  */
+    TOK_INC = 269,                 /* TOK_INC  */
+    TOK_DEC = 270,                 /* TOK_DEC  */
+    TOK_DEF = 271,                 /* TOK_DEF  */
+    TOK_LAND = 272,                /* TOK_LAND  */
+    TOK_LOR = 273,                 /* TOK_LOR  */
+    TOK_NOT = 274,                 /* TOK_NOT  */
+    TOK_LPAREN = 275,              /* TOK_LPAREN  */
+    TOK_RPAREN = 276,              /* TOK_RPAREN  */
+    TOK_LBRACE = 277,              /* TOK_LBRACE  */
+    TOK_RBRACE = 278,              /* TOK_RBRACE  */
+    TOK_LBRACKET = 279,            /* TOK_LBRACKET  */
+    TOK_RBRACKET = 280,            /* TOK_RBRACKET  */
+    TOK_LCHEVRON = 281,            /* TOK_LCHEVRON  */
+    TOK_RCHEVRON = 282,            /* TOK_RCHEVRON  */
+    TOK_IF = 283,                  /* TOK_IF  */
+    TOK_ELSE = 284,                /* TOK_ELSE  */
+    TOK_WHILE = 285,               /* TOK_WHILE  */
+    TOK_SWITCH = 286,              /* TOK_SWITCH  */
+    TOK_CASE = 287,                /* TOK_CASE  */
+    TOK_DEFAULT = 288,             /* TOK_DEFAULT  */
+    TOK_EQ_EQ = 289,               /* TOK_EQ_EQ  */
+    TOK_NEQ = 290,                 /* TOK_NEQ  */
+    TOK_LEQ = 291,                 /* TOK_LEQ  */
+    TOK_GEQ = 292,                 /* TOK_GEQ  */
+    TOK_EQ = 293,                  /* TOK_EQ  */
+    TOK_COMMA = 294,               /* TOK_COMMA  */
+    TOK_DOT = 295,                 /* TOK_DOT  */
+    TOK_ATMARK = 296,              /* TOK_ATMARK  */
+    TOK_MODULE = 297,              /* TOK_MODULE  */
+    TOK_USE = 298,                 /* TOK_USE  */
+    TOK_INCLUDE = 299,             /* TOK_INCLUDE  */
+    TOK_FN = 300,                  /* TOK_FN  */
+    TOK_COROUTINE = 301,           /* TOK_COROUTINE  */
+    TOK_RETURN = 302,              /* TOK_RETURN  */
+    TOK_YIELD = 303,               /* TOK_YIELD  */
+    TOK_BIT_OR = 304,              /* TOK_BIT_OR  */
+    TOK_BIT_AND = 305,             /* TOK_BIT_AND  */
+    TOK_BIT_XOR = 306,             /* TOK_BIT_XOR  */
+    TOK_BIT_LSHIFT = 307,          /* TOK_BIT_LSHIFT  */
+    TOK_BIT_RSHIFT = 308,          /* TOK_BIT_RSHIFT  */
+    TOK_BIT_NOT = 309,             /* TOK_BIT_NOT  */
+    TOK_TYPE_I8 = 310,             /* TOK_TYPE_I8  */
+    TOK_TYPE_I16 = 311,            /* TOK_TYPE_I16  */
+    TOK_TYPE_I32 = 312,            /* TOK_TYPE_I32  */
+    TOK_TYPE_I64 = 313,            /* TOK_TYPE_I64  */
+    TOK_TYPE_U8 = 314,             /* TOK_TYPE_U8  */
+    TOK_TYPE_U16 = 315,            /* TOK_TYPE_U16  */
+    TOK_TYPE_U32 = 316,            /* TOK_TYPE_U32  */
+    TOK_TYPE_U64 = 317,            /* TOK_TYPE_U64  */
+    TOK_TYPE = 318,                /* TOK_TYPE  */
+    TOK_TYPEDEF = 319,             /* TOK_TYPEDEF  */
+    TOK_STRUCT = 320,              /* TOK_STRUCT  */
+    TOK_UNION = 321,               /* TOK_UNION  */
+    TOK_ENUM = 322,                /* TOK_ENUM  */
+    TOK_TYPE_FP32 = 323,           /* TOK_TYPE_FP32  */
+    TOK_TYPE_FP64 = 324,           /* TOK_TYPE_FP64  */
+    TOK_TYPE_STRING = 325,         /* TOK_TYPE_STRING  */
+    TOK_TYPE_BOOL = 326,           /* TOK_TYPE_BOOL  */
+    TOK_NIL = 327,                 /* TOK_NIL  */
+    TOK_TRUE = 328,                /* TOK_TRUE  */
+    TOK_FALSE = 329,               /* TOK_FALSE  */
+    TOK_COLON = 330,               /* TOK_COLON  */
+    TOK_SEMICOLON = 331,           /* TOK_SEMICOLON  */
+    SNOP = 332,                    /* SNOP  */
+    UNOP = 333,                    /* UNOP  */
+    ELSENOP = 334,                 /* ELSENOP  */
+    RETNOP = 335                   /* RETNOP  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define TOK_LIT_FLOAT 258
+#define TOK_LIT_HEXINT 259
+#define TOK_LIT_DECINT 260
+#define TOK_LIT_OCTINT 261
+#define TOK_ID 262
+#define TOK_LIT_STR 263
+#define TOK_ADD 264
+#define TOK_SUB 265
+#define TOK_MUL 266
+#define TOK_DIV 267
+#define TOK_MOD 268
+#define TOK_INC 269
+#define TOK_DEC 270
+#define TOK_DEF 271
+#define TOK_LAND 272
+#define TOK_LOR 273
+#define TOK_NOT 274
+#define TOK_LPAREN 275
+#define TOK_RPAREN 276
+#define TOK_LBRACE 277
+#define TOK_RBRACE 278
+#define TOK_LBRACKET 279
+#define TOK_RBRACKET 280
+#define TOK_LCHEVRON 281
+#define TOK_RCHEVRON 282
+#define TOK_IF 283
+#define TOK_ELSE 284
+#define TOK_WHILE 285
+#define TOK_SWITCH 286
+#define TOK_CASE 287
+#define TOK_DEFAULT 288
+#define TOK_EQ_EQ 289
+#define TOK_NEQ 290
+#define TOK_LEQ 291
+#define TOK_GEQ 292
+#define TOK_EQ 293
+#define TOK_COMMA 294
+#define TOK_DOT 295
+#define TOK_ATMARK 296
+#define TOK_MODULE 297
+#define TOK_USE 298
+#define TOK_INCLUDE 299
+#define TOK_FN 300
+#define TOK_COROUTINE 301
+#define TOK_RETURN 302
+#define TOK_YIELD 303
+#define TOK_BIT_OR 304
+#define TOK_BIT_AND 305
+#define TOK_BIT_XOR 306
+#define TOK_BIT_LSHIFT 307
+#define TOK_BIT_RSHIFT 308
+#define TOK_BIT_NOT 309
+#define TOK_TYPE_I8 310
+#define TOK_TYPE_I16 311
+#define TOK_TYPE_I32 312
+#define TOK_TYPE_I64 313
+#define TOK_TYPE_U8 314
+#define TOK_TYPE_U16 315
+#define TOK_TYPE_U32 316
+#define TOK_TYPE_U64 317
+#define TOK_TYPE 318
+#define TOK_TYPEDEF 319
+#define TOK_STRUCT 320
+#define TOK_UNION 321
+#define TOK_ENUM 322
+#define TOK_TYPE_FP32 323
+#define TOK_TYPE_FP64 324
+#define TOK_TYPE_STRING 325
+#define TOK_TYPE_BOOL 326
+#define TOK_NIL 327
+#define TOK_TRUE 328
+#define TOK_FALSE 329
+#define TOK_COLON 330
+#define TOK_SEMICOLON 331
+#define SNOP 332
+#define UNOP 333
+#define ELSENOP 334
+#define RETNOP 335
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 56 "minica.y"
+
+    st_t *file;
+    module_t *module;
+    outer_block_t *oblock;
+    outer_block_entry_t *obent;
+    inner_block_t *iblock;
+    slice_t numval;
+    const char *idval;
+    const char *strval;
+    type_t *type;
+    directive_t *directive;
+    decl_t *decl;
+    decl_list_t *decl_list;
+    expr_list_t *exprs;
+    expr_t *expr;
+    switch_case_t *swcase;
+    switch_block_t *swblock;
+    literal_t *lit;
+    literal_set_t *lset;
+    arg_list_t *args;
+    arg_t *arg;
+    enum_elem_t *enum_elem;
+    coroutine_t *coroutine;
+    func_t *func;
+    stmt_t *stmt;
+    stmt_list_t *stmts;
+
+#line 255 "y.tab.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+
+
+int yyparse (void *scanner);
+
+
+#endif /* !YY_YY_Y_TAB_H_INCLUDED  */
@@ -0,0 +1,23 @@
+// Control flow
+
+fn main(x: i32, n: i32) (r: i32)
+{
+    s: i32 := 0
+    i: i32 := 0
+    while i < n {
+        if x > i {
+            s := s + x
+        } else {
+            s := s - 1
+        }
+        i++
+    }
+    switch s {
+        case 1, 2:
+            r := 10
+        case 3:
+            r := 20
+        default:
+            r := s
+    }
+}
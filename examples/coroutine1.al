@@ -0,0 +1,37 @@
+// Coroutines
+
+coroutine counter(n: i64) (r: i64)
+{
+    i: i64 := 0
+    while i < n {
+        yield i
+        i++
+    }
+    r := n
+}
+
+coroutine fib(n: i64) (r: i64)
+{
+    a: i64 := 0
+    b: i64 := 1
+    t: i64 := 0
+    i: i64 := 0
+    while i < n {
+        yield a
+        t := a + b
+        a := b
+        b := t
+        i++
+    }
+    r := a
+}
+
+coroutine squares(n: i64) (i: i64, s: i64)
+{
+    i := 0
+    while i < n {
+        s := i * i
+        yield i
+        i++
+    }
+}
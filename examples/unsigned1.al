@@ -0,0 +1,116 @@
+// Unsigned and narrow integers
+
+fn wrap(x: u8, y: i8) (r: i64)
+{
+    a: u8 := x + 1
+    b: i8 := y + 1
+    q: u8 := a / 2
+    s: i64 := b
+    r := a
+    r := r * 1000 + q * 10
+    r := r * 1000 + s
+}
+
+fn shift(x: u64, n: u64) (r: u64)
+{
+    r := x >> n
+}
+
+fn less(x: u64, y: u64) (r: i64)
+{
+    r := 0
+    if x < y {
+        r := 1
+    }
+}
+
+fn below(x: u32, y: u32) (r: bool)
+{
+    r := x < y
+}
+
+fn folded() (r: u64)
+{
+    a: u64 := 0xffffffffffffffff
+    r := a >> 60
+    if 1 < a {
+        r := r + 100
+    }
+}
+
+fn udiv(x: u64) (r: u64)
+{
+    r := x / 3 + x % 8
+}
+
+fn udiv7(x: u32, y: u64) (r: u64)
+{
+    a: u32 := x / 7 + x % 7
+    r := y / 7
+    r := r + a
+}
+
+fn udivv(x: u64, y: u64) (r: u64)
+{
+    r := x / y + x / 0x8000000000000001
+}
+
+fn udiv8(x: u8) (r: i64)
+{
+    a: i64 := x / 3
+    b: i64 := x % 3
+    c: i64 := x / 7
+    d: i64 := x % 7
+    e: i64 := x / 10
+    f: i64 := x % 10
+    r := a
+    r := r * 1000 + b
+    r := r * 1000 + c
+    r := r * 1000 + d
+    r := r * 1000 + e
+    r := r * 1000 + f
+}
+
+fn sdiv8(x: i8) (r: i64)
+{
+    a: i64 := x / 3
+    b: i64 := x % 3
+    c: i64 := x / 7
+    d: i64 := x % 7
+    e: i64 := x / 10
+    f: i64 := x % 10
+    r := a
+    r := r * 1000 + b
+    r := r * 1000 + c
+    r := r * 1000 + d
+    r := r * 1000 + e
+    r := r * 1000 + f
+}
+
+fn udiv16(x: u16) (r: i64)
+{
+    a: i64 := x / 3
+    b: i64 := x / 7
+    c: i64 := x / 10
+    d: i64 := x % 3
+    e: i64 := x % 7
+    f: i64 := x % 10
+    r := a
+    r := r * 100000 + b
+    r := r * 100000 + c
+    r := r * 1000 + d * 100 + e * 10 + f
+}
+
+fn sdiv16(x: i16) (r: i64)
+{
+    a: i64 := x / 3
+    b: i64 := x / 7
+    c: i64 := x / 10
+    d: i64 := x % 3
+    e: i64 := x % 7
+    f: i64 := x % 10
+    r := a
+    r := r * 100000 + b
+    r := r * 100000 + c
+    r := r * 1000 + d * 100 + e * 10 + f
+}
@@ -24,13 +24,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "alang.h"
 #include "tokenizer.h"
 #include "parser.h"
 #include "compiler.h"
 
-#define FILE_MEMSIZE_DELTA  4096
-
 /*
  * Print out the help message and quit the program
  */
@@ -47,48 +48,46 @@ usage(const char *prog)
 char *
 load_file(const char *fname)
 {
-    FILE *fp;
-    char buf[1024];
+    struct stat sb;
     char *content;
-    char *nb;
-    off_t off;
-    size_t sz;
-    size_t len;
+    ssize_t n;
+    size_t off;
+    int fd;
 
     /* Open the input file */
-    fp = fopen(fname, "r");
-    if ( NULL == fp ) {
+    fd = open(fname, O_RDONLY);
+    if ( fd < 0 ) {
         return NULL;
     }
 
-    /* Allocate memory */
-    content = malloc(FILE_MEMSIZE_DELTA);
+    /* Allocate memory for the whole file at once */
+    if ( fstat(fd, &sb) < 0 ) {
+        (void)close(fd);
+        return NULL;
+    }
+    content = malloc(sb.st_size + 1);
     if ( NULL == content ) {
-        (void)fclose(fp);
+        (void)close(fd);
         return NULL;
     }
-    sz = FILE_MEMSIZE_DELTA;
 
+    /* Read the content */
     off = 0;
-    while ( NULL != fgets(buf, sizeof(buf), fp) ) {
-        len = strlen(buf);
-        /* Expand the memory */
-        while ( sz <= off + len ) {
-            nb = realloc(content, sz + FILE_MEMSIZE_DELTA);
-            if ( NULL == nb ) {
-                free(content);
-                (void)fclose(fp);
-                return NULL;
-            }
-            sz += FILE_MEMSIZE_DELTA;
+    while ( off < (size_t)sb.st_size ) {
+        n = read(fd, content + off, sb.st_size - off);
+        if ( n < 0 ) {
+            free(content);
+            (void)close(fd);
+            return NULL;
+        } else if ( 0 == n ) {
+            break;
         }
-        memcpy(content + off, buf, len);
-        off += len;
-        content[off] = '\0';
+        off += n;
     }
+    content[off] = '\0';
 
     /* Close the file */
-    (void)fclose(fp);
+    (void)close(fd);
 
     return content;
 }